@@ -0,0 +1,159 @@
+/*
+Builds geometry::BVH over UV spheres of 1K to 10M triangles and measures:
+    - build: construction time on one thread and on the default job system;
+    - raycast: rays from random points around the sphere towards random
+      points inside it, so most rays hit;
+    - closest point: queries from random points near the surface of the sphere;
+    - overlap: triangles overlapping small random boxes on the sphere.
+Query rates are single-threaded, in millions of queries per second, followed
+by the fraction of rays that hit and the mean number of overlapping triangles.
+
+Then the spheres are deformed by a travelling ripple and BVH::refit() is
+timed over the steps, with the fraction of triangles it rebuilt and the SAH
+cost of the refit BVH against that of a new one on the last step.
+
+Usage: bvh_benchmark [largest number of triangles] [queries] [deformation steps]
+*/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bvh.hpp"
+#include "shapes/procedural.hpp"
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+double seconds_since(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+glm::vec3 random_point(std::mt19937& generator, float extent)
+{
+    std::uniform_real_distribution<float> distribution{-extent, extent};
+    return glm::vec3{distribution(generator), distribution(generator), distribution(generator)};
+}
+
+physscope::geometry::IndexedTriangleMesh make_sphere(std::size_t num_triangles)
+{
+    // A UV sphere with n segments and n rings has about 2 n^2 triangles
+    const auto resolution{static_cast<std::size_t>(std::sqrt(static_cast<double>(num_triangles) / 2.0))};
+    return physscope::shapes::make_uv_sphere(resolution, resolution);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    using namespace physscope::geometry;
+
+    const std::size_t max_triangles{argc > 1 ? std::stoul(argv[1]) : std::size_t{10'000'000}};
+    const std::size_t num_queries{argc > 2 ? std::stoul(argv[2]) : std::size_t{100'000}};
+    const std::size_t num_steps{argc > 3 ? std::stoul(argv[3]) : std::size_t{20}};
+
+    physscope::JobSystem single_thread{1};
+    std::cout << std::setw(10) << "triangles" << std::setw(8) << "depth" << std::setw(14) << "build 1T (ms)"
+              << std::setw(14) << "build (ms)" << std::setw(12) << "rays (M/s)" << std::setw(14) << "closest (M/s)"
+              << std::setw(14) << "overlap (M/s)" << std::setw(10) << "hit rate" << std::setw(10) << "overlaps"
+              << '\n';
+    for (std::size_t num_triangles = 1'000; num_triangles <= max_triangles; num_triangles *= 10)
+    {
+        const IndexedTriangleMesh mesh{make_sphere(num_triangles)};
+
+        Clock::time_point start{Clock::now()};
+        const BVH single_thread_bvh{mesh, BVHBuildSettings{}, single_thread};
+        const double single_thread_build{seconds_since(start)};
+
+        start = Clock::now();
+        const BVH bvh{mesh};
+        const double build{seconds_since(start)};
+
+        std::mt19937 generator{42};
+        std::size_t hits{0};
+        start = Clock::now();
+        for (std::size_t i = 0; i < num_queries; ++i)
+        {
+            const glm::vec3 origin{random_point(generator, 2.0f)};
+            const Ray ray{.origin = origin, .direction = random_point(generator, 0.5f) - origin};
+            hits += bvh.raycast(ray).has_value() ? 1 : 0;
+        }
+        const double raycast{seconds_since(start)};
+
+        std::uniform_real_distribution<float> distance{-0.1f, 0.1f};
+        start = Clock::now();
+        for (std::size_t i = 0; i < num_queries; ++i)
+        {
+            const glm::vec3 point{glm::normalize(random_point(generator, 1.0f)) * (1.0f + distance(generator))};
+            static_cast<void>(bvh.closest_point(point));
+        }
+        const double closest_point{seconds_since(start)};
+
+        std::size_t num_overlapping{0};
+        std::vector<std::size_t> overlapping;
+        start = Clock::now();
+        for (std::size_t i = 0; i < num_queries; ++i)
+        {
+            const glm::vec3 center{glm::normalize(random_point(generator, 1.0f))};
+            const AABB box{.min = center - glm::vec3{0.01f}, .max = center + glm::vec3{0.01f}};
+            overlapping.clear();
+            bvh.overlapping_triangles(box, overlapping);
+            num_overlapping += overlapping.size();
+        }
+        const double overlap{seconds_since(start)};
+
+        const auto rate{[&](double seconds) { return static_cast<double>(num_queries) / seconds / 1.0e6; }};
+        std::cout << std::setw(10) << mesh.num_indices() << std::setw(8) << bvh.depth() << std::fixed
+                  << std::setprecision(2) << std::setw(14) << single_thread_build * 1.0e3 << std::setw(14)
+                  << build * 1.0e3 << std::setw(12) << rate(raycast) << std::setw(14) << rate(closest_point)
+                  << std::setw(14) << rate(overlap) << std::setw(10)
+                  << static_cast<double>(hits) / static_cast<double>(num_queries) << std::setw(10)
+                  << static_cast<double>(num_overlapping) / static_cast<double>(num_queries) << std::defaultfloat
+                  << '\n';
+    }
+
+    std::cout << '\n'
+              << num_steps << " deformation steps\n"
+              << std::setw(10) << "triangles" << std::setw(14) << "refit (ms)" << std::setw(18) << "max refit (ms)"
+              << std::setw(12) << "rebuilt" << std::setw(12) << "SAH cost" << std::setw(14) << "new SAH cost" << '\n';
+    for (std::size_t num_triangles = 1'000; num_triangles <= max_triangles; num_triangles *= 10)
+    {
+        IndexedTriangleMesh mesh{make_sphere(num_triangles)};
+        const std::vector<glm::vec3> rest{mesh.vertices};
+        BVH bvh{mesh};
+
+        double total_seconds{0.0};
+        double max_seconds{0.0};
+        std::size_t num_rebuilt{0};
+        for (std::size_t step = 1; step <= num_steps; ++step)
+        {
+            const float phase{0.3f * static_cast<float>(step)};
+            for (std::size_t i = 0; i < rest.size(); ++i)
+            {
+                mesh.vertices[i] = rest[i] * (1.0f + 0.05f * std::sin(8.0f * rest[i].y + phase));
+            }
+
+            const Clock::time_point start{Clock::now()};
+            num_rebuilt += bvh.refit(mesh.vertices);
+            const double seconds{seconds_since(start)};
+            total_seconds += seconds;
+            max_seconds = std::max(max_seconds, seconds);
+        }
+
+        std::cout << std::setw(10) << mesh.num_indices() << std::fixed << std::setprecision(2) << std::setw(14)
+                  << total_seconds / static_cast<double>(num_steps) * 1.0e3 << std::setw(18) << max_seconds * 1.0e3
+                  << std::setw(12)
+                  << static_cast<double>(num_rebuilt) / static_cast<double>(num_steps * mesh.num_indices())
+                  << std::setw(12) << bvh.sah_cost() << std::setw(14) << BVH{mesh}.sah_cost() << std::defaultfloat
+                  << '\n';
+    }
+    return 0;
+}
\ No newline at end of file
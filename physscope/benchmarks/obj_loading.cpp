@@ -0,0 +1,123 @@
+/*
+Compares the OBJ loaders on a large mesh:
+    - tinyobj: read_triangle_mesh_obj(), which parses the file into tinyobj's
+      structures and then copies them into an IndexedTriangleMesh;
+    - mapped: read_triangle_mesh_obj_mapped(), which memory-maps the file and
+      parses it in parallel directly into the IndexedTriangleMesh;
+    - binary: MeshFile, which memory-maps the mesh converted to the binary
+      mesh format and uses its arrays in place (every page is read once, so
+      page faults are included).
+Without an OBJ file, a UV sphere with about the requested number of triangles
+is written to a temporary file first.
+
+Usage: obj_loading_benchmark [OBJ file | number of triangles] [repetitions]
+*/
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "io.hpp"
+#include "mesh_file.hpp"
+#include "shapes/procedural.hpp"
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+std::filesystem::path write_sphere(std::size_t num_triangles)
+{
+    // A UV sphere with n segments and n rings has about 2 n^2 triangles
+    const auto resolution{static_cast<std::size_t>(std::sqrt(static_cast<double>(num_triangles) / 2.0))};
+    const physscope::geometry::IndexedTriangleMesh mesh{
+        physscope::shapes::make_uv_sphere(std::max(resolution, std::size_t{3}), std::max(resolution, std::size_t{2}))};
+
+    const std::filesystem::path filename{std::filesystem::temp_directory_path() / "physscope_benchmark.obj"};
+    std::ofstream output{filename};
+    output << std::fixed << std::setprecision(6);
+    for (const glm::vec3& vertex : mesh.vertices)
+    {
+        output << "v " << vertex.x << ' ' << vertex.y << ' ' << vertex.z << '\n';
+    }
+    for (const std::array<std::uint32_t, 3>& triangle : mesh.indices)
+    {
+        output << "f " << triangle[0] + 1 << ' ' << triangle[1] + 1 << ' ' << triangle[2] + 1 << '\n';
+    }
+    return filename;
+}
+
+void report(const std::string& name, std::size_t repetitions, std::uintmax_t file_size,
+            const std::function<std::size_t()>& load)
+{
+    double best_seconds{0.0};
+    std::size_t num_triangles{0};
+    for (std::size_t i = 0; i < repetitions; ++i)
+    {
+        const Clock::time_point start{Clock::now()};
+        num_triangles = load();
+        const double seconds{std::chrono::duration<double>(Clock::now() - start).count()};
+        best_seconds = i == 0 ? seconds : std::min(best_seconds, seconds);
+    }
+
+    std::cout << std::left << std::setw(12) << name << std::right << std::fixed << std::setprecision(3)
+              << std::setw(12) << best_seconds << std::setprecision(1) << std::setw(12)
+              << static_cast<double>(file_size) / 1.0e6 / best_seconds << std::setw(16)
+              << static_cast<double>(num_triangles) / 1.0e6 / best_seconds << std::setw(14) << num_triangles
+              << '\n';
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::string source{argc > 1 ? argv[1] : "2000000"};
+    const std::size_t repetitions{argc > 2 ? std::stoul(argv[2]) : std::size_t{3}};
+    const bool is_generated{
+        std::all_of(source.begin(), source.end(), [](unsigned char c) { return std::isdigit(c) != 0; })};
+    const std::filesystem::path filename{is_generated ? write_sphere(std::stoul(source))
+                                                      : std::filesystem::path{source}};
+    const std::uintmax_t file_size{std::filesystem::file_size(filename)};
+
+    std::cout << filename.string() << ": " << static_cast<double>(file_size) / 1.0e6 << " MB; best of "
+              << repetitions << " runs\n";
+    std::cout << std::left << std::setw(12) << "loader" << std::right << std::setw(12) << "time (s)" << std::setw(12)
+              << "MB/s" << std::setw(16) << "Mtriangles/s" << std::setw(14) << "triangles" << '\n';
+    report("tinyobj", repetitions, file_size,
+           [&filename] { return physscope::read_triangle_mesh_obj(filename.string()).num_indices(); });
+    report("mapped", repetitions, file_size,
+           [&filename] { return physscope::read_triangle_mesh_obj_mapped(filename).num_indices(); });
+
+    std::filesystem::path binary_filename{filename};
+    binary_filename.replace_extension(".psm");
+    physscope::write_mesh_file(binary_filename, physscope::read_triangle_mesh_obj_mapped(filename));
+    report("binary", repetitions, std::filesystem::file_size(binary_filename),
+           [&binary_filename]
+           {
+               const physscope::MeshFile file{binary_filename};
+               std::uint64_t checksum{0};
+               for (const std::array<std::uint32_t, 3>& triangle : file.indices())
+               {
+                   checksum += triangle[0];
+               }
+               for (const glm::vec3& vertex : file.vertices())
+               {
+                   checksum += static_cast<std::uint64_t>(vertex.x != 0.0f);
+               }
+               return checksum > 0 ? file.indices().size() : std::size_t{0};
+           });
+
+    std::filesystem::remove(binary_filename);
+    if (is_generated)
+    {
+        std::filesystem::remove(filename);
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+/*
+Compares physscope::Semaphore (atomic fast path, spin-then-park) with the
+previous implementation based on a std::mutex and a std::condition_variable:
+    - ping-pong: two threads alternately release each other's semaphore;
+      reports the mean time of a round trip;
+    - uncontended: a single thread releases and acquires the same semaphore;
+      reports the number of release/acquire pairs per second.
+
+Usage: semaphore_benchmark [round trips] [uncontended iterations]
+*/
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "semaphore.hpp"
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+// Previous physscope::Semaphore, kept as a baseline
+class MutexSemaphore
+{
+public:
+    explicit MutexSemaphore(std::size_t initial_counter) noexcept : counter_{initial_counter}
+    {
+    }
+
+    void release() noexcept
+    {
+        std::scoped_lock lock_protection{mutex_};
+        ++counter_;
+        condition_.notify_one();
+    }
+
+    void acquire() noexcept
+    {
+        std::unique_lock<std::mutex> lock_protection{mutex_};
+        condition_.wait(lock_protection, [&counter = counter_] { return counter > 0; });
+        --counter_;
+    }
+
+private:
+    std::size_t counter_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+};
+
+template <typename Semaphore>
+double ping_pong_ns(std::size_t round_trips)
+{
+    Semaphore ping{0};
+    Semaphore pong{0};
+    std::thread partner{[&]
+                        {
+                            for (std::size_t i = 0; i < round_trips; ++i)
+                            {
+                                ping.acquire();
+                                pong.release();
+                            }
+                        }};
+
+    const Clock::time_point start{Clock::now()};
+    for (std::size_t i = 0; i < round_trips; ++i)
+    {
+        ping.release();
+        pong.acquire();
+    }
+    const Clock::duration elapsed{Clock::now() - start};
+    partner.join();
+    return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(round_trips);
+}
+
+template <typename Semaphore>
+double uncontended_per_second(std::size_t iterations)
+{
+    Semaphore semaphore{1};
+    const Clock::time_point start{Clock::now()};
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        semaphore.acquire();
+        semaphore.release();
+    }
+    const double seconds{std::chrono::duration<double>(Clock::now() - start).count()};
+    return static_cast<double>(iterations) / seconds;
+}
+
+template <typename Semaphore>
+void report(const std::string& name, std::size_t round_trips, std::size_t iterations)
+{
+    std::cout << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(20) << ping_pong_ns<Semaphore>(round_trips) << std::setw(24)
+              << uncontended_per_second<Semaphore>(iterations) / 1.0e6 << '\n';
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t round_trips{argc > 1 ? std::stoul(argv[1]) : std::size_t{100'000}};
+    const std::size_t iterations{argc > 2 ? std::stoul(argv[2]) : std::size_t{10'000'000}};
+
+    std::cout << std::left << std::setw(20) << "semaphore" << std::right << std::setw(20) << "round trip (ns)"
+              << std::setw(24) << "uncontended (Mops/s)" << '\n';
+    report<MutexSemaphore>("mutex + condition", round_trips, iterations);
+    report<physscope::Semaphore>("atomic wait", round_trips, iterations);
+    return 0;
+}
\ No newline at end of file
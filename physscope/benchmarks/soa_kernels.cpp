@@ -0,0 +1,111 @@
+/*
+Compares bulk vertex kernels on interleaved glm::vec3 vertices (AoS, as in
+IndexedTriangleMesh) and on geometry::SoAVertices:
+    - transform: apply an affine transform to every vertex, in place;
+    - bounds: axis-aligned bounding box of the vertices;
+    - centroid: mean of the vertices.
+Reports the best time of each kernel and the bandwidth it reached, counting
+the bytes read (and written, for transform) once.
+
+Usage: soa_kernels_benchmark [number of vertices] [repetitions]
+*/
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "soa_mesh.hpp"
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+void report(const std::string& name, std::size_t repetitions, double bytes, const std::function<float()>& kernel)
+{
+    double best_seconds{0.0};
+    float checksum{0.0f};
+    for (std::size_t i = 0; i < repetitions; ++i)
+    {
+        const Clock::time_point start{Clock::now()};
+        checksum += kernel();
+        const double seconds{std::chrono::duration<double>(Clock::now() - start).count()};
+        best_seconds = i == 0 ? seconds : std::min(best_seconds, seconds);
+    }
+
+    std::cout << std::left << std::setw(16) << name << std::right << std::fixed << std::setprecision(3)
+              << std::setw(12) << best_seconds * 1.0e3 << std::setprecision(1) << std::setw(12)
+              << bytes / 1.0e9 / best_seconds << std::setw(16) << std::scientific << std::setprecision(3) << checksum
+              << std::defaultfloat << '\n';
+}
+
+glm::vec3 aos_centroid(const std::vector<glm::vec3>& vertices)
+{
+    double x{0.0};
+    double y{0.0};
+    double z{0.0};
+    for (const glm::vec3& vertex : vertices)
+    {
+        x += vertex.x;
+        y += vertex.y;
+        z += vertex.z;
+    }
+    const auto count{static_cast<double>(vertices.size())};
+    return glm::vec3{static_cast<float>(x / count), static_cast<float>(y / count), static_cast<float>(z / count)};
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t num_vertices{argc > 1 ? std::stoul(argv[1]) : std::size_t{10'000'000}};
+    const std::size_t repetitions{argc > 2 ? std::stoul(argv[2]) : std::size_t{10}};
+
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<float> distribution{-1.0f, 1.0f};
+    std::vector<glm::vec3> aos(num_vertices);
+    for (glm::vec3& vertex : aos)
+    {
+        vertex = glm::vec3{distribution(generator), distribution(generator), distribution(generator)};
+    }
+    physscope::geometry::SoAVertices soa{aos};
+
+    // A small rotation and translation, so repeated transforms stay bounded
+    glm::mat4 transform{1.0f};
+    transform[0][0] = 0.99995f;
+    transform[0][1] = 0.01f;
+    transform[1][0] = -0.01f;
+    transform[1][1] = 0.99995f;
+    transform[3][2] = 1.0e-4f;
+
+    const double bytes{static_cast<double>(num_vertices * sizeof(glm::vec3))};
+    std::cout << num_vertices << " vertices; best of " << repetitions << " runs\n";
+    std::cout << std::left << std::setw(16) << "kernel" << std::right << std::setw(12) << "time (ms)" << std::setw(12)
+              << "GB/s" << std::setw(16) << "checksum" << '\n';
+
+    report("transform AoS", repetitions, 2.0 * bytes,
+           [&]
+           {
+               for (glm::vec3& vertex : aos)
+               {
+                   vertex = glm::vec3{transform * glm::vec4{vertex, 1.0f}};
+               }
+               return aos[0].x;
+           });
+    report("transform SoA", repetitions, 2.0 * bytes,
+           [&]
+           {
+               soa.transform(transform);
+               return soa.vertex(0).x;
+           });
+    report("bounds AoS", repetitions, bytes, [&] { return physscope::geometry::bounds(aos).max.x; });
+    report("bounds SoA", repetitions, bytes, [&] { return physscope::geometry::bounds(soa).max.x; });
+    report("centroid AoS", repetitions, bytes, [&] { return aos_centroid(aos).x; });
+    report("centroid SoA", repetitions, bytes, [&] { return physscope::geometry::centroid(soa).x; });
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,207 @@
+/*
+Compares the exchange of simulation state between a simulation thread
+(producer) and a render thread (consumer) using:
+    - the three-semaphore handshake, where both threads run in lockstep
+      (one physics step per rendered frame);
+    - a lock-free TripleBuffer, where the simulation runs freely and the
+      render thread reads the newest published state.
+The cost of a physics step and of a rendered frame is emulated by busy waiting.
+
+Usage: state_exchange_benchmark [seconds] [step cost (us)] [frame cost (us)]
+*/
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "semaphore.hpp"
+#include "triple_buffer.hpp"
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+struct State
+{
+    std::array<float, 64> data{};
+    std::uint64_t step{0};
+    Clock::time_point timestamp{};
+};
+
+struct Settings
+{
+    std::chrono::duration<double> duration{2.0};
+    std::chrono::microseconds step_cost{200};
+    std::chrono::microseconds frame_cost{4000};
+};
+
+struct Result
+{
+    std::uint64_t steps{0};
+    std::vector<double> latencies_ms;
+    std::vector<double> waits_ms;
+};
+
+void busy_work(std::chrono::microseconds cost)
+{
+    const Clock::time_point end{Clock::now() + cost};
+    while (Clock::now() < end)
+    {
+    }
+}
+
+void simulate_step(State& state)
+{
+    for (float& value : state.data)
+    {
+        value += 1.0f;
+    }
+    ++state.step;
+    state.timestamp = Clock::now();
+}
+
+double milliseconds(Clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+Result run_semaphores(const Settings& settings)
+{
+    physscope::Semaphore empty{1};
+    physscope::Semaphore full{0};
+    physscope::Semaphore mutex{1};
+    std::atomic<bool> running{true};
+    State state{};
+    Result result{};
+
+    std::thread producer{[&]
+                         {
+                             while (true)
+                             {
+                                 empty.acquire();
+                                 if (!running.load())
+                                 {
+                                     break;
+                                 }
+                                 mutex.acquire();
+                                 busy_work(settings.step_cost);
+                                 simulate_step(state);
+                                 mutex.release();
+                                 full.release();
+                             }
+                         }};
+
+    const Clock::time_point end{Clock::now() + std::chrono::duration_cast<Clock::duration>(settings.duration)};
+    while (Clock::now() < end)
+    {
+        busy_work(settings.frame_cost);
+        const Clock::time_point wait_start{Clock::now()};
+        full.acquire();
+        mutex.acquire();
+        const Clock::time_point now{Clock::now()};
+        result.waits_ms.emplace_back(milliseconds(now - wait_start));
+        result.latencies_ms.emplace_back(milliseconds(now - state.timestamp));
+        result.steps = state.step;
+        mutex.release();
+        empty.release();
+    }
+
+    running.store(false);
+    empty.release();
+    producer.join();
+    return result;
+}
+
+Result run_triple_buffer(const Settings& settings)
+{
+    physscope::TripleBuffer<State> buffer{};
+    std::atomic<bool> running{true};
+    std::atomic<std::uint64_t> steps{0};
+    Result result{};
+
+    std::thread producer{[&]
+                         {
+                             State state{};
+                             while (running.load())
+                             {
+                                 busy_work(settings.step_cost);
+                                 simulate_step(state);
+                                 buffer.write_buffer() = state;
+                                 buffer.publish();
+                             }
+                             steps.store(state.step);
+                         }};
+
+    const Clock::time_point end{Clock::now() + std::chrono::duration_cast<Clock::duration>(settings.duration)};
+    while (Clock::now() < end)
+    {
+        busy_work(settings.frame_cost);
+        const Clock::time_point wait_start{Clock::now()};
+        buffer.update();
+        const Clock::time_point now{Clock::now()};
+        result.waits_ms.emplace_back(milliseconds(now - wait_start));
+        result.latencies_ms.emplace_back(milliseconds(now - buffer.read_buffer().timestamp));
+    }
+
+    running.store(false);
+    producer.join();
+    result.steps = steps.load();
+    return result;
+}
+
+double percentile(std::vector<double> values, double fraction)
+{
+    if (values.empty())
+    {
+        return 0.0;
+    }
+    std::sort(values.begin(), values.end());
+    const auto index{static_cast<std::size_t>(fraction * static_cast<double>(values.size() - 1))};
+    return values[index];
+}
+
+void report(const std::string& name, const Result& result, const Settings& settings)
+{
+    const double seconds{settings.duration.count()};
+    std::cout << std::left << std::setw(16) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << static_cast<double>(result.steps) / seconds << std::setw(12)
+              << static_cast<double>(result.latencies_ms.size()) / seconds << std::setprecision(3) << std::setw(14)
+              << percentile(result.latencies_ms, 0.5) << std::setw(14) << percentile(result.latencies_ms, 0.99)
+              << std::setw(12) << percentile(result.waits_ms, 0.5) << std::setw(12)
+              << percentile(result.waits_ms, 0.99) << '\n';
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    Settings settings{};
+    if (argc > 1)
+    {
+        settings.duration = std::chrono::duration<double>{std::stod(argv[1])};
+    }
+    if (argc > 2)
+    {
+        settings.step_cost = std::chrono::microseconds{std::stol(argv[2])};
+    }
+    if (argc > 3)
+    {
+        settings.frame_cost = std::chrono::microseconds{std::stol(argv[3])};
+    }
+
+    std::cout << "Duration: " << settings.duration.count() << " s; step cost: " << settings.step_cost.count()
+              << " us; frame cost: " << settings.frame_cost.count() << " us\n";
+    std::cout << std::left << std::setw(16) << "scheme" << std::right << std::setw(12) << "steps/s" << std::setw(12)
+              << "frames/s" << std::setw(14) << "age p50 (ms)" << std::setw(14) << "age p99 (ms)" << std::setw(12)
+              << "wait p50" << std::setw(12) << "wait p99" << '\n';
+    report("semaphores", run_semaphores(settings), settings);
+    report("triple buffer", run_triple_buffer(settings), settings);
+    return 0;
+}
\ No newline at end of file
@@ -1,16 +1,23 @@
 #include <algorithm>
+#include <chrono>
+#include <fstream>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtx/string_cast.hpp>
+#include <memory>
 #include <polyscope/point_cloud.h>
 #include <polyscope/surface_mesh.h>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include "application.hpp"
+#include "ensemble.hpp"
 #include "geometry.hpp"
 #include "implot.h"
-#include "io.hpp"
 #include "shapes/uv_sphere.hpp"
+#include "trace.hpp"
+#include "triple_buffer.hpp"
 
 class Simulation : public physscope::Application
 {
@@ -18,7 +25,13 @@ public:
     // Note that Polyscope structures should NOT be created or
     // initialized inside the constructor. They should be created
     // and accessed only inside initialize() and pre_draw().
-    Simulation() = default;
+    Simulation()
+    {
+        set_fixed_time_step(0.005f);
+        set_max_steps_per_frame(50);
+        set_checkpoint_interval(1.0);
+    }
+
     ~Simulation() override = default;
 
     /*
@@ -28,9 +41,59 @@ public:
     void initialize() override
     {
         // Note: struct Ball is defined on the private section of this class
-        ball = Ball{start_position, "ball", physscope::shapes::uv_sphere, ""};
-        polyscope::view::lookAt(glm::vec3{0.0f, 20.0f, 20.0f}, glm::vec3{0.0f, 0.0f, 0.0f});
+        ball = Ball{start_position};
+        times.clear();
         positions.clear();
+        if (is_headless())
+        {
+            return;
+        }
+
+        ball.register_mesh_view("ball", physscope::shapes::uv_sphere());
+        polyscope::view::lookAt(glm::vec3{0.0f, 20.0f, 20.0f}, glm::vec3{0.0f, 0.0f, 0.0f});
+    }
+
+    /*
+    Apply changes made on the "World Variables" widgets; this is
+    called on the simulation thread, so it's safe to modify the
+    variables used by physics_update().
+    */
+    void set_parameter(std::string_view name, float value) override
+    {
+        if (name == "ball_mass")
+        {
+            world.ball_mass = value;
+        }
+        else if (name == "gravity.y")
+        {
+            world.gravity.y = value;
+        }
+        else if (name == "air_resistance_coefficient")
+        {
+            world.air_resistance_coefficient = value;
+        }
+        else if (name == "wind_velocity.x")
+        {
+            world.wind_velocity.x = value;
+        }
+        else if (name == "wind_velocity.y")
+        {
+            world.wind_velocity.y = value;
+        }
+        else if (name == "wind_velocity.z")
+        {
+            world.wind_velocity.z = value;
+        }
+    }
+
+    std::vector<std::pair<std::string, float>> current_parameters() const override
+    {
+        return {{"ball_mass", world.ball_mass},
+                {"gravity.y", world.gravity.y},
+                {"air_resistance_coefficient", world.air_resistance_coefficient},
+                {"wind_velocity.x", world.wind_velocity.x},
+                {"wind_velocity.y", world.wind_velocity.y},
+                {"wind_velocity.z", world.wind_velocity.z}};
     }
 
     /*
@@ -42,63 +105,123 @@ public:
     {
         if (is_animating())
         {
-            const float time_step{0.005f};
-            int substep{0};
-            while (delta_time > 1e-9f)
-            {
-                if (substep >= max_num_substeps)
-                {
-                    std::cout << "WARNING: physics update reached maximum number of substeps." << std::endl;
-                    break;
-                }
+            // Cache variables at n-th time step
+            const glm::vec3 current_position{ball.position};
+            const glm::vec3 current_velocity{ball.velocity};
+            const glm::vec3 acceleration{
+                world.gravity -
+                ((world.air_resistance_coefficient / world.ball_mass) * (world.wind_velocity - current_velocity))};
 
-                const float dt{std::min(delta_time, time_step)};
-                // Cache variables at n-th time step
-                const glm::vec3 current_position{ball.position};
-                const glm::vec3 current_velocity{ball.velocity};
-                const glm::vec3 acceleration{
-                    gravity - ((air_resistance_coefficient / ball.mass) * (wind_velocity - current_velocity))};
+            // Updating variables for (n+1)-th time step
 
-                // Updating variables for (n+1)-th time step
+            ball.velocity = current_velocity + (acceleration * delta_time);
 
-                ball.velocity = current_velocity + (acceleration * dt);
+            // Explicit Euler
+            // const glm::vec3 euler_position{current_position + (current_velocity * delta_time)};
 
-                // Explicit Euler
-                // const glm::vec3 euler_position{current_position + (current_velocity * dt)};
+            // Ending value approach: uses velocity at (n+1)-th time step
+            // const glm::vec3 ending_value_position{current_position + (ball.velocity * delta_time)};
 
-                // Ending value approach: uses velocity at (n+1)-th time step
-                // const glm::vec3 ending_value_position{current_position + (ball.velocity * dt)};
+            // Average of Explicit Euler and ending value approach; this is an exact solution.
+            const glm::vec3 exact_position{current_position +
+                                           (((current_velocity + ball.velocity) / 2.0f) * delta_time)};
 
-                // Average of Explicit Euler and ending value approach; this is an exact solution.
-                const glm::vec3 exact_position{current_position + (((current_velocity + ball.velocity) / 2.0f) * dt)};
+            ball.previous_position = current_position;
+            ball.position = exact_position;
+        }
+    }
 
-                ball.position = exact_position;
-                delta_time -= time_step;
-                ++substep;
-            }
+    /*
+    Share the positions of the ball with the render thread.
+    */
+    void publish_state() override
+    {
+        ball_state.write_buffer() = BallState{.time = static_cast<float>(simulation_time()),
+                                              .previous_position = ball.previous_position,
+                                              .position = ball.position};
+        ball_state.publish();
+    }
 
-            positions.emplace_back(ball.position.y);
-        }
+    /*
+    Checkpoints only need the kinematic state of the ball; the world
+    variables are parameters and keep their current values.
+    */
+    bool save_state(physscope::BufferWriter& writer) const override
+    {
+        writer.write(ball.position);
+        writer.write(ball.previous_position);
+        writer.write(ball.velocity);
+        return true;
+    }
+
+    bool load_state(physscope::BufferReader& reader) override
+    {
+        return reader.read(ball.position) && reader.read(ball.previous_position) && reader.read(ball.velocity);
+    }
+
+    // Final position and speed of the ball, aggregated over the runs of an ensemble
+    std::vector<std::pair<std::string, double>> summary_metrics() const override
+    {
+        return {{"final_position.x", ball.position.x},
+                {"final_position.y", ball.position.y},
+                {"final_position.z", ball.position.z},
+                {"final_speed", glm::length(ball.velocity)}};
+    }
+
+    /*
+    Write the position and velocity of the ball on a single line;
+    used when running without a window (see main).
+    */
+    void dump_state(std::ostream& output) const override
+    {
+        output << ball.position.x << ' ' << ball.position.y << ' ' << ball.position.z << ' ' << ball.velocity.x
+               << ' ' << ball.velocity.y << ' ' << ball.velocity.z << '\n';
     }
 
     /*
     Update Polyscope structures fields (e.g. position) based on the output
     generated by the physics_update member function.
     */
-    void pre_draw() override
+    void pre_draw(float alpha) override
     {
-        if (is_animating())
+        const bool new_state{ball_state.update()};
+        const BallState& state{ball_state.read_buffer()};
+        ball.update_mesh_view_position(state, alpha);
+        if (new_state)
         {
-            ball.update_mesh_view_position();
+            // A restored checkpoint (or a restart) goes back in time: drop the samples of the discarded future
+            const auto discarded{std::upper_bound(times.begin(), times.end(), state.time)};
+            positions.erase(positions.begin() + (discarded - times.begin()), positions.end());
+            times.erase(discarded, times.end());
+            if (is_animating())
+            {
+                times.emplace_back(state.time);
+                positions.emplace_back(state.position.y);
+            }
         }
 
         ImGui::PushItemWidth(300);
         if (ImGui::TreeNode("World Variables"))
         {
-            ImGui::SliderFloat("Ball Mass", &ball.mass, 0.001f, 100.0f);
-            ImGui::SliderFloat("Gravity", &gravity.y, 0.0f, -20.0f);
-            ImGui::SliderFloat("Air Resistance Coefficient", &air_resistance_coefficient, 0.0f, 20.0f);
-            ImGui::SliderFloat3("Wind Velocity", glm::value_ptr(wind_velocity), -20.0f, 20.0f);
+            if (ImGui::SliderFloat("Ball Mass", &world_widgets.ball_mass, 0.001f, 100.0f))
+            {
+                submit_parameter("ball_mass", world_widgets.ball_mass);
+            }
+            if (ImGui::SliderFloat("Gravity", &world_widgets.gravity.y, 0.0f, -20.0f))
+            {
+                submit_parameter("gravity.y", world_widgets.gravity.y);
+            }
+            if (ImGui::SliderFloat("Air Resistance Coefficient", &world_widgets.air_resistance_coefficient, 0.0f,
+                                   20.0f))
+            {
+                submit_parameter("air_resistance_coefficient", world_widgets.air_resistance_coefficient);
+            }
+            if (ImGui::SliderFloat3("Wind Velocity", glm::value_ptr(world_widgets.wind_velocity), -20.0f, 20.0f))
+            {
+                submit_parameter("wind_velocity.x", world_widgets.wind_velocity.x);
+                submit_parameter("wind_velocity.y", world_widgets.wind_velocity.y);
+                submit_parameter("wind_velocity.z", world_widgets.wind_velocity.z);
+            }
             ImGui::TreePop();
         }
         ImGui::PopItemWidth();
@@ -106,55 +229,163 @@ public:
         if (ImPlot::BeginPlot("Position (y) over Time (x)"))
         {
             ImPlot::SetupLegend(ImPlotLocation_NorthEast);
-            ImPlot::SetupAxesLimits(0, std::max(positions.size(), std::size_t{1000}), 0, 20);
-            ImPlot::PlotLine("Average Velocity (Exact)", positions.data(),
-                             std::min(positions.size(), std::size_t{1'000'000}));
+            ImPlot::SetupAxesLimits(0, std::max(times.empty() ? 0.0f : times.back(), 5.0f), 0, 20);
+            ImPlot::PlotLine("Average Velocity (Exact)", times.data(), positions.data(),
+                             static_cast<int>(std::min(positions.size(), std::size_t{1'000'000})));
             ImPlot::EndPlot();
         }
     }
 
 private:
+    // State of the ball shared with the render thread
+    struct BallState
+    {
+        float time{0.0f};
+        glm::vec3 previous_position{0.0f, 0.0f, 0.0f};
+        glm::vec3 position{0.0f, 0.0f, 0.0f};
+    };
+
     struct Ball
     {
-        float mass{10.0f};
         glm::vec3 position{0.0f, 0.0f, 0.0f};
+        glm::vec3 previous_position{0.0f, 0.0f, 0.0f};
         glm::vec3 velocity{0.0f, 0.0f, 0.0f};
-        physscope::geometry::IndexedTriangleMesh triangle_mesh;
         polyscope::SurfaceMesh* mesh_view{nullptr};
 
         Ball() = default;
 
-        Ball(const glm::vec3& initial_position, const std::string& mesh_name, const std::string& wavefront_string,
-             const std::string& material_string) :
-            position{initial_position}
+        explicit Ball(const glm::vec3& initial_position) :
+            position{initial_position}, previous_position{initial_position}
+        {
+        }
+
+        void register_mesh_view(const std::string& mesh_name, const physscope::geometry::IndexedTriangleMesh& mesh)
         {
-            triangle_mesh = physscope::read_triangle_mesh_obj(wavefront_string, material_string);
-            mesh_view = polyscope::registerSurfaceMesh(mesh_name, triangle_mesh.vertices, triangle_mesh.indices);
+            mesh_view = polyscope::registerSurfaceMesh(mesh_name, mesh.vertices, mesh.indices);
             mesh_view->setSmoothShade(true);
-            update_mesh_view_position();
+            update_mesh_view_position(BallState{.previous_position = position, .position = position}, 1.0f);
         }
 
-        void update_mesh_view_position()
+        // Render the ball between the last two simulated positions
+        void update_mesh_view_position(const BallState& state, float alpha)
         {
-            mesh_view->setTransform(glm::translate(glm::mat4{1.0f}, position));
+            mesh_view->setTransform(
+                glm::translate(glm::mat4{1.0f}, glm::mix(state.previous_position, state.position, alpha)));
         }
     };
 
-    const int max_num_substeps{50};
+    struct WorldVariables
+    {
+        float ball_mass{10.0f};
+        glm::vec3 gravity{0.0f, -10.0f, 0.0f};
+        float air_resistance_coefficient{2.0f};
+        glm::vec3 wind_velocity{-20.0f, 0.0f, 0.0f};
+    };
+
     Ball ball{};
     const glm::vec3 default_start_position{0.0f, 10.0f, 0.0f};
     glm::vec3 start_position{default_start_position};
+    std::vector<float> times{};
     std::vector<float> positions{};
+    physscope::TripleBuffer<BallState> ball_state{};
 
-    // World variables
-    glm::vec3 gravity{0.0f, -10.0f, 0.0f};
-    float air_resistance_coefficient{2.0f};
-    glm::vec3 wind_velocity{-20.0f, 0.0f, 0.0f};
+    // World variables: world is used by the simulation thread, while
+    // world_widgets is edited by the UI on the render thread.
+    WorldVariables world{};
+    WorldVariables world_widgets{};
 };
 
-int main()
+/*
+Usage:
+    basic_simulation
+        Opens the viewer.
+    basic_simulation --headless <number of steps> [<output file>]
+        Runs the simulation without a window, optionally writing
+        the state of the ball on each step to the output file.
+    basic_simulation --replay <timeline file>
+        Replays, without a window, a timeline recorded on the viewer.
+    basic_simulation --sweep <number of steps> [<output CSV file>]
+        Runs one simulation for each combination of world variables
+        on a grid, using all cores, and writes a summary of each run.
+Any of the above can be prefixed by --trace <trace file> to write a
+Chrome trace (viewable on https://ui.perfetto.dev) when the run ends.
+*/
+int run(Simulation& app, const std::vector<std::string>& arguments)
 {
-    Simulation app{};
+    if (arguments.size() > 1 && arguments[0] == "--headless")
+    {
+        std::ofstream output;
+        physscope::HeadlessSettings settings{.steps = std::stoul(arguments[1])};
+        if (arguments.size() > 2)
+        {
+            output.open(arguments[2]);
+            settings.state_output = &output;
+        }
+
+        const physscope::HeadlessReport report{app.run_headless(settings)};
+        std::cout << report.steps << " steps in " << report.seconds << " s (" << report.steps_per_second
+                  << " steps/s)" << std::endl;
+        return 0;
+    }
+
+    if (arguments.size() > 1 && arguments[0] == "--replay")
+    {
+        std::ifstream input{arguments[1], std::ios::binary};
+        const physscope::HeadlessReport report{app.replay(input)};
+        std::cout << report.steps << " steps in " << report.seconds << " s (" << report.steps_per_second
+                  << " steps/s)" << std::endl;
+        for (const auto& [name, value] : app.summary_metrics())
+        {
+            std::cout << name << ": " << value << std::endl;
+        }
+        return 0;
+    }
+
+    if (arguments.size() > 1 && arguments[0] == "--sweep")
+    {
+        const std::vector<physscope::ParameterSet> parameter_sets{physscope::grid_sweep({
+            {.name = "ball_mass", .min = 1.0f, .max = 100.0f, .samples = 5},
+            {.name = "gravity.y", .min = -20.0f, .max = 0.0f, .samples = 5},
+            {.name = "air_resistance_coefficient", .min = 0.0f, .max = 20.0f, .samples = 5},
+            {.name = "wind_velocity.x", .min = -20.0f, .max = 20.0f, .samples = 5},
+        })};
+
+        const auto start{std::chrono::steady_clock::now()};
+        const std::vector<physscope::EnsembleRun> runs{
+            physscope::run_ensemble([] { return std::make_unique<Simulation>(); }, parameter_sets,
+                                    physscope::HeadlessSettings{.steps = std::stoul(arguments[1])})};
+        const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+        std::cout << runs.size() << " runs in " << elapsed.count() << " s" << std::endl;
+
+        std::ofstream output_file;
+        if (arguments.size() > 2)
+        {
+            output_file.open(arguments[2]);
+        }
+        physscope::write_csv(arguments.size() > 2 ? output_file : std::cout, runs);
+        return 0;
+    }
+
     app.run();
     return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> arguments(argv + 1, argv + argc);
+    std::string trace_filename;
+    if (arguments.size() > 1 && arguments[0] == "--trace")
+    {
+        trace_filename = arguments[1];
+        arguments.erase(arguments.begin(), arguments.begin() + 2);
+        physscope::trace::set_enabled(true);
+    }
+
+    Simulation app{};
+    const int status{run(app, arguments)};
+    if (!trace_filename.empty())
+    {
+        physscope::trace::write_chrome_trace(trace_filename);
+    }
+    return status;
 }
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <polyscope/point_cloud.h>
 #include <polyscope/surface_mesh.h>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include "application.hpp"
@@ -10,6 +12,7 @@
 #include "implot.h"
 #include "io.hpp"
 #include "shapes/uv_sphere.hpp"
+#include "triple_buffer.hpp"
 
 class TemplateApplication : public physscope::Application
 {
@@ -26,11 +29,19 @@ public:
     */
     void initialize() override
     {
+        // Polyscope can't be accessed when running without a window
+        if (is_headless())
+        {
+            return;
+        }
+
         // OBJ file can be read directly from file, if you wish so
         // auto triangle_mesh{physscope::read_triangle_mesh_obj("assets/suzanne.obj", true)};
 
-        // ... Or you can store the OBJ file on a string_view variable and use it instead
-        auto triangle_mesh{physscope::read_triangle_mesh_obj(physscope::shapes::uv_sphere, "", true)};
+        // (meshes loaded many times, e.g. on every restart, can be parsed once with physscope::default_mesh_cache())
+
+        // ... Or you can use one of the shapes embedded into the engine, which need no parsing
+        const physscope::geometry::IndexedTriangleMesh& triangle_mesh{physscope::shapes::uv_sphere()};
         mesh = polyscope::registerSurfaceMesh("mesh", triangle_mesh.vertices, triangle_mesh.indices);
     }
 
@@ -53,15 +64,24 @@ public:
             }
 
             displacement += (sign)*0.01f;
-            positions.emplace_back(displacement);
         }
     }
 
+    /*
+    Share the output of physics_update with the render thread;
+    pre_draw must read the published value instead of displacement.
+    */
+    void publish_state() override
+    {
+        displacement_state.write_buffer() = displacement;
+        displacement_state.publish();
+    }
+
     /*
     Update Polyscope structures fields (e.g. position) based on the output
     generated by the physics_update member function.
     */
-    void pre_draw() override
+    void pre_draw(float /*alpha*/) override
     {
         // Update point cloud
         points.clear();
@@ -74,10 +94,16 @@ public:
         // only to access the performance impact of such usage.
         point_cloud = polyscope::registerPointCloud("Sample Point Cloud", points);
 
+        const bool new_state{displacement_state.update()};
+        const float current_displacement{displacement_state.read_buffer()};
         if (is_animating())
         {
-            point_cloud->setTransform(glm::translate(glm::mat4{1.0f}, glm::vec3{0.0f, displacement, 0.0f}));
-            mesh->setTransform(glm::translate(glm::mat4{1.0f}, glm::vec3{displacement, 0.0f, 0.0f}));
+            point_cloud->setTransform(glm::translate(glm::mat4{1.0f}, glm::vec3{0.0f, current_displacement, 0.0f}));
+            mesh->setTransform(glm::translate(glm::mat4{1.0f}, glm::vec3{current_displacement, 0.0f, 0.0f}));
+            if (new_state)
+            {
+                positions.emplace_back(current_displacement);
+            }
         }
 
         const std::size_t time_samples{std::min(positions.size(), std::size_t{10'000})};
@@ -97,11 +123,22 @@ private:
     std::vector<float> positions;
     float displacement{0.0f};
     int sign{1};
+    physscope::TripleBuffer<float> displacement_state{};
 };
 
-int main()
+int main(int argc, char* argv[])
 {
     TemplateApplication app{};
+
+    // Run without a window: template --headless <number of steps>
+    if (argc > 2 && std::string_view{argv[1]} == "--headless")
+    {
+        const physscope::HeadlessReport report{app.run_headless({.steps = std::stoul(argv[2])})};
+        std::cout << report.steps << " steps in " << report.seconds << " s (" << report.steps_per_second
+                  << " steps/s)" << std::endl;
+        return 0;
+    }
+
     app.run();
     return 0;
 }
\ No newline at end of file
@@ -1,30 +1,66 @@
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <iterator>
 #include <iostream>
+#include <optional>
 #include <polyscope/polyscope.h>
 #include <thread>
 
 #include "application.hpp"
 #include "implot.h"
-#include "semaphore.hpp"
+#include "trace.hpp"
 
 namespace physscope
 {
 
+namespace
+{
+
+// Upper bound for the time elapsed between two frames; longer frames
+// (e.g. window dragging or breakpoints) are clamped to this value.
+constexpr float max_frame_time{0.25f};
+
+// When running as fast as possible, the state is published after stepping for this long
+constexpr std::chrono::milliseconds unbounded_batch_duration{16};
+
+// Duration of the window used to measure the achieved time scale
+constexpr float time_scale_window{0.5f};
+
+// Identifies checkpoint files and their format version
+constexpr std::array<char, 4> checkpoint_magic{'P', 'S', 'C', 'K'};
+constexpr std::uint32_t checkpoint_version{1};
+
+float elapsed_milliseconds(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+    return std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+} // namespace
+
 void Application::run()
 {
     // Initialize polyscope and ImPlot
     ImPlot::CreateContext();
+    trace::set_thread_name("render");
     polyscope::init();
     set_polyscope_settings();
-    initialize();
+    initialize_simulation();
+    initial_checkpoint_ = capture_checkpoint();
+    resume_from_checkpoint_file();
+    publish_state();
     std::thread animation_thread{&Application::main_loop, this};
 
     polyscope::show(); // This function call blocks the main thread
 
     /*
     When the window is closed, the main thread is unblocked.
-    We need to set running to false and release the semaphores
-    to notify the simulation thread to stop.
+    We need to set running to false to notify the simulation
+    thread to stop.
     */
     shutdown();
     animation_thread.join();
@@ -32,6 +68,127 @@ void Application::run()
     ImPlot::DestroyContext();
 }
 
+HeadlessReport Application::run_headless(const HeadlessSettings& settings)
+{
+    headless_ = true;
+    if (settings.time_step > 0.0f)
+    {
+        set_fixed_time_step(settings.time_step);
+    }
+    const float time_step{fixed_time_step()};
+    const std::size_t output_interval{std::max(settings.output_interval, std::size_t{1})};
+
+    initialize_simulation();
+    resume_from_checkpoint_file();
+    apply_parameters();
+    start_animation();
+
+    // A run resumed from a checkpoint file only makes the steps that remain
+    const auto completed_steps{static_cast<std::size_t>(std::llround(simulation_time() / time_step))};
+    const std::size_t first_step{std::min(completed_steps, settings.steps) + 1};
+
+    const Clock::time_point start{Clock::now()};
+    for (std::size_t step_index = first_step; step_index <= settings.steps; ++step_index)
+    {
+        step(time_step);
+        if (settings.state_output != nullptr && step_index % output_interval == 0)
+        {
+            dump_state(*settings.state_output);
+        }
+        save_periodic_checkpoint();
+    }
+    const double seconds{std::chrono::duration<double>(Clock::now() - start).count()};
+
+    shutdown();
+    const std::size_t steps{settings.steps + 1 - first_step};
+    return HeadlessReport{.steps = steps,
+                          .seconds = seconds,
+                          .steps_per_second = seconds > 0.0 ? static_cast<double>(steps) / seconds : 0.0};
+}
+
+void Application::start_recording(const std::string& filename)
+{
+    pause_animation();
+
+    std::scoped_lock lock_protection{simulation_mutex_};
+    recorder_.reset();
+    recording_file_.close();
+    recording_file_.open(filename, std::ios::binary);
+    if (!recording_file_)
+    {
+        std::cerr << "Failed to open " << filename << " for recording" << std::endl;
+        recording_.store(false);
+        return;
+    }
+
+    // The recording starts from the initial state, with the current parameters
+    apply_parameters();
+    initialize_simulation();
+    publish_state();
+    recorder_ = std::make_unique<TimelineRecorder>(recording_file_);
+    recorder_->record_restart();
+    for (const auto& [name, value] : current_parameters())
+    {
+        recorder_->record_parameter(name, value);
+    }
+    recording_.store(true);
+}
+
+void Application::stop_recording()
+{
+    std::scoped_lock lock_protection{simulation_mutex_};
+    recorder_.reset();
+    recording_file_.close();
+    recording_.store(false);
+}
+
+bool Application::is_recording() const
+{
+    return recording_.load();
+}
+
+HeadlessReport Application::replay(std::istream& input)
+{
+    TimelineReader reader{input};
+    if (!reader.valid())
+    {
+        std::cerr << "Invalid timeline recording" << std::endl;
+        return HeadlessReport{};
+    }
+
+    headless_ = true;
+    initialize_simulation();
+    start_animation();
+
+    std::size_t steps{0};
+    const Clock::time_point start{Clock::now()};
+    while (const std::optional<TimelineEntry> entry{reader.next()})
+    {
+        switch (entry->event)
+        {
+        case TimelineEvent::steps:
+            for (std::uint32_t i = 0; i < entry->count; ++i)
+            {
+                step(entry->delta_time);
+            }
+            steps += entry->count;
+            break;
+        case TimelineEvent::parameter:
+            set_parameter(entry->name, entry->value);
+            break;
+        case TimelineEvent::restart:
+            initialize_simulation();
+            break;
+        }
+    }
+    const double seconds{std::chrono::duration<double>(Clock::now() - start).count()};
+
+    shutdown();
+    return HeadlessReport{.steps = steps,
+                          .seconds = seconds,
+                          .steps_per_second = seconds > 0.0 ? static_cast<double>(steps) / seconds : 0.0};
+}
+
 void Application::set_polyscope_settings()
 {
     polyscope::options::automaticallyComputeSceneExtents = false;
@@ -48,29 +205,403 @@ void Application::initialize()
 
 void Application::main_loop()
 {
-    float current_time{static_cast<float>(ImGui::GetTime())};
+    /*
+    The simulation thread runs independently of the render thread:
+    it advances the simulation in fixed steps as real time elapses
+    and sleeps until the next step is due.
+    */
+    trace::set_thread_name("simulation");
+    Clock::time_point current_time{Clock::now()};
     while (is_running())
     {
-        const float new_time{static_cast<float>(ImGui::GetTime())};
-        const float delta_time{new_time - current_time};
-        current_time = new_time;
-        update(delta_time);
+        if (!is_animating())
+        {
+            achieved_time_scale_.store(0.0f);
+            wait_for_animation();
+
+            // The time spent paused must not be simulated
+            current_time = Clock::now();
+            time_scale_window_start_ = current_time;
+            time_scale_window_simulated_ = 0.0f;
+        }
+
+        {
+            PHYSSCOPE_TRACE_SCOPE("Application::main_loop");
+            const Clock::time_point new_time{Clock::now()};
+            const float elapsed_time{std::chrono::duration<float>(new_time - current_time).count()};
+            const float frame_time{std::min(elapsed_time, max_frame_time)};
+            current_time = new_time;
+            update(frame_time);
+        }
+
+        const float current_time_scale{time_scale()};
+        if (std::isinf(current_time_scale))
+        {
+            // Give other threads a chance to take simulation_mutex_ (e.g. restart())
+            std::this_thread::yield();
+        }
+        else
+        {
+            const float time_to_next_step{(fixed_time_step() - accumulator_) / current_time_scale};
+            std::this_thread::sleep_for(std::chrono::duration<float>(time_to_next_step));
+        }
     }
 }
 
+void Application::wait_for_animation()
+{
+    std::unique_lock<std::mutex> lock_protection{animation_mutex_};
+    animation_condition_.wait(lock_protection, [this] { return is_animating() || !is_running(); });
+}
+
 bool Application::is_running() const
 {
     return running_.load();
 }
 
-void Application::update(float delta_time)
+JobSystem& Application::jobs() const
+{
+    return default_job_system();
+}
+
+bool Application::is_headless() const
+{
+    return headless_;
+}
+
+void Application::update(float frame_time)
+{
+    PHYSSCOPE_TRACE_SCOPE("Application::update");
+    const Clock::time_point lock_start{Clock::now()};
+    std::scoped_lock lock_protection{simulation_mutex_};
+    const float lock_wait{elapsed_milliseconds(lock_start, Clock::now())};
+    apply_parameters();
+    if (!is_animating())
+    {
+        accumulator_ = 0.0f;
+        return;
+    }
+
+    const float time_step{fixed_time_step()};
+    const float current_time_scale{time_scale()};
+    int steps{0};
+    const Clock::time_point physics_start{Clock::now()};
+
+    /*
+    The animation can be paused in the middle of a batch; stop stepping then,
+    since physics_update() does nothing while paused and recorded steps must
+    be simulated steps for replay() to reproduce the run.
+    */
+    if (std::isinf(current_time_scale))
+    {
+        // As fast as possible: keep stepping for about a frame, then publish
+        const Clock::time_point batch_end{physics_start + unbounded_batch_duration};
+        while (is_animating())
+        {
+            step(time_step);
+            ++steps;
+            if (Clock::now() >= batch_end)
+            {
+                break;
+            }
+        }
+        accumulator_ = 0.0f;
+    }
+    else
+    {
+        // Consume the elapsed (scaled) time in fixed-size steps, bounded by the per-frame budget
+        const float budget_scale{std::max(current_time_scale, 1.0f)};
+        const int max_steps{static_cast<int>(std::ceil(static_cast<float>(max_steps_per_frame()) * budget_scale))};
+        accumulator_ += frame_time * current_time_scale;
+        while (accumulator_ >= time_step && steps < max_steps && is_animating())
+        {
+            step(time_step);
+            accumulator_ -= time_step;
+            ++steps;
+        }
+
+        // Budget exhausted: drop the backlog, keeping only the partial step
+        if (accumulator_ >= time_step)
+        {
+            accumulator_ = std::fmod(accumulator_, time_step);
+        }
+    }
+    measure_time_scale(static_cast<float>(steps) * time_step);
+
+    save_periodic_checkpoint();
+
+    if (steps > 0)
+    {
+        const Clock::time_point publish_start{Clock::now()};
+        {
+            PHYSSCOPE_TRACE_SCOPE("publish_state");
+            publish_state();
+        }
+        const Clock::time_point publish_end{Clock::now()};
+        last_step_time_.store(publish_end.time_since_epoch().count());
+        profiler_.record(Phase::physics, elapsed_milliseconds(physics_start, publish_start));
+        profiler_.record(Phase::handoff, lock_wait + elapsed_milliseconds(publish_start, publish_end));
+    }
+}
+
+void Application::measure_time_scale(float simulated_time)
+{
+    const Clock::time_point now{Clock::now()};
+    time_scale_window_simulated_ += simulated_time;
+    const float window{std::chrono::duration<float>(now - time_scale_window_start_).count()};
+    if (window >= time_scale_window)
+    {
+        achieved_time_scale_.store(time_scale_window_simulated_ / window);
+        time_scale_window_start_ = now;
+        time_scale_window_simulated_ = 0.0f;
+    }
+}
+
+void Application::step(float time_step)
+{
+    if (recorder_)
+    {
+        recorder_->record_step(time_step);
+    }
+    PHYSSCOPE_TRACE_SCOPE("physics_update");
+    physics_update(time_step);
+
+    // Only the thread running the simulation writes the simulation time
+    simulation_time_.store(simulation_time_.load() + static_cast<double>(time_step));
+}
+
+double Application::simulation_time() const
+{
+    return simulation_time_.load();
+}
+
+void Application::initialize_simulation()
+{
+    initialize();
+    simulation_time_.store(0.0);
+    next_checkpoint_time_ = checkpoint_interval_.load();
+
+    std::scoped_lock lock_protection{checkpoints_mutex_};
+    checkpoints_.clear();
+}
+
+std::optional<Checkpoint> Application::capture_checkpoint() const
+{
+    Checkpoint checkpoint{.simulation_time = simulation_time(), .state = {}};
+    BufferWriter writer{checkpoint.state};
+    if (!save_state(writer))
+    {
+        return std::nullopt;
+    }
+    return checkpoint;
+}
+
+bool Application::save_checkpoint()
+{
+    std::scoped_lock lock_protection{simulation_mutex_};
+    return save_checkpoint_locked();
+}
+
+void Application::save_periodic_checkpoint()
+{
+    const double checkpoint_interval{checkpoint_interval_.load()};
+    if (checkpoint_interval > 0.0 && simulation_time() >= next_checkpoint_time_)
+    {
+        PHYSSCOPE_TRACE_SCOPE("save_checkpoint");
+        save_checkpoint_locked();
+        next_checkpoint_time_ = simulation_time() + checkpoint_interval;
+    }
+}
+
+bool Application::save_checkpoint_locked()
+{
+    std::optional<Checkpoint> checkpoint{capture_checkpoint()};
+    if (!checkpoint)
+    {
+        return false;
+    }
+
+    if (!checkpoint_filename_.empty())
+    {
+        write_checkpoint_file(*checkpoint);
+    }
+
+    std::scoped_lock lock_protection{checkpoints_mutex_};
+    checkpoints_.emplace_back(std::move(*checkpoint));
+    while (checkpoints_.size() > std::max(max_checkpoints_.load(), std::size_t{1}))
+    {
+        checkpoints_.pop_front();
+    }
+    return true;
+}
+
+bool Application::restore_checkpoint(double simulation_time)
 {
-    // Producer: generate physics updates
-    empty_.acquire();
-    mutex_.acquire();
-    physics_update(delta_time);
-    mutex_.release();
-    full_.release();
+    pause_animation();
+
+    // Wait for the simulation thread to finish its current steps
+    std::scoped_lock lock_protection{simulation_mutex_};
+    std::optional<Checkpoint> checkpoint;
+    {
+        std::scoped_lock checkpoints_protection{checkpoints_mutex_};
+        const auto is_later = [simulation_time](const Checkpoint& saved)
+        { return saved.simulation_time > simulation_time; };
+        const auto later{std::find_if(checkpoints_.begin(), checkpoints_.end(), is_later)};
+        if (later != checkpoints_.begin())
+        {
+            checkpoint = *std::prev(later);
+        }
+    }
+
+    if (!checkpoint)
+    {
+        return false;
+    }
+
+    if (recorder_)
+    {
+        std::cout << "Recording stopped: the timeline can't be replayed across a checkpoint restore" << std::endl;
+        recorder_.reset();
+        recording_file_.close();
+        recording_.store(false);
+    }
+
+    if (!restore_checkpoint_locked(*checkpoint))
+    {
+        return false;
+    }
+    publish_state();
+    return true;
+}
+
+bool Application::restore_checkpoint_locked(const Checkpoint& checkpoint)
+{
+    BufferReader reader{checkpoint.state};
+    if (!load_state(reader))
+    {
+        return false;
+    }
+    simulation_time_.store(checkpoint.simulation_time);
+    next_checkpoint_time_ = checkpoint.simulation_time + checkpoint_interval_.load();
+
+    // Checkpoints saved after the restored one belong to a discarded future
+    std::scoped_lock lock_protection{checkpoints_mutex_};
+    while (!checkpoints_.empty() && checkpoints_.back().simulation_time > checkpoint.simulation_time)
+    {
+        checkpoints_.pop_back();
+    }
+    return true;
+}
+
+std::vector<double> Application::checkpoint_times() const
+{
+    std::scoped_lock lock_protection{checkpoints_mutex_};
+    std::vector<double> times;
+    times.reserve(checkpoints_.size());
+    for (const Checkpoint& checkpoint : checkpoints_)
+    {
+        times.emplace_back(checkpoint.simulation_time);
+    }
+    return times;
+}
+
+void Application::set_checkpoint_interval(double interval, std::size_t max_checkpoints)
+{
+    checkpoint_interval_.store(std::max(interval, 0.0));
+    max_checkpoints_.store(max_checkpoints);
+}
+
+void Application::set_checkpoint_file(const std::string& filename)
+{
+    checkpoint_filename_ = filename;
+}
+
+void Application::write_checkpoint_file(const Checkpoint& checkpoint) const
+{
+    // Write to a temporary file and rename it, so a crash never leaves a truncated checkpoint behind
+    const std::string temporary_filename{checkpoint_filename_ + ".tmp"};
+    {
+        std::ofstream output{temporary_filename, std::ios::binary};
+        BinaryWriter writer{output};
+        writer.write(checkpoint_magic);
+        writer.write(checkpoint_version);
+        writer.write(checkpoint.simulation_time);
+        writer.write(static_cast<std::uint64_t>(checkpoint.state.size()));
+        writer.write(std::span<const std::byte>{checkpoint.state});
+        if (!output)
+        {
+            std::cerr << "Failed to write checkpoint to " << temporary_filename << std::endl;
+            return;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary_filename, checkpoint_filename_, error);
+    if (error)
+    {
+        std::cerr << "Failed to write checkpoint to " << checkpoint_filename_ << ": " << error.message() << std::endl;
+    }
+}
+
+void Application::resume_from_checkpoint_file()
+{
+    if (checkpoint_filename_.empty() || !std::filesystem::exists(checkpoint_filename_))
+    {
+        return;
+    }
+
+    std::ifstream input{checkpoint_filename_, std::ios::binary};
+    BinaryReader reader{input};
+    std::array<char, 4> magic{};
+    std::uint32_t version{0};
+    std::uint64_t size{0};
+    Checkpoint checkpoint{};
+    reader.read(magic);
+    reader.read(version);
+    reader.read(checkpoint.simulation_time);
+    reader.read(size);
+    if (!input || magic != checkpoint_magic || version != checkpoint_version)
+    {
+        std::cerr << "Ignoring invalid checkpoint file " << checkpoint_filename_ << std::endl;
+        return;
+    }
+    checkpoint.state.resize(static_cast<std::size_t>(size));
+    reader.read(std::span<std::byte>{checkpoint.state});
+    if (!input || !restore_checkpoint_locked(checkpoint))
+    {
+        std::cerr << "Ignoring invalid checkpoint file " << checkpoint_filename_ << std::endl;
+        return;
+    }
+    std::cout << "Resumed from " << checkpoint_filename_ << " at t = " << checkpoint.simulation_time << " s"
+              << std::endl;
+}
+
+bool Application::save_state(BufferWriter& /*writer*/) const
+{
+    return false;
+}
+
+bool Application::load_state(BufferReader& /*reader*/)
+{
+    return false;
+}
+
+void Application::apply_parameters()
+{
+    std::vector<std::pair<std::string, float>> parameters;
+    {
+        std::scoped_lock lock_protection{parameters_mutex_};
+        parameters.swap(pending_parameters_);
+    }
+
+    for (const auto& [name, value] : parameters)
+    {
+        if (recorder_)
+        {
+            recorder_->record_parameter(name, value);
+        }
+        set_parameter(name, value);
+    }
 }
 
 bool Application::is_animating() const
@@ -80,6 +611,15 @@ bool Application::is_animating() const
 
 void Application::user_callback()
 {
+    PHYSSCOPE_TRACE_SCOPE("Application::user_callback");
+
+    // Time spent by Polyscope since the previous callback
+    const Clock::time_point callback_start{Clock::now()};
+    if (last_callback_end_ != Clock::time_point{})
+    {
+        profiler_.record(Phase::draw, elapsed_milliseconds(last_callback_end_, callback_start));
+    }
+
     ImGui::PushItemWidth(100);
     if (ImGui::Button("Animate"))
     {
@@ -95,23 +635,166 @@ void Application::user_callback()
     {
         restart();
     }
+    ImGui::SameLine();
+    if (!is_recording() && ImGui::Button("Record"))
+    {
+        start_recording("timeline.pstl");
+    }
+    else if (is_recording() && ImGui::Button("Stop Recording"))
+    {
+        stop_recording();
+    }
+    ImGui::SameLine();
+    ImGui::Checkbox("Timings", &show_timings_);
+    if (trace::is_enabled())
+    {
+        ImGui::SameLine();
+        if (ImGui::Button("Save Trace"))
+        {
+            trace::write_chrome_trace("physscope_trace.json");
+        }
+    }
+    draw_time_scale_widgets();
+    draw_checkpoint_widgets();
     ImGui::PopItemWidth();
+    if (show_timings_)
+    {
+        draw_timings();
+    }
 
-    // Consumer: reads physics updates to update the graphics entities
-    full_.acquire();
-    mutex_.acquire();
-    pre_draw();
-    mutex_.release();
-    empty_.release();
+    // Fraction of a time step elapsed, in simulated time, since the latest published state
+    const Clock::duration since_last_step{Clock::now().time_since_epoch().count() - last_step_time_.load()};
+    const float current_time_scale{time_scale()};
+    const float alpha{std::isinf(current_time_scale) ? 1.0f
+                                                     : std::chrono::duration<float>(since_last_step).count() *
+                                                           current_time_scale / fixed_time_step()};
+
+    // Consumer: reads the latest published state without waiting for the simulation thread
+    const Clock::time_point pre_draw_start{Clock::now()};
+    {
+        PHYSSCOPE_TRACE_SCOPE("pre_draw");
+        pre_draw(std::clamp(alpha, 0.0f, 1.0f));
+    }
+    last_callback_end_ = Clock::now();
+    profiler_.record(Phase::pre_draw, elapsed_milliseconds(pre_draw_start, last_callback_end_));
 }
 
-void Application::pre_draw()
+void Application::draw_time_scale_widgets()
 {
+    float current_time_scale{time_scale()};
+    bool as_fast_as_possible{std::isinf(current_time_scale)};
+    if (!as_fast_as_possible && ImGui::SliderFloat("Time Scale", &current_time_scale, 0.1f, 100.0f, "%.2fx",
+                                                   ImGuiSliderFlags_Logarithmic))
+    {
+        set_time_scale(current_time_scale);
+    }
+    ImGui::SameLine();
+    if (ImGui::Checkbox("As Fast As Possible", &as_fast_as_possible))
+    {
+        set_time_scale(as_fast_as_possible ? unbounded_time_scale : 1.0f);
+    }
+
+    if (as_fast_as_possible)
+    {
+        ImGui::Text("Speed: %.2fx (requested: unbounded)", achieved_time_scale());
+    }
+    else
+    {
+        ImGui::Text("Speed: %.2fx (requested: %.2fx)", achieved_time_scale(), current_time_scale);
+    }
+}
+
+void Application::draw_checkpoint_widgets()
+{
+    // Only available when the derived class implements save_state()
+    if (!initial_checkpoint_ || !ImGui::TreeNode("Checkpoints"))
+    {
+        return;
+    }
+
+    if (ImGui::Button("Save Checkpoint"))
+    {
+        save_checkpoint();
+    }
+    const std::vector<double> times{checkpoint_times()};
+    for (std::size_t i = 0; i < times.size(); ++i)
+    {
+        std::array<char, 64> label{};
+        std::snprintf(label.data(), label.size(), "t = %.2f s##checkpoint%zu", times[i], i);
+        if (ImGui::Button(label.data()))
+        {
+            restore_checkpoint(times[i]);
+        }
+    }
+    ImGui::TreePop();
+}
+
+void Application::draw_timings()
+{
+    constexpr std::array phases{Phase::physics, Phase::handoff, Phase::pre_draw, Phase::draw};
+    if (ImGui::Begin("Timings", &show_timings_))
+    {
+        for (const Phase phase : phases)
+        {
+            ImGui::Text("%-10s p50 %7.3f ms  p95 %7.3f ms  p99 %7.3f ms", phase_name(phase).data(),
+                        profiler_.percentile(phase, 50.0f), profiler_.percentile(phase, 95.0f),
+                        profiler_.percentile(phase, 99.0f));
+        }
+
+        if (ImPlot::BeginPlot("Phase Timings"))
+        {
+            ImPlot::SetupAxes("Frame", "Time (ms)", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+            for (const Phase phase : phases)
+            {
+                const std::vector<float> samples{profiler_.samples(phase)};
+                ImPlot::PlotLine(phase_name(phase).data(), samples.data(), static_cast<int>(samples.size()));
+            }
+            ImPlot::EndPlot();
+        }
+    }
+    ImGui::End();
+}
+
+void Application::pre_draw(float /*alpha*/)
+{
+}
+
+void Application::publish_state()
+{
+}
+
+void Application::dump_state(std::ostream& /*output*/) const
+{
+}
+
+std::vector<std::pair<std::string, double>> Application::summary_metrics() const
+{
+    return {};
+}
+
+void Application::set_parameter(std::string_view /*name*/, float /*value*/)
+{
+}
+
+std::vector<std::pair<std::string, float>> Application::current_parameters() const
+{
+    return {};
+}
+
+void Application::submit_parameter(std::string_view name, float value)
+{
+    std::scoped_lock lock_protection{parameters_mutex_};
+    pending_parameters_.emplace_back(name, value);
 }
 
 void Application::start_animation()
 {
-    animate_.store(true);
+    {
+        // Update under the mutex so the wake up can't be missed by wait_for_animation()
+        std::scoped_lock lock_protection{animation_mutex_};
+        animate_.store(true);
+    }
+    animation_condition_.notify_one();
 }
 
 void Application::pause_animation()
@@ -119,17 +802,70 @@ void Application::pause_animation()
     animate_.store(false);
 }
 
+void Application::set_fixed_time_step(float time_step)
+{
+    time_step_.store(time_step);
+}
+
+float Application::fixed_time_step() const
+{
+    return time_step_.load();
+}
+
+void Application::set_max_steps_per_frame(int max_steps)
+{
+    max_steps_per_frame_.store(std::max(max_steps, 1));
+}
+
+int Application::max_steps_per_frame() const
+{
+    return max_steps_per_frame_.load();
+}
+
+void Application::set_time_scale(float time_scale)
+{
+    if (time_scale > 0.0f)
+    {
+        time_scale_.store(time_scale);
+    }
+}
+
+float Application::time_scale() const
+{
+    return time_scale_.load();
+}
+
+float Application::achieved_time_scale() const
+{
+    return achieved_time_scale_.load();
+}
+
 void Application::restart()
 {
     pause_animation();
-    initialize();
+
+    // Wait for the simulation thread to finish its current steps
+    std::scoped_lock lock_protection{simulation_mutex_};
+    if (recorder_)
+    {
+        recorder_->record_restart();
+    }
+
+    // Copying the initial state back is much cheaper than initializing again (e.g. loading meshes)
+    if (!initial_checkpoint_ || !restore_checkpoint_locked(*initial_checkpoint_))
+    {
+        initialize_simulation();
+    }
+    publish_state();
 }
 
 void Application::shutdown()
 {
-    running_.store(false);
-    mutex_.release();
-    empty_.release();
+    {
+        std::scoped_lock lock_protection{animation_mutex_};
+        running_.store(false);
+    }
+    animation_condition_.notify_one();
 }
 
 } // namespace physscope
\ No newline at end of file
@@ -2,13 +2,58 @@
 #define APPLICATION_HPP
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
 #include <thread>
+#include <utility>
+#include <vector>
 
-#include "semaphore.hpp"
+#include "binary_stream.hpp"
+#include "job_system.hpp"
+#include "profiler.hpp"
+#include "timeline.hpp"
 
 namespace physscope
 {
 
+struct HeadlessSettings
+{
+    // Total number of physics_update() calls, including those made before the checkpoint a run resumes from
+    std::size_t steps{0};
+
+    // Time step of each physics_update() call; if zero, fixed_time_step() is used
+    float time_step{0.0f};
+
+    // If not null, dump_state() writes to this stream every output_interval steps
+    std::ostream* state_output{nullptr};
+    std::size_t output_interval{1};
+};
+
+struct HeadlessReport
+{
+    // Steps made by this run, fewer than HeadlessSettings::steps when resuming from a checkpoint
+    std::size_t steps{0};
+    double seconds{0.0};
+    double steps_per_second{0.0};
+};
+
+struct Checkpoint
+{
+    double simulation_time{0.0};
+    std::vector<std::byte> state;
+};
+
 class Application
 {
 public:
@@ -23,10 +68,110 @@ public:
     // Run application: should only be called once.
     void run();
 
+    /*
+    Run the simulation without a window: Polyscope, ImGui and ImPlot
+    are never initialized and pre_draw() is never called. The
+    simulation is animated from the start and physics_update() is
+    called settings.steps times in a tight loop on the calling thread.
+    Should be called instead of run(), and only once.
+    */
+    HeadlessReport run_headless(const HeadlessSettings& settings);
+
+    /*
+    Start recording the timeline of the simulation (physics steps,
+    parameter changes and restarts) to filename. The simulation is
+    restarted, and the current parameter values are recorded, so the
+    recording can be replayed from the initial state.
+    Like restart(), it calls initialize(), so it must be called on
+    the render thread (e.g. inside pre_draw()).
+    */
+    void start_recording(const std::string& filename);
+
+    // Stop recording and close the file. This member-function is thread-safe.
+    void stop_recording();
+
+    // Return true if the timeline is being recorded
+    bool is_recording() const;
+
+    /*
+    Replay a timeline recorded with start_recording(), without a window
+    (as in run_headless()) and as fast as possible: physics_update() and
+    set_parameter() receive the exact recorded sequence of values.
+    Should be called instead of run(), and only once.
+    */
+    HeadlessReport replay(std::istream& input);
+
+    /*
+    Save the current simulation state (see save_state()) as a checkpoint.
+    Return false if the derived class doesn't support checkpoints.
+    This member-function is thread-safe.
+    */
+    bool save_checkpoint();
+
+    /*
+    Restore the latest checkpoint saved at or before simulation_time and
+    pause the animation; later checkpoints are discarded. Restoring only
+    copies the saved state, so it's much cheaper than re-initializing.
+    It also stops the current recording, since the timeline could no
+    longer be replayed from the initial state. Return false if there's
+    no such checkpoint. This member-function is thread-safe.
+    */
+    bool restore_checkpoint(double simulation_time);
+
+    // Return the simulation time of each stored checkpoint, in increasing order
+    std::vector<double> checkpoint_times() const;
+
+    /*
+    Save a checkpoint every interval seconds of simulated time, keeping
+    the latest max_checkpoints ones. If interval is zero (the default),
+    checkpoints are only saved by save_checkpoint().
+    This member-function is thread-safe.
+    */
+    void set_checkpoint_interval(double interval, std::size_t max_checkpoints = 16);
+
+    /*
+    Also write every checkpoint to filename, replacing the previous one.
+    If the file exists when run() or run_headless() starts, the simulation
+    resumes from it (e.g. after a crash); run_headless() then only makes the
+    steps remaining to HeadlessSettings::steps. Should be called before run().
+    */
+    void set_checkpoint_file(const std::string& filename);
+
+    /*
+    Request a change of a named simulation parameter (e.g. from an ImGui
+    widget inside pre_draw()). The change is applied by set_parameter()
+    on the simulation thread before the next physics step, so it never
+    races with physics_update(). This member-function is thread-safe.
+    */
+    void submit_parameter(std::string_view name, float value);
+
+    /*
+    Named scalar results summarizing a run (e.g. final position of a
+    body); used to compare simulations with different parameters,
+    see run_ensemble(). Called after run_headless() returns.
+    */
+    virtual std::vector<std::pair<std::string, double>> summary_metrics() const;
+
 protected:
     // Return true if the application is running
     bool is_running() const;
 
+    // Return the simulated time, in seconds, since the simulation was initialized
+    double simulation_time() const;
+
+    /*
+    Return the JobSystem shared by the whole process. Use it to
+    spread per-body or per-particle work inside physics_update()
+    across all cores, e.g. with jobs().parallel_for(...).
+    */
+    JobSystem& jobs() const;
+
+    /*
+    Return true if the application was started with run_headless().
+    Derived classes must not access Polyscope on headless runs.
+    */
+    bool is_headless() const;
+
     /*
     Return true if the application is currently
     set to animate the objects.
@@ -35,12 +180,14 @@ protected:
     bool is_animating() const;
 
     /*
-    Start the animation. This member-function is thread-safe.
+    Start the animation, waking up the simulation thread.
+    This member-function is thread-safe.
     */
     void start_animation();
 
     /*
-    Pause the animation. This member-function is thread-safe.
+    Pause the animation. The simulation thread sleeps until the
+    animation is started again. This member-function is thread-safe.
     */
     void pause_animation();
 
@@ -48,10 +195,57 @@ protected:
     Restarts the simulation. All state is set to it's initial
     configuration as defined at the initialize() member-function.
     If you initialized data outside initialize(), it will not be
-    affected by a call to restart().
+    affected by a call to restart(). If the derived class supports
+    checkpoints, the state saved right after the first initialize()
+    is restored instead of calling initialize() again.
     */
     void restart();
 
+    /*
+    Set the fixed time step, in seconds, used to advance the simulation.
+    physics_update() is always called with this value, independently of
+    the rendering frame rate. This member-function is thread-safe.
+    */
+    void set_fixed_time_step(float time_step);
+
+    // Return the fixed time step, in seconds, used by physics_update().
+    float fixed_time_step() const;
+
+    /*
+    Set the maximum number of physics_update() calls executed on a
+    single rendered frame. If the simulation falls behind real time by
+    more than this budget, the remaining time is dropped instead of
+    being carried over to the next frame (this avoids the so-called
+    "spiral of death"). This member-function is thread-safe.
+    */
+    void set_max_steps_per_frame(int max_steps);
+
+    // Return the maximum number of physics_update() calls per frame.
+    int max_steps_per_frame() const;
+
+    // Time scale that runs the simulation as fast as possible
+    static constexpr float unbounded_time_scale{std::numeric_limits<float>::infinity()};
+
+    /*
+    Set how many seconds of simulated time elapse per second of real
+    time (e.g. 10 runs the simulation ten times faster than real time).
+    The per-frame step budget grows with the time scale. With
+    unbounded_time_scale, the simulation thread steps continuously and
+    publishes its state about once per frame. The time step passed to
+    physics_update() is unaffected. This member-function is thread-safe.
+    */
+    void set_time_scale(float time_scale);
+
+    // Return the requested time scale
+    float time_scale() const;
+
+    /*
+    Return the time scale actually achieved by the simulation over the
+    last half second; lower than time_scale() if the simulation can't
+    keep up. This member-function is thread-safe.
+    */
+    float achieved_time_scale() const;
+
     /*
     This member-function specifies the default settings for
     rendering using Polyscope. It can be overridden to change the
@@ -62,41 +256,144 @@ protected:
     /*
     This member-function allows derived classes to initialize
     Polyscope-related objects. Polyscope structures can be
-    constructed and accessed inside this function.
+    constructed and accessed inside this function, unless
+    is_headless() returns true.
     */
     virtual void initialize();
 
+    /*
+    Applies a parameter change requested through submit_parameter().
+    Called on the simulation thread, between physics steps.
+    */
+    virtual void set_parameter(std::string_view name, float value);
+
+    /*
+    Returns the current value of every parameter accepted by
+    set_parameter(); called on the simulation thread (or while
+    it's blocked) when a recording starts.
+    */
+    virtual std::vector<std::pair<std::string, float>> current_parameters() const;
+
     /*
     Implements physics simulation/animation.
     Each derived class specifies it's own rules and logics
     based on the Application objective.
+    delta_time is always equal to fixed_time_step(); the
+    application calls this function as many times as needed
+    to keep the simulation in sync with real time.
     E.g. animate a ball (i.e. it's center) falling due to
     gravity force.
     See template.cpp for an example.
     */
     virtual void physics_update(float delta_time) = 0;
 
+    /*
+    Copies the simulation state needed for rendering into a snapshot
+    shared with the render thread (see TripleBuffer). Called on the
+    simulation thread after each batch of physics steps, and after
+    initialize(). The simulation runs freely, so pre_draw() must only
+    read the published snapshots, never the simulation state directly.
+    */
+    virtual void publish_state();
+
+    /*
+    Writes the current simulation state to output, in a format
+    defined by the derived class. Used by run_headless().
+    */
+    virtual void dump_state(std::ostream& output) const;
+
+    /*
+    Serializes the whole simulation state into writer, e.g. with
+    writer.write(position). Return false (the default) if checkpoints
+    aren't supported. Called on the simulation thread, or while it's blocked.
+    */
+    virtual bool save_state(BufferWriter& writer) const;
+
+    /*
+    Restores a state serialized by save_state(); return false on failure.
+    Called while the simulation thread is blocked.
+    */
+    virtual bool load_state(BufferReader& reader);
+
     /*
     Implements custom updates to render-related structures
     before they are draw to the screen. Polyscope structures
     can be constructed and accessed inside this function.
     E.g. apply transform on Polyscope structures based on
-    the physics_update output.
+    the latest state published by publish_state().
+    alpha is the fraction, in [0, 1], of a time step elapsed
+    since the latest physics step; it can be used to interpolate
+    between the previous and the current physics state.
     See template.cpp for an example.
     */
-    virtual void pre_draw();
+    virtual void pre_draw(float alpha);
 
 private:
+    using Clock = std::chrono::steady_clock;
+
     void main_loop();
-    void update(float delta_time);
+    void wait_for_animation();
+    void update(float frame_time);
+    void step(float time_step);
+    void measure_time_scale(float simulated_time);
+    void draw_time_scale_widgets();
+    void apply_parameters();
+    void initialize_simulation();
+    std::optional<Checkpoint> capture_checkpoint() const;
+    bool save_checkpoint_locked();
+
+    // Save a checkpoint if checkpoint_interval_ has elapsed since the last one
+    void save_periodic_checkpoint();
+    bool restore_checkpoint_locked(const Checkpoint& checkpoint);
+    void write_checkpoint_file(const Checkpoint& checkpoint) const;
+    void resume_from_checkpoint_file();
+    void draw_checkpoint_widgets();
     void user_callback();
+    void draw_timings();
     void shutdown();
 
+    bool headless_{false};
     std::atomic<bool> running_{true};
     std::atomic<bool> animate_{false};
-    physscope::Semaphore empty_{1};
-    physscope::Semaphore full_{0};
-    physscope::Semaphore mutex_{1};
+    std::atomic<bool> recording_{false};
+    std::atomic<float> time_step_{1.0f / 60.0f};
+    std::atomic<int> max_steps_per_frame_{8};
+    std::atomic<float> time_scale_{1.0f};
+    std::atomic<float> achieved_time_scale_{0.0f};
+    std::atomic<Clock::rep> last_step_time_{0};
+    std::atomic<double> simulation_time_{0.0};
+    float accumulator_{0.0f};
+
+    // Simulated time elapsed since time_scale_window_start_; used to measure the achieved time scale
+    Clock::time_point time_scale_window_start_{};
+    float time_scale_window_simulated_{0.0f};
+
+    // Held by the simulation thread while stepping; restart() holds it to re-initialize
+    std::mutex simulation_mutex_;
+    std::mutex parameters_mutex_;
+    std::vector<std::pair<std::string, float>> pending_parameters_;
+
+    // Accessed while holding simulation_mutex_
+    std::ofstream recording_file_;
+    std::unique_ptr<TimelineRecorder> recorder_;
+
+    // Checkpoints; initial_checkpoint_ and next_checkpoint_time_ are accessed while holding simulation_mutex_
+    std::optional<Checkpoint> initial_checkpoint_;
+    double next_checkpoint_time_{0.0};
+    std::atomic<double> checkpoint_interval_{0.0};
+    std::atomic<std::size_t> max_checkpoints_{16};
+    std::string checkpoint_filename_;
+    mutable std::mutex checkpoints_mutex_;
+    std::deque<Checkpoint> checkpoints_;
+
+    // Durations of the phases of the latest frames, shown on the "Timings" window
+    PhaseProfiler profiler_;
+    bool show_timings_{false};
+    Clock::time_point last_callback_end_{};
+
+    // Used to park the simulation thread while the animation is paused
+    std::mutex animation_mutex_;
+    std::condition_variable animation_condition_;
 };
 
 } // namespace physscope
@@ -0,0 +1,175 @@
+#ifndef BINARY_STREAM_HPP
+#define BINARY_STREAM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace physscope
+{
+
+/*
+Writes trivially copyable values to a stream using their in-memory
+representation (native endianness); strings are prefixed by their size.
+*/
+class BinaryWriter
+{
+public:
+    explicit BinaryWriter(std::ostream& output) : output_{output}
+    {
+    }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void write(const T& value)
+    {
+        output_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void write(std::span<const T> values)
+    {
+        output_.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size_bytes()));
+    }
+
+    void write(std::string_view text)
+    {
+        write(static_cast<std::uint32_t>(text.size()));
+        output_.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+
+    bool good() const
+    {
+        return output_.good();
+    }
+
+private:
+    std::ostream& output_;
+};
+
+// Reads values written by BinaryWriter; each read returns false on failure
+class BinaryReader
+{
+public:
+    explicit BinaryReader(std::istream& input) : input_{input}
+    {
+    }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    bool read(T& value)
+    {
+        return static_cast<bool>(input_.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    bool read(std::span<T> values)
+    {
+        return static_cast<bool>(
+            input_.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(values.size_bytes())));
+    }
+
+    bool read(std::string& text)
+    {
+        std::uint32_t size{0};
+        if (!read(size))
+        {
+            return false;
+        }
+        text.resize(size);
+        return static_cast<bool>(input_.read(text.data(), static_cast<std::streamsize>(size)));
+    }
+
+private:
+    std::istream& input_;
+};
+
+// Same as BinaryWriter, but appends to a buffer in memory
+class BufferWriter
+{
+public:
+    explicit BufferWriter(std::vector<std::byte>& buffer) : buffer_{buffer}
+    {
+    }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void write(const T& value)
+    {
+        write(std::span<const T>{&value, 1});
+    }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void write(std::span<const T> values)
+    {
+        const std::span<const std::byte> bytes{std::as_bytes(values)};
+        buffer_.insert(buffer_.end(), bytes.begin(), bytes.end());
+    }
+
+    void write(std::string_view text)
+    {
+        write(static_cast<std::uint32_t>(text.size()));
+        write(std::span<const char>{text.data(), text.size()});
+    }
+
+private:
+    std::vector<std::byte>& buffer_;
+};
+
+// Same as BinaryReader, but reads from a buffer in memory
+class BufferReader
+{
+public:
+    explicit BufferReader(std::span<const std::byte> buffer) : buffer_{buffer}
+    {
+    }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    bool read(T& value)
+    {
+        return read(std::span<T>{&value, 1});
+    }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    bool read(std::span<T> values)
+    {
+        if (values.size_bytes() > buffer_.size() - offset_)
+        {
+            return false;
+        }
+        std::memcpy(values.data(), buffer_.data() + offset_, values.size_bytes());
+        offset_ += values.size_bytes();
+        return true;
+    }
+
+    bool read(std::string& text)
+    {
+        std::uint32_t size{0};
+        if (!read(size))
+        {
+            return false;
+        }
+        text.resize(size);
+        return read(std::span<char>{text.data(), text.size()});
+    }
+
+private:
+    std::span<const std::byte> buffer_;
+    std::size_t offset_{0};
+};
+
+} // namespace physscope
+
+#endif // BINARY_STREAM_HPP
\ No newline at end of file
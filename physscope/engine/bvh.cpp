@@ -0,0 +1,909 @@
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <iostream>
+#include <mutex>
+
+#include "bvh.hpp"
+#include "trace.hpp"
+
+namespace physscope
+{
+
+namespace geometry
+{
+
+namespace
+{
+
+constexpr std::size_t num_bins{16};
+
+/*
+From this depth on, nodes are split at the median instead of by the SAH.
+Median splits halve the triangles of a node, so with fewer than 2^32
+triangles leaves are at most 32 levels deeper, which bounds the depth of
+the BVH (and the traversal stacks) by 64.
+*/
+constexpr std::size_t median_split_depth{32};
+
+// Triangle being placed in the BVH; partitioned in place so the build reads it sequentially
+struct Primitive
+{
+    AABB bounds{};
+    glm::vec3 centroid{0.0f};
+    std::uint32_t triangle{0};
+};
+
+struct Bin
+{
+    AABB bounds{};
+    std::size_t count{0};
+};
+
+using AxisBins = std::array<std::array<Bin, num_bins>, 3>;
+
+struct RangeBounds
+{
+    AABB bounds{};
+    AABB centroid_bounds{};
+};
+
+float surface_area(const AABB& box)
+{
+    if (box.is_empty())
+    {
+        return 0.0f;
+    }
+    const glm::vec3 extent{box.extent()};
+    return 2.0f * (extent.x * extent.y + extent.y * extent.z + extent.z * extent.x);
+}
+
+bool overlap(const AABB& a, const AABB& b)
+{
+    return a.min.x <= b.max.x && a.max.x >= b.min.x && a.min.y <= b.max.y && a.max.y >= b.min.y &&
+           a.min.z <= b.max.z && a.max.z >= b.min.z;
+}
+
+AABB node_bounds(const BVHNode& node)
+{
+    return AABB{.min = node.min, .max = node.max};
+}
+
+float squared_distance(const BVHNode& node, const glm::vec3& point)
+{
+    const glm::vec3 offset{glm::max(glm::max(node.min - point, point - node.max), glm::vec3{0.0f})};
+    return glm::dot(offset, offset);
+}
+
+// Distance along the ray at which it enters the node, or infinity if it misses it before max_distance
+float ray_entry(const BVHNode& node, const Ray& ray, const glm::vec3& inverse_direction, float max_distance)
+{
+    // NaNs (a ray parallel to a slab, starting on its plane) leave the interval unchanged
+    float entry{0.0f};
+    float exit{max_distance};
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        const float near{(node.min[axis] - ray.origin[axis]) * inverse_direction[axis]};
+        const float far{(node.max[axis] - ray.origin[axis]) * inverse_direction[axis]};
+        entry = std::max(entry, std::min(near, far));
+        exit = std::min(exit, std::max(near, far));
+    }
+    return entry <= exit ? entry : std::numeric_limits<float>::infinity();
+}
+
+// Möller-Trumbore intersection; hits at or beyond max_distance are ignored
+std::optional<RayHit> intersect(const Ray& ray, const std::array<glm::vec3, 3>& triangle, float max_distance)
+{
+    const glm::vec3 edge_1{triangle[1] - triangle[0]};
+    const glm::vec3 edge_2{triangle[2] - triangle[0]};
+    const glm::vec3 p{glm::cross(ray.direction, edge_2)};
+    const float determinant{glm::dot(edge_1, p)};
+    if (std::abs(determinant) < 1.0e-12f)
+    {
+        return std::nullopt;
+    }
+
+    const float inverse_determinant{1.0f / determinant};
+    const glm::vec3 t{ray.origin - triangle[0]};
+    const float u{glm::dot(t, p) * inverse_determinant};
+    if (u < 0.0f || u > 1.0f)
+    {
+        return std::nullopt;
+    }
+    const glm::vec3 q{glm::cross(t, edge_1)};
+    const float v{glm::dot(ray.direction, q) * inverse_determinant};
+    if (v < 0.0f || u + v > 1.0f)
+    {
+        return std::nullopt;
+    }
+    const float distance{glm::dot(edge_2, q) * inverse_determinant};
+    if (distance < 0.0f || distance >= max_distance)
+    {
+        return std::nullopt;
+    }
+    return RayHit{.triangle = 0, .distance = distance, .u = u, .v = v};
+}
+
+// Closest point of the triangle to point, by the Voronoi regions of its features (Ericson, 5.1.5)
+glm::vec3 closest_point_on_triangle(const glm::vec3& point, const std::array<glm::vec3, 3>& triangle)
+{
+    const glm::vec3& a{triangle[0]};
+    const glm::vec3& b{triangle[1]};
+    const glm::vec3& c{triangle[2]};
+    const glm::vec3 ab{b - a};
+    const glm::vec3 ac{c - a};
+    const glm::vec3 ap{point - a};
+    const float d1{glm::dot(ab, ap)};
+    const float d2{glm::dot(ac, ap)};
+    if (d1 <= 0.0f && d2 <= 0.0f)
+    {
+        return a;
+    }
+
+    const glm::vec3 bp{point - b};
+    const float d3{glm::dot(ab, bp)};
+    const float d4{glm::dot(ac, bp)};
+    if (d3 >= 0.0f && d4 <= d3)
+    {
+        return b;
+    }
+
+    const float vc{d1 * d4 - d3 * d2};
+    if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+    {
+        return a + ab * (d1 / (d1 - d3));
+    }
+
+    const glm::vec3 cp{point - c};
+    const float d5{glm::dot(ab, cp)};
+    const float d6{glm::dot(ac, cp)};
+    if (d6 >= 0.0f && d5 <= d6)
+    {
+        return c;
+    }
+
+    const float vb{d5 * d2 - d1 * d6};
+    if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+    {
+        return a + ac * (d2 / (d2 - d6));
+    }
+
+    const float va{d3 * d6 - d5 * d4};
+    if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f)
+    {
+        return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+
+    const float denominator{1.0f / (va + vb + vc)};
+    return a + ab * (vb * denominator) + ac * (vc * denominator);
+}
+
+// Levels of the BVH whose first subtrees are refit as separate tasks: about four subtrees per thread
+std::size_t refit_parallel_depth(const JobSystem& jobs)
+{
+    return jobs.num_threads() > 1 ? static_cast<std::size_t>(std::bit_width(jobs.num_threads())) + 2 : 0;
+}
+
+// Recursive top-down construction over the primitive order, shared by the tasks of a build
+class BVHBuilder
+{
+public:
+    BVHBuilder(const BVHBuildSettings& settings, JobSystem& jobs, std::vector<Primitive>& primitives,
+               std::vector<BVHNode>& nodes) :
+        settings_{settings}, jobs_{jobs}, primitives_{primitives}, nodes_{nodes}
+    {
+    }
+
+    void build(std::uint32_t node_index, std::size_t begin, std::size_t end, std::size_t depth)
+    {
+        const std::size_t count{end - begin};
+        const bool parallel{count >= settings_.parallel_threshold && jobs_.num_threads() > 1};
+        const RangeBounds range{range_bounds(begin, end, parallel)};
+        BVHNode& node{nodes_[node_index]};
+        node.min = range.bounds.min;
+        node.max = range.bounds.max;
+
+        std::size_t middle{split(begin, end, depth, range, parallel)};
+        if (middle == begin)
+        {
+            node.first = static_cast<std::uint32_t>(begin);
+            node.count = static_cast<std::uint32_t>(count);
+            return;
+        }
+
+        const std::uint32_t first_child{next_node_.fetch_add(2)};
+        node.first = first_child;
+        node.count = 0;
+        if (parallel)
+        {
+            TaskGroup group{jobs_};
+            group.run([this, first_child, begin, middle, depth] { build(first_child, begin, middle, depth + 1); });
+            build(first_child + 1, middle, end, depth + 1);
+            group.wait();
+        }
+        else
+        {
+            build(first_child, begin, middle, depth + 1);
+            build(first_child + 1, middle, end, depth + 1);
+        }
+    }
+
+    std::uint32_t num_nodes() const
+    {
+        return next_node_.load();
+    }
+
+private:
+    // Reduce accumulate(first, last, partial) over [begin, end), with parallel_for() if parallel
+    template <typename Result, typename Accumulate, typename Merge>
+    Result reduce(std::size_t begin, std::size_t end, bool parallel, const Accumulate& accumulate,
+                  const Merge& merge) const
+    {
+        Result result{};
+        if (!parallel)
+        {
+            accumulate(begin, end, result);
+            return result;
+        }
+
+        std::mutex mutex;
+        jobs_.parallel_for(begin, end,
+                           [&](std::size_t first, std::size_t last)
+                           {
+                               Result partial{};
+                               accumulate(first, last, partial);
+                               std::scoped_lock lock_protection{mutex};
+                               merge(result, partial);
+                           });
+        return result;
+    }
+
+    RangeBounds range_bounds(std::size_t begin, std::size_t end, bool parallel) const
+    {
+        return reduce<RangeBounds>(
+            begin, end, parallel,
+            [this](std::size_t first, std::size_t last, RangeBounds& range)
+            {
+                for (std::size_t i = first; i < last; ++i)
+                {
+                    range.bounds.expand(primitives_[i].bounds);
+                    range.centroid_bounds.expand(primitives_[i].centroid);
+                }
+            },
+            [](RangeBounds& result, const RangeBounds& partial)
+            {
+                result.bounds.expand(partial.bounds);
+                result.centroid_bounds.expand(partial.centroid_bounds);
+            });
+    }
+
+    static std::size_t bin_index(float centroid, float min, float scale)
+    {
+        return std::min(static_cast<std::size_t>((centroid - min) * scale), num_bins - 1);
+    }
+
+    /*
+    Reorder [begin, end) into two children and return where the second one
+    starts, or begin to make the node a leaf.
+    */
+    std::size_t split(std::size_t begin, std::size_t end, std::size_t depth, const RangeBounds& range,
+                      bool parallel)
+    {
+        const std::size_t count{end - begin};
+        if (count <= 1)
+        {
+            return begin;
+        }
+
+        const glm::vec3 extent{range.centroid_bounds.extent()};
+        const int longest_axis{extent.x >= extent.y ? (extent.x >= extent.z ? 0 : 2) : (extent.y >= extent.z ? 1 : 2)};
+        const bool is_degenerate{extent[longest_axis] <= 0.0f};
+        if (!is_degenerate && depth < median_split_depth)
+        {
+            glm::vec3 scale{0.0f};
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                scale[axis] = extent[axis] > 0.0f ? static_cast<float>(num_bins) / extent[axis] : 0.0f;
+            }
+            const AxisBins bins{bin(begin, end, range.centroid_bounds.min, scale, parallel)};
+
+            // Sweep the bins from both sides: the SAH cost of splitting after bin i on each axis
+            float best_cost{std::numeric_limits<float>::infinity()};
+            int best_axis{0};
+            std::size_t best_bin{0};
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                if (extent[axis] <= 0.0f)
+                {
+                    continue;
+                }
+
+                std::array<float, num_bins - 1> right_cost{};
+                AABB right{};
+                std::size_t right_count{0};
+                for (std::size_t i = num_bins - 1; i > 0; --i)
+                {
+                    right.expand(bins[axis][i].bounds);
+                    right_count += bins[axis][i].count;
+                    right_cost[i - 1] = surface_area(right) * static_cast<float>(right_count);
+                }
+
+                AABB left{};
+                std::size_t left_count{0};
+                for (std::size_t i = 0; i < num_bins - 1; ++i)
+                {
+                    left.expand(bins[axis][i].bounds);
+                    left_count += bins[axis][i].count;
+                    const float cost{surface_area(left) * static_cast<float>(left_count) + right_cost[i]};
+                    if (left_count > 0 && left_count < count && cost < best_cost)
+                    {
+                        best_cost = cost;
+                        best_axis = axis;
+                        best_bin = i;
+                    }
+                }
+            }
+
+            // Costs relative to intersecting a triangle; traversing a node costs about as much
+            const float node_area{surface_area(range.bounds)};
+            const float leaf_cost{node_area * static_cast<float>(count)};
+            if (count <= settings_.max_leaf_size && node_area + best_cost >= leaf_cost)
+            {
+                return begin;
+            }
+
+            if (best_cost < std::numeric_limits<float>::infinity())
+            {
+                const float min{range.centroid_bounds.min[best_axis]};
+                const float axis_scale{scale[best_axis]};
+                const auto middle{std::partition(primitives_.begin() + static_cast<std::ptrdiff_t>(begin),
+                                                 primitives_.begin() + static_cast<std::ptrdiff_t>(end),
+                                                 [&](const Primitive& primitive)
+                                                 {
+                                                     return bin_index(primitive.centroid[best_axis], min,
+                                                                      axis_scale) <= best_bin;
+                                                 })};
+                return static_cast<std::size_t>(middle - primitives_.begin());
+            }
+        }
+
+        if (count <= settings_.max_leaf_size)
+        {
+            return begin;
+        }
+
+        // No useful SAH split: halve the triangles along the longest axis of their centroids
+        const std::size_t middle{begin + count / 2};
+        std::nth_element(primitives_.begin() + static_cast<std::ptrdiff_t>(begin),
+                         primitives_.begin() + static_cast<std::ptrdiff_t>(middle),
+                         primitives_.begin() + static_cast<std::ptrdiff_t>(end),
+                         [&](const Primitive& a, const Primitive& b)
+                         { return a.centroid[longest_axis] < b.centroid[longest_axis]; });
+        return middle;
+    }
+
+    AxisBins bin(std::size_t begin, std::size_t end, const glm::vec3& min, const glm::vec3& scale, bool parallel) const
+    {
+        return reduce<AxisBins>(
+            begin, end, parallel,
+            [&](std::size_t first, std::size_t last, AxisBins& bins)
+            {
+                for (std::size_t i = first; i < last; ++i)
+                {
+                    const Primitive& primitive{primitives_[i]};
+                    for (int axis = 0; axis < 3; ++axis)
+                    {
+                        Bin& bin{bins[axis][bin_index(primitive.centroid[axis], min[axis], scale[axis])]};
+                        bin.bounds.expand(primitive.bounds);
+                        ++bin.count;
+                    }
+                }
+            },
+            [](AxisBins& result, const AxisBins& partial)
+            {
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    for (std::size_t i = 0; i < num_bins; ++i)
+                    {
+                        result[axis][i].bounds.expand(partial[axis][i].bounds);
+                        result[axis][i].count += partial[axis][i].count;
+                    }
+                }
+            });
+    }
+
+    const BVHBuildSettings& settings_;
+    JobSystem& jobs_;
+    std::vector<Primitive>& primitives_;
+    std::vector<BVHNode>& nodes_;
+    std::atomic<std::uint32_t> next_node_{1};
+};
+
+} // namespace
+
+bool BVHNode::is_leaf() const
+{
+    return count > 0;
+}
+
+BVH::BVH(const IndexedTriangleMesh& mesh, const BVHBuildSettings& settings, JobSystem& jobs) :
+    settings_{settings}, vertices_{mesh.vertices}, triangles_{mesh.indices}
+{
+    build(jobs);
+}
+
+void BVH::build(JobSystem& jobs)
+{
+    PHYSSCOPE_TRACE_SCOPE("BVH::build");
+    const std::size_t num_triangles{triangles_.size()};
+    if (num_triangles == 0)
+    {
+        return;
+    }
+
+    std::vector<Primitive> primitives(num_triangles);
+    jobs.parallel_for(0, num_triangles,
+                      [&](std::size_t first, std::size_t last)
+                      {
+                          for (std::size_t i = first; i < last; ++i)
+                          {
+                              Primitive& primitive{primitives[i]};
+                              for (const glm::vec3& vertex : triangle(i))
+                              {
+                                  primitive.bounds.expand(vertex);
+                              }
+                              primitive.centroid = primitive.bounds.center();
+                              primitive.triangle = static_cast<std::uint32_t>(i);
+                          }
+                      });
+
+    // A binary tree with at most one leaf per triangle has at most 2n - 1 nodes
+    nodes_.resize(2 * num_triangles - 1);
+    BVHBuilder builder{settings_, jobs, primitives, nodes_};
+    builder.build(0, 0, num_triangles, 1);
+    nodes_.resize(builder.num_nodes());
+    nodes_.shrink_to_fit();
+
+    // Store the triangles in leaf order
+    std::vector<std::array<IndexedTriangleMesh::index_type, 3>> triangles(num_triangles);
+    triangle_ids_.resize(num_triangles);
+    jobs.parallel_for(0, num_triangles,
+                      [&](std::size_t first, std::size_t last)
+                      {
+                          for (std::size_t i = first; i < last; ++i)
+                          {
+                              triangles[i] = triangles_[primitives[i].triangle];
+                              triangle_ids_[i] = primitives[i].triangle;
+                          }
+                      });
+    triangles_ = std::move(triangles);
+
+    build_costs_.resize(nodes_.size());
+    costs_.resize(nodes_.size());
+    refit(0, refit_parallel_depth(jobs), build_costs_, jobs);
+    costs_ = build_costs_;
+}
+
+std::array<glm::vec3, 3> BVH::triangle(std::size_t index) const
+{
+    const std::array<IndexedTriangleMesh::index_type, 3>& corners{triangles_[index]};
+    return std::array<glm::vec3, 3>{vertices_[corners[0]], vertices_[corners[1]], vertices_[corners[2]]};
+}
+
+std::optional<RayHit> BVH::raycast(const Ray& ray, float max_distance) const
+{
+    if (nodes_.empty())
+    {
+        return std::nullopt;
+    }
+
+    const glm::vec3 inverse_direction{1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z};
+    std::optional<RayHit> closest;
+    float closest_distance{max_distance};
+
+    // Nodes left to visit, with the distance at which the ray enters them
+    std::array<std::pair<std::uint32_t, float>, max_depth> stack{};
+    std::size_t stack_size{0};
+    if (ray_entry(nodes_[0], ray, inverse_direction, closest_distance) < closest_distance)
+    {
+        stack[stack_size++] = {0, 0.0f};
+    }
+
+    while (stack_size > 0)
+    {
+        const auto [node_index, entry]{stack[--stack_size]};
+        if (entry >= closest_distance)
+        {
+            continue;
+        }
+
+        // Descend towards the nearest child, leaving the other one on the stack
+        std::uint32_t current{node_index};
+        while (!nodes_[current].is_leaf())
+        {
+            std::uint32_t near_child{nodes_[current].first};
+            std::uint32_t far_child{near_child + 1};
+            float near_entry{ray_entry(nodes_[near_child], ray, inverse_direction, closest_distance)};
+            float far_entry{ray_entry(nodes_[far_child], ray, inverse_direction, closest_distance)};
+            if (far_entry < near_entry)
+            {
+                std::swap(near_child, far_child);
+                std::swap(near_entry, far_entry);
+            }
+            if (near_entry == std::numeric_limits<float>::infinity())
+            {
+                break;
+            }
+            if (far_entry != std::numeric_limits<float>::infinity())
+            {
+                stack[stack_size++] = {far_child, far_entry};
+            }
+            current = near_child;
+        }
+
+        const BVHNode& leaf{nodes_[current]};
+        if (!leaf.is_leaf())
+        {
+            continue;
+        }
+        for (std::size_t i = leaf.first; i < leaf.first + leaf.count; ++i)
+        {
+            if (std::optional<RayHit> hit{intersect(ray, triangle(i), closest_distance)})
+            {
+                hit->triangle = triangle_ids_[i];
+                closest_distance = hit->distance;
+                closest = hit;
+            }
+        }
+    }
+    return closest;
+}
+
+std::optional<ClosestPoint> BVH::closest_point(const glm::vec3& point, float max_distance) const
+{
+    if (nodes_.empty())
+    {
+        return std::nullopt;
+    }
+
+    std::optional<ClosestPoint> closest;
+    float closest_squared_distance{max_distance * max_distance};
+
+    // Nodes left to visit, with their squared distance to the point
+    std::array<std::pair<std::uint32_t, float>, max_depth> stack{};
+    std::size_t stack_size{0};
+    stack[stack_size++] = {0, squared_distance(nodes_[0], point)};
+    while (stack_size > 0)
+    {
+        const auto [node_index, node_distance]{stack[--stack_size]};
+        if (node_distance > closest_squared_distance)
+        {
+            continue;
+        }
+
+        const BVHNode& node{nodes_[node_index]};
+        if (node.is_leaf())
+        {
+            for (std::size_t i = node.first; i < node.first + node.count; ++i)
+            {
+                const glm::vec3 candidate{closest_point_on_triangle(point, triangle(i))};
+                const glm::vec3 offset{candidate - point};
+                const float candidate_distance{glm::dot(offset, offset)};
+                if (candidate_distance <= closest_squared_distance)
+                {
+                    closest_squared_distance = candidate_distance;
+                    closest = ClosestPoint{.triangle = triangle_ids_[i], .point = candidate, .distance = 0.0f};
+                }
+            }
+            continue;
+        }
+
+        // Push the farther child first, so the nearer one is visited next
+        std::uint32_t near_child{node.first};
+        std::uint32_t far_child{node.first + 1};
+        float near_distance{squared_distance(nodes_[near_child], point)};
+        float far_distance{squared_distance(nodes_[far_child], point)};
+        if (far_distance < near_distance)
+        {
+            std::swap(near_child, far_child);
+            std::swap(near_distance, far_distance);
+        }
+        if (far_distance <= closest_squared_distance)
+        {
+            stack[stack_size++] = {far_child, far_distance};
+        }
+        if (near_distance <= closest_squared_distance)
+        {
+            stack[stack_size++] = {near_child, near_distance};
+        }
+    }
+
+    if (closest)
+    {
+        closest->distance = std::sqrt(closest_squared_distance);
+    }
+    return closest;
+}
+
+void BVH::overlapping_triangles(const AABB& box, std::vector<std::size_t>& triangles) const
+{
+    if (nodes_.empty() || !overlap(node_bounds(nodes_[0]), box))
+    {
+        return;
+    }
+
+    std::array<std::uint32_t, max_depth> stack{};
+    std::size_t stack_size{0};
+    stack[stack_size++] = 0;
+    while (stack_size > 0)
+    {
+        const BVHNode& node{nodes_[stack[--stack_size]]};
+        if (node.is_leaf())
+        {
+            for (std::size_t i = node.first; i < node.first + node.count; ++i)
+            {
+                AABB triangle_bounds{};
+                for (const glm::vec3& vertex : triangle(i))
+                {
+                    triangle_bounds.expand(vertex);
+                }
+                if (overlap(triangle_bounds, box))
+                {
+                    triangles.push_back(triangle_ids_[i]);
+                }
+            }
+            continue;
+        }
+
+        for (const std::uint32_t child : {node.first, node.first + 1})
+        {
+            if (overlap(node_bounds(nodes_[child]), box))
+            {
+                stack[stack_size++] = child;
+            }
+        }
+    }
+}
+
+std::size_t BVH::refit(std::span<const glm::vec3> vertices, JobSystem& jobs)
+{
+    PHYSSCOPE_TRACE_SCOPE("BVH::refit");
+    if (vertices.size() != vertices_.size())
+    {
+        std::cerr << "Cannot refit a BVH of " << vertices_.size() << " vertices to " << vertices.size() << std::endl;
+        return 0;
+    }
+
+    std::copy(vertices.begin(), vertices.end(), vertices_.begin());
+    if (nodes_.empty())
+    {
+        return 0;
+    }
+    refit(0, refit_parallel_depth(jobs), costs_, jobs);
+
+    // Rebuild the largest subtrees that degraded: the first ones found from the root down
+    std::vector<std::pair<std::uint32_t, std::size_t>> degraded;
+    std::array<std::pair<std::uint32_t, std::size_t>, max_depth> stack{};
+    std::size_t stack_size{0};
+    stack[stack_size++] = {0, 1};
+    while (stack_size > 0)
+    {
+        const auto [node_index, node_depth]{stack[--stack_size]};
+        const BVHNode& node{nodes_[node_index]};
+        if (costs_[node_index] > settings_.rebuild_threshold * build_costs_[node_index])
+        {
+            degraded.emplace_back(node_index, node_depth);
+        }
+        else if (!node.is_leaf())
+        {
+            stack[stack_size++] = {node.first, node_depth + 1};
+            stack[stack_size++] = {node.first + 1, node_depth + 1};
+        }
+    }
+
+    std::size_t num_rebuilt{0};
+    for (const auto& [node_index, node_depth] : degraded)
+    {
+        num_rebuilt += rebuild(node_index, node_depth, jobs);
+    }
+
+    // The ancestors of rebuilt subtrees are cheaper now
+    if (num_rebuilt > 0)
+    {
+        refit(0, refit_parallel_depth(jobs), costs_, jobs);
+    }
+    return num_rebuilt;
+}
+
+float BVH::refit(std::uint32_t node_index, std::size_t parallel_depth, std::vector<float>& costs, JobSystem& jobs)
+{
+    BVHNode& node{nodes_[node_index]};
+    AABB box{};
+    float cost{0.0f};
+    if (node.is_leaf())
+    {
+        for (std::size_t i = node.first; i < node.first + node.count; ++i)
+        {
+            for (const glm::vec3& vertex : triangle(i))
+            {
+                box.expand(vertex);
+            }
+        }
+        cost = static_cast<float>(node.count);
+    }
+    else
+    {
+        const std::uint32_t first_child{node.first};
+        std::array<float, 2> child_costs{};
+        if (parallel_depth > 0)
+        {
+            TaskGroup group{jobs};
+            group.run([&] { child_costs[0] = refit(first_child, parallel_depth - 1, costs, jobs); });
+            child_costs[1] = refit(first_child + 1, parallel_depth - 1, costs, jobs);
+            group.wait();
+        }
+        else
+        {
+            child_costs[0] = refit(first_child, 0, costs, jobs);
+            child_costs[1] = refit(first_child + 1, 0, costs, jobs);
+        }
+
+        // Children are traversed with the probability that a ray hitting the node hits them too
+        const AABB first_bounds{node_bounds(nodes_[first_child])};
+        const AABB second_bounds{node_bounds(nodes_[first_child + 1])};
+        box = first_bounds;
+        box.expand(second_bounds);
+        const float area{surface_area(box)};
+        cost = area > 0.0f ? 1.0f + (surface_area(first_bounds) * child_costs[0] +
+                                     surface_area(second_bounds) * child_costs[1]) /
+                                        area
+                           : 1.0f + std::max(child_costs[0], child_costs[1]);
+    }
+
+    node.min = box.min;
+    node.max = box.max;
+    costs[node_index] = cost;
+    return cost;
+}
+
+std::size_t BVH::rebuild(std::uint32_t node_index, std::size_t depth, JobSystem& jobs)
+{
+    PHYSSCOPE_TRACE_SCOPE("BVH::rebuild");
+
+    // The subtree's leaves cover a contiguous range of triangles; free its nodes but the root
+    std::size_t begin{triangles_.size()};
+    std::size_t end{0};
+    std::array<std::uint32_t, max_depth> stack{};
+    std::size_t stack_size{0};
+    stack[stack_size++] = node_index;
+    while (stack_size > 0)
+    {
+        const BVHNode& node{nodes_[stack[--stack_size]]};
+        if (node.is_leaf())
+        {
+            begin = std::min(begin, static_cast<std::size_t>(node.first));
+            end = std::max(end, static_cast<std::size_t>(node.first + node.count));
+            continue;
+        }
+        free_node_pairs_.push_back(node.first);
+        stack[stack_size++] = node.first;
+        stack[stack_size++] = node.first + 1;
+    }
+
+    const std::size_t count{end - begin};
+    std::vector<Primitive> primitives(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Primitive& primitive{primitives[i]};
+        for (const glm::vec3& vertex : triangle(begin + i))
+        {
+            primitive.bounds.expand(vertex);
+        }
+        primitive.centroid = primitive.bounds.center();
+        primitive.triangle = static_cast<std::uint32_t>(i);
+    }
+
+    std::vector<BVHNode> nodes(2 * count - 1);
+    BVHBuilder builder{settings_, jobs, primitives, nodes};
+    builder.build(0, 0, count, depth);
+    nodes.resize(builder.num_nodes());
+
+    const std::vector<std::array<IndexedTriangleMesh::index_type, 3>> triangles{
+        triangles_.begin() + static_cast<std::ptrdiff_t>(begin), triangles_.begin() + static_cast<std::ptrdiff_t>(end)};
+    const std::vector<std::uint32_t> triangle_ids{triangle_ids_.begin() + static_cast<std::ptrdiff_t>(begin),
+                                                  triangle_ids_.begin() + static_cast<std::ptrdiff_t>(end)};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        triangles_[begin + i] = triangles[primitives[i].triangle];
+        triangle_ids_[begin + i] = triangle_ids[primitives[i].triangle];
+    }
+
+    // Move the new nodes into the BVH; children are allocated after their parent, so come later
+    std::vector<std::uint32_t> locations(nodes.size());
+    locations[0] = node_index;
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        BVHNode node{nodes[i]};
+        if (node.is_leaf())
+        {
+            node.first += static_cast<std::uint32_t>(begin);
+        }
+        else
+        {
+            const std::uint32_t pair{allocate_node_pair()};
+            locations[node.first] = pair;
+            locations[node.first + 1] = pair + 1;
+            node.first = pair;
+        }
+        nodes_[locations[i]] = node;
+    }
+
+    refit(node_index, refit_parallel_depth(jobs), build_costs_, jobs);
+    return count;
+}
+
+std::uint32_t BVH::allocate_node_pair()
+{
+    if (!free_node_pairs_.empty())
+    {
+        const std::uint32_t pair{free_node_pairs_.back()};
+        free_node_pairs_.pop_back();
+        return pair;
+    }
+
+    const auto pair{static_cast<std::uint32_t>(nodes_.size())};
+    nodes_.resize(nodes_.size() + 2);
+    build_costs_.resize(nodes_.size());
+    costs_.resize(nodes_.size());
+    return pair;
+}
+
+AABB BVH::bounds() const
+{
+    return nodes_.empty() ? AABB{} : node_bounds(nodes_[0]);
+}
+
+std::size_t BVH::num_triangles() const
+{
+    return triangles_.size();
+}
+
+std::span<const BVHNode> BVH::nodes() const
+{
+    return nodes_;
+}
+
+std::size_t BVH::depth() const
+{
+    if (nodes_.empty())
+    {
+        return 0;
+    }
+
+    std::size_t deepest{0};
+    std::array<std::pair<std::uint32_t, std::size_t>, max_depth> stack{};
+    std::size_t stack_size{0};
+    stack[stack_size++] = {0, 1};
+    while (stack_size > 0)
+    {
+        const auto [node_index, node_depth]{stack[--stack_size]};
+        const BVHNode& node{nodes_[node_index]};
+        deepest = std::max(deepest, node_depth);
+        if (!node.is_leaf())
+        {
+            stack[stack_size++] = {node.first, node_depth + 1};
+            stack[stack_size++] = {node.first + 1, node_depth + 1};
+        }
+    }
+    return deepest;
+}
+
+float BVH::sah_cost() const
+{
+    return costs_.empty() ? 0.0f : costs_[0];
+}
+
+} // namespace geometry
+
+} // namespace physscope
\ No newline at end of file
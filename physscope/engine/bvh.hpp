@@ -0,0 +1,156 @@
+#ifndef BVH_HPP
+#define BVH_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "geometry.hpp"
+#include "job_system.hpp"
+
+namespace physscope
+{
+
+namespace geometry
+{
+
+/*
+Node of a BVH, 32 bytes so two share a cache line. Inner nodes (count == 0)
+store the index of their first child in first, the second child follows
+it; leaves store the range [first, first + count) of BVH triangles.
+*/
+struct BVHNode
+{
+    glm::vec3 min{0.0f};
+    std::uint32_t first{0};
+    glm::vec3 max{0.0f};
+    std::uint32_t count{0};
+
+    bool is_leaf() const;
+};
+
+static_assert(sizeof(BVHNode) == 32);
+
+struct BVHBuildSettings
+{
+    // Larger leaves are always split; smaller ones only when the SAH says it pays off
+    std::size_t max_leaf_size{8};
+
+    // Subtrees with at least this many triangles are built by several threads
+    std::size_t parallel_threshold{std::size_t{1} << 14};
+
+    // BVH::refit() rebuilds subtrees whose SAH cost grew by more than this factor since they were built
+    float rebuild_threshold{1.5f};
+};
+
+struct Ray
+{
+    glm::vec3 origin{0.0f};
+    glm::vec3 direction{0.0f, 0.0f, 1.0f};
+};
+
+struct RayHit
+{
+    // Index of the triangle in the mesh the BVH was built from
+    std::size_t triangle{0};
+
+    // Hit point is origin + distance * direction, and (1 - u - v) * p0 + u * p1 + v * p2 on the triangle
+    float distance{0.0f};
+    float u{0.0f};
+    float v{0.0f};
+};
+
+struct ClosestPoint
+{
+    std::size_t triangle{0};
+    glm::vec3 point{0.0f};
+    float distance{0.0f};
+};
+
+/*
+Bounding volume hierarchy over the triangles of a mesh, built top-down with
+the surface area heuristic evaluated on 16 bins per axis. Subtrees larger
+than BVHBuildSettings::parallel_threshold are binned with parallel_for()
+and their children built as separate tasks. The BVH keeps its own copy of
+the vertices and of the triangles, reordered so each leaf reads a
+contiguous range; query results refer to the triangles of the original mesh.
+
+For deforming meshes, refit() moves the vertices and updates the bounds
+bottom-up instead of rebuilding: the hierarchy stays valid but loses
+quality as triangles move away from their neighbours, so subtrees whose SAH
+cost degraded past BVHBuildSettings::rebuild_threshold are rebuilt.
+*/
+class BVH
+{
+public:
+    BVH() = default;
+    explicit BVH(const IndexedTriangleMesh& mesh, const BVHBuildSettings& settings = {},
+                 JobSystem& jobs = default_job_system());
+
+    // Closest intersection of the ray closer than max_distance, if any; both faces of the triangles are hit
+    std::optional<RayHit> raycast(const Ray& ray, float max_distance = std::numeric_limits<float>::infinity()) const;
+
+    // Closest point of the mesh to point within max_distance, if any
+    std::optional<ClosestPoint> closest_point(const glm::vec3& point,
+                                              float max_distance = std::numeric_limits<float>::infinity()) const;
+
+    // Append to triangles the mesh triangles whose bounds overlap box (a broad phase: the triangles may not)
+    void overlapping_triangles(const AABB& box, std::vector<std::size_t>& triangles) const;
+
+    /*
+    Replace the vertex positions (as many as the mesh has), refit the bounds
+    and rebuild degraded subtrees. Returns the number of triangles in rebuilt
+    subtrees, so 0 when refitting was enough.
+    */
+    std::size_t refit(std::span<const glm::vec3> vertices, JobSystem& jobs = default_job_system());
+
+    AABB bounds() const;
+    std::size_t num_triangles() const;
+
+    // After partial rebuilds, some nodes may be unused until the space is reused by a later rebuild
+    std::span<const BVHNode> nodes() const;
+
+    // Depth of the deepest leaf, the root being at depth 1
+    std::size_t depth() const;
+
+    // Expected number of node traversals and triangle tests of a ray hitting the BVH bounds, by the SAH
+    float sah_cost() const;
+
+private:
+    // Traversal stacks are fixed arrays of max_depth entries; the build never exceeds it
+    static constexpr std::size_t max_depth{64};
+
+    void build(JobSystem& jobs);
+    std::array<glm::vec3, 3> triangle(std::size_t index) const;
+
+    // Update the bounds of the subtree and store the SAH cost of each of its nodes in costs; returns the root's
+    float refit(std::uint32_t node, std::size_t parallel_depth, std::vector<float>& costs, JobSystem& jobs);
+
+    // Build the subtree of node, at depth, again from its triangles; returns their number
+    std::size_t rebuild(std::uint32_t node, std::size_t depth, JobSystem& jobs);
+    std::uint32_t allocate_node_pair();
+
+    BVHBuildSettings settings_;
+    std::vector<glm::vec3> vertices_;
+    std::vector<std::array<IndexedTriangleMesh::index_type, 3>> triangles_;
+    std::vector<std::uint32_t> triangle_ids_;
+    std::vector<BVHNode> nodes_;
+
+    // SAH cost of each node when its subtree was built, and after the last refit
+    std::vector<float> build_costs_;
+    std::vector<float> costs_;
+
+    // First nodes of the sibling pairs freed by partial rebuilds
+    std::vector<std::uint32_t> free_node_pairs_;
+};
+
+} // namespace geometry
+
+} // namespace physscope
+
+#endif // BVH_HPP
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <random>
+
+#include "ensemble.hpp"
+#include "trace.hpp"
+
+namespace physscope
+{
+
+std::vector<ParameterSet> grid_sweep(const std::vector<ParameterRange>& ranges)
+{
+    std::size_t count{1};
+    for (const ParameterRange& range : ranges)
+    {
+        count *= std::max(range.samples, std::size_t{1});
+    }
+
+    std::vector<ParameterSet> parameter_sets;
+    parameter_sets.reserve(count);
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        // Decompose index in a mixed-radix number; each digit selects a sample of a range
+        ParameterSet parameters;
+        parameters.reserve(ranges.size());
+        std::size_t remainder{index};
+        for (const ParameterRange& range : ranges)
+        {
+            const std::size_t samples{std::max(range.samples, std::size_t{1})};
+            const std::size_t sample{remainder % samples};
+            remainder /= samples;
+
+            const float t{samples > 1 ? static_cast<float>(sample) / static_cast<float>(samples - 1) : 0.0f};
+            parameters.emplace_back(range.name, range.min + t * (range.max - range.min));
+        }
+        parameter_sets.emplace_back(std::move(parameters));
+    }
+
+    return parameter_sets;
+}
+
+std::vector<ParameterSet> random_sweep(const std::vector<ParameterRange>& ranges, std::size_t count,
+                                       std::uint64_t seed)
+{
+    std::mt19937_64 generator{seed};
+    std::vector<ParameterSet> parameter_sets;
+    parameter_sets.reserve(count);
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        ParameterSet parameters;
+        parameters.reserve(ranges.size());
+        for (const ParameterRange& range : ranges)
+        {
+            std::uniform_real_distribution<float> distribution{std::min(range.min, range.max),
+                                                               std::max(range.min, range.max)};
+            parameters.emplace_back(range.name, distribution(generator));
+        }
+        parameter_sets.emplace_back(std::move(parameters));
+    }
+
+    return parameter_sets;
+}
+
+std::vector<EnsembleRun> run_ensemble(const SimulationFactory& factory, const std::vector<ParameterSet>& parameter_sets,
+                                      const HeadlessSettings& settings, JobSystem& jobs)
+{
+    HeadlessSettings run_settings{settings};
+    run_settings.state_output = nullptr;
+
+    std::vector<EnsembleRun> runs(parameter_sets.size());
+    jobs.parallel_for(
+        0, parameter_sets.size(),
+        [&](std::size_t first, std::size_t last)
+        {
+            for (std::size_t index = first; index < last; ++index)
+            {
+                PHYSSCOPE_TRACE_SCOPE("ensemble run");
+                std::unique_ptr<Application> simulation{factory()};
+                for (const auto& [name, value] : parameter_sets[index])
+                {
+                    simulation->submit_parameter(name, value);
+                }
+
+                EnsembleRun& run{runs[index]};
+                run.parameters = parameter_sets[index];
+                run.report = simulation->run_headless(run_settings);
+                run.metrics = simulation->summary_metrics();
+            }
+        },
+        1);
+
+    return runs;
+}
+
+void write_csv(std::ostream& output, const std::vector<EnsembleRun>& runs)
+{
+    if (runs.empty())
+    {
+        return;
+    }
+
+    for (const auto& [name, value] : runs.front().parameters)
+    {
+        output << name << ',';
+    }
+    for (const auto& [name, value] : runs.front().metrics)
+    {
+        output << name << ',';
+    }
+    output << "steps_per_second\n";
+
+    for (const EnsembleRun& run : runs)
+    {
+        for (const auto& [name, value] : run.parameters)
+        {
+            output << value << ',';
+        }
+        for (const auto& [name, value] : run.metrics)
+        {
+            output << value << ',';
+        }
+        output << run.report.steps_per_second << '\n';
+    }
+}
+
+} // namespace physscope
\ No newline at end of file
@@ -0,0 +1,71 @@
+#ifndef ENSEMBLE_HPP
+#define ENSEMBLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "application.hpp"
+#include "job_system.hpp"
+
+namespace physscope
+{
+
+// Values of named parameters, applied to a simulation through Application::submit_parameter()
+using ParameterSet = std::vector<std::pair<std::string, float>>;
+
+struct ParameterRange
+{
+    std::string name;
+    float min{0.0f};
+    float max{0.0f};
+
+    // Number of evenly spaced values used by grid_sweep()
+    std::size_t samples{1};
+};
+
+struct EnsembleRun
+{
+    ParameterSet parameters;
+    HeadlessReport report;
+    std::vector<std::pair<std::string, double>> metrics;
+};
+
+// Creates a new, independent simulation for each run of the ensemble
+using SimulationFactory = std::function<std::unique_ptr<Application>()>;
+
+/*
+Return the cartesian product of the ranges: each range contributes
+range.samples evenly spaced values between range.min and range.max.
+*/
+std::vector<ParameterSet> grid_sweep(const std::vector<ParameterRange>& ranges);
+
+// Return count parameter sets with values drawn uniformly from each range
+std::vector<ParameterSet> random_sweep(const std::vector<ParameterRange>& ranges, std::size_t count,
+                                       std::uint64_t seed = 0);
+
+/*
+Run one headless simulation for each parameter set, spread among the
+threads of jobs. Each simulation is created by factory, receives its
+parameters through submit_parameter() and is run with run_headless(settings);
+settings.state_output is ignored. Runs are returned in the same order as
+parameter_sets.
+*/
+std::vector<EnsembleRun> run_ensemble(const SimulationFactory& factory, const std::vector<ParameterSet>& parameter_sets,
+                                      const HeadlessSettings& settings, JobSystem& jobs = default_job_system());
+
+/*
+Write one line per run with its parameters, summary metrics and steps/second.
+The header is taken from the first run; all runs are expected to share the
+same parameter and metric names.
+*/
+void write_csv(std::ostream& output, const std::vector<EnsembleRun>& runs);
+
+} // namespace physscope
+
+#endif // ENSEMBLE_HPP
\ No newline at end of file
@@ -1,3 +1,5 @@
+#include <iostream>
+
 #include "geometry.hpp"
 
 namespace physscope
@@ -16,19 +18,108 @@ const glm::vec3& Triangle::vertex(std::size_t index) const
     return vertices_[index];
 }
 
-std::size_t IndexedTriangleMesh::num_vertices() const
+bool AABB::is_empty() const
+{
+    return min.x > max.x || min.y > max.y || min.z > max.z;
+}
+
+glm::vec3 AABB::center() const
+{
+    return (min + max) * 0.5f;
+}
+
+glm::vec3 AABB::extent() const
+{
+    return max - min;
+}
+
+void AABB::expand(const glm::vec3& point)
+{
+    min = glm::min(min, point);
+    max = glm::max(max, point);
+}
+
+void AABB::expand(const AABB& box)
+{
+    min = glm::min(min, box.min);
+    max = glm::max(max, box.max);
+}
+
+AABB bounds(std::span<const glm::vec3> points)
+{
+    AABB box{};
+    for (const glm::vec3& point : points)
+    {
+        box.expand(point);
+    }
+    return box;
+}
+
+template <typename Index>
+std::size_t BasicIndexedTriangleMesh<Index>::num_vertices() const
 {
     return vertices.size();
 }
 
-std::size_t IndexedTriangleMesh::num_indices() const
+template <typename Index>
+std::size_t BasicIndexedTriangleMesh<Index>::num_indices() const
 {
     return indices.size();
 }
 
-Triangle IndexedTriangleMesh::triangle(std::size_t triangle) const
+template <typename Index>
+Triangle BasicIndexedTriangleMesh<Index>::triangle(std::size_t triangle) const
+{
+    const std::array<Index, 3>& corners{indices[triangle]};
+    return Triangle{vertices[corners[0]], vertices[corners[1]], vertices[corners[2]]};
+}
+
+template struct BasicIndexedTriangleMesh<std::uint16_t>;
+template struct BasicIndexedTriangleMesh<std::uint32_t>;
+template struct BasicIndexedTriangleMesh<std::uint64_t>;
+
+std::span<const glm::vec3> TriangleMeshScene::shape_vertices(std::size_t shape) const
+{
+    return std::span<const glm::vec3>{vertices}.subspan(shapes[shape].first_vertex, shapes[shape].num_vertices);
+}
+
+std::span<const std::array<TriangleMeshScene::index_type, 3>> TriangleMeshScene::shape_indices(std::size_t shape) const
+{
+    return std::span<const std::array<index_type, 3>>{indices}.subspan(shapes[shape].first_triangle,
+                                                                         shapes[shape].num_triangles);
+}
+
+AABB TriangleMeshScene::bounds() const
 {
-    return Triangle{vertices[3 * triangle], vertices[3 * triangle + 1], vertices[3 * triangle + 2]};
+    AABB box{};
+    for (const SceneShape& shape : shapes)
+    {
+        box.expand(shape.bounds);
+    }
+    return box;
+}
+
+IndexedTriangleMesh TriangleMeshScene::merged() const
+{
+    if (!fits_index_type<IndexedTriangleMesh::index_type>(vertices.size()))
+    {
+        std::cerr << "TriangleMeshScene::merged: too many vertices for 32-bit indices" << std::endl;
+        return IndexedTriangleMesh{};
+    }
+
+    IndexedTriangleMesh mesh{.vertices = vertices, .indices = {}};
+    mesh.indices.reserve(indices.size());
+    for (const SceneShape& shape : shapes)
+    {
+        for (std::size_t triangle = shape.first_triangle; triangle < shape.first_triangle + shape.num_triangles;
+             ++triangle)
+        {
+            const std::array<index_type, 3>& local{indices[triangle]};
+            const auto first_vertex{static_cast<IndexedTriangleMesh::index_type>(shape.first_vertex)};
+            mesh.indices.push_back({first_vertex + local[0], first_vertex + local[1], first_vertex + local[2]});
+        }
+    }
+    return mesh;
 }
 
 } // namespace geometry
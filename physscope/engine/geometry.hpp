@@ -2,7 +2,13 @@
 #define GEOMETRY_HPP
 
 #include <array>
+#include <cstdint>
 #include <glm/glm.hpp>
+#include <limits>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <variant>
 #include <vector>
 
 namespace physscope
@@ -22,16 +28,139 @@ private:
     std::array<glm::vec3, 3> vertices_{};
 };
 
-struct IndexedTriangleMesh
+// Axis-aligned bounding box; empty (min > max) when default-constructed
+struct AABB
 {
+    glm::vec3 min{std::numeric_limits<float>::infinity()};
+    glm::vec3 max{-std::numeric_limits<float>::infinity()};
+
+    bool is_empty() const;
+    glm::vec3 center() const;
+    glm::vec3 extent() const;
+
+    // Grow the box to contain point or box
+    void expand(const glm::vec3& point);
+    void expand(const AABB& box);
+};
+
+// Return the smallest box containing points
+AABB bounds(std::span<const glm::vec3> points);
+
+/*
+Triangle mesh whose triangles index its vertices with Index, an unsigned
+integer type. Narrow indices save memory and bandwidth wherever triangles
+are walked: 6 bytes per triangle with 16-bit indices, 12 with 32-bit ones.
+*/
+template <typename Index>
+struct BasicIndexedTriangleMesh
+{
+    using index_type = Index;
+
     std::vector<glm::vec3> vertices;
-    std::vector<std::array<std::size_t, 3>> indices;
+    std::vector<std::array<Index, 3>> indices;
 
     std::size_t num_vertices() const;
     std::size_t num_indices() const;
     Triangle triangle(std::size_t triangle) const;
 };
 
+extern template struct BasicIndexedTriangleMesh<std::uint16_t>;
+extern template struct BasicIndexedTriangleMesh<std::uint32_t>;
+extern template struct BasicIndexedTriangleMesh<std::uint64_t>;
+
+/*
+32-bit indices are the default because Polyscope and the binary mesh format
+store them; the *_narrowest loaders and narrow_indices() provide the other
+widths, 64-bit ones being needed beyond 2^32 vertices.
+*/
+using IndexedTriangleMesh = BasicIndexedTriangleMesh<std::uint32_t>;
+using IndexedTriangleMesh16 = BasicIndexedTriangleMesh<std::uint16_t>;
+using IndexedTriangleMesh64 = BasicIndexedTriangleMesh<std::uint64_t>;
+
+// A mesh stored with the narrowest index type that fits its vertices (see narrow_indices())
+using AnyIndexedTriangleMesh = std::variant<IndexedTriangleMesh16, IndexedTriangleMesh, IndexedTriangleMesh64>;
+
+// Whether Index can address num_vertices vertices
+template <typename Index>
+constexpr bool fits_index_type(std::size_t num_vertices)
+{
+    return num_vertices == 0 || num_vertices - 1 <= std::numeric_limits<Index>::max();
+}
+
+// Copy mesh with its indices converted to To, which must fit its vertices (see fits_index_type())
+template <typename To, typename From>
+BasicIndexedTriangleMesh<To> convert_indices(const BasicIndexedTriangleMesh<From>& mesh)
+{
+    BasicIndexedTriangleMesh<To> converted{.vertices = mesh.vertices, .indices = {}};
+    converted.indices.reserve(mesh.indices.size());
+    for (const std::array<From, 3>& triangle : mesh.indices)
+    {
+        converted.indices.push_back(
+            {static_cast<To>(triangle[0]), static_cast<To>(triangle[1]), static_cast<To>(triangle[2])});
+    }
+    return converted;
+}
+
+// Store mesh with the narrowest index type that fits its vertices
+template <typename Index>
+AnyIndexedTriangleMesh narrow_indices(BasicIndexedTriangleMesh<Index> mesh)
+{
+    const auto store = [&mesh]<typename To>() -> AnyIndexedTriangleMesh
+    {
+        if constexpr (std::is_same_v<To, Index>)
+        {
+            return std::move(mesh);
+        }
+        else
+        {
+            return convert_indices<To>(mesh);
+        }
+    };
+
+    if (fits_index_type<std::uint16_t>(mesh.num_vertices()))
+    {
+        return store.template operator()<std::uint16_t>();
+    }
+    if (fits_index_type<std::uint32_t>(mesh.num_vertices()))
+    {
+        return store.template operator()<std::uint32_t>();
+    }
+    return store.template operator()<std::uint64_t>();
+}
+
+// Part of a TriangleMeshScene; the indices of its triangles are relative to first_vertex
+struct SceneShape
+{
+    std::string name;
+    std::size_t first_vertex{0};
+    std::size_t num_vertices{0};
+    std::size_t first_triangle{0};
+    std::size_t num_triangles{0};
+    AABB bounds{};
+};
+
+/*
+Several triangle meshes stored in a single pair of vertex and index buffers.
+Each shape owns a contiguous range of both, and its indices are relative to
+its first vertex, so a shape can be registered or simulated on its own through
+shape_vertices() and shape_indices(), without copying.
+*/
+struct TriangleMeshScene
+{
+    using index_type = IndexedTriangleMesh::index_type;
+
+    std::vector<glm::vec3> vertices;
+    std::vector<std::array<index_type, 3>> indices;
+    std::vector<SceneShape> shapes;
+
+    std::span<const glm::vec3> shape_vertices(std::size_t shape) const;
+    std::span<const std::array<index_type, 3>> shape_indices(std::size_t shape) const;
+    AABB bounds() const;
+
+    // Copy every shape into a single mesh; empty (with an error) if its vertices don't fit 32-bit indices
+    IndexedTriangleMesh merged() const;
+};
+
 } // namespace geometry
 
 } // namespace physscope
@@ -1,37 +1,404 @@
 #include "io.hpp"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <limits>
 #include <tiny_obj_loader.h>
 
+#include "mapped_file.hpp"
+#include "trace.hpp"
+
 namespace physscope
 {
 
-geometry::IndexedTriangleMesh read_triangle_mesh_obj(std::string_view filename, bool verbose)
+namespace
 {
-    tinyobj::ObjReaderConfig reader_config;
-    reader_config.mtl_search_path = "assets/";
-    tinyobj::ObjReader reader;
 
-    if (!reader.ParseFromFile(filename.data(), reader_config))
+// Smallest chunk of OBJ text parsed by a single job
+constexpr std::size_t min_chunk_size{std::size_t{1} << 20};
+
+// Line-aligned part of an OBJ file and the range of the mesh it fills
+struct ObjChunk
+{
+    std::string_view text;
+    std::size_t num_vertices{0};
+    std::size_t num_triangles{0};
+    std::size_t first_vertex{0};
+    std::size_t first_triangle{0};
+};
+
+bool is_blank(char character)
+{
+    return character == ' ' || character == '\t' || character == '\r';
+}
+
+// Remove and return the first whitespace-separated token of line
+std::string_view next_token(std::string_view& line)
+{
+    std::size_t begin{0};
+    while (begin < line.size() && is_blank(line[begin]))
     {
-        if (!reader.Error().empty())
+        ++begin;
+    }
+    std::size_t end{begin};
+    while (end < line.size() && !is_blank(line[end]))
+    {
+        ++end;
+    }
+    const std::string_view token{line.substr(begin, end - begin)};
+    line.remove_prefix(end);
+    return token;
+}
+
+template <typename Function>
+void for_each_line(std::string_view text, const Function& function)
+{
+    while (!text.empty())
+    {
+        const std::size_t end{text.find('\n')};
+        function(text.substr(0, end));
+        text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+    }
+}
+
+std::vector<ObjChunk> split_into_chunks(std::string_view text, std::size_t max_chunks)
+{
+    const std::size_t num_chunks{std::clamp(text.size() / min_chunk_size, std::size_t{1}, max_chunks)};
+    const std::size_t chunk_size{text.size() / num_chunks + 1};
+    std::vector<ObjChunk> chunks;
+    chunks.reserve(num_chunks);
+    while (!text.empty())
+    {
+        // Extend each chunk to the end of its last line
+        std::size_t end{std::min(chunk_size, text.size())};
+        while (end < text.size() && text[end - 1] != '\n')
         {
-            std::cerr << "TinyObjReader: " << reader.Error();
+            ++end;
         }
-        exit(1);
+        chunks.emplace_back(ObjChunk{.text = text.substr(0, end)});
+        text.remove_prefix(end);
     }
+    return chunks;
+}
 
-    if (!reader.Warning().empty())
+void count_chunk(ObjChunk& chunk)
+{
+    for_each_line(chunk.text,
+                  [&chunk](std::string_view line)
+                  {
+                      const std::string_view keyword{next_token(line)};
+                      if (keyword == "v")
+                      {
+                          ++chunk.num_vertices;
+                      }
+                      else if (keyword == "f")
+                      {
+                          std::size_t corners{0};
+                          while (!next_token(line).empty())
+                          {
+                              ++corners;
+                          }
+                          chunk.num_triangles += corners >= 3 ? corners - 2 : 0;
+                      }
+                  });
+}
+
+float parse_float(std::string_view token)
+{
+    float value{0.0f};
+    std::from_chars(token.data(), token.data() + token.size(), value);
+    return value;
+}
+
+// Convert the vertex index of a face corner ("v", "v/vt", "v//vn" or "v/vt/vn") to a 0-based index
+std::size_t parse_vertex_index(std::string_view corner, std::size_t vertices_before, std::size_t total_vertices,
+                               bool& valid)
+{
+    long long index{0};
+    std::from_chars(corner.data(), corner.data() + corner.size(), index);
+    const long long resolved{index > 0 ? index - 1 : static_cast<long long>(vertices_before) + index};
+    if (index == 0 || resolved < 0 || resolved >= static_cast<long long>(total_vertices))
     {
-        std::cout << "TinyObjReader: " << reader.Warning();
+        valid = false;
+        return 0;
     }
+    return static_cast<std::size_t>(resolved);
+}
 
-    return read_triangle_mesh_obj(reader, verbose);
+template <typename Index>
+bool fill_chunk(const ObjChunk& chunk, geometry::BasicIndexedTriangleMesh<Index>& mesh)
+{
+    std::size_t vertex{chunk.first_vertex};
+    std::size_t triangle{chunk.first_triangle};
+    const std::size_t total_vertices{mesh.vertices.size()};
+    bool valid{true};
+    for_each_line(chunk.text,
+                  [&](std::string_view line)
+                  {
+                      const std::string_view keyword{next_token(line)};
+                      if (keyword == "v")
+                      {
+                          const float x{parse_float(next_token(line))};
+                          const float y{parse_float(next_token(line))};
+                          const float z{parse_float(next_token(line))};
+                          mesh.vertices[vertex++] = glm::vec3{x, y, z};
+                      }
+                      else if (keyword == "f")
+                      {
+                          // Fan triangulation around the first corner
+                          std::array<std::size_t, 3> face{};
+                          std::size_t corners{0};
+                          for (std::string_view corner{next_token(line)}; !corner.empty(); corner = next_token(line))
+                          {
+                              const std::size_t index{parse_vertex_index(corner, vertex, total_vertices, valid)};
+                              if (corners < 2)
+                              {
+                                  face[corners] = index;
+                              }
+                              else
+                              {
+                                  face[2] = index;
+                                  mesh.indices[triangle++] = {static_cast<Index>(face[0]), static_cast<Index>(face[1]),
+                                                              static_cast<Index>(face[2])};
+                                  face[1] = index;
+                              }
+                              ++corners;
+                          }
+                      }
+                  });
+    return valid;
 }
 
-geometry::IndexedTriangleMesh read_triangle_mesh_obj(std::string_view wavefront, std::string_view mtl, bool verbose)
+// Chunks of an OBJ text with their ranges of the mesh assigned, and the size of the mesh
+struct ObjLayout
 {
-    tinyobj::ObjReader reader;
-    if (!reader.ParseFromString(wavefront.data(), mtl.data()))
+    std::vector<ObjChunk> chunks;
+    std::size_t num_vertices{0};
+    std::size_t num_triangles{0};
+};
+
+// Counting pass of parse_triangle_mesh_obj(), so the mesh is allocated once with the right index type
+ObjLayout count_obj(std::string_view wavefront, JobSystem& jobs)
+{
+    ObjLayout layout{.chunks = split_into_chunks(wavefront, 4 * jobs.num_threads())};
+    std::vector<ObjChunk>& chunks{layout.chunks};
+    jobs.parallel_for(
+        0, chunks.size(),
+        [&chunks](std::size_t first, std::size_t last)
+        {
+            for (std::size_t i = first; i < last; ++i)
+            {
+                count_chunk(chunks[i]);
+            }
+        },
+        1);
+
+    // Each chunk writes to its own range of the mesh
+    for (ObjChunk& chunk : chunks)
+    {
+        chunk.first_vertex = layout.num_vertices;
+        chunk.first_triangle = layout.num_triangles;
+        layout.num_vertices += chunk.num_vertices;
+        layout.num_triangles += chunk.num_triangles;
+    }
+    return layout;
+}
+
+// Filling pass of parse_triangle_mesh_obj()
+template <typename Index>
+geometry::BasicIndexedTriangleMesh<Index> fill_obj(const ObjLayout& layout, JobSystem& jobs)
+{
+    geometry::BasicIndexedTriangleMesh<Index> mesh{};
+    mesh.vertices.resize(layout.num_vertices);
+    mesh.indices.resize(layout.num_triangles);
+    std::atomic<bool> valid{true};
+    jobs.parallel_for(
+        0, layout.chunks.size(),
+        [&layout, &mesh, &valid](std::size_t first, std::size_t last)
+        {
+            for (std::size_t i = first; i < last; ++i)
+            {
+                if (!fill_chunk(layout.chunks[i], mesh))
+                {
+                    valid.store(false);
+                }
+            }
+        },
+        1);
+
+    if (!valid.load())
+    {
+        std::cerr << "parse_triangle_mesh_obj: face with an invalid vertex index" << std::endl;
+        return geometry::BasicIndexedTriangleMesh<Index>{};
+    }
+    return mesh;
+}
+
+/*
+Splits OBJ polygon faces into triangles, reusing its buffers across faces so
+triangulating a mesh allocates nothing per face. Positions are the flat
+x, y, z array of tinyobj::attrib_t.
+*/
+class PolygonTriangulator
+{
+public:
+    PolygonTriangulator(const std::vector<float>& positions, Triangulation triangulation) :
+        positions_{positions}, triangulation_{triangulation}
+    {
+    }
+
+    // Pass the face_size - 2 triangles of the face of mesh starting at face_start to emit, as OBJ vertex indices
+    template <typename Emit>
+    void triangulate(const tinyobj::mesh_t& mesh, std::size_t face_start, std::size_t face_size, Emit&& emit)
+    {
+        corners_.resize(face_size);
+        for (std::size_t corner = 0; corner < face_size; ++corner)
+        {
+            corners_[corner] = static_cast<std::size_t>(mesh.indices[face_start + corner].vertex_index);
+        }
+
+        if (face_size == 3 || triangulation_ == Triangulation::fan || !clip_ears(emit))
+        {
+            fan(emit);
+        }
+    }
+
+private:
+    glm::vec3 position(std::size_t vertex) const
+    {
+        return glm::vec3{positions_[3 * vertex], positions_[3 * vertex + 1], positions_[3 * vertex + 2]};
+    }
+
+    // Fan around the first remaining corner
+    template <typename Emit>
+    void fan(Emit& emit)
+    {
+        for (std::size_t corner = 2; corner < corners_.size(); ++corner)
+        {
+            emit(std::array<std::size_t, 3>{corners_[0], corners_[corner - 1], corners_[corner]});
+        }
+    }
+
+    /*
+    Ear clipping in the plane that the polygon covers the most: the corners
+    are projected by dropping the dominant axis of the Newell normal, and
+    convexity is measured relative to the sign of the projected area.
+    Returns false, leaving the corners left to fan(), if no ear is found
+    (degenerate or self-intersecting polygons).
+    */
+    template <typename Emit>
+    bool clip_ears(Emit& emit)
+    {
+        glm::vec3 normal{0.0f};
+        for (std::size_t corner = 0; corner < corners_.size(); ++corner)
+        {
+            const glm::vec3 current{position(corners_[corner])};
+            const glm::vec3 next{position(corners_[(corner + 1) % corners_.size()])};
+            normal += glm::cross(current, next);
+        }
+        const glm::vec3 magnitude{glm::abs(normal)};
+        const int dropped{magnitude.x > magnitude.y ? (magnitude.x > magnitude.z ? 0 : 2)
+                                                    : (magnitude.y > magnitude.z ? 1 : 2)};
+        const int u_axis{(dropped + 1) % 3};
+        const int v_axis{(dropped + 2) % 3};
+        const float orientation{normal[dropped] < 0.0f ? -1.0f : 1.0f};
+
+        projected_.resize(corners_.size());
+        for (std::size_t corner = 0; corner < corners_.size(); ++corner)
+        {
+            const glm::vec3 point{position(corners_[corner])};
+            projected_[corner] = {point[u_axis], point[v_axis]};
+        }
+
+        const auto area = [this, orientation](std::size_t a, std::size_t b, std::size_t c)
+        {
+            const std::array<float, 2>& pa{projected_[a]};
+            const std::array<float, 2>& pb{projected_[b]};
+            const std::array<float, 2>& pc{projected_[c]};
+            return orientation * ((pb[0] - pa[0]) * (pc[1] - pa[1]) - (pb[1] - pa[1]) * (pc[0] - pa[0]));
+        };
+
+        // Indices into corners_ and projected_ of the polygon left to clip
+        remaining_.resize(corners_.size());
+        for (std::size_t corner = 0; corner < corners_.size(); ++corner)
+        {
+            remaining_[corner] = corner;
+        }
+
+        while (remaining_.size() > 3)
+        {
+            const std::size_t count{remaining_.size()};
+            bool clipped{false};
+            for (std::size_t i = 0; i < count && !clipped; ++i)
+            {
+                const std::size_t a{remaining_[(i + count - 1) % count]};
+                const std::size_t b{remaining_[i]};
+                const std::size_t c{remaining_[(i + 1) % count]};
+                if (area(a, b, c) <= 0.0f)
+                {
+                    continue;
+                }
+
+                // An ear contains no other corner, including on its edges
+                bool is_ear{true};
+                for (std::size_t j = 0; j < count && is_ear; ++j)
+                {
+                    const std::size_t p{remaining_[j]};
+                    if (p != a && p != b && p != c && projected_[p] != projected_[a] &&
+                        projected_[p] != projected_[b] && projected_[p] != projected_[c])
+                    {
+                        is_ear = area(a, b, p) < 0.0f || area(b, c, p) < 0.0f || area(c, a, p) < 0.0f;
+                    }
+                }
+
+                if (is_ear)
+                {
+                    emit(std::array<std::size_t, 3>{corners_[a], corners_[b], corners_[c]});
+                    remaining_.erase(remaining_.begin() + static_cast<std::ptrdiff_t>(i));
+                    clipped = true;
+                }
+            }
+
+            if (!clipped)
+            {
+                // Keep only the unclipped corners, in order, for fan()
+                for (std::size_t j = 0; j < remaining_.size(); ++j)
+                {
+                    remaining_[j] = corners_[remaining_[j]];
+                }
+                corners_.assign(remaining_.begin(), remaining_.end());
+                return false;
+            }
+        }
+
+        emit(std::array<std::size_t, 3>{corners_[remaining_[0]], corners_[remaining_[1]], corners_[remaining_[2]]});
+        return true;
+    }
+
+    const std::vector<float>& positions_;
+    Triangulation triangulation_;
+    std::vector<std::size_t> corners_;
+    std::vector<std::array<float, 2>> projected_;
+    std::vector<std::size_t> remaining_;
+};
+
+// Number of triangles of the faces of mesh once triangulated; faces with fewer than 3 corners have none
+std::size_t count_triangles(const tinyobj::mesh_t& mesh)
+{
+    std::size_t num_triangles{0};
+    for (const unsigned int face_size : mesh.num_face_vertices)
+    {
+        num_triangles += face_size >= 3 ? face_size - 2 : 0;
+    }
+    return num_triangles;
+}
+
+void report_parse_result(const tinyobj::ObjReader& reader, bool success)
+{
+    if (!success)
     {
         if (!reader.Error().empty())
         {
@@ -44,14 +411,55 @@ geometry::IndexedTriangleMesh read_triangle_mesh_obj(std::string_view wavefront,
     {
         std::cout << "TinyObjReader: " << reader.Warning();
     }
+}
 
-    return read_triangle_mesh_obj(reader, verbose);
+// Faces are read as stored, and triangulated by PolygonTriangulator while converting
+void parse_obj_file(tinyobj::ObjReader& reader, std::string_view filename)
+{
+    tinyobj::ObjReaderConfig reader_config;
+    reader_config.mtl_search_path = "assets/";
+    reader_config.triangulate = false;
+    report_parse_result(reader, reader.ParseFromFile(filename.data(), reader_config));
 }
 
-geometry::IndexedTriangleMesh read_triangle_mesh_obj(tinyobj::ObjReader& reader, bool verbose)
+void parse_obj_string(tinyobj::ObjReader& reader, std::string_view wavefront, std::string_view mtl)
 {
+    tinyobj::ObjReaderConfig reader_config;
+    reader_config.triangulate = false;
+    report_parse_result(reader, reader.ParseFromString(wavefront.data(), mtl.data(), reader_config));
+}
+
+} // namespace
+
+geometry::IndexedTriangleMesh read_triangle_mesh_obj(std::string_view filename, bool verbose,
+                                                     Triangulation triangulation)
+{
+    PHYSSCOPE_TRACE_SCOPE("read_triangle_mesh_obj (file)");
+    tinyobj::ObjReader reader;
+    parse_obj_file(reader, filename);
+    return read_triangle_mesh_obj(reader, verbose, triangulation);
+}
+
+geometry::IndexedTriangleMesh read_triangle_mesh_obj(std::string_view wavefront, std::string_view mtl, bool verbose,
+                                                     Triangulation triangulation)
+{
+    PHYSSCOPE_TRACE_SCOPE("read_triangle_mesh_obj (string)");
+    tinyobj::ObjReader reader;
+    parse_obj_string(reader, wavefront, mtl);
+    return read_triangle_mesh_obj(reader, verbose, triangulation);
+}
+
+geometry::IndexedTriangleMesh read_triangle_mesh_obj(tinyobj::ObjReader& reader, bool verbose,
+                                                     Triangulation triangulation)
+{
+    PHYSSCOPE_TRACE_SCOPE("read_triangle_mesh_obj (convert)");
     auto& attrib = reader.GetAttrib();
     auto& shapes = reader.GetShapes();
+    if (!geometry::fits_index_type<geometry::IndexedTriangleMesh::index_type>(attrib.vertices.size() / 3))
+    {
+        std::cerr << "read_triangle_mesh_obj: too many vertices for 32-bit indices" << std::endl;
+        return geometry::IndexedTriangleMesh{};
+    }
 
     std::vector<glm::vec3> vertices;
     vertices.reserve(attrib.vertices.size() / 3);
@@ -60,8 +468,22 @@ geometry::IndexedTriangleMesh read_triangle_mesh_obj(tinyobj::ObjReader& reader,
         vertices.emplace_back(attrib.vertices[i], attrib.vertices[i + 1], attrib.vertices[i + 2]);
     }
 
-    std::vector<std::array<std::size_t, 3>> indices;
-    std::array<std::size_t, 3> current_face_indices{};
+    // The triangles of every shape are concatenated, so reserve for all of them at once
+    std::size_t num_triangles{0};
+    for (const auto& shape : shapes)
+    {
+        num_triangles += count_triangles(shape.mesh);
+    }
+
+    using Index = geometry::IndexedTriangleMesh::index_type;
+    std::vector<std::array<Index, 3>> indices;
+    indices.reserve(num_triangles);
+    PolygonTriangulator triangulator{attrib.vertices, triangulation};
+    const auto emit = [&indices](const std::array<std::size_t, 3>& triangle)
+    {
+        indices.push_back(
+            {static_cast<Index>(triangle[0]), static_cast<Index>(triangle[1]), static_cast<Index>(triangle[2])});
+    };
     for (std::size_t shape_index = 0; const auto& shape : shapes)
     {
         if (verbose)
@@ -72,14 +494,14 @@ geometry::IndexedTriangleMesh read_triangle_mesh_obj(tinyobj::ObjReader& reader,
             std::cout << "\tNumber of indices:\t" << shape.mesh.indices.size() << std::endl;
         }
 
-        indices.reserve(3 * shape.mesh.num_face_vertices.size());
-        for (std::size_t face = 0; face < shape.mesh.num_face_vertices.size(); ++face)
+        std::size_t face_start{0};
+        for (const unsigned int face_size : shape.mesh.num_face_vertices)
         {
-            for (std::size_t offset = 0; offset < 3; ++offset)
+            if (face_size >= 3)
             {
-                current_face_indices[offset] = shape.mesh.indices[3 * face + offset].vertex_index;
+                triangulator.triangulate(shape.mesh, face_start, face_size, emit);
             }
-            indices.emplace_back(current_face_indices);
+            face_start += face_size;
         }
 
         ++shape_index;
@@ -88,4 +510,315 @@ geometry::IndexedTriangleMesh read_triangle_mesh_obj(tinyobj::ObjReader& reader,
     return geometry::IndexedTriangleMesh{.vertices = std::move(vertices), .indices = std::move(indices)};
 }
 
+geometry::TriangleMeshScene read_scene_obj(std::string_view filename, Triangulation triangulation)
+{
+    PHYSSCOPE_TRACE_SCOPE("read_scene_obj (file)");
+    tinyobj::ObjReader reader;
+    parse_obj_file(reader, filename);
+    return read_scene_obj(reader, triangulation);
+}
+
+geometry::TriangleMeshScene read_scene_obj(std::string_view wavefront, std::string_view mtl,
+                                           Triangulation triangulation)
+{
+    PHYSSCOPE_TRACE_SCOPE("read_scene_obj (string)");
+    tinyobj::ObjReader reader;
+    parse_obj_string(reader, wavefront, mtl);
+    return read_scene_obj(reader, triangulation);
+}
+
+geometry::TriangleMeshScene read_scene_obj(tinyobj::ObjReader& reader, Triangulation triangulation)
+{
+    PHYSSCOPE_TRACE_SCOPE("read_scene_obj (convert)");
+    const auto& attrib = reader.GetAttrib();
+    const auto& shapes = reader.GetShapes();
+
+    /*
+    OBJ shapes index a single vertex list, so each shape gets a copy of the
+    vertices it uses. local_index maps a vertex to its index on the current
+    shape, valid when owner (the last shape that used it) is the current shape.
+    */
+    const std::size_t num_obj_vertices{attrib.vertices.size() / 3};
+    constexpr std::size_t no_owner{std::numeric_limits<std::size_t>::max()};
+    std::vector<std::size_t> owner(num_obj_vertices, no_owner);
+    std::vector<std::size_t> local_index(num_obj_vertices, 0);
+
+    // Counting pass: the ranges of each shape, so the buffers are allocated once
+    geometry::TriangleMeshScene scene{};
+    scene.shapes.reserve(shapes.size());
+    std::size_t num_vertices{0};
+    std::size_t num_triangles{0};
+    for (std::size_t shape_index = 0; shape_index < shapes.size(); ++shape_index)
+    {
+        const tinyobj::mesh_t& mesh{shapes[shape_index].mesh};
+        geometry::SceneShape shape{.name = shapes[shape_index].name,
+                                   .first_vertex = num_vertices,
+                                   .first_triangle = num_triangles};
+        shape.num_triangles = count_triangles(mesh);
+        std::size_t face_start{0};
+        for (const unsigned int face_size : mesh.num_face_vertices)
+        {
+            // Every corner of a polygon ends up in one of its triangles
+            if (face_size >= 3)
+            {
+                for (std::size_t corner = 0; corner < face_size; ++corner)
+                {
+                    const auto vertex{static_cast<std::size_t>(mesh.indices[face_start + corner].vertex_index)};
+                    if (owner[vertex] != shape_index)
+                    {
+                        owner[vertex] = shape_index;
+                        ++shape.num_vertices;
+                    }
+                }
+            }
+            face_start += face_size;
+        }
+
+        // Triangles index the vertices of their own shape
+        if (!geometry::fits_index_type<geometry::TriangleMeshScene::index_type>(shape.num_vertices))
+        {
+            std::cerr << "read_scene_obj: too many vertices on shape " << shape.name << " for 32-bit indices"
+                      << std::endl;
+            return geometry::TriangleMeshScene{};
+        }
+
+        num_vertices += shape.num_vertices;
+        num_triangles += shape.num_triangles;
+        scene.shapes.emplace_back(std::move(shape));
+    }
+
+    scene.vertices.resize(num_vertices);
+    scene.indices.resize(num_triangles);
+    std::fill(owner.begin(), owner.end(), no_owner);
+
+    // Filling pass
+    PolygonTriangulator triangulator{attrib.vertices, triangulation};
+    for (std::size_t shape_index = 0; shape_index < shapes.size(); ++shape_index)
+    {
+        const tinyobj::mesh_t& mesh{shapes[shape_index].mesh};
+        geometry::SceneShape& shape{scene.shapes[shape_index]};
+        std::size_t next_vertex{0};
+        std::size_t triangle{shape.first_triangle};
+        const auto emit = [&](const std::array<std::size_t, 3>& obj_triangle)
+        {
+            std::array<geometry::TriangleMeshScene::index_type, 3>& local_triangle{scene.indices[triangle++]};
+            for (std::size_t corner = 0; corner < 3; ++corner)
+            {
+                local_triangle[corner] =
+                    static_cast<geometry::TriangleMeshScene::index_type>(local_index[obj_triangle[corner]]);
+            }
+        };
+
+        std::size_t face_start{0};
+        for (const unsigned int face_size : mesh.num_face_vertices)
+        {
+            if (face_size >= 3)
+            {
+                for (std::size_t corner = 0; corner < face_size; ++corner)
+                {
+                    const auto vertex{static_cast<std::size_t>(mesh.indices[face_start + corner].vertex_index)};
+                    if (owner[vertex] != shape_index)
+                    {
+                        owner[vertex] = shape_index;
+                        local_index[vertex] = next_vertex++;
+                        const glm::vec3 position{attrib.vertices[3 * vertex], attrib.vertices[3 * vertex + 1],
+                                                 attrib.vertices[3 * vertex + 2]};
+                        scene.vertices[shape.first_vertex + local_index[vertex]] = position;
+                        shape.bounds.expand(position);
+                    }
+                }
+                triangulator.triangulate(mesh, face_start, face_size, emit);
+            }
+            face_start += face_size;
+        }
+    }
+
+    return scene;
+}
+
+geometry::IndexedTriangleMesh parse_triangle_mesh_obj(std::string_view wavefront, JobSystem& jobs)
+{
+    PHYSSCOPE_TRACE_SCOPE("parse_triangle_mesh_obj");
+    const ObjLayout layout{count_obj(wavefront, jobs)};
+    if (!geometry::fits_index_type<geometry::IndexedTriangleMesh::index_type>(layout.num_vertices))
+    {
+        std::cerr << "parse_triangle_mesh_obj: too many vertices for 32-bit indices" << std::endl;
+        return geometry::IndexedTriangleMesh{};
+    }
+    return fill_obj<geometry::IndexedTriangleMesh::index_type>(layout, jobs);
+}
+
+geometry::AnyIndexedTriangleMesh parse_triangle_mesh_obj_narrowest(std::string_view wavefront, JobSystem& jobs)
+{
+    PHYSSCOPE_TRACE_SCOPE("parse_triangle_mesh_obj_narrowest");
+    const ObjLayout layout{count_obj(wavefront, jobs)};
+    if (geometry::fits_index_type<std::uint16_t>(layout.num_vertices))
+    {
+        return fill_obj<std::uint16_t>(layout, jobs);
+    }
+    if (geometry::fits_index_type<std::uint32_t>(layout.num_vertices))
+    {
+        return fill_obj<std::uint32_t>(layout, jobs);
+    }
+    return fill_obj<std::uint64_t>(layout, jobs);
+}
+
+bool write_triangle_mesh_obj(const std::filesystem::path& filename, const geometry::IndexedTriangleMesh& mesh)
+{
+    PHYSSCOPE_TRACE_SCOPE("write_triangle_mesh_obj");
+    std::ofstream output{filename};
+    output << std::setprecision(std::numeric_limits<float>::max_digits10);
+    for (const glm::vec3& vertex : mesh.vertices)
+    {
+        output << "v " << vertex.x << ' ' << vertex.y << ' ' << vertex.z << '\n';
+    }
+    for (const std::array<geometry::IndexedTriangleMesh::index_type, 3>& triangle : mesh.indices)
+    {
+        output << "f " << triangle[0] + 1 << ' ' << triangle[1] + 1 << ' ' << triangle[2] + 1 << '\n';
+    }
+
+    if (!output)
+    {
+        std::cerr << "Failed to write " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool stream_triangle_mesh_obj(const std::filesystem::path& filename, const ObjStreamCallbacks& callbacks,
+                              std::size_t batch_size)
+{
+    PHYSSCOPE_TRACE_SCOPE("stream_triangle_mesh_obj");
+    std::ifstream input{filename, std::ios::binary};
+    if (!input)
+    {
+        std::cerr << "Failed to open " << filename << std::endl;
+        return false;
+    }
+
+    batch_size = std::max(batch_size, std::size_t{1});
+    std::vector<glm::vec3> vertices;
+    std::vector<std::array<std::size_t, 3>> triangles;
+    vertices.reserve(batch_size);
+    triangles.reserve(batch_size);
+    std::size_t num_vertices{0};
+
+    const auto flush_vertices = [&]()
+    {
+        if (!vertices.empty() && callbacks.vertices)
+        {
+            callbacks.vertices(num_vertices - vertices.size(), vertices);
+        }
+        vertices.clear();
+    };
+    const auto flush_triangles = [&]()
+    {
+        // Triangles are delivered after the vertices they reference
+        flush_vertices();
+        if (!triangles.empty() && callbacks.triangles)
+        {
+            callbacks.triangles(triangles);
+        }
+        triangles.clear();
+    };
+
+    bool valid{true};
+    const auto parse_line = [&](std::string_view line)
+    {
+        const std::string_view keyword{next_token(line)};
+        if (keyword == "v")
+        {
+            const float x{parse_float(next_token(line))};
+            const float y{parse_float(next_token(line))};
+            const float z{parse_float(next_token(line))};
+            vertices.emplace_back(x, y, z);
+            ++num_vertices;
+            if (vertices.size() == batch_size)
+            {
+                flush_vertices();
+            }
+        }
+        else if (keyword == "f")
+        {
+            // Fan triangulation around the first corner
+            std::array<std::size_t, 3> face{};
+            std::size_t corners{0};
+            for (std::string_view corner{next_token(line)}; !corner.empty(); corner = next_token(line))
+            {
+                const std::size_t index{parse_vertex_index(corner, num_vertices, num_vertices, valid)};
+                if (corners < 2)
+                {
+                    face[corners] = index;
+                }
+                else
+                {
+                    face[2] = index;
+                    triangles.emplace_back(face);
+                    face[1] = index;
+                    if (triangles.size() == batch_size)
+                    {
+                        flush_triangles();
+                    }
+                }
+                ++corners;
+            }
+        }
+    };
+
+    /*
+    Read the file in blocks; a line split between two blocks is completed by
+    the next one, and a line longer than a block grows the buffer until its
+    end is read.
+    */
+    constexpr std::size_t block_size{std::size_t{1} << 20};
+    std::string buffer;
+    std::size_t pending{0};
+    while (input && valid)
+    {
+        buffer.resize(pending + block_size);
+        input.read(buffer.data() + pending, static_cast<std::streamsize>(block_size));
+        const std::size_t size{pending + static_cast<std::size_t>(input.gcount())};
+        const std::string_view text{buffer.data(), size};
+        const std::size_t last_newline{text.rfind('\n')};
+        const std::size_t complete{!input ? size : last_newline == std::string_view::npos ? 0 : last_newline + 1};
+        for_each_line(text.substr(0, complete), parse_line);
+
+        pending = size - complete;
+        std::copy(buffer.begin() + static_cast<std::ptrdiff_t>(complete),
+                  buffer.begin() + static_cast<std::ptrdiff_t>(size), buffer.begin());
+    }
+    flush_triangles();
+
+    if (!valid)
+    {
+        std::cerr << "stream_triangle_mesh_obj: face with an invalid vertex index" << std::endl;
+    }
+    return valid;
+}
+
+geometry::IndexedTriangleMesh read_triangle_mesh_obj_mapped(const std::filesystem::path& filename, JobSystem& jobs)
+{
+    PHYSSCOPE_TRACE_SCOPE("read_triangle_mesh_obj_mapped");
+    const MappedFile file{filename};
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open " << filename << std::endl;
+        return geometry::IndexedTriangleMesh{};
+    }
+    return parse_triangle_mesh_obj(file.text(), jobs);
+}
+
+geometry::AnyIndexedTriangleMesh read_triangle_mesh_obj_mapped_narrowest(const std::filesystem::path& filename,
+                                                                         JobSystem& jobs)
+{
+    PHYSSCOPE_TRACE_SCOPE("read_triangle_mesh_obj_mapped_narrowest");
+    const MappedFile file{filename};
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open " << filename << std::endl;
+        return geometry::AnyIndexedTriangleMesh{};
+    }
+    return parse_triangle_mesh_obj_narrowest(file.text(), jobs);
+}
+
 } // namespace physscope
\ No newline at end of file
@@ -1,13 +1,20 @@
 #ifndef IO_HPP
 #define IO_HPP
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
 #include <glm/glm.hpp>
+#include <iterator>
+#include <span>
 #include <string_view>
 #include <utility>
 #include <vector>
 
 #include "geometry.hpp"
+#include "job_system.hpp"
 
 // Forward declaration of tinyobj::ObjReader
 namespace tinyobj
@@ -21,17 +28,112 @@ namespace physscope
 {
 
 /*
-WARNING: for now, this function only accepts OBJ files with a single triangle mesh.
-Some OBJ files store multiple triangle meshes. Currently there's no need for this
-functionality, but it would be good to support this for improved flexibility.
-TODO: refactor this function to correctly process multiple triangle meshes.
+How polygon faces (quads and n-gons) are split into triangles: a fan around
+the first corner is exact for convex polygons, ear clipping also handles
+concave ones. Both produce n - 2 triangles for a face with n corners.
 */
-geometry::IndexedTriangleMesh read_triangle_mesh_obj(std::string_view filename, bool verbose = false);
+enum class Triangulation
+{
+    fan,
+    ear_clipping
+};
+
+/*
+Read an OBJ file as a single triangle mesh: when the file stores several
+shapes (objects or groups), their triangles are concatenated. Use
+read_scene_obj() to keep the shapes apart. Polygon faces are triangulated
+while converting, into an index buffer allocated once. The mesh is empty if
+its vertices don't fit 32-bit indices (see parse_triangle_mesh_obj_narrowest()).
+*/
+geometry::IndexedTriangleMesh read_triangle_mesh_obj(std::string_view filename, bool verbose = false,
+                                                     Triangulation triangulation = Triangulation::fan);
 
 geometry::IndexedTriangleMesh read_triangle_mesh_obj(std::string_view wavefront, std::string_view mtl,
-                                                     bool verbose = false);
+                                                     bool verbose = false,
+                                                     Triangulation triangulation = Triangulation::fan);
+
+geometry::IndexedTriangleMesh read_triangle_mesh_obj(tinyobj::ObjReader& reader, bool verbose = false,
+                                                     Triangulation triangulation = Triangulation::fan);
+
+/*
+Read every shape of an OBJ file into a single scene buffer: the vertex and
+index buffers are allocated once, after a counting pass, and each shape
+gets contiguous ranges of both, its name and its bounds. Vertices shared
+by several shapes are copied into each of them. The scene is empty if the
+vertices of a shape don't fit 32-bit indices.
+*/
+geometry::TriangleMeshScene read_scene_obj(std::string_view filename,
+                                           Triangulation triangulation = Triangulation::fan);
+
+geometry::TriangleMeshScene read_scene_obj(std::string_view wavefront, std::string_view mtl,
+                                           Triangulation triangulation = Triangulation::fan);
+
+geometry::TriangleMeshScene read_scene_obj(tinyobj::ObjReader& reader,
+                                           Triangulation triangulation = Triangulation::fan);
+
+/*
+Fast OBJ parser for large meshes: the text is split into line-aligned chunks
+that are parsed in parallel, first to count the vertices and triangles of each
+chunk and then to write them directly into the mesh, allocated once.
+Only vertex positions ("v") and faces ("f") are read; polygons are triangulated
+as fans and negative (relative) indices are supported. On invalid indices, or
+more vertices than 32-bit indices address, an error is printed and an empty
+mesh is returned.
+*/
+geometry::IndexedTriangleMesh parse_triangle_mesh_obj(std::string_view wavefront,
+                                                      JobSystem& jobs = default_job_system());
+
+// As parse_triangle_mesh_obj(), but with the narrowest index type that fits the vertices, chosen after counting them
+geometry::AnyIndexedTriangleMesh parse_triangle_mesh_obj_narrowest(std::string_view wavefront,
+                                                                   JobSystem& jobs = default_job_system());
+
+// Memory-map filename and parse it with parse_triangle_mesh_obj()
+geometry::IndexedTriangleMesh read_triangle_mesh_obj_mapped(const std::filesystem::path& filename,
+                                                            JobSystem& jobs = default_job_system());
+
+// Memory-map filename and parse it with parse_triangle_mesh_obj_narrowest()
+geometry::AnyIndexedTriangleMesh read_triangle_mesh_obj_mapped_narrowest(const std::filesystem::path& filename,
+                                                                         JobSystem& jobs = default_job_system());
+
+// Write mesh as OBJ vertices and faces, with enough digits to read the same floats back; return false on failure
+bool write_triangle_mesh_obj(const std::filesystem::path& filename, const geometry::IndexedTriangleMesh& mesh);
+
+// Receivers of the batches produced by stream_triangle_mesh_obj(); either may be empty
+struct ObjStreamCallbacks
+{
+    // Called with consecutive vertex positions, the first one having index first_vertex
+    std::function<void(std::size_t first_vertex, std::span<const glm::vec3> vertices)> vertices;
+
+    // Called with triangles, after the vertices they reference
+    std::function<void(std::span<const std::array<std::size_t, 3>> triangles)> triangles;
+};
+
+/*
+Read filename sequentially and hand its vertex positions and triangles to
+callbacks in batches of at most batch_size elements, so memory use doesn't
+depend on the size of the mesh, only on its longest line (e.g. to convert
+huge scans into another format or a spatial structure). Faces are read as in parse_triangle_mesh_obj().
+Return false if the file can't be read or a face references a vertex that
+wasn't read yet; batches delivered before the error aren't retracted.
+*/
+bool stream_triangle_mesh_obj(const std::filesystem::path& filename, const ObjStreamCallbacks& callbacks,
+                              std::size_t batch_size = 65536);
 
-geometry::IndexedTriangleMesh read_triangle_mesh_obj(tinyobj::ObjReader& reader, bool verbose = false);
+// As above, but copy the vertices and triangles to output iterators
+template <std::output_iterator<glm::vec3> VertexOutput,
+          std::output_iterator<std::array<std::size_t, 3>> TriangleOutput>
+bool stream_triangle_mesh_obj(const std::filesystem::path& filename, VertexOutput vertex_output,
+                              TriangleOutput triangle_output, std::size_t batch_size = 65536)
+{
+    return stream_triangle_mesh_obj(
+        filename,
+        ObjStreamCallbacks{
+            .vertices = [&vertex_output](std::size_t, std::span<const glm::vec3> vertices)
+            { vertex_output = std::copy(vertices.begin(), vertices.end(), vertex_output); },
+            .triangles = [&triangle_output](std::span<const std::array<std::size_t, 3>> triangles)
+            { triangle_output = std::copy(triangles.begin(), triangles.end(), triangle_output); }},
+        batch_size);
+}
 
 } // namespace physscope
 
@@ -0,0 +1,196 @@
+#include <string>
+
+#include "job_system.hpp"
+#include "trace.hpp"
+
+namespace physscope
+{
+
+namespace
+{
+
+// Number of attempts to find a job before a worker goes to sleep
+constexpr int spin_attempts{64};
+
+// Identifies the worker running on the current thread, if any
+thread_local const JobSystem* current_job_system{nullptr};
+thread_local std::size_t current_worker_index{0};
+
+} // namespace
+
+JobSystem::JobSystem(std::size_t num_threads)
+{
+    const std::size_t num_workers{std::max(num_threads, std::size_t{1}) - 1};
+
+    // Without workers, a single queue is drained by the waiting threads
+    const std::size_t num_queues{std::max(num_workers, std::size_t{1})};
+    queues_.reserve(num_queues);
+    for (std::size_t i = 0; i < num_queues; ++i)
+    {
+        queues_.emplace_back(std::make_unique<WorkerQueue>());
+    }
+
+    workers_.reserve(num_workers);
+    for (std::size_t i = 0; i < num_workers; ++i)
+    {
+        workers_.emplace_back(&JobSystem::worker_loop, this, i);
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::scoped_lock lock_protection{sleep_mutex_};
+        stopping_.store(true);
+    }
+    wake_condition_.notify_all();
+
+    for (std::thread& worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+std::size_t JobSystem::num_threads() const
+{
+    return workers_.size() + 1;
+}
+
+void JobSystem::submit(Job job)
+{
+    // Workers push to their own queue; other threads spread jobs among the workers
+    const std::size_t index{current_job_system == this ? current_worker_index
+                                                       : next_queue_.fetch_add(1) % queues_.size()};
+    queued_jobs_.fetch_add(1);
+    {
+        WorkerQueue& queue{*queues_[index]};
+        std::scoped_lock lock_protection{queue.mutex};
+        queue.jobs.emplace_back(std::move(job));
+    }
+
+    if (sleeping_workers_.load() > 0)
+    {
+        // Lock and unlock the mutex so the notification can't be missed by a worker going to sleep
+        {
+            std::scoped_lock lock_protection{sleep_mutex_};
+        }
+        wake_condition_.notify_one();
+    }
+}
+
+std::optional<JobSystem::Job> JobSystem::find_job()
+{
+    const bool is_worker{current_job_system == this};
+    const std::size_t first{is_worker ? current_worker_index : 0};
+
+    // Pop the most recent job of our own queue
+    if (is_worker)
+    {
+        WorkerQueue& queue{*queues_[first]};
+        std::scoped_lock lock_protection{queue.mutex};
+        if (!queue.jobs.empty())
+        {
+            Job job{std::move(queue.jobs.back())};
+            queue.jobs.pop_back();
+            queued_jobs_.fetch_sub(1);
+            return job;
+        }
+    }
+
+    // Steal the oldest job of another queue
+    for (std::size_t offset = is_worker ? 1 : 0; offset < queues_.size(); ++offset)
+    {
+        WorkerQueue& queue{*queues_[(first + offset) % queues_.size()]};
+        std::scoped_lock lock_protection{queue.mutex};
+        if (!queue.jobs.empty())
+        {
+            Job job{std::move(queue.jobs.front())};
+            queue.jobs.pop_front();
+            queued_jobs_.fetch_sub(1);
+            return job;
+        }
+    }
+
+    return std::nullopt;
+}
+
+void JobSystem::worker_loop(std::size_t index)
+{
+    current_job_system = this;
+    current_worker_index = index;
+    trace::set_thread_name("job worker " + std::to_string(index));
+
+    while (true)
+    {
+        bool found_job{false};
+        for (int attempt = 0; attempt < spin_attempts && !found_job; ++attempt)
+        {
+            if (std::optional<Job> job{find_job()})
+            {
+                (*job)();
+                found_job = true;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        if (found_job)
+        {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock_protection{sleep_mutex_};
+        sleeping_workers_.fetch_add(1);
+        wake_condition_.wait(lock_protection, [this] { return stopping_.load() || queued_jobs_.load() > 0; });
+        sleeping_workers_.fetch_sub(1);
+        if (stopping_.load() && queued_jobs_.load() == 0)
+        {
+            return;
+        }
+    }
+}
+
+TaskGroup::TaskGroup(JobSystem& jobs) : jobs_{jobs}
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+    wait();
+}
+
+void TaskGroup::run(std::function<void()> task)
+{
+    pending_.fetch_add(1);
+    jobs_.submit(
+        [this, task = std::move(task)]
+        {
+            task();
+            pending_.fetch_sub(1);
+        });
+}
+
+void TaskGroup::wait()
+{
+    while (pending_.load() > 0)
+    {
+        if (std::optional<JobSystem::Job> job{jobs_.find_job()})
+        {
+            (*job)();
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+JobSystem& default_job_system()
+{
+    static JobSystem job_system{};
+    return job_system;
+}
+
+} // namespace physscope
\ No newline at end of file
@@ -0,0 +1,145 @@
+#ifndef JOB_SYSTEM_HPP
+#define JOB_SYSTEM_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace physscope
+{
+
+class TaskGroup;
+
+/*
+Work-stealing task scheduler. Each worker thread owns a deque of jobs:
+it pushes and pops jobs at the back of its own deque (LIFO, for cache
+locality), while idle workers steal from the front of the other deques.
+Workers sleep on a condition variable when there's no work left, so an
+idle JobSystem uses no CPU.
+
+Jobs are submitted through a TaskGroup or parallel_for(); threads that
+wait on a TaskGroup execute pending jobs while waiting, so the calling
+thread also contributes to the work.
+*/
+class JobSystem
+{
+public:
+    // Create num_threads - 1 workers; the thread waiting on the work is the remaining one
+    explicit JobSystem(std::size_t num_threads = std::thread::hardware_concurrency());
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem(JobSystem&&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+    JobSystem& operator=(JobSystem&&) = delete;
+
+    // Number of threads executing jobs, including the waiting thread
+    std::size_t num_threads() const;
+
+    /*
+    Call function(first, last) over disjoint sub-ranges covering [begin, end),
+    in parallel. Each sub-range has at most grain_size elements; if grain_size
+    is zero, it is chosen to give each thread a few sub-ranges. Blocks until
+    every sub-range was processed.
+    */
+    template <typename Function>
+    void parallel_for(std::size_t begin, std::size_t end, const Function& function, std::size_t grain_size = 0);
+
+private:
+    friend class TaskGroup;
+
+    using Job = std::function<void()>;
+
+    struct WorkerQueue
+    {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    void submit(Job job);
+    std::optional<Job> find_job();
+    void worker_loop(std::size_t index);
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<std::size_t> next_queue_{0};
+    std::atomic<std::size_t> queued_jobs_{0};
+    std::atomic<std::size_t> sleeping_workers_{0};
+    std::atomic<bool> stopping_{false};
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_condition_;
+};
+
+/*
+Set of jobs that can be waited on as a whole. Jobs may create
+nested task groups (e.g. for recursive algorithms).
+*/
+class TaskGroup
+{
+public:
+    explicit TaskGroup(JobSystem& jobs);
+
+    // Waits for the remaining jobs
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup(TaskGroup&&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+    TaskGroup& operator=(TaskGroup&&) = delete;
+
+    // Schedule task for execution on any thread of the JobSystem
+    void run(std::function<void()> task);
+
+    // Block until every task of this group finishes, executing pending jobs meanwhile
+    void wait();
+
+private:
+    JobSystem& jobs_;
+    std::atomic<std::size_t> pending_{0};
+};
+
+// Process-wide JobSystem sized to the hardware concurrency; created on first use.
+JobSystem& default_job_system();
+
+template <typename Function>
+void JobSystem::parallel_for(std::size_t begin, std::size_t end, const Function& function, std::size_t grain_size)
+{
+    if (begin >= end)
+    {
+        return;
+    }
+
+    const std::size_t size{end - begin};
+    if (grain_size == 0)
+    {
+        grain_size = std::max(size / (4 * num_threads()), std::size_t{1});
+    }
+    if (size <= grain_size)
+    {
+        function(begin, end);
+        return;
+    }
+
+    TaskGroup group{*this};
+    for (std::size_t first = begin + grain_size; first < end; first += grain_size)
+    {
+        const std::size_t last{std::min(first + grain_size, end)};
+        group.run([&function, first, last] { function(first, last); });
+    }
+
+    // The calling thread processes the first sub-range
+    function(begin, begin + grain_size);
+    group.wait();
+}
+
+} // namespace physscope
+
+#endif // JOB_SYSTEM_HPP
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "mapped_file.hpp"
+
+namespace physscope
+{
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::filesystem::path& filename)
+{
+    HANDLE file{CreateFileW(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr)};
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+    file_ = file;
+
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(file, &size))
+    {
+        close();
+        return;
+    }
+    size_ = static_cast<std::size_t>(size.QuadPart);
+
+    // Empty files can't be mapped, but are valid
+    if (size_ == 0)
+    {
+        open_ = true;
+        return;
+    }
+
+    mapping_ = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_ == nullptr)
+    {
+        close();
+        return;
+    }
+
+    data_ = static_cast<const std::byte*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+    if (data_ == nullptr)
+    {
+        close();
+        return;
+    }
+    open_ = true;
+}
+
+void MappedFile::close()
+{
+    if (data_ != nullptr)
+    {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_ != nullptr)
+    {
+        CloseHandle(mapping_);
+    }
+    if (file_ != nullptr)
+    {
+        CloseHandle(file_);
+    }
+    data_ = nullptr;
+    mapping_ = nullptr;
+    file_ = nullptr;
+    size_ = 0;
+    open_ = false;
+}
+
+#else
+
+MappedFile::MappedFile(const std::filesystem::path& filename)
+{
+    const int file{::open(filename.c_str(), O_RDONLY)};
+    if (file < 0)
+    {
+        return;
+    }
+
+    struct stat status
+    {
+    };
+    if (::fstat(file, &status) != 0)
+    {
+        ::close(file);
+        return;
+    }
+    size_ = static_cast<std::size_t>(status.st_size);
+
+    // Empty files can't be mapped, but are valid
+    if (size_ > 0)
+    {
+        void* data{::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file, 0)};
+        if (data == MAP_FAILED)
+        {
+            ::close(file);
+            size_ = 0;
+            return;
+        }
+
+        // The file is usually read entirely, by several threads at once
+        ::madvise(data, size_, MADV_WILLNEED);
+        data_ = static_cast<const std::byte*>(data);
+    }
+
+    // The mapping stays valid after the file descriptor is closed
+    ::close(file);
+    open_ = true;
+}
+
+void MappedFile::close()
+{
+    if (data_ != nullptr)
+    {
+        ::munmap(const_cast<std::byte*>(data_), size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+    open_ = false;
+}
+
+#endif
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept :
+    data_{std::exchange(other.data_, nullptr)}, size_{std::exchange(other.size_, 0)},
+    open_{std::exchange(other.open_, false)}
+#ifdef _WIN32
+    ,
+    file_{std::exchange(other.file_, nullptr)}, mapping_{std::exchange(other.mapping_, nullptr)}
+#endif
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        open_ = std::exchange(other.open_, false);
+#ifdef _WIN32
+        file_ = std::exchange(other.file_, nullptr);
+        mapping_ = std::exchange(other.mapping_, nullptr);
+#endif
+    }
+    return *this;
+}
+
+bool MappedFile::is_open() const
+{
+    return open_;
+}
+
+std::size_t MappedFile::size() const
+{
+    return size_;
+}
+
+std::span<const std::byte> MappedFile::bytes() const
+{
+    return std::span<const std::byte>{data_, size_};
+}
+
+std::string_view MappedFile::text() const
+{
+    return std::string_view{reinterpret_cast<const char*>(data_), size_};
+}
+
+} // namespace physscope
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string_view>
+
+namespace physscope
+{
+
+/*
+Read-only memory mapping of a whole file. The contents are paged in by the
+operating system on first access, so opening is cheap regardless of the file
+size, and the memory is shared with the page cache (no copy is made).
+*/
+class MappedFile
+{
+public:
+    MappedFile() = default;
+
+    // Map filename; check is_open() for failures
+    explicit MappedFile(const std::filesystem::path& filename);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    bool is_open() const;
+    std::size_t size() const;
+    std::span<const std::byte> bytes() const;
+    std::string_view text() const;
+
+private:
+    void close();
+
+    const std::byte* data_{nullptr};
+    std::size_t size_{0};
+    bool open_{false};
+#ifdef _WIN32
+    void* file_{nullptr};
+    void* mapping_{nullptr};
+#endif
+};
+
+} // namespace physscope
+
+#endif // MAPPED_FILE_HPP
\ No newline at end of file
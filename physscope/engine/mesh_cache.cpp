@@ -0,0 +1,276 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string>
+#include <system_error>
+
+#include "binary_stream.hpp"
+#include "io.hpp"
+#include "mesh_cache.hpp"
+#include "trace.hpp"
+
+namespace physscope
+{
+
+namespace
+{
+
+constexpr std::array<char, 4> mesh_cache_magic{'P', 'S', 'M', 'C'};
+constexpr std::uint32_t mesh_cache_version{2};
+
+// Size of the magic, version, number of vertices and number of triangles that start a cache file
+constexpr std::uint64_t mesh_cache_header_size{sizeof(mesh_cache_magic) + sizeof(std::uint32_t) +
+                                               2 * sizeof(std::uint64_t)};
+
+// Keeps file keys and content keys of the same bytes apart
+constexpr std::string_view file_key_prefix{"file:"};
+constexpr std::string_view content_key_prefix{"content:"};
+
+template <typename T>
+std::uint64_t hash_value(const T& value, std::uint64_t seed)
+{
+    return fnv1a_hash(std::string_view{reinterpret_cast<const char*>(&value), sizeof(value)}, seed);
+}
+
+// Mix the optimization settings into key, field by field so padding bytes are not hashed
+std::uint64_t optimization_key(std::uint64_t key, const geometry::MeshOptimizationSettings& settings)
+{
+    key = hash_value(settings.weld, key);
+    key = hash_value(settings.weld_tolerance, key);
+    key = hash_value(settings.optimize_vertex_cache, key);
+    key = hash_value(settings.cache_size, key);
+    return hash_value(settings.optimize_vertex_fetch, key);
+}
+
+} // namespace
+
+std::uint64_t fnv1a_hash(std::string_view bytes, std::uint64_t seed)
+{
+    constexpr std::uint64_t prime{0x100000001b3};
+    std::uint64_t hash{seed};
+    for (const char byte : bytes)
+    {
+        hash ^= static_cast<std::uint8_t>(byte);
+        hash *= prime;
+    }
+    return hash;
+}
+
+SharedTriangleMesh MeshCache::load_obj(const std::filesystem::path& filename)
+{
+    std::error_code error;
+    const std::filesystem::file_time_type modification_time{std::filesystem::last_write_time(filename, error)};
+    const auto ticks{static_cast<std::uint64_t>(modification_time.time_since_epoch().count())};
+    const std::string path{std::filesystem::absolute(filename, error).string()};
+
+    std::uint64_t key{fnv1a_hash(file_key_prefix)};
+    key = fnv1a_hash(path, key);
+    key = hash_value(ticks, key);
+    return load(key, [&filename] { return read_triangle_mesh_obj_mapped(filename); });
+}
+
+SharedTriangleMesh MeshCache::load_obj(std::string_view wavefront, std::string_view mtl)
+{
+    std::uint64_t key{fnv1a_hash(content_key_prefix)};
+    key = fnv1a_hash(wavefront, key);
+    key = fnv1a_hash(mtl, key);
+
+    // tinyobj expects null-terminated strings
+    return load(key, [wavefront, mtl]
+                { return read_triangle_mesh_obj(std::string{wavefront}, std::string{mtl}); });
+}
+
+void MeshCache::set_disk_cache_directory(const std::filesystem::path& directory)
+{
+    std::scoped_lock lock_protection{mutex_};
+    disk_cache_directory_ = directory;
+    if (!directory.empty())
+    {
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+    }
+}
+
+void MeshCache::set_mesh_optimization(const std::optional<geometry::MeshOptimizationSettings>& settings)
+{
+    std::scoped_lock lock_protection{mutex_};
+    mesh_optimization_ = settings;
+}
+
+void MeshCache::clear()
+{
+    std::scoped_lock lock_protection{mutex_};
+    meshes_.clear();
+}
+
+std::size_t MeshCache::size() const
+{
+    std::scoped_lock lock_protection{mutex_};
+    return meshes_.size();
+}
+
+template <typename Parse>
+SharedTriangleMesh MeshCache::load(std::uint64_t key, const Parse& parse)
+{
+    PHYSSCOPE_TRACE_SCOPE("MeshCache::load");
+    std::optional<geometry::MeshOptimizationSettings> optimization;
+    {
+        std::scoped_lock lock_protection{mutex_};
+        optimization = mesh_optimization_;
+        if (optimization)
+        {
+            key = optimization_key(key, *optimization);
+        }
+        if (const auto cached{meshes_.find(key)}; cached != meshes_.end())
+        {
+            return cached->second;
+        }
+    }
+
+    // Parse without holding the lock, so loading different meshes doesn't serialize
+    SharedTriangleMesh mesh{read_disk_cache(key)};
+    if (!mesh)
+    {
+        geometry::IndexedTriangleMesh parsed{parse()};
+        if (optimization)
+        {
+            geometry::optimize_mesh(parsed, *optimization);
+        }
+        mesh = std::make_shared<const geometry::IndexedTriangleMesh>(std::move(parsed));
+        write_disk_cache(key, *mesh);
+    }
+
+    // If another thread loaded the same mesh meanwhile, keep the first one
+    std::scoped_lock lock_protection{mutex_};
+    return meshes_.try_emplace(key, std::move(mesh)).first->second;
+}
+
+std::filesystem::path MeshCache::disk_cache_path(std::uint64_t key) const
+{
+    std::scoped_lock lock_protection{mutex_};
+    if (disk_cache_directory_.empty())
+    {
+        return {};
+    }
+
+    std::array<char, 17> name{};
+    constexpr std::string_view digits{"0123456789abcdef"};
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        name[15 - i] = digits[(key >> (4 * i)) & 0xf];
+    }
+    return disk_cache_directory_ / (std::string{name.data()} + ".psmc");
+}
+
+SharedTriangleMesh MeshCache::read_disk_cache(std::uint64_t key) const
+{
+    const std::filesystem::path path{disk_cache_path(key)};
+    if (path.empty())
+    {
+        return nullptr;
+    }
+
+    std::error_code error;
+    const std::uint64_t file_size{std::filesystem::file_size(path, error)};
+    std::ifstream input{path, std::ios::binary};
+    if (error || !input)
+    {
+        return nullptr;
+    }
+
+    PHYSSCOPE_TRACE_SCOPE("MeshCache::read_disk_cache");
+    BinaryReader reader{input};
+    std::array<char, 4> magic{};
+    std::uint32_t version{0};
+    std::uint64_t num_vertices{0};
+    std::uint64_t num_indices{0};
+    if (!reader.read(magic) || magic != mesh_cache_magic || !reader.read(version) || version != mesh_cache_version ||
+        !reader.read(num_vertices) || !reader.read(num_indices))
+    {
+        return nullptr;
+    }
+
+    // The counts of a corrupt file must not drive the allocations: the arrays have to fill the rest of it
+    using Triangle = std::array<geometry::IndexedTriangleMesh::index_type, 3>;
+    const std::uint64_t data_size{file_size - std::min(file_size, mesh_cache_header_size)};
+    if (num_vertices > data_size / sizeof(glm::vec3) || num_indices > data_size / sizeof(Triangle) ||
+        num_vertices * sizeof(glm::vec3) + num_indices * sizeof(Triangle) != data_size)
+    {
+        std::cerr << "Ignoring invalid mesh cache " << path << std::endl;
+        return nullptr;
+    }
+
+    geometry::IndexedTriangleMesh mesh{};
+    mesh.vertices.resize(static_cast<std::size_t>(num_vertices));
+    mesh.indices.resize(static_cast<std::size_t>(num_indices));
+    if (!reader.read(std::span<glm::vec3>{mesh.vertices}) || !reader.read(std::span<Triangle>{mesh.indices}))
+    {
+        return nullptr;
+    }
+    const auto is_valid{[num_vertices](const Triangle& triangle)
+                        {
+                            return std::all_of(triangle.begin(), triangle.end(),
+                                               [num_vertices](auto index) { return index < num_vertices; });
+                        }};
+    if (!std::all_of(mesh.indices.begin(), mesh.indices.end(), is_valid))
+    {
+        std::cerr << "Ignoring invalid mesh cache " << path << std::endl;
+        return nullptr;
+    }
+    return std::make_shared<const geometry::IndexedTriangleMesh>(std::move(mesh));
+}
+
+void MeshCache::write_disk_cache(std::uint64_t key, const geometry::IndexedTriangleMesh& mesh) const
+{
+    const std::filesystem::path path{disk_cache_path(key)};
+    if (path.empty())
+    {
+        return;
+    }
+
+    /*
+    Write to a temporary file and rename it, so other processes never read a
+    partial mesh. The temporary name is unique, since other processes (and
+    threads) may be caching the same mesh at the same time.
+    */
+    static std::atomic<std::uint64_t> temporary_count{0};
+    std::filesystem::path temporary_path{path};
+    temporary_path += "." + std::to_string(std::random_device{}()) + "-" + std::to_string(temporary_count++) + ".tmp";
+    bool written{false};
+    {
+        std::ofstream output{temporary_path, std::ios::binary};
+        BinaryWriter writer{output};
+        writer.write(mesh_cache_magic);
+        writer.write(mesh_cache_version);
+        writer.write(static_cast<std::uint64_t>(mesh.vertices.size()));
+        writer.write(static_cast<std::uint64_t>(mesh.indices.size()));
+        writer.write(std::span<const glm::vec3>{mesh.vertices});
+        writer.write(std::span<const std::array<geometry::IndexedTriangleMesh::index_type, 3>>{mesh.indices});
+        written = writer.good();
+    }
+
+    std::error_code error;
+    if (!written)
+    {
+        std::cerr << "Failed to write mesh cache " << temporary_path << std::endl;
+        std::filesystem::remove(temporary_path, error);
+        return;
+    }
+    std::filesystem::rename(temporary_path, path, error);
+    if (error)
+    {
+        std::filesystem::remove(temporary_path, error);
+    }
+}
+
+MeshCache& default_mesh_cache()
+{
+    static MeshCache mesh_cache{};
+    return mesh_cache;
+}
+
+} // namespace physscope
\ No newline at end of file
@@ -0,0 +1,80 @@
+#ifndef MESH_CACHE_HPP
+#define MESH_CACHE_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+#include "geometry.hpp"
+#include "mesh_optimizer.hpp"
+
+namespace physscope
+{
+
+// Meshes returned by the cache are shared and must not be modified
+using SharedTriangleMesh = std::shared_ptr<const geometry::IndexedTriangleMesh>;
+
+// 64-bit FNV-1a hash of bytes; pass a previous hash as seed to hash several buffers
+std::uint64_t fnv1a_hash(std::string_view bytes, std::uint64_t seed = 0xcbf29ce484222325);
+
+/*
+Cache of parsed triangle meshes, so each OBJ source is parsed once per process.
+Files are identified by their path and modification time (editing a file
+invalidates its entry), while OBJ strings are identified by a hash of their
+content. This class is thread-safe.
+
+Optionally, parsed meshes are also stored in a directory on disk, so later
+runs skip the text parsing entirely.
+*/
+class MeshCache
+{
+public:
+    // Return the mesh stored on an OBJ file, parsing it only on the first request
+    SharedTriangleMesh load_obj(const std::filesystem::path& filename);
+
+    // Return the mesh described by an OBJ string, parsing it only on the first request
+    SharedTriangleMesh load_obj(std::string_view wavefront, std::string_view mtl);
+
+    /*
+    Store parsed meshes on directory (created if needed) and look for
+    them there before parsing. An empty path disables the disk cache.
+    */
+    void set_disk_cache_directory(const std::filesystem::path& directory);
+
+    /*
+    Run geometry::optimize_mesh() with settings on meshes loaded from now on,
+    before they are cached; std::nullopt keeps meshes as authored. Meshes
+    optimized with different settings are cached apart.
+    */
+    void set_mesh_optimization(const std::optional<geometry::MeshOptimizationSettings>& settings);
+
+    // Release the meshes held by the cache; meshes still in use stay valid
+    void clear();
+
+    // Number of meshes held by the cache
+    std::size_t size() const;
+
+private:
+    template <typename Parse>
+    SharedTriangleMesh load(std::uint64_t key, const Parse& parse);
+
+    SharedTriangleMesh read_disk_cache(std::uint64_t key) const;
+    void write_disk_cache(std::uint64_t key, const geometry::IndexedTriangleMesh& mesh) const;
+    std::filesystem::path disk_cache_path(std::uint64_t key) const;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::uint64_t, SharedTriangleMesh> meshes_;
+    std::filesystem::path disk_cache_directory_;
+    std::optional<geometry::MeshOptimizationSettings> mesh_optimization_;
+};
+
+// Process-wide MeshCache; created on first use.
+MeshCache& default_mesh_cache();
+
+} // namespace physscope
+
+#endif // MESH_CACHE_HPP
\ No newline at end of file
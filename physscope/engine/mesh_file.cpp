@@ -0,0 +1,162 @@
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "binary_stream.hpp"
+#include "mesh_file.hpp"
+#include "trace.hpp"
+
+namespace physscope
+{
+
+namespace
+{
+
+// The arrays of the file are used in place as arrays of these types
+static_assert(sizeof(glm::vec3) == 3 * sizeof(float));
+static_assert(sizeof(std::array<std::uint32_t, 3>) == 3 * sizeof(std::uint32_t));
+
+// Meshes are written and read without converting their indices
+static_assert(std::is_same_v<geometry::IndexedTriangleMesh::index_type, std::uint32_t>);
+
+std::uint64_t align(std::uint64_t offset)
+{
+    return (offset + mesh_file_alignment - 1) / mesh_file_alignment * mesh_file_alignment;
+}
+
+void write_padding(std::ostream& output, std::uint64_t offset)
+{
+    constexpr std::array<char, mesh_file_alignment> zeros{};
+    const auto current{static_cast<std::uint64_t>(output.tellp())};
+    output.write(zeros.data(), static_cast<std::streamsize>(offset - current));
+}
+
+// Return the section of size bytes at offset, if it lies inside file and is aligned
+template <typename T>
+std::span<const T> section(const MappedFile& file, std::uint64_t offset, std::uint64_t count)
+{
+    const std::uint64_t max_count{std::numeric_limits<std::uint64_t>::max() / sizeof(T)};
+    if (offset % mesh_file_alignment != 0 || count > max_count || offset > file.size() ||
+        count * sizeof(T) > file.size() - offset)
+    {
+        return {};
+    }
+    return std::span<const T>{reinterpret_cast<const T*>(file.bytes().data() + offset),
+                              static_cast<std::size_t>(count)};
+}
+
+} // namespace
+
+bool write_mesh_file(const std::filesystem::path& filename, const geometry::IndexedTriangleMesh& mesh,
+                     std::span<const glm::vec3> normals)
+{
+    PHYSSCOPE_TRACE_SCOPE("write_mesh_file");
+    if (!normals.empty() && normals.size() != mesh.num_vertices())
+    {
+        std::cerr << "write_mesh_file: one normal per vertex expected for " << filename << std::endl;
+        return false;
+    }
+
+    const geometry::AABB bounds{geometry::bounds(mesh.vertices)};
+    MeshFileHeader header{};
+    header.flags = normals.empty() ? 0 : mesh_file_has_normals;
+    header.num_vertices = mesh.num_vertices();
+    header.num_triangles = mesh.num_indices();
+    header.bounds_min = {bounds.min.x, bounds.min.y, bounds.min.z};
+    header.bounds_max = {bounds.max.x, bounds.max.y, bounds.max.z};
+    header.positions_offset = align(sizeof(MeshFileHeader));
+    header.indices_offset = align(header.positions_offset + header.num_vertices * sizeof(glm::vec3));
+    header.normals_offset =
+        normals.empty() ? 0 : align(header.indices_offset + header.num_triangles * 3 * sizeof(std::uint32_t));
+
+    std::ofstream output{filename, std::ios::binary};
+    BinaryWriter writer{output};
+    writer.write(header);
+    write_padding(output, header.positions_offset);
+    writer.write(std::span<const glm::vec3>{mesh.vertices});
+    write_padding(output, header.indices_offset);
+    writer.write(std::span<const std::array<std::uint32_t, 3>>{mesh.indices});
+    if (!normals.empty())
+    {
+        write_padding(output, header.normals_offset);
+        writer.write(normals);
+    }
+
+    if (!writer.good())
+    {
+        std::cerr << "Failed to write " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+MeshFile::MeshFile(const std::filesystem::path& filename) : file_{filename}
+{
+    if (!file_.is_open() || file_.size() < sizeof(MeshFileHeader))
+    {
+        file_ = MappedFile{};
+        return;
+    }
+
+    const auto& header{*reinterpret_cast<const MeshFileHeader*>(file_.bytes().data())};
+    if (header.magic != MeshFileHeader{}.magic || header.version != MeshFileHeader{}.version)
+    {
+        file_ = MappedFile{};
+        return;
+    }
+
+    const bool has_normals{(header.flags & mesh_file_has_normals) != 0};
+    vertices_ = section<glm::vec3>(file_, header.positions_offset, header.num_vertices);
+    indices_ = section<std::array<std::uint32_t, 3>>(file_, header.indices_offset, header.num_triangles);
+    normals_ = has_normals ? section<glm::vec3>(file_, header.normals_offset, header.num_vertices)
+                           : std::span<const glm::vec3>{};
+    if (vertices_.size() != header.num_vertices || indices_.size() != header.num_triangles ||
+        (has_normals && normals_.size() != header.num_vertices))
+    {
+        file_ = MappedFile{};
+        vertices_ = {};
+        indices_ = {};
+        normals_ = {};
+        return;
+    }
+
+    bounds_.min = glm::vec3{header.bounds_min[0], header.bounds_min[1], header.bounds_min[2]};
+    bounds_.max = glm::vec3{header.bounds_max[0], header.bounds_max[1], header.bounds_max[2]};
+}
+
+bool MeshFile::is_open() const
+{
+    return file_.is_open();
+}
+
+const geometry::AABB& MeshFile::bounds() const
+{
+    return bounds_;
+}
+
+std::span<const glm::vec3> MeshFile::vertices() const
+{
+    return vertices_;
+}
+
+std::span<const std::array<std::uint32_t, 3>> MeshFile::indices() const
+{
+    return indices_;
+}
+
+std::span<const glm::vec3> MeshFile::normals() const
+{
+    return normals_;
+}
+
+geometry::IndexedTriangleMesh MeshFile::to_indexed_triangle_mesh() const
+{
+    geometry::IndexedTriangleMesh mesh{};
+    mesh.vertices.assign(vertices_.begin(), vertices_.end());
+    mesh.indices.assign(indices_.begin(), indices_.end());
+    return mesh;
+}
+
+} // namespace physscope
\ No newline at end of file
@@ -0,0 +1,81 @@
+#ifndef MESH_FILE_HPP
+#define MESH_FILE_HPP
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <glm/glm.hpp>
+#include <span>
+
+#include "geometry.hpp"
+#include "mapped_file.hpp"
+
+namespace physscope
+{
+
+/*
+Binary mesh container, laid out so it can be used directly from a memory
+mapping: a MeshFileHeader followed by the vertex positions (3 floats each),
+the triangle indices (3 uint32 each) and, optionally, one normal per vertex
+(3 floats each). Every section starts at an offset aligned to
+mesh_file_alignment bytes. Values are stored in native byte order.
+*/
+struct MeshFileHeader
+{
+    std::array<char, 4> magic{'P', 'S', 'M', 'F'};
+    std::uint32_t version{1};
+    std::uint32_t flags{0};
+    std::uint32_t reserved{0};
+    std::uint64_t num_vertices{0};
+    std::uint64_t num_triangles{0};
+    std::array<float, 3> bounds_min{};
+    std::array<float, 3> bounds_max{};
+    std::uint64_t positions_offset{0};
+    std::uint64_t indices_offset{0};
+    std::uint64_t normals_offset{0};
+};
+
+inline constexpr std::uint32_t mesh_file_has_normals{1};
+inline constexpr std::size_t mesh_file_alignment{64};
+
+/*
+Write mesh to filename, with one normal per vertex if normals isn't empty.
+Return false if the file can't be written or normals doesn't match the vertices.
+*/
+bool write_mesh_file(const std::filesystem::path& filename, const geometry::IndexedTriangleMesh& mesh,
+                     std::span<const glm::vec3> normals = {});
+
+/*
+Mesh file opened with a read-only memory mapping: the arrays are exposed
+where they lie in the file, without parsing or copying, and are paged in
+on first access. The header and section sizes are validated on open; the
+indices are not, as that would touch the whole file.
+*/
+class MeshFile
+{
+public:
+    // Open filename; check is_open() for failures
+    explicit MeshFile(const std::filesystem::path& filename);
+
+    bool is_open() const;
+    const geometry::AABB& bounds() const;
+    std::span<const glm::vec3> vertices() const;
+    std::span<const std::array<std::uint32_t, 3>> indices() const;
+
+    // Empty if the file has no normals
+    std::span<const glm::vec3> normals() const;
+
+    // Copy the file contents into a mesh
+    geometry::IndexedTriangleMesh to_indexed_triangle_mesh() const;
+
+private:
+    MappedFile file_;
+    geometry::AABB bounds_{};
+    std::span<const glm::vec3> vertices_;
+    std::span<const std::array<std::uint32_t, 3>> indices_;
+    std::span<const glm::vec3> normals_;
+};
+
+} // namespace physscope
+
+#endif // MESH_FILE_HPP
\ No newline at end of file
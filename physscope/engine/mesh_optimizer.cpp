@@ -0,0 +1,409 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "mesh_optimizer.hpp"
+#include "trace.hpp"
+
+namespace physscope
+{
+
+namespace geometry
+{
+
+namespace
+{
+
+constexpr std::size_t no_vertex{std::numeric_limits<std::size_t>::max()};
+
+// Hash of a grid cell, or of a position when welding exactly; collisions are resolved by comparing positions
+std::uint64_t cell_hash(std::int64_t x, std::int64_t y, std::int64_t z)
+{
+    return static_cast<std::uint64_t>(x) * 0x9e3779b97f4a7c15 ^ static_cast<std::uint64_t>(y) * 0xc2b2ae3d27d4eb4f ^
+           static_cast<std::uint64_t>(z) * 0x165667b19e3779f9;
+}
+
+std::uint64_t position_hash(const glm::vec3& position)
+{
+    // Adding 0 turns -0 into +0, so both hash alike
+    return cell_hash(std::bit_cast<std::uint32_t>(position.x + 0.0f), std::bit_cast<std::uint32_t>(position.y + 0.0f),
+                     std::bit_cast<std::uint32_t>(position.z + 0.0f));
+}
+
+/*
+Replace every index by remap[index], drop the triangles with repeated indices
+and keep the remapped vertices; when several vertices map to the same index,
+the first one is kept.
+*/
+template <typename Index>
+void apply_remap(BasicIndexedTriangleMesh<Index>& mesh, const std::vector<std::size_t>& remap, std::size_t num_vertices)
+{
+    std::vector<glm::vec3> vertices(num_vertices);
+    for (std::size_t vertex = remap.size(); vertex-- > 0;)
+    {
+        if (remap[vertex] != no_vertex)
+        {
+            vertices[remap[vertex]] = mesh.vertices[vertex];
+        }
+    }
+    mesh.vertices = std::move(vertices);
+
+    std::size_t kept{0};
+    for (const std::array<Index, 3>& triangle : mesh.indices)
+    {
+        const std::array<Index, 3> remapped{static_cast<Index>(remap[triangle[0]]),
+                                            static_cast<Index>(remap[triangle[1]]),
+                                            static_cast<Index>(remap[triangle[2]])};
+        if (remapped[0] != remapped[1] && remapped[1] != remapped[2] && remapped[2] != remapped[0])
+        {
+            mesh.indices[kept++] = remapped;
+        }
+    }
+    mesh.indices.resize(kept);
+}
+
+// Drop the vertices no triangle uses, keeping the order of the others
+template <typename Index>
+void remove_unused_vertices(BasicIndexedTriangleMesh<Index>& mesh)
+{
+    std::vector<std::size_t> remap(mesh.vertices.size(), no_vertex);
+    for (const std::array<Index, 3>& triangle : mesh.indices)
+    {
+        for (const std::size_t vertex : triangle)
+        {
+            remap[vertex] = 0;
+        }
+    }
+
+    std::size_t num_vertices{0};
+    for (std::size_t& new_index : remap)
+    {
+        if (new_index != no_vertex)
+        {
+            new_index = num_vertices++;
+        }
+    }
+    if (num_vertices != mesh.vertices.size())
+    {
+        apply_remap(mesh, remap, num_vertices);
+    }
+}
+
+/*
+Vertex score of Forsyth's algorithm: the three most recent vertices score
+the same, so the triangle just emitted isn't favoured over its neighbours,
+and vertices used by few remaining triangles are boosted, so they are
+finished off instead of being left as isolated triangles.
+*/
+float vertex_score(std::size_t cache_position, std::size_t remaining_triangles, std::size_t cache_size)
+{
+    constexpr float last_triangle_score{0.75f};
+    constexpr float cache_decay_power{1.5f};
+    constexpr float valence_boost_scale{2.0f};
+    constexpr float valence_boost_power{0.5f};
+
+    if (remaining_triangles == 0)
+    {
+        return -1.0f;
+    }
+
+    float score{0.0f};
+    if (cache_position < 3)
+    {
+        score = last_triangle_score;
+    }
+    else if (cache_position < cache_size)
+    {
+        const float scale{1.0f / static_cast<float>(cache_size - 3)};
+        score = std::pow(1.0f - static_cast<float>(cache_position - 3) * scale, cache_decay_power);
+    }
+    return score + valence_boost_scale * std::pow(static_cast<float>(remaining_triangles), -valence_boost_power);
+}
+
+} // namespace
+
+template <typename Index>
+std::size_t weld_vertices(BasicIndexedTriangleMesh<Index>& mesh, float tolerance)
+{
+    PHYSSCOPE_TRACE_SCOPE("weld_vertices");
+    const std::size_t num_vertices{mesh.vertices.size()};
+    std::vector<std::size_t> remap(num_vertices, no_vertex);
+
+    // Each cell holds a list of the vertices kept in it, linked through next_in_cell
+    std::unordered_map<std::uint64_t, std::size_t> cells;
+    cells.reserve(num_vertices);
+    std::vector<std::size_t> next_in_cell(num_vertices, no_vertex);
+    std::size_t num_kept{0};
+
+    const float tolerance_squared{tolerance * tolerance};
+    const auto find_in_cell = [&](std::uint64_t hash, const glm::vec3& position)
+    {
+        const auto cell{cells.find(hash)};
+        for (std::size_t other = cell == cells.end() ? no_vertex : cell->second; other != no_vertex;
+             other = next_in_cell[other])
+        {
+            const glm::vec3 offset{mesh.vertices[other] - position};
+            if (tolerance > 0.0f ? glm::dot(offset, offset) <= tolerance_squared : mesh.vertices[other] == position)
+            {
+                return other;
+            }
+        }
+        return no_vertex;
+    };
+
+    for (std::size_t vertex = 0; vertex < num_vertices; ++vertex)
+    {
+        const glm::vec3& position{mesh.vertices[vertex]};
+        std::size_t match{no_vertex};
+        std::uint64_t hash{0};
+        if (tolerance > 0.0f)
+        {
+            // Cells are as wide as the tolerance, so matches lie in this cell or its 26 neighbours
+            const auto x{static_cast<std::int64_t>(std::floor(position.x / tolerance))};
+            const auto y{static_cast<std::int64_t>(std::floor(position.y / tolerance))};
+            const auto z{static_cast<std::int64_t>(std::floor(position.z / tolerance))};
+            hash = cell_hash(x, y, z);
+            for (std::int64_t i = -1; i <= 1 && match == no_vertex; ++i)
+            {
+                for (std::int64_t j = -1; j <= 1 && match == no_vertex; ++j)
+                {
+                    for (std::int64_t k = -1; k <= 1 && match == no_vertex; ++k)
+                    {
+                        match = find_in_cell(cell_hash(x + i, y + j, z + k), position);
+                    }
+                }
+            }
+        }
+        else
+        {
+            hash = position_hash(position);
+            match = find_in_cell(hash, position);
+        }
+
+        if (match != no_vertex)
+        {
+            remap[vertex] = remap[match];
+            continue;
+        }
+
+        remap[vertex] = num_kept++;
+        const auto [cell, inserted]{cells.try_emplace(hash, vertex)};
+        if (!inserted)
+        {
+            next_in_cell[vertex] = cell->second;
+            cell->second = vertex;
+        }
+    }
+
+    apply_remap(mesh, remap, num_kept);
+    remove_unused_vertices(mesh);
+    return num_vertices - mesh.vertices.size();
+}
+
+template <typename Index>
+void optimize_vertex_cache(BasicIndexedTriangleMesh<Index>& mesh, std::size_t cache_size)
+{
+    PHYSSCOPE_TRACE_SCOPE("optimize_vertex_cache");
+    cache_size = std::max(cache_size, std::size_t{4});
+    const std::size_t num_vertices{mesh.vertices.size()};
+    const std::size_t num_triangles{mesh.indices.size()};
+
+    // Triangles using each vertex, as ranges of adjacency; the first remaining[vertex] are not emitted yet
+    std::vector<std::size_t> remaining(num_vertices, 0);
+    for (const std::array<Index, 3>& triangle : mesh.indices)
+    {
+        for (const std::size_t vertex : triangle)
+        {
+            ++remaining[vertex];
+        }
+    }
+    std::vector<std::size_t> first_adjacent(num_vertices + 1, 0);
+    for (std::size_t vertex = 0; vertex < num_vertices; ++vertex)
+    {
+        first_adjacent[vertex + 1] = first_adjacent[vertex] + remaining[vertex];
+    }
+    std::vector<std::size_t> adjacency(first_adjacent.back());
+    {
+        std::vector<std::size_t> filled(first_adjacent.begin(), first_adjacent.end() - 1);
+        for (std::size_t triangle = 0; triangle < num_triangles; ++triangle)
+        {
+            for (const std::size_t vertex : mesh.indices[triangle])
+            {
+                adjacency[filled[vertex]++] = triangle;
+            }
+        }
+    }
+
+    std::vector<std::size_t> cache_position(num_vertices, no_vertex);
+    std::vector<float> vertex_scores(num_vertices);
+    for (std::size_t vertex = 0; vertex < num_vertices; ++vertex)
+    {
+        vertex_scores[vertex] = vertex_score(no_vertex, remaining[vertex], cache_size);
+    }
+    std::vector<float> triangle_scores(num_triangles);
+    for (std::size_t triangle = 0; triangle < num_triangles; ++triangle)
+    {
+        const std::array<Index, 3>& corners{mesh.indices[triangle]};
+        triangle_scores[triangle] = vertex_scores[corners[0]] + vertex_scores[corners[1]] + vertex_scores[corners[2]];
+    }
+
+    // The cache holds up to 3 extra entries while a triangle is being added
+    std::vector<std::size_t> cache;
+    std::vector<std::size_t> next_cache;
+    cache.reserve(cache_size + 3);
+    next_cache.reserve(cache_size + 3);
+
+    std::vector<std::array<Index, 3>> ordered;
+    ordered.reserve(num_triangles);
+    std::vector<bool> emitted(num_triangles, false);
+    std::size_t best_triangle{num_triangles > 0 ? 0 : no_vertex};
+    std::size_t next_unemitted{0};
+    while (ordered.size() < num_triangles)
+    {
+        // Dead end: no triangle touches the cache, so continue with the next one in input order
+        if (best_triangle == no_vertex)
+        {
+            while (emitted[next_unemitted])
+            {
+                ++next_unemitted;
+            }
+            best_triangle = next_unemitted;
+        }
+
+        const std::array<Index, 3> corners{mesh.indices[best_triangle]};
+        ordered.push_back(corners);
+        emitted[best_triangle] = true;
+
+        next_cache.assign(corners.begin(), corners.end());
+        for (const std::size_t vertex : corners)
+        {
+            // Remove the triangle from the remaining range of its vertices
+            const auto first{adjacency.begin() + static_cast<std::ptrdiff_t>(first_adjacent[vertex])};
+            const auto last{first + static_cast<std::ptrdiff_t>(remaining[vertex])};
+            std::iter_swap(std::find(first, last, best_triangle), last - 1);
+            --remaining[vertex];
+        }
+        for (const std::size_t vertex : cache)
+        {
+            if (std::find(corners.begin(), corners.end(), vertex) == corners.end())
+            {
+                next_cache.push_back(vertex);
+            }
+        }
+        std::swap(cache, next_cache);
+
+        // Rescore the vertices of the cache, including those just evicted, and the triangles using them
+        for (std::size_t position = 0; position < cache.size(); ++position)
+        {
+            const std::size_t vertex{cache[position]};
+            cache_position[vertex] = position < cache_size ? position : no_vertex;
+            vertex_scores[vertex] = vertex_score(cache_position[vertex], remaining[vertex], cache_size);
+        }
+
+        best_triangle = no_vertex;
+        float best_score{-std::numeric_limits<float>::infinity()};
+        for (const std::size_t vertex : cache)
+        {
+            for (std::size_t i = first_adjacent[vertex]; i < first_adjacent[vertex] + remaining[vertex]; ++i)
+            {
+                const std::size_t triangle{adjacency[i]};
+                const std::array<Index, 3>& triangle_corners{mesh.indices[triangle]};
+                triangle_scores[triangle] = vertex_scores[triangle_corners[0]] + vertex_scores[triangle_corners[1]] +
+                                            vertex_scores[triangle_corners[2]];
+                if (triangle_scores[triangle] > best_score)
+                {
+                    best_score = triangle_scores[triangle];
+                    best_triangle = triangle;
+                }
+            }
+        }
+        if (cache.size() > cache_size)
+        {
+            cache.resize(cache_size);
+        }
+    }
+
+    mesh.indices = std::move(ordered);
+}
+
+template <typename Index>
+void optimize_vertex_fetch(BasicIndexedTriangleMesh<Index>& mesh)
+{
+    PHYSSCOPE_TRACE_SCOPE("optimize_vertex_fetch");
+    std::vector<std::size_t> remap(mesh.vertices.size(), no_vertex);
+    std::size_t num_vertices{0};
+    for (const std::array<Index, 3>& triangle : mesh.indices)
+    {
+        for (const std::size_t vertex : triangle)
+        {
+            if (remap[vertex] == no_vertex)
+            {
+                remap[vertex] = num_vertices++;
+            }
+        }
+    }
+    apply_remap(mesh, remap, num_vertices);
+}
+
+template <typename Index>
+float average_cache_miss_ratio(const BasicIndexedTriangleMesh<Index>& mesh, std::size_t cache_size)
+{
+    if (mesh.indices.empty())
+    {
+        return 0.0f;
+    }
+
+    // A vertex is in the FIFO cache if fewer than cache_size misses happened since it was loaded
+    std::vector<std::size_t> loaded_at(mesh.vertices.size(), no_vertex);
+    std::size_t misses{0};
+    for (const std::array<Index, 3>& triangle : mesh.indices)
+    {
+        for (const std::size_t vertex : triangle)
+        {
+            if (loaded_at[vertex] == no_vertex || misses - loaded_at[vertex] >= cache_size)
+            {
+                loaded_at[vertex] = misses++;
+            }
+        }
+    }
+    return static_cast<float>(misses) / static_cast<float>(mesh.indices.size());
+}
+
+template <typename Index>
+void optimize_mesh(BasicIndexedTriangleMesh<Index>& mesh, const MeshOptimizationSettings& settings)
+{
+    PHYSSCOPE_TRACE_SCOPE("optimize_mesh");
+    if (settings.weld)
+    {
+        weld_vertices(mesh, settings.weld_tolerance);
+    }
+    if (settings.optimize_vertex_cache)
+    {
+        optimize_vertex_cache(mesh, settings.cache_size);
+    }
+    if (settings.optimize_vertex_fetch)
+    {
+        optimize_vertex_fetch(mesh);
+    }
+}
+
+#define PHYSSCOPE_INSTANTIATE_MESH_OPTIMIZER(Index)                                                                    \
+    template std::size_t weld_vertices(BasicIndexedTriangleMesh<Index>& mesh, float tolerance);                        \
+    template void optimize_vertex_cache(BasicIndexedTriangleMesh<Index>& mesh, std::size_t cache_size);                \
+    template void optimize_vertex_fetch(BasicIndexedTriangleMesh<Index>& mesh);                                        \
+    template float average_cache_miss_ratio(const BasicIndexedTriangleMesh<Index>& mesh, std::size_t cache_size);      \
+    template void optimize_mesh(BasicIndexedTriangleMesh<Index>& mesh, const MeshOptimizationSettings& settings);
+
+PHYSSCOPE_INSTANTIATE_MESH_OPTIMIZER(std::uint16_t)
+PHYSSCOPE_INSTANTIATE_MESH_OPTIMIZER(std::uint32_t)
+PHYSSCOPE_INSTANTIATE_MESH_OPTIMIZER(std::uint64_t)
+
+#undef PHYSSCOPE_INSTANTIATE_MESH_OPTIMIZER
+
+} // namespace geometry
+
+} // namespace physscope
\ No newline at end of file
@@ -0,0 +1,69 @@
+#ifndef MESH_OPTIMIZER_HPP
+#define MESH_OPTIMIZER_HPP
+
+#include <cstddef>
+
+#include "geometry.hpp"
+
+namespace physscope
+{
+
+namespace geometry
+{
+
+// The passes below are instantiated for the 16, 32 and 64-bit meshes of geometry.hpp
+
+/*
+Merge vertices closer than tolerance (bitwise-equal positions when tolerance
+is 0) using a hash grid, then drop the triangles that became degenerate and
+the vertices no longer referenced. Each vertex is merged into the first
+vertex within tolerance, so clusters wider than tolerance are not chained
+together. Return the number of vertices removed.
+*/
+template <typename Index>
+std::size_t weld_vertices(BasicIndexedTriangleMesh<Index>& mesh, float tolerance = 0.0f);
+
+/*
+Reorder the triangles so consecutive triangles share vertices, following
+Forsyth's "Linear-Speed Vertex Cache Optimisation": vertices are scored by
+their position on a simulated LRU cache of cache_size entries and by how
+many triangles still use them, and the best scored triangle among those
+touching the cache is emitted next. Vertices are not moved.
+*/
+template <typename Index>
+void optimize_vertex_cache(BasicIndexedTriangleMesh<Index>& mesh, std::size_t cache_size = 32);
+
+/*
+Renumber the vertices in the order the triangles first use them, so reading
+the triangles in order walks the vertex buffer forwards. Unreferenced
+vertices are dropped. Run after optimize_vertex_cache().
+*/
+template <typename Index>
+void optimize_vertex_fetch(BasicIndexedTriangleMesh<Index>& mesh);
+
+/*
+Average number of vertices transformed per triangle with a FIFO cache of
+cache_size entries: 3 without any reuse, about 0.5 for a well ordered
+regular grid. Used to measure optimize_vertex_cache().
+*/
+template <typename Index>
+float average_cache_miss_ratio(const BasicIndexedTriangleMesh<Index>& mesh, std::size_t cache_size = 32);
+
+struct MeshOptimizationSettings
+{
+    bool weld{true};
+    float weld_tolerance{0.0f};
+    bool optimize_vertex_cache{true};
+    std::size_t cache_size{32};
+    bool optimize_vertex_fetch{true};
+};
+
+// Run the enabled passes of settings, in the order they are declared
+template <typename Index>
+void optimize_mesh(BasicIndexedTriangleMesh<Index>& mesh, const MeshOptimizationSettings& settings = {});
+
+} // namespace geometry
+
+} // namespace physscope
+
+#endif // MESH_OPTIMIZER_HPP
\ No newline at end of file
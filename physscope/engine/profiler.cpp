@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <cmath>
+
+#include "profiler.hpp"
+
+namespace physscope
+{
+
+std::string_view phase_name(Phase phase)
+{
+    switch (phase)
+    {
+    case Phase::physics:
+        return "physics";
+    case Phase::handoff:
+        return "handoff";
+    case Phase::pre_draw:
+        return "pre_draw";
+    case Phase::draw:
+        return "draw";
+    case Phase::count:
+        break;
+    }
+    return "unknown";
+}
+
+void PhaseProfiler::record(Phase phase, float milliseconds) noexcept
+{
+    RingBuffer& buffer{buffers_[static_cast<std::size_t>(phase)]};
+    const std::size_t count{buffer.count.load(std::memory_order_relaxed)};
+    buffer.samples[count % capacity].store(milliseconds, std::memory_order_relaxed);
+    buffer.count.store(count + 1, std::memory_order_release);
+}
+
+std::vector<float> PhaseProfiler::samples(Phase phase) const
+{
+    const RingBuffer& buffer{buffers_[static_cast<std::size_t>(phase)]};
+    const std::size_t count{buffer.count.load(std::memory_order_acquire)};
+    const std::size_t size{std::min(count, capacity)};
+
+    std::vector<float> result;
+    result.reserve(size);
+    for (std::size_t i = count - size; i < count; ++i)
+    {
+        result.emplace_back(buffer.samples[i % capacity].load(std::memory_order_relaxed));
+    }
+    return result;
+}
+
+float PhaseProfiler::percentile(Phase phase, float percent) const
+{
+    std::vector<float> values{samples(phase)};
+    if (values.empty())
+    {
+        return 0.0f;
+    }
+
+    const float rank{std::clamp(percent, 0.0f, 100.0f) / 100.0f * static_cast<float>(values.size() - 1)};
+    const auto nth{values.begin() + static_cast<std::ptrdiff_t>(std::lround(rank))};
+    std::nth_element(values.begin(), nth, values.end());
+    return *nth;
+}
+
+} // namespace physscope
\ No newline at end of file
@@ -0,0 +1,55 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace physscope
+{
+
+enum class Phase : std::size_t
+{
+    physics = 0, // physics_update() calls of a frame, on the simulation thread
+    handoff,     // waiting for simulation_mutex_ plus publish_state(), on the simulation thread
+    pre_draw,    // pre_draw(), on the render thread
+    draw,        // Polyscope rendering between two user callbacks, on the render thread
+    count,
+};
+
+std::string_view phase_name(Phase phase);
+
+/*
+Keeps the durations of the latest frames of each Phase in fixed-size
+ring buffers. Each phase must be recorded by a single thread, but the
+samples can be read from any thread without locking.
+*/
+class PhaseProfiler
+{
+public:
+    static constexpr std::size_t capacity{512};
+
+    // Store the duration, in milliseconds, of the latest occurrence of phase
+    void record(Phase phase, float milliseconds) noexcept;
+
+    // Return the stored durations of phase, from oldest to newest
+    std::vector<float> samples(Phase phase) const;
+
+    // Return the given percentile (in [0, 100]) of the stored durations of phase
+    float percentile(Phase phase, float percent) const;
+
+private:
+    struct RingBuffer
+    {
+        std::array<std::atomic<float>, capacity> samples{};
+        std::atomic<std::size_t> count{0};
+    };
+
+    std::array<RingBuffer, static_cast<std::size_t>(Phase::count)> buffers_{};
+};
+
+} // namespace physscope
+
+#endif // PROFILER_HPP
\ No newline at end of file
@@ -1,4 +1,3 @@
-#include <mutex>
 #include <thread>
 
 #include "semaphore.hpp"
@@ -6,30 +5,65 @@
 namespace physscope
 {
 
+namespace
+{
+
+// Number of attempts to acquire the semaphore before going to sleep
+constexpr int spin_attempts{128};
+
+} // namespace
+
 Semaphore::Semaphore(std::size_t initial_counter) noexcept : counter_{initial_counter}
 {
 }
 
 void Semaphore::release() noexcept
 {
-    // std::lock_guard lock_protection{mutex_}; // Automatically unlocks the mutex at the end of scope
-    std::scoped_lock lock_protection{mutex_};
-    ++counter_;
-    condition_.notify_one(); // Notify any sleeping thread
+    counter_.fetch_add(1);
+
+    // Only pay for a system call if a thread may be sleeping
+    if (waiters_.load() > 0)
+    {
+        counter_.notify_one();
+    }
 }
 
 void Semaphore::acquire() noexcept
 {
-    std::unique_lock<std::mutex> lock_protection{mutex_}; // Automatically unlocks the mutex at the end of scope
-
-    /*
-    If the condition is not satisfied, the thread is blocked until it's notified
-    by a call of notify_one() or notify_all(). When the blocked thread is notified,
-    the thread is waken up and the condition is checked again. If the condition
-    still isn't satisfied, the thread is blocked again.
-    */
-    condition_.wait(lock_protection, [&counter = counter_] { return counter > 0; });
-    --counter_;
+    for (int attempt = 0; attempt < spin_attempts; ++attempt)
+    {
+        if (try_acquire())
+        {
+            return;
+        }
+        std::this_thread::yield();
+    }
+
+    waiters_.fetch_add(1);
+    while (!try_acquire())
+    {
+        /*
+        The thread is blocked while the counter is zero, until it's notified
+        by a call of release(). When the blocked thread is woken up, it tries
+        to decrement the counter again, since another thread may have
+        acquired the semaphore in the meantime.
+        */
+        counter_.wait(0);
+    }
+    waiters_.fetch_sub(1);
+}
+
+bool Semaphore::try_acquire() noexcept
+{
+    std::size_t counter{counter_.load()};
+    while (counter > 0)
+    {
+        if (counter_.compare_exchange_weak(counter, counter - 1))
+        {
+            return true;
+        }
+    }
+    return false;
 }
 
 } // namespace physscope
\ No newline at end of file
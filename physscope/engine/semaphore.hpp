@@ -1,12 +1,18 @@
 #ifndef SEMAPHORE_HPP
 #define SEMAPHORE_HPP
 
-#include <condition_variable>
-#include <mutex>
+#include <atomic>
+#include <cstddef>
 
 namespace physscope
 {
 
+/*
+Counting semaphore. When the counter is positive, acquire() and release()
+are a single atomic operation; when it's zero, acquire() spins for a short
+while and then sleeps using std::atomic::wait (a futex on Linux) until
+another thread calls release().
+*/
 class Semaphore
 {
 public:
@@ -19,9 +25,10 @@ public:
     void acquire() noexcept;
 
 private:
-    std::size_t counter_;
-    std::mutex mutex_;
-    std::condition_variable condition_;
+    bool try_acquire() noexcept;
+
+    std::atomic<std::size_t> counter_;
+    std::atomic<std::size_t> waiters_{0};
 };
 
 } // namespace physscope
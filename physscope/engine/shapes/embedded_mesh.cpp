@@ -0,0 +1,38 @@
+#include "shapes/embedded_mesh.hpp"
+
+namespace physscope
+{
+
+namespace shapes
+{
+
+std::size_t EmbeddedMesh::num_vertices() const
+{
+    return positions.size() / 3;
+}
+
+std::size_t EmbeddedMesh::num_triangles() const
+{
+    return indices.size() / 3;
+}
+
+geometry::IndexedTriangleMesh to_indexed_triangle_mesh(const EmbeddedMesh& mesh)
+{
+    geometry::IndexedTriangleMesh triangle_mesh{};
+    triangle_mesh.vertices.reserve(mesh.num_vertices());
+    for (std::size_t i = 0; i < mesh.positions.size(); i += 3)
+    {
+        triangle_mesh.vertices.emplace_back(mesh.positions[i], mesh.positions[i + 1], mesh.positions[i + 2]);
+    }
+
+    triangle_mesh.indices.reserve(mesh.num_triangles());
+    for (std::size_t i = 0; i < mesh.indices.size(); i += 3)
+    {
+        triangle_mesh.indices.push_back({mesh.indices[i], mesh.indices[i + 1], mesh.indices[i + 2]});
+    }
+    return triangle_mesh;
+}
+
+} // namespace shapes
+
+} // namespace physscope
\ No newline at end of file
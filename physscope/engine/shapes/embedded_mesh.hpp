@@ -0,0 +1,36 @@
+#ifndef EMBEDDED_MESH_HPP
+#define EMBEDDED_MESH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "geometry.hpp"
+
+namespace physscope
+{
+
+namespace shapes
+{
+
+/*
+View of a triangle mesh compiled into the executable (see scripts/obj_to_header.py):
+positions stores x, y, z for each vertex and indices stores three vertex indices
+for each triangle. No parsing is needed to use it.
+*/
+struct EmbeddedMesh
+{
+    std::span<const float> positions;
+    std::span<const std::uint32_t> indices;
+
+    std::size_t num_vertices() const;
+    std::size_t num_triangles() const;
+};
+
+geometry::IndexedTriangleMesh to_indexed_triangle_mesh(const EmbeddedMesh& mesh);
+
+} // namespace shapes
+
+} // namespace physscope
+
+#endif // EMBEDDED_MESH_HPP
\ No newline at end of file
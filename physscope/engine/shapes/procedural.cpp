@@ -0,0 +1,78 @@
+#include <span>
+
+#include "shapes/procedural.hpp"
+
+namespace physscope
+{
+
+namespace shapes
+{
+
+namespace
+{
+
+// Small shapes can be generated at compile time
+static_assert(make_static_mesh<icosphere_size(1)>([](auto vertices, auto triangles)
+                                                  { generate_icosphere(vertices, triangles, 1); })
+                  .vertices[0][1] > 0.0f);
+
+// Allocate the buffers once and generate the shape directly into them
+template <typename Generate>
+geometry::IndexedTriangleMesh make_mesh(MeshSize size, const Generate& generate)
+{
+    geometry::IndexedTriangleMesh mesh{};
+    mesh.vertices.resize(size.num_vertices);
+    mesh.indices.resize(size.num_triangles);
+    generate(std::span<glm::vec3>{mesh.vertices},
+             std::span<std::array<geometry::IndexedTriangleMesh::index_type, 3>>{mesh.indices});
+    return mesh;
+}
+
+} // namespace
+
+geometry::IndexedTriangleMesh make_uv_sphere(std::size_t segments, std::size_t rings, float radius)
+{
+    return make_mesh(uv_sphere_size(segments, rings), [&](auto vertices, auto triangles)
+                     { generate_uv_sphere(vertices, triangles, segments, rings, radius); });
+}
+
+geometry::IndexedTriangleMesh make_icosphere(std::size_t frequency, float radius)
+{
+    return make_mesh(icosphere_size(frequency), [&](auto vertices, auto triangles)
+                     { generate_icosphere(vertices, triangles, frequency, radius); });
+}
+
+geometry::IndexedTriangleMesh make_box(std::size_t subdivisions, float half_extent)
+{
+    return make_mesh(box_size(subdivisions), [&](auto vertices, auto triangles)
+                     { generate_box(vertices, triangles, subdivisions, half_extent); });
+}
+
+geometry::IndexedTriangleMesh make_plane(std::size_t subdivisions, float half_extent)
+{
+    return make_mesh(plane_size(subdivisions), [&](auto vertices, auto triangles)
+                     { generate_plane(vertices, triangles, subdivisions, half_extent); });
+}
+
+geometry::IndexedTriangleMesh make_cylinder(std::size_t segments, float radius, float height)
+{
+    return make_mesh(cylinder_size(segments), [&](auto vertices, auto triangles)
+                     { generate_cylinder(vertices, triangles, segments, radius, height); });
+}
+
+geometry::IndexedTriangleMesh make_capsule(std::size_t segments, std::size_t rings, float radius, float height)
+{
+    return make_mesh(capsule_size(segments, rings), [&](auto vertices, auto triangles)
+                     { generate_capsule(vertices, triangles, segments, rings, radius, height); });
+}
+
+geometry::IndexedTriangleMesh make_torus(std::size_t segments, std::size_t sides, float major_radius,
+                                         float minor_radius)
+{
+    return make_mesh(torus_size(segments, sides), [&](auto vertices, auto triangles)
+                     { generate_torus(vertices, triangles, segments, sides, major_radius, minor_radius); });
+}
+
+} // namespace shapes
+
+} // namespace physscope
\ No newline at end of file
@@ -0,0 +1,588 @@
+#ifndef PROCEDURAL_HPP
+#define PROCEDURAL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "geometry.hpp"
+
+/*
+Procedural shape generators. Each shape comes in three flavours:
+    - X_size(resolution): number of vertices and triangles of the shape;
+    - generate_X(vertices, triangles, resolution): writes the shape into
+      preallocated buffers of any vertex type constructible from three
+      floats (e.g. glm::vec3 or std::array<float, 3>) and any index type;
+      it's constexpr, so small shapes can be generated at compile time
+      (see make_static_mesh());
+    - make_X(resolution): returns the shape as an IndexedTriangleMesh.
+Triangles are counter-clockwise when seen from outside the shape, and
+the shapes are centered at the origin with y as the up axis.
+*/
+
+namespace physscope
+{
+
+namespace shapes
+{
+
+struct MeshSize
+{
+    std::size_t num_vertices{0};
+    std::size_t num_triangles{0};
+};
+
+template <std::size_t NumVertices, std::size_t NumTriangles>
+struct StaticMesh
+{
+    std::array<std::array<float, 3>, NumVertices> vertices{};
+    std::array<std::array<std::uint32_t, 3>, NumTriangles> triangles{};
+};
+
+/*
+Generate a shape at compile time, e.g.
+    constexpr auto proxy{make_static_mesh<icosphere_size(1)>(
+        [](auto vertices, auto triangles) { generate_icosphere(vertices, triangles, 1); })};
+*/
+template <MeshSize Size, typename Generate>
+constexpr StaticMesh<Size.num_vertices, Size.num_triangles> make_static_mesh(const Generate& generate)
+{
+    StaticMesh<Size.num_vertices, Size.num_triangles> mesh{};
+    generate(std::span<std::array<float, 3>>{mesh.vertices}, std::span<std::array<std::uint32_t, 3>>{mesh.triangles});
+    return mesh;
+}
+
+namespace detail
+{
+
+constexpr double pi{3.14159265358979323846};
+
+// std::sin and std::cos aren't constexpr until C++26
+constexpr double sin(double x)
+{
+    x -= 2.0 * pi * static_cast<double>(static_cast<long long>(x / (2.0 * pi)));
+    if (x > pi)
+    {
+        x -= 2.0 * pi;
+    }
+    else if (x < -pi)
+    {
+        x += 2.0 * pi;
+    }
+
+    // Taylor series; the error is below 1e-16 on [-pi, pi]
+    double term{x};
+    double sum{x};
+    for (int n = 1; n < 14; ++n)
+    {
+        term *= -x * x / static_cast<double>((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double cos(double x)
+{
+    return sin(x + pi / 2.0);
+}
+
+constexpr double sqrt(double x)
+{
+    if (x <= 0.0)
+    {
+        return 0.0;
+    }
+
+    double root{x > 1.0 ? x : 1.0};
+    for (int i = 0; i < 64; ++i)
+    {
+        const double next{0.5 * (root + x / root)};
+        if (next == root)
+        {
+            break;
+        }
+        root = next;
+    }
+    return root;
+}
+
+template <typename Vertex>
+constexpr Vertex make_vertex(double x, double y, double z)
+{
+    return Vertex{static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)};
+}
+
+template <typename Index>
+constexpr std::array<Index, 3> make_triangle(std::size_t a, std::size_t b, std::size_t c)
+{
+    return std::array<Index, 3>{static_cast<Index>(a), static_cast<Index>(b), static_cast<Index>(c)};
+}
+
+struct ProfilePoint
+{
+    double radius{0.0};
+    double height{0.0};
+};
+
+// Size of a surface of revolution with the given rings, of which num_bands pairs of consecutive rings are connected
+constexpr MeshSize lathe_size(std::size_t segments, std::size_t rings, std::size_t num_bands)
+{
+    return MeshSize{.num_vertices = segments * rings + 2, .num_triangles = 2 * segments + 2 * segments * num_bands};
+}
+
+/*
+Surface of revolution around the y axis: a top pole at top_height, rings
+of segments vertices placed at profile(ring) from top to bottom, and a
+bottom pole at bottom_height. Consecutive rings are connected by a band
+of triangles when is_band(ring) is true for the upper one; the poles are
+connected to the first and last rings.
+*/
+template <typename Vertex, typename Index, typename Profile, typename IsBand>
+constexpr void generate_lathe(std::span<Vertex> vertices, std::span<std::array<Index, 3>> triangles,
+                              std::size_t segments, std::size_t rings, double top_height, double bottom_height,
+                              const Profile& profile, const IsBand& is_band)
+{
+    const std::size_t bottom_pole{segments * rings + 1};
+    vertices[0] = make_vertex<Vertex>(0.0, top_height, 0.0);
+    for (std::size_t ring = 0; ring < rings; ++ring)
+    {
+        const ProfilePoint point{profile(ring)};
+        for (std::size_t segment = 0; segment < segments; ++segment)
+        {
+            const double angle{2.0 * pi * static_cast<double>(segment) / static_cast<double>(segments)};
+            vertices[1 + ring * segments + segment] =
+                make_vertex<Vertex>(point.radius * cos(angle), point.height, point.radius * sin(angle));
+        }
+    }
+    vertices[bottom_pole] = make_vertex<Vertex>(0.0, bottom_height, 0.0);
+
+    const auto ring_vertex = [segments](std::size_t ring, std::size_t segment)
+    { return 1 + ring * segments + segment % segments; };
+
+    std::size_t triangle{0};
+    for (std::size_t segment = 0; segment < segments; ++segment)
+    {
+        triangles[triangle++] = make_triangle<Index>(0, ring_vertex(0, segment + 1), ring_vertex(0, segment));
+    }
+    for (std::size_t ring = 0; ring + 1 < rings; ++ring)
+    {
+        if (!is_band(ring))
+        {
+            continue;
+        }
+
+        for (std::size_t segment = 0; segment < segments; ++segment)
+        {
+            const std::size_t upper_0{ring_vertex(ring, segment)};
+            const std::size_t upper_1{ring_vertex(ring, segment + 1)};
+            const std::size_t lower_0{ring_vertex(ring + 1, segment)};
+            const std::size_t lower_1{ring_vertex(ring + 1, segment + 1)};
+            triangles[triangle++] = make_triangle<Index>(upper_0, upper_1, lower_1);
+            triangles[triangle++] = make_triangle<Index>(upper_0, lower_1, lower_0);
+        }
+    }
+    for (std::size_t segment = 0; segment < segments; ++segment)
+    {
+        triangles[triangle++] =
+            make_triangle<Index>(bottom_pole, ring_vertex(rings - 1, segment), ring_vertex(rings - 1, segment + 1));
+    }
+}
+
+/*
+Square grid of subdivisions x subdivisions cells on the plane through
+center spanned by the half-extent vectors u and v; faces u x v.
+*/
+template <typename Vertex, typename Index>
+constexpr void generate_grid(std::span<Vertex> vertices, std::span<std::array<Index, 3>> triangles,
+                             std::size_t subdivisions, const std::array<double, 3>& center,
+                             const std::array<double, 3>& u, const std::array<double, 3>& v)
+{
+    const std::size_t row_size{subdivisions + 1};
+    for (std::size_t t = 0; t <= subdivisions; ++t)
+    {
+        const double v_weight{2.0 * static_cast<double>(t) / static_cast<double>(subdivisions) - 1.0};
+        for (std::size_t s = 0; s <= subdivisions; ++s)
+        {
+            const double u_weight{2.0 * static_cast<double>(s) / static_cast<double>(subdivisions) - 1.0};
+            vertices[t * row_size + s] = make_vertex<Vertex>(center[0] + u_weight * u[0] + v_weight * v[0],
+                                                             center[1] + u_weight * u[1] + v_weight * v[1],
+                                                             center[2] + u_weight * u[2] + v_weight * v[2]);
+        }
+    }
+
+    std::size_t triangle{0};
+    for (std::size_t t = 0; t < subdivisions; ++t)
+    {
+        for (std::size_t s = 0; s < subdivisions; ++s)
+        {
+            const std::size_t corner{t * row_size + s};
+            triangles[triangle++] = make_triangle<Index>(corner, corner + 1, corner + row_size + 1);
+            triangles[triangle++] = make_triangle<Index>(corner, corner + row_size + 1, corner + row_size);
+        }
+    }
+}
+
+// Regular icosahedron inscribed on a sphere of radius sqrt(1 + golden_ratio^2)
+constexpr double golden_ratio{1.6180339887498948482};
+
+constexpr std::array<std::array<double, 3>, 12> icosahedron_vertices{{
+    {-1.0, golden_ratio, 0.0},
+    {1.0, golden_ratio, 0.0},
+    {-1.0, -golden_ratio, 0.0},
+    {1.0, -golden_ratio, 0.0},
+    {0.0, -1.0, golden_ratio},
+    {0.0, 1.0, golden_ratio},
+    {0.0, -1.0, -golden_ratio},
+    {0.0, 1.0, -golden_ratio},
+    {golden_ratio, 0.0, -1.0},
+    {golden_ratio, 0.0, 1.0},
+    {-golden_ratio, 0.0, -1.0},
+    {-golden_ratio, 0.0, 1.0},
+}};
+
+constexpr std::array<std::array<std::size_t, 3>, 20> icosahedron_faces{{
+    {0, 11, 5}, {0, 5, 1},  {0, 1, 7},   {0, 7, 10}, {0, 10, 11}, {1, 5, 9}, {5, 11, 4},
+    {11, 10, 2}, {10, 7, 6}, {7, 1, 8},   {3, 9, 4},  {3, 4, 2},   {3, 2, 6}, {3, 6, 8},
+    {3, 8, 9},  {4, 9, 5},  {2, 4, 11},  {6, 2, 10}, {8, 6, 7},   {9, 8, 1},
+}};
+
+// The 30 edges of the icosahedron, with the lowest vertex index first
+constexpr std::array<std::array<std::size_t, 2>, 30> icosahedron_edges{[]
+{
+    std::array<std::array<std::size_t, 2>, 30> edges{};
+    std::size_t num_edges{0};
+    for (const std::array<std::size_t, 3>& face : icosahedron_faces)
+    {
+        for (std::size_t corner = 0; corner < 3; ++corner)
+        {
+            const std::size_t a{face[corner]};
+            const std::size_t b{face[(corner + 1) % 3]};
+            const std::array<std::size_t, 2> edge{a < b ? a : b, a < b ? b : a};
+            bool found{false};
+            for (std::size_t i = 0; i < num_edges && !found; ++i)
+            {
+                found = edges[i] == edge;
+            }
+            if (!found)
+            {
+                edges[num_edges++] = edge;
+            }
+        }
+    }
+    return edges;
+}()};
+
+/*
+Index of the vertex at (steps towards face[1], steps towards face[2]) on the
+triangular grid of face, with frequency steps along each edge. Vertices on
+corners and edges are shared with the neighbouring faces.
+*/
+constexpr std::size_t icosphere_vertex(std::size_t face, std::size_t i, std::size_t j, std::size_t frequency)
+{
+    const std::array<std::size_t, 3>& corners{icosahedron_faces[face]};
+    if (i == 0 && j == 0)
+    {
+        return corners[0];
+    }
+    if (i == frequency)
+    {
+        return corners[1];
+    }
+    if (j == frequency)
+    {
+        return corners[2];
+    }
+
+    // Vertex at step (from first) on the edge between first and second
+    const auto edge_vertex = [frequency](std::size_t first, std::size_t second, std::size_t step)
+    {
+        std::size_t edge{0};
+        while (icosahedron_edges[edge] != std::array<std::size_t, 2>{first < second ? first : second,
+                                                                        first < second ? second : first})
+        {
+            ++edge;
+        }
+        const std::size_t step_from_lowest{first < second ? step : frequency - step};
+        return icosahedron_vertices.size() + edge * (frequency - 1) + step_from_lowest - 1;
+    };
+
+    if (j == 0)
+    {
+        return edge_vertex(corners[0], corners[1], i);
+    }
+    if (i == 0)
+    {
+        return edge_vertex(corners[0], corners[2], j);
+    }
+    if (i + j == frequency)
+    {
+        return edge_vertex(corners[1], corners[2], j);
+    }
+
+    const std::size_t face_size{(frequency - 1) * (frequency - 2) / 2};
+    const std::size_t interior_start{icosahedron_vertices.size() + icosahedron_edges.size() * (frequency - 1) +
+                                     face * face_size};
+    return interior_start + (i - 1) * (frequency - 1) - (i - 1) * i / 2 + (j - 1);
+}
+
+} // namespace detail
+
+constexpr MeshSize uv_sphere_size(std::size_t segments, std::size_t rings)
+{
+    return detail::lathe_size(segments, rings - 1, rings - 2);
+}
+
+/*
+Sphere made of segments meridians and rings parallel bands (segments >= 3, rings >= 2).
+*/
+template <typename Vertex, typename Index>
+constexpr void generate_uv_sphere(std::span<Vertex> vertices, std::span<std::array<Index, 3>> triangles,
+                                  std::size_t segments, std::size_t rings, float radius = 1.0f)
+{
+    const auto profile = [rings, radius](std::size_t ring)
+    {
+        const double angle{detail::pi * static_cast<double>(ring + 1) / static_cast<double>(rings)};
+        return detail::ProfilePoint{.radius = radius * detail::sin(angle), .height = radius * detail::cos(angle)};
+    };
+    detail::generate_lathe(vertices, triangles, segments, rings - 1, radius, -radius, profile,
+                           [](std::size_t) { return true; });
+}
+
+constexpr MeshSize icosphere_size(std::size_t frequency)
+{
+    return MeshSize{.num_vertices = 10 * frequency * frequency + 2, .num_triangles = 20 * frequency * frequency};
+}
+
+/*
+Sphere made of an icosahedron whose faces are split into frequency x frequency
+triangles, projected onto the sphere (frequency >= 1). Triangles are much more
+uniform than on a UV sphere: frequency 1 (20 triangles) and 2 (80) are good
+low-poly proxies.
+*/
+template <typename Vertex, typename Index>
+constexpr void generate_icosphere(std::span<Vertex> vertices, std::span<std::array<Index, 3>> triangles,
+                                  std::size_t frequency, float radius = 1.0f)
+{
+    const auto place = [&vertices, radius](std::size_t index, const std::array<double, 3>& point)
+    {
+        const double scale{radius / detail::sqrt(point[0] * point[0] + point[1] * point[1] + point[2] * point[2])};
+        vertices[index] = detail::make_vertex<Vertex>(scale * point[0], scale * point[1], scale * point[2]);
+    };
+
+    // Every vertex is placed once per face it belongs to, always at the same position
+    std::size_t triangle{0};
+    for (std::size_t face = 0; face < detail::icosahedron_faces.size(); ++face)
+    {
+        const std::array<std::size_t, 3>& corners{detail::icosahedron_faces[face]};
+        const auto vertex = [face, frequency](std::size_t i, std::size_t j)
+        { return detail::icosphere_vertex(face, i, j, frequency); };
+        for (std::size_t i = 0; i <= frequency; ++i)
+        {
+            for (std::size_t j = 0; i + j <= frequency; ++j)
+            {
+                const double weight_1{static_cast<double>(i) / static_cast<double>(frequency)};
+                const double weight_2{static_cast<double>(j) / static_cast<double>(frequency)};
+                const double weight_0{1.0 - weight_1 - weight_2};
+                std::array<double, 3> point{};
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    point[axis] = weight_0 * detail::icosahedron_vertices[corners[0]][axis] +
+                                  weight_1 * detail::icosahedron_vertices[corners[1]][axis] +
+                                  weight_2 * detail::icosahedron_vertices[corners[2]][axis];
+                }
+                place(vertex(i, j), point);
+            }
+        }
+
+        for (std::size_t i = 0; i < frequency; ++i)
+        {
+            for (std::size_t j = 0; i + j < frequency; ++j)
+            {
+                triangles[triangle++] = detail::make_triangle<Index>(vertex(i, j), vertex(i + 1, j), vertex(i, j + 1));
+                if (i + j + 1 < frequency)
+                {
+                    triangles[triangle++] =
+                        detail::make_triangle<Index>(vertex(i + 1, j), vertex(i + 1, j + 1), vertex(i, j + 1));
+                }
+            }
+        }
+    }
+}
+
+constexpr MeshSize box_size(std::size_t subdivisions)
+{
+    return MeshSize{.num_vertices = 6 * (subdivisions + 1) * (subdivisions + 1),
+                    .num_triangles = 12 * subdivisions * subdivisions};
+}
+
+/*
+Axis-aligned box from -half_extent to half_extent, with each face split into
+subdivisions x subdivisions quads (subdivisions >= 1). Faces don't share
+vertices, so flat shading has sharp edges.
+*/
+template <typename Vertex, typename Index>
+constexpr void generate_box(std::span<Vertex> vertices, std::span<std::array<Index, 3>> triangles,
+                            std::size_t subdivisions, float half_extent = 1.0f)
+{
+    // Normal, u and v of each face, with u x v = normal
+    constexpr std::array<std::array<std::array<double, 3>, 3>, 6> faces{{
+        {{{1.0, 0.0, 0.0}, {0.0, 0.0, -1.0}, {0.0, 1.0, 0.0}}},
+        {{{-1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, 1.0, 0.0}}},
+        {{{0.0, 1.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 0.0, -1.0}}},
+        {{{0.0, -1.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}}},
+        {{{0.0, 0.0, 1.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}}},
+        {{{0.0, 0.0, -1.0}, {-1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}}},
+    }};
+
+    const MeshSize face_size{.num_vertices = (subdivisions + 1) * (subdivisions + 1),
+                             .num_triangles = 2 * subdivisions * subdivisions};
+    for (std::size_t face = 0; face < faces.size(); ++face)
+    {
+        std::array<std::array<double, 3>, 3> axes{};
+        for (std::size_t axis = 0; axis < 3; ++axis)
+        {
+            for (std::size_t component = 0; component < 3; ++component)
+            {
+                axes[axis][component] = half_extent * faces[face][axis][component];
+            }
+        }
+
+        const std::span<std::array<Index, 3>> face_triangles{
+            triangles.subspan(face * face_size.num_triangles, face_size.num_triangles)};
+        detail::generate_grid(vertices.subspan(face * face_size.num_vertices, face_size.num_vertices), face_triangles,
+                              subdivisions, axes[0], axes[1], axes[2]);
+        for (std::array<Index, 3>& triangle : face_triangles)
+        {
+            for (Index& index : triangle)
+            {
+                index += static_cast<Index>(face * face_size.num_vertices);
+            }
+        }
+    }
+}
+
+constexpr MeshSize plane_size(std::size_t subdivisions)
+{
+    return MeshSize{.num_vertices = (subdivisions + 1) * (subdivisions + 1),
+                    .num_triangles = 2 * subdivisions * subdivisions};
+}
+
+/*
+Square on the xz plane from -half_extent to half_extent, facing +y, split
+into subdivisions x subdivisions quads (subdivisions >= 1).
+*/
+template <typename Vertex, typename Index>
+constexpr void generate_plane(std::span<Vertex> vertices, std::span<std::array<Index, 3>> triangles,
+                              std::size_t subdivisions, float half_extent = 1.0f)
+{
+    detail::generate_grid(vertices, triangles, subdivisions, {0.0, 0.0, 0.0}, {half_extent, 0.0, 0.0},
+                          {0.0, 0.0, -static_cast<double>(half_extent)});
+}
+
+constexpr MeshSize cylinder_size(std::size_t segments)
+{
+    return detail::lathe_size(segments, 4, 1);
+}
+
+/*
+Cylinder along the y axis with segments sides (segments >= 3). The caps
+have their own rings of vertices, so they have sharp edges when shaded.
+*/
+template <typename Vertex, typename Index>
+constexpr void generate_cylinder(std::span<Vertex> vertices, std::span<std::array<Index, 3>> triangles,
+                                 std::size_t segments, float radius = 1.0f, float height = 2.0f)
+{
+    // Top cap, side (top and bottom rings) and bottom cap
+    const auto profile = [radius, height](std::size_t ring)
+    { return detail::ProfilePoint{.radius = radius, .height = ring < 2 ? height / 2.0 : -height / 2.0}; };
+    detail::generate_lathe(vertices, triangles, segments, 4, height / 2.0, -height / 2.0, profile,
+                           [](std::size_t ring) { return ring == 1; });
+}
+
+constexpr MeshSize capsule_size(std::size_t segments, std::size_t rings)
+{
+    return detail::lathe_size(segments, 2 * rings, 2 * rings - 1);
+}
+
+/*
+Cylinder of the given height capped by hemispheres, along the y axis;
+segments meridians (>= 3) and rings parallel bands per hemisphere (>= 1).
+*/
+template <typename Vertex, typename Index>
+constexpr void generate_capsule(std::span<Vertex> vertices, std::span<std::array<Index, 3>> triangles,
+                                std::size_t segments, std::size_t rings, float radius = 1.0f, float height = 2.0f)
+{
+    // The last ring of the top hemisphere and the first of the bottom one bound the cylinder
+    const auto profile = [rings, radius, height](std::size_t ring)
+    {
+        const bool is_top{ring < rings};
+        const std::size_t step{is_top ? ring + 1 : ring};
+        const double angle{detail::pi / 2.0 * static_cast<double>(step) / static_cast<double>(rings)};
+        const double center{is_top ? height / 2.0 : -height / 2.0};
+        return detail::ProfilePoint{.radius = radius * detail::sin(angle),
+                                    .height = center + radius * detail::cos(angle)};
+    };
+    detail::generate_lathe(vertices, triangles, segments, 2 * rings, height / 2.0 + radius, -height / 2.0 - radius,
+                           profile, [](std::size_t) { return true; });
+}
+
+constexpr MeshSize torus_size(std::size_t segments, std::size_t sides)
+{
+    return MeshSize{.num_vertices = segments * sides, .num_triangles = 2 * segments * sides};
+}
+
+/*
+Torus around the y axis: segments sections (>= 3) along the ring, each a
+circle of sides vertices (>= 3) and radius minor_radius.
+*/
+template <typename Vertex, typename Index>
+constexpr void generate_torus(std::span<Vertex> vertices, std::span<std::array<Index, 3>> triangles,
+                              std::size_t segments, std::size_t sides, float major_radius = 1.0f,
+                              float minor_radius = 0.25f)
+{
+    for (std::size_t segment = 0; segment < segments; ++segment)
+    {
+        const double ring_angle{2.0 * detail::pi * static_cast<double>(segment) / static_cast<double>(segments)};
+        for (std::size_t side = 0; side < sides; ++side)
+        {
+            const double tube_angle{2.0 * detail::pi * static_cast<double>(side) / static_cast<double>(sides)};
+            const double radius{major_radius + minor_radius * detail::cos(tube_angle)};
+            vertices[segment * sides + side] =
+                detail::make_vertex<Vertex>(radius * detail::cos(ring_angle), minor_radius * detail::sin(tube_angle),
+                                            radius * detail::sin(ring_angle));
+        }
+    }
+
+    std::size_t triangle{0};
+    for (std::size_t segment = 0; segment < segments; ++segment)
+    {
+        const std::size_t next_segment{(segment + 1) % segments};
+        for (std::size_t side = 0; side < sides; ++side)
+        {
+            const std::size_t next_side{(side + 1) % sides};
+            const std::size_t corner_00{segment * sides + side};
+            const std::size_t corner_01{segment * sides + next_side};
+            const std::size_t corner_10{next_segment * sides + side};
+            const std::size_t corner_11{next_segment * sides + next_side};
+            triangles[triangle++] = detail::make_triangle<Index>(corner_00, corner_01, corner_11);
+            triangles[triangle++] = detail::make_triangle<Index>(corner_00, corner_11, corner_10);
+        }
+    }
+}
+
+geometry::IndexedTriangleMesh make_uv_sphere(std::size_t segments, std::size_t rings, float radius = 1.0f);
+geometry::IndexedTriangleMesh make_icosphere(std::size_t frequency, float radius = 1.0f);
+geometry::IndexedTriangleMesh make_box(std::size_t subdivisions, float half_extent = 1.0f);
+geometry::IndexedTriangleMesh make_plane(std::size_t subdivisions, float half_extent = 1.0f);
+geometry::IndexedTriangleMesh make_cylinder(std::size_t segments, float radius = 1.0f, float height = 2.0f);
+geometry::IndexedTriangleMesh make_capsule(std::size_t segments, std::size_t rings, float radius = 1.0f,
+                                           float height = 2.0f);
+geometry::IndexedTriangleMesh make_torus(std::size_t segments, std::size_t sides, float major_radius = 1.0f,
+                                         float minor_radius = 0.25f);
+
+} // namespace shapes
+
+} // namespace physscope
+
+#endif // PROCEDURAL_HPP
\ No newline at end of file
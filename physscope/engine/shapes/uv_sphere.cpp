@@ -0,0 +1,1192 @@
+// Generated by scripts/obj_to_header.py from uv_sphere.obj; do not edit.
+#include <array>
+#include <cstdint>
+
+#include "shapes/uv_sphere.hpp"
+
+namespace physscope
+{
+
+namespace shapes
+{
+
+namespace
+{
+
+constexpr std::array<float, 5958> positions{
+    0.0f, 0.995185f, -0.098017f, 0.0f, 0.95694f, -0.290285f, 0.0f, 0.92388f, -0.382683f, 0.0f, 0.77301f, -0.634393f,
+    0.0f, 0.707107f, -0.707107f, 0.0f, 0.634393f, -0.77301f, 0.0f, 0.471397f, -0.881921f, 0.0f, 0.290285f, -0.95694f,
+    0.0f, 0.19509f, -0.980785f, 0.0f, 0.098017f, -0.995185f, 0.0f, -0.0f, -1.0f, 0.0f, -0.098017f, -0.995185f, 0.0f,
+    -0.19509f, -0.980785f, 0.0f, -0.290285f, -0.95694f, 0.0f, -0.382683f, -0.92388f, 0.0f, -0.471397f, -0.881921f, 0.0f,
+    -0.707107f, -0.707107f, 0.0f, -0.77301f, -0.634393f, 0.0f, -0.881921f, -0.471397f, 0.0f, -0.995185f, -0.098017f,
+    0.009607f, 0.995185f, -0.097545f, 0.019122f, 0.980785f, -0.194151f, 0.028453f, 0.95694f, -0.288887f, 0.03751f,
+    0.92388f, -0.380841f, 0.046205f, 0.881921f, -0.469127f, 0.054455f, 0.83147f, -0.552895f, 0.062181f, 0.77301f,
+    -0.631338f, 0.069309f, 0.707107f, -0.703702f, 0.075768f, 0.634393f, -0.769288f, 0.081498f, 0.55557f, -0.827466f,
+    0.086443f, 0.471397f, -0.877675f, 0.090556f, 0.382683f, -0.919431f, 0.093797f, 0.290285f, -0.952332f, 0.096134f,
+    0.19509f, -0.976062f, 0.097545f, 0.098017f, -0.990393f, 0.098017f, -0.0f, -0.995185f, 0.097545f, -0.098017f,
+    -0.990393f, 0.096134f, -0.19509f, -0.976062f, 0.093797f, -0.290285f, -0.952332f, 0.090556f, -0.382683f, -0.919431f,
+    0.086443f, -0.471397f, -0.877675f, 0.081498f, -0.55557f, -0.827466f, 0.075768f, -0.634393f, -0.769288f, 0.069309f,
+    -0.707107f, -0.703702f, 0.062181f, -0.77301f, -0.631338f, 0.054455f, -0.83147f, -0.552895f, 0.046205f, -0.881921f,
+    -0.469127f, 0.03751f, -0.92388f, -0.380841f, 0.028453f, -0.95694f, -0.288887f, 0.019122f, -0.980785f, -0.194151f,
+    0.009607f, -0.995185f, -0.097545f, 0.019122f, 0.995185f, -0.096134f, 0.03806f, 0.980785f, -0.191342f, 0.056632f,
+    0.95694f, -0.284707f, 0.074658f, 0.92388f, -0.37533f, 0.091965f, 0.881921f, -0.462339f, 0.108386f, 0.83147f,
+    -0.544895f, 0.123764f, 0.77301f, -0.622204f, 0.13795f, 0.707107f, -0.69352f, 0.150807f, 0.634393f, -0.758157f,
+    0.162212f, 0.55557f, -0.815493f, 0.172054f, 0.471397f, -0.864975f, 0.18024f, 0.382683f, -0.906127f, 0.18669f,
+    0.290285f, -0.938553f, 0.191342f, 0.19509f, -0.96194f, 0.194151f, 0.098017f, -0.976062f, 0.19509f, -0.0f,
+    -0.980785f, 0.194151f, -0.098017f, -0.976062f, 0.191342f, -0.19509f, -0.96194f, 0.18669f, -0.290285f, -0.938553f,
+    0.18024f, -0.382683f, -0.906128f, 0.172054f, -0.471397f, -0.864975f, 0.162212f, -0.55557f, -0.815493f, 0.150807f,
+    -0.634393f, -0.758157f, 0.13795f, -0.707107f, -0.69352f, 0.123764f, -0.77301f, -0.622204f, 0.108386f, -0.83147f,
+    -0.544895f, 0.091965f, -0.881921f, -0.462339f, 0.074658f, -0.92388f, -0.37533f, 0.056632f, -0.95694f, -0.284707f,
+    0.03806f, -0.980785f, -0.191342f, 0.019122f, -0.995185f, -0.096134f, 0.028453f, 0.995185f, -0.093797f, 0.056632f,
+    0.980785f, -0.18669f, 0.084265f, 0.95694f, -0.277785f, 0.111087f, 0.92388f, -0.366205f, 0.136839f, 0.881921f,
+    -0.451099f, 0.161274f, 0.83147f, -0.531648f, 0.184155f, 0.77301f, -0.607076f, 0.205262f, 0.707107f, -0.676659f,
+    0.224393f, 0.634393f, -0.739725f, 0.241363f, 0.55557f, -0.795667f, 0.256008f, 0.471397f, -0.843946f, 0.268188f,
+    0.382683f, -0.884098f, 0.277785f, 0.290285f, -0.915735f, 0.284707f, 0.19509f, -0.938553f, 0.288887f, 0.098017f,
+    -0.952332f, 0.290285f, -0.0f, -0.95694f, 0.288887f, -0.098017f, -0.952332f, 0.284707f, -0.19509f, -0.938553f,
+    0.277785f, -0.290285f, -0.915735f, 0.268188f, -0.382683f, -0.884098f, 0.256008f, -0.471397f, -0.843946f, 0.241363f,
+    -0.55557f, -0.795667f, 0.224393f, -0.634393f, -0.739725f, 0.205262f, -0.707107f, -0.676659f, 0.184155f, -0.77301f,
+    -0.607076f, 0.161274f, -0.83147f, -0.531648f, 0.136839f, -0.881921f, -0.451099f, 0.111087f, -0.92388f, -0.366205f,
+    0.084265f, -0.95694f, -0.277785f, 0.056632f, -0.980785f, -0.18669f, 0.028453f, -0.995185f, -0.093797f, 0.03751f,
+    0.995185f, -0.090556f, 0.074658f, 0.980785f, -0.18024f, 0.111087f, 0.95694f, -0.268188f, 0.146447f, 0.92388f,
+    -0.353553f, 0.180396f, 0.881921f, -0.435514f, 0.212608f, 0.83147f, -0.51328f, 0.242772f, 0.77301f, -0.586103f,
+    0.270598f, 0.707107f, -0.653281f, 0.295818f, 0.634393f, -0.714169f, 0.31819f, 0.55557f, -0.768178f, 0.337497f,
+    0.471397f, -0.814789f, 0.353553f, 0.382683f, -0.853553f, 0.366205f, 0.290285f, -0.884098f, 0.37533f, 0.19509f,
+    -0.906127f, 0.380841f, 0.098017f, -0.919431f, 0.382683f, -0.0f, -0.92388f, 0.380841f, -0.098017f, -0.919431f,
+    0.37533f, -0.19509f, -0.906127f, 0.366205f, -0.290285f, -0.884098f, 0.353553f, -0.382683f, -0.853553f, 0.337497f,
+    -0.471397f, -0.814789f, 0.31819f, -0.55557f, -0.768178f, 0.295818f, -0.634393f, -0.714169f, 0.270598f, -0.707107f,
+    -0.653281f, 0.242772f, -0.77301f, -0.586103f, 0.212608f, -0.83147f, -0.51328f, 0.180396f, -0.881921f, -0.435514f,
+    0.146447f, -0.92388f, -0.353553f, 0.111087f, -0.95694f, -0.268188f, 0.074658f, -0.980785f, -0.18024f, 0.03751f,
+    -0.995185f, -0.090556f, 0.046205f, 0.995185f, -0.086443f, 0.091965f, 0.980785f, -0.172054f, 0.136839f, 0.95694f,
+    -0.256008f, 0.180396f, 0.92388f, -0.337497f, 0.222215f, 0.881921f, -0.415735f, 0.261894f, 0.83147f, -0.489969f,
+    0.299051f, 0.77301f, -0.559485f, 0.333328f, 0.707107f, -0.623612f, 0.364395f, 0.634393f, -0.681734f, 0.391952f,
+    0.55557f, -0.733291f, 0.415735f, 0.471397f, -0.777785f, 0.435514f, 0.382683f, -0.814789f, 0.451099f, 0.290285f,
+    -0.843946f, 0.462339f, 0.19509f, -0.864975f, 0.469127f, 0.098017f, -0.877675f, 0.471397f, -0.0f, -0.881921f,
+    0.469127f, -0.098017f, -0.877675f, 0.462339f, -0.19509f, -0.864975f, 0.451099f, -0.290285f, -0.843946f, 0.435514f,
+    -0.382683f, -0.814789f, 0.415735f, -0.471397f, -0.777785f, 0.391952f, -0.55557f, -0.733291f, 0.364395f, -0.634393f,
+    -0.681734f, 0.333328f, -0.707107f, -0.623612f, 0.299051f, -0.77301f, -0.559485f, 0.261894f, -0.83147f, -0.489969f,
+    0.222215f, -0.881921f, -0.415735f, 0.180396f, -0.92388f, -0.337497f, 0.136839f, -0.95694f, -0.256008f, 0.091965f,
+    -0.980785f, -0.172054f, 0.046205f, -0.995185f, -0.086443f, 0.054455f, 0.995185f, -0.081498f, 0.108386f, 0.980785f,
+    -0.162212f, 0.161274f, 0.95694f, -0.241363f, 0.212608f, 0.92388f, -0.31819f, 0.261894f, 0.881921f, -0.391952f,
+    0.308658f, 0.83147f, -0.46194f, 0.35245f, 0.77301f, -0.527479f, 0.392848f, 0.707107f, -0.587938f, 0.429462f,
+    0.634393f, -0.642735f, 0.46194f, 0.55557f, -0.691342f, 0.489969f, 0.471397f, -0.733291f, 0.51328f, 0.382683f,
+    -0.768178f, 0.531648f, 0.290285f, -0.795667f, 0.544895f, 0.19509f, -0.815493f, 0.552895f, 0.098017f, -0.827466f,
+    0.55557f, -0.0f, -0.83147f, 0.552895f, -0.098017f, -0.827466f, 0.544895f, -0.19509f, -0.815493f, 0.531648f,
+    -0.290285f, -0.795667f, 0.51328f, -0.382683f, -0.768178f, 0.489969f, -0.471397f, -0.733291f, 0.46194f, -0.55557f,
+    -0.691342f, 0.429462f, -0.634393f, -0.642735f, 0.392848f, -0.707107f, -0.587938f, 0.35245f, -0.77301f, -0.527479f,
+    0.308658f, -0.83147f, -0.46194f, 0.261894f, -0.881921f, -0.391952f, 0.212608f, -0.92388f, -0.31819f, 0.161274f,
+    -0.95694f, -0.241363f, 0.108386f, -0.980785f, -0.162212f, 0.054455f, -0.995185f, -0.081498f, 0.062181f, 0.995185f,
+    -0.075768f, 0.123764f, 0.980785f, -0.150807f, 0.184155f, 0.95694f, -0.224393f, 0.242772f, 0.92388f, -0.295818f,
+    0.299051f, 0.881921f, -0.364395f, 0.35245f, 0.83147f, -0.429462f, 0.402455f, 0.77301f, -0.490393f, 0.448584f,
+    0.707107f, -0.546601f, 0.490393f, 0.634393f, -0.597545f, 0.527479f, 0.55557f, -0.642735f, 0.559485f, 0.471397f,
+    -0.681734f, 0.586103f, 0.382683f, -0.714168f, 0.607077f, 0.290285f, -0.739725f, 0.622204f, 0.19509f, -0.758157f,
+    0.631338f, 0.098017f, -0.769288f, 0.634393f, -0.0f, -0.77301f, 0.631338f, -0.098017f, -0.769288f, 0.622204f,
+    -0.19509f, -0.758157f, 0.607077f, -0.290285f, -0.739725f, 0.586103f, -0.382683f, -0.714169f, 0.559485f, -0.471397f,
+    -0.681734f, 0.527479f, -0.55557f, -0.642735f, 0.490393f, -0.634393f, -0.597545f, 0.448584f, -0.707107f, -0.546601f,
+    0.402455f, -0.77301f, -0.490393f, 0.35245f, -0.83147f, -0.429462f, 0.299051f, -0.881921f, -0.364395f, 0.242772f,
+    -0.92388f, -0.295818f, 0.184155f, -0.95694f, -0.224393f, 0.123764f, -0.980785f, -0.150807f, 0.062181f, -0.995185f,
+    -0.075768f, 0.069309f, 0.995185f, -0.069309f, 0.13795f, 0.980785f, -0.13795f, 0.205262f, 0.95694f, -0.205262f,
+    0.270598f, 0.92388f, -0.270598f, 0.333328f, 0.881921f, -0.333328f, 0.392848f, 0.83147f, -0.392848f, 0.448584f,
+    0.77301f, -0.448584f, 0.5f, 0.707107f, -0.5f, 0.546601f, 0.634393f, -0.546601f, 0.587938f, 0.55557f, -0.587938f,
+    0.623612f, 0.471397f, -0.623612f, 0.653281f, 0.382683f, -0.653281f, 0.676659f, 0.290285f, -0.676659f, 0.69352f,
+    0.19509f, -0.69352f, 0.703702f, 0.098017f, -0.703702f, 0.707107f, -0.0f, -0.707107f, 0.703702f, -0.098017f,
+    -0.703702f, 0.69352f, -0.19509f, -0.69352f, 0.676659f, -0.290285f, -0.676659f, 0.653282f, -0.382683f, -0.653281f,
+    0.623613f, -0.471397f, -0.623612f, 0.587938f, -0.55557f, -0.587938f, 0.546601f, -0.634393f, -0.546601f, 0.5f,
+    -0.707107f, -0.5f, 0.448584f, -0.77301f, -0.448584f, 0.392847f, -0.83147f, -0.392848f, 0.333328f, -0.881921f,
+    -0.333328f, 0.270598f, -0.92388f, -0.270598f, 0.205262f, -0.95694f, -0.205262f, 0.13795f, -0.980785f, -0.13795f,
+    0.069309f, -0.995185f, -0.069309f, 0.075768f, 0.995185f, -0.062181f, 0.150807f, 0.980785f, -0.123764f, 0.224393f,
+    0.95694f, -0.184155f, 0.295818f, 0.92388f, -0.242772f, 0.364395f, 0.881921f, -0.299051f, 0.429462f, 0.83147f,
+    -0.35245f, 0.490393f, 0.77301f, -0.402455f, 0.546601f, 0.707107f, -0.448584f, 0.597545f, 0.634393f, -0.490393f,
+    0.642735f, 0.55557f, -0.527479f, 0.681734f, 0.471397f, -0.559485f, 0.714168f, 0.382683f, -0.586103f, 0.739725f,
+    0.290285f, -0.607077f, 0.758157f, 0.19509f, -0.622203f, 0.769288f, 0.098017f, -0.631338f, 0.77301f, -0.0f,
+    -0.634393f, 0.769288f, -0.098017f, -0.631338f, 0.758157f, -0.19509f, -0.622203f, 0.739725f, -0.290285f, -0.607076f,
+    0.714169f, -0.382683f, -0.586103f, 0.681734f, -0.471397f, -0.559485f, 0.642735f, -0.55557f, -0.527479f, 0.597545f,
+    -0.634393f, -0.490393f, 0.546601f, -0.707107f, -0.448584f, 0.490393f, -0.77301f, -0.402455f, 0.429462f, -0.83147f,
+    -0.35245f, 0.364395f, -0.881921f, -0.299051f, 0.295818f, -0.92388f, -0.242772f, 0.224393f, -0.95694f, -0.184155f,
+    0.150807f, -0.980785f, -0.123764f, 0.075768f, -0.995185f, -0.062181f, 0.081498f, 0.995185f, -0.054455f, 0.162212f,
+    0.980785f, -0.108386f, 0.241363f, 0.95694f, -0.161273f, 0.31819f, 0.92388f, -0.212607f, 0.391952f, 0.881921f,
+    -0.261894f, 0.46194f, 0.83147f, -0.308658f, 0.527479f, 0.77301f, -0.35245f, 0.587938f, 0.707107f, -0.392847f,
+    0.642735f, 0.634393f, -0.429461f, 0.691342f, 0.55557f, -0.46194f, 0.733291f, 0.471397f, -0.489969f, 0.768178f,
+    0.382683f, -0.51328f, 0.795667f, 0.290285f, -0.531648f, 0.815493f, 0.19509f, -0.544895f, 0.827466f, 0.098017f,
+    -0.552895f, 0.83147f, -0.0f, -0.55557f, 0.827466f, -0.098017f, -0.552895f, 0.815493f, -0.19509f, -0.544895f,
+    0.795667f, -0.290285f, -0.531648f, 0.768178f, -0.382683f, -0.51328f, 0.733291f, -0.471397f, -0.489969f, 0.691342f,
+    -0.55557f, -0.46194f, 0.642735f, -0.634393f, -0.429462f, 0.587938f, -0.707107f, -0.392847f, 0.527479f, -0.77301f,
+    -0.35245f, 0.46194f, -0.83147f, -0.308658f, 0.391952f, -0.881921f, -0.261894f, 0.31819f, -0.92388f, -0.212607f,
+    0.241363f, -0.95694f, -0.161273f, 0.162212f, -0.980785f, -0.108386f, 0.081498f, -0.995185f, -0.054455f, 0.086443f,
+    0.995185f, -0.046205f, 0.172054f, 0.980785f, -0.091965f, 0.256008f, 0.95694f, -0.136839f, 0.337497f, 0.92388f,
+    -0.180396f, 0.415735f, 0.881921f, -0.222215f, 0.489969f, 0.83147f, -0.261894f, 0.559485f, 0.77301f, -0.299051f,
+    0.623613f, 0.707107f, -0.333328f, 0.681734f, 0.634393f, -0.364394f, 0.733291f, 0.55557f, -0.391952f, 0.777785f,
+    0.471397f, -0.415735f, 0.814789f, 0.382683f, -0.435514f, 0.843946f, 0.290285f, -0.451099f, 0.864975f, 0.19509f,
+    -0.462339f, 0.877675f, 0.098017f, -0.469127f, 0.881921f, -0.0f, -0.471397f, 0.877675f, -0.098017f, -0.469127f,
+    0.864975f, -0.19509f, -0.462339f, 0.843946f, -0.290285f, -0.451099f, 0.814789f, -0.382683f, -0.435514f, 0.777785f,
+    -0.471397f, -0.415735f, 0.733291f, -0.55557f, -0.391952f, 0.681734f, -0.634393f, -0.364395f, 0.623613f, -0.707107f,
+    -0.333328f, 0.559485f, -0.77301f, -0.299051f, 0.489969f, -0.83147f, -0.261894f, 0.415735f, -0.881921f, -0.222215f,
+    0.337497f, -0.92388f, -0.180396f, 0.256008f, -0.95694f, -0.136839f, 0.172054f, -0.980785f, -0.091965f, 0.086443f,
+    -0.995185f, -0.046205f, 0.090556f, 0.995185f, -0.037509f, 0.18024f, 0.980785f, -0.074658f, 0.268188f, 0.95694f,
+    -0.111087f, 0.353553f, 0.92388f, -0.146447f, 0.435514f, 0.881921f, -0.180396f, 0.51328f, 0.83147f, -0.212608f,
+    0.586103f, 0.77301f, -0.242772f, 0.653282f, 0.707107f, -0.270598f, 0.714168f, 0.634393f, -0.295818f, 0.768178f,
+    0.55557f, -0.31819f, 0.814789f, 0.471397f, -0.337497f, 0.853553f, 0.382683f, -0.353553f, 0.884098f, 0.290285f,
+    -0.366205f, 0.906127f, 0.19509f, -0.37533f, 0.919431f, 0.098017f, -0.380841f, 0.923879f, -0.0f, -0.382683f,
+    0.919431f, -0.098017f, -0.380841f, 0.906127f, -0.19509f, -0.37533f, 0.884098f, -0.290285f, -0.366205f, 0.853553f,
+    -0.382683f, -0.353553f, 0.814789f, -0.471397f, -0.337497f, 0.768178f, -0.55557f, -0.31819f, 0.714168f, -0.634393f,
+    -0.295818f, 0.653282f, -0.707107f, -0.270598f, 0.586103f, -0.77301f, -0.242772f, 0.51328f, -0.83147f, -0.212608f,
+    0.435514f, -0.881921f, -0.180396f, 0.353553f, -0.92388f, -0.146447f, 0.268188f, -0.95694f, -0.111087f, 0.18024f,
+    -0.980785f, -0.074658f, 0.090556f, -0.995185f, -0.037509f, 0.093797f, 0.995185f, -0.028453f, 0.18669f, 0.980785f,
+    -0.056632f, 0.277785f, 0.95694f, -0.084265f, 0.366205f, 0.92388f, -0.111087f, 0.451099f, 0.881921f, -0.136839f,
+    0.531648f, 0.83147f, -0.161274f, 0.607077f, 0.77301f, -0.184155f, 0.676659f, 0.707107f, -0.205262f, 0.739725f,
+    0.634393f, -0.224393f, 0.795667f, 0.55557f, -0.241363f, 0.843946f, 0.471397f, -0.256008f, 0.884098f, 0.382683f,
+    -0.268188f, 0.915735f, 0.290285f, -0.277785f, 0.938553f, 0.19509f, -0.284707f, 0.952332f, 0.098017f, -0.288887f,
+    0.95694f, -0.0f, -0.290285f, 0.952332f, -0.098017f, -0.288887f, 0.938553f, -0.19509f, -0.284707f, 0.915735f,
+    -0.290285f, -0.277785f, 0.884098f, -0.382683f, -0.268188f, 0.843946f, -0.471397f, -0.256008f, 0.795667f, -0.55557f,
+    -0.241363f, 0.739725f, -0.634393f, -0.224393f, 0.676659f, -0.707107f, -0.205262f, 0.607077f, -0.77301f, -0.184155f,
+    0.531648f, -0.83147f, -0.161274f, 0.451099f, -0.881921f, -0.136839f, 0.366205f, -0.92388f, -0.111087f, 0.277785f,
+    -0.95694f, -0.084265f, 0.18669f, -0.980785f, -0.056632f, 0.093797f, -0.995185f, -0.028453f, 0.096134f, 0.995185f,
+    -0.019122f, 0.191342f, 0.980785f, -0.03806f, 0.284707f, 0.95694f, -0.056632f, 0.37533f, 0.92388f, -0.074658f,
+    0.462339f, 0.881921f, -0.091965f, 0.544895f, 0.83147f, -0.108386f, 0.622204f, 0.77301f, -0.123764f, 0.69352f,
+    0.707107f, -0.13795f, 0.758157f, 0.634393f, -0.150807f, 0.815493f, 0.55557f, -0.162212f, 0.864975f, 0.471397f,
+    -0.172054f, 0.906127f, 0.382683f, -0.18024f, 0.938553f, 0.290285f, -0.18669f, 0.96194f, 0.19509f, -0.191342f,
+    0.976063f, 0.098017f, -0.194151f, 0.980785f, -0.0f, -0.19509f, 0.976063f, -0.098017f, -0.194151f, 0.96194f,
+    -0.19509f, -0.191342f, 0.938553f, -0.290285f, -0.18669f, 0.906128f, -0.382683f, -0.18024f, 0.864975f, -0.471397f,
+    -0.172054f, 0.815493f, -0.55557f, -0.162212f, 0.758157f, -0.634393f, -0.150807f, 0.69352f, -0.707107f, -0.13795f,
+    0.622204f, -0.77301f, -0.123764f, 0.544895f, -0.83147f, -0.108386f, 0.462339f, -0.881921f, -0.091965f, 0.37533f,
+    -0.92388f, -0.074658f, 0.284707f, -0.95694f, -0.056632f, 0.191342f, -0.980785f, -0.03806f, 0.096134f, -0.995185f,
+    -0.019122f, 0.097545f, 0.995185f, -0.009607f, 0.194151f, 0.980785f, -0.019122f, 0.288887f, 0.95694f, -0.028453f,
+    0.380841f, 0.92388f, -0.037509f, 0.469127f, 0.881921f, -0.046205f, 0.552895f, 0.83147f, -0.054455f, 0.631338f,
+    0.77301f, -0.062181f, 0.703702f, 0.707107f, -0.069308f, 0.769288f, 0.634393f, -0.075768f, 0.827466f, 0.55557f,
+    -0.081498f, 0.877674f, 0.471397f, -0.086443f, 0.919431f, 0.382683f, -0.090556f, 0.952332f, 0.290285f, -0.093797f,
+    0.976062f, 0.19509f, -0.096134f, 0.990393f, 0.098017f, -0.097545f, 0.995185f, -0.0f, -0.098017f, 0.990393f,
+    -0.098017f, -0.097545f, 0.976062f, -0.19509f, -0.096134f, 0.952332f, -0.290285f, -0.093797f, 0.919431f, -0.382683f,
+    -0.090556f, 0.877674f, -0.471397f, -0.086443f, 0.827466f, -0.55557f, -0.081498f, 0.769288f, -0.634393f, -0.075768f,
+    0.703702f, -0.707107f, -0.069308f, 0.631338f, -0.77301f, -0.062181f, 0.552895f, -0.83147f, -0.054455f, 0.469127f,
+    -0.881921f, -0.046205f, 0.380841f, -0.92388f, -0.037509f, 0.288887f, -0.95694f, -0.028453f, 0.194151f, -0.980785f,
+    -0.019122f, 0.097545f, -0.995185f, -0.009607f, 0.098017f, 0.995185f, 0.0f, 0.19509f, 0.980785f, 0.0f, 0.290285f,
+    0.95694f, 0.0f, 0.382683f, 0.92388f, 0.0f, 0.471397f, 0.881921f, 0.0f, 0.55557f, 0.83147f, 0.0f, 0.634393f,
+    0.77301f, 0.0f, 0.707107f, 0.707107f, 0.0f, 0.77301f, 0.634393f, 0.0f, 0.83147f, 0.55557f, 0.0f, 0.881921f,
+    0.471397f, -0.0f, 0.923879f, 0.382683f, 0.0f, 0.95694f, 0.290285f, -0.0f, 0.980785f, 0.19509f, 0.0f, 0.995185f,
+    0.098017f, 0.0f, 1.0f, -0.0f, 0.0f, 0.995185f, -0.098017f, 0.0f, 0.980785f, -0.19509f, 0.0f, 0.95694f, -0.290285f,
+    0.0f, 0.92388f, -0.382683f, 0.0f, 0.881921f, -0.471397f, 0.0f, 0.83147f, -0.55557f, 0.0f, 0.77301f, -0.634393f,
+    0.0f, 0.707107f, -0.707107f, 0.0f, 0.634393f, -0.77301f, 0.0f, 0.55557f, -0.83147f, 0.0f, 0.471397f, -0.881921f,
+    0.0f, 0.382683f, -0.92388f, 0.0f, 0.290285f, -0.95694f, 0.0f, 0.19509f, -0.980785f, 0.0f, 0.098017f, -0.995185f,
+    0.0f, 0.097545f, 0.995185f, 0.009607f, 0.194151f, 0.980785f, 0.019122f, 0.288887f, 0.95694f, 0.028453f, 0.380841f,
+    0.92388f, 0.03751f, 0.469127f, 0.881921f, 0.046205f, 0.552895f, 0.83147f, 0.054455f, 0.631338f, 0.77301f, 0.062181f,
+    0.703702f, 0.707107f, 0.069309f, 0.769288f, 0.634393f, 0.075768f, 0.827466f, 0.55557f, 0.081498f, 0.877674f,
+    0.471397f, 0.086443f, 0.919431f, 0.382683f, 0.090556f, 0.952332f, 0.290285f, 0.093797f, 0.976062f, 0.19509f,
+    0.096134f, 0.990393f, 0.098017f, 0.097545f, 0.995185f, -0.0f, 0.098017f, 0.990393f, -0.098017f, 0.097545f,
+    0.976062f, -0.19509f, 0.096134f, 0.952332f, -0.290285f, 0.093797f, 0.919431f, -0.382683f, 0.090556f, 0.877674f,
+    -0.471397f, 0.086443f, 0.827466f, -0.55557f, 0.081498f, 0.769288f, -0.634393f, 0.075768f, 0.703702f, -0.707107f,
+    0.069309f, 0.631338f, -0.77301f, 0.062181f, 0.552895f, -0.83147f, 0.054455f, 0.469127f, -0.881921f, 0.046205f,
+    0.380841f, -0.92388f, 0.03751f, 0.288887f, -0.95694f, 0.028453f, 0.194151f, -0.980785f, 0.019122f, 0.097545f,
+    -0.995185f, 0.009607f, 0.096134f, 0.995185f, 0.019122f, 0.191342f, 0.980785f, 0.03806f, 0.284707f, 0.95694f,
+    0.056632f, 0.37533f, 0.92388f, 0.074658f, 0.462339f, 0.881921f, 0.091965f, 0.544895f, 0.83147f, 0.108386f,
+    0.622203f, 0.77301f, 0.123764f, 0.69352f, 0.707107f, 0.13795f, 0.758157f, 0.634393f, 0.150807f, 0.815493f, 0.55557f,
+    0.162212f, 0.864975f, 0.471397f, 0.172054f, 0.906127f, 0.382683f, 0.18024f, 0.938553f, 0.290285f, 0.18669f,
+    0.96194f, 0.19509f, 0.191342f, 0.976062f, 0.098017f, 0.194151f, 0.980785f, -0.0f, 0.19509f, 0.976062f, -0.098017f,
+    0.194151f, 0.96194f, -0.19509f, 0.191342f, 0.938553f, -0.290285f, 0.18669f, 0.906128f, -0.382683f, 0.18024f,
+    0.864975f, -0.471397f, 0.172054f, 0.815493f, -0.55557f, 0.162212f, 0.758157f, -0.634393f, 0.150807f, 0.69352f,
+    -0.707107f, 0.13795f, 0.622203f, -0.77301f, 0.123764f, 0.544895f, -0.83147f, 0.108386f, 0.462339f, -0.881921f,
+    0.091965f, 0.37533f, -0.92388f, 0.074658f, 0.284707f, -0.95694f, 0.056632f, 0.191342f, -0.980785f, 0.03806f,
+    0.096134f, -0.995185f, 0.019122f, 0.093797f, 0.995185f, 0.028453f, 0.18669f, 0.980785f, 0.056632f, 0.277785f,
+    0.95694f, 0.084265f, 0.366205f, 0.92388f, 0.111087f, 0.451098f, 0.881921f, 0.136839f, 0.531648f, 0.83147f,
+    0.161274f, 0.607076f, 0.77301f, 0.184155f, 0.676659f, 0.707107f, 0.205262f, 0.739725f, 0.634393f, 0.224393f,
+    0.795667f, 0.55557f, 0.241363f, 0.843946f, 0.471397f, 0.256008f, 0.884097f, 0.382683f, 0.268188f, 0.915735f,
+    0.290285f, 0.277785f, 0.938553f, 0.19509f, 0.284707f, 0.952332f, 0.098017f, 0.288887f, 0.95694f, -0.0f, 0.290285f,
+    0.952332f, -0.098017f, 0.288887f, 0.938553f, -0.19509f, 0.284707f, 0.915735f, -0.290285f, 0.277785f, 0.884098f,
+    -0.382683f, 0.268188f, 0.843946f, -0.471397f, 0.256008f, 0.795667f, -0.55557f, 0.241363f, 0.739725f, -0.634393f,
+    0.224393f, 0.676659f, -0.707107f, 0.205262f, 0.607076f, -0.77301f, 0.184155f, 0.531648f, -0.83147f, 0.161274f,
+    0.451099f, -0.881921f, 0.136839f, 0.366205f, -0.92388f, 0.111087f, 0.277785f, -0.95694f, 0.084265f, 0.18669f,
+    -0.980785f, 0.056632f, 0.093797f, -0.995185f, 0.028453f, 0.090556f, 0.995185f, 0.03751f, 0.18024f, 0.980785f,
+    0.074658f, 0.268188f, 0.95694f, 0.111087f, 0.353553f, 0.92388f, 0.146447f, 0.435514f, 0.881921f, 0.180396f,
+    0.51328f, 0.83147f, 0.212608f, 0.586103f, 0.77301f, 0.242772f, 0.653281f, 0.707107f, 0.270598f, 0.714168f,
+    0.634393f, 0.295818f, 0.768178f, 0.55557f, 0.31819f, 0.814789f, 0.471397f, 0.337497f, 0.853553f, 0.382683f,
+    0.353553f, 0.884098f, 0.290285f, 0.366205f, 0.906127f, 0.19509f, 0.37533f, 0.919431f, 0.098017f, 0.380841f,
+    0.923879f, -0.0f, 0.382683f, 0.919431f, -0.098017f, 0.380841f, 0.906127f, -0.19509f, 0.37533f, 0.884098f,
+    -0.290285f, 0.366205f, 0.853553f, -0.382683f, 0.353553f, 0.814789f, -0.471397f, 0.337497f, 0.768178f, -0.55557f,
+    0.31819f, 0.714168f, -0.634393f, 0.295818f, 0.653281f, -0.707107f, 0.270598f, 0.586103f, -0.77301f, 0.242772f,
+    0.51328f, -0.83147f, 0.212608f, 0.435514f, -0.881921f, 0.180396f, 0.353553f, -0.92388f, 0.146447f, 0.268188f,
+    -0.95694f, 0.111087f, 0.18024f, -0.980785f, 0.074658f, 0.090556f, -0.995185f, 0.03751f, 0.086443f, 0.995185f,
+    0.046205f, 0.172054f, 0.980785f, 0.091965f, 0.256008f, 0.95694f, 0.136839f, 0.337496f, 0.92388f, 0.180396f,
+    0.415735f, 0.881921f, 0.222215f, 0.489969f, 0.83147f, 0.261894f, 0.559485f, 0.77301f, 0.299051f, 0.623612f,
+    0.707107f, 0.333328f, 0.681734f, 0.634393f, 0.364395f, 0.733291f, 0.55557f, 0.391952f, 0.777785f, 0.471397f,
+    0.415735f, 0.814789f, 0.382683f, 0.435514f, 0.843946f, 0.290285f, 0.451099f, 0.864975f, 0.19509f, 0.462339f,
+    0.877674f, 0.098017f, 0.469127f, 0.881921f, -0.0f, 0.471397f, 0.877674f, -0.098017f, 0.469127f, 0.864975f,
+    -0.19509f, 0.462339f, 0.843946f, -0.290285f, 0.451099f, 0.814789f, -0.382683f, 0.435514f, 0.777785f, -0.471397f,
+    0.415735f, 0.733291f, -0.55557f, 0.391952f, 0.681734f, -0.634393f, 0.364395f, 0.623612f, -0.707107f, 0.333328f,
+    0.559485f, -0.77301f, 0.299051f, 0.489969f, -0.83147f, 0.261894f, 0.415735f, -0.881921f, 0.222215f, 0.337497f,
+    -0.92388f, 0.180396f, 0.256008f, -0.95694f, 0.136839f, 0.172054f, -0.980785f, 0.091965f, 0.086443f, -0.995185f,
+    0.046205f, 0.081498f, 0.995185f, 0.054456f, 0.162212f, 0.980785f, 0.108387f, 0.241363f, 0.95694f, 0.161274f,
+    0.318189f, 0.92388f, 0.212608f, 0.391952f, 0.881921f, 0.261894f, 0.46194f, 0.83147f, 0.308658f, 0.527479f, 0.77301f,
+    0.35245f, 0.587938f, 0.707107f, 0.392848f, 0.642735f, 0.634393f, 0.429462f, 0.691342f, 0.55557f, 0.46194f, 0.73329f,
+    0.471397f, 0.489969f, 0.768178f, 0.382683f, 0.51328f, 0.795667f, 0.290285f, 0.531648f, 0.815493f, 0.19509f,
+    0.544895f, 0.827466f, 0.098017f, 0.552895f, 0.831469f, -0.0f, 0.55557f, 0.827466f, -0.098017f, 0.552895f, 0.815493f,
+    -0.19509f, 0.544895f, 0.795667f, -0.290285f, 0.531648f, 0.768178f, -0.382683f, 0.51328f, 0.73329f, -0.471397f,
+    0.489969f, 0.691342f, -0.55557f, 0.46194f, 0.642735f, -0.634393f, 0.429462f, 0.587938f, -0.707107f, 0.392848f,
+    0.527479f, -0.77301f, 0.35245f, 0.46194f, -0.83147f, 0.308658f, 0.391952f, -0.881921f, 0.261894f, 0.31819f,
+    -0.92388f, 0.212608f, 0.241363f, -0.95694f, 0.161274f, 0.162212f, -0.980785f, 0.108387f, 0.081498f, -0.995185f,
+    0.054456f, 0.075768f, 0.995185f, 0.062182f, 0.150807f, 0.980785f, 0.123764f, 0.224393f, 0.95694f, 0.184155f,
+    0.295818f, 0.92388f, 0.242772f, 0.364394f, 0.881921f, 0.299051f, 0.429462f, 0.83147f, 0.35245f, 0.490393f, 0.77301f,
+    0.402455f, 0.546601f, 0.707107f, 0.448584f, 0.597545f, 0.634393f, 0.490393f, 0.642735f, 0.55557f, 0.527479f,
+    0.681734f, 0.471397f, 0.559485f, 0.714168f, 0.382683f, 0.586103f, 0.739725f, 0.290285f, 0.607077f, 0.758157f,
+    0.19509f, 0.622204f, 0.769288f, 0.098017f, 0.631338f, 0.77301f, -0.0f, 0.634393f, 0.769288f, -0.098017f, 0.631338f,
+    0.758157f, -0.19509f, 0.622204f, 0.739725f, -0.290285f, 0.607077f, 0.714168f, -0.382683f, 0.586103f, 0.681734f,
+    -0.471397f, 0.559485f, 0.642735f, -0.55557f, 0.527479f, 0.597545f, -0.634393f, 0.490393f, 0.546601f, -0.707107f,
+    0.448584f, 0.490393f, -0.77301f, 0.402455f, 0.429462f, -0.83147f, 0.35245f, 0.364395f, -0.881921f, 0.299051f,
+    0.295818f, -0.92388f, 0.242772f, 0.224393f, -0.95694f, 0.184155f, 0.150807f, -0.980785f, 0.123764f, 0.075768f,
+    -0.995185f, 0.062182f, 0.069309f, 0.995185f, 0.069309f, 0.13795f, 0.980785f, 0.13795f, 0.205262f, 0.95694f,
+    0.205262f, 0.270598f, 0.92388f, 0.270598f, 0.333328f, 0.881921f, 0.333328f, 0.392848f, 0.83147f, 0.392848f,
+    0.448584f, 0.77301f, 0.448584f, 0.5f, 0.707107f, 0.5f, 0.546601f, 0.634393f, 0.546601f, 0.587938f, 0.55557f,
+    0.587938f, 0.623612f, 0.471397f, 0.623612f, 0.653281f, 0.382683f, 0.653281f, 0.676659f, 0.290285f, 0.676659f,
+    0.69352f, 0.19509f, 0.69352f, 0.703702f, 0.098017f, 0.703702f, 0.707107f, -0.0f, 0.707107f, 0.703702f, -0.098017f,
+    0.703702f, 0.69352f, -0.19509f, 0.69352f, 0.676659f, -0.290285f, 0.676659f, 0.653281f, -0.382683f, 0.653282f,
+    0.623612f, -0.471397f, 0.623612f, 0.587938f, -0.55557f, 0.587938f, 0.546601f, -0.634393f, 0.546601f, 0.5f,
+    -0.707107f, 0.5f, 0.448584f, -0.77301f, 0.448584f, 0.392848f, -0.83147f, 0.392848f, 0.333328f, -0.881921f,
+    0.333328f, 0.270598f, -0.92388f, 0.270598f, 0.205262f, -0.95694f, 0.205262f, 0.13795f, -0.980785f, 0.13795f,
+    0.069309f, -0.995185f, 0.069309f, 0.062181f, 0.995185f, 0.075768f, 0.123764f, 0.980785f, 0.150807f, 0.184155f,
+    0.95694f, 0.224393f, 0.242772f, 0.92388f, 0.295818f, 0.299051f, 0.881921f, 0.364395f, 0.35245f, 0.83147f, 0.429462f,
+    0.402455f, 0.77301f, 0.490393f, 0.448584f, 0.707107f, 0.546601f, 0.490392f, 0.634393f, 0.597545f, 0.527479f,
+    0.55557f, 0.642735f, 0.559485f, 0.471397f, 0.681734f, 0.586103f, 0.382683f, 0.714168f, 0.607076f, 0.290285f,
+    0.739725f, 0.622203f, 0.19509f, 0.758157f, 0.631338f, 0.098017f, 0.769288f, 0.634393f, -0.0f, 0.77301f, 0.631338f,
+    -0.098017f, 0.769288f, 0.622203f, -0.19509f, 0.758157f, 0.607076f, -0.290285f, 0.739725f, 0.586103f, -0.382683f,
+    0.714169f, 0.559485f, -0.471397f, 0.681734f, 0.527479f, -0.55557f, 0.642735f, 0.490393f, -0.634393f, 0.597545f,
+    0.448584f, -0.707107f, 0.546601f, 0.402455f, -0.77301f, 0.490393f, 0.35245f, -0.83147f, 0.429462f, 0.299051f,
+    -0.881921f, 0.364395f, 0.242772f, -0.92388f, 0.295818f, 0.184155f, -0.95694f, 0.224393f, 0.123764f, -0.980785f,
+    0.150807f, 0.062181f, -0.995185f, 0.075768f, 0.054455f, 0.995185f, 0.081498f, 0.108387f, 0.980785f, 0.162212f,
+    0.161274f, 0.95694f, 0.241363f, 0.212607f, 0.92388f, 0.31819f, 0.261894f, 0.881921f, 0.391952f, 0.308658f, 0.83147f,
+    0.46194f, 0.35245f, 0.77301f, 0.527479f, 0.392847f, 0.707107f, 0.587938f, 0.429461f, 0.634393f, 0.642735f, 0.46194f,
+    0.55557f, 0.691342f, 0.489969f, 0.471397f, 0.73329f, 0.51328f, 0.382683f, 0.768178f, 0.531648f, 0.290285f,
+    0.795667f, 0.544895f, 0.19509f, 0.815493f, 0.552895f, 0.098017f, 0.827466f, 0.55557f, -0.0f, 0.83147f, 0.552895f,
+    -0.098017f, 0.827466f, 0.544895f, -0.19509f, 0.815493f, 0.531647f, -0.290285f, 0.795667f, 0.51328f, -0.382683f,
+    0.768178f, 0.489969f, -0.471397f, 0.733291f, 0.46194f, -0.55557f, 0.691342f, 0.429461f, -0.634393f, 0.642735f,
+    0.392847f, -0.707107f, 0.587938f, 0.35245f, -0.77301f, 0.527479f, 0.308658f, -0.83147f, 0.46194f, 0.261894f,
+    -0.881921f, 0.391952f, 0.212607f, -0.92388f, 0.31819f, 0.161274f, -0.95694f, 0.241363f, 0.108387f, -0.980785f,
+    0.162212f, 0.054455f, -0.995185f, 0.081498f, 0.046205f, 0.995185f, 0.086444f, 0.091965f, 0.980785f, 0.172055f,
+    0.136839f, 0.95694f, 0.256008f, 0.180396f, 0.92388f, 0.337497f, 0.222215f, 0.881921f, 0.415735f, 0.261894f,
+    0.83147f, 0.489969f, 0.299051f, 0.77301f, 0.559485f, 0.333328f, 0.707107f, 0.623613f, 0.364394f, 0.634393f,
+    0.681734f, 0.391952f, 0.55557f, 0.733291f, 0.415735f, 0.471397f, 0.777785f, 0.435514f, 0.382683f, 0.814789f,
+    0.451099f, 0.290285f, 0.843946f, 0.462339f, 0.19509f, 0.864975f, 0.469127f, 0.098017f, 0.877674f, 0.471397f, -0.0f,
+    0.881921f, 0.469127f, -0.098017f, 0.877674f, 0.462339f, -0.19509f, 0.864975f, 0.451098f, -0.290285f, 0.843946f,
+    0.435514f, -0.382683f, 0.814789f, 0.415735f, -0.471397f, 0.777785f, 0.391952f, -0.55557f, 0.733291f, 0.364394f,
+    -0.634393f, 0.681734f, 0.333328f, -0.707107f, 0.623613f, 0.299051f, -0.77301f, 0.559485f, 0.261894f, -0.83147f,
+    0.489969f, 0.222215f, -0.881921f, 0.415735f, 0.180396f, -0.92388f, 0.337497f, 0.136839f, -0.95694f, 0.256008f,
+    0.091965f, -0.980785f, 0.172055f, 0.046205f, -0.995185f, 0.086443f, 0.03751f, 0.995185f, 0.090556f, 0.074658f,
+    0.980785f, 0.18024f, 0.111087f, 0.95694f, 0.268188f, 0.146447f, 0.92388f, 0.353553f, 0.180396f, 0.881921f,
+    0.435514f, 0.212608f, 0.83147f, 0.51328f, 0.242772f, 0.77301f, 0.586103f, 0.270598f, 0.707107f, 0.653282f,
+    0.295818f, 0.634393f, 0.714168f, 0.31819f, 0.55557f, 0.768178f, 0.337497f, 0.471397f, 0.814789f, 0.353553f,
+    0.382683f, 0.853553f, 0.366205f, 0.290285f, 0.884098f, 0.37533f, 0.19509f, 0.906127f, 0.380841f, 0.098017f,
+    0.919431f, 0.382683f, -0.0f, 0.923879f, 0.380841f, -0.098017f, 0.919431f, 0.37533f, -0.19509f, 0.906127f, 0.366205f,
+    -0.290285f, 0.884098f, 0.353553f, -0.382683f, 0.853553f, 0.337497f, -0.471397f, 0.814789f, 0.31819f, -0.55557f,
+    0.768178f, 0.295818f, -0.634393f, 0.714168f, 0.270598f, -0.707107f, 0.653282f, 0.242772f, -0.77301f, 0.586103f,
+    0.212608f, -0.83147f, 0.51328f, 0.180396f, -0.881921f, 0.435514f, 0.146447f, -0.92388f, 0.353553f, 0.111087f,
+    -0.95694f, 0.268188f, 0.074658f, -0.980785f, 0.18024f, 0.03751f, -0.995185f, 0.090556f, 0.028453f, 0.995185f,
+    0.093797f, 0.056632f, 0.980785f, 0.18669f, 0.084265f, 0.95694f, 0.277785f, 0.111087f, 0.92388f, 0.366205f,
+    0.136839f, 0.881921f, 0.451098f, 0.161274f, 0.83147f, 0.531648f, 0.184155f, 0.77301f, 0.607077f, 0.205262f,
+    0.707107f, 0.676659f, 0.224393f, 0.634393f, 0.739725f, 0.241363f, 0.55557f, 0.795667f, 0.256008f, 0.471397f,
+    0.843946f, 0.268188f, 0.382683f, 0.884097f, 0.277785f, 0.290285f, 0.915735f, 0.284707f, 0.19509f, 0.938553f,
+    0.288887f, 0.098017f, 0.952332f, 0.290284f, -0.0f, 0.95694f, 0.288887f, -0.098017f, 0.952332f, 0.284707f, -0.19509f,
+    0.938553f, 0.277785f, -0.290285f, 0.915735f, 0.268188f, -0.382683f, 0.884098f, 0.256008f, -0.471397f, 0.843946f,
+    0.241363f, -0.55557f, 0.795667f, 0.224393f, -0.634393f, 0.739725f, 0.205262f, -0.707107f, 0.676659f, 0.184155f,
+    -0.77301f, 0.607077f, 0.161274f, -0.83147f, 0.531648f, 0.136839f, -0.881921f, 0.451099f, 0.111087f, -0.92388f,
+    0.366205f, 0.084265f, -0.95694f, 0.277785f, 0.056632f, -0.980785f, 0.18669f, 0.028453f, -0.995185f, 0.093797f,
+    0.019122f, 0.995185f, 0.096134f, 0.03806f, 0.980785f, 0.191342f, 0.056632f, 0.95694f, 0.284707f, 0.074658f,
+    0.92388f, 0.37533f, 0.091965f, 0.881921f, 0.462339f, 0.108386f, 0.83147f, 0.544895f, 0.123764f, 0.77301f, 0.622204f,
+    0.13795f, 0.707107f, 0.69352f, 0.150807f, 0.634393f, 0.758157f, 0.162212f, 0.55557f, 0.815493f, 0.172054f,
+    0.471397f, 0.864975f, 0.18024f, 0.382683f, 0.906127f, 0.18669f, 0.290285f, 0.938553f, 0.191342f, 0.19509f, 0.96194f,
+    0.194151f, 0.098017f, 0.976062f, 0.19509f, -0.0f, 0.980785f, 0.194151f, -0.098017f, 0.976062f, 0.191342f, -0.19509f,
+    0.96194f, 0.18669f, -0.290285f, 0.938553f, 0.18024f, -0.382683f, 0.906127f, 0.172054f, -0.471397f, 0.864975f,
+    0.162212f, -0.55557f, 0.815493f, 0.150807f, -0.634393f, 0.758157f, 0.13795f, -0.707107f, 0.69352f, 0.123764f,
+    -0.77301f, 0.622204f, 0.108386f, -0.83147f, 0.544895f, 0.091965f, -0.881921f, 0.462339f, 0.074658f, -0.92388f,
+    0.37533f, 0.056632f, -0.95694f, 0.284707f, 0.03806f, -0.980785f, 0.191342f, 0.019122f, -0.995185f, 0.096134f,
+    0.009607f, 0.995185f, 0.097545f, 0.019122f, 0.980785f, 0.194151f, 0.028453f, 0.95694f, 0.288887f, 0.03751f,
+    0.92388f, 0.380841f, 0.046205f, 0.881921f, 0.469127f, 0.054456f, 0.83147f, 0.552895f, 0.062181f, 0.77301f,
+    0.631338f, 0.069308f, 0.707107f, 0.703702f, 0.075768f, 0.634393f, 0.769288f, 0.081498f, 0.55557f, 0.827466f,
+    0.086443f, 0.471397f, 0.877674f, 0.090556f, 0.382683f, 0.91943f, 0.093797f, 0.290285f, 0.952332f, 0.096134f,
+    0.19509f, 0.976062f, 0.097545f, 0.098017f, 0.990392f, 0.098017f, -0.0f, 0.995185f, 0.097545f, -0.098017f, 0.990392f,
+    0.096134f, -0.19509f, 0.976062f, 0.093796f, -0.290285f, 0.952332f, 0.090556f, -0.382683f, 0.919431f, 0.086443f,
+    -0.471397f, 0.877674f, 0.081498f, -0.55557f, 0.827466f, 0.075768f, -0.634393f, 0.769288f, 0.069308f, -0.707107f,
+    0.703702f, 0.062181f, -0.77301f, 0.631338f, 0.054456f, -0.83147f, 0.552895f, 0.046205f, -0.881921f, 0.469127f,
+    0.03751f, -0.92388f, 0.380841f, 0.028453f, -0.95694f, 0.288887f, 0.019122f, -0.980785f, 0.194151f, 0.009607f,
+    -0.995185f, 0.097545f, 0.0f, 0.995185f, 0.098017f, 0.0f, 0.980785f, 0.195091f, -0.0f, 0.95694f, 0.290285f, 0.0f,
+    0.92388f, 0.382683f, -0.0f, 0.881921f, 0.471397f, 0.0f, 0.83147f, 0.55557f, -0.0f, 0.77301f, 0.634393f, -0.0f,
+    0.707107f, 0.707107f, -0.0f, 0.634393f, 0.77301f, -0.0f, 0.55557f, 0.83147f, 0.0f, 0.471397f, 0.881921f, -0.0f,
+    0.382683f, 0.923879f, 0.0f, 0.290285f, 0.95694f, 0.0f, 0.19509f, 0.980785f, -0.0f, 0.098017f, 0.995184f, -0.0f,
+    -0.0f, 1.0f, -0.0f, -0.098017f, 0.995184f, 0.0f, -0.19509f, 0.980785f, -0.0f, -0.290285f, 0.95694f, -0.0f,
+    -0.382683f, 0.92388f, -0.0f, -0.471397f, 0.881921f, 0.0f, -0.55557f, 0.83147f, 0.0f, -0.634393f, 0.77301f, -0.0f,
+    -0.707107f, 0.707107f, -0.0f, -0.77301f, 0.634393f, 0.0f, -0.83147f, 0.55557f, -0.0f, -0.881921f, 0.471397f, 0.0f,
+    -0.92388f, 0.382683f, -0.0f, -0.95694f, 0.290285f, 0.0f, -0.980785f, 0.195091f, -0.0f, -0.995185f, 0.098017f,
+    -0.009607f, 0.995185f, 0.097545f, -0.019122f, 0.980785f, 0.194151f, -0.028453f, 0.95694f, 0.288887f, -0.03751f,
+    0.92388f, 0.38084f, -0.046205f, 0.881921f, 0.469127f, -0.054455f, 0.83147f, 0.552895f, -0.062181f, 0.77301f,
+    0.631338f, -0.069309f, 0.707107f, 0.703702f, -0.075768f, 0.634393f, 0.769288f, -0.081498f, 0.55557f, 0.827466f,
+    -0.086443f, 0.471397f, 0.877674f, -0.090556f, 0.382683f, 0.91943f, -0.093797f, 0.290285f, 0.952332f, -0.096134f,
+    0.19509f, 0.976062f, -0.097545f, 0.098017f, 0.990392f, -0.098017f, -0.0f, 0.995184f, -0.097545f, -0.098017f,
+    0.990392f, -0.096134f, -0.19509f, 0.976062f, -0.093797f, -0.290285f, 0.952332f, -0.090556f, -0.382683f, 0.919431f,
+    -0.086443f, -0.471397f, 0.877674f, -0.081498f, -0.55557f, 0.827466f, -0.075768f, -0.634393f, 0.769288f, -0.069309f,
+    -0.707107f, 0.703702f, -0.062181f, -0.77301f, 0.631338f, -0.054455f, -0.83147f, 0.552895f, -0.046205f, -0.881921f,
+    0.469127f, -0.037509f, -0.92388f, 0.38084f, -0.028453f, -0.95694f, 0.288887f, -0.019122f, -0.980785f, 0.194151f,
+    -0.009607f, -0.995185f, 0.097545f, -0.019122f, 0.995185f, 0.096134f, -0.03806f, 0.980785f, 0.191342f, -0.056632f,
+    0.95694f, 0.284707f, -0.074658f, 0.92388f, 0.37533f, -0.091965f, 0.881921f, 0.462339f, -0.108386f, 0.83147f,
+    0.544895f, -0.123764f, 0.77301f, 0.622203f, -0.13795f, 0.707107f, 0.69352f, -0.150807f, 0.634393f, 0.758157f,
+    -0.162212f, 0.55557f, 0.815493f, -0.172054f, 0.471397f, 0.864975f, -0.18024f, 0.382683f, 0.906127f, -0.18669f,
+    0.290285f, 0.938553f, -0.191342f, 0.19509f, 0.96194f, -0.194151f, 0.098017f, 0.976062f, -0.19509f, -0.0f, 0.980785f,
+    -0.194151f, -0.098017f, 0.976062f, -0.191342f, -0.19509f, 0.96194f, -0.18669f, -0.290285f, 0.938553f, -0.18024f,
+    -0.382683f, 0.906127f, -0.172054f, -0.471397f, 0.864975f, -0.162212f, -0.55557f, 0.815493f, -0.150807f, -0.634393f,
+    0.758157f, -0.13795f, -0.707107f, 0.69352f, -0.123764f, -0.77301f, 0.622203f, -0.108386f, -0.83147f, 0.544895f,
+    -0.091965f, -0.881921f, 0.462339f, -0.074658f, -0.92388f, 0.37533f, -0.056632f, -0.95694f, 0.284707f, -0.03806f,
+    -0.980785f, 0.191342f, -0.019122f, -0.995185f, 0.096134f, -0.028453f, 0.995185f, 0.093797f, -0.056632f, 0.980785f,
+    0.18669f, -0.084265f, 0.95694f, 0.277785f, -0.111087f, 0.92388f, 0.366205f, -0.136839f, 0.881921f, 0.451098f,
+    -0.161273f, 0.83147f, 0.531648f, -0.184155f, 0.77301f, 0.607076f, -0.205262f, 0.707107f, 0.676659f, -0.224393f,
+    0.634393f, 0.739725f, -0.241363f, 0.55557f, 0.795667f, -0.256008f, 0.471397f, 0.843946f, -0.268188f, 0.382683f,
+    0.884097f, -0.277785f, 0.290285f, 0.915735f, -0.284707f, 0.19509f, 0.938553f, -0.288887f, 0.098017f, 0.952332f,
+    -0.290285f, -0.0f, 0.95694f, -0.288887f, -0.098017f, 0.952332f, -0.284707f, -0.19509f, 0.938553f, -0.277785f,
+    -0.290285f, 0.915735f, -0.268188f, -0.382683f, 0.884098f, -0.256008f, -0.471397f, 0.843946f, -0.241363f, -0.55557f,
+    0.795667f, -0.224393f, -0.634393f, 0.739725f, -0.205262f, -0.707107f, 0.676659f, -0.184155f, -0.77301f, 0.607076f,
+    -0.161273f, -0.83147f, 0.531648f, -0.136839f, -0.881921f, 0.451099f, -0.111087f, -0.92388f, 0.366205f, -0.084265f,
+    -0.95694f, 0.277785f, -0.056632f, -0.980785f, 0.18669f, -0.028453f, -0.995185f, 0.093797f, -0.03751f, 0.995185f,
+    0.090556f, -0.074658f, 0.980785f, 0.18024f, -0.111087f, 0.95694f, 0.268188f, -0.146446f, 0.92388f, 0.353553f,
+    -0.180396f, 0.881921f, 0.435514f, -0.212607f, 0.83147f, 0.51328f, -0.242772f, 0.77301f, 0.586103f, -0.270598f,
+    0.707107f, 0.653282f, -0.295818f, 0.634393f, 0.714168f, -0.31819f, 0.55557f, 0.768178f, -0.337496f, 0.471397f,
+    0.814789f, -0.353553f, 0.382683f, 0.853553f, -0.366205f, 0.290285f, 0.884098f, -0.37533f, 0.19509f, 0.906127f,
+    -0.380841f, 0.098017f, 0.919431f, -0.382683f, -0.0f, 0.923879f, -0.380841f, -0.098017f, 0.919431f, -0.37533f,
+    -0.19509f, 0.906127f, -0.366205f, -0.290285f, 0.884098f, -0.353553f, -0.382683f, 0.853553f, -0.337497f, -0.471397f,
+    0.814789f, -0.31819f, -0.55557f, 0.768178f, -0.295818f, -0.634393f, 0.714168f, -0.270598f, -0.707107f, 0.653282f,
+    -0.242772f, -0.77301f, 0.586103f, -0.212607f, -0.83147f, 0.51328f, -0.180396f, -0.881921f, 0.435514f, -0.146446f,
+    -0.92388f, 0.353553f, -0.111087f, -0.95694f, 0.268188f, -0.074658f, -0.980785f, 0.18024f, -0.03751f, -0.995185f,
+    0.090556f, 0.0f, -1.0f, 0.0f, -0.046205f, 0.995185f, 0.086444f, -0.091965f, 0.980785f, 0.172055f, -0.136839f,
+    0.95694f, 0.256008f, -0.180396f, 0.92388f, 0.337496f, -0.222215f, 0.881921f, 0.415735f, -0.261894f, 0.83147f,
+    0.489969f, -0.299051f, 0.77301f, 0.559485f, -0.333328f, 0.707107f, 0.623613f, -0.364394f, 0.634393f, 0.681734f,
+    -0.391952f, 0.55557f, 0.733291f, -0.415735f, 0.471397f, 0.777785f, -0.435514f, 0.382683f, 0.814789f, -0.451099f,
+    0.290285f, 0.843946f, -0.462339f, 0.19509f, 0.864975f, -0.469127f, 0.098017f, 0.877674f, -0.471397f, -0.0f,
+    0.881921f, -0.469127f, -0.098017f, 0.877674f, -0.462339f, -0.19509f, 0.864975f, -0.451099f, -0.290285f, 0.843946f,
+    -0.435514f, -0.382683f, 0.814789f, -0.415735f, -0.471397f, 0.777785f, -0.391952f, -0.55557f, 0.733291f, -0.364394f,
+    -0.634393f, 0.681734f, -0.333328f, -0.707107f, 0.623613f, -0.299051f, -0.77301f, 0.559485f, -0.261894f, -0.83147f,
+    0.489969f, -0.222215f, -0.881921f, 0.415735f, -0.180396f, -0.92388f, 0.337496f, -0.136839f, -0.95694f, 0.256008f,
+    -0.091965f, -0.980785f, 0.172055f, -0.046205f, -0.995185f, 0.086443f, -0.054455f, 0.995185f, 0.081498f, -0.108386f,
+    0.980785f, 0.162212f, -0.161274f, 0.95694f, 0.241363f, -0.212607f, 0.92388f, 0.318189f, -0.261894f, 0.881921f,
+    0.391952f, -0.308658f, 0.83147f, 0.46194f, -0.35245f, 0.77301f, 0.527479f, -0.392848f, 0.707107f, 0.587938f,
+    -0.429461f, 0.634393f, 0.642734f, -0.46194f, 0.55557f, 0.691342f, -0.489969f, 0.471397f, 0.73329f, -0.51328f,
+    0.382683f, 0.768177f, -0.531648f, 0.290285f, 0.795667f, -0.544895f, 0.19509f, 0.815493f, -0.552895f, 0.098017f,
+    0.827466f, -0.55557f, -0.0f, 0.831469f, -0.552895f, -0.098017f, 0.827466f, -0.544895f, -0.19509f, 0.815493f,
+    -0.531648f, -0.290285f, 0.795667f, -0.51328f, -0.382683f, 0.768178f, -0.489969f, -0.471397f, 0.73329f, -0.46194f,
+    -0.55557f, 0.691342f, -0.429461f, -0.634393f, 0.642735f, -0.392848f, -0.707107f, 0.587938f, -0.35245f, -0.77301f,
+    0.527479f, -0.308658f, -0.83147f, 0.46194f, -0.261894f, -0.881921f, 0.391952f, -0.212607f, -0.92388f, 0.318189f,
+    -0.161274f, -0.95694f, 0.241363f, -0.108386f, -0.980785f, 0.162212f, -0.054455f, -0.995185f, 0.081498f, -0.062181f,
+    0.995185f, 0.075768f, -0.123764f, 0.980785f, 0.150807f, -0.184155f, 0.95694f, 0.224393f, -0.242772f, 0.92388f,
+    0.295818f, -0.299051f, 0.881921f, 0.364395f, -0.35245f, 0.83147f, 0.429462f, -0.402455f, 0.77301f, 0.490393f,
+    -0.448584f, 0.707107f, 0.546601f, -0.490392f, 0.634393f, 0.597545f, -0.527479f, 0.55557f, 0.642735f, -0.559485f,
+    0.471397f, 0.681734f, -0.586103f, 0.382683f, 0.714168f, -0.607076f, 0.290285f, 0.739725f, -0.622203f, 0.19509f,
+    0.758157f, -0.631338f, 0.098017f, 0.769288f, -0.634393f, -0.0f, 0.77301f, -0.631338f, -0.098017f, 0.769288f,
+    -0.622203f, -0.19509f, 0.758157f, -0.607077f, -0.290285f, 0.739725f, -0.586103f, -0.382683f, 0.714168f, -0.559485f,
+    -0.471397f, 0.681734f, -0.527479f, -0.55557f, 0.642735f, -0.490392f, -0.634393f, 0.597545f, -0.448584f, -0.707107f,
+    0.546601f, -0.402455f, -0.77301f, 0.490393f, -0.35245f, -0.83147f, 0.429462f, -0.299051f, -0.881921f, 0.364395f,
+    -0.242772f, -0.92388f, 0.295818f, -0.184155f, -0.95694f, 0.224393f, -0.123764f, -0.980785f, 0.150807f, -0.062181f,
+    -0.995185f, 0.075768f, -0.069309f, 0.995185f, 0.069309f, -0.13795f, 0.980785f, 0.13795f, -0.205262f, 0.95694f,
+    0.205262f, -0.270598f, 0.92388f, 0.270598f, -0.333328f, 0.881921f, 0.333328f, -0.392848f, 0.83147f, 0.392848f,
+    -0.448584f, 0.77301f, 0.448584f, -0.5f, 0.707107f, 0.5f, -0.546601f, 0.634393f, 0.546601f, -0.587938f, 0.55557f,
+    0.587938f, -0.623612f, 0.471397f, 0.623612f, -0.653281f, 0.382683f, 0.653281f, -0.676659f, 0.290285f, 0.676659f,
+    -0.69352f, 0.19509f, 0.69352f, -0.703702f, 0.098017f, 0.703702f, -0.707107f, -0.0f, 0.707106f, -0.703702f,
+    -0.098017f, 0.703702f, -0.69352f, -0.19509f, 0.69352f, -0.676659f, -0.290285f, 0.676659f, -0.653282f, -0.382683f,
+    0.653281f, -0.623612f, -0.471397f, 0.623612f, -0.587938f, -0.55557f, 0.587938f, -0.546601f, -0.634393f, 0.546601f,
+    -0.5f, -0.707107f, 0.5f, -0.448584f, -0.77301f, 0.448584f, -0.392848f, -0.83147f, 0.392848f, -0.333328f, -0.881921f,
+    0.333328f, -0.270598f, -0.92388f, 0.270598f, -0.205262f, -0.95694f, 0.205262f, -0.13795f, -0.980785f, 0.13795f,
+    -0.069309f, -0.995185f, 0.069309f, -0.075768f, 0.995185f, 0.062182f, -0.150807f, 0.980785f, 0.123764f, -0.224393f,
+    0.95694f, 0.184155f, -0.295818f, 0.92388f, 0.242772f, -0.364394f, 0.881921f, 0.299051f, -0.429462f, 0.83147f,
+    0.35245f, -0.490393f, 0.77301f, 0.402455f, -0.546601f, 0.707107f, 0.448584f, -0.597545f, 0.634393f, 0.490392f,
+    -0.642735f, 0.55557f, 0.527479f, -0.681734f, 0.471397f, 0.559485f, -0.714168f, 0.382683f, 0.586103f, -0.739725f,
+    0.290285f, 0.607076f, -0.758157f, 0.19509f, 0.622204f, -0.769288f, 0.098017f, 0.631338f, -0.77301f, -0.0f,
+    0.634393f, -0.769288f, -0.098017f, 0.631338f, -0.758157f, -0.19509f, 0.622204f, -0.739725f, -0.290285f, 0.607076f,
+    -0.714169f, -0.382683f, 0.586103f, -0.681734f, -0.471397f, 0.559485f, -0.642735f, -0.55557f, 0.527479f, -0.597545f,
+    -0.634393f, 0.490393f, -0.546601f, -0.707107f, 0.448584f, -0.490393f, -0.77301f, 0.402455f, -0.429462f, -0.83147f,
+    0.35245f, -0.364395f, -0.881921f, 0.299051f, -0.295818f, -0.92388f, 0.242772f, -0.224393f, -0.95694f, 0.184155f,
+    -0.150807f, -0.980785f, 0.123764f, -0.075768f, -0.995185f, 0.062182f, -0.081498f, 0.995185f, 0.054456f, -0.162212f,
+    0.980785f, 0.108387f, -0.241363f, 0.95694f, 0.161274f, -0.318189f, 0.92388f, 0.212607f, -0.391952f, 0.881921f,
+    0.261894f, -0.46194f, 0.83147f, 0.308659f, -0.527479f, 0.77301f, 0.35245f, -0.587938f, 0.707107f, 0.392847f,
+    -0.642734f, 0.634393f, 0.429461f, -0.691342f, 0.55557f, 0.46194f, -0.73329f, 0.471397f, 0.489969f, -0.768177f,
+    0.382683f, 0.51328f, -0.795667f, 0.290285f, 0.531647f, -0.815493f, 0.19509f, 0.544895f, -0.827466f, 0.098017f,
+    0.552895f, -0.831469f, -0.0f, 0.55557f, -0.827466f, -0.098017f, 0.552895f, -0.815493f, -0.19509f, 0.544895f,
+    -0.795667f, -0.290285f, 0.531647f, -0.768178f, -0.382683f, 0.51328f, -0.73329f, -0.471397f, 0.489969f, -0.691342f,
+    -0.55557f, 0.46194f, -0.642734f, -0.634393f, 0.429461f, -0.587938f, -0.707107f, 0.392847f, -0.527479f, -0.77301f,
+    0.35245f, -0.46194f, -0.83147f, 0.308659f, -0.391952f, -0.881921f, 0.261894f, -0.318189f, -0.92388f, 0.212607f,
+    -0.241363f, -0.95694f, 0.161274f, -0.162212f, -0.980785f, 0.108387f, -0.081498f, -0.995185f, 0.054455f, -0.086443f,
+    0.995185f, 0.046205f, -0.172054f, 0.980785f, 0.091965f, -0.256008f, 0.95694f, 0.136839f, -0.337496f, 0.92388f,
+    0.180396f, -0.415735f, 0.881921f, 0.222215f, -0.489969f, 0.83147f, 0.261894f, -0.559485f, 0.77301f, 0.299051f,
+    -0.623613f, 0.707107f, 0.333328f, -0.681734f, 0.634393f, 0.364394f, -0.733291f, 0.55557f, 0.391952f, -0.777785f,
+    0.471397f, 0.415735f, -0.814789f, 0.382683f, 0.435514f, -0.843946f, 0.290285f, 0.451098f, -0.864975f, 0.19509f,
+    0.462339f, -0.877674f, 0.098017f, 0.469127f, -0.881921f, -0.0f, 0.471396f, -0.877674f, -0.098017f, 0.469127f,
+    -0.864975f, -0.19509f, 0.462339f, -0.843946f, -0.290285f, 0.451098f, -0.814789f, -0.382683f, 0.435514f, -0.777785f,
+    -0.471397f, 0.415735f, -0.733291f, -0.55557f, 0.391952f, -0.681734f, -0.634393f, 0.364395f, -0.623613f, -0.707107f,
+    0.333328f, -0.559485f, -0.77301f, 0.299051f, -0.489969f, -0.83147f, 0.261894f, -0.415735f, -0.881921f, 0.222215f,
+    -0.337496f, -0.92388f, 0.180396f, -0.256008f, -0.95694f, 0.136839f, -0.172054f, -0.980785f, 0.091965f, -0.086443f,
+    -0.995185f, 0.046205f, -0.090556f, 0.995185f, 0.03751f, -0.18024f, 0.980785f, 0.074658f, -0.268188f, 0.95694f,
+    0.111087f, -0.353553f, 0.92388f, 0.146447f, -0.435514f, 0.881921f, 0.180396f, -0.51328f, 0.83147f, 0.212608f,
+    -0.586103f, 0.77301f, 0.242772f, -0.653282f, 0.707107f, 0.270598f, -0.714168f, 0.634393f, 0.295818f, -0.768178f,
+    0.55557f, 0.31819f, -0.814789f, 0.471397f, 0.337497f, -0.853553f, 0.382683f, 0.353553f, -0.884097f, 0.290285f,
+    0.366205f, -0.906127f, 0.19509f, 0.37533f, -0.919431f, 0.098017f, 0.380841f, -0.923879f, -0.0f, 0.382683f,
+    -0.919431f, -0.098017f, 0.380841f, -0.906127f, -0.19509f, 0.37533f, -0.884098f, -0.290285f, 0.366205f, -0.853553f,
+    -0.382683f, 0.353553f, -0.814789f, -0.471397f, 0.337497f, -0.768178f, -0.55557f, 0.31819f, -0.714168f, -0.634393f,
+    0.295818f, -0.653282f, -0.707107f, 0.270598f, -0.586103f, -0.77301f, 0.242772f, -0.51328f, -0.83147f, 0.212608f,
+    -0.435514f, -0.881921f, 0.180396f, -0.353553f, -0.92388f, 0.146447f, -0.268188f, -0.95694f, 0.111087f, -0.18024f,
+    -0.980785f, 0.074658f, -0.090556f, -0.995185f, 0.03751f, -0.093797f, 0.995185f, 0.028453f, -0.18669f, 0.980785f,
+    0.056632f, -0.277785f, 0.95694f, 0.084265f, -0.366205f, 0.92388f, 0.111087f, -0.451098f, 0.881921f, 0.136839f,
+    -0.531648f, 0.83147f, 0.161274f, -0.607076f, 0.77301f, 0.184155f, -0.676659f, 0.707107f, 0.205262f, -0.739725f,
+    0.634393f, 0.224393f, -0.795667f, 0.55557f, 0.241363f, -0.843946f, 0.471397f, 0.256008f, -0.884097f, 0.382683f,
+    0.268188f, -0.915735f, 0.290285f, 0.277785f, -0.938553f, 0.19509f, 0.284707f, -0.952332f, 0.098017f, 0.288887f,
+    -0.95694f, -0.0f, 0.290284f, -0.952332f, -0.098017f, 0.288887f, -0.938553f, -0.19509f, 0.284707f, -0.915735f,
+    -0.290285f, 0.277785f, -0.884097f, -0.382683f, 0.268188f, -0.843946f, -0.471397f, 0.256008f, -0.795667f, -0.55557f,
+    0.241363f, -0.739725f, -0.634393f, 0.224393f, -0.676659f, -0.707107f, 0.205262f, -0.607076f, -0.77301f, 0.184155f,
+    -0.531648f, -0.83147f, 0.161274f, -0.451099f, -0.881921f, 0.136839f, -0.366205f, -0.92388f, 0.111087f, -0.277785f,
+    -0.95694f, 0.084265f, -0.18669f, -0.980785f, 0.056632f, -0.093797f, -0.995185f, 0.028453f, -0.096134f, 0.995185f,
+    0.019122f, -0.191342f, 0.980785f, 0.03806f, -0.284707f, 0.95694f, 0.056632f, -0.37533f, 0.92388f, 0.074658f,
+    -0.462339f, 0.881921f, 0.091965f, -0.544895f, 0.83147f, 0.108387f, -0.622204f, 0.77301f, 0.123764f, -0.69352f,
+    0.707107f, 0.13795f, -0.758157f, 0.634393f, 0.150807f, -0.815493f, 0.55557f, 0.162212f, -0.864975f, 0.471397f,
+    0.172054f, -0.906127f, 0.382683f, 0.18024f, -0.938553f, 0.290285f, 0.18669f, -0.96194f, 0.19509f, 0.191342f,
+    -0.976062f, 0.098017f, 0.194151f, -0.980785f, -0.0f, 0.19509f, -0.976062f, -0.098017f, 0.194151f, -0.96194f,
+    -0.19509f, 0.191342f, -0.938553f, -0.290285f, 0.18669f, -0.906127f, -0.382683f, 0.18024f, -0.864975f, -0.471397f,
+    0.172054f, -0.815493f, -0.55557f, 0.162212f, -0.758157f, -0.634393f, 0.150807f, -0.69352f, -0.707107f, 0.13795f,
+    -0.622204f, -0.77301f, 0.123764f, -0.544895f, -0.83147f, 0.108387f, -0.462339f, -0.881921f, 0.091965f, -0.37533f,
+    -0.92388f, 0.074658f, -0.284707f, -0.95694f, 0.056632f, -0.191342f, -0.980785f, 0.03806f, -0.096134f, -0.995185f,
+    0.019122f, -0.0f, 1.0f, 0.0f, -0.097545f, 0.995185f, 0.009607f, -0.194151f, 0.980785f, 0.019122f, -0.288887f,
+    0.95694f, 0.028453f, -0.38084f, 0.92388f, 0.03751f, -0.469127f, 0.881921f, 0.046205f, -0.552895f, 0.83147f,
+    0.054456f, -0.631338f, 0.77301f, 0.062181f, -0.703702f, 0.707107f, 0.069308f, -0.769288f, 0.634393f, 0.075768f,
+    -0.827466f, 0.55557f, 0.081498f, -0.877674f, 0.471397f, 0.086443f, -0.91943f, 0.382683f, 0.090556f, -0.952332f,
+    0.290285f, 0.093796f, -0.976062f, 0.19509f, 0.096134f, -0.990392f, 0.098017f, 0.097545f, -0.995184f, -0.0f,
+    0.098017f, -0.990392f, -0.098017f, 0.097545f, -0.976062f, -0.19509f, 0.096134f, -0.952332f, -0.290285f, 0.093796f,
+    -0.919431f, -0.382683f, 0.090556f, -0.877674f, -0.471397f, 0.086443f, -0.827466f, -0.55557f, 0.081498f, -0.769288f,
+    -0.634393f, 0.075768f, -0.703702f, -0.707107f, 0.069308f, -0.631338f, -0.77301f, 0.062181f, -0.552895f, -0.83147f,
+    0.054456f, -0.469127f, -0.881921f, 0.046205f, -0.38084f, -0.92388f, 0.03751f, -0.288887f, -0.95694f, 0.028453f,
+    -0.194151f, -0.980785f, 0.019122f, -0.097545f, -0.995185f, 0.009607f, -0.098017f, 0.995185f, 0.0f, -0.19509f,
+    0.980785f, 0.0f, -0.290285f, 0.95694f, 0.0f, -0.382683f, 0.92388f, 0.0f, -0.471397f, 0.881921f, 0.0f, -0.55557f,
+    0.83147f, 0.0f, -0.634393f, 0.77301f, -0.0f, -0.707107f, 0.707107f, -0.0f, -0.77301f, 0.634393f, -0.0f, -0.83147f,
+    0.55557f, 0.0f, -0.881921f, 0.471397f, 0.0f, -0.923879f, 0.382683f, 0.0f, -0.95694f, 0.290285f, -0.0f, -0.980785f,
+    0.19509f, 0.0f, -0.995184f, 0.098017f, -0.0f, -1.0f, -0.0f, -0.0f, -0.995184f, -0.098017f, -0.0f, -0.980785f,
+    -0.19509f, 0.0f, -0.95694f, -0.290285f, -0.0f, -0.923879f, -0.382683f, -0.0f, -0.881921f, -0.471397f, -0.0f,
+    -0.83147f, -0.55557f, 0.0f, -0.77301f, -0.634393f, 0.0f, -0.707107f, -0.707107f, -0.0f, -0.634393f, -0.77301f,
+    -0.0f, -0.55557f, -0.83147f, 0.0f, -0.471397f, -0.881921f, 0.0f, -0.382683f, -0.92388f, 0.0f, -0.290285f, -0.95694f,
+    0.0f, -0.19509f, -0.980785f, 0.0f, -0.098017f, -0.995185f, 0.0f, -0.097545f, 0.995185f, -0.009607f, -0.194151f,
+    0.980785f, -0.019122f, -0.288887f, 0.95694f, -0.028453f, -0.38084f, 0.92388f, -0.037509f, -0.469127f, 0.881921f,
+    -0.046205f, -0.552895f, 0.83147f, -0.054455f, -0.631338f, 0.77301f, -0.062181f, -0.703702f, 0.707107f, -0.069309f,
+    -0.769288f, 0.634393f, -0.075768f, -0.827466f, 0.55557f, -0.081498f, -0.877674f, 0.471397f, -0.086443f, -0.91943f,
+    0.382683f, -0.090556f, -0.952332f, 0.290285f, -0.093797f, -0.976062f, 0.19509f, -0.096134f, -0.990392f, 0.098017f,
+    -0.097545f, -0.995184f, -0.0f, -0.098017f, -0.990392f, -0.098017f, -0.097545f, -0.976062f, -0.19509f, -0.096134f,
+    -0.952332f, -0.290285f, -0.093797f, -0.919431f, -0.382683f, -0.090556f, -0.877674f, -0.471397f, -0.086443f,
+    -0.827466f, -0.55557f, -0.081498f, -0.769288f, -0.634393f, -0.075768f, -0.703702f, -0.707107f, -0.069309f,
+    -0.631338f, -0.77301f, -0.062181f, -0.552895f, -0.83147f, -0.054455f, -0.469127f, -0.881921f, -0.046205f, -0.38084f,
+    -0.92388f, -0.037509f, -0.288887f, -0.95694f, -0.028453f, -0.194151f, -0.980785f, -0.019122f, -0.097545f,
+    -0.995185f, -0.009607f, -0.096134f, 0.995185f, -0.019122f, -0.191342f, 0.980785f, -0.03806f, -0.284707f, 0.95694f,
+    -0.056632f, -0.37533f, 0.92388f, -0.074658f, -0.462339f, 0.881921f, -0.091965f, -0.544895f, 0.83147f, -0.108386f,
+    -0.622203f, 0.77301f, -0.123764f, -0.69352f, 0.707107f, -0.13795f, -0.758157f, 0.634393f, -0.150807f, -0.815493f,
+    0.55557f, -0.162212f, -0.864975f, 0.471397f, -0.172054f, -0.906127f, 0.382683f, -0.18024f, -0.938553f, 0.290285f,
+    -0.18669f, -0.96194f, 0.19509f, -0.191342f, -0.976062f, 0.098017f, -0.194151f, -0.980785f, -0.0f, -0.195091f,
+    -0.976062f, -0.098017f, -0.194151f, -0.96194f, -0.19509f, -0.191342f, -0.938553f, -0.290285f, -0.18669f, -0.906127f,
+    -0.382683f, -0.18024f, -0.864975f, -0.471397f, -0.172054f, -0.815493f, -0.55557f, -0.162212f, -0.758157f,
+    -0.634393f, -0.150807f, -0.69352f, -0.707107f, -0.13795f, -0.622203f, -0.77301f, -0.123764f, -0.544895f, -0.83147f,
+    -0.108386f, -0.462339f, -0.881921f, -0.091965f, -0.37533f, -0.92388f, -0.074658f, -0.284707f, -0.95694f, -0.056632f,
+    -0.191342f, -0.980785f, -0.03806f, -0.096134f, -0.995185f, -0.019122f, -0.093797f, 0.995185f, -0.028453f, -0.18669f,
+    0.980785f, -0.056632f, -0.277785f, 0.95694f, -0.084265f, -0.366205f, 0.92388f, -0.111087f, -0.451098f, 0.881921f,
+    -0.136839f, -0.531648f, 0.83147f, -0.161273f, -0.607076f, 0.77301f, -0.184155f, -0.676659f, 0.707107f, -0.205262f,
+    -0.739725f, 0.634393f, -0.224393f, -0.795667f, 0.55557f, -0.241363f, -0.843946f, 0.471397f, -0.256008f, -0.884097f,
+    0.382683f, -0.268188f, -0.915735f, 0.290285f, -0.277785f, -0.938553f, 0.19509f, -0.284707f, -0.952332f, 0.098017f,
+    -0.288887f, -0.95694f, -0.0f, -0.290285f, -0.952332f, -0.098017f, -0.288887f, -0.938553f, -0.19509f, -0.284707f,
+    -0.915735f, -0.290285f, -0.277785f, -0.884097f, -0.382683f, -0.268188f, -0.843946f, -0.471397f, -0.256008f,
+    -0.795667f, -0.55557f, -0.241363f, -0.739725f, -0.634393f, -0.224393f, -0.676659f, -0.707107f, -0.205262f,
+    -0.607076f, -0.77301f, -0.184155f, -0.531648f, -0.83147f, -0.161273f, -0.451099f, -0.881921f, -0.136839f,
+    -0.366205f, -0.92388f, -0.111087f, -0.277785f, -0.95694f, -0.084265f, -0.18669f, -0.980785f, -0.056632f, -0.093797f,
+    -0.995185f, -0.028453f, -0.090556f, 0.995185f, -0.037509f, -0.18024f, 0.980785f, -0.074658f, -0.268188f, 0.95694f,
+    -0.111087f, -0.353553f, 0.92388f, -0.146446f, -0.435514f, 0.881921f, -0.180396f, -0.51328f, 0.83147f, -0.212607f,
+    -0.586103f, 0.77301f, -0.242772f, -0.653282f, 0.707107f, -0.270598f, -0.714168f, 0.634393f, -0.295818f, -0.768178f,
+    0.55557f, -0.31819f, -0.814788f, 0.471397f, -0.337496f, -0.853553f, 0.382683f, -0.353553f, -0.884097f, 0.290285f,
+    -0.366205f, -0.906127f, 0.19509f, -0.37533f, -0.91943f, 0.098017f, -0.380841f, -0.923879f, -0.0f, -0.382684f,
+    -0.91943f, -0.098017f, -0.380841f, -0.906127f, -0.19509f, -0.37533f, -0.884098f, -0.290285f, -0.366205f, -0.853553f,
+    -0.382683f, -0.353553f, -0.814789f, -0.471397f, -0.337497f, -0.768178f, -0.55557f, -0.31819f, -0.714168f,
+    -0.634393f, -0.295818f, -0.653282f, -0.707107f, -0.270598f, -0.586103f, -0.77301f, -0.242772f, -0.51328f, -0.83147f,
+    -0.212607f, -0.435514f, -0.881921f, -0.180396f, -0.353553f, -0.92388f, -0.146446f, -0.268188f, -0.95694f,
+    -0.111087f, -0.18024f, -0.980785f, -0.074658f, -0.090556f, -0.995185f, -0.037509f, -0.086443f, 0.995185f,
+    -0.046205f, -0.172054f, 0.980785f, -0.091965f, -0.256008f, 0.95694f, -0.136839f, -0.337496f, 0.92388f, -0.180395f,
+    -0.415735f, 0.881921f, -0.222215f, -0.48997f, 0.83147f, -0.261894f, -0.559485f, 0.77301f, -0.299051f, -0.623613f,
+    0.707107f, -0.333328f, -0.681734f, 0.634393f, -0.364394f, -0.733291f, 0.55557f, -0.391952f, -0.777785f, 0.471397f,
+    -0.415735f, -0.814789f, 0.382683f, -0.435513f, -0.843946f, 0.290285f, -0.451099f, -0.864975f, 0.19509f, -0.462339f,
+    -0.877674f, 0.098017f, -0.469127f, -0.881921f, -0.0f, -0.471397f, -0.877674f, -0.098017f, -0.469127f, -0.864975f,
+    -0.19509f, -0.462339f, -0.843946f, -0.290285f, -0.451099f, -0.814789f, -0.382683f, -0.435514f, -0.777785f,
+    -0.471397f, -0.415735f, -0.733291f, -0.55557f, -0.391952f, -0.681734f, -0.634393f, -0.364394f, -0.623613f,
+    -0.707107f, -0.333328f, -0.559485f, -0.77301f, -0.299051f, -0.48997f, -0.83147f, -0.261894f, -0.415735f, -0.881921f,
+    -0.222215f, -0.337496f, -0.92388f, -0.180395f, -0.256008f, -0.95694f, -0.136839f, -0.172054f, -0.980785f,
+    -0.091965f, -0.086443f, -0.995185f, -0.046205f, -0.081498f, 0.995185f, -0.054455f, -0.162212f, 0.980785f,
+    -0.108386f, -0.241363f, 0.95694f, -0.161274f, -0.318189f, 0.92388f, -0.212607f, -0.391952f, 0.881921f, -0.261894f,
+    -0.46194f, 0.83147f, -0.308658f, -0.527479f, 0.77301f, -0.35245f, -0.587938f, 0.707107f, -0.392848f, -0.642734f,
+    0.634393f, -0.429461f, -0.691342f, 0.55557f, -0.46194f, -0.73329f, 0.471397f, -0.489969f, -0.768177f, 0.382683f,
+    -0.51328f, -0.795667f, 0.290285f, -0.531648f, -0.815493f, 0.19509f, -0.544895f, -0.827466f, 0.098017f, -0.552895f,
+    -0.831469f, -0.0f, -0.55557f, -0.827466f, -0.098017f, -0.552895f, -0.815493f, -0.19509f, -0.544895f, -0.795667f,
+    -0.290285f, -0.531648f, -0.768178f, -0.382683f, -0.51328f, -0.73329f, -0.471397f, -0.489969f, -0.691342f, -0.55557f,
+    -0.46194f, -0.642734f, -0.634393f, -0.429461f, -0.587938f, -0.707107f, -0.392848f, -0.527479f, -0.77301f, -0.35245f,
+    -0.46194f, -0.83147f, -0.308658f, -0.391952f, -0.881921f, -0.261894f, -0.318189f, -0.92388f, -0.212607f, -0.241363f,
+    -0.95694f, -0.161274f, -0.162212f, -0.980785f, -0.108386f, -0.081498f, -0.995185f, -0.054455f, -0.075768f,
+    0.995185f, -0.062181f, -0.150807f, 0.980785f, -0.123764f, -0.224393f, 0.95694f, -0.184155f, -0.295818f, 0.92388f,
+    -0.242772f, -0.364394f, 0.881921f, -0.299051f, -0.429462f, 0.83147f, -0.35245f, -0.490393f, 0.77301f, -0.402455f,
+    -0.546601f, 0.707107f, -0.448584f, -0.597545f, 0.634393f, -0.490392f, -0.642735f, 0.55557f, -0.527479f, -0.681734f,
+    0.471397f, -0.559485f, -0.714168f, 0.382683f, -0.586103f, -0.739725f, 0.290285f, -0.607077f, -0.758157f, 0.19509f,
+    -0.622204f, -0.769288f, 0.098017f, -0.631338f, -0.77301f, -0.0f, -0.634393f, -0.769288f, -0.098017f, -0.631338f,
+    -0.758157f, -0.19509f, -0.622204f, -0.739725f, -0.290285f, -0.607077f, -0.714168f, -0.382683f, -0.586103f,
+    -0.681734f, -0.471397f, -0.559485f, -0.642735f, -0.55557f, -0.527479f, -0.597545f, -0.634393f, -0.490392f,
+    -0.546601f, -0.707107f, -0.448584f, -0.490393f, -0.77301f, -0.402455f, -0.429462f, -0.83147f, -0.35245f, -0.364395f,
+    -0.881921f, -0.299051f, -0.295818f, -0.92388f, -0.242772f, -0.224393f, -0.95694f, -0.184155f, -0.150807f,
+    -0.980785f, -0.123764f, -0.075768f, -0.995185f, -0.062181f, -0.069309f, 0.995185f, -0.069309f, -0.13795f, 0.980785f,
+    -0.13795f, -0.205262f, 0.95694f, -0.205262f, -0.270598f, 0.92388f, -0.270598f, -0.333328f, 0.881921f, -0.333328f,
+    -0.392848f, 0.83147f, -0.392848f, -0.448584f, 0.77301f, -0.448584f, -0.5f, 0.707107f, -0.5f, -0.546601f, 0.634393f,
+    -0.546601f, -0.587938f, 0.55557f, -0.587938f, -0.623612f, 0.471397f, -0.623612f, -0.653281f, 0.382683f, -0.653281f,
+    -0.676659f, 0.290285f, -0.676659f, -0.69352f, 0.19509f, -0.69352f, -0.703702f, 0.098017f, -0.703702f, -0.707106f,
+    -0.0f, -0.707107f, -0.703702f, -0.098017f, -0.703702f, -0.69352f, -0.19509f, -0.69352f, -0.676659f, -0.290285f,
+    -0.676659f, -0.653281f, -0.382683f, -0.653281f, -0.623612f, -0.471397f, -0.623612f, -0.587938f, -0.55557f,
+    -0.587938f, -0.546601f, -0.634393f, -0.546601f, -0.5f, -0.707107f, -0.5f, -0.448584f, -0.77301f, -0.448584f,
+    -0.392848f, -0.83147f, -0.392848f, -0.333328f, -0.881921f, -0.333328f, -0.270598f, -0.92388f, -0.270598f,
+    -0.205262f, -0.95694f, -0.205262f, -0.13795f, -0.980785f, -0.13795f, -0.069309f, -0.995185f, -0.069309f, -0.062181f,
+    0.995185f, -0.075768f, -0.123764f, 0.980785f, -0.150807f, -0.184155f, 0.95694f, -0.224393f, -0.242772f, 0.92388f,
+    -0.295818f, -0.299051f, 0.881921f, -0.364394f, -0.35245f, 0.83147f, -0.429462f, -0.402455f, 0.77301f, -0.490393f,
+    -0.448584f, 0.707107f, -0.546601f, -0.490392f, 0.634393f, -0.597545f, -0.527479f, 0.55557f, -0.642735f, -0.559484f,
+    0.471397f, -0.681734f, -0.586103f, 0.382683f, -0.714168f, -0.607076f, 0.290285f, -0.739725f, -0.622203f, 0.19509f,
+    -0.758157f, -0.631338f, 0.098017f, -0.769288f, -0.634393f, -0.0f, -0.77301f, -0.631338f, -0.098017f, -0.769288f,
+    -0.622203f, -0.19509f, -0.758157f, -0.607076f, -0.290285f, -0.739725f, -0.586103f, -0.382683f, -0.714168f,
+    -0.559485f, -0.471397f, -0.681734f, -0.527479f, -0.55557f, -0.642735f, -0.490392f, -0.634393f, -0.597545f,
+    -0.448584f, -0.707107f, -0.546601f, -0.402455f, -0.77301f, -0.490393f, -0.35245f, -0.83147f, -0.429462f, -0.299051f,
+    -0.881921f, -0.364395f, -0.242772f, -0.92388f, -0.295818f, -0.184155f, -0.95694f, -0.224393f, -0.123764f,
+    -0.980785f, -0.150807f, -0.062181f, -0.995185f, -0.075768f, -0.054455f, 0.995185f, -0.081498f, -0.108386f,
+    0.980785f, -0.162212f, -0.161274f, 0.95694f, -0.241363f, -0.212607f, 0.92388f, -0.318189f, -0.261894f, 0.881921f,
+    -0.391952f, -0.308659f, 0.83147f, -0.46194f, -0.35245f, 0.77301f, -0.527479f, -0.392847f, 0.707107f, -0.587938f,
+    -0.429461f, 0.634393f, -0.642734f, -0.46194f, 0.55557f, -0.691342f, -0.489969f, 0.471397f, -0.73329f, -0.51328f,
+    0.382683f, -0.768177f, -0.531647f, 0.290285f, -0.795667f, -0.544895f, 0.19509f, -0.815493f, -0.552895f, 0.098017f,
+    -0.827466f, -0.55557f, -0.0f, -0.831469f, -0.552895f, -0.098017f, -0.827466f, -0.544895f, -0.19509f, -0.815493f,
+    -0.531647f, -0.290285f, -0.795667f, -0.51328f, -0.382683f, -0.768178f, -0.489969f, -0.471397f, -0.73329f, -0.46194f,
+    -0.55557f, -0.691342f, -0.429461f, -0.634393f, -0.642734f, -0.392847f, -0.707107f, -0.587938f, -0.35245f, -0.77301f,
+    -0.527479f, -0.308659f, -0.83147f, -0.46194f, -0.261894f, -0.881921f, -0.391952f, -0.212607f, -0.92388f, -0.318189f,
+    -0.161274f, -0.95694f, -0.241363f, -0.108386f, -0.980785f, -0.162212f, -0.054455f, -0.995185f, -0.081498f,
+    -0.046205f, 0.995185f, -0.086443f, -0.091965f, 0.980785f, -0.172054f, -0.136839f, 0.95694f, -0.256008f, -0.180395f,
+    0.92388f, -0.337496f, -0.222215f, 0.881921f, -0.415734f, -0.261894f, 0.83147f, -0.489969f, -0.299051f, 0.77301f,
+    -0.559485f, -0.333328f, 0.707107f, -0.623613f, -0.364394f, 0.634393f, -0.681734f, -0.391952f, 0.55557f, -0.733291f,
+    -0.415734f, 0.471397f, -0.777785f, -0.435514f, 0.382683f, -0.814788f, -0.451098f, 0.290285f, -0.843946f, -0.462339f,
+    0.19509f, -0.864975f, -0.469127f, 0.098017f, -0.877674f, -0.471396f, -0.0f, -0.881921f, -0.469127f, -0.098017f,
+    -0.877674f, -0.462339f, -0.19509f, -0.864975f, -0.451098f, -0.290285f, -0.843946f, -0.435514f, -0.382683f,
+    -0.814789f, -0.415735f, -0.471397f, -0.777785f, -0.391952f, -0.55557f, -0.733291f, -0.364394f, -0.634393f,
+    -0.681734f, -0.333328f, -0.707107f, -0.623613f, -0.299051f, -0.77301f, -0.559485f, -0.261894f, -0.83147f,
+    -0.489969f, -0.222215f, -0.881921f, -0.415735f, -0.180396f, -0.92388f, -0.337496f, -0.136839f, -0.95694f,
+    -0.256008f, -0.091965f, -0.980785f, -0.172054f, -0.046205f, -0.995185f, -0.086443f, -0.03751f, 0.995185f,
+    -0.090556f, -0.074658f, 0.980785f, -0.18024f, -0.111087f, 0.95694f, -0.268188f, -0.146446f, 0.92388f, -0.353553f,
+    -0.180396f, 0.881921f, -0.435513f, -0.212608f, 0.83147f, -0.51328f, -0.242772f, 0.77301f, -0.586103f, -0.270598f,
+    0.707107f, -0.653282f, -0.295818f, 0.634393f, -0.714168f, -0.31819f, 0.55557f, -0.768178f, -0.337496f, 0.471397f,
+    -0.814788f, -0.353553f, 0.382683f, -0.853553f, -0.366205f, 0.290285f, -0.884098f, -0.37533f, 0.19509f, -0.906127f,
+    -0.38084f, 0.098017f, -0.919431f, -0.382683f, -0.0f, -0.923879f, -0.38084f, -0.098017f, -0.919431f, -0.37533f,
+    -0.19509f, -0.906127f, -0.366205f, -0.290285f, -0.884098f, -0.353553f, -0.382683f, -0.853553f, -0.337496f,
+    -0.471397f, -0.814789f, -0.31819f, -0.55557f, -0.768178f, -0.295818f, -0.634393f, -0.714168f, -0.270598f,
+    -0.707107f, -0.653282f, -0.242772f, -0.77301f, -0.586103f, -0.212608f, -0.83147f, -0.51328f, -0.180396f, -0.881921f,
+    -0.435514f, -0.146446f, -0.92388f, -0.353553f, -0.111087f, -0.95694f, -0.268188f, -0.074658f, -0.980785f, -0.18024f,
+    -0.03751f, -0.995185f, -0.090556f, -0.028453f, 0.995185f, -0.093796f, -0.056632f, 0.980785f, -0.18669f, -0.084265f,
+    0.95694f, -0.277785f, -0.111087f, 0.92388f, -0.366205f, -0.136839f, 0.881921f, -0.451098f, -0.161274f, 0.83147f,
+    -0.531648f, -0.184155f, 0.77301f, -0.607076f, -0.205262f, 0.707107f, -0.676659f, -0.224393f, 0.634393f, -0.739724f,
+    -0.241363f, 0.55557f, -0.795667f, -0.256008f, 0.471397f, -0.843946f, -0.268188f, 0.382683f, -0.884097f, -0.277785f,
+    0.290285f, -0.915735f, -0.284707f, 0.19509f, -0.938553f, -0.288887f, 0.098017f, -0.952332f, -0.290284f, -0.0f,
+    -0.95694f, -0.288887f, -0.098017f, -0.952332f, -0.284707f, -0.19509f, -0.938553f, -0.277785f, -0.290285f,
+    -0.915735f, -0.268188f, -0.382683f, -0.884097f, -0.256008f, -0.471397f, -0.843946f, -0.241363f, -0.55557f,
+    -0.795667f, -0.224393f, -0.634393f, -0.739724f, -0.205262f, -0.707107f, -0.676659f, -0.184155f, -0.77301f,
+    -0.607076f, -0.161274f, -0.83147f, -0.531648f, -0.136839f, -0.881921f, -0.451098f, -0.111087f, -0.92388f,
+    -0.366205f, -0.084265f, -0.95694f, -0.277785f, -0.056632f, -0.980785f, -0.18669f, -0.028453f, -0.995185f,
+    -0.093796f, -0.019122f, 0.995185f, -0.096134f, -0.03806f, 0.980785f, -0.191342f, -0.056632f, 0.95694f, -0.284707f,
+    -0.074658f, 0.92388f, -0.37533f, -0.091965f, 0.881921f, -0.462339f, -0.108387f, 0.83147f, -0.544895f, -0.123764f,
+    0.77301f, -0.622204f, -0.13795f, 0.707107f, -0.69352f, -0.150807f, 0.634393f, -0.758157f, -0.162212f, 0.55557f,
+    -0.815493f, -0.172054f, 0.471397f, -0.864975f, -0.18024f, 0.382683f, -0.906127f, -0.18669f, 0.290285f, -0.938553f,
+    -0.191342f, 0.19509f, -0.96194f, -0.194151f, 0.098017f, -0.976062f, -0.19509f, -0.0f, -0.980785f, -0.194151f,
+    -0.098017f, -0.976062f, -0.191342f, -0.19509f, -0.96194f, -0.18669f, -0.290285f, -0.938553f, -0.18024f, -0.382683f,
+    -0.906127f, -0.172054f, -0.471397f, -0.864975f, -0.162212f, -0.55557f, -0.815493f, -0.150807f, -0.634393f,
+    -0.758157f, -0.13795f, -0.707107f, -0.69352f, -0.123764f, -0.77301f, -0.622204f, -0.108387f, -0.83147f, -0.544895f,
+    -0.091965f, -0.881921f, -0.462339f, -0.074658f, -0.92388f, -0.37533f, -0.056632f, -0.95694f, -0.284707f, -0.03806f,
+    -0.980785f, -0.191342f, -0.019122f, -0.995185f, -0.096134f, -0.009607f, 0.995185f, -0.097545f, -0.019122f,
+    0.980785f, -0.194151f, -0.028453f, 0.95694f, -0.288887f, -0.037509f, 0.92388f, -0.38084f, -0.046205f, 0.881921f,
+    -0.469126f, -0.054456f, 0.83147f, -0.552895f, -0.062181f, 0.77301f, -0.631338f, -0.069308f, 0.707107f, -0.703702f,
+    -0.075768f, 0.634393f, -0.769288f, -0.081498f, 0.55557f, -0.827466f, -0.086443f, 0.471397f, -0.877674f, -0.090556f,
+    0.382683f, -0.91943f, -0.093796f, 0.290285f, -0.952332f, -0.096134f, 0.19509f, -0.976062f, -0.097545f, 0.098017f,
+    -0.990392f, -0.098017f, -0.0f, -0.995184f, -0.097545f, -0.098017f, -0.990392f, -0.096134f, -0.19509f, -0.976062f,
+    -0.093796f, -0.290285f, -0.952332f, -0.090556f, -0.382683f, -0.91943f, -0.086443f, -0.471397f, -0.877674f,
+    -0.081498f, -0.55557f, -0.827466f, -0.075768f, -0.634393f, -0.769288f, -0.069308f, -0.707107f, -0.703702f,
+    -0.062181f, -0.77301f, -0.631338f, -0.054456f, -0.83147f, -0.552895f, -0.046205f, -0.881921f, -0.469127f,
+    -0.037509f, -0.92388f, -0.38084f, -0.028453f, -0.95694f, -0.288887f, -0.019122f, -0.980785f, -0.194151f, -0.009607f,
+    -0.995185f, -0.097545f, -0.0f, 0.980785f, -0.19509f, 0.0f, 0.881921f, -0.471396f, -0.0f, 0.83147f, -0.55557f, -0.0f,
+    0.55557f, -0.83147f, -0.0f, 0.382683f, -0.923879f, -0.0f, -0.55557f, -0.83147f, -0.0f, -0.634393f, -0.77301f, -0.0f,
+    -0.83147f, -0.55557f, 0.0f, -0.92388f, -0.382683f, 0.0f, -0.95694f, -0.290285f, -0.0f, -0.980785f, -0.19509f};
+
+constexpr std::array<std::uint32_t, 11904> indices{
+    1136, 19, 50, 12, 38, 13, 1977, 24, 25, 13, 39, 14, 1977, 26, 3, 15, 39, 40, 3, 27, 4, 15, 41, 1980, 4, 28, 5, 1980,
+    42, 1981, 5, 29, 1978, 1981, 43, 16, 1978, 30, 6, 17, 43, 44, 1979, 30, 31, 1982, 44, 45, 7, 31, 32, 18, 45, 46, 7,
+    33, 8, 0, 1447, 20, 18, 47, 1983, 8, 34, 9, 0, 21, 1975, 1983, 48, 1984, 9, 35, 10, 1975, 22, 1, 1984, 49, 1985, 10,
+    36, 11, 1, 23, 2, 1985, 50, 19, 11, 37, 12, 1976, 23, 24, 45, 77, 46, 33, 63, 64, 20, 1447, 51, 47, 77, 78, 33, 65,
+    34, 20, 52, 21, 48, 78, 79, 34, 66, 35, 21, 53, 22, 49, 79, 80, 35, 67, 36, 22, 54, 23, 49, 81, 50, 36, 68, 37, 23,
+    55, 24, 1136, 50, 81, 37, 69, 38, 24, 56, 25, 38, 70, 39, 25, 57, 26, 39, 71, 40, 26, 58, 27, 41, 71, 72, 28, 58,
+    59, 42, 72, 73, 28, 60, 29, 43, 73, 74, 29, 61, 30, 44, 74, 75, 30, 62, 31, 44, 76, 45, 31, 63, 32, 51, 83, 52, 78,
+    110, 79, 66, 96, 97, 52, 84, 53, 79, 111, 80, 67, 97, 98, 53, 85, 54, 81, 111, 112, 67, 99, 68, 54, 86, 55, 1136,
+    81, 112, 68, 100, 69, 55, 87, 56, 70, 100, 101, 57, 87, 88, 71, 101, 102, 58, 88, 89, 72, 102, 103, 58, 90, 59, 73,
+    103, 104, 60, 90, 91, 73, 105, 74, 60, 92, 61, 74, 106, 75, 62, 92, 93, 75, 107, 76, 63, 93, 94, 76, 108, 77, 63,
+    95, 64, 51, 1447, 82, 78, 108, 109, 64, 96, 65, 84, 116, 85, 111, 143, 112, 99, 129, 130, 85, 117, 86, 1136, 112,
+    143, 99, 131, 100, 86, 118, 87, 100, 132, 101, 87, 119, 88, 102, 132, 133, 88, 120, 89, 102, 134, 103, 89, 121, 90,
+    103, 135, 104, 91, 121, 122, 105, 135, 136, 91, 123, 92, 105, 137, 106, 92, 124, 93, 107, 137, 138, 94, 124, 125,
+    107, 139, 108, 94, 126, 95, 82, 1447, 113, 108, 140, 109, 96, 126, 127, 83, 113, 114, 109, 141, 110, 96, 128, 97,
+    84, 114, 115, 110, 142, 111, 97, 129, 98, 117, 149, 118, 132, 162, 163, 119, 149, 150, 133, 163, 164, 120, 150, 151,
+    134, 164, 165, 120, 152, 121, 134, 166, 135, 121, 153, 122, 136, 166, 167, 122, 154, 123, 136, 168, 137, 123, 155,
+    124, 137, 169, 138, 124, 156, 125, 139, 169, 170, 125, 157, 126, 113, 1447, 144, 140, 170, 171, 127, 157, 158, 113,
+    145, 114, 140, 172, 141, 127, 159, 128, 115, 145, 146, 141, 173, 142, 128, 160, 129, 115, 147, 116, 143, 173, 174,
+    129, 161, 130, 116, 148, 117, 1136, 143, 174, 130, 162, 131, 151, 181, 182, 165, 195, 196, 151, 183, 152, 166, 196,
+    197, 153, 183, 184, 167, 197, 198, 153, 185, 154, 167, 199, 168, 154, 186, 155, 168, 200, 169, 156, 186, 187, 170,
+    200, 201, 156, 188, 157, 144, 1447, 175, 171, 201, 202, 157, 189, 158, 144, 176, 145, 171, 203, 172, 158, 190, 159,
+    146, 176, 177, 172, 204, 173, 160, 190, 191, 146, 178, 147, 173, 205, 174, 161, 191, 192, 147, 179, 148, 1136, 174,
+    205, 161, 193, 162, 148, 180, 149, 162, 194, 163, 149, 181, 150, 164, 194, 195, 184, 214, 215, 198, 228, 229, 184,
+    216, 185, 198, 230, 199, 185, 217, 186, 199, 231, 200, 186, 218, 187, 201, 231, 232, 187, 219, 188, 175, 1447, 206,
+    201, 233, 202, 188, 220, 189, 175, 207, 176, 203, 233, 234, 190, 220, 221, 177, 207, 208, 203, 235, 204, 190, 222,
+    191, 177, 209, 178, 204, 236, 205, 192, 222, 223, 178, 210, 179, 1136, 205, 236, 192, 224, 193, 180, 210, 211, 193,
+    225, 194, 180, 212, 181, 194, 226, 195, 182, 212, 213, 195, 227, 196, 182, 214, 183, 196, 228, 197, 217, 247, 248,
+    231, 261, 262, 217, 249, 218, 232, 262, 263, 218, 250, 219, 206, 1447, 237, 233, 263, 264, 219, 251, 220, 206, 238,
+    207, 234, 264, 265, 221, 251, 252, 207, 239, 208, 234, 266, 235, 221, 253, 222, 208, 240, 209, 235, 267, 236, 223,
+    253, 254, 209, 241, 210, 1136, 236, 267, 224, 254, 255, 210, 242, 211, 225, 255, 256, 212, 242, 243, 225, 257, 226,
+    213, 243, 244, 227, 257, 258, 213, 245, 214, 228, 258, 259, 215, 245, 246, 229, 259, 260, 215, 247, 216, 229, 261,
+    230, 249, 281, 250, 237, 1447, 268, 264, 294, 295, 250, 282, 251, 237, 269, 238, 265, 295, 296, 252, 282, 283, 239,
+    269, 270, 265, 297, 266, 252, 284, 253, 239, 271, 240, 266, 298, 267, 254, 284, 285, 241, 271, 272, 1136, 267, 298,
+    255, 285, 286, 241, 273, 242, 256, 286, 287, 243, 273, 274, 256, 288, 257, 244, 274, 275, 258, 288, 289, 244, 276,
+    245, 258, 290, 259, 246, 276, 277, 260, 290, 291, 246, 278, 247, 260, 292, 261, 248, 278, 279, 261, 293, 262, 248,
+    280, 249, 263, 293, 294, 283, 313, 314, 270, 300, 301, 296, 328, 297, 283, 315, 284, 270, 302, 271, 298, 328, 329,
+    284, 316, 285, 271, 303, 272, 1136, 298, 329, 286, 316, 317, 272, 304, 273, 287, 317, 318, 274, 304, 305, 287, 319,
+    288, 275, 305, 306, 288, 320, 289, 275, 307, 276, 289, 321, 290, 277, 307, 308, 291, 321, 322, 277, 309, 278, 291,
+    323, 292, 279, 309, 310, 292, 324, 293, 279, 311, 280, 294, 324, 325, 280, 312, 281, 268, 1447, 299, 295, 325, 326,
+    282, 312, 313, 268, 300, 269, 296, 326, 327, 315, 347, 316, 303, 333, 334, 1136, 329, 360, 317, 347, 348, 303, 335,
+    304, 318, 348, 349, 305, 335, 336, 318, 350, 319, 306, 336, 337, 320, 350, 351, 306, 338, 307, 320, 352, 321, 308,
+    338, 339, 322, 352, 353, 308, 340, 309, 322, 354, 323, 310, 340, 341, 323, 355, 324, 310, 342, 311, 325, 355, 356,
+    311, 343, 312, 299, 1447, 330, 325, 357, 326, 313, 343, 344, 299, 331, 300, 327, 357, 358, 314, 344, 345, 301, 331,
+    332, 327, 359, 328, 314, 346, 315, 301, 333, 302, 328, 360, 329, 349, 379, 380, 336, 366, 367, 349, 381, 350, 337,
+    367, 368, 350, 382, 351, 337, 369, 338, 351, 383, 352, 339, 369, 370, 353, 383, 384, 339, 371, 340, 353, 385, 354,
+    341, 371, 372, 354, 386, 355, 341, 373, 342, 356, 386, 387, 343, 373, 374, 330, 1447, 361, 356, 388, 357, 344, 374,
+    375, 330, 362, 331, 358, 388, 389, 344, 376, 345, 332, 362, 363, 358, 390, 359, 346, 376, 377, 332, 364, 333, 359,
+    391, 360, 346, 378, 347, 333, 365, 334, 1136, 360, 391, 348, 378, 379, 334, 366, 335, 381, 413, 382, 368, 400, 369,
+    382, 414, 383, 370, 400, 401, 384, 414, 415, 370, 402, 371, 384, 416, 385, 372, 402, 403, 385, 417, 386, 372, 404,
+    373, 387, 417, 418, 374, 404, 405, 361, 1447, 392, 388, 418, 419, 375, 405, 406, 361, 393, 362, 389, 419, 420, 375,
+    407, 376, 363, 393, 394, 389, 421, 390, 377, 407, 408, 363, 395, 364, 390, 422, 391, 377, 409, 378, 364, 396, 365,
+    1136, 391, 422, 379, 409, 410, 365, 397, 366, 380, 410, 411, 367, 397, 398, 380, 412, 381, 367, 399, 368, 415, 445,
+    446, 401, 433, 402, 415, 447, 416, 403, 433, 434, 416, 448, 417, 403, 435, 404, 418, 448, 449, 405, 435, 436, 392,
+    1447, 423, 419, 449, 450, 406, 436, 437, 392, 424, 393, 420, 450, 451, 406, 438, 407, 394, 424, 425, 420, 452, 421,
+    408, 438, 439, 394, 426, 395, 421, 453, 422, 408, 440, 409, 396, 426, 427, 1136, 422, 453, 410, 440, 441, 396, 428,
+    397, 411, 441, 442, 398, 428, 429, 411, 443, 412, 399, 429, 430, 412, 444, 413, 399, 431, 400, 414, 444, 445, 400,
+    432, 401, 447, 479, 448, 434, 466, 435, 449, 479, 480, 436, 466, 467, 423, 1447, 454, 450, 480, 481, 437, 467, 468,
+    423, 455, 424, 451, 481, 482, 437, 469, 438, 424, 456, 425, 451, 483, 452, 439, 469, 470, 425, 457, 426, 452, 484,
+    453, 439, 471, 440, 426, 458, 427, 1136, 453, 484, 440, 472, 441, 427, 459, 428, 441, 473, 442, 429, 459, 460, 443,
+    473, 474, 430, 460, 461, 443, 475, 444, 430, 462, 431, 444, 476, 445, 432, 462, 463, 446, 476, 477, 432, 464, 433,
+    446, 478, 447, 434, 464, 465, 481, 511, 512, 468, 498, 499, 455, 485, 486, 482, 512, 513, 468, 500, 469, 456, 486,
+    487, 482, 514, 483, 470, 500, 501, 456, 488, 457, 483, 515, 484, 470, 502, 471, 457, 489, 458, 1136, 484, 515, 471,
+    503, 472, 458, 490, 459, 473, 503, 504, 459, 491, 460, 474, 504, 505, 461, 491, 492, 474, 506, 475, 461, 493, 462,
+    476, 506, 507, 463, 493, 494, 477, 507, 508, 463, 495, 464, 477, 509, 478, 465, 495, 496, 478, 510, 479, 465, 497,
+    466, 480, 510, 511, 467, 497, 498, 454, 1447, 485, 513, 545, 514, 501, 531, 532, 487, 519, 488, 514, 546, 515, 501,
+    533, 502, 489, 519, 520, 1136, 515, 546, 502, 534, 503, 489, 521, 490, 503, 535, 504, 491, 521, 522, 504, 536, 505,
+    492, 522, 523, 505, 537, 506, 492, 524, 493, 507, 537, 538, 494, 524, 525, 508, 538, 539, 494, 526, 495, 508, 540,
+    509, 496, 526, 527, 509, 541, 510, 496, 528, 497, 511, 541, 542, 498, 528, 529, 485, 1447, 516, 511, 543, 512, 499,
+    529, 530, 486, 516, 517, 512, 544, 513, 499, 531, 500, 487, 517, 518, 1136, 546, 577, 533, 565, 534, 520, 552, 521,
+    535, 565, 566, 522, 552, 553, 535, 567, 536, 522, 554, 523, 536, 568, 537, 523, 555, 524, 537, 569, 538, 525, 555,
+    556, 539, 569, 570, 525, 557, 526, 539, 571, 540, 527, 557, 558, 540, 572, 541, 527, 559, 528, 542, 572, 573, 529,
+    559, 560, 516, 1447, 547, 543, 573, 574, 530, 560, 561, 516, 548, 517, 544, 574, 575, 530, 562, 531, 517, 549, 518,
+    545, 575, 576, 532, 562, 563, 518, 550, 519, 546, 576, 577, 532, 564, 533, 519, 551, 520, 567, 597, 598, 554, 584,
+    585, 567, 599, 568, 554, 586, 555, 568, 600, 569, 556, 586, 587, 570, 600, 601, 556, 588, 557, 570, 602, 571, 558,
+    588, 589, 571, 603, 572, 558, 590, 559, 573, 603, 604, 560, 590, 591, 547, 1447, 578, 574, 604, 605, 561, 591, 592,
+    548, 578, 579, 575, 605, 606, 561, 593, 562, 549, 579, 580, 575, 607, 576, 563, 593, 594, 549, 581, 550, 576, 608,
+    577, 563, 595, 564, 551, 581, 582, 1136, 577, 608, 564, 596, 565, 551, 583, 552, 566, 596, 597, 553, 583, 584, 599,
+    631, 600, 586, 618, 587, 601, 631, 632, 587, 619, 588, 601, 633, 602, 589, 619, 620, 602, 634, 603, 589, 621, 590,
+    604, 634, 635, 591, 621, 622, 578, 1447, 609, 604, 636, 605, 592, 622, 623, 578, 610, 579, 605, 637, 606, 592, 624,
+    593, 580, 610, 611, 606, 638, 607, 594, 624, 625, 580, 612, 581, 607, 639, 608, 594, 626, 595, 581, 613, 582, 1136,
+    608, 639, 595, 627, 596, 582, 614, 583, 596, 628, 597, 584, 614, 615, 598, 628, 629, 585, 615, 616, 598, 630, 599,
+    585, 617, 586, 632, 664, 633, 620, 650, 651, 633, 665, 634, 620, 652, 621, 635, 665, 666, 622, 652, 653, 609, 1447,
+    640, 635, 667, 636, 623, 653, 654, 609, 641, 610, 637, 667, 668, 623, 655, 624, 611, 641, 642, 637, 669, 638, 625,
+    655, 656, 611, 643, 612, 639, 669, 670, 625, 657, 626, 612, 644, 613, 1136, 639, 670, 626, 658, 627, 613, 645, 614,
+    627, 659, 628, 615, 645, 646, 629, 659, 660, 616, 646, 647, 629, 661, 630, 616, 648, 617, 630, 662, 631, 618, 648,
+    649, 632, 662, 663, 618, 650, 619, 666, 696, 697, 652, 684, 653, 640, 1447, 671, 667, 697, 698, 654, 684, 685, 641,
+    671, 672, 668, 698, 699, 654, 686, 655, 642, 672, 673, 668, 700, 669, 656, 686, 687, 642, 674, 643, 669, 701, 670,
+    656, 688, 657, 643, 675, 644, 1136, 670, 701, 658, 688, 689, 644, 676, 645, 658, 690, 659, 646, 676, 677, 660, 690,
+    691, 647, 677, 678, 660, 692, 661, 647, 679, 648, 662, 692, 693, 649, 679, 680, 663, 693, 694, 649, 681, 650, 663,
+    695, 664, 651, 681, 682, 664, 696, 665, 651, 683, 652, 671, 703, 672, 699, 729, 730, 686, 716, 717, 673, 703, 704,
+    699, 731, 700, 686, 718, 687, 673, 705, 674, 700, 732, 701, 687, 719, 688, 674, 706, 675, 1136, 701, 732, 689, 719,
+    720, 675, 707, 676, 689, 721, 690, 677, 707, 708, 690, 722, 691, 678, 708, 709, 691, 723, 692, 678, 710, 679, 693,
+    723, 724, 680, 710, 711, 694, 724, 725, 680, 712, 681, 694, 726, 695, 682, 712, 713, 695, 727, 696, 682, 714, 683,
+    697, 727, 728, 683, 715, 684, 671, 1447, 702, 697, 729, 698, 685, 715, 716, 704, 736, 705, 731, 763, 732, 718, 750,
+    719, 705, 737, 706, 1136, 732, 763, 720, 750, 751, 706, 738, 707, 721, 751, 752, 708, 738, 739, 721, 753, 722, 709,
+    739, 740, 722, 754, 723, 709, 741, 710, 724, 754, 755, 711, 741, 742, 725, 755, 756, 711, 743, 712, 725, 757, 726,
+    713, 743, 744, 726, 758, 727, 713, 745, 714, 728, 758, 759, 715, 745, 746, 702, 1447, 733, 728, 760, 729, 716, 746,
+    747, 702, 734, 703, 730, 760, 761, 717, 747, 748, 704, 734, 735, 730, 762, 731, 717, 749, 718, 737, 769, 738, 752,
+    782, 783, 739, 769, 770, 752, 784, 753, 740, 770, 771, 753, 785, 754, 740, 772, 741, 755, 785, 786, 742, 772, 773,
+    756, 786, 787, 742, 774, 743, 756, 788, 757, 744, 774, 775, 757, 789, 758, 744, 776, 745, 759, 789, 790, 746, 776,
+    777, 733, 1447, 764, 759, 791, 760, 747, 777, 778, 733, 765, 734, 761, 791, 792, 748, 778, 779, 735, 765, 766, 761,
+    793, 762, 748, 780, 749, 735, 767, 736, 763, 793, 794, 749, 781, 750, 736, 768, 737, 1136, 763, 794, 751, 781, 782,
+    771, 801, 802, 784, 816, 785, 771, 803, 772, 786, 816, 817, 773, 803, 804, 787, 817, 818, 773, 805, 774, 787, 819,
+    788, 775, 805, 806, 788, 820, 789, 775, 807, 776, 790, 820, 821, 776, 808, 777, 764, 1447, 795, 790, 822, 791, 778,
+    808, 809, 765, 795, 796, 792, 822, 823, 779, 809, 810, 765, 797, 766, 792, 824, 793, 779, 811, 780, 766, 798, 767,
+    794, 824, 825, 780, 812, 781, 767, 799, 768, 1136, 794, 825, 782, 812, 813, 768, 800, 769, 783, 813, 814, 770, 800,
+    801, 783, 815, 784, 810, 840, 841, 797, 827, 828, 823, 855, 824, 810, 842, 811, 797, 829, 798, 825, 855, 856, 811,
+    843, 812, 798, 830, 799, 1136, 825, 856, 813, 843, 844, 799, 831, 800, 814, 844, 845, 801, 831, 832, 814, 846, 815,
+    802, 832, 833, 815, 847, 816, 802, 834, 803, 817, 847, 848, 803, 835, 804, 818, 848, 849, 804, 836, 805, 818, 850,
+    819, 806, 836, 837, 819, 851, 820, 806, 838, 807, 821, 851, 852, 807, 839, 808, 795, 1447, 826, 821, 853, 822, 809,
+    839, 840, 795, 827, 796, 823, 853, 854, 842, 874, 843, 830, 860, 861, 1136, 856, 887, 844, 874, 875, 830, 862, 831,
+    845, 875, 876, 832, 862, 863, 845, 877, 846, 833, 863, 864, 846, 878, 847, 833, 865, 834, 848, 878, 879, 835, 865,
+    866, 849, 879, 880, 835, 867, 836, 849, 881, 850, 837, 867, 868, 850, 882, 851, 837, 869, 838, 852, 882, 883, 838,
+    870, 839, 826, 1447, 857, 852, 884, 853, 840, 870, 871, 826, 858, 827, 854, 884, 885, 841, 871, 872, 828, 858, 859,
+    854, 886, 855, 841, 873, 842, 828, 860, 829, 856, 886, 887, 876, 906, 907, 863, 893, 894, 876, 908, 877, 864, 894,
+    895, 877, 909, 878, 864, 896, 865, 879, 909, 910, 866, 896, 897, 880, 910, 911, 866, 898, 867, 880, 912, 881, 868,
+    898, 899, 881, 913, 882, 868, 900, 869, 883, 913, 914, 869, 901, 870, 857, 1447, 888, 883, 915, 884, 871, 901, 902,
+    857, 889, 858, 885, 915, 916, 872, 902, 903, 859, 889, 890, 885, 917, 886, 872, 904, 873, 860, 890, 891, 886, 918,
+    887, 873, 905, 874, 861, 891, 892, 1136, 887, 918, 875, 905, 906, 861, 893, 862, 908, 940, 909, 895, 927, 896, 910,
+    940, 941, 896, 928, 897, 911, 941, 942, 897, 929, 898, 911, 943, 912, 899, 929, 930, 912, 944, 913, 899, 931, 900,
+    914, 944, 945, 900, 932, 901, 888, 1447, 919, 914, 946, 915, 902, 932, 933, 888, 920, 889, 916, 946, 947, 903, 933,
+    934, 890, 920, 921, 916, 948, 917, 903, 935, 904, 891, 921, 922, 917, 949, 918, 904, 936, 905, 892, 922, 923, 1136,
+    918, 949, 906, 936, 937, 892, 924, 893, 907, 937, 938, 894, 924, 925, 907, 939, 908, 895, 925, 926, 942, 972, 973,
+    928, 960, 929, 942, 974, 943, 930, 960, 961, 943, 975, 944, 930, 962, 931, 945, 975, 976, 932, 962, 963, 919, 1447,
+    950, 945, 977, 946, 933, 963, 964, 919, 951, 920, 947, 977, 978, 934, 964, 965, 921, 951, 952, 947, 979, 948, 934,
+    966, 935, 921, 953, 922, 948, 980, 949, 935, 967, 936, 923, 953, 954, 1136, 949, 980, 937, 967, 968, 923, 955, 924,
+    937, 969, 938, 925, 955, 956, 938, 970, 939, 926, 956, 957, 939, 971, 940, 926, 958, 927, 941, 971, 972, 927, 959,
+    928, 974, 1006, 975, 961, 993, 962, 976, 1006, 1007, 963, 993, 994, 950, 1447, 981, 976, 1008, 977, 964, 994, 995,
+    950, 982, 951, 978, 1008, 1009, 965, 995, 996, 951, 983, 952, 978, 1010, 979, 965, 997, 966, 952, 984, 953, 980,
+    1010, 1011, 966, 998, 967, 953, 985, 954, 1136, 980, 1011, 968, 998, 999, 954, 986, 955, 969, 999, 1000, 956, 986,
+    987, 969, 1001, 970, 957, 987, 988, 970, 1002, 971, 957, 989, 958, 972, 1002, 1003, 958, 990, 959, 973, 1003, 1004,
+    959, 991, 960, 973, 1005, 974, 961, 991, 992, 981, 1447, 1012, 1007, 1039, 1008, 995, 1025, 1026, 981, 1013, 982,
+    1009, 1039, 1040, 996, 1026, 1027, 983, 1013, 1014, 1009, 1041, 1010, 996, 1028, 997, 983, 1015, 984, 1011, 1041,
+    1042, 997, 1029, 998, 984, 1016, 985, 1136, 1011, 1042, 999, 1029, 1030, 985, 1017, 986, 1000, 1030, 1031, 987,
+    1017, 1018, 1000, 1032, 1001, 988, 1018, 1019, 1001, 1033, 1002, 988, 1020, 989, 1003, 1033, 1034, 989, 1021, 990,
+    1004, 1034, 1035, 990, 1022, 991, 1004, 1036, 1005, 992, 1022, 1023, 1005, 1037, 1006, 992, 1024, 993, 1007, 1037,
+    1038, 993, 1025, 994, 1013, 1045, 1014, 1040, 1072, 1041, 1027, 1059, 1028, 1014, 1046, 1015, 1041, 1073, 1042,
+    1028, 1060, 1029, 1015, 1047, 1016, 1136, 1042, 1073, 1030, 1060, 1061, 1016, 1048, 1017, 1031, 1061, 1062, 1018,
+    1048, 1049, 1031, 1063, 1032, 1019, 1049, 1050, 1032, 1064, 1033, 1019, 1051, 1020, 1034, 1064, 1065, 1020, 1052,
+    1021, 1035, 1065, 1066, 1021, 1053, 1022, 1035, 1067, 1036, 1023, 1053, 1054, 1036, 1068, 1037, 1023, 1055, 1024,
+    1038, 1068, 1069, 1024, 1056, 1025, 1012, 1447, 1043, 1038, 1070, 1039, 1026, 1056, 1057, 1013, 1043, 1044, 1040,
+    1070, 1071, 1027, 1057, 1058, 1046, 1078, 1047, 1136, 1073, 1104, 1061, 1091, 1092, 1047, 1079, 1048, 1061, 1093,
+    1062, 1049, 1079, 1080, 1062, 1094, 1063, 1050, 1080, 1081, 1063, 1095, 1064, 1050, 1082, 1051, 1065, 1095, 1096,
+    1051, 1083, 1052, 1066, 1096, 1097, 1052, 1084, 1053, 1066, 1098, 1067, 1054, 1084, 1085, 1067, 1099, 1068, 1054,
+    1086, 1055, 1069, 1099, 1100, 1056, 1086, 1087, 1043, 1447, 1074, 1069, 1101, 1070, 1057, 1087, 1088, 1044, 1074,
+    1075, 1071, 1101, 1102, 1057, 1089, 1058, 1045, 1075, 1076, 1071, 1103, 1072, 1058, 1090, 1059, 1045, 1077, 1046,
+    1072, 1104, 1073, 1059, 1091, 1060, 1080, 1110, 1111, 1093, 1125, 1094, 1081, 1111, 1112, 1094, 1126, 1095, 1081,
+    1113, 1082, 1096, 1126, 1127, 1083, 1113, 1114, 1097, 1127, 1128, 1083, 1115, 1084, 1097, 1129, 1098, 1085, 1115,
+    1116, 1098, 1130, 1099, 1085, 1117, 1086, 1100, 1130, 1131, 1087, 1117, 1118, 1074, 1447, 1105, 1100, 1132, 1101,
+    1088, 1118, 1119, 1074, 1106, 1075, 1102, 1132, 1133, 1089, 1119, 1120, 1075, 1107, 1076, 1102, 1134, 1103, 1089,
+    1121, 1090, 1076, 1108, 1077, 1104, 1134, 1135, 1090, 1122, 1091, 1077, 1109, 1078, 1136, 1104, 1135, 1092, 1122,
+    1123, 1078, 1110, 1079, 1092, 1124, 1093, 1112, 1145, 1113, 1127, 1158, 1159, 1113, 1146, 1114, 1128, 1159, 1160,
+    1114, 1147, 1115, 1128, 1161, 1129, 1116, 1147, 1148, 1129, 1162, 1130, 1116, 1149, 1117, 1131, 1162, 1163, 1117,
+    1150, 1118, 1105, 1447, 1137, 1131, 1164, 1132, 1119, 1150, 1151, 1105, 1138, 1106, 1133, 1164, 1165, 1120, 1151,
+    1152, 1107, 1138, 1139, 1133, 1166, 1134, 1120, 1153, 1121, 1107, 1140, 1108, 1135, 1166, 1167, 1121, 1154, 1122,
+    1108, 1141, 1109, 1136, 1135, 1167, 1123, 1154, 1155, 1109, 1142, 1110, 1123, 1156, 1124, 1111, 1142, 1143, 1124,
+    1157, 1125, 1112, 1143, 1144, 1125, 1158, 1126, 1146, 1178, 1147, 1160, 1192, 1161, 1148, 1178, 1179, 1161, 1193,
+    1162, 1148, 1180, 1149, 1162, 1194, 1163, 1149, 1181, 1150, 1137, 1447, 1168, 1163, 1195, 1164, 1151, 1181, 1182,
+    1137, 1169, 1138, 1165, 1195, 1196, 1152, 1182, 1183, 1138, 1170, 1139, 1165, 1197, 1166, 1152, 1184, 1153, 1139,
+    1171, 1140, 1166, 1198, 1167, 1153, 1185, 1154, 1140, 1172, 1141, 1136, 1167, 1198, 1155, 1185, 1186, 1141, 1173,
+    1142, 1156, 1186, 1187, 1143, 1173, 1174, 1156, 1188, 1157, 1144, 1174, 1175, 1157, 1189, 1158, 1144, 1176, 1145,
+    1159, 1189, 1190, 1145, 1177, 1146, 1160, 1190, 1191, 1179, 1211, 1180, 1194, 1224, 1225, 1180, 1212, 1181, 1168,
+    1447, 1199, 1194, 1226, 1195, 1182, 1212, 1213, 1168, 1200, 1169, 1196, 1226, 1227, 1183, 1213, 1214, 1170, 1200,
+    1201, 1196, 1228, 1197, 1183, 1215, 1184, 1170, 1202, 1171, 1197, 1229, 1198, 1184, 1216, 1185, 1171, 1203, 1172,
+    1136, 1198, 1229, 1186, 1216, 1217, 1172, 1204, 1173, 1187, 1217, 1218, 1174, 1204, 1205, 1187, 1219, 1188, 1175,
+    1205, 1206, 1188, 1220, 1189, 1175, 1207, 1176, 1190, 1220, 1221, 1176, 1208, 1177, 1191, 1221, 1222, 1178, 1208,
+    1209, 1191, 1223, 1192, 1179, 1209, 1210, 1192, 1224, 1193, 1213, 1243, 1244, 1199, 1231, 1200, 1227, 1257, 1258,
+    1214, 1244, 1245, 1200, 1232, 1201, 1227, 1259, 1228, 1214, 1246, 1215, 1201, 1233, 1202, 1229, 1259, 1260, 1215,
+    1247, 1216, 1202, 1234, 1203, 1136, 1229, 1260, 1217, 1247, 1248, 1203, 1235, 1204, 1218, 1248, 1249, 1205, 1235,
+    1236, 1218, 1250, 1219, 1206, 1236, 1237, 1219, 1251, 1220, 1206, 1238, 1207, 1221, 1251, 1252, 1207, 1239, 1208,
+    1222, 1252, 1253, 1208, 1240, 1209, 1222, 1254, 1223, 1210, 1240, 1241, 1223, 1255, 1224, 1211, 1241, 1242, 1225,
+    1255, 1256, 1211, 1243, 1212, 1199, 1447, 1230, 1225, 1257, 1226, 1245, 1277, 1246, 1233, 1263, 1264, 1259, 1291,
+    1260, 1246, 1278, 1247, 1233, 1265, 1234, 1136, 1260, 1291, 1248, 1278, 1279, 1234, 1266, 1235, 1249, 1279, 1280,
+    1236, 1266, 1267, 1249, 1281, 1250, 1237, 1267, 1268, 1250, 1282, 1251, 1237, 1269, 1238, 1252, 1282, 1283, 1238,
+    1270, 1239, 1253, 1283, 1284, 1239, 1271, 1240, 1253, 1285, 1254, 1241, 1271, 1272, 1254, 1286, 1255, 1242, 1272,
+    1273, 1256, 1286, 1287, 1242, 1274, 1243, 1230, 1447, 1261, 1257, 1287, 1288, 1244, 1274, 1275, 1230, 1262, 1231,
+    1258, 1288, 1289, 1245, 1275, 1276, 1232, 1262, 1263, 1258, 1290, 1259, 1279, 1309, 1310, 1265, 1297, 1266, 1280,
+    1310, 1311, 1267, 1297, 1298, 1280, 1312, 1281, 1268, 1298, 1299, 1281, 1313, 1282, 1268, 1300, 1269, 1283, 1313,
+    1314, 1269, 1301, 1270, 1284, 1314, 1315, 1270, 1302, 1271, 1284, 1316, 1285, 1271, 1303, 1272, 1285, 1317, 1286,
+    1273, 1303, 1304, 1287, 1317, 1318, 1273, 1305, 1274, 1261, 1447, 1292, 1287, 1319, 1288, 1275, 1305, 1306, 1261,
+    1293, 1262, 1288, 1320, 1289, 1276, 1306, 1307, 1263, 1293, 1294, 1289, 1321, 1290, 1276, 1308, 1277, 1263, 1295,
+    1264, 1291, 1321, 1322, 1277, 1309, 1278, 1264, 1296, 1265, 1136, 1291, 1322, 1311, 1343, 1312, 1299, 1329, 1330,
+    1312, 1344, 1313, 1299, 1331, 1300, 1314, 1344, 1345, 1300, 1332, 1301, 1315, 1345, 1346, 1302, 1332, 1333, 1315,
+    1347, 1316, 1302, 1334, 1303, 1316, 1348, 1317, 1304, 1334, 1335, 1318, 1348, 1349, 1304, 1336, 1305, 1292, 1447,
+    1323, 1318, 1350, 1319, 1306, 1336, 1337, 1292, 1324, 1293, 1320, 1350, 1351, 1307, 1337, 1338, 1294, 1324, 1325,
+    1320, 1352, 1321, 1307, 1339, 1308, 1294, 1326, 1295, 1321, 1353, 1322, 1308, 1340, 1309, 1296, 1326, 1327, 1136,
+    1322, 1353, 1310, 1340, 1341, 1296, 1328, 1297, 1311, 1341, 1342, 1298, 1328, 1329, 1345, 1375, 1376, 1331, 1363,
+    1332, 1346, 1376, 1377, 1333, 1363, 1364, 1346, 1378, 1347, 1333, 1365, 1334, 1347, 1379, 1348, 1335, 1365, 1366,
+    1349, 1379, 1380, 1335, 1367, 1336, 1323, 1447, 1354, 1349, 1381, 1350, 1337, 1367, 1368, 1323, 1355, 1324, 1350,
+    1382, 1351, 1338, 1368, 1369, 1324, 1356, 1325, 1351, 1383, 1352, 1338, 1370, 1339, 1326, 1356, 1357, 1352, 1384,
+    1353, 1339, 1371, 1340, 1326, 1358, 1327, 1136, 1353, 1384, 1341, 1371, 1372, 1327, 1359, 1328, 1342, 1372, 1373,
+    1329, 1359, 1360, 1342, 1374, 1343, 1330, 1360, 1361, 1343, 1375, 1344, 1330, 1362, 1331, 1377, 1409, 1378, 1364,
+    1396, 1365, 1378, 1410, 1379, 1366, 1396, 1397, 1380, 1410, 1411, 1366, 1398, 1367, 1354, 1447, 1385, 1381, 1411,
+    1412, 1368, 1398, 1399, 1354, 1386, 1355, 1381, 1413, 1382, 1369, 1399, 1400, 1356, 1386, 1387, 1382, 1414, 1383,
+    1369, 1401, 1370, 1357, 1387, 1388, 1383, 1415, 1384, 1370, 1402, 1371, 1357, 1389, 1358, 1136, 1384, 1415, 1372,
+    1402, 1403, 1358, 1390, 1359, 1372, 1404, 1373, 1360, 1390, 1391, 1373, 1405, 1374, 1361, 1391, 1392, 1374, 1406,
+    1375, 1361, 1393, 1362, 1376, 1406, 1407, 1362, 1394, 1363, 1377, 1407, 1408, 1364, 1394, 1395, 1411, 1441, 1442,
+    1397, 1429, 1398, 1385, 1447, 1416, 1412, 1442, 1443, 1399, 1429, 1430, 1385, 1417, 1386, 1413, 1443, 1444, 1400,
+    1430, 1431, 1387, 1417, 1418, 1413, 1445, 1414, 1400, 1432, 1401, 1388, 1418, 1419, 1415, 1445, 1446, 1401, 1433,
+    1402, 1388, 1420, 1389, 1136, 1415, 1446, 1403, 1433, 1434, 1389, 1421, 1390, 1403, 1435, 1404, 1391, 1421, 1422,
+    1404, 1436, 1405, 1392, 1422, 1423, 1405, 1437, 1406, 1392, 1424, 1393, 1407, 1437, 1438, 1393, 1425, 1394, 1408,
+    1438, 1439, 1395, 1425, 1426, 1408, 1440, 1409, 1395, 1427, 1396, 1409, 1441, 1410, 1397, 1427, 1428, 1443, 1476,
+    1444, 1431, 1462, 1463, 1418, 1449, 1450, 1444, 1477, 1445, 1431, 1464, 1432, 1419, 1450, 1451, 1446, 1477, 1478,
+    1432, 1465, 1433, 1419, 1452, 1420, 1136, 1446, 1478, 1434, 1465, 1466, 1420, 1453, 1421, 1434, 1467, 1435, 1422,
+    1453, 1454, 1435, 1468, 1436, 1423, 1454, 1455, 1436, 1469, 1437, 1423, 1456, 1424, 1438, 1469, 1470, 1424, 1457,
+    1425, 1439, 1470, 1471, 1426, 1457, 1458, 1439, 1472, 1440, 1426, 1459, 1427, 1440, 1473, 1441, 1428, 1459, 1460,
+    1442, 1473, 1474, 1428, 1461, 1429, 1416, 1447, 1448, 1442, 1475, 1443, 1430, 1461, 1462, 1416, 1449, 1417, 1478,
+    1508, 1509, 1464, 1496, 1465, 1451, 1483, 1452, 1136, 1478, 1509, 1466, 1496, 1497, 1452, 1484, 1453, 1466, 1498,
+    1467, 1454, 1484, 1485, 1467, 1499, 1468, 1455, 1485, 1486, 1468, 1500, 1469, 1455, 1487, 1456, 1470, 1500, 1501,
+    1456, 1488, 1457, 1471, 1501, 1502, 1458, 1488, 1489, 1471, 1503, 1472, 1458, 1490, 1459, 1472, 1504, 1473, 1460,
+    1490, 1491, 1474, 1504, 1505, 1460, 1492, 1461, 1448, 1447, 1479, 1475, 1505, 1506, 1462, 1492, 1493, 1448, 1480,
+    1449, 1476, 1506, 1507, 1463, 1493, 1494, 1449, 1481, 1450, 1477, 1507, 1508, 1463, 1495, 1464, 1450, 1482, 1451,
+    1497, 1529, 1498, 1485, 1515, 1516, 1498, 1530, 1499, 1486, 1516, 1517, 1499, 1531, 1500, 1486, 1518, 1487, 1501,
+    1531, 1532, 1487, 1519, 1488, 1502, 1532, 1533, 1489, 1519, 1520, 1502, 1534, 1503, 1489, 1521, 1490, 1503, 1535,
+    1504, 1491, 1521, 1522, 1505, 1535, 1536, 1491, 1523, 1492, 1479, 1447, 1510, 1505, 1537, 1506, 1493, 1523, 1524,
+    1479, 1511, 1480, 1507, 1537, 1538, 1494, 1524, 1525, 1481, 1511, 1512, 1507, 1539, 1508, 1494, 1526, 1495, 1482,
+    1512, 1513, 1509, 1539, 1540, 1495, 1527, 1496, 1482, 1514, 1483, 1136, 1509, 1540, 1497, 1527, 1528, 1483, 1515,
+    1484, 1530, 1562, 1531, 1517, 1549, 1518, 1532, 1562, 1563, 1518, 1550, 1519, 1533, 1563, 1564, 1520, 1550, 1551,
+    1533, 1565, 1534, 1520, 1552, 1521, 1534, 1566, 1535, 1522, 1552, 1553, 1536, 1566, 1567, 1522, 1554, 1523, 1510,
+    1447, 1541, 1537, 1567, 1568, 1524, 1554, 1555, 1510, 1542, 1511, 1537, 1569, 1538, 1525, 1555, 1556, 1512, 1542,
+    1543, 1539, 1569, 1570, 1525, 1557, 1526, 1513, 1543, 1544, 1540, 1570, 1571, 1526, 1558, 1527, 1513, 1545, 1514,
+    1136, 1540, 1571, 1528, 1558, 1559, 1514, 1546, 1515, 1528, 1560, 1529, 1516, 1546, 1547, 1529, 1561, 1530, 1517,
+    1547, 1548, 1564, 1594, 1595, 1551, 1581, 1582, 1564, 1596, 1565, 1551, 1583, 1552, 1565, 1597, 1566, 1553, 1583,
+    1584, 1567, 1597, 1598, 1553, 1585, 1554, 1541, 1447, 1572, 1567, 1599, 1568, 1555, 1585, 1586, 1541, 1573, 1542,
+    1569, 1599, 1600, 1556, 1586, 1587, 1543, 1573, 1574, 1569, 1601, 1570, 1556, 1588, 1557, 1544, 1574, 1575, 1571,
+    1601, 1602, 1557, 1589, 1558, 1544, 1576, 1545, 1136, 1571, 1602, 1559, 1589, 1590, 1545, 1577, 1546, 1559, 1591,
+    1560, 1547, 1577, 1578, 1560, 1592, 1561, 1548, 1578, 1579, 1561, 1593, 1562, 1548, 1580, 1549, 1563, 1593, 1594,
+    1549, 1581, 1550, 1595, 1627, 1596, 1582, 1614, 1583, 1596, 1628, 1597, 1584, 1614, 1615, 1598, 1628, 1629, 1584,
+    1616, 1585, 1572, 1447, 1603, 1598, 1630, 1599, 1586, 1616, 1617, 1572, 1604, 1573, 1599, 1631, 1600, 1587, 1617,
+    1618, 1573, 1605, 1574, 1600, 1632, 1601, 1587, 1619, 1588, 1575, 1605, 1606, 1601, 1633, 1602, 1588, 1620, 1589,
+    1575, 1607, 1576, 1136, 1602, 1633, 1590, 1620, 1621, 1576, 1608, 1577, 1590, 1622, 1591, 1578, 1608, 1609, 1592,
+    1622, 1623, 1579, 1609, 1610, 1592, 1624, 1593, 1579, 1611, 1580, 1594, 1624, 1625, 1580, 1612, 1581, 1595, 1625,
+    1626, 1582, 1612, 1613, 1629, 1659, 1660, 1615, 1647, 1616, 1603, 1447, 1634, 1629, 1661, 1630, 1617, 1647, 1648,
+    1603, 1635, 1604, 1631, 1661, 1662, 1618, 1648, 1649, 1605, 1635, 1636, 1631, 1663, 1632, 1618, 1650, 1619, 1606,
+    1636, 1637, 1632, 1664, 1633, 1619, 1651, 1620, 1606, 1638, 1607, 1136, 1633, 1664, 1621, 1651, 1652, 1607, 1639,
+    1608, 1621, 1653, 1622, 1609, 1639, 1640, 1622, 1654, 1623, 1610, 1640, 1641, 1623, 1655, 1624, 1610, 1642, 1611,
+    1625, 1655, 1656, 1611, 1643, 1612, 1626, 1656, 1657, 1613, 1643, 1644, 1626, 1658, 1627, 1613, 1645, 1614, 1627,
+    1659, 1628, 1615, 1645, 1646, 1634, 1666, 1635, 1662, 1692, 1693, 1649, 1679, 1680, 1636, 1666, 1667, 1662, 1694,
+    1663, 1649, 1681, 1650, 1636, 1668, 1637, 1664, 1694, 1695, 1650, 1682, 1651, 1637, 1669, 1638, 1136, 1664, 1695,
+    1652, 1682, 1683, 1638, 1670, 1639, 1653, 1683, 1684, 1640, 1670, 1671, 1653, 1685, 1654, 1641, 1671, 1672, 1654,
+    1686, 1655, 1641, 1673, 1642, 1656, 1686, 1687, 1642, 1674, 1643, 1657, 1687, 1688, 1644, 1674, 1675, 1657, 1689,
+    1658, 1644, 1676, 1645, 1658, 1690, 1659, 1646, 1676, 1677, 1660, 1690, 1691, 1646, 1678, 1647, 1634, 1447, 1665,
+    1660, 1692, 1661, 1648, 1678, 1679, 1668, 1698, 1699, 1694, 1726, 1695, 1681, 1713, 1682, 1669, 1699, 1700, 1136,
+    1695, 1726, 1683, 1713, 1714, 1669, 1701, 1670, 1683, 1715, 1684, 1671, 1701, 1702, 1684, 1716, 1685, 1672, 1702,
+    1703, 1685, 1717, 1686, 1672, 1704, 1673, 1687, 1717, 1718, 1673, 1705, 1674, 1688, 1718, 1719, 1675, 1705, 1706,
+    1688, 1720, 1689, 1675, 1707, 1676, 1689, 1721, 1690, 1677, 1707, 1708, 1691, 1721, 1722, 1677, 1709, 1678, 1665,
+    1447, 1696, 1691, 1723, 1692, 1679, 1709, 1710, 1665, 1697, 1666, 1693, 1723, 1724, 1680, 1710, 1711, 1667, 1697,
+    1698, 1693, 1725, 1694, 1680, 1712, 1681, 1700, 1732, 1701, 1714, 1746, 1715, 1702, 1732, 1733, 1715, 1747, 1716,
+    1703, 1733, 1734, 1716, 1748, 1717, 1703, 1735, 1704, 1718, 1748, 1749, 1704, 1736, 1705, 1719, 1749, 1750, 1706,
+    1736, 1737, 1719, 1751, 1720, 1706, 1738, 1707, 1720, 1752, 1721, 1708, 1738, 1739, 1722, 1752, 1753, 1708, 1740,
+    1709, 1696, 1447, 1727, 1722, 1754, 1723, 1710, 1740, 1741, 1696, 1728, 1697, 1724, 1754, 1755, 1711, 1741, 1742,
+    1698, 1728, 1729, 1724, 1756, 1725, 1711, 1743, 1712, 1699, 1729, 1730, 1726, 1756, 1757, 1712, 1744, 1713, 1700,
+    1730, 1731, 1136, 1726, 1757, 1714, 1744, 1745, 1734, 1764, 1765, 1747, 1779, 1748, 1734, 1766, 1735, 1749, 1779,
+    1780, 1735, 1767, 1736, 1750, 1780, 1781, 1737, 1767, 1768, 1750, 1782, 1751, 1737, 1769, 1738, 1751, 1783, 1752,
+    1739, 1769, 1770, 1753, 1783, 1784, 1739, 1771, 1740, 1727, 1447, 1758, 1753, 1785, 1754, 1741, 1771, 1772, 1728,
+    1758, 1759, 1755, 1785, 1786, 1742, 1772, 1773, 1728, 1760, 1729, 1755, 1787, 1756, 1742, 1774, 1743, 1729, 1761,
+    1730, 1756, 1788, 1757, 1743, 1775, 1744, 1730, 1762, 1731, 1136, 1757, 1788, 1745, 1775, 1776, 1731, 1763, 1732,
+    1745, 1777, 1746, 1733, 1763, 1764, 1746, 1778, 1747, 1766, 1798, 1767, 1781, 1811, 1812, 1768, 1798, 1799, 1781,
+    1813, 1782, 1768, 1800, 1769, 1782, 1814, 1783, 1770, 1800, 1801, 1784, 1814, 1815, 1770, 1802, 1771, 1758, 1447,
+    1789, 1785, 1815, 1816, 1772, 1802, 1803, 1758, 1790, 1759, 1786, 1816, 1817, 1773, 1803, 1804, 1760, 1790, 1791,
+    1786, 1818, 1787, 1773, 1805, 1774, 1761, 1791, 1792, 1788, 1818, 1819, 1774, 1806, 1775, 1761, 1793, 1762, 1136,
+    1788, 1819, 1776, 1806, 1807, 1762, 1794, 1763, 1777, 1807, 1808, 1764, 1794, 1795, 1777, 1809, 1778, 1765, 1795,
+    1796, 1778, 1810, 1779, 1765, 1797, 1766, 1780, 1810, 1811, 1799, 1831, 1800, 1813, 1845, 1814, 1801, 1831, 1832,
+    1815, 1845, 1846, 1801, 1833, 1802, 1789, 1447, 1820, 1815, 1847, 1816, 1803, 1833, 1834, 1789, 1821, 1790, 1817,
+    1847, 1848, 1804, 1834, 1835, 1791, 1821, 1822, 1817, 1849, 1818, 1804, 1836, 1805, 1792, 1822, 1823, 1819, 1849,
+    1850, 1805, 1837, 1806, 1792, 1824, 1793, 1136, 1819, 1850, 1807, 1837, 1838, 1793, 1825, 1794, 1807, 1839, 1808,
+    1795, 1825, 1826, 1808, 1840, 1809, 1796, 1826, 1827, 1809, 1841, 1810, 1796, 1828, 1797, 1811, 1841, 1842, 1797,
+    1829, 1798, 1812, 1842, 1843, 1799, 1829, 1830, 1812, 1844, 1813, 1832, 1864, 1833, 1820, 1447, 1851, 1846, 1878,
+    1847, 1834, 1864, 1865, 1820, 1852, 1821, 1848, 1878, 1879, 1835, 1865, 1866, 1822, 1852, 1853, 1848, 1880, 1849,
+    1835, 1867, 1836, 1823, 1853, 1854, 1850, 1880, 1881, 1836, 1868, 1837, 1823, 1855, 1824, 1136, 1850, 1881, 1838,
+    1868, 1869, 1824, 1856, 1825, 1838, 1870, 1839, 1826, 1856, 1857, 1839, 1871, 1840, 1827, 1857, 1858, 1840, 1872,
+    1841, 1827, 1859, 1828, 1842, 1872, 1873, 1828, 1860, 1829, 1843, 1873, 1874, 1830, 1860, 1861, 1843, 1875, 1844,
+    1830, 1862, 1831, 1844, 1876, 1845, 1832, 1862, 1863, 1846, 1876, 1877, 1866, 1896, 1897, 1852, 1884, 1853, 1879,
+    1911, 1880, 1866, 1898, 1867, 1854, 1884, 1885, 1880, 1912, 1881, 1867, 1899, 1868, 1854, 1886, 1855, 1136, 1881,
+    1912, 1869, 1899, 1900, 1855, 1887, 1856, 1869, 1901, 1870, 1857, 1887, 1888, 1871, 1901, 1902, 1858, 1888, 1889,
+    1871, 1903, 1872, 1858, 1890, 1859, 1873, 1903, 1904, 1859, 1891, 1860, 1874, 1904, 1905, 1861, 1891, 1892, 1874,
+    1906, 1875, 1861, 1893, 1862, 1875, 1907, 1876, 1863, 1893, 1894, 1877, 1907, 1908, 1863, 1895, 1864, 1851, 1447,
+    1882, 1877, 1909, 1878, 1865, 1895, 1896, 1851, 1883, 1852, 1879, 1909, 1910, 1898, 1930, 1899, 1885, 1917, 1886,
+    1136, 1912, 1943, 1900, 1930, 1931, 1886, 1918, 1887, 1900, 1932, 1901, 1888, 1918, 1919, 1902, 1932, 1933, 1888,
+    1920, 1889, 1902, 1934, 1903, 1889, 1921, 1890, 1904, 1934, 1935, 1890, 1922, 1891, 1905, 1935, 1936, 1892, 1922,
+    1923, 1905, 1937, 1906, 1892, 1924, 1893, 1906, 1938, 1907, 1894, 1924, 1925, 1908, 1938, 1939, 1894, 1926, 1895,
+    1882, 1447, 1913, 1909, 1939, 1940, 1896, 1926, 1927, 1882, 1914, 1883, 1910, 1940, 1941, 1897, 1927, 1928, 1884,
+    1914, 1915, 1910, 1942, 1911, 1897, 1929, 1898, 1885, 1915, 1916, 1911, 1943, 1912, 1931, 1963, 1932, 1919, 1949,
+    1950, 1933, 1963, 1964, 1920, 1950, 1951, 1933, 1965, 1934, 1920, 1952, 1921, 1935, 1965, 1966, 1921, 1953, 1922,
+    1936, 1966, 1967, 1923, 1953, 1954, 1936, 1968, 1937, 1923, 1955, 1924, 1937, 1969, 1938, 1925, 1955, 1956, 1939,
+    1969, 1970, 1925, 1957, 1926, 1913, 1447, 1944, 1940, 1970, 1971, 1927, 1957, 1958, 1913, 1945, 1914, 1941, 1971,
+    1972, 1928, 1958, 1959, 1915, 1945, 1946, 1941, 1973, 1942, 1928, 1960, 1929, 1916, 1946, 1947, 1943, 1973, 1974,
+    1929, 1961, 1930, 1916, 1948, 1917, 1136, 1943, 1974, 1931, 1961, 1962, 1917, 1949, 1918, 1964, 1980, 1965, 1952, 4,
+    5, 1966, 1980, 1981, 1953, 5, 1978, 1967, 1981, 16, 1954, 1978, 6, 1967, 17, 1968, 1954, 1979, 1955, 1968, 1982,
+    1969, 1956, 1979, 7, 1969, 18, 1970, 1956, 8, 1957, 1944, 1447, 0, 1970, 1983, 1971, 1958, 8, 9, 1945, 0, 1975,
+    1972, 1983, 1984, 1959, 9, 10, 1945, 1, 1946, 1972, 1985, 1973, 1959, 11, 1960, 1947, 1, 2, 1973, 19, 1974, 1960,
+    12, 1961, 1948, 2, 1976, 1136, 1974, 19, 1962, 12, 13, 1948, 1977, 1949, 1962, 14, 1963, 1950, 1977, 3, 1963, 15,
+    1964, 1951, 3, 4, 12, 37, 38, 1977, 1976, 24, 13, 38, 39, 1977, 25, 26, 15, 14, 39, 3, 26, 27, 15, 40, 41, 4, 27,
+    28, 1980, 41, 42, 5, 28, 29, 1981, 42, 43, 1978, 29, 30, 17, 16, 43, 1979, 6, 30, 1982, 17, 44, 7, 1979, 31, 18,
+    1982, 45, 7, 32, 33, 18, 46, 47, 8, 33, 34, 0, 20, 21, 1983, 47, 48, 9, 34, 35, 1975, 21, 22, 1984, 48, 49, 10, 35,
+    36, 1, 22, 23, 1985, 49, 50, 11, 36, 37, 1976, 2, 23, 45, 76, 77, 33, 32, 63, 47, 46, 77, 33, 64, 65, 20, 51, 52,
+    48, 47, 78, 34, 65, 66, 21, 52, 53, 49, 48, 79, 35, 66, 67, 22, 53, 54, 49, 80, 81, 36, 67, 68, 23, 54, 55, 37, 68,
+    69, 24, 55, 56, 38, 69, 70, 25, 56, 57, 39, 70, 71, 26, 57, 58, 41, 40, 71, 28, 27, 58, 42, 41, 72, 28, 59, 60, 43,
+    42, 73, 29, 60, 61, 44, 43, 74, 30, 61, 62, 44, 75, 76, 31, 62, 63, 51, 82, 83, 78, 109, 110, 66, 65, 96, 52, 83,
+    84, 79, 110, 111, 67, 66, 97, 53, 84, 85, 81, 80, 111, 67, 98, 99, 54, 85, 86, 68, 99, 100, 55, 86, 87, 70, 69, 100,
+    57, 56, 87, 71, 70, 101, 58, 57, 88, 72, 71, 102, 58, 89, 90, 73, 72, 103, 60, 59, 90, 73, 104, 105, 60, 91, 92, 74,
+    105, 106, 62, 61, 92, 75, 106, 107, 63, 62, 93, 76, 107, 108, 63, 94, 95, 78, 77, 108, 64, 95, 96, 84, 115, 116,
+    111, 142, 143, 99, 98, 129, 85, 116, 117, 99, 130, 131, 86, 117, 118, 100, 131, 132, 87, 118, 119, 102, 101, 132,
+    88, 119, 120, 102, 133, 134, 89, 120, 121, 103, 134, 135, 91, 90, 121, 105, 104, 135, 91, 122, 123, 105, 136, 137,
+    92, 123, 124, 107, 106, 137, 94, 93, 124, 107, 138, 139, 94, 125, 126, 108, 139, 140, 96, 95, 126, 83, 82, 113, 109,
+    140, 141, 96, 127, 128, 84, 83, 114, 110, 141, 142, 97, 128, 129, 117, 148, 149, 132, 131, 162, 119, 118, 149, 133,
+    132, 163, 120, 119, 150, 134, 133, 164, 120, 151, 152, 134, 165, 166, 121, 152, 153, 136, 135, 166, 122, 153, 154,
+    136, 167, 168, 123, 154, 155, 137, 168, 169, 124, 155, 156, 139, 138, 169, 125, 156, 157, 140, 139, 170, 127, 126,
+    157, 113, 144, 145, 140, 171, 172, 127, 158, 159, 115, 114, 145, 141, 172, 173, 128, 159, 160, 115, 146, 147, 143,
+    142, 173, 129, 160, 161, 116, 147, 148, 130, 161, 162, 151, 150, 181, 165, 164, 195, 151, 182, 183, 166, 165, 196,
+    153, 152, 183, 167, 166, 197, 153, 184, 185, 167, 198, 199, 154, 185, 186, 168, 199, 200, 156, 155, 186, 170, 169,
+    200, 156, 187, 188, 171, 170, 201, 157, 188, 189, 144, 175, 176, 171, 202, 203, 158, 189, 190, 146, 145, 176, 172,
+    203, 204, 160, 159, 190, 146, 177, 178, 173, 204, 205, 161, 160, 191, 147, 178, 179, 161, 192, 193, 148, 179, 180,
+    162, 193, 194, 149, 180, 181, 164, 163, 194, 184, 183, 214, 198, 197, 228, 184, 215, 216, 198, 229, 230, 185, 216,
+    217, 199, 230, 231, 186, 217, 218, 201, 200, 231, 187, 218, 219, 201, 232, 233, 188, 219, 220, 175, 206, 207, 203,
+    202, 233, 190, 189, 220, 177, 176, 207, 203, 234, 235, 190, 221, 222, 177, 208, 209, 204, 235, 236, 192, 191, 222,
+    178, 209, 210, 192, 223, 224, 180, 179, 210, 193, 224, 225, 180, 211, 212, 194, 225, 226, 182, 181, 212, 195, 226,
+    227, 182, 213, 214, 196, 227, 228, 217, 216, 247, 231, 230, 261, 217, 248, 249, 232, 231, 262, 218, 249, 250, 233,
+    232, 263, 219, 250, 251, 206, 237, 238, 234, 233, 264, 221, 220, 251, 207, 238, 239, 234, 265, 266, 221, 252, 253,
+    208, 239, 240, 235, 266, 267, 223, 222, 253, 209, 240, 241, 224, 223, 254, 210, 241, 242, 225, 224, 255, 212, 211,
+    242, 225, 256, 257, 213, 212, 243, 227, 226, 257, 213, 244, 245, 228, 227, 258, 215, 214, 245, 229, 228, 259, 215,
+    246, 247, 229, 260, 261, 249, 280, 281, 264, 263, 294, 250, 281, 282, 237, 268, 269, 265, 264, 295, 252, 251, 282,
+    239, 238, 269, 265, 296, 297, 252, 283, 284, 239, 270, 271, 266, 297, 298, 254, 253, 284, 241, 240, 271, 255, 254,
+    285, 241, 272, 273, 256, 255, 286, 243, 242, 273, 256, 287, 288, 244, 243, 274, 258, 257, 288, 244, 275, 276, 258,
+    289, 290, 246, 245, 276, 260, 259, 290, 246, 277, 278, 260, 291, 292, 248, 247, 278, 261, 292, 293, 248, 279, 280,
+    263, 262, 293, 283, 282, 313, 270, 269, 300, 296, 327, 328, 283, 314, 315, 270, 301, 302, 298, 297, 328, 284, 315,
+    316, 271, 302, 303, 286, 285, 316, 272, 303, 304, 287, 286, 317, 274, 273, 304, 287, 318, 319, 275, 274, 305, 288,
+    319, 320, 275, 306, 307, 289, 320, 321, 277, 276, 307, 291, 290, 321, 277, 308, 309, 291, 322, 323, 279, 278, 309,
+    292, 323, 324, 279, 310, 311, 294, 293, 324, 280, 311, 312, 295, 294, 325, 282, 281, 312, 268, 299, 300, 296, 295,
+    326, 315, 346, 347, 303, 302, 333, 317, 316, 347, 303, 334, 335, 318, 317, 348, 305, 304, 335, 318, 349, 350, 306,
+    305, 336, 320, 319, 350, 306, 337, 338, 320, 351, 352, 308, 307, 338, 322, 321, 352, 308, 339, 340, 322, 353, 354,
+    310, 309, 340, 323, 354, 355, 310, 341, 342, 325, 324, 355, 311, 342, 343, 325, 356, 357, 313, 312, 343, 299, 330,
+    331, 327, 326, 357, 314, 313, 344, 301, 300, 331, 327, 358, 359, 314, 345, 346, 301, 332, 333, 328, 359, 360, 349,
+    348, 379, 336, 335, 366, 349, 380, 381, 337, 336, 367, 350, 381, 382, 337, 368, 369, 351, 382, 383, 339, 338, 369,
+    353, 352, 383, 339, 370, 371, 353, 384, 385, 341, 340, 371, 354, 385, 386, 341, 372, 373, 356, 355, 386, 343, 342,
+    373, 356, 387, 388, 344, 343, 374, 330, 361, 362, 358, 357, 388, 344, 375, 376, 332, 331, 362, 358, 389, 390, 346,
+    345, 376, 332, 363, 364, 359, 390, 391, 346, 377, 378, 333, 364, 365, 348, 347, 378, 334, 365, 366, 381, 412, 413,
+    368, 399, 400, 382, 413, 414, 370, 369, 400, 384, 383, 414, 370, 401, 402, 384, 415, 416, 372, 371, 402, 385, 416,
+    417, 372, 403, 404, 387, 386, 417, 374, 373, 404, 388, 387, 418, 375, 374, 405, 361, 392, 393, 389, 388, 419, 375,
+    406, 407, 363, 362, 393, 389, 420, 421, 377, 376, 407, 363, 394, 395, 390, 421, 422, 377, 408, 409, 364, 395, 396,
+    379, 378, 409, 365, 396, 397, 380, 379, 410, 367, 366, 397, 380, 411, 412, 367, 398, 399, 415, 414, 445, 401, 432,
+    433, 415, 446, 447, 403, 402, 433, 416, 447, 448, 403, 434, 435, 418, 417, 448, 405, 404, 435, 419, 418, 449, 406,
+    405, 436, 392, 423, 424, 420, 419, 450, 406, 437, 438, 394, 393, 424, 420, 451, 452, 408, 407, 438, 394, 425, 426,
+    421, 452, 453, 408, 439, 440, 396, 395, 426, 410, 409, 440, 396, 427, 428, 411, 410, 441, 398, 397, 428, 411, 442,
+    443, 399, 398, 429, 412, 443, 444, 399, 430, 431, 414, 413, 444, 400, 431, 432, 447, 478, 479, 434, 465, 466, 449,
+    448, 479, 436, 435, 466, 450, 449, 480, 437, 436, 467, 423, 454, 455, 451, 450, 481, 437, 468, 469, 424, 455, 456,
+    451, 482, 483, 439, 438, 469, 425, 456, 457, 452, 483, 484, 439, 470, 471, 426, 457, 458, 440, 471, 472, 427, 458,
+    459, 441, 472, 473, 429, 428, 459, 443, 442, 473, 430, 429, 460, 443, 474, 475, 430, 461, 462, 444, 475, 476, 432,
+    431, 462, 446, 445, 476, 432, 463, 464, 446, 477, 478, 434, 433, 464, 481, 480, 511, 468, 467, 498, 455, 454, 485,
+    482, 481, 512, 468, 499, 500, 456, 455, 486, 482, 513, 514, 470, 469, 500, 456, 487, 488, 483, 514, 515, 470, 501,
+    502, 457, 488, 489, 471, 502, 503, 458, 489, 490, 473, 472, 503, 459, 490, 491, 474, 473, 504, 461, 460, 491, 474,
+    505, 506, 461, 492, 493, 476, 475, 506, 463, 462, 493, 477, 476, 507, 463, 494, 495, 477, 508, 509, 465, 464, 495,
+    478, 509, 510, 465, 496, 497, 480, 479, 510, 467, 466, 497, 513, 544, 545, 501, 500, 531, 487, 518, 519, 514, 545,
+    546, 501, 532, 533, 489, 488, 519, 502, 533, 534, 489, 520, 521, 503, 534, 535, 491, 490, 521, 504, 535, 536, 492,
+    491, 522, 505, 536, 537, 492, 523, 524, 507, 506, 537, 494, 493, 524, 508, 507, 538, 494, 525, 526, 508, 539, 540,
+    496, 495, 526, 509, 540, 541, 496, 527, 528, 511, 510, 541, 498, 497, 528, 511, 542, 543, 499, 498, 529, 486, 485,
+    516, 512, 543, 544, 499, 530, 531, 487, 486, 517, 533, 564, 565, 520, 551, 552, 535, 534, 565, 522, 521, 552, 535,
+    566, 567, 522, 553, 554, 536, 567, 568, 523, 554, 555, 537, 568, 569, 525, 524, 555, 539, 538, 569, 525, 556, 557,
+    539, 570, 571, 527, 526, 557, 540, 571, 572, 527, 558, 559, 542, 541, 572, 529, 528, 559, 543, 542, 573, 530, 529,
+    560, 516, 547, 548, 544, 543, 574, 530, 561, 562, 517, 548, 549, 545, 544, 575, 532, 531, 562, 518, 549, 550, 546,
+    545, 576, 532, 563, 564, 519, 550, 551, 567, 566, 597, 554, 553, 584, 567, 598, 599, 554, 585, 586, 568, 599, 600,
+    556, 555, 586, 570, 569, 600, 556, 587, 588, 570, 601, 602, 558, 557, 588, 571, 602, 603, 558, 589, 590, 573, 572,
+    603, 560, 559, 590, 574, 573, 604, 561, 560, 591, 548, 547, 578, 575, 574, 605, 561, 592, 593, 549, 548, 579, 575,
+    606, 607, 563, 562, 593, 549, 580, 581, 576, 607, 608, 563, 594, 595, 551, 550, 581, 564, 595, 596, 551, 582, 583,
+    566, 565, 596, 553, 552, 583, 599, 630, 631, 586, 617, 618, 601, 600, 631, 587, 618, 619, 601, 632, 633, 589, 588,
+    619, 602, 633, 634, 589, 620, 621, 604, 603, 634, 591, 590, 621, 604, 635, 636, 592, 591, 622, 578, 609, 610, 605,
+    636, 637, 592, 623, 624, 580, 579, 610, 606, 637, 638, 594, 593, 624, 580, 611, 612, 607, 638, 639, 594, 625, 626,
+    581, 612, 613, 595, 626, 627, 582, 613, 614, 596, 627, 628, 584, 583, 614, 598, 597, 628, 585, 584, 615, 598, 629,
+    630, 585, 616, 617, 632, 663, 664, 620, 619, 650, 633, 664, 665, 620, 651, 652, 635, 634, 665, 622, 621, 652, 635,
+    666, 667, 623, 622, 653, 609, 640, 641, 637, 636, 667, 623, 654, 655, 611, 610, 641, 637, 668, 669, 625, 624, 655,
+    611, 642, 643, 639, 638, 669, 625, 656, 657, 612, 643, 644, 626, 657, 658, 613, 644, 645, 627, 658, 659, 615, 614,
+    645, 629, 628, 659, 616, 615, 646, 629, 660, 661, 616, 647, 648, 630, 661, 662, 618, 617, 648, 632, 631, 662, 618,
+    649, 650, 666, 665, 696, 652, 683, 684, 667, 666, 697, 654, 653, 684, 641, 640, 671, 668, 667, 698, 654, 685, 686,
+    642, 641, 672, 668, 699, 700, 656, 655, 686, 642, 673, 674, 669, 700, 701, 656, 687, 688, 643, 674, 675, 658, 657,
+    688, 644, 675, 676, 658, 689, 690, 646, 645, 676, 660, 659, 690, 647, 646, 677, 660, 691, 692, 647, 678, 679, 662,
+    661, 692, 649, 648, 679, 663, 662, 693, 649, 680, 681, 663, 694, 695, 651, 650, 681, 664, 695, 696, 651, 682, 683,
+    671, 702, 703, 699, 698, 729, 686, 685, 716, 673, 672, 703, 699, 730, 731, 686, 717, 718, 673, 704, 705, 700, 731,
+    732, 687, 718, 719, 674, 705, 706, 689, 688, 719, 675, 706, 707, 689, 720, 721, 677, 676, 707, 690, 721, 722, 678,
+    677, 708, 691, 722, 723, 678, 709, 710, 693, 692, 723, 680, 679, 710, 694, 693, 724, 680, 711, 712, 694, 725, 726,
+    682, 681, 712, 695, 726, 727, 682, 713, 714, 697, 696, 727, 683, 714, 715, 697, 728, 729, 685, 684, 715, 704, 735,
+    736, 731, 762, 763, 718, 749, 750, 705, 736, 737, 720, 719, 750, 706, 737, 738, 721, 720, 751, 708, 707, 738, 721,
+    752, 753, 709, 708, 739, 722, 753, 754, 709, 740, 741, 724, 723, 754, 711, 710, 741, 725, 724, 755, 711, 742, 743,
+    725, 756, 757, 713, 712, 743, 726, 757, 758, 713, 744, 745, 728, 727, 758, 715, 714, 745, 728, 759, 760, 716, 715,
+    746, 702, 733, 734, 730, 729, 760, 717, 716, 747, 704, 703, 734, 730, 761, 762, 717, 748, 749, 737, 768, 769, 752,
+    751, 782, 739, 738, 769, 752, 783, 784, 740, 739, 770, 753, 784, 785, 740, 771, 772, 755, 754, 785, 742, 741, 772,
+    756, 755, 786, 742, 773, 774, 756, 787, 788, 744, 743, 774, 757, 788, 789, 744, 775, 776, 759, 758, 789, 746, 745,
+    776, 759, 790, 791, 747, 746, 777, 733, 764, 765, 761, 760, 791, 748, 747, 778, 735, 734, 765, 761, 792, 793, 748,
+    779, 780, 735, 766, 767, 763, 762, 793, 749, 780, 781, 736, 767, 768, 751, 750, 781, 771, 770, 801, 784, 815, 816,
+    771, 802, 803, 786, 785, 816, 773, 772, 803, 787, 786, 817, 773, 804, 805, 787, 818, 819, 775, 774, 805, 788, 819,
+    820, 775, 806, 807, 790, 789, 820, 776, 807, 808, 790, 821, 822, 778, 777, 808, 765, 764, 795, 792, 791, 822, 779,
+    778, 809, 765, 796, 797, 792, 823, 824, 779, 810, 811, 766, 797, 798, 794, 793, 824, 780, 811, 812, 767, 798, 799,
+    782, 781, 812, 768, 799, 800, 783, 782, 813, 770, 769, 800, 783, 814, 815, 810, 809, 840, 797, 796, 827, 823, 854,
+    855, 810, 841, 842, 797, 828, 829, 825, 824, 855, 811, 842, 843, 798, 829, 830, 813, 812, 843, 799, 830, 831, 814,
+    813, 844, 801, 800, 831, 814, 845, 846, 802, 801, 832, 815, 846, 847, 802, 833, 834, 817, 816, 847, 803, 834, 835,
+    818, 817, 848, 804, 835, 836, 818, 849, 850, 806, 805, 836, 819, 850, 851, 806, 837, 838, 821, 820, 851, 807, 838,
+    839, 821, 852, 853, 809, 808, 839, 795, 826, 827, 823, 822, 853, 842, 873, 874, 830, 829, 860, 844, 843, 874, 830,
+    861, 862, 845, 844, 875, 832, 831, 862, 845, 876, 877, 833, 832, 863, 846, 877, 878, 833, 864, 865, 848, 847, 878,
+    835, 834, 865, 849, 848, 879, 835, 866, 867, 849, 880, 881, 837, 836, 867, 850, 881, 882, 837, 868, 869, 852, 851,
+    882, 838, 869, 870, 852, 883, 884, 840, 839, 870, 826, 857, 858, 854, 853, 884, 841, 840, 871, 828, 827, 858, 854,
+    885, 886, 841, 872, 873, 828, 859, 860, 856, 855, 886, 876, 875, 906, 863, 862, 893, 876, 907, 908, 864, 863, 894,
+    877, 908, 909, 864, 895, 896, 879, 878, 909, 866, 865, 896, 880, 879, 910, 866, 897, 898, 880, 911, 912, 868, 867,
+    898, 881, 912, 913, 868, 899, 900, 883, 882, 913, 869, 900, 901, 883, 914, 915, 871, 870, 901, 857, 888, 889, 885,
+    884, 915, 872, 871, 902, 859, 858, 889, 885, 916, 917, 872, 903, 904, 860, 859, 890, 886, 917, 918, 873, 904, 905,
+    861, 860, 891, 875, 874, 905, 861, 892, 893, 908, 939, 940, 895, 926, 927, 910, 909, 940, 896, 927, 928, 911, 910,
+    941, 897, 928, 929, 911, 942, 943, 899, 898, 929, 912, 943, 944, 899, 930, 931, 914, 913, 944, 900, 931, 932, 914,
+    945, 946, 902, 901, 932, 888, 919, 920, 916, 915, 946, 903, 902, 933, 890, 889, 920, 916, 947, 948, 903, 934, 935,
+    891, 890, 921, 917, 948, 949, 904, 935, 936, 892, 891, 922, 906, 905, 936, 892, 923, 924, 907, 906, 937, 894, 893,
+    924, 907, 938, 939, 895, 894, 925, 942, 941, 972, 928, 959, 960, 942, 973, 974, 930, 929, 960, 943, 974, 975, 930,
+    961, 962, 945, 944, 975, 932, 931, 962, 945, 976, 977, 933, 932, 963, 919, 950, 951, 947, 946, 977, 934, 933, 964,
+    921, 920, 951, 947, 978, 979, 934, 965, 966, 921, 952, 953, 948, 979, 980, 935, 966, 967, 923, 922, 953, 937, 936,
+    967, 923, 954, 955, 937, 968, 969, 925, 924, 955, 938, 969, 970, 926, 925, 956, 939, 970, 971, 926, 957, 958, 941,
+    940, 971, 927, 958, 959, 974, 1005, 1006, 961, 992, 993, 976, 975, 1006, 963, 962, 993, 976, 1007, 1008, 964, 963,
+    994, 950, 981, 982, 978, 977, 1008, 965, 964, 995, 951, 982, 983, 978, 1009, 1010, 965, 996, 997, 952, 983, 984,
+    980, 979, 1010, 966, 997, 998, 953, 984, 985, 968, 967, 998, 954, 985, 986, 969, 968, 999, 956, 955, 986, 969, 1000,
+    1001, 957, 956, 987, 970, 1001, 1002, 957, 988, 989, 972, 971, 1002, 958, 989, 990, 973, 972, 1003, 959, 990, 991,
+    973, 1004, 1005, 961, 960, 991, 1007, 1038, 1039, 995, 994, 1025, 981, 1012, 1013, 1009, 1008, 1039, 996, 995, 1026,
+    983, 982, 1013, 1009, 1040, 1041, 996, 1027, 1028, 983, 1014, 1015, 1011, 1010, 1041, 997, 1028, 1029, 984, 1015,
+    1016, 999, 998, 1029, 985, 1016, 1017, 1000, 999, 1030, 987, 986, 1017, 1000, 1031, 1032, 988, 987, 1018, 1001,
+    1032, 1033, 988, 1019, 1020, 1003, 1002, 1033, 989, 1020, 1021, 1004, 1003, 1034, 990, 1021, 1022, 1004, 1035, 1036,
+    992, 991, 1022, 1005, 1036, 1037, 992, 1023, 1024, 1007, 1006, 1037, 993, 1024, 1025, 1013, 1044, 1045, 1040, 1071,
+    1072, 1027, 1058, 1059, 1014, 1045, 1046, 1041, 1072, 1073, 1028, 1059, 1060, 1015, 1046, 1047, 1030, 1029, 1060,
+    1016, 1047, 1048, 1031, 1030, 1061, 1018, 1017, 1048, 1031, 1062, 1063, 1019, 1018, 1049, 1032, 1063, 1064, 1019,
+    1050, 1051, 1034, 1033, 1064, 1020, 1051, 1052, 1035, 1034, 1065, 1021, 1052, 1053, 1035, 1066, 1067, 1023, 1022,
+    1053, 1036, 1067, 1068, 1023, 1054, 1055, 1038, 1037, 1068, 1024, 1055, 1056, 1038, 1069, 1070, 1026, 1025, 1056,
+    1013, 1012, 1043, 1040, 1039, 1070, 1027, 1026, 1057, 1046, 1077, 1078, 1061, 1060, 1091, 1047, 1078, 1079, 1061,
+    1092, 1093, 1049, 1048, 1079, 1062, 1093, 1094, 1050, 1049, 1080, 1063, 1094, 1095, 1050, 1081, 1082, 1065, 1064,
+    1095, 1051, 1082, 1083, 1066, 1065, 1096, 1052, 1083, 1084, 1066, 1097, 1098, 1054, 1053, 1084, 1067, 1098, 1099,
+    1054, 1085, 1086, 1069, 1068, 1099, 1056, 1055, 1086, 1069, 1100, 1101, 1057, 1056, 1087, 1044, 1043, 1074, 1071,
+    1070, 1101, 1057, 1088, 1089, 1045, 1044, 1075, 1071, 1102, 1103, 1058, 1089, 1090, 1045, 1076, 1077, 1072, 1103,
+    1104, 1059, 1090, 1091, 1080, 1079, 1110, 1093, 1124, 1125, 1081, 1080, 1111, 1094, 1125, 1126, 1081, 1112, 1113,
+    1096, 1095, 1126, 1083, 1082, 1113, 1097, 1096, 1127, 1083, 1114, 1115, 1097, 1128, 1129, 1085, 1084, 1115, 1098,
+    1129, 1130, 1085, 1116, 1117, 1100, 1099, 1130, 1087, 1086, 1117, 1100, 1131, 1132, 1088, 1087, 1118, 1074, 1105,
+    1106, 1102, 1101, 1132, 1089, 1088, 1119, 1075, 1106, 1107, 1102, 1133, 1134, 1089, 1120, 1121, 1076, 1107, 1108,
+    1104, 1103, 1134, 1090, 1121, 1122, 1077, 1108, 1109, 1092, 1091, 1122, 1078, 1109, 1110, 1092, 1123, 1124, 1112,
+    1144, 1145, 1127, 1126, 1158, 1113, 1145, 1146, 1128, 1127, 1159, 1114, 1146, 1147, 1128, 1160, 1161, 1116, 1115,
+    1147, 1129, 1161, 1162, 1116, 1148, 1149, 1131, 1130, 1162, 1117, 1149, 1150, 1131, 1163, 1164, 1119, 1118, 1150,
+    1105, 1137, 1138, 1133, 1132, 1164, 1120, 1119, 1151, 1107, 1106, 1138, 1133, 1165, 1166, 1120, 1152, 1153, 1107,
+    1139, 1140, 1135, 1134, 1166, 1121, 1153, 1154, 1108, 1140, 1141, 1123, 1122, 1154, 1109, 1141, 1142, 1123, 1155,
+    1156, 1111, 1110, 1142, 1124, 1156, 1157, 1112, 1111, 1143, 1125, 1157, 1158, 1146, 1177, 1178, 1160, 1191, 1192,
+    1148, 1147, 1178, 1161, 1192, 1193, 1148, 1179, 1180, 1162, 1193, 1194, 1149, 1180, 1181, 1163, 1194, 1195, 1151,
+    1150, 1181, 1137, 1168, 1169, 1165, 1164, 1195, 1152, 1151, 1182, 1138, 1169, 1170, 1165, 1196, 1197, 1152, 1183,
+    1184, 1139, 1170, 1171, 1166, 1197, 1198, 1153, 1184, 1185, 1140, 1171, 1172, 1155, 1154, 1185, 1141, 1172, 1173,
+    1156, 1155, 1186, 1143, 1142, 1173, 1156, 1187, 1188, 1144, 1143, 1174, 1157, 1188, 1189, 1144, 1175, 1176, 1159,
+    1158, 1189, 1145, 1176, 1177, 1160, 1159, 1190, 1179, 1210, 1211, 1194, 1193, 1224, 1180, 1211, 1212, 1194, 1225,
+    1226, 1182, 1181, 1212, 1168, 1199, 1200, 1196, 1195, 1226, 1183, 1182, 1213, 1170, 1169, 1200, 1196, 1227, 1228,
+    1183, 1214, 1215, 1170, 1201, 1202, 1197, 1228, 1229, 1184, 1215, 1216, 1171, 1202, 1203, 1186, 1185, 1216, 1172,
+    1203, 1204, 1187, 1186, 1217, 1174, 1173, 1204, 1187, 1218, 1219, 1175, 1174, 1205, 1188, 1219, 1220, 1175, 1206,
+    1207, 1190, 1189, 1220, 1176, 1207, 1208, 1191, 1190, 1221, 1178, 1177, 1208, 1191, 1222, 1223, 1179, 1178, 1209,
+    1192, 1223, 1224, 1213, 1212, 1243, 1199, 1230, 1231, 1227, 1226, 1257, 1214, 1213, 1244, 1200, 1231, 1232, 1227,
+    1258, 1259, 1214, 1245, 1246, 1201, 1232, 1233, 1229, 1228, 1259, 1215, 1246, 1247, 1202, 1233, 1234, 1217, 1216,
+    1247, 1203, 1234, 1235, 1218, 1217, 1248, 1205, 1204, 1235, 1218, 1249, 1250, 1206, 1205, 1236, 1219, 1250, 1251,
+    1206, 1237, 1238, 1221, 1220, 1251, 1207, 1238, 1239, 1222, 1221, 1252, 1208, 1239, 1240, 1222, 1253, 1254, 1210,
+    1209, 1240, 1223, 1254, 1255, 1211, 1210, 1241, 1225, 1224, 1255, 1211, 1242, 1243, 1225, 1256, 1257, 1245, 1276,
+    1277, 1233, 1232, 1263, 1259, 1290, 1291, 1246, 1277, 1278, 1233, 1264, 1265, 1248, 1247, 1278, 1234, 1265, 1266,
+    1249, 1248, 1279, 1236, 1235, 1266, 1249, 1280, 1281, 1237, 1236, 1267, 1250, 1281, 1282, 1237, 1268, 1269, 1252,
+    1251, 1282, 1238, 1269, 1270, 1253, 1252, 1283, 1239, 1270, 1271, 1253, 1284, 1285, 1241, 1240, 1271, 1254, 1285,
+    1286, 1242, 1241, 1272, 1256, 1255, 1286, 1242, 1273, 1274, 1257, 1256, 1287, 1244, 1243, 1274, 1230, 1261, 1262,
+    1258, 1257, 1288, 1245, 1244, 1275, 1232, 1231, 1262, 1258, 1289, 1290, 1279, 1278, 1309, 1265, 1296, 1297, 1280,
+    1279, 1310, 1267, 1266, 1297, 1280, 1311, 1312, 1268, 1267, 1298, 1281, 1312, 1313, 1268, 1299, 1300, 1283, 1282,
+    1313, 1269, 1300, 1301, 1284, 1283, 1314, 1270, 1301, 1302, 1284, 1315, 1316, 1271, 1302, 1303, 1285, 1316, 1317,
+    1273, 1272, 1303, 1287, 1286, 1317, 1273, 1304, 1305, 1287, 1318, 1319, 1275, 1274, 1305, 1261, 1292, 1293, 1288,
+    1319, 1320, 1276, 1275, 1306, 1263, 1262, 1293, 1289, 1320, 1321, 1276, 1307, 1308, 1263, 1294, 1295, 1291, 1290,
+    1321, 1277, 1308, 1309, 1264, 1295, 1296, 1311, 1342, 1343, 1299, 1298, 1329, 1312, 1343, 1344, 1299, 1330, 1331,
+    1314, 1313, 1344, 1300, 1331, 1332, 1315, 1314, 1345, 1302, 1301, 1332, 1315, 1346, 1347, 1302, 1333, 1334, 1316,
+    1347, 1348, 1304, 1303, 1334, 1318, 1317, 1348, 1304, 1335, 1336, 1318, 1349, 1350, 1306, 1305, 1336, 1292, 1323,
+    1324, 1320, 1319, 1350, 1307, 1306, 1337, 1294, 1293, 1324, 1320, 1351, 1352, 1307, 1338, 1339, 1294, 1325, 1326,
+    1321, 1352, 1353, 1308, 1339, 1340, 1296, 1295, 1326, 1310, 1309, 1340, 1296, 1327, 1328, 1311, 1310, 1341, 1298,
+    1297, 1328, 1345, 1344, 1375, 1331, 1362, 1363, 1346, 1345, 1376, 1333, 1332, 1363, 1346, 1377, 1378, 1333, 1364,
+    1365, 1347, 1378, 1379, 1335, 1334, 1365, 1349, 1348, 1379, 1335, 1366, 1367, 1349, 1380, 1381, 1337, 1336, 1367,
+    1323, 1354, 1355, 1350, 1381, 1382, 1338, 1337, 1368, 1324, 1355, 1356, 1351, 1382, 1383, 1338, 1369, 1370, 1326,
+    1325, 1356, 1352, 1383, 1384, 1339, 1370, 1371, 1326, 1357, 1358, 1341, 1340, 1371, 1327, 1358, 1359, 1342, 1341,
+    1372, 1329, 1328, 1359, 1342, 1373, 1374, 1330, 1329, 1360, 1343, 1374, 1375, 1330, 1361, 1362, 1377, 1408, 1409,
+    1364, 1395, 1396, 1378, 1409, 1410, 1366, 1365, 1396, 1380, 1379, 1410, 1366, 1397, 1398, 1381, 1380, 1411, 1368,
+    1367, 1398, 1354, 1385, 1386, 1381, 1412, 1413, 1369, 1368, 1399, 1356, 1355, 1386, 1382, 1413, 1414, 1369, 1400,
+    1401, 1357, 1356, 1387, 1383, 1414, 1415, 1370, 1401, 1402, 1357, 1388, 1389, 1372, 1371, 1402, 1358, 1389, 1390,
+    1372, 1403, 1404, 1360, 1359, 1390, 1373, 1404, 1405, 1361, 1360, 1391, 1374, 1405, 1406, 1361, 1392, 1393, 1376,
+    1375, 1406, 1362, 1393, 1394, 1377, 1376, 1407, 1364, 1363, 1394, 1411, 1410, 1441, 1397, 1428, 1429, 1412, 1411,
+    1442, 1399, 1398, 1429, 1385, 1416, 1417, 1413, 1412, 1443, 1400, 1399, 1430, 1387, 1386, 1417, 1413, 1444, 1445,
+    1400, 1431, 1432, 1388, 1387, 1418, 1415, 1414, 1445, 1401, 1432, 1433, 1388, 1419, 1420, 1403, 1402, 1433, 1389,
+    1420, 1421, 1403, 1434, 1435, 1391, 1390, 1421, 1404, 1435, 1436, 1392, 1391, 1422, 1405, 1436, 1437, 1392, 1423,
+    1424, 1407, 1406, 1437, 1393, 1424, 1425, 1408, 1407, 1438, 1395, 1394, 1425, 1408, 1439, 1440, 1395, 1426, 1427,
+    1409, 1440, 1441, 1397, 1396, 1427, 1443, 1475, 1476, 1431, 1430, 1462, 1418, 1417, 1449, 1444, 1476, 1477, 1431,
+    1463, 1464, 1419, 1418, 1450, 1446, 1445, 1477, 1432, 1464, 1465, 1419, 1451, 1452, 1434, 1433, 1465, 1420, 1452,
+    1453, 1434, 1466, 1467, 1422, 1421, 1453, 1435, 1467, 1468, 1423, 1422, 1454, 1436, 1468, 1469, 1423, 1455, 1456,
+    1438, 1437, 1469, 1424, 1456, 1457, 1439, 1438, 1470, 1426, 1425, 1457, 1439, 1471, 1472, 1426, 1458, 1459, 1440,
+    1472, 1473, 1428, 1427, 1459, 1442, 1441, 1473, 1428, 1460, 1461, 1442, 1474, 1475, 1430, 1429, 1461, 1416, 1448,
+    1449, 1478, 1477, 1508, 1464, 1495, 1496, 1451, 1482, 1483, 1466, 1465, 1496, 1452, 1483, 1484, 1466, 1497, 1498,
+    1454, 1453, 1484, 1467, 1498, 1499, 1455, 1454, 1485, 1468, 1499, 1500, 1455, 1486, 1487, 1470, 1469, 1500, 1456,
+    1487, 1488, 1471, 1470, 1501, 1458, 1457, 1488, 1471, 1502, 1503, 1458, 1489, 1490, 1472, 1503, 1504, 1460, 1459,
+    1490, 1474, 1473, 1504, 1460, 1491, 1492, 1475, 1474, 1505, 1462, 1461, 1492, 1448, 1479, 1480, 1476, 1475, 1506,
+    1463, 1462, 1493, 1449, 1480, 1481, 1477, 1476, 1507, 1463, 1494, 1495, 1450, 1481, 1482, 1497, 1528, 1529, 1485,
+    1484, 1515, 1498, 1529, 1530, 1486, 1485, 1516, 1499, 1530, 1531, 1486, 1517, 1518, 1501, 1500, 1531, 1487, 1518,
+    1519, 1502, 1501, 1532, 1489, 1488, 1519, 1502, 1533, 1534, 1489, 1520, 1521, 1503, 1534, 1535, 1491, 1490, 1521,
+    1505, 1504, 1535, 1491, 1522, 1523, 1505, 1536, 1537, 1493, 1492, 1523, 1479, 1510, 1511, 1507, 1506, 1537, 1494,
+    1493, 1524, 1481, 1480, 1511, 1507, 1538, 1539, 1494, 1525, 1526, 1482, 1481, 1512, 1509, 1508, 1539, 1495, 1526,
+    1527, 1482, 1513, 1514, 1497, 1496, 1527, 1483, 1514, 1515, 1530, 1561, 1562, 1517, 1548, 1549, 1532, 1531, 1562,
+    1518, 1549, 1550, 1533, 1532, 1563, 1520, 1519, 1550, 1533, 1564, 1565, 1520, 1551, 1552, 1534, 1565, 1566, 1522,
+    1521, 1552, 1536, 1535, 1566, 1522, 1553, 1554, 1537, 1536, 1567, 1524, 1523, 1554, 1510, 1541, 1542, 1537, 1568,
+    1569, 1525, 1524, 1555, 1512, 1511, 1542, 1539, 1538, 1569, 1525, 1556, 1557, 1513, 1512, 1543, 1540, 1539, 1570,
+    1526, 1557, 1558, 1513, 1544, 1545, 1528, 1527, 1558, 1514, 1545, 1546, 1528, 1559, 1560, 1516, 1515, 1546, 1529,
+    1560, 1561, 1517, 1516, 1547, 1564, 1563, 1594, 1551, 1550, 1581, 1564, 1595, 1596, 1551, 1582, 1583, 1565, 1596,
+    1597, 1553, 1552, 1583, 1567, 1566, 1597, 1553, 1584, 1585, 1567, 1598, 1599, 1555, 1554, 1585, 1541, 1572, 1573,
+    1569, 1568, 1599, 1556, 1555, 1586, 1543, 1542, 1573, 1569, 1600, 1601, 1556, 1587, 1588, 1544, 1543, 1574, 1571,
+    1570, 1601, 1557, 1588, 1589, 1544, 1575, 1576, 1559, 1558, 1589, 1545, 1576, 1577, 1559, 1590, 1591, 1547, 1546,
+    1577, 1560, 1591, 1592, 1548, 1547, 1578, 1561, 1592, 1593, 1548, 1579, 1580, 1563, 1562, 1593, 1549, 1580, 1581,
+    1595, 1626, 1627, 1582, 1613, 1614, 1596, 1627, 1628, 1584, 1583, 1614, 1598, 1597, 1628, 1584, 1615, 1616, 1598,
+    1629, 1630, 1586, 1585, 1616, 1572, 1603, 1604, 1599, 1630, 1631, 1587, 1586, 1617, 1573, 1604, 1605, 1600, 1631,
+    1632, 1587, 1618, 1619, 1575, 1574, 1605, 1601, 1632, 1633, 1588, 1619, 1620, 1575, 1606, 1607, 1590, 1589, 1620,
+    1576, 1607, 1608, 1590, 1621, 1622, 1578, 1577, 1608, 1592, 1591, 1622, 1579, 1578, 1609, 1592, 1623, 1624, 1579,
+    1610, 1611, 1594, 1593, 1624, 1580, 1611, 1612, 1595, 1594, 1625, 1582, 1581, 1612, 1629, 1628, 1659, 1615, 1646,
+    1647, 1629, 1660, 1661, 1617, 1616, 1647, 1603, 1634, 1635, 1631, 1630, 1661, 1618, 1617, 1648, 1605, 1604, 1635,
+    1631, 1662, 1663, 1618, 1649, 1650, 1606, 1605, 1636, 1632, 1663, 1664, 1619, 1650, 1651, 1606, 1637, 1638, 1621,
+    1620, 1651, 1607, 1638, 1639, 1621, 1652, 1653, 1609, 1608, 1639, 1622, 1653, 1654, 1610, 1609, 1640, 1623, 1654,
+    1655, 1610, 1641, 1642, 1625, 1624, 1655, 1611, 1642, 1643, 1626, 1625, 1656, 1613, 1612, 1643, 1626, 1657, 1658,
+    1613, 1644, 1645, 1627, 1658, 1659, 1615, 1614, 1645, 1634, 1665, 1666, 1662, 1661, 1692, 1649, 1648, 1679, 1636,
+    1635, 1666, 1662, 1693, 1694, 1649, 1680, 1681, 1636, 1667, 1668, 1664, 1663, 1694, 1650, 1681, 1682, 1637, 1668,
+    1669, 1652, 1651, 1682, 1638, 1669, 1670, 1653, 1652, 1683, 1640, 1639, 1670, 1653, 1684, 1685, 1641, 1640, 1671,
+    1654, 1685, 1686, 1641, 1672, 1673, 1656, 1655, 1686, 1642, 1673, 1674, 1657, 1656, 1687, 1644, 1643, 1674, 1657,
+    1688, 1689, 1644, 1675, 1676, 1658, 1689, 1690, 1646, 1645, 1676, 1660, 1659, 1690, 1646, 1677, 1678, 1660, 1691,
+    1692, 1648, 1647, 1678, 1668, 1667, 1698, 1694, 1725, 1726, 1681, 1712, 1713, 1669, 1668, 1699, 1683, 1682, 1713,
+    1669, 1700, 1701, 1683, 1714, 1715, 1671, 1670, 1701, 1684, 1715, 1716, 1672, 1671, 1702, 1685, 1716, 1717, 1672,
+    1703, 1704, 1687, 1686, 1717, 1673, 1704, 1705, 1688, 1687, 1718, 1675, 1674, 1705, 1688, 1719, 1720, 1675, 1706,
+    1707, 1689, 1720, 1721, 1677, 1676, 1707, 1691, 1690, 1721, 1677, 1708, 1709, 1691, 1722, 1723, 1679, 1678, 1709,
+    1665, 1696, 1697, 1693, 1692, 1723, 1680, 1679, 1710, 1667, 1666, 1697, 1693, 1724, 1725, 1680, 1711, 1712, 1700,
+    1731, 1732, 1714, 1745, 1746, 1702, 1701, 1732, 1715, 1746, 1747, 1703, 1702, 1733, 1716, 1747, 1748, 1703, 1734,
+    1735, 1718, 1717, 1748, 1704, 1735, 1736, 1719, 1718, 1749, 1706, 1705, 1736, 1719, 1750, 1751, 1706, 1737, 1738,
+    1720, 1751, 1752, 1708, 1707, 1738, 1722, 1721, 1752, 1708, 1739, 1740, 1722, 1753, 1754, 1710, 1709, 1740, 1696,
+    1727, 1728, 1724, 1723, 1754, 1711, 1710, 1741, 1698, 1697, 1728, 1724, 1755, 1756, 1711, 1742, 1743, 1699, 1698,
+    1729, 1726, 1725, 1756, 1712, 1743, 1744, 1700, 1699, 1730, 1714, 1713, 1744, 1734, 1733, 1764, 1747, 1778, 1779,
+    1734, 1765, 1766, 1749, 1748, 1779, 1735, 1766, 1767, 1750, 1749, 1780, 1737, 1736, 1767, 1750, 1781, 1782, 1737,
+    1768, 1769, 1751, 1782, 1783, 1739, 1738, 1769, 1753, 1752, 1783, 1739, 1770, 1771, 1753, 1784, 1785, 1741, 1740,
+    1771, 1728, 1727, 1758, 1755, 1754, 1785, 1742, 1741, 1772, 1728, 1759, 1760, 1755, 1786, 1787, 1742, 1773, 1774,
+    1729, 1760, 1761, 1756, 1787, 1788, 1743, 1774, 1775, 1730, 1761, 1762, 1745, 1744, 1775, 1731, 1762, 1763, 1745,
+    1776, 1777, 1733, 1732, 1763, 1746, 1777, 1778, 1766, 1797, 1798, 1781, 1780, 1811, 1768, 1767, 1798, 1781, 1812,
+    1813, 1768, 1799, 1800, 1782, 1813, 1814, 1770, 1769, 1800, 1784, 1783, 1814, 1770, 1801, 1802, 1785, 1784, 1815,
+    1772, 1771, 1802, 1758, 1789, 1790, 1786, 1785, 1816, 1773, 1772, 1803, 1760, 1759, 1790, 1786, 1817, 1818, 1773,
+    1804, 1805, 1761, 1760, 1791, 1788, 1787, 1818, 1774, 1805, 1806, 1761, 1792, 1793, 1776, 1775, 1806, 1762, 1793,
+    1794, 1777, 1776, 1807, 1764, 1763, 1794, 1777, 1808, 1809, 1765, 1764, 1795, 1778, 1809, 1810, 1765, 1796, 1797,
+    1780, 1779, 1810, 1799, 1830, 1831, 1813, 1844, 1845, 1801, 1800, 1831, 1815, 1814, 1845, 1801, 1832, 1833, 1815,
+    1846, 1847, 1803, 1802, 1833, 1789, 1820, 1821, 1817, 1816, 1847, 1804, 1803, 1834, 1791, 1790, 1821, 1817, 1848,
+    1849, 1804, 1835, 1836, 1792, 1791, 1822, 1819, 1818, 1849, 1805, 1836, 1837, 1792, 1823, 1824, 1807, 1806, 1837,
+    1793, 1824, 1825, 1807, 1838, 1839, 1795, 1794, 1825, 1808, 1839, 1840, 1796, 1795, 1826, 1809, 1840, 1841, 1796,
+    1827, 1828, 1811, 1810, 1841, 1797, 1828, 1829, 1812, 1811, 1842, 1799, 1798, 1829, 1812, 1843, 1844, 1832, 1863,
+    1864, 1846, 1877, 1878, 1834, 1833, 1864, 1820, 1851, 1852, 1848, 1847, 1878, 1835, 1834, 1865, 1822, 1821, 1852,
+    1848, 1879, 1880, 1835, 1866, 1867, 1823, 1822, 1853, 1850, 1849, 1880, 1836, 1867, 1868, 1823, 1854, 1855, 1838,
+    1837, 1868, 1824, 1855, 1856, 1838, 1869, 1870, 1826, 1825, 1856, 1839, 1870, 1871, 1827, 1826, 1857, 1840, 1871,
+    1872, 1827, 1858, 1859, 1842, 1841, 1872, 1828, 1859, 1860, 1843, 1842, 1873, 1830, 1829, 1860, 1843, 1874, 1875,
+    1830, 1861, 1862, 1844, 1875, 1876, 1832, 1831, 1862, 1846, 1845, 1876, 1866, 1865, 1896, 1852, 1883, 1884, 1879,
+    1910, 1911, 1866, 1897, 1898, 1854, 1853, 1884, 1880, 1911, 1912, 1867, 1898, 1899, 1854, 1885, 1886, 1869, 1868,
+    1899, 1855, 1886, 1887, 1869, 1900, 1901, 1857, 1856, 1887, 1871, 1870, 1901, 1858, 1857, 1888, 1871, 1902, 1903,
+    1858, 1889, 1890, 1873, 1872, 1903, 1859, 1890, 1891, 1874, 1873, 1904, 1861, 1860, 1891, 1874, 1905, 1906, 1861,
+    1892, 1893, 1875, 1906, 1907, 1863, 1862, 1893, 1877, 1876, 1907, 1863, 1894, 1895, 1877, 1908, 1909, 1865, 1864,
+    1895, 1851, 1882, 1883, 1879, 1878, 1909, 1898, 1929, 1930, 1885, 1916, 1917, 1900, 1899, 1930, 1886, 1917, 1918,
+    1900, 1931, 1932, 1888, 1887, 1918, 1902, 1901, 1932, 1888, 1919, 1920, 1902, 1933, 1934, 1889, 1920, 1921, 1904,
+    1903, 1934, 1890, 1921, 1922, 1905, 1904, 1935, 1892, 1891, 1922, 1905, 1936, 1937, 1892, 1923, 1924, 1906, 1937,
+    1938, 1894, 1893, 1924, 1908, 1907, 1938, 1894, 1925, 1926, 1909, 1908, 1939, 1896, 1895, 1926, 1882, 1913, 1914,
+    1910, 1909, 1940, 1897, 1896, 1927, 1884, 1883, 1914, 1910, 1941, 1942, 1897, 1928, 1929, 1885, 1884, 1915, 1911,
+    1942, 1943, 1931, 1962, 1963, 1919, 1918, 1949, 1933, 1932, 1963, 1920, 1919, 1950, 1933, 1964, 1965, 1920, 1951,
+    1952, 1935, 1934, 1965, 1921, 1952, 1953, 1936, 1935, 1966, 1923, 1922, 1953, 1936, 1967, 1968, 1923, 1954, 1955,
+    1937, 1968, 1969, 1925, 1924, 1955, 1939, 1938, 1969, 1925, 1956, 1957, 1940, 1939, 1970, 1927, 1926, 1957, 1913,
+    1944, 1945, 1941, 1940, 1971, 1928, 1927, 1958, 1915, 1914, 1945, 1941, 1972, 1973, 1928, 1959, 1960, 1916, 1915,
+    1946, 1943, 1942, 1973, 1929, 1960, 1961, 1916, 1947, 1948, 1931, 1930, 1961, 1917, 1948, 1949, 1964, 15, 1980,
+    1952, 1951, 4, 1966, 1965, 1980, 1953, 1952, 5, 1967, 1966, 1981, 1954, 1953, 1978, 1967, 16, 17, 1954, 6, 1979,
+    1968, 17, 1982, 1956, 1955, 1979, 1969, 1982, 18, 1956, 7, 8, 1970, 18, 1983, 1958, 1957, 8, 1945, 1944, 0, 1972,
+    1971, 1983, 1959, 1958, 9, 1945, 1975, 1, 1972, 1984, 1985, 1959, 10, 11, 1947, 1946, 1, 1973, 1985, 19, 1960, 11,
+    12, 1948, 1947, 2, 1962, 1961, 12, 1948, 1976, 1977, 1962, 13, 14, 1950, 1949, 1977, 1963, 14, 15, 1951, 1950, 3};
+
+} // namespace
+
+EmbeddedMesh uv_sphere_data()
+{
+    return EmbeddedMesh{.positions = positions, .indices = indices};
+}
+
+const geometry::IndexedTriangleMesh& uv_sphere()
+{
+    static const geometry::IndexedTriangleMesh mesh{to_indexed_triangle_mesh(uv_sphere_data())};
+    return mesh;
+}
+
+} // namespace shapes
+
+} // namespace physscope
\ No newline at end of file
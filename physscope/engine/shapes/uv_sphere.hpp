@@ -1,7 +1,9 @@
+// Generated by scripts/obj_to_header.py from uv_sphere.obj; do not edit.
 #ifndef UV_SPHERE_HPP
 #define UV_SPHERE_HPP
 
-#include <string>
+#include "geometry.hpp"
+#include "shapes/embedded_mesh.hpp"
 
 namespace physscope
 {
@@ -9,10093 +11,11 @@ namespace physscope
 namespace shapes
 {
 
-inline const std::string uv_sphere{"# Blender v3.2.0 OBJ File: ''\n"
-                                   "# www.blender.org\n"
-                                   "o Sphere\n"
-                                   "v 0.000000 0.995185 -0.098017\n"
-                                   "v 0.000000 0.956940 -0.290285\n"
-                                   "v 0.000000 0.923880 -0.382683\n"
-                                   "v 0.000000 0.773010 -0.634393\n"
-                                   "v 0.000000 0.707107 -0.707107\n"
-                                   "v 0.000000 0.634393 -0.773010\n"
-                                   "v 0.000000 0.471397 -0.881921\n"
-                                   "v 0.000000 0.290285 -0.956940\n"
-                                   "v 0.000000 0.195090 -0.980785\n"
-                                   "v 0.000000 0.098017 -0.995185\n"
-                                   "v 0.000000 -0.000000 -1.000000\n"
-                                   "v 0.000000 -0.098017 -0.995185\n"
-                                   "v 0.000000 -0.195090 -0.980785\n"
-                                   "v 0.000000 -0.290285 -0.956940\n"
-                                   "v 0.000000 -0.382683 -0.923880\n"
-                                   "v 0.000000 -0.471397 -0.881921\n"
-                                   "v 0.000000 -0.707107 -0.707107\n"
-                                   "v 0.000000 -0.773010 -0.634393\n"
-                                   "v 0.000000 -0.881921 -0.471397\n"
-                                   "v 0.000000 -0.995185 -0.098017\n"
-                                   "v 0.009607 0.995185 -0.097545\n"
-                                   "v 0.019122 0.980785 -0.194151\n"
-                                   "v 0.028453 0.956940 -0.288887\n"
-                                   "v 0.037510 0.923880 -0.380841\n"
-                                   "v 0.046205 0.881921 -0.469127\n"
-                                   "v 0.054455 0.831470 -0.552895\n"
-                                   "v 0.062181 0.773010 -0.631338\n"
-                                   "v 0.069309 0.707107 -0.703702\n"
-                                   "v 0.075768 0.634393 -0.769288\n"
-                                   "v 0.081498 0.555570 -0.827466\n"
-                                   "v 0.086443 0.471397 -0.877675\n"
-                                   "v 0.090556 0.382683 -0.919431\n"
-                                   "v 0.093797 0.290285 -0.952332\n"
-                                   "v 0.096134 0.195090 -0.976062\n"
-                                   "v 0.097545 0.098017 -0.990393\n"
-                                   "v 0.098017 -0.000000 -0.995185\n"
-                                   "v 0.097545 -0.098017 -0.990393\n"
-                                   "v 0.096134 -0.195090 -0.976062\n"
-                                   "v 0.093797 -0.290285 -0.952332\n"
-                                   "v 0.090556 -0.382683 -0.919431\n"
-                                   "v 0.086443 -0.471397 -0.877675\n"
-                                   "v 0.081498 -0.555570 -0.827466\n"
-                                   "v 0.075768 -0.634393 -0.769288\n"
-                                   "v 0.069309 -0.707107 -0.703702\n"
-                                   "v 0.062181 -0.773010 -0.631338\n"
-                                   "v 0.054455 -0.831470 -0.552895\n"
-                                   "v 0.046205 -0.881921 -0.469127\n"
-                                   "v 0.037510 -0.923880 -0.380841\n"
-                                   "v 0.028453 -0.956940 -0.288887\n"
-                                   "v 0.019122 -0.980785 -0.194151\n"
-                                   "v 0.009607 -0.995185 -0.097545\n"
-                                   "v 0.019122 0.995185 -0.096134\n"
-                                   "v 0.038060 0.980785 -0.191342\n"
-                                   "v 0.056632 0.956940 -0.284707\n"
-                                   "v 0.074658 0.923880 -0.375330\n"
-                                   "v 0.091965 0.881921 -0.462339\n"
-                                   "v 0.108386 0.831470 -0.544895\n"
-                                   "v 0.123764 0.773010 -0.622204\n"
-                                   "v 0.137950 0.707107 -0.693520\n"
-                                   "v 0.150807 0.634393 -0.758157\n"
-                                   "v 0.162212 0.555570 -0.815493\n"
-                                   "v 0.172054 0.471397 -0.864975\n"
-                                   "v 0.180240 0.382683 -0.906127\n"
-                                   "v 0.186690 0.290285 -0.938553\n"
-                                   "v 0.191342 0.195090 -0.961940\n"
-                                   "v 0.194151 0.098017 -0.976062\n"
-                                   "v 0.195090 -0.000000 -0.980785\n"
-                                   "v 0.194151 -0.098017 -0.976062\n"
-                                   "v 0.191342 -0.195090 -0.961940\n"
-                                   "v 0.186690 -0.290285 -0.938553\n"
-                                   "v 0.180240 -0.382683 -0.906128\n"
-                                   "v 0.172054 -0.471397 -0.864975\n"
-                                   "v 0.162212 -0.555570 -0.815493\n"
-                                   "v 0.150807 -0.634393 -0.758157\n"
-                                   "v 0.137950 -0.707107 -0.693520\n"
-                                   "v 0.123764 -0.773010 -0.622204\n"
-                                   "v 0.108386 -0.831470 -0.544895\n"
-                                   "v 0.091965 -0.881921 -0.462339\n"
-                                   "v 0.074658 -0.923880 -0.375330\n"
-                                   "v 0.056632 -0.956940 -0.284707\n"
-                                   "v 0.038060 -0.980785 -0.191342\n"
-                                   "v 0.019122 -0.995185 -0.096134\n"
-                                   "v 0.028453 0.995185 -0.093797\n"
-                                   "v 0.056632 0.980785 -0.186690\n"
-                                   "v 0.084265 0.956940 -0.277785\n"
-                                   "v 0.111087 0.923880 -0.366205\n"
-                                   "v 0.136839 0.881921 -0.451099\n"
-                                   "v 0.161274 0.831470 -0.531648\n"
-                                   "v 0.184155 0.773010 -0.607076\n"
-                                   "v 0.205262 0.707107 -0.676659\n"
-                                   "v 0.224393 0.634393 -0.739725\n"
-                                   "v 0.241363 0.555570 -0.795667\n"
-                                   "v 0.256008 0.471397 -0.843946\n"
-                                   "v 0.268188 0.382683 -0.884098\n"
-                                   "v 0.277785 0.290285 -0.915735\n"
-                                   "v 0.284707 0.195090 -0.938553\n"
-                                   "v 0.288887 0.098017 -0.952332\n"
-                                   "v 0.290285 -0.000000 -0.956940\n"
-                                   "v 0.288887 -0.098017 -0.952332\n"
-                                   "v 0.284707 -0.195090 -0.938553\n"
-                                   "v 0.277785 -0.290285 -0.915735\n"
-                                   "v 0.268188 -0.382683 -0.884098\n"
-                                   "v 0.256008 -0.471397 -0.843946\n"
-                                   "v 0.241363 -0.555570 -0.795667\n"
-                                   "v 0.224393 -0.634393 -0.739725\n"
-                                   "v 0.205262 -0.707107 -0.676659\n"
-                                   "v 0.184155 -0.773010 -0.607076\n"
-                                   "v 0.161274 -0.831470 -0.531648\n"
-                                   "v 0.136839 -0.881921 -0.451099\n"
-                                   "v 0.111087 -0.923880 -0.366205\n"
-                                   "v 0.084265 -0.956940 -0.277785\n"
-                                   "v 0.056632 -0.980785 -0.186690\n"
-                                   "v 0.028453 -0.995185 -0.093797\n"
-                                   "v 0.037510 0.995185 -0.090556\n"
-                                   "v 0.074658 0.980785 -0.180240\n"
-                                   "v 0.111087 0.956940 -0.268188\n"
-                                   "v 0.146447 0.923880 -0.353553\n"
-                                   "v 0.180396 0.881921 -0.435514\n"
-                                   "v 0.212608 0.831470 -0.513280\n"
-                                   "v 0.242772 0.773010 -0.586103\n"
-                                   "v 0.270598 0.707107 -0.653281\n"
-                                   "v 0.295818 0.634393 -0.714169\n"
-                                   "v 0.318190 0.555570 -0.768178\n"
-                                   "v 0.337497 0.471397 -0.814789\n"
-                                   "v 0.353553 0.382683 -0.853553\n"
-                                   "v 0.366205 0.290285 -0.884098\n"
-                                   "v 0.375330 0.195090 -0.906127\n"
-                                   "v 0.380841 0.098017 -0.919431\n"
-                                   "v 0.382683 -0.000000 -0.923880\n"
-                                   "v 0.380841 -0.098017 -0.919431\n"
-                                   "v 0.375330 -0.195090 -0.906127\n"
-                                   "v 0.366205 -0.290285 -0.884098\n"
-                                   "v 0.353553 -0.382683 -0.853553\n"
-                                   "v 0.337497 -0.471397 -0.814789\n"
-                                   "v 0.318190 -0.555570 -0.768178\n"
-                                   "v 0.295818 -0.634393 -0.714169\n"
-                                   "v 0.270598 -0.707107 -0.653281\n"
-                                   "v 0.242772 -0.773010 -0.586103\n"
-                                   "v 0.212608 -0.831470 -0.513280\n"
-                                   "v 0.180396 -0.881921 -0.435514\n"
-                                   "v 0.146447 -0.923880 -0.353553\n"
-                                   "v 0.111087 -0.956940 -0.268188\n"
-                                   "v 0.074658 -0.980785 -0.180240\n"
-                                   "v 0.037510 -0.995185 -0.090556\n"
-                                   "v 0.046205 0.995185 -0.086443\n"
-                                   "v 0.091965 0.980785 -0.172054\n"
-                                   "v 0.136839 0.956940 -0.256008\n"
-                                   "v 0.180396 0.923880 -0.337497\n"
-                                   "v 0.222215 0.881921 -0.415735\n"
-                                   "v 0.261894 0.831470 -0.489969\n"
-                                   "v 0.299051 0.773010 -0.559485\n"
-                                   "v 0.333328 0.707107 -0.623612\n"
-                                   "v 0.364395 0.634393 -0.681734\n"
-                                   "v 0.391952 0.555570 -0.733291\n"
-                                   "v 0.415735 0.471397 -0.777785\n"
-                                   "v 0.435514 0.382683 -0.814789\n"
-                                   "v 0.451099 0.290285 -0.843946\n"
-                                   "v 0.462339 0.195090 -0.864975\n"
-                                   "v 0.469127 0.098017 -0.877675\n"
-                                   "v 0.471397 -0.000000 -0.881921\n"
-                                   "v 0.469127 -0.098017 -0.877675\n"
-                                   "v 0.462339 -0.195090 -0.864975\n"
-                                   "v 0.451099 -0.290285 -0.843946\n"
-                                   "v 0.435514 -0.382683 -0.814789\n"
-                                   "v 0.415735 -0.471397 -0.777785\n"
-                                   "v 0.391952 -0.555570 -0.733291\n"
-                                   "v 0.364395 -0.634393 -0.681734\n"
-                                   "v 0.333328 -0.707107 -0.623612\n"
-                                   "v 0.299051 -0.773010 -0.559485\n"
-                                   "v 0.261894 -0.831470 -0.489969\n"
-                                   "v 0.222215 -0.881921 -0.415735\n"
-                                   "v 0.180396 -0.923880 -0.337497\n"
-                                   "v 0.136839 -0.956940 -0.256008\n"
-                                   "v 0.091965 -0.980785 -0.172054\n"
-                                   "v 0.046205 -0.995185 -0.086443\n"
-                                   "v 0.054455 0.995185 -0.081498\n"
-                                   "v 0.108386 0.980785 -0.162212\n"
-                                   "v 0.161274 0.956940 -0.241363\n"
-                                   "v 0.212608 0.923880 -0.318190\n"
-                                   "v 0.261894 0.881921 -0.391952\n"
-                                   "v 0.308658 0.831470 -0.461940\n"
-                                   "v 0.352450 0.773010 -0.527479\n"
-                                   "v 0.392848 0.707107 -0.587938\n"
-                                   "v 0.429462 0.634393 -0.642735\n"
-                                   "v 0.461940 0.555570 -0.691342\n"
-                                   "v 0.489969 0.471397 -0.733291\n"
-                                   "v 0.513280 0.382683 -0.768178\n"
-                                   "v 0.531648 0.290285 -0.795667\n"
-                                   "v 0.544895 0.195090 -0.815493\n"
-                                   "v 0.552895 0.098017 -0.827466\n"
-                                   "v 0.555570 -0.000000 -0.831470\n"
-                                   "v 0.552895 -0.098017 -0.827466\n"
-                                   "v 0.544895 -0.195090 -0.815493\n"
-                                   "v 0.531648 -0.290285 -0.795667\n"
-                                   "v 0.513280 -0.382683 -0.768178\n"
-                                   "v 0.489969 -0.471397 -0.733291\n"
-                                   "v 0.461940 -0.555570 -0.691342\n"
-                                   "v 0.429462 -0.634393 -0.642735\n"
-                                   "v 0.392848 -0.707107 -0.587938\n"
-                                   "v 0.352450 -0.773010 -0.527479\n"
-                                   "v 0.308658 -0.831470 -0.461940\n"
-                                   "v 0.261894 -0.881921 -0.391952\n"
-                                   "v 0.212608 -0.923880 -0.318190\n"
-                                   "v 0.161274 -0.956940 -0.241363\n"
-                                   "v 0.108386 -0.980785 -0.162212\n"
-                                   "v 0.054455 -0.995185 -0.081498\n"
-                                   "v 0.062181 0.995185 -0.075768\n"
-                                   "v 0.123764 0.980785 -0.150807\n"
-                                   "v 0.184155 0.956940 -0.224393\n"
-                                   "v 0.242772 0.923880 -0.295818\n"
-                                   "v 0.299051 0.881921 -0.364395\n"
-                                   "v 0.352450 0.831470 -0.429462\n"
-                                   "v 0.402455 0.773010 -0.490393\n"
-                                   "v 0.448584 0.707107 -0.546601\n"
-                                   "v 0.490393 0.634393 -0.597545\n"
-                                   "v 0.527479 0.555570 -0.642735\n"
-                                   "v 0.559485 0.471397 -0.681734\n"
-                                   "v 0.586103 0.382683 -0.714168\n"
-                                   "v 0.607077 0.290285 -0.739725\n"
-                                   "v 0.622204 0.195090 -0.758157\n"
-                                   "v 0.631338 0.098017 -0.769288\n"
-                                   "v 0.634393 -0.000000 -0.773010\n"
-                                   "v 0.631338 -0.098017 -0.769288\n"
-                                   "v 0.622204 -0.195090 -0.758157\n"
-                                   "v 0.607077 -0.290285 -0.739725\n"
-                                   "v 0.586103 -0.382683 -0.714169\n"
-                                   "v 0.559485 -0.471397 -0.681734\n"
-                                   "v 0.527479 -0.555570 -0.642735\n"
-                                   "v 0.490393 -0.634393 -0.597545\n"
-                                   "v 0.448584 -0.707107 -0.546601\n"
-                                   "v 0.402455 -0.773010 -0.490393\n"
-                                   "v 0.352450 -0.831470 -0.429462\n"
-                                   "v 0.299051 -0.881921 -0.364395\n"
-                                   "v 0.242772 -0.923880 -0.295818\n"
-                                   "v 0.184155 -0.956940 -0.224393\n"
-                                   "v 0.123764 -0.980785 -0.150807\n"
-                                   "v 0.062181 -0.995185 -0.075768\n"
-                                   "v 0.069309 0.995185 -0.069309\n"
-                                   "v 0.137950 0.980785 -0.137950\n"
-                                   "v 0.205262 0.956940 -0.205262\n"
-                                   "v 0.270598 0.923880 -0.270598\n"
-                                   "v 0.333328 0.881921 -0.333328\n"
-                                   "v 0.392848 0.831470 -0.392848\n"
-                                   "v 0.448584 0.773010 -0.448584\n"
-                                   "v 0.500000 0.707107 -0.500000\n"
-                                   "v 0.546601 0.634393 -0.546601\n"
-                                   "v 0.587938 0.555570 -0.587938\n"
-                                   "v 0.623612 0.471397 -0.623612\n"
-                                   "v 0.653281 0.382683 -0.653281\n"
-                                   "v 0.676659 0.290285 -0.676659\n"
-                                   "v 0.693520 0.195090 -0.693520\n"
-                                   "v 0.703702 0.098017 -0.703702\n"
-                                   "v 0.707107 -0.000000 -0.707107\n"
-                                   "v 0.703702 -0.098017 -0.703702\n"
-                                   "v 0.693520 -0.195090 -0.693520\n"
-                                   "v 0.676659 -0.290285 -0.676659\n"
-                                   "v 0.653282 -0.382683 -0.653281\n"
-                                   "v 0.623613 -0.471397 -0.623612\n"
-                                   "v 0.587938 -0.555570 -0.587938\n"
-                                   "v 0.546601 -0.634393 -0.546601\n"
-                                   "v 0.500000 -0.707107 -0.500000\n"
-                                   "v 0.448584 -0.773010 -0.448584\n"
-                                   "v 0.392847 -0.831470 -0.392848\n"
-                                   "v 0.333328 -0.881921 -0.333328\n"
-                                   "v 0.270598 -0.923880 -0.270598\n"
-                                   "v 0.205262 -0.956940 -0.205262\n"
-                                   "v 0.137950 -0.980785 -0.137950\n"
-                                   "v 0.069309 -0.995185 -0.069309\n"
-                                   "v 0.075768 0.995185 -0.062181\n"
-                                   "v 0.150807 0.980785 -0.123764\n"
-                                   "v 0.224393 0.956940 -0.184155\n"
-                                   "v 0.295818 0.923880 -0.242772\n"
-                                   "v 0.364395 0.881921 -0.299051\n"
-                                   "v 0.429462 0.831470 -0.352450\n"
-                                   "v 0.490393 0.773010 -0.402455\n"
-                                   "v 0.546601 0.707107 -0.448584\n"
-                                   "v 0.597545 0.634393 -0.490393\n"
-                                   "v 0.642735 0.555570 -0.527479\n"
-                                   "v 0.681734 0.471397 -0.559485\n"
-                                   "v 0.714168 0.382683 -0.586103\n"
-                                   "v 0.739725 0.290285 -0.607077\n"
-                                   "v 0.758157 0.195090 -0.622203\n"
-                                   "v 0.769288 0.098017 -0.631338\n"
-                                   "v 0.773010 -0.000000 -0.634393\n"
-                                   "v 0.769288 -0.098017 -0.631338\n"
-                                   "v 0.758157 -0.195090 -0.622203\n"
-                                   "v 0.739725 -0.290285 -0.607076\n"
-                                   "v 0.714169 -0.382683 -0.586103\n"
-                                   "v 0.681734 -0.471397 -0.559485\n"
-                                   "v 0.642735 -0.555570 -0.527479\n"
-                                   "v 0.597545 -0.634393 -0.490393\n"
-                                   "v 0.546601 -0.707107 -0.448584\n"
-                                   "v 0.490393 -0.773010 -0.402455\n"
-                                   "v 0.429462 -0.831470 -0.352450\n"
-                                   "v 0.364395 -0.881921 -0.299051\n"
-                                   "v 0.295818 -0.923880 -0.242772\n"
-                                   "v 0.224393 -0.956940 -0.184155\n"
-                                   "v 0.150807 -0.980785 -0.123764\n"
-                                   "v 0.075768 -0.995185 -0.062181\n"
-                                   "v 0.081498 0.995185 -0.054455\n"
-                                   "v 0.162212 0.980785 -0.108386\n"
-                                   "v 0.241363 0.956940 -0.161273\n"
-                                   "v 0.318190 0.923880 -0.212607\n"
-                                   "v 0.391952 0.881921 -0.261894\n"
-                                   "v 0.461940 0.831470 -0.308658\n"
-                                   "v 0.527479 0.773010 -0.352450\n"
-                                   "v 0.587938 0.707107 -0.392847\n"
-                                   "v 0.642735 0.634393 -0.429461\n"
-                                   "v 0.691342 0.555570 -0.461940\n"
-                                   "v 0.733291 0.471397 -0.489969\n"
-                                   "v 0.768178 0.382683 -0.513280\n"
-                                   "v 0.795667 0.290285 -0.531648\n"
-                                   "v 0.815493 0.195090 -0.544895\n"
-                                   "v 0.827466 0.098017 -0.552895\n"
-                                   "v 0.831470 -0.000000 -0.555570\n"
-                                   "v 0.827466 -0.098017 -0.552895\n"
-                                   "v 0.815493 -0.195090 -0.544895\n"
-                                   "v 0.795667 -0.290285 -0.531648\n"
-                                   "v 0.768178 -0.382683 -0.513280\n"
-                                   "v 0.733291 -0.471397 -0.489969\n"
-                                   "v 0.691342 -0.555570 -0.461940\n"
-                                   "v 0.642735 -0.634393 -0.429462\n"
-                                   "v 0.587938 -0.707107 -0.392847\n"
-                                   "v 0.527479 -0.773010 -0.352450\n"
-                                   "v 0.461940 -0.831470 -0.308658\n"
-                                   "v 0.391952 -0.881921 -0.261894\n"
-                                   "v 0.318190 -0.923880 -0.212607\n"
-                                   "v 0.241363 -0.956940 -0.161273\n"
-                                   "v 0.162212 -0.980785 -0.108386\n"
-                                   "v 0.081498 -0.995185 -0.054455\n"
-                                   "v 0.086443 0.995185 -0.046205\n"
-                                   "v 0.172054 0.980785 -0.091965\n"
-                                   "v 0.256008 0.956940 -0.136839\n"
-                                   "v 0.337497 0.923880 -0.180396\n"
-                                   "v 0.415735 0.881921 -0.222215\n"
-                                   "v 0.489969 0.831470 -0.261894\n"
-                                   "v 0.559485 0.773010 -0.299051\n"
-                                   "v 0.623613 0.707107 -0.333328\n"
-                                   "v 0.681734 0.634393 -0.364394\n"
-                                   "v 0.733291 0.555570 -0.391952\n"
-                                   "v 0.777785 0.471397 -0.415735\n"
-                                   "v 0.814789 0.382683 -0.435514\n"
-                                   "v 0.843946 0.290285 -0.451099\n"
-                                   "v 0.864975 0.195090 -0.462339\n"
-                                   "v 0.877675 0.098017 -0.469127\n"
-                                   "v 0.881921 -0.000000 -0.471397\n"
-                                   "v 0.877675 -0.098017 -0.469127\n"
-                                   "v 0.864975 -0.195090 -0.462339\n"
-                                   "v 0.843946 -0.290285 -0.451099\n"
-                                   "v 0.814789 -0.382683 -0.435514\n"
-                                   "v 0.777785 -0.471397 -0.415735\n"
-                                   "v 0.733291 -0.555570 -0.391952\n"
-                                   "v 0.681734 -0.634393 -0.364395\n"
-                                   "v 0.623613 -0.707107 -0.333328\n"
-                                   "v 0.559485 -0.773010 -0.299051\n"
-                                   "v 0.489969 -0.831470 -0.261894\n"
-                                   "v 0.415735 -0.881921 -0.222215\n"
-                                   "v 0.337497 -0.923880 -0.180396\n"
-                                   "v 0.256008 -0.956940 -0.136839\n"
-                                   "v 0.172054 -0.980785 -0.091965\n"
-                                   "v 0.086443 -0.995185 -0.046205\n"
-                                   "v 0.090556 0.995185 -0.037509\n"
-                                   "v 0.180240 0.980785 -0.074658\n"
-                                   "v 0.268188 0.956940 -0.111087\n"
-                                   "v 0.353553 0.923880 -0.146447\n"
-                                   "v 0.435514 0.881921 -0.180396\n"
-                                   "v 0.513280 0.831470 -0.212608\n"
-                                   "v 0.586103 0.773010 -0.242772\n"
-                                   "v 0.653282 0.707107 -0.270598\n"
-                                   "v 0.714168 0.634393 -0.295818\n"
-                                   "v 0.768178 0.555570 -0.318190\n"
-                                   "v 0.814789 0.471397 -0.337497\n"
-                                   "v 0.853553 0.382683 -0.353553\n"
-                                   "v 0.884098 0.290285 -0.366205\n"
-                                   "v 0.906127 0.195090 -0.375330\n"
-                                   "v 0.919431 0.098017 -0.380841\n"
-                                   "v 0.923879 -0.000000 -0.382683\n"
-                                   "v 0.919431 -0.098017 -0.380841\n"
-                                   "v 0.906127 -0.195090 -0.375330\n"
-                                   "v 0.884098 -0.290285 -0.366205\n"
-                                   "v 0.853553 -0.382683 -0.353553\n"
-                                   "v 0.814789 -0.471397 -0.337497\n"
-                                   "v 0.768178 -0.555570 -0.318190\n"
-                                   "v 0.714168 -0.634393 -0.295818\n"
-                                   "v 0.653282 -0.707107 -0.270598\n"
-                                   "v 0.586103 -0.773010 -0.242772\n"
-                                   "v 0.513280 -0.831470 -0.212608\n"
-                                   "v 0.435514 -0.881921 -0.180396\n"
-                                   "v 0.353553 -0.923880 -0.146447\n"
-                                   "v 0.268188 -0.956940 -0.111087\n"
-                                   "v 0.180240 -0.980785 -0.074658\n"
-                                   "v 0.090556 -0.995185 -0.037509\n"
-                                   "v 0.093797 0.995185 -0.028453\n"
-                                   "v 0.186690 0.980785 -0.056632\n"
-                                   "v 0.277785 0.956940 -0.084265\n"
-                                   "v 0.366205 0.923880 -0.111087\n"
-                                   "v 0.451099 0.881921 -0.136839\n"
-                                   "v 0.531648 0.831470 -0.161274\n"
-                                   "v 0.607077 0.773010 -0.184155\n"
-                                   "v 0.676659 0.707107 -0.205262\n"
-                                   "v 0.739725 0.634393 -0.224393\n"
-                                   "v 0.795667 0.555570 -0.241363\n"
-                                   "v 0.843946 0.471397 -0.256008\n"
-                                   "v 0.884098 0.382683 -0.268188\n"
-                                   "v 0.915735 0.290285 -0.277785\n"
-                                   "v 0.938553 0.195090 -0.284707\n"
-                                   "v 0.952332 0.098017 -0.288887\n"
-                                   "v 0.956940 -0.000000 -0.290285\n"
-                                   "v 0.952332 -0.098017 -0.288887\n"
-                                   "v 0.938553 -0.195090 -0.284707\n"
-                                   "v 0.915735 -0.290285 -0.277785\n"
-                                   "v 0.884098 -0.382683 -0.268188\n"
-                                   "v 0.843946 -0.471397 -0.256008\n"
-                                   "v 0.795667 -0.555570 -0.241363\n"
-                                   "v 0.739725 -0.634393 -0.224393\n"
-                                   "v 0.676659 -0.707107 -0.205262\n"
-                                   "v 0.607077 -0.773010 -0.184155\n"
-                                   "v 0.531648 -0.831470 -0.161274\n"
-                                   "v 0.451099 -0.881921 -0.136839\n"
-                                   "v 0.366205 -0.923880 -0.111087\n"
-                                   "v 0.277785 -0.956940 -0.084265\n"
-                                   "v 0.186690 -0.980785 -0.056632\n"
-                                   "v 0.093797 -0.995185 -0.028453\n"
-                                   "v 0.096134 0.995185 -0.019122\n"
-                                   "v 0.191342 0.980785 -0.038060\n"
-                                   "v 0.284707 0.956940 -0.056632\n"
-                                   "v 0.375330 0.923880 -0.074658\n"
-                                   "v 0.462339 0.881921 -0.091965\n"
-                                   "v 0.544895 0.831470 -0.108386\n"
-                                   "v 0.622204 0.773010 -0.123764\n"
-                                   "v 0.693520 0.707107 -0.137950\n"
-                                   "v 0.758157 0.634393 -0.150807\n"
-                                   "v 0.815493 0.555570 -0.162212\n"
-                                   "v 0.864975 0.471397 -0.172054\n"
-                                   "v 0.906127 0.382683 -0.180240\n"
-                                   "v 0.938553 0.290285 -0.186690\n"
-                                   "v 0.961940 0.195090 -0.191342\n"
-                                   "v 0.976063 0.098017 -0.194151\n"
-                                   "v 0.980785 -0.000000 -0.195090\n"
-                                   "v 0.976063 -0.098017 -0.194151\n"
-                                   "v 0.961940 -0.195090 -0.191342\n"
-                                   "v 0.938553 -0.290285 -0.186690\n"
-                                   "v 0.906128 -0.382683 -0.180240\n"
-                                   "v 0.864975 -0.471397 -0.172054\n"
-                                   "v 0.815493 -0.555570 -0.162212\n"
-                                   "v 0.758157 -0.634393 -0.150807\n"
-                                   "v 0.693520 -0.707107 -0.137950\n"
-                                   "v 0.622204 -0.773010 -0.123764\n"
-                                   "v 0.544895 -0.831470 -0.108386\n"
-                                   "v 0.462339 -0.881921 -0.091965\n"
-                                   "v 0.375330 -0.923880 -0.074658\n"
-                                   "v 0.284707 -0.956940 -0.056632\n"
-                                   "v 0.191342 -0.980785 -0.038060\n"
-                                   "v 0.096134 -0.995185 -0.019122\n"
-                                   "v 0.097545 0.995185 -0.009607\n"
-                                   "v 0.194151 0.980785 -0.019122\n"
-                                   "v 0.288887 0.956940 -0.028453\n"
-                                   "v 0.380841 0.923880 -0.037509\n"
-                                   "v 0.469127 0.881921 -0.046205\n"
-                                   "v 0.552895 0.831470 -0.054455\n"
-                                   "v 0.631338 0.773010 -0.062181\n"
-                                   "v 0.703702 0.707107 -0.069308\n"
-                                   "v 0.769288 0.634393 -0.075768\n"
-                                   "v 0.827466 0.555570 -0.081498\n"
-                                   "v 0.877674 0.471397 -0.086443\n"
-                                   "v 0.919431 0.382683 -0.090556\n"
-                                   "v 0.952332 0.290285 -0.093797\n"
-                                   "v 0.976062 0.195090 -0.096134\n"
-                                   "v 0.990393 0.098017 -0.097545\n"
-                                   "v 0.995185 -0.000000 -0.098017\n"
-                                   "v 0.990393 -0.098017 -0.097545\n"
-                                   "v 0.976062 -0.195090 -0.096134\n"
-                                   "v 0.952332 -0.290285 -0.093797\n"
-                                   "v 0.919431 -0.382683 -0.090556\n"
-                                   "v 0.877674 -0.471397 -0.086443\n"
-                                   "v 0.827466 -0.555570 -0.081498\n"
-                                   "v 0.769288 -0.634393 -0.075768\n"
-                                   "v 0.703702 -0.707107 -0.069308\n"
-                                   "v 0.631338 -0.773010 -0.062181\n"
-                                   "v 0.552895 -0.831470 -0.054455\n"
-                                   "v 0.469127 -0.881921 -0.046205\n"
-                                   "v 0.380841 -0.923880 -0.037509\n"
-                                   "v 0.288887 -0.956940 -0.028453\n"
-                                   "v 0.194151 -0.980785 -0.019122\n"
-                                   "v 0.097545 -0.995185 -0.009607\n"
-                                   "v 0.098017 0.995185 0.000000\n"
-                                   "v 0.195090 0.980785 0.000000\n"
-                                   "v 0.290285 0.956940 0.000000\n"
-                                   "v 0.382683 0.923880 0.000000\n"
-                                   "v 0.471397 0.881921 0.000000\n"
-                                   "v 0.555570 0.831470 0.000000\n"
-                                   "v 0.634393 0.773010 0.000000\n"
-                                   "v 0.707107 0.707107 0.000000\n"
-                                   "v 0.773010 0.634393 0.000000\n"
-                                   "v 0.831470 0.555570 0.000000\n"
-                                   "v 0.881921 0.471397 -0.000000\n"
-                                   "v 0.923879 0.382683 0.000000\n"
-                                   "v 0.956940 0.290285 -0.000000\n"
-                                   "v 0.980785 0.195090 0.000000\n"
-                                   "v 0.995185 0.098017 0.000000\n"
-                                   "v 1.000000 -0.000000 0.000000\n"
-                                   "v 0.995185 -0.098017 0.000000\n"
-                                   "v 0.980785 -0.195090 0.000000\n"
-                                   "v 0.956940 -0.290285 0.000000\n"
-                                   "v 0.923880 -0.382683 0.000000\n"
-                                   "v 0.881921 -0.471397 0.000000\n"
-                                   "v 0.831470 -0.555570 0.000000\n"
-                                   "v 0.773010 -0.634393 0.000000\n"
-                                   "v 0.707107 -0.707107 0.000000\n"
-                                   "v 0.634393 -0.773010 0.000000\n"
-                                   "v 0.555570 -0.831470 0.000000\n"
-                                   "v 0.471397 -0.881921 0.000000\n"
-                                   "v 0.382683 -0.923880 0.000000\n"
-                                   "v 0.290285 -0.956940 0.000000\n"
-                                   "v 0.195090 -0.980785 0.000000\n"
-                                   "v 0.098017 -0.995185 0.000000\n"
-                                   "v 0.097545 0.995185 0.009607\n"
-                                   "v 0.194151 0.980785 0.019122\n"
-                                   "v 0.288887 0.956940 0.028453\n"
-                                   "v 0.380841 0.923880 0.037510\n"
-                                   "v 0.469127 0.881921 0.046205\n"
-                                   "v 0.552895 0.831470 0.054455\n"
-                                   "v 0.631338 0.773010 0.062181\n"
-                                   "v 0.703702 0.707107 0.069309\n"
-                                   "v 0.769288 0.634393 0.075768\n"
-                                   "v 0.827466 0.555570 0.081498\n"
-                                   "v 0.877674 0.471397 0.086443\n"
-                                   "v 0.919431 0.382683 0.090556\n"
-                                   "v 0.952332 0.290285 0.093797\n"
-                                   "v 0.976062 0.195090 0.096134\n"
-                                   "v 0.990393 0.098017 0.097545\n"
-                                   "v 0.995185 -0.000000 0.098017\n"
-                                   "v 0.990393 -0.098017 0.097545\n"
-                                   "v 0.976062 -0.195090 0.096134\n"
-                                   "v 0.952332 -0.290285 0.093797\n"
-                                   "v 0.919431 -0.382683 0.090556\n"
-                                   "v 0.877674 -0.471397 0.086443\n"
-                                   "v 0.827466 -0.555570 0.081498\n"
-                                   "v 0.769288 -0.634393 0.075768\n"
-                                   "v 0.703702 -0.707107 0.069309\n"
-                                   "v 0.631338 -0.773010 0.062181\n"
-                                   "v 0.552895 -0.831470 0.054455\n"
-                                   "v 0.469127 -0.881921 0.046205\n"
-                                   "v 0.380841 -0.923880 0.037510\n"
-                                   "v 0.288887 -0.956940 0.028453\n"
-                                   "v 0.194151 -0.980785 0.019122\n"
-                                   "v 0.097545 -0.995185 0.009607\n"
-                                   "v 0.096134 0.995185 0.019122\n"
-                                   "v 0.191342 0.980785 0.038060\n"
-                                   "v 0.284707 0.956940 0.056632\n"
-                                   "v 0.375330 0.923880 0.074658\n"
-                                   "v 0.462339 0.881921 0.091965\n"
-                                   "v 0.544895 0.831470 0.108386\n"
-                                   "v 0.622203 0.773010 0.123764\n"
-                                   "v 0.693520 0.707107 0.137950\n"
-                                   "v 0.758157 0.634393 0.150807\n"
-                                   "v 0.815493 0.555570 0.162212\n"
-                                   "v 0.864975 0.471397 0.172054\n"
-                                   "v 0.906127 0.382683 0.180240\n"
-                                   "v 0.938553 0.290285 0.186690\n"
-                                   "v 0.961940 0.195090 0.191342\n"
-                                   "v 0.976062 0.098017 0.194151\n"
-                                   "v 0.980785 -0.000000 0.195090\n"
-                                   "v 0.976062 -0.098017 0.194151\n"
-                                   "v 0.961940 -0.195090 0.191342\n"
-                                   "v 0.938553 -0.290285 0.186690\n"
-                                   "v 0.906128 -0.382683 0.180240\n"
-                                   "v 0.864975 -0.471397 0.172054\n"
-                                   "v 0.815493 -0.555570 0.162212\n"
-                                   "v 0.758157 -0.634393 0.150807\n"
-                                   "v 0.693520 -0.707107 0.137950\n"
-                                   "v 0.622203 -0.773010 0.123764\n"
-                                   "v 0.544895 -0.831470 0.108386\n"
-                                   "v 0.462339 -0.881921 0.091965\n"
-                                   "v 0.375330 -0.923880 0.074658\n"
-                                   "v 0.284707 -0.956940 0.056632\n"
-                                   "v 0.191342 -0.980785 0.038060\n"
-                                   "v 0.096134 -0.995185 0.019122\n"
-                                   "v 0.093797 0.995185 0.028453\n"
-                                   "v 0.186690 0.980785 0.056632\n"
-                                   "v 0.277785 0.956940 0.084265\n"
-                                   "v 0.366205 0.923880 0.111087\n"
-                                   "v 0.451098 0.881921 0.136839\n"
-                                   "v 0.531648 0.831470 0.161274\n"
-                                   "v 0.607076 0.773010 0.184155\n"
-                                   "v 0.676659 0.707107 0.205262\n"
-                                   "v 0.739725 0.634393 0.224393\n"
-                                   "v 0.795667 0.555570 0.241363\n"
-                                   "v 0.843946 0.471397 0.256008\n"
-                                   "v 0.884097 0.382683 0.268188\n"
-                                   "v 0.915735 0.290285 0.277785\n"
-                                   "v 0.938553 0.195090 0.284707\n"
-                                   "v 0.952332 0.098017 0.288887\n"
-                                   "v 0.956940 -0.000000 0.290285\n"
-                                   "v 0.952332 -0.098017 0.288887\n"
-                                   "v 0.938553 -0.195090 0.284707\n"
-                                   "v 0.915735 -0.290285 0.277785\n"
-                                   "v 0.884098 -0.382683 0.268188\n"
-                                   "v 0.843946 -0.471397 0.256008\n"
-                                   "v 0.795667 -0.555570 0.241363\n"
-                                   "v 0.739725 -0.634393 0.224393\n"
-                                   "v 0.676659 -0.707107 0.205262\n"
-                                   "v 0.607076 -0.773010 0.184155\n"
-                                   "v 0.531648 -0.831470 0.161274\n"
-                                   "v 0.451099 -0.881921 0.136839\n"
-                                   "v 0.366205 -0.923880 0.111087\n"
-                                   "v 0.277785 -0.956940 0.084265\n"
-                                   "v 0.186690 -0.980785 0.056632\n"
-                                   "v 0.093797 -0.995185 0.028453\n"
-                                   "v 0.090556 0.995185 0.037510\n"
-                                   "v 0.180240 0.980785 0.074658\n"
-                                   "v 0.268188 0.956940 0.111087\n"
-                                   "v 0.353553 0.923880 0.146447\n"
-                                   "v 0.435514 0.881921 0.180396\n"
-                                   "v 0.513280 0.831470 0.212608\n"
-                                   "v 0.586103 0.773010 0.242772\n"
-                                   "v 0.653281 0.707107 0.270598\n"
-                                   "v 0.714168 0.634393 0.295818\n"
-                                   "v 0.768178 0.555570 0.318190\n"
-                                   "v 0.814789 0.471397 0.337497\n"
-                                   "v 0.853553 0.382683 0.353553\n"
-                                   "v 0.884098 0.290285 0.366205\n"
-                                   "v 0.906127 0.195090 0.375330\n"
-                                   "v 0.919431 0.098017 0.380841\n"
-                                   "v 0.923879 -0.000000 0.382683\n"
-                                   "v 0.919431 -0.098017 0.380841\n"
-                                   "v 0.906127 -0.195090 0.375330\n"
-                                   "v 0.884098 -0.290285 0.366205\n"
-                                   "v 0.853553 -0.382683 0.353553\n"
-                                   "v 0.814789 -0.471397 0.337497\n"
-                                   "v 0.768178 -0.555570 0.318190\n"
-                                   "v 0.714168 -0.634393 0.295818\n"
-                                   "v 0.653281 -0.707107 0.270598\n"
-                                   "v 0.586103 -0.773010 0.242772\n"
-                                   "v 0.513280 -0.831470 0.212608\n"
-                                   "v 0.435514 -0.881921 0.180396\n"
-                                   "v 0.353553 -0.923880 0.146447\n"
-                                   "v 0.268188 -0.956940 0.111087\n"
-                                   "v 0.180240 -0.980785 0.074658\n"
-                                   "v 0.090556 -0.995185 0.037510\n"
-                                   "v 0.086443 0.995185 0.046205\n"
-                                   "v 0.172054 0.980785 0.091965\n"
-                                   "v 0.256008 0.956940 0.136839\n"
-                                   "v 0.337496 0.923880 0.180396\n"
-                                   "v 0.415735 0.881921 0.222215\n"
-                                   "v 0.489969 0.831470 0.261894\n"
-                                   "v 0.559485 0.773010 0.299051\n"
-                                   "v 0.623612 0.707107 0.333328\n"
-                                   "v 0.681734 0.634393 0.364395\n"
-                                   "v 0.733291 0.555570 0.391952\n"
-                                   "v 0.777785 0.471397 0.415735\n"
-                                   "v 0.814789 0.382683 0.435514\n"
-                                   "v 0.843946 0.290285 0.451099\n"
-                                   "v 0.864975 0.195090 0.462339\n"
-                                   "v 0.877674 0.098017 0.469127\n"
-                                   "v 0.881921 -0.000000 0.471397\n"
-                                   "v 0.877674 -0.098017 0.469127\n"
-                                   "v 0.864975 -0.195090 0.462339\n"
-                                   "v 0.843946 -0.290285 0.451099\n"
-                                   "v 0.814789 -0.382683 0.435514\n"
-                                   "v 0.777785 -0.471397 0.415735\n"
-                                   "v 0.733291 -0.555570 0.391952\n"
-                                   "v 0.681734 -0.634393 0.364395\n"
-                                   "v 0.623612 -0.707107 0.333328\n"
-                                   "v 0.559485 -0.773010 0.299051\n"
-                                   "v 0.489969 -0.831470 0.261894\n"
-                                   "v 0.415735 -0.881921 0.222215\n"
-                                   "v 0.337497 -0.923880 0.180396\n"
-                                   "v 0.256008 -0.956940 0.136839\n"
-                                   "v 0.172054 -0.980785 0.091965\n"
-                                   "v 0.086443 -0.995185 0.046205\n"
-                                   "v 0.081498 0.995185 0.054456\n"
-                                   "v 0.162212 0.980785 0.108387\n"
-                                   "v 0.241363 0.956940 0.161274\n"
-                                   "v 0.318189 0.923880 0.212608\n"
-                                   "v 0.391952 0.881921 0.261894\n"
-                                   "v 0.461940 0.831470 0.308658\n"
-                                   "v 0.527479 0.773010 0.352450\n"
-                                   "v 0.587938 0.707107 0.392848\n"
-                                   "v 0.642735 0.634393 0.429462\n"
-                                   "v 0.691342 0.555570 0.461940\n"
-                                   "v 0.733290 0.471397 0.489969\n"
-                                   "v 0.768178 0.382683 0.513280\n"
-                                   "v 0.795667 0.290285 0.531648\n"
-                                   "v 0.815493 0.195090 0.544895\n"
-                                   "v 0.827466 0.098017 0.552895\n"
-                                   "v 0.831469 -0.000000 0.555570\n"
-                                   "v 0.827466 -0.098017 0.552895\n"
-                                   "v 0.815493 -0.195090 0.544895\n"
-                                   "v 0.795667 -0.290285 0.531648\n"
-                                   "v 0.768178 -0.382683 0.513280\n"
-                                   "v 0.733290 -0.471397 0.489969\n"
-                                   "v 0.691342 -0.555570 0.461940\n"
-                                   "v 0.642735 -0.634393 0.429462\n"
-                                   "v 0.587938 -0.707107 0.392848\n"
-                                   "v 0.527479 -0.773010 0.352450\n"
-                                   "v 0.461940 -0.831470 0.308658\n"
-                                   "v 0.391952 -0.881921 0.261894\n"
-                                   "v 0.318190 -0.923880 0.212608\n"
-                                   "v 0.241363 -0.956940 0.161274\n"
-                                   "v 0.162212 -0.980785 0.108387\n"
-                                   "v 0.081498 -0.995185 0.054456\n"
-                                   "v 0.075768 0.995185 0.062182\n"
-                                   "v 0.150807 0.980785 0.123764\n"
-                                   "v 0.224393 0.956940 0.184155\n"
-                                   "v 0.295818 0.923880 0.242772\n"
-                                   "v 0.364394 0.881921 0.299051\n"
-                                   "v 0.429462 0.831470 0.352450\n"
-                                   "v 0.490393 0.773010 0.402455\n"
-                                   "v 0.546601 0.707107 0.448584\n"
-                                   "v 0.597545 0.634393 0.490393\n"
-                                   "v 0.642735 0.555570 0.527479\n"
-                                   "v 0.681734 0.471397 0.559485\n"
-                                   "v 0.714168 0.382683 0.586103\n"
-                                   "v 0.739725 0.290285 0.607077\n"
-                                   "v 0.758157 0.195090 0.622204\n"
-                                   "v 0.769288 0.098017 0.631338\n"
-                                   "v 0.773010 -0.000000 0.634393\n"
-                                   "v 0.769288 -0.098017 0.631338\n"
-                                   "v 0.758157 -0.195090 0.622204\n"
-                                   "v 0.739725 -0.290285 0.607077\n"
-                                   "v 0.714168 -0.382683 0.586103\n"
-                                   "v 0.681734 -0.471397 0.559485\n"
-                                   "v 0.642735 -0.555570 0.527479\n"
-                                   "v 0.597545 -0.634393 0.490393\n"
-                                   "v 0.546601 -0.707107 0.448584\n"
-                                   "v 0.490393 -0.773010 0.402455\n"
-                                   "v 0.429462 -0.831470 0.352450\n"
-                                   "v 0.364395 -0.881921 0.299051\n"
-                                   "v 0.295818 -0.923880 0.242772\n"
-                                   "v 0.224393 -0.956940 0.184155\n"
-                                   "v 0.150807 -0.980785 0.123764\n"
-                                   "v 0.075768 -0.995185 0.062182\n"
-                                   "v 0.069309 0.995185 0.069309\n"
-                                   "v 0.137950 0.980785 0.137950\n"
-                                   "v 0.205262 0.956940 0.205262\n"
-                                   "v 0.270598 0.923880 0.270598\n"
-                                   "v 0.333328 0.881921 0.333328\n"
-                                   "v 0.392848 0.831470 0.392848\n"
-                                   "v 0.448584 0.773010 0.448584\n"
-                                   "v 0.500000 0.707107 0.500000\n"
-                                   "v 0.546601 0.634393 0.546601\n"
-                                   "v 0.587938 0.555570 0.587938\n"
-                                   "v 0.623612 0.471397 0.623612\n"
-                                   "v 0.653281 0.382683 0.653281\n"
-                                   "v 0.676659 0.290285 0.676659\n"
-                                   "v 0.693520 0.195090 0.693520\n"
-                                   "v 0.703702 0.098017 0.703702\n"
-                                   "v 0.707107 -0.000000 0.707107\n"
-                                   "v 0.703702 -0.098017 0.703702\n"
-                                   "v 0.693520 -0.195090 0.693520\n"
-                                   "v 0.676659 -0.290285 0.676659\n"
-                                   "v 0.653281 -0.382683 0.653282\n"
-                                   "v 0.623612 -0.471397 0.623612\n"
-                                   "v 0.587938 -0.555570 0.587938\n"
-                                   "v 0.546601 -0.634393 0.546601\n"
-                                   "v 0.500000 -0.707107 0.500000\n"
-                                   "v 0.448584 -0.773010 0.448584\n"
-                                   "v 0.392848 -0.831470 0.392848\n"
-                                   "v 0.333328 -0.881921 0.333328\n"
-                                   "v 0.270598 -0.923880 0.270598\n"
-                                   "v 0.205262 -0.956940 0.205262\n"
-                                   "v 0.137950 -0.980785 0.137950\n"
-                                   "v 0.069309 -0.995185 0.069309\n"
-                                   "v 0.062181 0.995185 0.075768\n"
-                                   "v 0.123764 0.980785 0.150807\n"
-                                   "v 0.184155 0.956940 0.224393\n"
-                                   "v 0.242772 0.923880 0.295818\n"
-                                   "v 0.299051 0.881921 0.364395\n"
-                                   "v 0.352450 0.831470 0.429462\n"
-                                   "v 0.402455 0.773010 0.490393\n"
-                                   "v 0.448584 0.707107 0.546601\n"
-                                   "v 0.490392 0.634393 0.597545\n"
-                                   "v 0.527479 0.555570 0.642735\n"
-                                   "v 0.559485 0.471397 0.681734\n"
-                                   "v 0.586103 0.382683 0.714168\n"
-                                   "v 0.607076 0.290285 0.739725\n"
-                                   "v 0.622203 0.195090 0.758157\n"
-                                   "v 0.631338 0.098017 0.769288\n"
-                                   "v 0.634393 -0.000000 0.773010\n"
-                                   "v 0.631338 -0.098017 0.769288\n"
-                                   "v 0.622203 -0.195090 0.758157\n"
-                                   "v 0.607076 -0.290285 0.739725\n"
-                                   "v 0.586103 -0.382683 0.714169\n"
-                                   "v 0.559485 -0.471397 0.681734\n"
-                                   "v 0.527479 -0.555570 0.642735\n"
-                                   "v 0.490393 -0.634393 0.597545\n"
-                                   "v 0.448584 -0.707107 0.546601\n"
-                                   "v 0.402455 -0.773010 0.490393\n"
-                                   "v 0.352450 -0.831470 0.429462\n"
-                                   "v 0.299051 -0.881921 0.364395\n"
-                                   "v 0.242772 -0.923880 0.295818\n"
-                                   "v 0.184155 -0.956940 0.224393\n"
-                                   "v 0.123764 -0.980785 0.150807\n"
-                                   "v 0.062181 -0.995185 0.075768\n"
-                                   "v 0.054455 0.995185 0.081498\n"
-                                   "v 0.108387 0.980785 0.162212\n"
-                                   "v 0.161274 0.956940 0.241363\n"
-                                   "v 0.212607 0.923880 0.318190\n"
-                                   "v 0.261894 0.881921 0.391952\n"
-                                   "v 0.308658 0.831470 0.461940\n"
-                                   "v 0.352450 0.773010 0.527479\n"
-                                   "v 0.392847 0.707107 0.587938\n"
-                                   "v 0.429461 0.634393 0.642735\n"
-                                   "v 0.461940 0.555570 0.691342\n"
-                                   "v 0.489969 0.471397 0.733290\n"
-                                   "v 0.513280 0.382683 0.768178\n"
-                                   "v 0.531648 0.290285 0.795667\n"
-                                   "v 0.544895 0.195090 0.815493\n"
-                                   "v 0.552895 0.098017 0.827466\n"
-                                   "v 0.555570 -0.000000 0.831470\n"
-                                   "v 0.552895 -0.098017 0.827466\n"
-                                   "v 0.544895 -0.195090 0.815493\n"
-                                   "v 0.531647 -0.290285 0.795667\n"
-                                   "v 0.513280 -0.382683 0.768178\n"
-                                   "v 0.489969 -0.471397 0.733291\n"
-                                   "v 0.461940 -0.555570 0.691342\n"
-                                   "v 0.429461 -0.634393 0.642735\n"
-                                   "v 0.392847 -0.707107 0.587938\n"
-                                   "v 0.352450 -0.773010 0.527479\n"
-                                   "v 0.308658 -0.831470 0.461940\n"
-                                   "v 0.261894 -0.881921 0.391952\n"
-                                   "v 0.212607 -0.923880 0.318190\n"
-                                   "v 0.161274 -0.956940 0.241363\n"
-                                   "v 0.108387 -0.980785 0.162212\n"
-                                   "v 0.054455 -0.995185 0.081498\n"
-                                   "v 0.046205 0.995185 0.086444\n"
-                                   "v 0.091965 0.980785 0.172055\n"
-                                   "v 0.136839 0.956940 0.256008\n"
-                                   "v 0.180396 0.923880 0.337497\n"
-                                   "v 0.222215 0.881921 0.415735\n"
-                                   "v 0.261894 0.831470 0.489969\n"
-                                   "v 0.299051 0.773010 0.559485\n"
-                                   "v 0.333328 0.707107 0.623613\n"
-                                   "v 0.364394 0.634393 0.681734\n"
-                                   "v 0.391952 0.555570 0.733291\n"
-                                   "v 0.415735 0.471397 0.777785\n"
-                                   "v 0.435514 0.382683 0.814789\n"
-                                   "v 0.451099 0.290285 0.843946\n"
-                                   "v 0.462339 0.195090 0.864975\n"
-                                   "v 0.469127 0.098017 0.877674\n"
-                                   "v 0.471397 -0.000000 0.881921\n"
-                                   "v 0.469127 -0.098017 0.877674\n"
-                                   "v 0.462339 -0.195090 0.864975\n"
-                                   "v 0.451098 -0.290285 0.843946\n"
-                                   "v 0.435514 -0.382683 0.814789\n"
-                                   "v 0.415735 -0.471397 0.777785\n"
-                                   "v 0.391952 -0.555570 0.733291\n"
-                                   "v 0.364394 -0.634393 0.681734\n"
-                                   "v 0.333328 -0.707107 0.623613\n"
-                                   "v 0.299051 -0.773010 0.559485\n"
-                                   "v 0.261894 -0.831470 0.489969\n"
-                                   "v 0.222215 -0.881921 0.415735\n"
-                                   "v 0.180396 -0.923880 0.337497\n"
-                                   "v 0.136839 -0.956940 0.256008\n"
-                                   "v 0.091965 -0.980785 0.172055\n"
-                                   "v 0.046205 -0.995185 0.086443\n"
-                                   "v 0.037510 0.995185 0.090556\n"
-                                   "v 0.074658 0.980785 0.180240\n"
-                                   "v 0.111087 0.956940 0.268188\n"
-                                   "v 0.146447 0.923880 0.353553\n"
-                                   "v 0.180396 0.881921 0.435514\n"
-                                   "v 0.212608 0.831470 0.513280\n"
-                                   "v 0.242772 0.773010 0.586103\n"
-                                   "v 0.270598 0.707107 0.653282\n"
-                                   "v 0.295818 0.634393 0.714168\n"
-                                   "v 0.318190 0.555570 0.768178\n"
-                                   "v 0.337497 0.471397 0.814789\n"
-                                   "v 0.353553 0.382683 0.853553\n"
-                                   "v 0.366205 0.290285 0.884098\n"
-                                   "v 0.375330 0.195090 0.906127\n"
-                                   "v 0.380841 0.098017 0.919431\n"
-                                   "v 0.382683 -0.000000 0.923879\n"
-                                   "v 0.380841 -0.098017 0.919431\n"
-                                   "v 0.375330 -0.195090 0.906127\n"
-                                   "v 0.366205 -0.290285 0.884098\n"
-                                   "v 0.353553 -0.382683 0.853553\n"
-                                   "v 0.337497 -0.471397 0.814789\n"
-                                   "v 0.318190 -0.555570 0.768178\n"
-                                   "v 0.295818 -0.634393 0.714168\n"
-                                   "v 0.270598 -0.707107 0.653282\n"
-                                   "v 0.242772 -0.773010 0.586103\n"
-                                   "v 0.212608 -0.831470 0.513280\n"
-                                   "v 0.180396 -0.881921 0.435514\n"
-                                   "v 0.146447 -0.923880 0.353553\n"
-                                   "v 0.111087 -0.956940 0.268188\n"
-                                   "v 0.074658 -0.980785 0.180240\n"
-                                   "v 0.037510 -0.995185 0.090556\n"
-                                   "v 0.028453 0.995185 0.093797\n"
-                                   "v 0.056632 0.980785 0.186690\n"
-                                   "v 0.084265 0.956940 0.277785\n"
-                                   "v 0.111087 0.923880 0.366205\n"
-                                   "v 0.136839 0.881921 0.451098\n"
-                                   "v 0.161274 0.831470 0.531648\n"
-                                   "v 0.184155 0.773010 0.607077\n"
-                                   "v 0.205262 0.707107 0.676659\n"
-                                   "v 0.224393 0.634393 0.739725\n"
-                                   "v 0.241363 0.555570 0.795667\n"
-                                   "v 0.256008 0.471397 0.843946\n"
-                                   "v 0.268188 0.382683 0.884097\n"
-                                   "v 0.277785 0.290285 0.915735\n"
-                                   "v 0.284707 0.195090 0.938553\n"
-                                   "v 0.288887 0.098017 0.952332\n"
-                                   "v 0.290284 -0.000000 0.956940\n"
-                                   "v 0.288887 -0.098017 0.952332\n"
-                                   "v 0.284707 -0.195090 0.938553\n"
-                                   "v 0.277785 -0.290285 0.915735\n"
-                                   "v 0.268188 -0.382683 0.884098\n"
-                                   "v 0.256008 -0.471397 0.843946\n"
-                                   "v 0.241363 -0.555570 0.795667\n"
-                                   "v 0.224393 -0.634393 0.739725\n"
-                                   "v 0.205262 -0.707107 0.676659\n"
-                                   "v 0.184155 -0.773010 0.607077\n"
-                                   "v 0.161274 -0.831470 0.531648\n"
-                                   "v 0.136839 -0.881921 0.451099\n"
-                                   "v 0.111087 -0.923880 0.366205\n"
-                                   "v 0.084265 -0.956940 0.277785\n"
-                                   "v 0.056632 -0.980785 0.186690\n"
-                                   "v 0.028453 -0.995185 0.093797\n"
-                                   "v 0.019122 0.995185 0.096134\n"
-                                   "v 0.038060 0.980785 0.191342\n"
-                                   "v 0.056632 0.956940 0.284707\n"
-                                   "v 0.074658 0.923880 0.375330\n"
-                                   "v 0.091965 0.881921 0.462339\n"
-                                   "v 0.108386 0.831470 0.544895\n"
-                                   "v 0.123764 0.773010 0.622204\n"
-                                   "v 0.137950 0.707107 0.693520\n"
-                                   "v 0.150807 0.634393 0.758157\n"
-                                   "v 0.162212 0.555570 0.815493\n"
-                                   "v 0.172054 0.471397 0.864975\n"
-                                   "v 0.180240 0.382683 0.906127\n"
-                                   "v 0.186690 0.290285 0.938553\n"
-                                   "v 0.191342 0.195090 0.961940\n"
-                                   "v 0.194151 0.098017 0.976062\n"
-                                   "v 0.195090 -0.000000 0.980785\n"
-                                   "v 0.194151 -0.098017 0.976062\n"
-                                   "v 0.191342 -0.195090 0.961940\n"
-                                   "v 0.186690 -0.290285 0.938553\n"
-                                   "v 0.180240 -0.382683 0.906127\n"
-                                   "v 0.172054 -0.471397 0.864975\n"
-                                   "v 0.162212 -0.555570 0.815493\n"
-                                   "v 0.150807 -0.634393 0.758157\n"
-                                   "v 0.137950 -0.707107 0.693520\n"
-                                   "v 0.123764 -0.773010 0.622204\n"
-                                   "v 0.108386 -0.831470 0.544895\n"
-                                   "v 0.091965 -0.881921 0.462339\n"
-                                   "v 0.074658 -0.923880 0.375330\n"
-                                   "v 0.056632 -0.956940 0.284707\n"
-                                   "v 0.038060 -0.980785 0.191342\n"
-                                   "v 0.019122 -0.995185 0.096134\n"
-                                   "v 0.009607 0.995185 0.097545\n"
-                                   "v 0.019122 0.980785 0.194151\n"
-                                   "v 0.028453 0.956940 0.288887\n"
-                                   "v 0.037510 0.923880 0.380841\n"
-                                   "v 0.046205 0.881921 0.469127\n"
-                                   "v 0.054456 0.831470 0.552895\n"
-                                   "v 0.062181 0.773010 0.631338\n"
-                                   "v 0.069308 0.707107 0.703702\n"
-                                   "v 0.075768 0.634393 0.769288\n"
-                                   "v 0.081498 0.555570 0.827466\n"
-                                   "v 0.086443 0.471397 0.877674\n"
-                                   "v 0.090556 0.382683 0.919430\n"
-                                   "v 0.093797 0.290285 0.952332\n"
-                                   "v 0.096134 0.195090 0.976062\n"
-                                   "v 0.097545 0.098017 0.990392\n"
-                                   "v 0.098017 -0.000000 0.995185\n"
-                                   "v 0.097545 -0.098017 0.990392\n"
-                                   "v 0.096134 -0.195090 0.976062\n"
-                                   "v 0.093796 -0.290285 0.952332\n"
-                                   "v 0.090556 -0.382683 0.919431\n"
-                                   "v 0.086443 -0.471397 0.877674\n"
-                                   "v 0.081498 -0.555570 0.827466\n"
-                                   "v 0.075768 -0.634393 0.769288\n"
-                                   "v 0.069308 -0.707107 0.703702\n"
-                                   "v 0.062181 -0.773010 0.631338\n"
-                                   "v 0.054456 -0.831470 0.552895\n"
-                                   "v 0.046205 -0.881921 0.469127\n"
-                                   "v 0.037510 -0.923880 0.380841\n"
-                                   "v 0.028453 -0.956940 0.288887\n"
-                                   "v 0.019122 -0.980785 0.194151\n"
-                                   "v 0.009607 -0.995185 0.097545\n"
-                                   "v 0.000000 0.995185 0.098017\n"
-                                   "v 0.000000 0.980785 0.195091\n"
-                                   "v -0.000000 0.956940 0.290285\n"
-                                   "v 0.000000 0.923880 0.382683\n"
-                                   "v -0.000000 0.881921 0.471397\n"
-                                   "v 0.000000 0.831470 0.555570\n"
-                                   "v -0.000000 0.773010 0.634393\n"
-                                   "v -0.000000 0.707107 0.707107\n"
-                                   "v -0.000000 0.634393 0.773010\n"
-                                   "v -0.000000 0.555570 0.831470\n"
-                                   "v 0.000000 0.471397 0.881921\n"
-                                   "v -0.000000 0.382683 0.923879\n"
-                                   "v 0.000000 0.290285 0.956940\n"
-                                   "v 0.000000 0.195090 0.980785\n"
-                                   "v -0.000000 0.098017 0.995184\n"
-                                   "v -0.000000 -0.000000 1.000000\n"
-                                   "v -0.000000 -0.098017 0.995184\n"
-                                   "v 0.000000 -0.195090 0.980785\n"
-                                   "v -0.000000 -0.290285 0.956940\n"
-                                   "v -0.000000 -0.382683 0.923880\n"
-                                   "v -0.000000 -0.471397 0.881921\n"
-                                   "v 0.000000 -0.555570 0.831470\n"
-                                   "v 0.000000 -0.634393 0.773010\n"
-                                   "v -0.000000 -0.707107 0.707107\n"
-                                   "v -0.000000 -0.773010 0.634393\n"
-                                   "v 0.000000 -0.831470 0.555570\n"
-                                   "v -0.000000 -0.881921 0.471397\n"
-                                   "v 0.000000 -0.923880 0.382683\n"
-                                   "v -0.000000 -0.956940 0.290285\n"
-                                   "v 0.000000 -0.980785 0.195091\n"
-                                   "v -0.000000 -0.995185 0.098017\n"
-                                   "v -0.009607 0.995185 0.097545\n"
-                                   "v -0.019122 0.980785 0.194151\n"
-                                   "v -0.028453 0.956940 0.288887\n"
-                                   "v -0.037510 0.923880 0.380840\n"
-                                   "v -0.046205 0.881921 0.469127\n"
-                                   "v -0.054455 0.831470 0.552895\n"
-                                   "v -0.062181 0.773010 0.631338\n"
-                                   "v -0.069309 0.707107 0.703702\n"
-                                   "v -0.075768 0.634393 0.769288\n"
-                                   "v -0.081498 0.555570 0.827466\n"
-                                   "v -0.086443 0.471397 0.877674\n"
-                                   "v -0.090556 0.382683 0.919430\n"
-                                   "v -0.093797 0.290285 0.952332\n"
-                                   "v -0.096134 0.195090 0.976062\n"
-                                   "v -0.097545 0.098017 0.990392\n"
-                                   "v -0.098017 -0.000000 0.995184\n"
-                                   "v -0.097545 -0.098017 0.990392\n"
-                                   "v -0.096134 -0.195090 0.976062\n"
-                                   "v -0.093797 -0.290285 0.952332\n"
-                                   "v -0.090556 -0.382683 0.919431\n"
-                                   "v -0.086443 -0.471397 0.877674\n"
-                                   "v -0.081498 -0.555570 0.827466\n"
-                                   "v -0.075768 -0.634393 0.769288\n"
-                                   "v -0.069309 -0.707107 0.703702\n"
-                                   "v -0.062181 -0.773010 0.631338\n"
-                                   "v -0.054455 -0.831470 0.552895\n"
-                                   "v -0.046205 -0.881921 0.469127\n"
-                                   "v -0.037509 -0.923880 0.380840\n"
-                                   "v -0.028453 -0.956940 0.288887\n"
-                                   "v -0.019122 -0.980785 0.194151\n"
-                                   "v -0.009607 -0.995185 0.097545\n"
-                                   "v -0.019122 0.995185 0.096134\n"
-                                   "v -0.038060 0.980785 0.191342\n"
-                                   "v -0.056632 0.956940 0.284707\n"
-                                   "v -0.074658 0.923880 0.375330\n"
-                                   "v -0.091965 0.881921 0.462339\n"
-                                   "v -0.108386 0.831470 0.544895\n"
-                                   "v -0.123764 0.773010 0.622203\n"
-                                   "v -0.137950 0.707107 0.693520\n"
-                                   "v -0.150807 0.634393 0.758157\n"
-                                   "v -0.162212 0.555570 0.815493\n"
-                                   "v -0.172054 0.471397 0.864975\n"
-                                   "v -0.180240 0.382683 0.906127\n"
-                                   "v -0.186690 0.290285 0.938553\n"
-                                   "v -0.191342 0.195090 0.961940\n"
-                                   "v -0.194151 0.098017 0.976062\n"
-                                   "v -0.195090 -0.000000 0.980785\n"
-                                   "v -0.194151 -0.098017 0.976062\n"
-                                   "v -0.191342 -0.195090 0.961940\n"
-                                   "v -0.186690 -0.290285 0.938553\n"
-                                   "v -0.180240 -0.382683 0.906127\n"
-                                   "v -0.172054 -0.471397 0.864975\n"
-                                   "v -0.162212 -0.555570 0.815493\n"
-                                   "v -0.150807 -0.634393 0.758157\n"
-                                   "v -0.137950 -0.707107 0.693520\n"
-                                   "v -0.123764 -0.773010 0.622203\n"
-                                   "v -0.108386 -0.831470 0.544895\n"
-                                   "v -0.091965 -0.881921 0.462339\n"
-                                   "v -0.074658 -0.923880 0.375330\n"
-                                   "v -0.056632 -0.956940 0.284707\n"
-                                   "v -0.038060 -0.980785 0.191342\n"
-                                   "v -0.019122 -0.995185 0.096134\n"
-                                   "v -0.028453 0.995185 0.093797\n"
-                                   "v -0.056632 0.980785 0.186690\n"
-                                   "v -0.084265 0.956940 0.277785\n"
-                                   "v -0.111087 0.923880 0.366205\n"
-                                   "v -0.136839 0.881921 0.451098\n"
-                                   "v -0.161273 0.831470 0.531648\n"
-                                   "v -0.184155 0.773010 0.607076\n"
-                                   "v -0.205262 0.707107 0.676659\n"
-                                   "v -0.224393 0.634393 0.739725\n"
-                                   "v -0.241363 0.555570 0.795667\n"
-                                   "v -0.256008 0.471397 0.843946\n"
-                                   "v -0.268188 0.382683 0.884097\n"
-                                   "v -0.277785 0.290285 0.915735\n"
-                                   "v -0.284707 0.195090 0.938553\n"
-                                   "v -0.288887 0.098017 0.952332\n"
-                                   "v -0.290285 -0.000000 0.956940\n"
-                                   "v -0.288887 -0.098017 0.952332\n"
-                                   "v -0.284707 -0.195090 0.938553\n"
-                                   "v -0.277785 -0.290285 0.915735\n"
-                                   "v -0.268188 -0.382683 0.884098\n"
-                                   "v -0.256008 -0.471397 0.843946\n"
-                                   "v -0.241363 -0.555570 0.795667\n"
-                                   "v -0.224393 -0.634393 0.739725\n"
-                                   "v -0.205262 -0.707107 0.676659\n"
-                                   "v -0.184155 -0.773010 0.607076\n"
-                                   "v -0.161273 -0.831470 0.531648\n"
-                                   "v -0.136839 -0.881921 0.451099\n"
-                                   "v -0.111087 -0.923880 0.366205\n"
-                                   "v -0.084265 -0.956940 0.277785\n"
-                                   "v -0.056632 -0.980785 0.186690\n"
-                                   "v -0.028453 -0.995185 0.093797\n"
-                                   "v -0.037510 0.995185 0.090556\n"
-                                   "v -0.074658 0.980785 0.180240\n"
-                                   "v -0.111087 0.956940 0.268188\n"
-                                   "v -0.146446 0.923880 0.353553\n"
-                                   "v -0.180396 0.881921 0.435514\n"
-                                   "v -0.212607 0.831470 0.513280\n"
-                                   "v -0.242772 0.773010 0.586103\n"
-                                   "v -0.270598 0.707107 0.653282\n"
-                                   "v -0.295818 0.634393 0.714168\n"
-                                   "v -0.318190 0.555570 0.768178\n"
-                                   "v -0.337496 0.471397 0.814789\n"
-                                   "v -0.353553 0.382683 0.853553\n"
-                                   "v -0.366205 0.290285 0.884098\n"
-                                   "v -0.375330 0.195090 0.906127\n"
-                                   "v -0.380841 0.098017 0.919431\n"
-                                   "v -0.382683 -0.000000 0.923879\n"
-                                   "v -0.380841 -0.098017 0.919431\n"
-                                   "v -0.375330 -0.195090 0.906127\n"
-                                   "v -0.366205 -0.290285 0.884098\n"
-                                   "v -0.353553 -0.382683 0.853553\n"
-                                   "v -0.337497 -0.471397 0.814789\n"
-                                   "v -0.318190 -0.555570 0.768178\n"
-                                   "v -0.295818 -0.634393 0.714168\n"
-                                   "v -0.270598 -0.707107 0.653282\n"
-                                   "v -0.242772 -0.773010 0.586103\n"
-                                   "v -0.212607 -0.831470 0.513280\n"
-                                   "v -0.180396 -0.881921 0.435514\n"
-                                   "v -0.146446 -0.923880 0.353553\n"
-                                   "v -0.111087 -0.956940 0.268188\n"
-                                   "v -0.074658 -0.980785 0.180240\n"
-                                   "v -0.037510 -0.995185 0.090556\n"
-                                   "v 0.000000 -1.000000 0.000000\n"
-                                   "v -0.046205 0.995185 0.086444\n"
-                                   "v -0.091965 0.980785 0.172055\n"
-                                   "v -0.136839 0.956940 0.256008\n"
-                                   "v -0.180396 0.923880 0.337496\n"
-                                   "v -0.222215 0.881921 0.415735\n"
-                                   "v -0.261894 0.831470 0.489969\n"
-                                   "v -0.299051 0.773010 0.559485\n"
-                                   "v -0.333328 0.707107 0.623613\n"
-                                   "v -0.364394 0.634393 0.681734\n"
-                                   "v -0.391952 0.555570 0.733291\n"
-                                   "v -0.415735 0.471397 0.777785\n"
-                                   "v -0.435514 0.382683 0.814789\n"
-                                   "v -0.451099 0.290285 0.843946\n"
-                                   "v -0.462339 0.195090 0.864975\n"
-                                   "v -0.469127 0.098017 0.877674\n"
-                                   "v -0.471397 -0.000000 0.881921\n"
-                                   "v -0.469127 -0.098017 0.877674\n"
-                                   "v -0.462339 -0.195090 0.864975\n"
-                                   "v -0.451099 -0.290285 0.843946\n"
-                                   "v -0.435514 -0.382683 0.814789\n"
-                                   "v -0.415735 -0.471397 0.777785\n"
-                                   "v -0.391952 -0.555570 0.733291\n"
-                                   "v -0.364394 -0.634393 0.681734\n"
-                                   "v -0.333328 -0.707107 0.623613\n"
-                                   "v -0.299051 -0.773010 0.559485\n"
-                                   "v -0.261894 -0.831470 0.489969\n"
-                                   "v -0.222215 -0.881921 0.415735\n"
-                                   "v -0.180396 -0.923880 0.337496\n"
-                                   "v -0.136839 -0.956940 0.256008\n"
-                                   "v -0.091965 -0.980785 0.172055\n"
-                                   "v -0.046205 -0.995185 0.086443\n"
-                                   "v -0.054455 0.995185 0.081498\n"
-                                   "v -0.108386 0.980785 0.162212\n"
-                                   "v -0.161274 0.956940 0.241363\n"
-                                   "v -0.212607 0.923880 0.318189\n"
-                                   "v -0.261894 0.881921 0.391952\n"
-                                   "v -0.308658 0.831470 0.461940\n"
-                                   "v -0.352450 0.773010 0.527479\n"
-                                   "v -0.392848 0.707107 0.587938\n"
-                                   "v -0.429461 0.634393 0.642734\n"
-                                   "v -0.461940 0.555570 0.691342\n"
-                                   "v -0.489969 0.471397 0.733290\n"
-                                   "v -0.513280 0.382683 0.768177\n"
-                                   "v -0.531648 0.290285 0.795667\n"
-                                   "v -0.544895 0.195090 0.815493\n"
-                                   "v -0.552895 0.098017 0.827466\n"
-                                   "v -0.555570 -0.000000 0.831469\n"
-                                   "v -0.552895 -0.098017 0.827466\n"
-                                   "v -0.544895 -0.195090 0.815493\n"
-                                   "v -0.531648 -0.290285 0.795667\n"
-                                   "v -0.513280 -0.382683 0.768178\n"
-                                   "v -0.489969 -0.471397 0.733290\n"
-                                   "v -0.461940 -0.555570 0.691342\n"
-                                   "v -0.429461 -0.634393 0.642735\n"
-                                   "v -0.392848 -0.707107 0.587938\n"
-                                   "v -0.352450 -0.773010 0.527479\n"
-                                   "v -0.308658 -0.831470 0.461940\n"
-                                   "v -0.261894 -0.881921 0.391952\n"
-                                   "v -0.212607 -0.923880 0.318189\n"
-                                   "v -0.161274 -0.956940 0.241363\n"
-                                   "v -0.108386 -0.980785 0.162212\n"
-                                   "v -0.054455 -0.995185 0.081498\n"
-                                   "v -0.062181 0.995185 0.075768\n"
-                                   "v -0.123764 0.980785 0.150807\n"
-                                   "v -0.184155 0.956940 0.224393\n"
-                                   "v -0.242772 0.923880 0.295818\n"
-                                   "v -0.299051 0.881921 0.364395\n"
-                                   "v -0.352450 0.831470 0.429462\n"
-                                   "v -0.402455 0.773010 0.490393\n"
-                                   "v -0.448584 0.707107 0.546601\n"
-                                   "v -0.490392 0.634393 0.597545\n"
-                                   "v -0.527479 0.555570 0.642735\n"
-                                   "v -0.559485 0.471397 0.681734\n"
-                                   "v -0.586103 0.382683 0.714168\n"
-                                   "v -0.607076 0.290285 0.739725\n"
-                                   "v -0.622203 0.195090 0.758157\n"
-                                   "v -0.631338 0.098017 0.769288\n"
-                                   "v -0.634393 -0.000000 0.773010\n"
-                                   "v -0.631338 -0.098017 0.769288\n"
-                                   "v -0.622203 -0.195090 0.758157\n"
-                                   "v -0.607077 -0.290285 0.739725\n"
-                                   "v -0.586103 -0.382683 0.714168\n"
-                                   "v -0.559485 -0.471397 0.681734\n"
-                                   "v -0.527479 -0.555570 0.642735\n"
-                                   "v -0.490392 -0.634393 0.597545\n"
-                                   "v -0.448584 -0.707107 0.546601\n"
-                                   "v -0.402455 -0.773010 0.490393\n"
-                                   "v -0.352450 -0.831470 0.429462\n"
-                                   "v -0.299051 -0.881921 0.364395\n"
-                                   "v -0.242772 -0.923880 0.295818\n"
-                                   "v -0.184155 -0.956940 0.224393\n"
-                                   "v -0.123764 -0.980785 0.150807\n"
-                                   "v -0.062181 -0.995185 0.075768\n"
-                                   "v -0.069309 0.995185 0.069309\n"
-                                   "v -0.137950 0.980785 0.137950\n"
-                                   "v -0.205262 0.956940 0.205262\n"
-                                   "v -0.270598 0.923880 0.270598\n"
-                                   "v -0.333328 0.881921 0.333328\n"
-                                   "v -0.392848 0.831470 0.392848\n"
-                                   "v -0.448584 0.773010 0.448584\n"
-                                   "v -0.500000 0.707107 0.500000\n"
-                                   "v -0.546601 0.634393 0.546601\n"
-                                   "v -0.587938 0.555570 0.587938\n"
-                                   "v -0.623612 0.471397 0.623612\n"
-                                   "v -0.653281 0.382683 0.653281\n"
-                                   "v -0.676659 0.290285 0.676659\n"
-                                   "v -0.693520 0.195090 0.693520\n"
-                                   "v -0.703702 0.098017 0.703702\n"
-                                   "v -0.707107 -0.000000 0.707106\n"
-                                   "v -0.703702 -0.098017 0.703702\n"
-                                   "v -0.693520 -0.195090 0.693520\n"
-                                   "v -0.676659 -0.290285 0.676659\n"
-                                   "v -0.653282 -0.382683 0.653281\n"
-                                   "v -0.623612 -0.471397 0.623612\n"
-                                   "v -0.587938 -0.555570 0.587938\n"
-                                   "v -0.546601 -0.634393 0.546601\n"
-                                   "v -0.500000 -0.707107 0.500000\n"
-                                   "v -0.448584 -0.773010 0.448584\n"
-                                   "v -0.392848 -0.831470 0.392848\n"
-                                   "v -0.333328 -0.881921 0.333328\n"
-                                   "v -0.270598 -0.923880 0.270598\n"
-                                   "v -0.205262 -0.956940 0.205262\n"
-                                   "v -0.137950 -0.980785 0.137950\n"
-                                   "v -0.069309 -0.995185 0.069309\n"
-                                   "v -0.075768 0.995185 0.062182\n"
-                                   "v -0.150807 0.980785 0.123764\n"
-                                   "v -0.224393 0.956940 0.184155\n"
-                                   "v -0.295818 0.923880 0.242772\n"
-                                   "v -0.364394 0.881921 0.299051\n"
-                                   "v -0.429462 0.831470 0.352450\n"
-                                   "v -0.490393 0.773010 0.402455\n"
-                                   "v -0.546601 0.707107 0.448584\n"
-                                   "v -0.597545 0.634393 0.490392\n"
-                                   "v -0.642735 0.555570 0.527479\n"
-                                   "v -0.681734 0.471397 0.559485\n"
-                                   "v -0.714168 0.382683 0.586103\n"
-                                   "v -0.739725 0.290285 0.607076\n"
-                                   "v -0.758157 0.195090 0.622204\n"
-                                   "v -0.769288 0.098017 0.631338\n"
-                                   "v -0.773010 -0.000000 0.634393\n"
-                                   "v -0.769288 -0.098017 0.631338\n"
-                                   "v -0.758157 -0.195090 0.622204\n"
-                                   "v -0.739725 -0.290285 0.607076\n"
-                                   "v -0.714169 -0.382683 0.586103\n"
-                                   "v -0.681734 -0.471397 0.559485\n"
-                                   "v -0.642735 -0.555570 0.527479\n"
-                                   "v -0.597545 -0.634393 0.490393\n"
-                                   "v -0.546601 -0.707107 0.448584\n"
-                                   "v -0.490393 -0.773010 0.402455\n"
-                                   "v -0.429462 -0.831470 0.352450\n"
-                                   "v -0.364395 -0.881921 0.299051\n"
-                                   "v -0.295818 -0.923880 0.242772\n"
-                                   "v -0.224393 -0.956940 0.184155\n"
-                                   "v -0.150807 -0.980785 0.123764\n"
-                                   "v -0.075768 -0.995185 0.062182\n"
-                                   "v -0.081498 0.995185 0.054456\n"
-                                   "v -0.162212 0.980785 0.108387\n"
-                                   "v -0.241363 0.956940 0.161274\n"
-                                   "v -0.318189 0.923880 0.212607\n"
-                                   "v -0.391952 0.881921 0.261894\n"
-                                   "v -0.461940 0.831470 0.308659\n"
-                                   "v -0.527479 0.773010 0.352450\n"
-                                   "v -0.587938 0.707107 0.392847\n"
-                                   "v -0.642734 0.634393 0.429461\n"
-                                   "v -0.691342 0.555570 0.461940\n"
-                                   "v -0.733290 0.471397 0.489969\n"
-                                   "v -0.768177 0.382683 0.513280\n"
-                                   "v -0.795667 0.290285 0.531647\n"
-                                   "v -0.815493 0.195090 0.544895\n"
-                                   "v -0.827466 0.098017 0.552895\n"
-                                   "v -0.831469 -0.000000 0.555570\n"
-                                   "v -0.827466 -0.098017 0.552895\n"
-                                   "v -0.815493 -0.195090 0.544895\n"
-                                   "v -0.795667 -0.290285 0.531647\n"
-                                   "v -0.768178 -0.382683 0.513280\n"
-                                   "v -0.733290 -0.471397 0.489969\n"
-                                   "v -0.691342 -0.555570 0.461940\n"
-                                   "v -0.642734 -0.634393 0.429461\n"
-                                   "v -0.587938 -0.707107 0.392847\n"
-                                   "v -0.527479 -0.773010 0.352450\n"
-                                   "v -0.461940 -0.831470 0.308659\n"
-                                   "v -0.391952 -0.881921 0.261894\n"
-                                   "v -0.318189 -0.923880 0.212607\n"
-                                   "v -0.241363 -0.956940 0.161274\n"
-                                   "v -0.162212 -0.980785 0.108387\n"
-                                   "v -0.081498 -0.995185 0.054455\n"
-                                   "v -0.086443 0.995185 0.046205\n"
-                                   "v -0.172054 0.980785 0.091965\n"
-                                   "v -0.256008 0.956940 0.136839\n"
-                                   "v -0.337496 0.923880 0.180396\n"
-                                   "v -0.415735 0.881921 0.222215\n"
-                                   "v -0.489969 0.831470 0.261894\n"
-                                   "v -0.559485 0.773010 0.299051\n"
-                                   "v -0.623613 0.707107 0.333328\n"
-                                   "v -0.681734 0.634393 0.364394\n"
-                                   "v -0.733291 0.555570 0.391952\n"
-                                   "v -0.777785 0.471397 0.415735\n"
-                                   "v -0.814789 0.382683 0.435514\n"
-                                   "v -0.843946 0.290285 0.451098\n"
-                                   "v -0.864975 0.195090 0.462339\n"
-                                   "v -0.877674 0.098017 0.469127\n"
-                                   "v -0.881921 -0.000000 0.471396\n"
-                                   "v -0.877674 -0.098017 0.469127\n"
-                                   "v -0.864975 -0.195090 0.462339\n"
-                                   "v -0.843946 -0.290285 0.451098\n"
-                                   "v -0.814789 -0.382683 0.435514\n"
-                                   "v -0.777785 -0.471397 0.415735\n"
-                                   "v -0.733291 -0.555570 0.391952\n"
-                                   "v -0.681734 -0.634393 0.364395\n"
-                                   "v -0.623613 -0.707107 0.333328\n"
-                                   "v -0.559485 -0.773010 0.299051\n"
-                                   "v -0.489969 -0.831470 0.261894\n"
-                                   "v -0.415735 -0.881921 0.222215\n"
-                                   "v -0.337496 -0.923880 0.180396\n"
-                                   "v -0.256008 -0.956940 0.136839\n"
-                                   "v -0.172054 -0.980785 0.091965\n"
-                                   "v -0.086443 -0.995185 0.046205\n"
-                                   "v -0.090556 0.995185 0.037510\n"
-                                   "v -0.180240 0.980785 0.074658\n"
-                                   "v -0.268188 0.956940 0.111087\n"
-                                   "v -0.353553 0.923880 0.146447\n"
-                                   "v -0.435514 0.881921 0.180396\n"
-                                   "v -0.513280 0.831470 0.212608\n"
-                                   "v -0.586103 0.773010 0.242772\n"
-                                   "v -0.653282 0.707107 0.270598\n"
-                                   "v -0.714168 0.634393 0.295818\n"
-                                   "v -0.768178 0.555570 0.318190\n"
-                                   "v -0.814789 0.471397 0.337497\n"
-                                   "v -0.853553 0.382683 0.353553\n"
-                                   "v -0.884097 0.290285 0.366205\n"
-                                   "v -0.906127 0.195090 0.375330\n"
-                                   "v -0.919431 0.098017 0.380841\n"
-                                   "v -0.923879 -0.000000 0.382683\n"
-                                   "v -0.919431 -0.098017 0.380841\n"
-                                   "v -0.906127 -0.195090 0.375330\n"
-                                   "v -0.884098 -0.290285 0.366205\n"
-                                   "v -0.853553 -0.382683 0.353553\n"
-                                   "v -0.814789 -0.471397 0.337497\n"
-                                   "v -0.768178 -0.555570 0.318190\n"
-                                   "v -0.714168 -0.634393 0.295818\n"
-                                   "v -0.653282 -0.707107 0.270598\n"
-                                   "v -0.586103 -0.773010 0.242772\n"
-                                   "v -0.513280 -0.831470 0.212608\n"
-                                   "v -0.435514 -0.881921 0.180396\n"
-                                   "v -0.353553 -0.923880 0.146447\n"
-                                   "v -0.268188 -0.956940 0.111087\n"
-                                   "v -0.180240 -0.980785 0.074658\n"
-                                   "v -0.090556 -0.995185 0.037510\n"
-                                   "v -0.093797 0.995185 0.028453\n"
-                                   "v -0.186690 0.980785 0.056632\n"
-                                   "v -0.277785 0.956940 0.084265\n"
-                                   "v -0.366205 0.923880 0.111087\n"
-                                   "v -0.451098 0.881921 0.136839\n"
-                                   "v -0.531648 0.831470 0.161274\n"
-                                   "v -0.607076 0.773010 0.184155\n"
-                                   "v -0.676659 0.707107 0.205262\n"
-                                   "v -0.739725 0.634393 0.224393\n"
-                                   "v -0.795667 0.555570 0.241363\n"
-                                   "v -0.843946 0.471397 0.256008\n"
-                                   "v -0.884097 0.382683 0.268188\n"
-                                   "v -0.915735 0.290285 0.277785\n"
-                                   "v -0.938553 0.195090 0.284707\n"
-                                   "v -0.952332 0.098017 0.288887\n"
-                                   "v -0.956940 -0.000000 0.290284\n"
-                                   "v -0.952332 -0.098017 0.288887\n"
-                                   "v -0.938553 -0.195090 0.284707\n"
-                                   "v -0.915735 -0.290285 0.277785\n"
-                                   "v -0.884097 -0.382683 0.268188\n"
-                                   "v -0.843946 -0.471397 0.256008\n"
-                                   "v -0.795667 -0.555570 0.241363\n"
-                                   "v -0.739725 -0.634393 0.224393\n"
-                                   "v -0.676659 -0.707107 0.205262\n"
-                                   "v -0.607076 -0.773010 0.184155\n"
-                                   "v -0.531648 -0.831470 0.161274\n"
-                                   "v -0.451099 -0.881921 0.136839\n"
-                                   "v -0.366205 -0.923880 0.111087\n"
-                                   "v -0.277785 -0.956940 0.084265\n"
-                                   "v -0.186690 -0.980785 0.056632\n"
-                                   "v -0.093797 -0.995185 0.028453\n"
-                                   "v -0.096134 0.995185 0.019122\n"
-                                   "v -0.191342 0.980785 0.038060\n"
-                                   "v -0.284707 0.956940 0.056632\n"
-                                   "v -0.375330 0.923880 0.074658\n"
-                                   "v -0.462339 0.881921 0.091965\n"
-                                   "v -0.544895 0.831470 0.108387\n"
-                                   "v -0.622204 0.773010 0.123764\n"
-                                   "v -0.693520 0.707107 0.137950\n"
-                                   "v -0.758157 0.634393 0.150807\n"
-                                   "v -0.815493 0.555570 0.162212\n"
-                                   "v -0.864975 0.471397 0.172054\n"
-                                   "v -0.906127 0.382683 0.180240\n"
-                                   "v -0.938553 0.290285 0.186690\n"
-                                   "v -0.961940 0.195090 0.191342\n"
-                                   "v -0.976062 0.098017 0.194151\n"
-                                   "v -0.980785 -0.000000 0.195090\n"
-                                   "v -0.976062 -0.098017 0.194151\n"
-                                   "v -0.961940 -0.195090 0.191342\n"
-                                   "v -0.938553 -0.290285 0.186690\n"
-                                   "v -0.906127 -0.382683 0.180240\n"
-                                   "v -0.864975 -0.471397 0.172054\n"
-                                   "v -0.815493 -0.555570 0.162212\n"
-                                   "v -0.758157 -0.634393 0.150807\n"
-                                   "v -0.693520 -0.707107 0.137950\n"
-                                   "v -0.622204 -0.773010 0.123764\n"
-                                   "v -0.544895 -0.831470 0.108387\n"
-                                   "v -0.462339 -0.881921 0.091965\n"
-                                   "v -0.375330 -0.923880 0.074658\n"
-                                   "v -0.284707 -0.956940 0.056632\n"
-                                   "v -0.191342 -0.980785 0.038060\n"
-                                   "v -0.096134 -0.995185 0.019122\n"
-                                   "v -0.000000 1.000000 0.000000\n"
-                                   "v -0.097545 0.995185 0.009607\n"
-                                   "v -0.194151 0.980785 0.019122\n"
-                                   "v -0.288887 0.956940 0.028453\n"
-                                   "v -0.380840 0.923880 0.037510\n"
-                                   "v -0.469127 0.881921 0.046205\n"
-                                   "v -0.552895 0.831470 0.054456\n"
-                                   "v -0.631338 0.773010 0.062181\n"
-                                   "v -0.703702 0.707107 0.069308\n"
-                                   "v -0.769288 0.634393 0.075768\n"
-                                   "v -0.827466 0.555570 0.081498\n"
-                                   "v -0.877674 0.471397 0.086443\n"
-                                   "v -0.919430 0.382683 0.090556\n"
-                                   "v -0.952332 0.290285 0.093796\n"
-                                   "v -0.976062 0.195090 0.096134\n"
-                                   "v -0.990392 0.098017 0.097545\n"
-                                   "v -0.995184 -0.000000 0.098017\n"
-                                   "v -0.990392 -0.098017 0.097545\n"
-                                   "v -0.976062 -0.195090 0.096134\n"
-                                   "v -0.952332 -0.290285 0.093796\n"
-                                   "v -0.919431 -0.382683 0.090556\n"
-                                   "v -0.877674 -0.471397 0.086443\n"
-                                   "v -0.827466 -0.555570 0.081498\n"
-                                   "v -0.769288 -0.634393 0.075768\n"
-                                   "v -0.703702 -0.707107 0.069308\n"
-                                   "v -0.631338 -0.773010 0.062181\n"
-                                   "v -0.552895 -0.831470 0.054456\n"
-                                   "v -0.469127 -0.881921 0.046205\n"
-                                   "v -0.380840 -0.923880 0.037510\n"
-                                   "v -0.288887 -0.956940 0.028453\n"
-                                   "v -0.194151 -0.980785 0.019122\n"
-                                   "v -0.097545 -0.995185 0.009607\n"
-                                   "v -0.098017 0.995185 0.000000\n"
-                                   "v -0.195090 0.980785 0.000000\n"
-                                   "v -0.290285 0.956940 0.000000\n"
-                                   "v -0.382683 0.923880 0.000000\n"
-                                   "v -0.471397 0.881921 0.000000\n"
-                                   "v -0.555570 0.831470 0.000000\n"
-                                   "v -0.634393 0.773010 -0.000000\n"
-                                   "v -0.707107 0.707107 -0.000000\n"
-                                   "v -0.773010 0.634393 -0.000000\n"
-                                   "v -0.831470 0.555570 0.000000\n"
-                                   "v -0.881921 0.471397 0.000000\n"
-                                   "v -0.923879 0.382683 0.000000\n"
-                                   "v -0.956940 0.290285 -0.000000\n"
-                                   "v -0.980785 0.195090 0.000000\n"
-                                   "v -0.995184 0.098017 -0.000000\n"
-                                   "v -1.000000 -0.000000 -0.000000\n"
-                                   "v -0.995184 -0.098017 -0.000000\n"
-                                   "v -0.980785 -0.195090 0.000000\n"
-                                   "v -0.956940 -0.290285 -0.000000\n"
-                                   "v -0.923879 -0.382683 -0.000000\n"
-                                   "v -0.881921 -0.471397 -0.000000\n"
-                                   "v -0.831470 -0.555570 0.000000\n"
-                                   "v -0.773010 -0.634393 0.000000\n"
-                                   "v -0.707107 -0.707107 -0.000000\n"
-                                   "v -0.634393 -0.773010 -0.000000\n"
-                                   "v -0.555570 -0.831470 0.000000\n"
-                                   "v -0.471397 -0.881921 0.000000\n"
-                                   "v -0.382683 -0.923880 0.000000\n"
-                                   "v -0.290285 -0.956940 0.000000\n"
-                                   "v -0.195090 -0.980785 0.000000\n"
-                                   "v -0.098017 -0.995185 0.000000\n"
-                                   "v -0.097545 0.995185 -0.009607\n"
-                                   "v -0.194151 0.980785 -0.019122\n"
-                                   "v -0.288887 0.956940 -0.028453\n"
-                                   "v -0.380840 0.923880 -0.037509\n"
-                                   "v -0.469127 0.881921 -0.046205\n"
-                                   "v -0.552895 0.831470 -0.054455\n"
-                                   "v -0.631338 0.773010 -0.062181\n"
-                                   "v -0.703702 0.707107 -0.069309\n"
-                                   "v -0.769288 0.634393 -0.075768\n"
-                                   "v -0.827466 0.555570 -0.081498\n"
-                                   "v -0.877674 0.471397 -0.086443\n"
-                                   "v -0.919430 0.382683 -0.090556\n"
-                                   "v -0.952332 0.290285 -0.093797\n"
-                                   "v -0.976062 0.195090 -0.096134\n"
-                                   "v -0.990392 0.098017 -0.097545\n"
-                                   "v -0.995184 -0.000000 -0.098017\n"
-                                   "v -0.990392 -0.098017 -0.097545\n"
-                                   "v -0.976062 -0.195090 -0.096134\n"
-                                   "v -0.952332 -0.290285 -0.093797\n"
-                                   "v -0.919431 -0.382683 -0.090556\n"
-                                   "v -0.877674 -0.471397 -0.086443\n"
-                                   "v -0.827466 -0.555570 -0.081498\n"
-                                   "v -0.769288 -0.634393 -0.075768\n"
-                                   "v -0.703702 -0.707107 -0.069309\n"
-                                   "v -0.631338 -0.773010 -0.062181\n"
-                                   "v -0.552895 -0.831470 -0.054455\n"
-                                   "v -0.469127 -0.881921 -0.046205\n"
-                                   "v -0.380840 -0.923880 -0.037509\n"
-                                   "v -0.288887 -0.956940 -0.028453\n"
-                                   "v -0.194151 -0.980785 -0.019122\n"
-                                   "v -0.097545 -0.995185 -0.009607\n"
-                                   "v -0.096134 0.995185 -0.019122\n"
-                                   "v -0.191342 0.980785 -0.038060\n"
-                                   "v -0.284707 0.956940 -0.056632\n"
-                                   "v -0.375330 0.923880 -0.074658\n"
-                                   "v -0.462339 0.881921 -0.091965\n"
-                                   "v -0.544895 0.831470 -0.108386\n"
-                                   "v -0.622203 0.773010 -0.123764\n"
-                                   "v -0.693520 0.707107 -0.137950\n"
-                                   "v -0.758157 0.634393 -0.150807\n"
-                                   "v -0.815493 0.555570 -0.162212\n"
-                                   "v -0.864975 0.471397 -0.172054\n"
-                                   "v -0.906127 0.382683 -0.180240\n"
-                                   "v -0.938553 0.290285 -0.186690\n"
-                                   "v -0.961940 0.195090 -0.191342\n"
-                                   "v -0.976062 0.098017 -0.194151\n"
-                                   "v -0.980785 -0.000000 -0.195091\n"
-                                   "v -0.976062 -0.098017 -0.194151\n"
-                                   "v -0.961940 -0.195090 -0.191342\n"
-                                   "v -0.938553 -0.290285 -0.186690\n"
-                                   "v -0.906127 -0.382683 -0.180240\n"
-                                   "v -0.864975 -0.471397 -0.172054\n"
-                                   "v -0.815493 -0.555570 -0.162212\n"
-                                   "v -0.758157 -0.634393 -0.150807\n"
-                                   "v -0.693520 -0.707107 -0.137950\n"
-                                   "v -0.622203 -0.773010 -0.123764\n"
-                                   "v -0.544895 -0.831470 -0.108386\n"
-                                   "v -0.462339 -0.881921 -0.091965\n"
-                                   "v -0.375330 -0.923880 -0.074658\n"
-                                   "v -0.284707 -0.956940 -0.056632\n"
-                                   "v -0.191342 -0.980785 -0.038060\n"
-                                   "v -0.096134 -0.995185 -0.019122\n"
-                                   "v -0.093797 0.995185 -0.028453\n"
-                                   "v -0.186690 0.980785 -0.056632\n"
-                                   "v -0.277785 0.956940 -0.084265\n"
-                                   "v -0.366205 0.923880 -0.111087\n"
-                                   "v -0.451098 0.881921 -0.136839\n"
-                                   "v -0.531648 0.831470 -0.161273\n"
-                                   "v -0.607076 0.773010 -0.184155\n"
-                                   "v -0.676659 0.707107 -0.205262\n"
-                                   "v -0.739725 0.634393 -0.224393\n"
-                                   "v -0.795667 0.555570 -0.241363\n"
-                                   "v -0.843946 0.471397 -0.256008\n"
-                                   "v -0.884097 0.382683 -0.268188\n"
-                                   "v -0.915735 0.290285 -0.277785\n"
-                                   "v -0.938553 0.195090 -0.284707\n"
-                                   "v -0.952332 0.098017 -0.288887\n"
-                                   "v -0.956940 -0.000000 -0.290285\n"
-                                   "v -0.952332 -0.098017 -0.288887\n"
-                                   "v -0.938553 -0.195090 -0.284707\n"
-                                   "v -0.915735 -0.290285 -0.277785\n"
-                                   "v -0.884097 -0.382683 -0.268188\n"
-                                   "v -0.843946 -0.471397 -0.256008\n"
-                                   "v -0.795667 -0.555570 -0.241363\n"
-                                   "v -0.739725 -0.634393 -0.224393\n"
-                                   "v -0.676659 -0.707107 -0.205262\n"
-                                   "v -0.607076 -0.773010 -0.184155\n"
-                                   "v -0.531648 -0.831470 -0.161273\n"
-                                   "v -0.451099 -0.881921 -0.136839\n"
-                                   "v -0.366205 -0.923880 -0.111087\n"
-                                   "v -0.277785 -0.956940 -0.084265\n"
-                                   "v -0.186690 -0.980785 -0.056632\n"
-                                   "v -0.093797 -0.995185 -0.028453\n"
-                                   "v -0.090556 0.995185 -0.037509\n"
-                                   "v -0.180240 0.980785 -0.074658\n"
-                                   "v -0.268188 0.956940 -0.111087\n"
-                                   "v -0.353553 0.923880 -0.146446\n"
-                                   "v -0.435514 0.881921 -0.180396\n"
-                                   "v -0.513280 0.831470 -0.212607\n"
-                                   "v -0.586103 0.773010 -0.242772\n"
-                                   "v -0.653282 0.707107 -0.270598\n"
-                                   "v -0.714168 0.634393 -0.295818\n"
-                                   "v -0.768178 0.555570 -0.318190\n"
-                                   "v -0.814788 0.471397 -0.337496\n"
-                                   "v -0.853553 0.382683 -0.353553\n"
-                                   "v -0.884097 0.290285 -0.366205\n"
-                                   "v -0.906127 0.195090 -0.375330\n"
-                                   "v -0.919430 0.098017 -0.380841\n"
-                                   "v -0.923879 -0.000000 -0.382684\n"
-                                   "v -0.919430 -0.098017 -0.380841\n"
-                                   "v -0.906127 -0.195090 -0.375330\n"
-                                   "v -0.884098 -0.290285 -0.366205\n"
-                                   "v -0.853553 -0.382683 -0.353553\n"
-                                   "v -0.814789 -0.471397 -0.337497\n"
-                                   "v -0.768178 -0.555570 -0.318190\n"
-                                   "v -0.714168 -0.634393 -0.295818\n"
-                                   "v -0.653282 -0.707107 -0.270598\n"
-                                   "v -0.586103 -0.773010 -0.242772\n"
-                                   "v -0.513280 -0.831470 -0.212607\n"
-                                   "v -0.435514 -0.881921 -0.180396\n"
-                                   "v -0.353553 -0.923880 -0.146446\n"
-                                   "v -0.268188 -0.956940 -0.111087\n"
-                                   "v -0.180240 -0.980785 -0.074658\n"
-                                   "v -0.090556 -0.995185 -0.037509\n"
-                                   "v -0.086443 0.995185 -0.046205\n"
-                                   "v -0.172054 0.980785 -0.091965\n"
-                                   "v -0.256008 0.956940 -0.136839\n"
-                                   "v -0.337496 0.923880 -0.180395\n"
-                                   "v -0.415735 0.881921 -0.222215\n"
-                                   "v -0.489970 0.831470 -0.261894\n"
-                                   "v -0.559485 0.773010 -0.299051\n"
-                                   "v -0.623613 0.707107 -0.333328\n"
-                                   "v -0.681734 0.634393 -0.364394\n"
-                                   "v -0.733291 0.555570 -0.391952\n"
-                                   "v -0.777785 0.471397 -0.415735\n"
-                                   "v -0.814789 0.382683 -0.435513\n"
-                                   "v -0.843946 0.290285 -0.451099\n"
-                                   "v -0.864975 0.195090 -0.462339\n"
-                                   "v -0.877674 0.098017 -0.469127\n"
-                                   "v -0.881921 -0.000000 -0.471397\n"
-                                   "v -0.877674 -0.098017 -0.469127\n"
-                                   "v -0.864975 -0.195090 -0.462339\n"
-                                   "v -0.843946 -0.290285 -0.451099\n"
-                                   "v -0.814789 -0.382683 -0.435514\n"
-                                   "v -0.777785 -0.471397 -0.415735\n"
-                                   "v -0.733291 -0.555570 -0.391952\n"
-                                   "v -0.681734 -0.634393 -0.364394\n"
-                                   "v -0.623613 -0.707107 -0.333328\n"
-                                   "v -0.559485 -0.773010 -0.299051\n"
-                                   "v -0.489970 -0.831470 -0.261894\n"
-                                   "v -0.415735 -0.881921 -0.222215\n"
-                                   "v -0.337496 -0.923880 -0.180395\n"
-                                   "v -0.256008 -0.956940 -0.136839\n"
-                                   "v -0.172054 -0.980785 -0.091965\n"
-                                   "v -0.086443 -0.995185 -0.046205\n"
-                                   "v -0.081498 0.995185 -0.054455\n"
-                                   "v -0.162212 0.980785 -0.108386\n"
-                                   "v -0.241363 0.956940 -0.161274\n"
-                                   "v -0.318189 0.923880 -0.212607\n"
-                                   "v -0.391952 0.881921 -0.261894\n"
-                                   "v -0.461940 0.831470 -0.308658\n"
-                                   "v -0.527479 0.773010 -0.352450\n"
-                                   "v -0.587938 0.707107 -0.392848\n"
-                                   "v -0.642734 0.634393 -0.429461\n"
-                                   "v -0.691342 0.555570 -0.461940\n"
-                                   "v -0.733290 0.471397 -0.489969\n"
-                                   "v -0.768177 0.382683 -0.513280\n"
-                                   "v -0.795667 0.290285 -0.531648\n"
-                                   "v -0.815493 0.195090 -0.544895\n"
-                                   "v -0.827466 0.098017 -0.552895\n"
-                                   "v -0.831469 -0.000000 -0.555570\n"
-                                   "v -0.827466 -0.098017 -0.552895\n"
-                                   "v -0.815493 -0.195090 -0.544895\n"
-                                   "v -0.795667 -0.290285 -0.531648\n"
-                                   "v -0.768178 -0.382683 -0.513280\n"
-                                   "v -0.733290 -0.471397 -0.489969\n"
-                                   "v -0.691342 -0.555570 -0.461940\n"
-                                   "v -0.642734 -0.634393 -0.429461\n"
-                                   "v -0.587938 -0.707107 -0.392848\n"
-                                   "v -0.527479 -0.773010 -0.352450\n"
-                                   "v -0.461940 -0.831470 -0.308658\n"
-                                   "v -0.391952 -0.881921 -0.261894\n"
-                                   "v -0.318189 -0.923880 -0.212607\n"
-                                   "v -0.241363 -0.956940 -0.161274\n"
-                                   "v -0.162212 -0.980785 -0.108386\n"
-                                   "v -0.081498 -0.995185 -0.054455\n"
-                                   "v -0.075768 0.995185 -0.062181\n"
-                                   "v -0.150807 0.980785 -0.123764\n"
-                                   "v -0.224393 0.956940 -0.184155\n"
-                                   "v -0.295818 0.923880 -0.242772\n"
-                                   "v -0.364394 0.881921 -0.299051\n"
-                                   "v -0.429462 0.831470 -0.352450\n"
-                                   "v -0.490393 0.773010 -0.402455\n"
-                                   "v -0.546601 0.707107 -0.448584\n"
-                                   "v -0.597545 0.634393 -0.490392\n"
-                                   "v -0.642735 0.555570 -0.527479\n"
-                                   "v -0.681734 0.471397 -0.559485\n"
-                                   "v -0.714168 0.382683 -0.586103\n"
-                                   "v -0.739725 0.290285 -0.607077\n"
-                                   "v -0.758157 0.195090 -0.622204\n"
-                                   "v -0.769288 0.098017 -0.631338\n"
-                                   "v -0.773010 -0.000000 -0.634393\n"
-                                   "v -0.769288 -0.098017 -0.631338\n"
-                                   "v -0.758157 -0.195090 -0.622204\n"
-                                   "v -0.739725 -0.290285 -0.607077\n"
-                                   "v -0.714168 -0.382683 -0.586103\n"
-                                   "v -0.681734 -0.471397 -0.559485\n"
-                                   "v -0.642735 -0.555570 -0.527479\n"
-                                   "v -0.597545 -0.634393 -0.490392\n"
-                                   "v -0.546601 -0.707107 -0.448584\n"
-                                   "v -0.490393 -0.773010 -0.402455\n"
-                                   "v -0.429462 -0.831470 -0.352450\n"
-                                   "v -0.364395 -0.881921 -0.299051\n"
-                                   "v -0.295818 -0.923880 -0.242772\n"
-                                   "v -0.224393 -0.956940 -0.184155\n"
-                                   "v -0.150807 -0.980785 -0.123764\n"
-                                   "v -0.075768 -0.995185 -0.062181\n"
-                                   "v -0.069309 0.995185 -0.069309\n"
-                                   "v -0.137950 0.980785 -0.137950\n"
-                                   "v -0.205262 0.956940 -0.205262\n"
-                                   "v -0.270598 0.923880 -0.270598\n"
-                                   "v -0.333328 0.881921 -0.333328\n"
-                                   "v -0.392848 0.831470 -0.392848\n"
-                                   "v -0.448584 0.773010 -0.448584\n"
-                                   "v -0.500000 0.707107 -0.500000\n"
-                                   "v -0.546601 0.634393 -0.546601\n"
-                                   "v -0.587938 0.555570 -0.587938\n"
-                                   "v -0.623612 0.471397 -0.623612\n"
-                                   "v -0.653281 0.382683 -0.653281\n"
-                                   "v -0.676659 0.290285 -0.676659\n"
-                                   "v -0.693520 0.195090 -0.693520\n"
-                                   "v -0.703702 0.098017 -0.703702\n"
-                                   "v -0.707106 -0.000000 -0.707107\n"
-                                   "v -0.703702 -0.098017 -0.703702\n"
-                                   "v -0.693520 -0.195090 -0.693520\n"
-                                   "v -0.676659 -0.290285 -0.676659\n"
-                                   "v -0.653281 -0.382683 -0.653281\n"
-                                   "v -0.623612 -0.471397 -0.623612\n"
-                                   "v -0.587938 -0.555570 -0.587938\n"
-                                   "v -0.546601 -0.634393 -0.546601\n"
-                                   "v -0.500000 -0.707107 -0.500000\n"
-                                   "v -0.448584 -0.773010 -0.448584\n"
-                                   "v -0.392848 -0.831470 -0.392848\n"
-                                   "v -0.333328 -0.881921 -0.333328\n"
-                                   "v -0.270598 -0.923880 -0.270598\n"
-                                   "v -0.205262 -0.956940 -0.205262\n"
-                                   "v -0.137950 -0.980785 -0.137950\n"
-                                   "v -0.069309 -0.995185 -0.069309\n"
-                                   "v -0.062181 0.995185 -0.075768\n"
-                                   "v -0.123764 0.980785 -0.150807\n"
-                                   "v -0.184155 0.956940 -0.224393\n"
-                                   "v -0.242772 0.923880 -0.295818\n"
-                                   "v -0.299051 0.881921 -0.364394\n"
-                                   "v -0.352450 0.831470 -0.429462\n"
-                                   "v -0.402455 0.773010 -0.490393\n"
-                                   "v -0.448584 0.707107 -0.546601\n"
-                                   "v -0.490392 0.634393 -0.597545\n"
-                                   "v -0.527479 0.555570 -0.642735\n"
-                                   "v -0.559484 0.471397 -0.681734\n"
-                                   "v -0.586103 0.382683 -0.714168\n"
-                                   "v -0.607076 0.290285 -0.739725\n"
-                                   "v -0.622203 0.195090 -0.758157\n"
-                                   "v -0.631338 0.098017 -0.769288\n"
-                                   "v -0.634393 -0.000000 -0.773010\n"
-                                   "v -0.631338 -0.098017 -0.769288\n"
-                                   "v -0.622203 -0.195090 -0.758157\n"
-                                   "v -0.607076 -0.290285 -0.739725\n"
-                                   "v -0.586103 -0.382683 -0.714168\n"
-                                   "v -0.559485 -0.471397 -0.681734\n"
-                                   "v -0.527479 -0.555570 -0.642735\n"
-                                   "v -0.490392 -0.634393 -0.597545\n"
-                                   "v -0.448584 -0.707107 -0.546601\n"
-                                   "v -0.402455 -0.773010 -0.490393\n"
-                                   "v -0.352450 -0.831470 -0.429462\n"
-                                   "v -0.299051 -0.881921 -0.364395\n"
-                                   "v -0.242772 -0.923880 -0.295818\n"
-                                   "v -0.184155 -0.956940 -0.224393\n"
-                                   "v -0.123764 -0.980785 -0.150807\n"
-                                   "v -0.062181 -0.995185 -0.075768\n"
-                                   "v -0.054455 0.995185 -0.081498\n"
-                                   "v -0.108386 0.980785 -0.162212\n"
-                                   "v -0.161274 0.956940 -0.241363\n"
-                                   "v -0.212607 0.923880 -0.318189\n"
-                                   "v -0.261894 0.881921 -0.391952\n"
-                                   "v -0.308659 0.831470 -0.461940\n"
-                                   "v -0.352450 0.773010 -0.527479\n"
-                                   "v -0.392847 0.707107 -0.587938\n"
-                                   "v -0.429461 0.634393 -0.642734\n"
-                                   "v -0.461940 0.555570 -0.691342\n"
-                                   "v -0.489969 0.471397 -0.733290\n"
-                                   "v -0.513280 0.382683 -0.768177\n"
-                                   "v -0.531647 0.290285 -0.795667\n"
-                                   "v -0.544895 0.195090 -0.815493\n"
-                                   "v -0.552895 0.098017 -0.827466\n"
-                                   "v -0.555570 -0.000000 -0.831469\n"
-                                   "v -0.552895 -0.098017 -0.827466\n"
-                                   "v -0.544895 -0.195090 -0.815493\n"
-                                   "v -0.531647 -0.290285 -0.795667\n"
-                                   "v -0.513280 -0.382683 -0.768178\n"
-                                   "v -0.489969 -0.471397 -0.733290\n"
-                                   "v -0.461940 -0.555570 -0.691342\n"
-                                   "v -0.429461 -0.634393 -0.642734\n"
-                                   "v -0.392847 -0.707107 -0.587938\n"
-                                   "v -0.352450 -0.773010 -0.527479\n"
-                                   "v -0.308659 -0.831470 -0.461940\n"
-                                   "v -0.261894 -0.881921 -0.391952\n"
-                                   "v -0.212607 -0.923880 -0.318189\n"
-                                   "v -0.161274 -0.956940 -0.241363\n"
-                                   "v -0.108386 -0.980785 -0.162212\n"
-                                   "v -0.054455 -0.995185 -0.081498\n"
-                                   "v -0.046205 0.995185 -0.086443\n"
-                                   "v -0.091965 0.980785 -0.172054\n"
-                                   "v -0.136839 0.956940 -0.256008\n"
-                                   "v -0.180395 0.923880 -0.337496\n"
-                                   "v -0.222215 0.881921 -0.415734\n"
-                                   "v -0.261894 0.831470 -0.489969\n"
-                                   "v -0.299051 0.773010 -0.559485\n"
-                                   "v -0.333328 0.707107 -0.623613\n"
-                                   "v -0.364394 0.634393 -0.681734\n"
-                                   "v -0.391952 0.555570 -0.733291\n"
-                                   "v -0.415734 0.471397 -0.777785\n"
-                                   "v -0.435514 0.382683 -0.814788\n"
-                                   "v -0.451098 0.290285 -0.843946\n"
-                                   "v -0.462339 0.195090 -0.864975\n"
-                                   "v -0.469127 0.098017 -0.877674\n"
-                                   "v -0.471396 -0.000000 -0.881921\n"
-                                   "v -0.469127 -0.098017 -0.877674\n"
-                                   "v -0.462339 -0.195090 -0.864975\n"
-                                   "v -0.451098 -0.290285 -0.843946\n"
-                                   "v -0.435514 -0.382683 -0.814789\n"
-                                   "v -0.415735 -0.471397 -0.777785\n"
-                                   "v -0.391952 -0.555570 -0.733291\n"
-                                   "v -0.364394 -0.634393 -0.681734\n"
-                                   "v -0.333328 -0.707107 -0.623613\n"
-                                   "v -0.299051 -0.773010 -0.559485\n"
-                                   "v -0.261894 -0.831470 -0.489969\n"
-                                   "v -0.222215 -0.881921 -0.415735\n"
-                                   "v -0.180396 -0.923880 -0.337496\n"
-                                   "v -0.136839 -0.956940 -0.256008\n"
-                                   "v -0.091965 -0.980785 -0.172054\n"
-                                   "v -0.046205 -0.995185 -0.086443\n"
-                                   "v -0.037510 0.995185 -0.090556\n"
-                                   "v -0.074658 0.980785 -0.180240\n"
-                                   "v -0.111087 0.956940 -0.268188\n"
-                                   "v -0.146446 0.923880 -0.353553\n"
-                                   "v -0.180396 0.881921 -0.435513\n"
-                                   "v -0.212608 0.831470 -0.513280\n"
-                                   "v -0.242772 0.773010 -0.586103\n"
-                                   "v -0.270598 0.707107 -0.653282\n"
-                                   "v -0.295818 0.634393 -0.714168\n"
-                                   "v -0.318190 0.555570 -0.768178\n"
-                                   "v -0.337496 0.471397 -0.814788\n"
-                                   "v -0.353553 0.382683 -0.853553\n"
-                                   "v -0.366205 0.290285 -0.884098\n"
-                                   "v -0.375330 0.195090 -0.906127\n"
-                                   "v -0.380840 0.098017 -0.919431\n"
-                                   "v -0.382683 -0.000000 -0.923879\n"
-                                   "v -0.380840 -0.098017 -0.919431\n"
-                                   "v -0.375330 -0.195090 -0.906127\n"
-                                   "v -0.366205 -0.290285 -0.884098\n"
-                                   "v -0.353553 -0.382683 -0.853553\n"
-                                   "v -0.337496 -0.471397 -0.814789\n"
-                                   "v -0.318190 -0.555570 -0.768178\n"
-                                   "v -0.295818 -0.634393 -0.714168\n"
-                                   "v -0.270598 -0.707107 -0.653282\n"
-                                   "v -0.242772 -0.773010 -0.586103\n"
-                                   "v -0.212608 -0.831470 -0.513280\n"
-                                   "v -0.180396 -0.881921 -0.435514\n"
-                                   "v -0.146446 -0.923880 -0.353553\n"
-                                   "v -0.111087 -0.956940 -0.268188\n"
-                                   "v -0.074658 -0.980785 -0.180240\n"
-                                   "v -0.037510 -0.995185 -0.090556\n"
-                                   "v -0.028453 0.995185 -0.093796\n"
-                                   "v -0.056632 0.980785 -0.186690\n"
-                                   "v -0.084265 0.956940 -0.277785\n"
-                                   "v -0.111087 0.923880 -0.366205\n"
-                                   "v -0.136839 0.881921 -0.451098\n"
-                                   "v -0.161274 0.831470 -0.531648\n"
-                                   "v -0.184155 0.773010 -0.607076\n"
-                                   "v -0.205262 0.707107 -0.676659\n"
-                                   "v -0.224393 0.634393 -0.739724\n"
-                                   "v -0.241363 0.555570 -0.795667\n"
-                                   "v -0.256008 0.471397 -0.843946\n"
-                                   "v -0.268188 0.382683 -0.884097\n"
-                                   "v -0.277785 0.290285 -0.915735\n"
-                                   "v -0.284707 0.195090 -0.938553\n"
-                                   "v -0.288887 0.098017 -0.952332\n"
-                                   "v -0.290284 -0.000000 -0.956940\n"
-                                   "v -0.288887 -0.098017 -0.952332\n"
-                                   "v -0.284707 -0.195090 -0.938553\n"
-                                   "v -0.277785 -0.290285 -0.915735\n"
-                                   "v -0.268188 -0.382683 -0.884097\n"
-                                   "v -0.256008 -0.471397 -0.843946\n"
-                                   "v -0.241363 -0.555570 -0.795667\n"
-                                   "v -0.224393 -0.634393 -0.739724\n"
-                                   "v -0.205262 -0.707107 -0.676659\n"
-                                   "v -0.184155 -0.773010 -0.607076\n"
-                                   "v -0.161274 -0.831470 -0.531648\n"
-                                   "v -0.136839 -0.881921 -0.451098\n"
-                                   "v -0.111087 -0.923880 -0.366205\n"
-                                   "v -0.084265 -0.956940 -0.277785\n"
-                                   "v -0.056632 -0.980785 -0.186690\n"
-                                   "v -0.028453 -0.995185 -0.093796\n"
-                                   "v -0.019122 0.995185 -0.096134\n"
-                                   "v -0.038060 0.980785 -0.191342\n"
-                                   "v -0.056632 0.956940 -0.284707\n"
-                                   "v -0.074658 0.923880 -0.375330\n"
-                                   "v -0.091965 0.881921 -0.462339\n"
-                                   "v -0.108387 0.831470 -0.544895\n"
-                                   "v -0.123764 0.773010 -0.622204\n"
-                                   "v -0.137950 0.707107 -0.693520\n"
-                                   "v -0.150807 0.634393 -0.758157\n"
-                                   "v -0.162212 0.555570 -0.815493\n"
-                                   "v -0.172054 0.471397 -0.864975\n"
-                                   "v -0.180240 0.382683 -0.906127\n"
-                                   "v -0.186690 0.290285 -0.938553\n"
-                                   "v -0.191342 0.195090 -0.961940\n"
-                                   "v -0.194151 0.098017 -0.976062\n"
-                                   "v -0.195090 -0.000000 -0.980785\n"
-                                   "v -0.194151 -0.098017 -0.976062\n"
-                                   "v -0.191342 -0.195090 -0.961940\n"
-                                   "v -0.186690 -0.290285 -0.938553\n"
-                                   "v -0.180240 -0.382683 -0.906127\n"
-                                   "v -0.172054 -0.471397 -0.864975\n"
-                                   "v -0.162212 -0.555570 -0.815493\n"
-                                   "v -0.150807 -0.634393 -0.758157\n"
-                                   "v -0.137950 -0.707107 -0.693520\n"
-                                   "v -0.123764 -0.773010 -0.622204\n"
-                                   "v -0.108387 -0.831470 -0.544895\n"
-                                   "v -0.091965 -0.881921 -0.462339\n"
-                                   "v -0.074658 -0.923880 -0.375330\n"
-                                   "v -0.056632 -0.956940 -0.284707\n"
-                                   "v -0.038060 -0.980785 -0.191342\n"
-                                   "v -0.019122 -0.995185 -0.096134\n"
-                                   "v -0.009607 0.995185 -0.097545\n"
-                                   "v -0.019122 0.980785 -0.194151\n"
-                                   "v -0.028453 0.956940 -0.288887\n"
-                                   "v -0.037509 0.923880 -0.380840\n"
-                                   "v -0.046205 0.881921 -0.469126\n"
-                                   "v -0.054456 0.831470 -0.552895\n"
-                                   "v -0.062181 0.773010 -0.631338\n"
-                                   "v -0.069308 0.707107 -0.703702\n"
-                                   "v -0.075768 0.634393 -0.769288\n"
-                                   "v -0.081498 0.555570 -0.827466\n"
-                                   "v -0.086443 0.471397 -0.877674\n"
-                                   "v -0.090556 0.382683 -0.919430\n"
-                                   "v -0.093796 0.290285 -0.952332\n"
-                                   "v -0.096134 0.195090 -0.976062\n"
-                                   "v -0.097545 0.098017 -0.990392\n"
-                                   "v -0.098017 -0.000000 -0.995184\n"
-                                   "v -0.097545 -0.098017 -0.990392\n"
-                                   "v -0.096134 -0.195090 -0.976062\n"
-                                   "v -0.093796 -0.290285 -0.952332\n"
-                                   "v -0.090556 -0.382683 -0.919430\n"
-                                   "v -0.086443 -0.471397 -0.877674\n"
-                                   "v -0.081498 -0.555570 -0.827466\n"
-                                   "v -0.075768 -0.634393 -0.769288\n"
-                                   "v -0.069308 -0.707107 -0.703702\n"
-                                   "v -0.062181 -0.773010 -0.631338\n"
-                                   "v -0.054456 -0.831470 -0.552895\n"
-                                   "v -0.046205 -0.881921 -0.469127\n"
-                                   "v -0.037509 -0.923880 -0.380840\n"
-                                   "v -0.028453 -0.956940 -0.288887\n"
-                                   "v -0.019122 -0.980785 -0.194151\n"
-                                   "v -0.009607 -0.995185 -0.097545\n"
-                                   "v -0.000000 0.980785 -0.195090\n"
-                                   "v 0.000000 0.881921 -0.471396\n"
-                                   "v -0.000000 0.831470 -0.555570\n"
-                                   "v -0.000000 0.555570 -0.831470\n"
-                                   "v -0.000000 0.382683 -0.923879\n"
-                                   "v -0.000000 -0.555570 -0.831470\n"
-                                   "v -0.000000 -0.634393 -0.773010\n"
-                                   "v -0.000000 -0.831470 -0.555570\n"
-                                   "v 0.000000 -0.923880 -0.382683\n"
-                                   "v 0.000000 -0.956940 -0.290285\n"
-                                   "v -0.000000 -0.980785 -0.195090\n"
-                                   "vt 0.742188 0.000000\n"
-                                   "vt 0.750000 0.031250\n"
-                                   "vt 0.734375 0.031250\n"
-                                   "vt 0.750000 0.437500\n"
-                                   "vt 0.734375 0.406250\n"
-                                   "vt 0.750000 0.406250\n"
-                                   "vt 0.750000 0.812500\n"
-                                   "vt 0.734375 0.843750\n"
-                                   "vt 0.734375 0.812500\n"
-                                   "vt 0.734375 0.375000\n"
-                                   "vt 0.750000 0.375000\n"
-                                   "vt 0.734375 0.781250\n"
-                                   "vt 0.750000 0.781250\n"
-                                   "vt 0.750000 0.343750\n"
-                                   "vt 0.734375 0.343750\n"
-                                   "vt 0.734375 0.750000\n"
-                                   "vt 0.750000 0.750000\n"
-                                   "vt 0.734375 0.312500\n"
-                                   "vt 0.750000 0.312500\n"
-                                   "vt 0.734375 0.718750\n"
-                                   "vt 0.750000 0.718750\n"
-                                   "vt 0.734375 0.281250\n"
-                                   "vt 0.750000 0.281250\n"
-                                   "vt 0.734375 0.687500\n"
-                                   "vt 0.750000 0.687500\n"
-                                   "vt 0.734375 0.250000\n"
-                                   "vt 0.750000 0.250000\n"
-                                   "vt 0.734375 0.656250\n"
-                                   "vt 0.750000 0.656250\n"
-                                   "vt 0.750000 0.218750\n"
-                                   "vt 0.734375 0.218750\n"
-                                   "vt 0.750000 0.625000\n"
-                                   "vt 0.734375 0.625000\n"
-                                   "vt 0.750000 0.187500\n"
-                                   "vt 0.734375 0.187500\n"
-                                   "vt 0.750000 0.593750\n"
-                                   "vt 0.734375 0.593750\n"
-                                   "vt 0.750000 0.156250\n"
-                                   "vt 0.734375 0.156250\n"
-                                   "vt 0.734375 0.562500\n"
-                                   "vt 0.750000 0.562500\n"
-                                   "vt 0.750000 0.968750\n"
-                                   "vt 0.742188 1.000000\n"
-                                   "vt 0.734375 0.968750\n"
-                                   "vt 0.734375 0.125000\n"
-                                   "vt 0.750000 0.125000\n"
-                                   "vt 0.734375 0.531250\n"
-                                   "vt 0.750000 0.531250\n"
-                                   "vt 0.734375 0.937500\n"
-                                   "vt 0.750000 0.937500\n"
-                                   "vt 0.734375 0.093750\n"
-                                   "vt 0.750000 0.093750\n"
-                                   "vt 0.734375 0.500000\n"
-                                   "vt 0.750000 0.500000\n"
-                                   "vt 0.734375 0.906250\n"
-                                   "vt 0.750000 0.906250\n"
-                                   "vt 0.734375 0.062500\n"
-                                   "vt 0.750000 0.062500\n"
-                                   "vt 0.734375 0.468750\n"
-                                   "vt 0.750000 0.468750\n"
-                                   "vt 0.734375 0.875000\n"
-                                   "vt 0.750000 0.875000\n"
-                                   "vt 0.734375 0.437500\n"
-                                   "vt 0.750000 0.843750\n"
-                                   "vt 0.718750 0.156250\n"
-                                   "vt 0.718750 0.593750\n"
-                                   "vt 0.718750 0.562500\n"
-                                   "vt 0.726562 1.000000\n"
-                                   "vt 0.718750 0.968750\n"
-                                   "vt 0.718750 0.125000\n"
-                                   "vt 0.718750 0.531250\n"
-                                   "vt 0.718750 0.937500\n"
-                                   "vt 0.718750 0.093750\n"
-                                   "vt 0.718750 0.500000\n"
-                                   "vt 0.718750 0.906250\n"
-                                   "vt 0.718750 0.062500\n"
-                                   "vt 0.718750 0.468750\n"
-                                   "vt 0.718750 0.875000\n"
-                                   "vt 0.718750 0.031250\n"
-                                   "vt 0.718750 0.437500\n"
-                                   "vt 0.718750 0.843750\n"
-                                   "vt 0.726562 0.000000\n"
-                                   "vt 0.718750 0.406250\n"
-                                   "vt 0.718750 0.812500\n"
-                                   "vt 0.718750 0.375000\n"
-                                   "vt 0.718750 0.781250\n"
-                                   "vt 0.718750 0.343750\n"
-                                   "vt 0.718750 0.750000\n"
-                                   "vt 0.718750 0.312500\n"
-                                   "vt 0.718750 0.718750\n"
-                                   "vt 0.718750 0.281250\n"
-                                   "vt 0.718750 0.687500\n"
-                                   "vt 0.718750 0.250000\n"
-                                   "vt 0.718750 0.656250\n"
-                                   "vt 0.718750 0.218750\n"
-                                   "vt 0.718750 0.625000\n"
-                                   "vt 0.718750 0.187500\n"
-                                   "vt 0.703125 0.937500\n"
-                                   "vt 0.703125 0.093750\n"
-                                   "vt 0.703125 0.531250\n"
-                                   "vt 0.703125 0.500000\n"
-                                   "vt 0.703125 0.906250\n"
-                                   "vt 0.703125 0.062500\n"
-                                   "vt 0.703125 0.468750\n"
-                                   "vt 0.703125 0.875000\n"
-                                   "vt 0.703125 0.031250\n"
-                                   "vt 0.703125 0.437500\n"
-                                   "vt 0.703125 0.843750\n"
-                                   "vt 0.710937 0.000000\n"
-                                   "vt 0.703125 0.406250\n"
-                                   "vt 0.703125 0.812500\n"
-                                   "vt 0.703125 0.375000\n"
-                                   "vt 0.703125 0.781250\n"
-                                   "vt 0.703125 0.343750\n"
-                                   "vt 0.703125 0.750000\n"
-                                   "vt 0.703125 0.312500\n"
-                                   "vt 0.703125 0.718750\n"
-                                   "vt 0.703125 0.281250\n"
-                                   "vt 0.703125 0.687500\n"
-                                   "vt 0.703125 0.250000\n"
-                                   "vt 0.703125 0.656250\n"
-                                   "vt 0.703125 0.218750\n"
-                                   "vt 0.703125 0.625000\n"
-                                   "vt 0.703125 0.187500\n"
-                                   "vt 0.703125 0.593750\n"
-                                   "vt 0.703125 0.156250\n"
-                                   "vt 0.703125 0.562500\n"
-                                   "vt 0.710938 1.000000\n"
-                                   "vt 0.703125 0.968750\n"
-                                   "vt 0.703125 0.125000\n"
-                                   "vt 0.687500 0.875000\n"
-                                   "vt 0.687500 0.031250\n"
-                                   "vt 0.687500 0.468750\n"
-                                   "vt 0.687500 0.437500\n"
-                                   "vt 0.687500 0.843750\n"
-                                   "vt 0.695312 0.000000\n"
-                                   "vt 0.687500 0.406250\n"
-                                   "vt 0.687500 0.812500\n"
-                                   "vt 0.687500 0.375000\n"
-                                   "vt 0.687500 0.781250\n"
-                                   "vt 0.687500 0.343750\n"
-                                   "vt 0.687500 0.750000\n"
-                                   "vt 0.687500 0.312500\n"
-                                   "vt 0.687500 0.718750\n"
-                                   "vt 0.687500 0.281250\n"
-                                   "vt 0.687500 0.687500\n"
-                                   "vt 0.687500 0.250000\n"
-                                   "vt 0.687500 0.656250\n"
-                                   "vt 0.687500 0.218750\n"
-                                   "vt 0.687500 0.625000\n"
-                                   "vt 0.687500 0.187500\n"
-                                   "vt 0.687500 0.593750\n"
-                                   "vt 0.687500 0.156250\n"
-                                   "vt 0.687500 0.562500\n"
-                                   "vt 0.695312 1.000000\n"
-                                   "vt 0.687500 0.968750\n"
-                                   "vt 0.687500 0.125000\n"
-                                   "vt 0.687500 0.531250\n"
-                                   "vt 0.687500 0.937500\n"
-                                   "vt 0.687500 0.093750\n"
-                                   "vt 0.687500 0.500000\n"
-                                   "vt 0.687500 0.906250\n"
-                                   "vt 0.687500 0.062500\n"
-                                   "vt 0.671875 0.812500\n"
-                                   "vt 0.671875 0.406250\n"
-                                   "vt 0.671875 0.375000\n"
-                                   "vt 0.671875 0.781250\n"
-                                   "vt 0.671875 0.343750\n"
-                                   "vt 0.671875 0.750000\n"
-                                   "vt 0.671875 0.312500\n"
-                                   "vt 0.671875 0.718750\n"
-                                   "vt 0.671875 0.281250\n"
-                                   "vt 0.671875 0.687500\n"
-                                   "vt 0.671875 0.250000\n"
-                                   "vt 0.671875 0.656250\n"
-                                   "vt 0.671875 0.218750\n"
-                                   "vt 0.671875 0.625000\n"
-                                   "vt 0.671875 0.187500\n"
-                                   "vt 0.671875 0.593750\n"
-                                   "vt 0.671875 0.156250\n"
-                                   "vt 0.671875 0.562500\n"
-                                   "vt 0.679688 1.000000\n"
-                                   "vt 0.671875 0.968750\n"
-                                   "vt 0.671875 0.125000\n"
-                                   "vt 0.671875 0.531250\n"
-                                   "vt 0.671875 0.937500\n"
-                                   "vt 0.671875 0.093750\n"
-                                   "vt 0.671875 0.500000\n"
-                                   "vt 0.671875 0.906250\n"
-                                   "vt 0.671875 0.062500\n"
-                                   "vt 0.671875 0.468750\n"
-                                   "vt 0.671875 0.875000\n"
-                                   "vt 0.671875 0.031250\n"
-                                   "vt 0.671875 0.437500\n"
-                                   "vt 0.671875 0.843750\n"
-                                   "vt 0.679687 0.000000\n"
-                                   "vt 0.656250 0.781250\n"
-                                   "vt 0.656250 0.750000\n"
-                                   "vt 0.656250 0.343750\n"
-                                   "vt 0.656250 0.312500\n"
-                                   "vt 0.656250 0.718750\n"
-                                   "vt 0.656250 0.281250\n"
-                                   "vt 0.656250 0.687500\n"
-                                   "vt 0.656250 0.250000\n"
-                                   "vt 0.656250 0.656250\n"
-                                   "vt 0.656250 0.218750\n"
-                                   "vt 0.656250 0.625000\n"
-                                   "vt 0.656250 0.187500\n"
-                                   "vt 0.656250 0.593750\n"
-                                   "vt 0.656250 0.156250\n"
-                                   "vt 0.656250 0.562500\n"
-                                   "vt 0.664062 1.000000\n"
-                                   "vt 0.656250 0.968750\n"
-                                   "vt 0.656250 0.125000\n"
-                                   "vt 0.656250 0.531250\n"
-                                   "vt 0.656250 0.937500\n"
-                                   "vt 0.656250 0.093750\n"
-                                   "vt 0.656250 0.500000\n"
-                                   "vt 0.656250 0.906250\n"
-                                   "vt 0.656250 0.062500\n"
-                                   "vt 0.656250 0.468750\n"
-                                   "vt 0.656250 0.875000\n"
-                                   "vt 0.656250 0.031250\n"
-                                   "vt 0.656250 0.437500\n"
-                                   "vt 0.656250 0.843750\n"
-                                   "vt 0.664062 0.000000\n"
-                                   "vt 0.656250 0.406250\n"
-                                   "vt 0.656250 0.812500\n"
-                                   "vt 0.656250 0.375000\n"
-                                   "vt 0.640625 0.718750\n"
-                                   "vt 0.640625 0.687500\n"
-                                   "vt 0.640625 0.281250\n"
-                                   "vt 0.640625 0.250000\n"
-                                   "vt 0.640625 0.656250\n"
-                                   "vt 0.640625 0.218750\n"
-                                   "vt 0.640625 0.625000\n"
-                                   "vt 0.640625 0.187500\n"
-                                   "vt 0.640625 0.593750\n"
-                                   "vt 0.640625 0.156250\n"
-                                   "vt 0.640625 0.562500\n"
-                                   "vt 0.648437 1.000000\n"
-                                   "vt 0.640625 0.968750\n"
-                                   "vt 0.640625 0.125000\n"
-                                   "vt 0.640625 0.531250\n"
-                                   "vt 0.640625 0.937500\n"
-                                   "vt 0.640625 0.093750\n"
-                                   "vt 0.640625 0.500000\n"
-                                   "vt 0.640625 0.906250\n"
-                                   "vt 0.640625 0.062500\n"
-                                   "vt 0.640625 0.468750\n"
-                                   "vt 0.640625 0.875000\n"
-                                   "vt 0.640625 0.031250\n"
-                                   "vt 0.640625 0.437500\n"
-                                   "vt 0.640625 0.843750\n"
-                                   "vt 0.648437 0.000000\n"
-                                   "vt 0.640625 0.406250\n"
-                                   "vt 0.640625 0.812500\n"
-                                   "vt 0.640625 0.375000\n"
-                                   "vt 0.640625 0.781250\n"
-                                   "vt 0.640625 0.343750\n"
-                                   "vt 0.640625 0.750000\n"
-                                   "vt 0.640625 0.312500\n"
-                                   "vt 0.625000 0.656250\n"
-                                   "vt 0.625000 0.625000\n"
-                                   "vt 0.625000 0.218750\n"
-                                   "vt 0.625000 0.187500\n"
-                                   "vt 0.625000 0.593750\n"
-                                   "vt 0.625000 0.156250\n"
-                                   "vt 0.625000 0.562500\n"
-                                   "vt 0.632812 1.000000\n"
-                                   "vt 0.625000 0.968750\n"
-                                   "vt 0.625000 0.125000\n"
-                                   "vt 0.625000 0.531250\n"
-                                   "vt 0.625000 0.937500\n"
-                                   "vt 0.625000 0.093750\n"
-                                   "vt 0.625000 0.500000\n"
-                                   "vt 0.625000 0.906250\n"
-                                   "vt 0.625000 0.062500\n"
-                                   "vt 0.625000 0.468750\n"
-                                   "vt 0.625000 0.875000\n"
-                                   "vt 0.625000 0.031250\n"
-                                   "vt 0.625000 0.437500\n"
-                                   "vt 0.625000 0.843750\n"
-                                   "vt 0.632812 0.000000\n"
-                                   "vt 0.625000 0.406250\n"
-                                   "vt 0.625000 0.812500\n"
-                                   "vt 0.625000 0.375000\n"
-                                   "vt 0.625000 0.781250\n"
-                                   "vt 0.625000 0.343750\n"
-                                   "vt 0.625000 0.750000\n"
-                                   "vt 0.625000 0.312500\n"
-                                   "vt 0.625000 0.718750\n"
-                                   "vt 0.625000 0.281250\n"
-                                   "vt 0.625000 0.687500\n"
-                                   "vt 0.625000 0.250000\n"
-                                   "vt 0.609375 0.562500\n"
-                                   "vt 0.617187 1.000000\n"
-                                   "vt 0.609375 0.968750\n"
-                                   "vt 0.609375 0.156250\n"
-                                   "vt 0.609375 0.125000\n"
-                                   "vt 0.609375 0.531250\n"
-                                   "vt 0.609375 0.937500\n"
-                                   "vt 0.609375 0.093750\n"
-                                   "vt 0.609375 0.500000\n"
-                                   "vt 0.609375 0.906250\n"
-                                   "vt 0.609375 0.062500\n"
-                                   "vt 0.609375 0.468750\n"
-                                   "vt 0.609375 0.875000\n"
-                                   "vt 0.609375 0.031250\n"
-                                   "vt 0.609375 0.437500\n"
-                                   "vt 0.609375 0.843750\n"
-                                   "vt 0.617187 0.000000\n"
-                                   "vt 0.609375 0.406250\n"
-                                   "vt 0.609375 0.812500\n"
-                                   "vt 0.609375 0.375000\n"
-                                   "vt 0.609375 0.781250\n"
-                                   "vt 0.609375 0.343750\n"
-                                   "vt 0.609375 0.750000\n"
-                                   "vt 0.609375 0.312500\n"
-                                   "vt 0.609375 0.718750\n"
-                                   "vt 0.609375 0.281250\n"
-                                   "vt 0.609375 0.687500\n"
-                                   "vt 0.609375 0.250000\n"
-                                   "vt 0.609375 0.656250\n"
-                                   "vt 0.609375 0.218750\n"
-                                   "vt 0.609375 0.625000\n"
-                                   "vt 0.609375 0.187500\n"
-                                   "vt 0.609375 0.593750\n"
-                                   "vt 0.593750 0.531250\n"
-                                   "vt 0.593750 0.500000\n"
-                                   "vt 0.593750 0.937500\n"
-                                   "vt 0.593750 0.906250\n"
-                                   "vt 0.593750 0.062500\n"
-                                   "vt 0.593750 0.468750\n"
-                                   "vt 0.593750 0.875000\n"
-                                   "vt 0.593750 0.031250\n"
-                                   "vt 0.593750 0.437500\n"
-                                   "vt 0.593750 0.843750\n"
-                                   "vt 0.601562 0.000000\n"
-                                   "vt 0.593750 0.406250\n"
-                                   "vt 0.593750 0.812500\n"
-                                   "vt 0.593750 0.375000\n"
-                                   "vt 0.593750 0.781250\n"
-                                   "vt 0.593750 0.343750\n"
-                                   "vt 0.593750 0.750000\n"
-                                   "vt 0.593750 0.312500\n"
-                                   "vt 0.593750 0.718750\n"
-                                   "vt 0.593750 0.281250\n"
-                                   "vt 0.593750 0.687500\n"
-                                   "vt 0.593750 0.250000\n"
-                                   "vt 0.593750 0.656250\n"
-                                   "vt 0.593750 0.218750\n"
-                                   "vt 0.593750 0.625000\n"
-                                   "vt 0.593750 0.187500\n"
-                                   "vt 0.593750 0.593750\n"
-                                   "vt 0.593750 0.156250\n"
-                                   "vt 0.593750 0.562500\n"
-                                   "vt 0.601562 1.000000\n"
-                                   "vt 0.593750 0.968750\n"
-                                   "vt 0.593750 0.125000\n"
-                                   "vt 0.593750 0.093750\n"
-                                   "vt 0.578125 0.437500\n"
-                                   "vt 0.578125 0.875000\n"
-                                   "vt 0.578125 0.843750\n"
-                                   "vt 0.585937 0.000000\n"
-                                   "vt 0.578125 0.031250\n"
-                                   "vt 0.578125 0.406250\n"
-                                   "vt 0.578125 0.812500\n"
-                                   "vt 0.578125 0.375000\n"
-                                   "vt 0.578125 0.781250\n"
-                                   "vt 0.578125 0.343750\n"
-                                   "vt 0.578125 0.750000\n"
-                                   "vt 0.578125 0.312500\n"
-                                   "vt 0.578125 0.718750\n"
-                                   "vt 0.578125 0.281250\n"
-                                   "vt 0.578125 0.687500\n"
-                                   "vt 0.578125 0.250000\n"
-                                   "vt 0.578125 0.656250\n"
-                                   "vt 0.578125 0.218750\n"
-                                   "vt 0.578125 0.625000\n"
-                                   "vt 0.578125 0.187500\n"
-                                   "vt 0.578125 0.593750\n"
-                                   "vt 0.578125 0.156250\n"
-                                   "vt 0.578125 0.562500\n"
-                                   "vt 0.585937 1.000000\n"
-                                   "vt 0.578125 0.968750\n"
-                                   "vt 0.578125 0.125000\n"
-                                   "vt 0.578125 0.531250\n"
-                                   "vt 0.578125 0.937500\n"
-                                   "vt 0.578125 0.093750\n"
-                                   "vt 0.578125 0.500000\n"
-                                   "vt 0.578125 0.906250\n"
-                                   "vt 0.578125 0.062500\n"
-                                   "vt 0.578125 0.468750\n"
-                                   "vt 0.562500 0.406250\n"
-                                   "vt 0.562500 0.375000\n"
-                                   "vt 0.562500 0.812500\n"
-                                   "vt 0.562500 0.781250\n"
-                                   "vt 0.562500 0.343750\n"
-                                   "vt 0.562500 0.750000\n"
-                                   "vt 0.562500 0.312500\n"
-                                   "vt 0.562500 0.718750\n"
-                                   "vt 0.562500 0.281250\n"
-                                   "vt 0.562500 0.687500\n"
-                                   "vt 0.562500 0.250000\n"
-                                   "vt 0.562500 0.656250\n"
-                                   "vt 0.562500 0.218750\n"
-                                   "vt 0.562500 0.625000\n"
-                                   "vt 0.562500 0.187500\n"
-                                   "vt 0.562500 0.593750\n"
-                                   "vt 0.562500 0.156250\n"
-                                   "vt 0.562500 0.562500\n"
-                                   "vt 0.570312 1.000000\n"
-                                   "vt 0.562500 0.968750\n"
-                                   "vt 0.562500 0.125000\n"
-                                   "vt 0.562500 0.531250\n"
-                                   "vt 0.562500 0.937500\n"
-                                   "vt 0.562500 0.093750\n"
-                                   "vt 0.562500 0.500000\n"
-                                   "vt 0.562500 0.906250\n"
-                                   "vt 0.562500 0.062500\n"
-                                   "vt 0.562500 0.468750\n"
-                                   "vt 0.562500 0.875000\n"
-                                   "vt 0.562500 0.031250\n"
-                                   "vt 0.562500 0.437500\n"
-                                   "vt 0.562500 0.843750\n"
-                                   "vt 0.570312 0.000000\n"
-                                   "vt 0.546875 0.312500\n"
-                                   "vt 0.546875 0.718750\n"
-                                   "vt 0.546875 0.281250\n"
-                                   "vt 0.546875 0.687500\n"
-                                   "vt 0.546875 0.250000\n"
-                                   "vt 0.546875 0.656250\n"
-                                   "vt 0.546875 0.218750\n"
-                                   "vt 0.546875 0.625000\n"
-                                   "vt 0.546875 0.187500\n"
-                                   "vt 0.546875 0.593750\n"
-                                   "vt 0.546875 0.156250\n"
-                                   "vt 0.546875 0.562500\n"
-                                   "vt 0.554687 1.000000\n"
-                                   "vt 0.546875 0.968750\n"
-                                   "vt 0.546875 0.125000\n"
-                                   "vt 0.546875 0.531250\n"
-                                   "vt 0.546875 0.937500\n"
-                                   "vt 0.546875 0.093750\n"
-                                   "vt 0.546875 0.500000\n"
-                                   "vt 0.546875 0.906250\n"
-                                   "vt 0.546875 0.062500\n"
-                                   "vt 0.546875 0.468750\n"
-                                   "vt 0.546875 0.875000\n"
-                                   "vt 0.546875 0.031250\n"
-                                   "vt 0.546875 0.437500\n"
-                                   "vt 0.546875 0.843750\n"
-                                   "vt 0.554687 0.000000\n"
-                                   "vt 0.546875 0.406250\n"
-                                   "vt 0.546875 0.812500\n"
-                                   "vt 0.546875 0.375000\n"
-                                   "vt 0.546875 0.781250\n"
-                                   "vt 0.546875 0.343750\n"
-                                   "vt 0.546875 0.750000\n"
-                                   "vt 0.531250 0.281250\n"
-                                   "vt 0.531250 0.250000\n"
-                                   "vt 0.531250 0.656250\n"
-                                   "vt 0.531250 0.218750\n"
-                                   "vt 0.531250 0.625000\n"
-                                   "vt 0.531250 0.187500\n"
-                                   "vt 0.531250 0.593750\n"
-                                   "vt 0.531250 0.156250\n"
-                                   "vt 0.531250 0.562500\n"
-                                   "vt 0.539062 1.000000\n"
-                                   "vt 0.531250 0.968750\n"
-                                   "vt 0.531250 0.125000\n"
-                                   "vt 0.531250 0.531250\n"
-                                   "vt 0.531250 0.937500\n"
-                                   "vt 0.531250 0.093750\n"
-                                   "vt 0.531250 0.500000\n"
-                                   "vt 0.531250 0.906250\n"
-                                   "vt 0.531250 0.062500\n"
-                                   "vt 0.531250 0.468750\n"
-                                   "vt 0.531250 0.875000\n"
-                                   "vt 0.531250 0.031250\n"
-                                   "vt 0.531250 0.437500\n"
-                                   "vt 0.531250 0.843750\n"
-                                   "vt 0.539062 0.000000\n"
-                                   "vt 0.531250 0.406250\n"
-                                   "vt 0.531250 0.812500\n"
-                                   "vt 0.531250 0.375000\n"
-                                   "vt 0.531250 0.781250\n"
-                                   "vt 0.531250 0.343750\n"
-                                   "vt 0.531250 0.750000\n"
-                                   "vt 0.531250 0.312500\n"
-                                   "vt 0.531250 0.718750\n"
-                                   "vt 0.531250 0.687500\n"
-                                   "vt 0.515625 0.187500\n"
-                                   "vt 0.515625 0.593750\n"
-                                   "vt 0.515625 0.156250\n"
-                                   "vt 0.515625 0.562500\n"
-                                   "vt 0.523437 1.000000\n"
-                                   "vt 0.515625 0.968750\n"
-                                   "vt 0.515625 0.125000\n"
-                                   "vt 0.515625 0.531250\n"
-                                   "vt 0.515625 0.937500\n"
-                                   "vt 0.515625 0.093750\n"
-                                   "vt 0.515625 0.500000\n"
-                                   "vt 0.515625 0.906250\n"
-                                   "vt 0.515625 0.062500\n"
-                                   "vt 0.515625 0.468750\n"
-                                   "vt 0.515625 0.875000\n"
-                                   "vt 0.515625 0.031250\n"
-                                   "vt 0.515625 0.437500\n"
-                                   "vt 0.515625 0.843750\n"
-                                   "vt 0.523437 0.000000\n"
-                                   "vt 0.515625 0.406250\n"
-                                   "vt 0.515625 0.812500\n"
-                                   "vt 0.515625 0.375000\n"
-                                   "vt 0.515625 0.781250\n"
-                                   "vt 0.515625 0.343750\n"
-                                   "vt 0.515625 0.750000\n"
-                                   "vt 0.515625 0.312500\n"
-                                   "vt 0.515625 0.718750\n"
-                                   "vt 0.515625 0.281250\n"
-                                   "vt 0.515625 0.687500\n"
-                                   "vt 0.515625 0.250000\n"
-                                   "vt 0.515625 0.656250\n"
-                                   "vt 0.515625 0.218750\n"
-                                   "vt 0.515625 0.625000\n"
-                                   "vt 0.500000 0.156250\n"
-                                   "vt 0.500000 0.125000\n"
-                                   "vt 0.500000 0.562500\n"
-                                   "vt 0.500000 0.531250\n"
-                                   "vt 0.500000 0.968750\n"
-                                   "vt 0.500000 0.937500\n"
-                                   "vt 0.500000 0.093750\n"
-                                   "vt 0.500000 0.500000\n"
-                                   "vt 0.500000 0.906250\n"
-                                   "vt 0.500000 0.062500\n"
-                                   "vt 0.500000 0.468750\n"
-                                   "vt 0.500000 0.875000\n"
-                                   "vt 0.500000 0.031250\n"
-                                   "vt 0.500000 0.437500\n"
-                                   "vt 0.500000 0.843750\n"
-                                   "vt 0.507812 0.000000\n"
-                                   "vt 0.500000 0.406250\n"
-                                   "vt 0.500000 0.812500\n"
-                                   "vt 0.500000 0.375000\n"
-                                   "vt 0.500000 0.781250\n"
-                                   "vt 0.500000 0.343750\n"
-                                   "vt 0.500000 0.750000\n"
-                                   "vt 0.500000 0.312500\n"
-                                   "vt 0.500000 0.718750\n"
-                                   "vt 0.500000 0.281250\n"
-                                   "vt 0.500000 0.687500\n"
-                                   "vt 0.500000 0.250000\n"
-                                   "vt 0.500000 0.656250\n"
-                                   "vt 0.500000 0.218750\n"
-                                   "vt 0.500000 0.625000\n"
-                                   "vt 0.500000 0.187500\n"
-                                   "vt 0.500000 0.593750\n"
-                                   "vt 0.507812 1.000000\n"
-                                   "vt 0.484375 0.062500\n"
-                                   "vt 0.484375 0.500000\n"
-                                   "vt 0.484375 0.468750\n"
-                                   "vt 0.484375 0.875000\n"
-                                   "vt 0.484375 0.031250\n"
-                                   "vt 0.484375 0.437500\n"
-                                   "vt 0.484375 0.843750\n"
-                                   "vt 0.492187 0.000000\n"
-                                   "vt 0.484375 0.406250\n"
-                                   "vt 0.484375 0.812500\n"
-                                   "vt 0.484375 0.375000\n"
-                                   "vt 0.484375 0.781250\n"
-                                   "vt 0.484375 0.343750\n"
-                                   "vt 0.484375 0.750000\n"
-                                   "vt 0.484375 0.312500\n"
-                                   "vt 0.484375 0.718750\n"
-                                   "vt 0.484375 0.281250\n"
-                                   "vt 0.484375 0.687500\n"
-                                   "vt 0.484375 0.250000\n"
-                                   "vt 0.484375 0.656250\n"
-                                   "vt 0.484375 0.218750\n"
-                                   "vt 0.484375 0.625000\n"
-                                   "vt 0.484375 0.187500\n"
-                                   "vt 0.484375 0.593750\n"
-                                   "vt 0.484375 0.156250\n"
-                                   "vt 0.484375 0.562500\n"
-                                   "vt 0.492187 1.000000\n"
-                                   "vt 0.484375 0.968750\n"
-                                   "vt 0.484375 0.125000\n"
-                                   "vt 0.484375 0.531250\n"
-                                   "vt 0.484375 0.937500\n"
-                                   "vt 0.484375 0.093750\n"
-                                   "vt 0.484375 0.906250\n"
-                                   "vt 0.476562 0.000000\n"
-                                   "vt 0.468750 0.031250\n"
-                                   "vt 0.468750 0.406250\n"
-                                   "vt 0.468750 0.812500\n"
-                                   "vt 0.468750 0.375000\n"
-                                   "vt 0.468750 0.781250\n"
-                                   "vt 0.468750 0.343750\n"
-                                   "vt 0.468750 0.750000\n"
-                                   "vt 0.468750 0.312500\n"
-                                   "vt 0.468750 0.718750\n"
-                                   "vt 0.468750 0.281250\n"
-                                   "vt 0.468750 0.687500\n"
-                                   "vt 0.468750 0.250000\n"
-                                   "vt 0.468750 0.656250\n"
-                                   "vt 0.468750 0.218750\n"
-                                   "vt 0.468750 0.625000\n"
-                                   "vt 0.468750 0.187500\n"
-                                   "vt 0.468750 0.593750\n"
-                                   "vt 0.468750 0.156250\n"
-                                   "vt 0.468750 0.562500\n"
-                                   "vt 0.476562 1.000000\n"
-                                   "vt 0.468750 0.968750\n"
-                                   "vt 0.468750 0.125000\n"
-                                   "vt 0.468750 0.531250\n"
-                                   "vt 0.468750 0.937500\n"
-                                   "vt 0.468750 0.093750\n"
-                                   "vt 0.468750 0.500000\n"
-                                   "vt 0.468750 0.906250\n"
-                                   "vt 0.468750 0.062500\n"
-                                   "vt 0.468750 0.468750\n"
-                                   "vt 0.468750 0.875000\n"
-                                   "vt 0.468750 0.437500\n"
-                                   "vt 0.468750 0.843750\n"
-                                   "vt 0.453125 0.375000\n"
-                                   "vt 0.453125 0.343750\n"
-                                   "vt 0.453125 0.781250\n"
-                                   "vt 0.453125 0.750000\n"
-                                   "vt 0.453125 0.312500\n"
-                                   "vt 0.453125 0.718750\n"
-                                   "vt 0.453125 0.281250\n"
-                                   "vt 0.453125 0.687500\n"
-                                   "vt 0.453125 0.250000\n"
-                                   "vt 0.453125 0.656250\n"
-                                   "vt 0.453125 0.218750\n"
-                                   "vt 0.453125 0.625000\n"
-                                   "vt 0.453125 0.187500\n"
-                                   "vt 0.453125 0.593750\n"
-                                   "vt 0.453125 0.156250\n"
-                                   "vt 0.453125 0.562500\n"
-                                   "vt 0.460937 1.000000\n"
-                                   "vt 0.453125 0.968750\n"
-                                   "vt 0.453125 0.125000\n"
-                                   "vt 0.453125 0.531250\n"
-                                   "vt 0.453125 0.937500\n"
-                                   "vt 0.453125 0.093750\n"
-                                   "vt 0.453125 0.500000\n"
-                                   "vt 0.453125 0.906250\n"
-                                   "vt 0.453125 0.062500\n"
-                                   "vt 0.453125 0.468750\n"
-                                   "vt 0.453125 0.875000\n"
-                                   "vt 0.453125 0.031250\n"
-                                   "vt 0.453125 0.437500\n"
-                                   "vt 0.453125 0.843750\n"
-                                   "vt 0.460937 0.000000\n"
-                                   "vt 0.453125 0.406250\n"
-                                   "vt 0.453125 0.812500\n"
-                                   "vt 0.437500 0.281250\n"
-                                   "vt 0.437500 0.687500\n"
-                                   "vt 0.437500 0.250000\n"
-                                   "vt 0.437500 0.656250\n"
-                                   "vt 0.437500 0.218750\n"
-                                   "vt 0.437500 0.625000\n"
-                                   "vt 0.437500 0.187500\n"
-                                   "vt 0.437500 0.593750\n"
-                                   "vt 0.437500 0.156250\n"
-                                   "vt 0.437500 0.562500\n"
-                                   "vt 0.445312 1.000000\n"
-                                   "vt 0.437500 0.968750\n"
-                                   "vt 0.437500 0.125000\n"
-                                   "vt 0.437500 0.531250\n"
-                                   "vt 0.437500 0.937500\n"
-                                   "vt 0.437500 0.093750\n"
-                                   "vt 0.437500 0.500000\n"
-                                   "vt 0.437500 0.906250\n"
-                                   "vt 0.437500 0.062500\n"
-                                   "vt 0.437500 0.468750\n"
-                                   "vt 0.437500 0.875000\n"
-                                   "vt 0.437500 0.031250\n"
-                                   "vt 0.437500 0.437500\n"
-                                   "vt 0.437500 0.843750\n"
-                                   "vt 0.445312 0.000000\n"
-                                   "vt 0.437500 0.406250\n"
-                                   "vt 0.437500 0.812500\n"
-                                   "vt 0.437500 0.375000\n"
-                                   "vt 0.437500 0.781250\n"
-                                   "vt 0.437500 0.343750\n"
-                                   "vt 0.437500 0.750000\n"
-                                   "vt 0.437500 0.312500\n"
-                                   "vt 0.437500 0.718750\n"
-                                   "vt 0.421875 0.218750\n"
-                                   "vt 0.421875 0.656250\n"
-                                   "vt 0.421875 0.625000\n"
-                                   "vt 0.421875 0.187500\n"
-                                   "vt 0.421875 0.593750\n"
-                                   "vt 0.421875 0.156250\n"
-                                   "vt 0.421875 0.562500\n"
-                                   "vt 0.429687 1.000000\n"
-                                   "vt 0.421875 0.968750\n"
-                                   "vt 0.421875 0.125000\n"
-                                   "vt 0.421875 0.531250\n"
-                                   "vt 0.421875 0.937500\n"
-                                   "vt 0.421875 0.093750\n"
-                                   "vt 0.421875 0.500000\n"
-                                   "vt 0.421875 0.906250\n"
-                                   "vt 0.421875 0.062500\n"
-                                   "vt 0.421875 0.468750\n"
-                                   "vt 0.421875 0.875000\n"
-                                   "vt 0.421875 0.031250\n"
-                                   "vt 0.421875 0.437500\n"
-                                   "vt 0.421875 0.843750\n"
-                                   "vt 0.429687 0.000000\n"
-                                   "vt 0.421875 0.406250\n"
-                                   "vt 0.421875 0.812500\n"
-                                   "vt 0.421875 0.375000\n"
-                                   "vt 0.421875 0.781250\n"
-                                   "vt 0.421875 0.343750\n"
-                                   "vt 0.421875 0.750000\n"
-                                   "vt 0.421875 0.312500\n"
-                                   "vt 0.421875 0.718750\n"
-                                   "vt 0.421875 0.281250\n"
-                                   "vt 0.421875 0.687500\n"
-                                   "vt 0.421875 0.250000\n"
-                                   "vt 0.406250 0.187500\n"
-                                   "vt 0.406250 0.156250\n"
-                                   "vt 0.406250 0.562500\n"
-                                   "vt 0.414062 1.000000\n"
-                                   "vt 0.406250 0.968750\n"
-                                   "vt 0.406250 0.125000\n"
-                                   "vt 0.406250 0.531250\n"
-                                   "vt 0.406250 0.937500\n"
-                                   "vt 0.406250 0.093750\n"
-                                   "vt 0.406250 0.500000\n"
-                                   "vt 0.406250 0.906250\n"
-                                   "vt 0.406250 0.062500\n"
-                                   "vt 0.406250 0.468750\n"
-                                   "vt 0.406250 0.875000\n"
-                                   "vt 0.406250 0.031250\n"
-                                   "vt 0.406250 0.437500\n"
-                                   "vt 0.406250 0.843750\n"
-                                   "vt 0.414062 0.000000\n"
-                                   "vt 0.406250 0.406250\n"
-                                   "vt 0.406250 0.812500\n"
-                                   "vt 0.406250 0.375000\n"
-                                   "vt 0.406250 0.781250\n"
-                                   "vt 0.406250 0.343750\n"
-                                   "vt 0.406250 0.750000\n"
-                                   "vt 0.406250 0.312500\n"
-                                   "vt 0.406250 0.718750\n"
-                                   "vt 0.406250 0.281250\n"
-                                   "vt 0.406250 0.687500\n"
-                                   "vt 0.406250 0.250000\n"
-                                   "vt 0.406250 0.656250\n"
-                                   "vt 0.406250 0.218750\n"
-                                   "vt 0.406250 0.625000\n"
-                                   "vt 0.406250 0.593750\n"
-                                   "vt 0.390625 0.937500\n"
-                                   "vt 0.390625 0.125000\n"
-                                   "vt 0.390625 0.093750\n"
-                                   "vt 0.390625 0.531250\n"
-                                   "vt 0.390625 0.500000\n"
-                                   "vt 0.390625 0.906250\n"
-                                   "vt 0.390625 0.062500\n"
-                                   "vt 0.390625 0.468750\n"
-                                   "vt 0.390625 0.875000\n"
-                                   "vt 0.390625 0.031250\n"
-                                   "vt 0.390625 0.437500\n"
-                                   "vt 0.390625 0.843750\n"
-                                   "vt 0.398437 0.000000\n"
-                                   "vt 0.390625 0.406250\n"
-                                   "vt 0.390625 0.812500\n"
-                                   "vt 0.390625 0.375000\n"
-                                   "vt 0.390625 0.781250\n"
-                                   "vt 0.390625 0.343750\n"
-                                   "vt 0.390625 0.750000\n"
-                                   "vt 0.390625 0.312500\n"
-                                   "vt 0.390625 0.718750\n"
-                                   "vt 0.390625 0.281250\n"
-                                   "vt 0.390625 0.687500\n"
-                                   "vt 0.390625 0.250000\n"
-                                   "vt 0.390625 0.656250\n"
-                                   "vt 0.390625 0.218750\n"
-                                   "vt 0.390625 0.625000\n"
-                                   "vt 0.390625 0.187500\n"
-                                   "vt 0.390625 0.593750\n"
-                                   "vt 0.390625 0.156250\n"
-                                   "vt 0.390625 0.562500\n"
-                                   "vt 0.398437 1.000000\n"
-                                   "vt 0.390625 0.968750\n"
-                                   "vt 0.375000 0.875000\n"
-                                   "vt 0.375000 0.031250\n"
-                                   "vt 0.375000 0.437500\n"
-                                   "vt 0.375000 0.843750\n"
-                                   "vt 0.382812 0.000000\n"
-                                   "vt 0.375000 0.406250\n"
-                                   "vt 0.375000 0.812500\n"
-                                   "vt 0.375000 0.375000\n"
-                                   "vt 0.375000 0.781250\n"
-                                   "vt 0.375000 0.343750\n"
-                                   "vt 0.375000 0.750000\n"
-                                   "vt 0.375000 0.312500\n"
-                                   "vt 0.375000 0.718750\n"
-                                   "vt 0.375000 0.281250\n"
-                                   "vt 0.375000 0.687500\n"
-                                   "vt 0.375000 0.250000\n"
-                                   "vt 0.375000 0.656250\n"
-                                   "vt 0.375000 0.218750\n"
-                                   "vt 0.375000 0.625000\n"
-                                   "vt 0.375000 0.187500\n"
-                                   "vt 0.375000 0.593750\n"
-                                   "vt 0.375000 0.156250\n"
-                                   "vt 0.375000 0.562500\n"
-                                   "vt 0.382812 1.000000\n"
-                                   "vt 0.375000 0.968750\n"
-                                   "vt 0.375000 0.125000\n"
-                                   "vt 0.375000 0.531250\n"
-                                   "vt 0.375000 0.937500\n"
-                                   "vt 0.375000 0.093750\n"
-                                   "vt 0.375000 0.500000\n"
-                                   "vt 0.375000 0.906250\n"
-                                   "vt 0.375000 0.062500\n"
-                                   "vt 0.375000 0.468750\n"
-                                   "vt 0.359375 0.812500\n"
-                                   "vt 0.359375 0.406250\n"
-                                   "vt 0.359375 0.375000\n"
-                                   "vt 0.359375 0.781250\n"
-                                   "vt 0.359375 0.343750\n"
-                                   "vt 0.359375 0.750000\n"
-                                   "vt 0.359375 0.312500\n"
-                                   "vt 0.359375 0.718750\n"
-                                   "vt 0.359375 0.281250\n"
-                                   "vt 0.359375 0.687500\n"
-                                   "vt 0.359375 0.250000\n"
-                                   "vt 0.359375 0.656250\n"
-                                   "vt 0.359375 0.218750\n"
-                                   "vt 0.359375 0.625000\n"
-                                   "vt 0.359375 0.187500\n"
-                                   "vt 0.359375 0.593750\n"
-                                   "vt 0.359375 0.156250\n"
-                                   "vt 0.359375 0.562500\n"
-                                   "vt 0.367187 1.000000\n"
-                                   "vt 0.359375 0.968750\n"
-                                   "vt 0.359375 0.125000\n"
-                                   "vt 0.359375 0.531250\n"
-                                   "vt 0.359375 0.937500\n"
-                                   "vt 0.359375 0.093750\n"
-                                   "vt 0.359375 0.500000\n"
-                                   "vt 0.359375 0.906250\n"
-                                   "vt 0.359375 0.062500\n"
-                                   "vt 0.359375 0.468750\n"
-                                   "vt 0.359375 0.875000\n"
-                                   "vt 0.359375 0.031250\n"
-                                   "vt 0.359375 0.437500\n"
-                                   "vt 0.359375 0.843750\n"
-                                   "vt 0.367187 0.000000\n"
-                                   "vt 0.343750 0.781250\n"
-                                   "vt 0.343750 0.750000\n"
-                                   "vt 0.343750 0.312500\n"
-                                   "vt 0.343750 0.718750\n"
-                                   "vt 0.343750 0.281250\n"
-                                   "vt 0.343750 0.687500\n"
-                                   "vt 0.343750 0.250000\n"
-                                   "vt 0.343750 0.656250\n"
-                                   "vt 0.343750 0.218750\n"
-                                   "vt 0.343750 0.625000\n"
-                                   "vt 0.343750 0.187500\n"
-                                   "vt 0.343750 0.593750\n"
-                                   "vt 0.343750 0.156250\n"
-                                   "vt 0.343750 0.562500\n"
-                                   "vt 0.351562 1.000000\n"
-                                   "vt 0.343750 0.968750\n"
-                                   "vt 0.343750 0.125000\n"
-                                   "vt 0.343750 0.531250\n"
-                                   "vt 0.343750 0.937500\n"
-                                   "vt 0.343750 0.093750\n"
-                                   "vt 0.343750 0.500000\n"
-                                   "vt 0.343750 0.906250\n"
-                                   "vt 0.343750 0.062500\n"
-                                   "vt 0.343750 0.468750\n"
-                                   "vt 0.343750 0.875000\n"
-                                   "vt 0.343750 0.031250\n"
-                                   "vt 0.343750 0.437500\n"
-                                   "vt 0.343750 0.843750\n"
-                                   "vt 0.351562 0.000000\n"
-                                   "vt 0.343750 0.406250\n"
-                                   "vt 0.343750 0.812500\n"
-                                   "vt 0.343750 0.375000\n"
-                                   "vt 0.343750 0.343750\n"
-                                   "vt 0.328125 0.531250\n"
-                                   "vt 0.328125 0.500000\n"
-                                   "vt 0.328125 0.937500\n"
-                                   "vt 0.328125 0.906250\n"
-                                   "vt 0.328125 0.062500\n"
-                                   "vt 0.328125 0.468750\n"
-                                   "vt 0.328125 0.875000\n"
-                                   "vt 0.328125 0.031250\n"
-                                   "vt 0.328125 0.437500\n"
-                                   "vt 0.328125 0.843750\n"
-                                   "vt 0.335937 0.000000\n"
-                                   "vt 0.328125 0.406250\n"
-                                   "vt 0.328125 0.812500\n"
-                                   "vt 0.328125 0.375000\n"
-                                   "vt 0.328125 0.781250\n"
-                                   "vt 0.328125 0.343750\n"
-                                   "vt 0.328125 0.750000\n"
-                                   "vt 0.328125 0.312500\n"
-                                   "vt 0.328125 0.718750\n"
-                                   "vt 0.328125 0.281250\n"
-                                   "vt 0.328125 0.687500\n"
-                                   "vt 0.328125 0.250000\n"
-                                   "vt 0.328125 0.656250\n"
-                                   "vt 0.328125 0.218750\n"
-                                   "vt 0.328125 0.625000\n"
-                                   "vt 0.328125 0.187500\n"
-                                   "vt 0.328125 0.593750\n"
-                                   "vt 0.328125 0.156250\n"
-                                   "vt 0.328125 0.562500\n"
-                                   "vt 0.335937 1.000000\n"
-                                   "vt 0.328125 0.968750\n"
-                                   "vt 0.328125 0.125000\n"
-                                   "vt 0.328125 0.093750\n"
-                                   "vt 0.312500 0.437500\n"
-                                   "vt 0.312500 0.875000\n"
-                                   "vt 0.312500 0.843750\n"
-                                   "vt 0.320312 0.000000\n"
-                                   "vt 0.312500 0.031250\n"
-                                   "vt 0.312500 0.406250\n"
-                                   "vt 0.312500 0.812500\n"
-                                   "vt 0.312500 0.375000\n"
-                                   "vt 0.312500 0.781250\n"
-                                   "vt 0.312500 0.343750\n"
-                                   "vt 0.312500 0.750000\n"
-                                   "vt 0.312500 0.312500\n"
-                                   "vt 0.312500 0.718750\n"
-                                   "vt 0.312500 0.281250\n"
-                                   "vt 0.312500 0.687500\n"
-                                   "vt 0.312500 0.250000\n"
-                                   "vt 0.312500 0.656250\n"
-                                   "vt 0.312500 0.218750\n"
-                                   "vt 0.312500 0.625000\n"
-                                   "vt 0.312500 0.187500\n"
-                                   "vt 0.312500 0.593750\n"
-                                   "vt 0.312500 0.156250\n"
-                                   "vt 0.312500 0.562500\n"
-                                   "vt 0.320312 1.000000\n"
-                                   "vt 0.312500 0.968750\n"
-                                   "vt 0.312500 0.125000\n"
-                                   "vt 0.312500 0.531250\n"
-                                   "vt 0.312500 0.937500\n"
-                                   "vt 0.312500 0.093750\n"
-                                   "vt 0.312500 0.500000\n"
-                                   "vt 0.312500 0.906250\n"
-                                   "vt 0.312500 0.062500\n"
-                                   "vt 0.312500 0.468750\n"
-                                   "vt 0.296875 0.406250\n"
-                                   "vt 0.296875 0.375000\n"
-                                   "vt 0.296875 0.812500\n"
-                                   "vt 0.296875 0.781250\n"
-                                   "vt 0.296875 0.343750\n"
-                                   "vt 0.296875 0.750000\n"
-                                   "vt 0.296875 0.312500\n"
-                                   "vt 0.296875 0.718750\n"
-                                   "vt 0.296875 0.281250\n"
-                                   "vt 0.296875 0.687500\n"
-                                   "vt 0.296875 0.250000\n"
-                                   "vt 0.296875 0.656250\n"
-                                   "vt 0.296875 0.218750\n"
-                                   "vt 0.296875 0.625000\n"
-                                   "vt 0.296875 0.187500\n"
-                                   "vt 0.296875 0.593750\n"
-                                   "vt 0.296875 0.156250\n"
-                                   "vt 0.296875 0.562500\n"
-                                   "vt 0.304687 1.000000\n"
-                                   "vt 0.296875 0.968750\n"
-                                   "vt 0.296875 0.125000\n"
-                                   "vt 0.296875 0.531250\n"
-                                   "vt 0.296875 0.937500\n"
-                                   "vt 0.296875 0.093750\n"
-                                   "vt 0.296875 0.500000\n"
-                                   "vt 0.296875 0.906250\n"
-                                   "vt 0.296875 0.062500\n"
-                                   "vt 0.296875 0.468750\n"
-                                   "vt 0.296875 0.875000\n"
-                                   "vt 0.296875 0.031250\n"
-                                   "vt 0.296875 0.437500\n"
-                                   "vt 0.296875 0.843750\n"
-                                   "vt 0.304687 0.000000\n"
-                                   "vt 0.281250 0.312500\n"
-                                   "vt 0.281250 0.718750\n"
-                                   "vt 0.281250 0.281250\n"
-                                   "vt 0.281250 0.687500\n"
-                                   "vt 0.281250 0.250000\n"
-                                   "vt 0.281250 0.656250\n"
-                                   "vt 0.281250 0.218750\n"
-                                   "vt 0.281250 0.625000\n"
-                                   "vt 0.281250 0.187500\n"
-                                   "vt 0.281250 0.593750\n"
-                                   "vt 0.281250 0.156250\n"
-                                   "vt 0.281250 0.562500\n"
-                                   "vt 0.289062 1.000000\n"
-                                   "vt 0.281250 0.968750\n"
-                                   "vt 0.281250 0.125000\n"
-                                   "vt 0.281250 0.531250\n"
-                                   "vt 0.281250 0.937500\n"
-                                   "vt 0.281250 0.093750\n"
-                                   "vt 0.281250 0.500000\n"
-                                   "vt 0.281250 0.906250\n"
-                                   "vt 0.281250 0.062500\n"
-                                   "vt 0.281250 0.468750\n"
-                                   "vt 0.281250 0.875000\n"
-                                   "vt 0.281250 0.031250\n"
-                                   "vt 0.281250 0.437500\n"
-                                   "vt 0.281250 0.843750\n"
-                                   "vt 0.289062 0.000000\n"
-                                   "vt 0.281250 0.406250\n"
-                                   "vt 0.281250 0.812500\n"
-                                   "vt 0.281250 0.375000\n"
-                                   "vt 0.281250 0.781250\n"
-                                   "vt 0.281250 0.343750\n"
-                                   "vt 0.281250 0.750000\n"
-                                   "vt 0.265625 0.281250\n"
-                                   "vt 0.265625 0.250000\n"
-                                   "vt 0.265625 0.656250\n"
-                                   "vt 0.265625 0.218750\n"
-                                   "vt 0.265625 0.625000\n"
-                                   "vt 0.265625 0.187500\n"
-                                   "vt 0.265625 0.593750\n"
-                                   "vt 0.265625 0.156250\n"
-                                   "vt 0.265625 0.562500\n"
-                                   "vt 0.273437 1.000000\n"
-                                   "vt 0.265625 0.968750\n"
-                                   "vt 0.265625 0.125000\n"
-                                   "vt 0.265625 0.531250\n"
-                                   "vt 0.265625 0.937500\n"
-                                   "vt 0.265625 0.093750\n"
-                                   "vt 0.265625 0.500000\n"
-                                   "vt 0.265625 0.906250\n"
-                                   "vt 0.265625 0.062500\n"
-                                   "vt 0.265625 0.468750\n"
-                                   "vt 0.265625 0.875000\n"
-                                   "vt 0.265625 0.031250\n"
-                                   "vt 0.265625 0.437500\n"
-                                   "vt 0.265625 0.843750\n"
-                                   "vt 0.273437 0.000000\n"
-                                   "vt 0.265625 0.406250\n"
-                                   "vt 0.265625 0.812500\n"
-                                   "vt 0.265625 0.375000\n"
-                                   "vt 0.265625 0.781250\n"
-                                   "vt 0.265625 0.343750\n"
-                                   "vt 0.265625 0.750000\n"
-                                   "vt 0.265625 0.312500\n"
-                                   "vt 0.265625 0.718750\n"
-                                   "vt 0.265625 0.687500\n"
-                                   "vt 0.250000 0.187500\n"
-                                   "vt 0.250000 0.593750\n"
-                                   "vt 0.250000 0.156250\n"
-                                   "vt 0.250000 0.562500\n"
-                                   "vt 0.257812 1.000000\n"
-                                   "vt 0.250000 0.968750\n"
-                                   "vt 0.250000 0.125000\n"
-                                   "vt 0.250000 0.531250\n"
-                                   "vt 0.250000 0.937500\n"
-                                   "vt 0.250000 0.093750\n"
-                                   "vt 0.250000 0.500000\n"
-                                   "vt 0.250000 0.906250\n"
-                                   "vt 0.250000 0.062500\n"
-                                   "vt 0.250000 0.468750\n"
-                                   "vt 0.250000 0.875000\n"
-                                   "vt 0.250000 0.031250\n"
-                                   "vt 0.250000 0.437500\n"
-                                   "vt 0.250000 0.843750\n"
-                                   "vt 0.257812 0.000000\n"
-                                   "vt 0.250000 0.406250\n"
-                                   "vt 0.250000 0.812500\n"
-                                   "vt 0.250000 0.375000\n"
-                                   "vt 0.250000 0.781250\n"
-                                   "vt 0.250000 0.343750\n"
-                                   "vt 0.250000 0.750000\n"
-                                   "vt 0.250000 0.312500\n"
-                                   "vt 0.250000 0.718750\n"
-                                   "vt 0.250000 0.281250\n"
-                                   "vt 0.250000 0.687500\n"
-                                   "vt 0.250000 0.250000\n"
-                                   "vt 0.250000 0.656250\n"
-                                   "vt 0.250000 0.218750\n"
-                                   "vt 0.250000 0.625000\n"
-                                   "vt 0.242187 1.000000\n"
-                                   "vt 0.234375 0.968750\n"
-                                   "vt 0.234375 0.125000\n"
-                                   "vt 0.234375 0.562500\n"
-                                   "vt 0.234375 0.531250\n"
-                                   "vt 0.234375 0.937500\n"
-                                   "vt 0.234375 0.093750\n"
-                                   "vt 0.234375 0.500000\n"
-                                   "vt 0.234375 0.906250\n"
-                                   "vt 0.234375 0.062500\n"
-                                   "vt 0.234375 0.468750\n"
-                                   "vt 0.234375 0.875000\n"
-                                   "vt 0.234375 0.031250\n"
-                                   "vt 0.234375 0.437500\n"
-                                   "vt 0.234375 0.843750\n"
-                                   "vt 0.242188 0.000000\n"
-                                   "vt 0.234375 0.406250\n"
-                                   "vt 0.234375 0.812500\n"
-                                   "vt 0.234375 0.375000\n"
-                                   "vt 0.234375 0.781250\n"
-                                   "vt 0.234375 0.343750\n"
-                                   "vt 0.234375 0.750000\n"
-                                   "vt 0.234375 0.312500\n"
-                                   "vt 0.234375 0.718750\n"
-                                   "vt 0.234375 0.281250\n"
-                                   "vt 0.234375 0.687500\n"
-                                   "vt 0.234375 0.250000\n"
-                                   "vt 0.234375 0.656250\n"
-                                   "vt 0.234375 0.218750\n"
-                                   "vt 0.234375 0.625000\n"
-                                   "vt 0.234375 0.187500\n"
-                                   "vt 0.234375 0.593750\n"
-                                   "vt 0.234375 0.156250\n"
-                                   "vt 0.218750 0.906250\n"
-                                   "vt 0.218750 0.062500\n"
-                                   "vt 0.218750 0.468750\n"
-                                   "vt 0.218750 0.875000\n"
-                                   "vt 0.218750 0.031250\n"
-                                   "vt 0.218750 0.437500\n"
-                                   "vt 0.218750 0.843750\n"
-                                   "vt 0.226563 0.000000\n"
-                                   "vt 0.218750 0.406250\n"
-                                   "vt 0.218750 0.812500\n"
-                                   "vt 0.218750 0.375000\n"
-                                   "vt 0.218750 0.781250\n"
-                                   "vt 0.218750 0.343750\n"
-                                   "vt 0.218750 0.750000\n"
-                                   "vt 0.218750 0.312500\n"
-                                   "vt 0.218750 0.718750\n"
-                                   "vt 0.218750 0.281250\n"
-                                   "vt 0.218750 0.687500\n"
-                                   "vt 0.218750 0.250000\n"
-                                   "vt 0.218750 0.656250\n"
-                                   "vt 0.218750 0.218750\n"
-                                   "vt 0.218750 0.625000\n"
-                                   "vt 0.218750 0.187500\n"
-                                   "vt 0.218750 0.593750\n"
-                                   "vt 0.218750 0.156250\n"
-                                   "vt 0.218750 0.562500\n"
-                                   "vt 0.226562 1.000000\n"
-                                   "vt 0.218750 0.968750\n"
-                                   "vt 0.218750 0.125000\n"
-                                   "vt 0.218750 0.531250\n"
-                                   "vt 0.218750 0.937500\n"
-                                   "vt 0.218750 0.093750\n"
-                                   "vt 0.218750 0.500000\n"
-                                   "vt 0.203125 0.843750\n"
-                                   "vt 0.210938 0.000000\n"
-                                   "vt 0.203125 0.031250\n"
-                                   "vt 0.203125 0.437500\n"
-                                   "vt 0.203125 0.406250\n"
-                                   "vt 0.203125 0.812500\n"
-                                   "vt 0.203125 0.375000\n"
-                                   "vt 0.203125 0.781250\n"
-                                   "vt 0.203125 0.343750\n"
-                                   "vt 0.203125 0.750000\n"
-                                   "vt 0.203125 0.312500\n"
-                                   "vt 0.203125 0.718750\n"
-                                   "vt 0.203125 0.281250\n"
-                                   "vt 0.203125 0.687500\n"
-                                   "vt 0.203125 0.250000\n"
-                                   "vt 0.203125 0.656250\n"
-                                   "vt 0.203125 0.218750\n"
-                                   "vt 0.203125 0.625000\n"
-                                   "vt 0.203125 0.187500\n"
-                                   "vt 0.203125 0.593750\n"
-                                   "vt 0.203125 0.156250\n"
-                                   "vt 0.203125 0.562500\n"
-                                   "vt 0.210938 1.000000\n"
-                                   "vt 0.203125 0.968750\n"
-                                   "vt 0.203125 0.125000\n"
-                                   "vt 0.203125 0.531250\n"
-                                   "vt 0.203125 0.937500\n"
-                                   "vt 0.203125 0.093750\n"
-                                   "vt 0.203125 0.500000\n"
-                                   "vt 0.203125 0.906250\n"
-                                   "vt 0.203125 0.062500\n"
-                                   "vt 0.203125 0.468750\n"
-                                   "vt 0.203125 0.875000\n"
-                                   "vt 0.187500 0.812500\n"
-                                   "vt 0.187500 0.781250\n"
-                                   "vt 0.187500 0.343750\n"
-                                   "vt 0.187500 0.750000\n"
-                                   "vt 0.187500 0.312500\n"
-                                   "vt 0.187500 0.718750\n"
-                                   "vt 0.187500 0.281250\n"
-                                   "vt 0.187500 0.687500\n"
-                                   "vt 0.187500 0.250000\n"
-                                   "vt 0.187500 0.656250\n"
-                                   "vt 0.187500 0.218750\n"
-                                   "vt 0.187500 0.625000\n"
-                                   "vt 0.187500 0.187500\n"
-                                   "vt 0.187500 0.593750\n"
-                                   "vt 0.187500 0.156250\n"
-                                   "vt 0.187500 0.562500\n"
-                                   "vt 0.195313 1.000000\n"
-                                   "vt 0.187500 0.968750\n"
-                                   "vt 0.187500 0.125000\n"
-                                   "vt 0.187500 0.531250\n"
-                                   "vt 0.187500 0.937500\n"
-                                   "vt 0.187500 0.093750\n"
-                                   "vt 0.187500 0.500000\n"
-                                   "vt 0.187500 0.906250\n"
-                                   "vt 0.187500 0.062500\n"
-                                   "vt 0.187500 0.468750\n"
-                                   "vt 0.187500 0.875000\n"
-                                   "vt 0.187500 0.031250\n"
-                                   "vt 0.187500 0.437500\n"
-                                   "vt 0.187500 0.843750\n"
-                                   "vt 0.195313 0.000000\n"
-                                   "vt 0.187500 0.406250\n"
-                                   "vt 0.187500 0.375000\n"
-                                   "vt 0.171875 0.718750\n"
-                                   "vt 0.171875 0.312500\n"
-                                   "vt 0.171875 0.281250\n"
-                                   "vt 0.171875 0.687500\n"
-                                   "vt 0.171875 0.250000\n"
-                                   "vt 0.171875 0.656250\n"
-                                   "vt 0.171875 0.218750\n"
-                                   "vt 0.171875 0.625000\n"
-                                   "vt 0.171875 0.187500\n"
-                                   "vt 0.171875 0.593750\n"
-                                   "vt 0.171875 0.156250\n"
-                                   "vt 0.171875 0.562500\n"
-                                   "vt 0.179688 1.000000\n"
-                                   "vt 0.171875 0.968750\n"
-                                   "vt 0.171875 0.125000\n"
-                                   "vt 0.171875 0.531250\n"
-                                   "vt 0.171875 0.937500\n"
-                                   "vt 0.171875 0.093750\n"
-                                   "vt 0.171875 0.500000\n"
-                                   "vt 0.171875 0.906250\n"
-                                   "vt 0.171875 0.062500\n"
-                                   "vt 0.171875 0.468750\n"
-                                   "vt 0.171875 0.875000\n"
-                                   "vt 0.171875 0.031250\n"
-                                   "vt 0.171875 0.437500\n"
-                                   "vt 0.171875 0.843750\n"
-                                   "vt 0.179688 0.000000\n"
-                                   "vt 0.171875 0.406250\n"
-                                   "vt 0.171875 0.812500\n"
-                                   "vt 0.171875 0.375000\n"
-                                   "vt 0.171875 0.781250\n"
-                                   "vt 0.171875 0.343750\n"
-                                   "vt 0.171875 0.750000\n"
-                                   "vt 0.156250 0.656250\n"
-                                   "vt 0.156250 0.218750\n"
-                                   "vt 0.156250 0.625000\n"
-                                   "vt 0.156250 0.187500\n"
-                                   "vt 0.156250 0.593750\n"
-                                   "vt 0.156250 0.156250\n"
-                                   "vt 0.156250 0.562500\n"
-                                   "vt 0.164063 1.000000\n"
-                                   "vt 0.156250 0.968750\n"
-                                   "vt 0.156250 0.125000\n"
-                                   "vt 0.156250 0.531250\n"
-                                   "vt 0.156250 0.937500\n"
-                                   "vt 0.156250 0.093750\n"
-                                   "vt 0.156250 0.500000\n"
-                                   "vt 0.156250 0.906250\n"
-                                   "vt 0.156250 0.062500\n"
-                                   "vt 0.156250 0.468750\n"
-                                   "vt 0.156250 0.875000\n"
-                                   "vt 0.156250 0.031250\n"
-                                   "vt 0.156250 0.437500\n"
-                                   "vt 0.156250 0.843750\n"
-                                   "vt 0.164063 0.000000\n"
-                                   "vt 0.156250 0.406250\n"
-                                   "vt 0.156250 0.812500\n"
-                                   "vt 0.156250 0.375000\n"
-                                   "vt 0.156250 0.781250\n"
-                                   "vt 0.156250 0.343750\n"
-                                   "vt 0.156250 0.750000\n"
-                                   "vt 0.156250 0.312500\n"
-                                   "vt 0.156250 0.718750\n"
-                                   "vt 0.156250 0.281250\n"
-                                   "vt 0.156250 0.687500\n"
-                                   "vt 0.156250 0.250000\n"
-                                   "vt 0.140625 0.593750\n"
-                                   "vt 0.140625 0.187500\n"
-                                   "vt 0.140625 0.156250\n"
-                                   "vt 0.140625 0.562500\n"
-                                   "vt 0.148438 1.000000\n"
-                                   "vt 0.140625 0.968750\n"
-                                   "vt 0.140625 0.125000\n"
-                                   "vt 0.140625 0.531250\n"
-                                   "vt 0.140625 0.937500\n"
-                                   "vt 0.140625 0.093750\n"
-                                   "vt 0.140625 0.500000\n"
-                                   "vt 0.140625 0.906250\n"
-                                   "vt 0.140625 0.062500\n"
-                                   "vt 0.140625 0.468750\n"
-                                   "vt 0.140625 0.875000\n"
-                                   "vt 0.140625 0.031250\n"
-                                   "vt 0.140625 0.437500\n"
-                                   "vt 0.140625 0.843750\n"
-                                   "vt 0.148438 0.000000\n"
-                                   "vt 0.140625 0.406250\n"
-                                   "vt 0.140625 0.812500\n"
-                                   "vt 0.140625 0.375000\n"
-                                   "vt 0.140625 0.781250\n"
-                                   "vt 0.140625 0.343750\n"
-                                   "vt 0.140625 0.750000\n"
-                                   "vt 0.140625 0.312500\n"
-                                   "vt 0.140625 0.718750\n"
-                                   "vt 0.140625 0.281250\n"
-                                   "vt 0.140625 0.687500\n"
-                                   "vt 0.140625 0.250000\n"
-                                   "vt 0.140625 0.656250\n"
-                                   "vt 0.140625 0.218750\n"
-                                   "vt 0.140625 0.625000\n"
-                                   "vt 0.125000 0.562500\n"
-                                   "vt 0.125000 0.531250\n"
-                                   "vt 0.125000 0.937500\n"
-                                   "vt 0.125000 0.125000\n"
-                                   "vt 0.125000 0.093750\n"
-                                   "vt 0.125000 0.500000\n"
-                                   "vt 0.125000 0.906250\n"
-                                   "vt 0.125000 0.062500\n"
-                                   "vt 0.125000 0.468750\n"
-                                   "vt 0.125000 0.875000\n"
-                                   "vt 0.125000 0.031250\n"
-                                   "vt 0.125000 0.437500\n"
-                                   "vt 0.125000 0.843750\n"
-                                   "vt 0.132813 0.000000\n"
-                                   "vt 0.125000 0.406250\n"
-                                   "vt 0.125000 0.812500\n"
-                                   "vt 0.125000 0.375000\n"
-                                   "vt 0.125000 0.781250\n"
-                                   "vt 0.125000 0.343750\n"
-                                   "vt 0.125000 0.750000\n"
-                                   "vt 0.125000 0.312500\n"
-                                   "vt 0.125000 0.718750\n"
-                                   "vt 0.125000 0.281250\n"
-                                   "vt 0.125000 0.687500\n"
-                                   "vt 0.125000 0.250000\n"
-                                   "vt 0.125000 0.656250\n"
-                                   "vt 0.125000 0.218750\n"
-                                   "vt 0.125000 0.625000\n"
-                                   "vt 0.125000 0.187500\n"
-                                   "vt 0.125000 0.593750\n"
-                                   "vt 0.125000 0.156250\n"
-                                   "vt 0.132813 1.000000\n"
-                                   "vt 0.125000 0.968750\n"
-                                   "vt 0.109375 0.468750\n"
-                                   "vt 0.109375 0.906250\n"
-                                   "vt 0.109375 0.875000\n"
-                                   "vt 0.109375 0.031250\n"
-                                   "vt 0.109375 0.437500\n"
-                                   "vt 0.109375 0.843750\n"
-                                   "vt 0.117188 0.000000\n"
-                                   "vt 0.109375 0.406250\n"
-                                   "vt 0.109375 0.812500\n"
-                                   "vt 0.109375 0.375000\n"
-                                   "vt 0.109375 0.781250\n"
-                                   "vt 0.109375 0.343750\n"
-                                   "vt 0.109375 0.750000\n"
-                                   "vt 0.109375 0.312500\n"
-                                   "vt 0.109375 0.718750\n"
-                                   "vt 0.109375 0.281250\n"
-                                   "vt 0.109375 0.687500\n"
-                                   "vt 0.109375 0.250000\n"
-                                   "vt 0.109375 0.656250\n"
-                                   "vt 0.109375 0.218750\n"
-                                   "vt 0.109375 0.625000\n"
-                                   "vt 0.109375 0.187500\n"
-                                   "vt 0.109375 0.593750\n"
-                                   "vt 0.109375 0.156250\n"
-                                   "vt 0.109375 0.562500\n"
-                                   "vt 0.117188 1.000000\n"
-                                   "vt 0.109375 0.968750\n"
-                                   "vt 0.109375 0.125000\n"
-                                   "vt 0.109375 0.531250\n"
-                                   "vt 0.109375 0.937500\n"
-                                   "vt 0.109375 0.093750\n"
-                                   "vt 0.109375 0.500000\n"
-                                   "vt 0.109375 0.062500\n"
-                                   "vt 0.093750 0.437500\n"
-                                   "vt 0.093750 0.406250\n"
-                                   "vt 0.093750 0.812500\n"
-                                   "vt 0.093750 0.375000\n"
-                                   "vt 0.093750 0.781250\n"
-                                   "vt 0.093750 0.343750\n"
-                                   "vt 0.093750 0.750000\n"
-                                   "vt 0.093750 0.312500\n"
-                                   "vt 0.093750 0.718750\n"
-                                   "vt 0.093750 0.281250\n"
-                                   "vt 0.093750 0.687500\n"
-                                   "vt 0.093750 0.250000\n"
-                                   "vt 0.093750 0.656250\n"
-                                   "vt 0.093750 0.218750\n"
-                                   "vt 0.093750 0.625000\n"
-                                   "vt 0.093750 0.187500\n"
-                                   "vt 0.093750 0.593750\n"
-                                   "vt 0.093750 0.156250\n"
-                                   "vt 0.093750 0.562500\n"
-                                   "vt 0.101563 1.000000\n"
-                                   "vt 0.093750 0.968750\n"
-                                   "vt 0.093750 0.125000\n"
-                                   "vt 0.093750 0.531250\n"
-                                   "vt 0.093750 0.937500\n"
-                                   "vt 0.093750 0.093750\n"
-                                   "vt 0.093750 0.500000\n"
-                                   "vt 0.093750 0.906250\n"
-                                   "vt 0.093750 0.062500\n"
-                                   "vt 0.093750 0.468750\n"
-                                   "vt 0.093750 0.875000\n"
-                                   "vt 0.093750 0.031250\n"
-                                   "vt 0.093750 0.843750\n"
-                                   "vt 0.101563 0.000000\n"
-                                   "vt 0.078125 0.343750\n"
-                                   "vt 0.078125 0.781250\n"
-                                   "vt 0.078125 0.750000\n"
-                                   "vt 0.078125 0.312500\n"
-                                   "vt 0.078125 0.718750\n"
-                                   "vt 0.078125 0.281250\n"
-                                   "vt 0.078125 0.687500\n"
-                                   "vt 0.078125 0.250000\n"
-                                   "vt 0.078125 0.656250\n"
-                                   "vt 0.078125 0.218750\n"
-                                   "vt 0.078125 0.625000\n"
-                                   "vt 0.078125 0.187500\n"
-                                   "vt 0.078125 0.593750\n"
-                                   "vt 0.078125 0.156250\n"
-                                   "vt 0.078125 0.562500\n"
-                                   "vt 0.085938 1.000000\n"
-                                   "vt 0.078125 0.968750\n"
-                                   "vt 0.078125 0.125000\n"
-                                   "vt 0.078125 0.531250\n"
-                                   "vt 0.078125 0.937500\n"
-                                   "vt 0.078125 0.093750\n"
-                                   "vt 0.078125 0.500000\n"
-                                   "vt 0.078125 0.906250\n"
-                                   "vt 0.078125 0.062500\n"
-                                   "vt 0.078125 0.468750\n"
-                                   "vt 0.078125 0.875000\n"
-                                   "vt 0.078125 0.031250\n"
-                                   "vt 0.078125 0.437500\n"
-                                   "vt 0.078125 0.843750\n"
-                                   "vt 0.085938 0.000000\n"
-                                   "vt 0.078125 0.406250\n"
-                                   "vt 0.078125 0.812500\n"
-                                   "vt 0.078125 0.375000\n"
-                                   "vt 0.062500 0.312500\n"
-                                   "vt 0.062500 0.281250\n"
-                                   "vt 0.062500 0.687500\n"
-                                   "vt 0.062500 0.250000\n"
-                                   "vt 0.062500 0.656250\n"
-                                   "vt 0.062500 0.218750\n"
-                                   "vt 0.062500 0.625000\n"
-                                   "vt 0.062500 0.187500\n"
-                                   "vt 0.062500 0.593750\n"
-                                   "vt 0.062500 0.156250\n"
-                                   "vt 0.062500 0.562500\n"
-                                   "vt 0.070313 1.000000\n"
-                                   "vt 0.062500 0.968750\n"
-                                   "vt 0.062500 0.125000\n"
-                                   "vt 0.062500 0.531250\n"
-                                   "vt 0.062500 0.937500\n"
-                                   "vt 0.062500 0.093750\n"
-                                   "vt 0.062500 0.500000\n"
-                                   "vt 0.062500 0.906250\n"
-                                   "vt 0.062500 0.062500\n"
-                                   "vt 0.062500 0.468750\n"
-                                   "vt 0.062500 0.875000\n"
-                                   "vt 0.062500 0.031250\n"
-                                   "vt 0.062500 0.437500\n"
-                                   "vt 0.062500 0.843750\n"
-                                   "vt 0.070313 0.000000\n"
-                                   "vt 0.062500 0.406250\n"
-                                   "vt 0.062500 0.812500\n"
-                                   "vt 0.062500 0.375000\n"
-                                   "vt 0.062500 0.781250\n"
-                                   "vt 0.062500 0.343750\n"
-                                   "vt 0.062500 0.750000\n"
-                                   "vt 0.062500 0.718750\n"
-                                   "vt 0.046875 0.218750\n"
-                                   "vt 0.046875 0.625000\n"
-                                   "vt 0.046875 0.187500\n"
-                                   "vt 0.046875 0.593750\n"
-                                   "vt 0.046875 0.156250\n"
-                                   "vt 0.046875 0.562500\n"
-                                   "vt 0.054688 1.000000\n"
-                                   "vt 0.046875 0.968750\n"
-                                   "vt 0.046875 0.125000\n"
-                                   "vt 0.046875 0.531250\n"
-                                   "vt 0.046875 0.937500\n"
-                                   "vt 0.046875 0.093750\n"
-                                   "vt 0.046875 0.500000\n"
-                                   "vt 0.046875 0.906250\n"
-                                   "vt 0.046875 0.062500\n"
-                                   "vt 0.046875 0.468750\n"
-                                   "vt 0.046875 0.875000\n"
-                                   "vt 0.046875 0.031250\n"
-                                   "vt 0.046875 0.437500\n"
-                                   "vt 0.046875 0.843750\n"
-                                   "vt 0.054688 0.000000\n"
-                                   "vt 0.046875 0.406250\n"
-                                   "vt 0.046875 0.812500\n"
-                                   "vt 0.046875 0.375000\n"
-                                   "vt 0.046875 0.781250\n"
-                                   "vt 0.046875 0.343750\n"
-                                   "vt 0.046875 0.750000\n"
-                                   "vt 0.046875 0.312500\n"
-                                   "vt 0.046875 0.718750\n"
-                                   "vt 0.046875 0.281250\n"
-                                   "vt 0.046875 0.687500\n"
-                                   "vt 0.046875 0.250000\n"
-                                   "vt 0.046875 0.656250\n"
-                                   "vt 0.031250 0.187500\n"
-                                   "vt 0.031250 0.156250\n"
-                                   "vt 0.031250 0.562500\n"
-                                   "vt 0.039063 1.000000\n"
-                                   "vt 0.031250 0.968750\n"
-                                   "vt 0.031250 0.125000\n"
-                                   "vt 0.031250 0.531250\n"
-                                   "vt 0.031250 0.937500\n"
-                                   "vt 0.031250 0.093750\n"
-                                   "vt 0.031250 0.500000\n"
-                                   "vt 0.031250 0.906250\n"
-                                   "vt 0.031250 0.062500\n"
-                                   "vt 0.031250 0.468750\n"
-                                   "vt 0.031250 0.875000\n"
-                                   "vt 0.031250 0.031250\n"
-                                   "vt 0.031250 0.437500\n"
-                                   "vt 0.031250 0.843750\n"
-                                   "vt 0.039063 0.000000\n"
-                                   "vt 0.031250 0.406250\n"
-                                   "vt 0.031250 0.812500\n"
-                                   "vt 0.031250 0.375000\n"
-                                   "vt 0.031250 0.781250\n"
-                                   "vt 0.031250 0.343750\n"
-                                   "vt 0.031250 0.750000\n"
-                                   "vt 0.031250 0.312500\n"
-                                   "vt 0.031250 0.718750\n"
-                                   "vt 0.031250 0.281250\n"
-                                   "vt 0.031250 0.687500\n"
-                                   "vt 0.031250 0.250000\n"
-                                   "vt 0.031250 0.656250\n"
-                                   "vt 0.031250 0.218750\n"
-                                   "vt 0.031250 0.625000\n"
-                                   "vt 0.031250 0.593750\n"
-                                   "vt 0.015625 0.093750\n"
-                                   "vt 0.015625 0.531250\n"
-                                   "vt 0.015625 0.500000\n"
-                                   "vt 0.015625 0.937500\n"
-                                   "vt 0.015625 0.906250\n"
-                                   "vt 0.015625 0.062500\n"
-                                   "vt 0.015625 0.468750\n"
-                                   "vt 0.015625 0.875000\n"
-                                   "vt 0.015625 0.031250\n"
-                                   "vt 0.015625 0.437500\n"
-                                   "vt 0.015625 0.843750\n"
-                                   "vt 0.023438 0.000000\n"
-                                   "vt 0.015625 0.406250\n"
-                                   "vt 0.015625 0.812500\n"
-                                   "vt 0.015625 0.375000\n"
-                                   "vt 0.015625 0.781250\n"
-                                   "vt 0.015625 0.343750\n"
-                                   "vt 0.015625 0.750000\n"
-                                   "vt 0.015625 0.312500\n"
-                                   "vt 0.015625 0.718750\n"
-                                   "vt 0.015625 0.281250\n"
-                                   "vt 0.015625 0.687500\n"
-                                   "vt 0.015625 0.250000\n"
-                                   "vt 0.015625 0.656250\n"
-                                   "vt 0.015625 0.218750\n"
-                                   "vt 0.015625 0.625000\n"
-                                   "vt 0.015625 0.187500\n"
-                                   "vt 0.015625 0.593750\n"
-                                   "vt 0.015625 0.156250\n"
-                                   "vt 0.015625 0.562500\n"
-                                   "vt 0.023438 1.000000\n"
-                                   "vt 0.015625 0.968750\n"
-                                   "vt 0.015625 0.125000\n"
-                                   "vt 0.000000 0.062500\n"
-                                   "vt 0.000000 0.031250\n"
-                                   "vt 0.000000 0.437500\n"
-                                   "vt 0.000000 0.843750\n"
-                                   "vt 0.007813 0.000000\n"
-                                   "vt 0.000000 0.406250\n"
-                                   "vt 0.000000 0.812500\n"
-                                   "vt 0.000000 0.375000\n"
-                                   "vt 0.000000 0.781250\n"
-                                   "vt 0.000000 0.343750\n"
-                                   "vt 0.000000 0.750000\n"
-                                   "vt 0.000000 0.312500\n"
-                                   "vt 0.000000 0.718750\n"
-                                   "vt 0.000000 0.281250\n"
-                                   "vt 0.000000 0.687500\n"
-                                   "vt 0.000000 0.250000\n"
-                                   "vt 0.000000 0.656250\n"
-                                   "vt 0.000000 0.218750\n"
-                                   "vt 0.000000 0.625000\n"
-                                   "vt 0.000000 0.187500\n"
-                                   "vt 0.000000 0.593750\n"
-                                   "vt 0.000000 0.156250\n"
-                                   "vt 0.000000 0.562500\n"
-                                   "vt 0.007813 1.000000\n"
-                                   "vt 0.000000 0.968750\n"
-                                   "vt 0.000000 0.125000\n"
-                                   "vt 0.000000 0.531250\n"
-                                   "vt 0.000000 0.937500\n"
-                                   "vt 0.000000 0.093750\n"
-                                   "vt 0.000000 0.500000\n"
-                                   "vt 0.000000 0.906250\n"
-                                   "vt 0.000000 0.468750\n"
-                                   "vt 0.000000 0.875000\n"
-                                   "vt 1.000000 0.406250\n"
-                                   "vt 0.984375 0.375000\n"
-                                   "vt 1.000000 0.375000\n"
-                                   "vt 1.000000 0.781250\n"
-                                   "vt 0.984375 0.812500\n"
-                                   "vt 0.984375 0.781250\n"
-                                   "vt 0.984375 0.343750\n"
-                                   "vt 1.000000 0.343750\n"
-                                   "vt 1.000000 0.750000\n"
-                                   "vt 0.984375 0.750000\n"
-                                   "vt 0.984375 0.312500\n"
-                                   "vt 1.000000 0.312500\n"
-                                   "vt 0.984375 0.718750\n"
-                                   "vt 1.000000 0.718750\n"
-                                   "vt 1.000000 0.281250\n"
-                                   "vt 0.984375 0.281250\n"
-                                   "vt 0.984375 0.687500\n"
-                                   "vt 1.000000 0.687500\n"
-                                   "vt 1.000000 0.250000\n"
-                                   "vt 0.984375 0.250000\n"
-                                   "vt 1.000000 0.656250\n"
-                                   "vt 0.984375 0.656250\n"
-                                   "vt 0.984375 0.218750\n"
-                                   "vt 1.000000 0.218750\n"
-                                   "vt 0.984375 0.625000\n"
-                                   "vt 1.000000 0.625000\n"
-                                   "vt 0.984375 0.187500\n"
-                                   "vt 1.000000 0.187500\n"
-                                   "vt 1.000000 0.593750\n"
-                                   "vt 0.984375 0.593750\n"
-                                   "vt 1.000000 0.156250\n"
-                                   "vt 0.984375 0.156250\n"
-                                   "vt 0.984375 0.562500\n"
-                                   "vt 1.000000 0.562500\n"
-                                   "vt 1.000000 0.968750\n"
-                                   "vt 0.992188 1.000000\n"
-                                   "vt 0.984375 0.968750\n"
-                                   "vt 0.984375 0.125000\n"
-                                   "vt 1.000000 0.125000\n"
-                                   "vt 1.000000 0.531250\n"
-                                   "vt 0.984375 0.531250\n"
-                                   "vt 0.984375 0.937500\n"
-                                   "vt 1.000000 0.937500\n"
-                                   "vt 1.000000 0.093750\n"
-                                   "vt 0.984375 0.093750\n"
-                                   "vt 1.000000 0.500000\n"
-                                   "vt 0.984375 0.500000\n"
-                                   "vt 1.000000 0.906250\n"
-                                   "vt 0.984375 0.906250\n"
-                                   "vt 0.984375 0.062500\n"
-                                   "vt 1.000000 0.062500\n"
-                                   "vt 0.984375 0.468750\n"
-                                   "vt 1.000000 0.468750\n"
-                                   "vt 1.000000 0.875000\n"
-                                   "vt 0.984375 0.875000\n"
-                                   "vt 1.000000 0.031250\n"
-                                   "vt 0.984375 0.031250\n"
-                                   "vt 0.984375 0.437500\n"
-                                   "vt 1.000000 0.437500\n"
-                                   "vt 0.984375 0.843750\n"
-                                   "vt 1.000000 0.843750\n"
-                                   "vt 0.992188 0.000000\n"
-                                   "vt 0.984375 0.406250\n"
-                                   "vt 1.000000 0.812500\n"
-                                   "vt 0.968750 0.312500\n"
-                                   "vt 0.968750 0.718750\n"
-                                   "vt 0.968750 0.281250\n"
-                                   "vt 0.968750 0.687500\n"
-                                   "vt 0.968750 0.250000\n"
-                                   "vt 0.968750 0.656250\n"
-                                   "vt 0.968750 0.218750\n"
-                                   "vt 0.968750 0.625000\n"
-                                   "vt 0.968750 0.187500\n"
-                                   "vt 0.968750 0.593750\n"
-                                   "vt 0.968750 0.156250\n"
-                                   "vt 0.968750 0.562500\n"
-                                   "vt 0.976563 1.000000\n"
-                                   "vt 0.968750 0.968750\n"
-                                   "vt 0.968750 0.125000\n"
-                                   "vt 0.968750 0.531250\n"
-                                   "vt 0.968750 0.937500\n"
-                                   "vt 0.968750 0.093750\n"
-                                   "vt 0.968750 0.500000\n"
-                                   "vt 0.968750 0.906250\n"
-                                   "vt 0.968750 0.062500\n"
-                                   "vt 0.968750 0.468750\n"
-                                   "vt 0.968750 0.875000\n"
-                                   "vt 0.968750 0.031250\n"
-                                   "vt 0.968750 0.437500\n"
-                                   "vt 0.968750 0.843750\n"
-                                   "vt 0.976563 0.000000\n"
-                                   "vt 0.968750 0.406250\n"
-                                   "vt 0.968750 0.812500\n"
-                                   "vt 0.968750 0.375000\n"
-                                   "vt 0.968750 0.781250\n"
-                                   "vt 0.968750 0.343750\n"
-                                   "vt 0.968750 0.750000\n"
-                                   "vt 0.953125 0.281250\n"
-                                   "vt 0.953125 0.250000\n"
-                                   "vt 0.953125 0.687500\n"
-                                   "vt 0.953125 0.656250\n"
-                                   "vt 0.953125 0.218750\n"
-                                   "vt 0.953125 0.625000\n"
-                                   "vt 0.953125 0.187500\n"
-                                   "vt 0.953125 0.593750\n"
-                                   "vt 0.953125 0.156250\n"
-                                   "vt 0.953125 0.562500\n"
-                                   "vt 0.960938 1.000000\n"
-                                   "vt 0.953125 0.968750\n"
-                                   "vt 0.953125 0.125000\n"
-                                   "vt 0.953125 0.531250\n"
-                                   "vt 0.953125 0.937500\n"
-                                   "vt 0.953125 0.093750\n"
-                                   "vt 0.953125 0.500000\n"
-                                   "vt 0.953125 0.906250\n"
-                                   "vt 0.953125 0.062500\n"
-                                   "vt 0.953125 0.468750\n"
-                                   "vt 0.953125 0.875000\n"
-                                   "vt 0.953125 0.031250\n"
-                                   "vt 0.953125 0.437500\n"
-                                   "vt 0.953125 0.843750\n"
-                                   "vt 0.960938 0.000000\n"
-                                   "vt 0.953125 0.406250\n"
-                                   "vt 0.953125 0.812500\n"
-                                   "vt 0.953125 0.375000\n"
-                                   "vt 0.953125 0.781250\n"
-                                   "vt 0.953125 0.343750\n"
-                                   "vt 0.953125 0.750000\n"
-                                   "vt 0.953125 0.312500\n"
-                                   "vt 0.953125 0.718750\n"
-                                   "vt 0.937500 0.218750\n"
-                                   "vt 0.937500 0.625000\n"
-                                   "vt 0.937500 0.187500\n"
-                                   "vt 0.937500 0.593750\n"
-                                   "vt 0.937500 0.156250\n"
-                                   "vt 0.937500 0.562500\n"
-                                   "vt 0.945313 1.000000\n"
-                                   "vt 0.937500 0.968750\n"
-                                   "vt 0.937500 0.125000\n"
-                                   "vt 0.937500 0.531250\n"
-                                   "vt 0.937500 0.937500\n"
-                                   "vt 0.937500 0.093750\n"
-                                   "vt 0.937500 0.500000\n"
-                                   "vt 0.937500 0.906250\n"
-                                   "vt 0.937500 0.062500\n"
-                                   "vt 0.937500 0.468750\n"
-                                   "vt 0.937500 0.875000\n"
-                                   "vt 0.937500 0.031250\n"
-                                   "vt 0.937500 0.437500\n"
-                                   "vt 0.937500 0.843750\n"
-                                   "vt 0.945313 0.000000\n"
-                                   "vt 0.937500 0.406250\n"
-                                   "vt 0.937500 0.812500\n"
-                                   "vt 0.937500 0.375000\n"
-                                   "vt 0.937500 0.781250\n"
-                                   "vt 0.937500 0.343750\n"
-                                   "vt 0.937500 0.750000\n"
-                                   "vt 0.937500 0.312500\n"
-                                   "vt 0.937500 0.718750\n"
-                                   "vt 0.937500 0.281250\n"
-                                   "vt 0.937500 0.687500\n"
-                                   "vt 0.937500 0.250000\n"
-                                   "vt 0.937500 0.656250\n"
-                                   "vt 0.921875 0.187500\n"
-                                   "vt 0.921875 0.156250\n"
-                                   "vt 0.921875 0.562500\n"
-                                   "vt 0.929688 1.000000\n"
-                                   "vt 0.921875 0.968750\n"
-                                   "vt 0.921875 0.125000\n"
-                                   "vt 0.921875 0.531250\n"
-                                   "vt 0.921875 0.937500\n"
-                                   "vt 0.921875 0.093750\n"
-                                   "vt 0.921875 0.500000\n"
-                                   "vt 0.921875 0.906250\n"
-                                   "vt 0.921875 0.062500\n"
-                                   "vt 0.921875 0.468750\n"
-                                   "vt 0.921875 0.875000\n"
-                                   "vt 0.921875 0.031250\n"
-                                   "vt 0.921875 0.437500\n"
-                                   "vt 0.921875 0.843750\n"
-                                   "vt 0.929688 0.000000\n"
-                                   "vt 0.921875 0.406250\n"
-                                   "vt 0.921875 0.812500\n"
-                                   "vt 0.921875 0.375000\n"
-                                   "vt 0.921875 0.781250\n"
-                                   "vt 0.921875 0.343750\n"
-                                   "vt 0.921875 0.750000\n"
-                                   "vt 0.921875 0.312500\n"
-                                   "vt 0.921875 0.718750\n"
-                                   "vt 0.921875 0.281250\n"
-                                   "vt 0.921875 0.687500\n"
-                                   "vt 0.921875 0.250000\n"
-                                   "vt 0.921875 0.656250\n"
-                                   "vt 0.921875 0.218750\n"
-                                   "vt 0.921875 0.625000\n"
-                                   "vt 0.921875 0.593750\n"
-                                   "vt 0.906250 0.937500\n"
-                                   "vt 0.906250 0.125000\n"
-                                   "vt 0.906250 0.093750\n"
-                                   "vt 0.906250 0.531250\n"
-                                   "vt 0.906250 0.500000\n"
-                                   "vt 0.906250 0.906250\n"
-                                   "vt 0.906250 0.062500\n"
-                                   "vt 0.906250 0.468750\n"
-                                   "vt 0.906250 0.875000\n"
-                                   "vt 0.906250 0.031250\n"
-                                   "vt 0.906250 0.437500\n"
-                                   "vt 0.906250 0.843750\n"
-                                   "vt 0.914063 0.000000\n"
-                                   "vt 0.906250 0.406250\n"
-                                   "vt 0.906250 0.812500\n"
-                                   "vt 0.906250 0.375000\n"
-                                   "vt 0.906250 0.781250\n"
-                                   "vt 0.906250 0.343750\n"
-                                   "vt 0.906250 0.750000\n"
-                                   "vt 0.906250 0.312500\n"
-                                   "vt 0.906250 0.718750\n"
-                                   "vt 0.906250 0.281250\n"
-                                   "vt 0.906250 0.687500\n"
-                                   "vt 0.906250 0.250000\n"
-                                   "vt 0.906250 0.656250\n"
-                                   "vt 0.906250 0.218750\n"
-                                   "vt 0.906250 0.625000\n"
-                                   "vt 0.906250 0.187500\n"
-                                   "vt 0.906250 0.593750\n"
-                                   "vt 0.906250 0.156250\n"
-                                   "vt 0.906250 0.562500\n"
-                                   "vt 0.914063 1.000000\n"
-                                   "vt 0.906250 0.968750\n"
-                                   "vt 0.890625 0.906250\n"
-                                   "vt 0.890625 0.875000\n"
-                                   "vt 0.890625 0.031250\n"
-                                   "vt 0.890625 0.437500\n"
-                                   "vt 0.890625 0.843750\n"
-                                   "vt 0.898438 0.000000\n"
-                                   "vt 0.890625 0.406250\n"
-                                   "vt 0.890625 0.812500\n"
-                                   "vt 0.890625 0.375000\n"
-                                   "vt 0.890625 0.781250\n"
-                                   "vt 0.890625 0.343750\n"
-                                   "vt 0.890625 0.750000\n"
-                                   "vt 0.890625 0.312500\n"
-                                   "vt 0.890625 0.718750\n"
-                                   "vt 0.890625 0.281250\n"
-                                   "vt 0.890625 0.687500\n"
-                                   "vt 0.890625 0.250000\n"
-                                   "vt 0.890625 0.656250\n"
-                                   "vt 0.890625 0.218750\n"
-                                   "vt 0.890625 0.625000\n"
-                                   "vt 0.890625 0.187500\n"
-                                   "vt 0.890625 0.593750\n"
-                                   "vt 0.890625 0.156250\n"
-                                   "vt 0.890625 0.562500\n"
-                                   "vt 0.898438 1.000000\n"
-                                   "vt 0.890625 0.968750\n"
-                                   "vt 0.890625 0.125000\n"
-                                   "vt 0.890625 0.531250\n"
-                                   "vt 0.890625 0.937500\n"
-                                   "vt 0.890625 0.093750\n"
-                                   "vt 0.890625 0.500000\n"
-                                   "vt 0.890625 0.062500\n"
-                                   "vt 0.890625 0.468750\n"
-                                   "vt 0.875000 0.812500\n"
-                                   "vt 0.875000 0.375000\n"
-                                   "vt 0.875000 0.781250\n"
-                                   "vt 0.875000 0.343750\n"
-                                   "vt 0.875000 0.750000\n"
-                                   "vt 0.875000 0.312500\n"
-                                   "vt 0.875000 0.718750\n"
-                                   "vt 0.875000 0.281250\n"
-                                   "vt 0.875000 0.687500\n"
-                                   "vt 0.875000 0.250000\n"
-                                   "vt 0.875000 0.656250\n"
-                                   "vt 0.875000 0.218750\n"
-                                   "vt 0.875000 0.625000\n"
-                                   "vt 0.875000 0.187500\n"
-                                   "vt 0.875000 0.593750\n"
-                                   "vt 0.875000 0.156250\n"
-                                   "vt 0.875000 0.562500\n"
-                                   "vt 0.882813 1.000000\n"
-                                   "vt 0.875000 0.968750\n"
-                                   "vt 0.875000 0.125000\n"
-                                   "vt 0.875000 0.531250\n"
-                                   "vt 0.875000 0.937500\n"
-                                   "vt 0.875000 0.093750\n"
-                                   "vt 0.875000 0.500000\n"
-                                   "vt 0.875000 0.906250\n"
-                                   "vt 0.875000 0.062500\n"
-                                   "vt 0.875000 0.468750\n"
-                                   "vt 0.875000 0.875000\n"
-                                   "vt 0.875000 0.031250\n"
-                                   "vt 0.875000 0.437500\n"
-                                   "vt 0.875000 0.843750\n"
-                                   "vt 0.882813 0.000000\n"
-                                   "vt 0.875000 0.406250\n"
-                                   "vt 0.859375 0.781250\n"
-                                   "vt 0.859375 0.750000\n"
-                                   "vt 0.859375 0.312500\n"
-                                   "vt 0.859375 0.718750\n"
-                                   "vt 0.859375 0.281250\n"
-                                   "vt 0.859375 0.687500\n"
-                                   "vt 0.859375 0.250000\n"
-                                   "vt 0.859375 0.656250\n"
-                                   "vt 0.859375 0.218750\n"
-                                   "vt 0.859375 0.625000\n"
-                                   "vt 0.859375 0.187500\n"
-                                   "vt 0.859375 0.593750\n"
-                                   "vt 0.859375 0.156250\n"
-                                   "vt 0.859375 0.562500\n"
-                                   "vt 0.867188 1.000000\n"
-                                   "vt 0.859375 0.968750\n"
-                                   "vt 0.859375 0.125000\n"
-                                   "vt 0.859375 0.531250\n"
-                                   "vt 0.859375 0.937500\n"
-                                   "vt 0.859375 0.093750\n"
-                                   "vt 0.859375 0.500000\n"
-                                   "vt 0.859375 0.906250\n"
-                                   "vt 0.859375 0.062500\n"
-                                   "vt 0.859375 0.468750\n"
-                                   "vt 0.859375 0.875000\n"
-                                   "vt 0.859375 0.031250\n"
-                                   "vt 0.859375 0.437500\n"
-                                   "vt 0.859375 0.843750\n"
-                                   "vt 0.867188 0.000000\n"
-                                   "vt 0.859375 0.406250\n"
-                                   "vt 0.859375 0.812500\n"
-                                   "vt 0.859375 0.375000\n"
-                                   "vt 0.859375 0.343750\n"
-                                   "vt 0.843750 0.687500\n"
-                                   "vt 0.843750 0.281250\n"
-                                   "vt 0.843750 0.250000\n"
-                                   "vt 0.843750 0.656250\n"
-                                   "vt 0.843750 0.218750\n"
-                                   "vt 0.843750 0.625000\n"
-                                   "vt 0.843750 0.187500\n"
-                                   "vt 0.843750 0.593750\n"
-                                   "vt 0.843750 0.156250\n"
-                                   "vt 0.843750 0.562500\n"
-                                   "vt 0.851563 1.000000\n"
-                                   "vt 0.843750 0.968750\n"
-                                   "vt 0.843750 0.125000\n"
-                                   "vt 0.843750 0.531250\n"
-                                   "vt 0.843750 0.937500\n"
-                                   "vt 0.843750 0.093750\n"
-                                   "vt 0.843750 0.500000\n"
-                                   "vt 0.843750 0.906250\n"
-                                   "vt 0.843750 0.062500\n"
-                                   "vt 0.843750 0.468750\n"
-                                   "vt 0.843750 0.875000\n"
-                                   "vt 0.843750 0.031250\n"
-                                   "vt 0.843750 0.437500\n"
-                                   "vt 0.843750 0.843750\n"
-                                   "vt 0.851563 0.000000\n"
-                                   "vt 0.843750 0.406250\n"
-                                   "vt 0.843750 0.812500\n"
-                                   "vt 0.843750 0.375000\n"
-                                   "vt 0.843750 0.781250\n"
-                                   "vt 0.843750 0.343750\n"
-                                   "vt 0.843750 0.750000\n"
-                                   "vt 0.843750 0.312500\n"
-                                   "vt 0.843750 0.718750\n"
-                                   "vt 0.828125 0.625000\n"
-                                   "vt 0.828125 0.187500\n"
-                                   "vt 0.828125 0.593750\n"
-                                   "vt 0.828125 0.156250\n"
-                                   "vt 0.828125 0.562500\n"
-                                   "vt 0.835938 1.000000\n"
-                                   "vt 0.828125 0.968750\n"
-                                   "vt 0.828125 0.125000\n"
-                                   "vt 0.828125 0.531250\n"
-                                   "vt 0.828125 0.937500\n"
-                                   "vt 0.828125 0.093750\n"
-                                   "vt 0.828125 0.500000\n"
-                                   "vt 0.828125 0.906250\n"
-                                   "vt 0.828125 0.062500\n"
-                                   "vt 0.828125 0.468750\n"
-                                   "vt 0.828125 0.875000\n"
-                                   "vt 0.828125 0.031250\n"
-                                   "vt 0.828125 0.437500\n"
-                                   "vt 0.828125 0.843750\n"
-                                   "vt 0.835938 0.000000\n"
-                                   "vt 0.828125 0.406250\n"
-                                   "vt 0.828125 0.812500\n"
-                                   "vt 0.828125 0.375000\n"
-                                   "vt 0.828125 0.781250\n"
-                                   "vt 0.828125 0.343750\n"
-                                   "vt 0.828125 0.750000\n"
-                                   "vt 0.828125 0.312500\n"
-                                   "vt 0.828125 0.718750\n"
-                                   "vt 0.828125 0.281250\n"
-                                   "vt 0.828125 0.687500\n"
-                                   "vt 0.828125 0.250000\n"
-                                   "vt 0.828125 0.656250\n"
-                                   "vt 0.828125 0.218750\n"
-                                   "vt 0.812500 0.562500\n"
-                                   "vt 0.820313 1.000000\n"
-                                   "vt 0.812500 0.968750\n"
-                                   "vt 0.812500 0.125000\n"
-                                   "vt 0.812500 0.531250\n"
-                                   "vt 0.812500 0.937500\n"
-                                   "vt 0.812500 0.093750\n"
-                                   "vt 0.812500 0.500000\n"
-                                   "vt 0.812500 0.906250\n"
-                                   "vt 0.812500 0.062500\n"
-                                   "vt 0.812500 0.468750\n"
-                                   "vt 0.812500 0.875000\n"
-                                   "vt 0.812500 0.031250\n"
-                                   "vt 0.812500 0.437500\n"
-                                   "vt 0.812500 0.843750\n"
-                                   "vt 0.820313 0.000000\n"
-                                   "vt 0.812500 0.406250\n"
-                                   "vt 0.812500 0.812500\n"
-                                   "vt 0.812500 0.375000\n"
-                                   "vt 0.812500 0.781250\n"
-                                   "vt 0.812500 0.343750\n"
-                                   "vt 0.812500 0.750000\n"
-                                   "vt 0.812500 0.312500\n"
-                                   "vt 0.812500 0.718750\n"
-                                   "vt 0.812500 0.281250\n"
-                                   "vt 0.812500 0.687500\n"
-                                   "vt 0.812500 0.250000\n"
-                                   "vt 0.812500 0.656250\n"
-                                   "vt 0.812500 0.218750\n"
-                                   "vt 0.812500 0.625000\n"
-                                   "vt 0.812500 0.187500\n"
-                                   "vt 0.812500 0.593750\n"
-                                   "vt 0.812500 0.156250\n"
-                                   "vt 0.796875 0.531250\n"
-                                   "vt 0.796875 0.500000\n"
-                                   "vt 0.796875 0.906250\n"
-                                   "vt 0.796875 0.062500\n"
-                                   "vt 0.796875 0.468750\n"
-                                   "vt 0.796875 0.875000\n"
-                                   "vt 0.796875 0.031250\n"
-                                   "vt 0.796875 0.437500\n"
-                                   "vt 0.796875 0.843750\n"
-                                   "vt 0.804688 0.000000\n"
-                                   "vt 0.796875 0.406250\n"
-                                   "vt 0.796875 0.812500\n"
-                                   "vt 0.796875 0.375000\n"
-                                   "vt 0.796875 0.781250\n"
-                                   "vt 0.796875 0.343750\n"
-                                   "vt 0.796875 0.750000\n"
-                                   "vt 0.796875 0.312500\n"
-                                   "vt 0.796875 0.718750\n"
-                                   "vt 0.796875 0.281250\n"
-                                   "vt 0.796875 0.687500\n"
-                                   "vt 0.796875 0.250000\n"
-                                   "vt 0.796875 0.656250\n"
-                                   "vt 0.796875 0.218750\n"
-                                   "vt 0.796875 0.625000\n"
-                                   "vt 0.796875 0.187500\n"
-                                   "vt 0.796875 0.593750\n"
-                                   "vt 0.796875 0.156250\n"
-                                   "vt 0.796875 0.562500\n"
-                                   "vt 0.804688 1.000000\n"
-                                   "vt 0.796875 0.968750\n"
-                                   "vt 0.796875 0.125000\n"
-                                   "vt 0.796875 0.937500\n"
-                                   "vt 0.796875 0.093750\n"
-                                   "vt 0.781250 0.437500\n"
-                                   "vt 0.781250 0.843750\n"
-                                   "vt 0.789062 0.000000\n"
-                                   "vt 0.781250 0.031250\n"
-                                   "vt 0.781250 0.406250\n"
-                                   "vt 0.781250 0.812500\n"
-                                   "vt 0.781250 0.375000\n"
-                                   "vt 0.781250 0.781250\n"
-                                   "vt 0.781250 0.343750\n"
-                                   "vt 0.781250 0.750000\n"
-                                   "vt 0.781250 0.312500\n"
-                                   "vt 0.781250 0.718750\n"
-                                   "vt 0.781250 0.281250\n"
-                                   "vt 0.781250 0.687500\n"
-                                   "vt 0.781250 0.250000\n"
-                                   "vt 0.781250 0.656250\n"
-                                   "vt 0.781250 0.218750\n"
-                                   "vt 0.781250 0.625000\n"
-                                   "vt 0.781250 0.187500\n"
-                                   "vt 0.781250 0.593750\n"
-                                   "vt 0.781250 0.156250\n"
-                                   "vt 0.781250 0.562500\n"
-                                   "vt 0.789063 1.000000\n"
-                                   "vt 0.781250 0.968750\n"
-                                   "vt 0.781250 0.125000\n"
-                                   "vt 0.781250 0.531250\n"
-                                   "vt 0.781250 0.937500\n"
-                                   "vt 0.781250 0.093750\n"
-                                   "vt 0.781250 0.500000\n"
-                                   "vt 0.781250 0.906250\n"
-                                   "vt 0.781250 0.062500\n"
-                                   "vt 0.781250 0.468750\n"
-                                   "vt 0.781250 0.875000\n"
-                                   "vt 0.765625 0.375000\n"
-                                   "vt 0.765625 0.812500\n"
-                                   "vt 0.765625 0.781250\n"
-                                   "vt 0.765625 0.343750\n"
-                                   "vt 0.765625 0.750000\n"
-                                   "vt 0.765625 0.312500\n"
-                                   "vt 0.765625 0.718750\n"
-                                   "vt 0.765625 0.281250\n"
-                                   "vt 0.765625 0.687500\n"
-                                   "vt 0.765625 0.250000\n"
-                                   "vt 0.765625 0.656250\n"
-                                   "vt 0.765625 0.218750\n"
-                                   "vt 0.765625 0.625000\n"
-                                   "vt 0.765625 0.187500\n"
-                                   "vt 0.765625 0.593750\n"
-                                   "vt 0.765625 0.156250\n"
-                                   "vt 0.765625 0.562500\n"
-                                   "vt 0.773438 1.000000\n"
-                                   "vt 0.765625 0.968750\n"
-                                   "vt 0.765625 0.125000\n"
-                                   "vt 0.765625 0.531250\n"
-                                   "vt 0.765625 0.937500\n"
-                                   "vt 0.765625 0.093750\n"
-                                   "vt 0.765625 0.500000\n"
-                                   "vt 0.765625 0.906250\n"
-                                   "vt 0.765625 0.062500\n"
-                                   "vt 0.765625 0.468750\n"
-                                   "vt 0.765625 0.875000\n"
-                                   "vt 0.765625 0.031250\n"
-                                   "vt 0.765625 0.437500\n"
-                                   "vt 0.765625 0.843750\n"
-                                   "vt 0.773438 0.000000\n"
-                                   "vt 0.765625 0.406250\n"
-                                   "vt 0.757813 1.000000\n"
-                                   "vt 0.757812 0.000000\n"
-                                   "vn 0.0000 -1.0000 -0.0000\n"
-                                   "vn -0.0000 -0.9950 -0.0995\n"
-                                   "vn 0.0098 -0.9950 -0.0991\n"
-                                   "vn -0.0000 -0.1948 -0.9808\n"
-                                   "vn 0.0938 -0.2899 -0.9525\n"
-                                   "vn -0.0000 -0.2899 -0.9571\n"
-                                   "vn 0.0000 0.8308 -0.5566\n"
-                                   "vn 0.0463 0.8813 -0.4703\n"
-                                   "vn 0.0546 0.8308 -0.5539\n"
-                                   "vn 0.0906 -0.3821 -0.9197\n"
-                                   "vn -0.0000 -0.3821 -0.9241\n"
-                                   "vn 0.0623 0.7723 -0.6322\n"
-                                   "vn -0.0000 0.7723 -0.6353\n"
-                                   "vn -0.0000 -0.4708 -0.8823\n"
-                                   "vn 0.0865 -0.4708 -0.8780\n"
-                                   "vn 0.0694 0.7063 -0.7045\n"
-                                   "vn -0.0000 0.7063 -0.7079\n"
-                                   "vn 0.0815 -0.5549 -0.8279\n"
-                                   "vn -0.0000 -0.5549 -0.8319\n"
-                                   "vn 0.0758 0.6336 -0.7699\n"
-                                   "vn -0.0000 0.6336 -0.7736\n"
-                                   "vn 0.0758 -0.6336 -0.7699\n"
-                                   "vn -0.0000 -0.6336 -0.7736\n"
-                                   "vn 0.0815 0.5549 -0.8279\n"
-                                   "vn -0.0000 0.5549 -0.8319\n"
-                                   "vn 0.0694 -0.7063 -0.7045\n"
-                                   "vn 0.0000 -0.7063 -0.7079\n"
-                                   "vn 0.0865 0.4708 -0.8780\n"
-                                   "vn -0.0000 0.4708 -0.8823\n"
-                                   "vn -0.0000 -0.7723 -0.6353\n"
-                                   "vn 0.0623 -0.7723 -0.6322\n"
-                                   "vn -0.0000 0.3821 -0.9241\n"
-                                   "vn 0.0906 0.3821 -0.9197\n"
-                                   "vn 0.0000 -0.8308 -0.5566\n"
-                                   "vn 0.0546 -0.8308 -0.5539\n"
-                                   "vn -0.0000 0.2899 -0.9571\n"
-                                   "vn 0.0938 0.2899 -0.9525\n"
-                                   "vn -0.0000 -0.8813 -0.4726\n"
-                                   "vn 0.0463 -0.8813 -0.4703\n"
-                                   "vn 0.0961 0.1948 -0.9761\n"
-                                   "vn -0.0000 0.1948 -0.9808\n"
-                                   "vn -0.0000 0.9950 -0.0995\n"
-                                   "vn -0.0000 1.0000 -0.0000\n"
-                                   "vn 0.0098 0.9950 -0.0991\n"
-                                   "vn 0.0376 -0.9233 -0.3821\n"
-                                   "vn -0.0000 -0.9233 -0.3840\n"
-                                   "vn 0.0975 0.0979 -0.9904\n"
-                                   "vn -0.0000 0.0979 -0.9952\n"
-                                   "vn 0.0193 0.9805 -0.1956\n"
-                                   "vn 0.0000 0.9805 -0.1966\n"
-                                   "vn 0.0286 -0.9565 -0.2903\n"
-                                   "vn 0.0000 -0.9565 -0.2917\n"
-                                   "vn 0.0980 -0.0000 -0.9952\n"
-                                   "vn -0.0000 -0.0000 -1.0000\n"
-                                   "vn 0.0286 0.9565 -0.2903\n"
-                                   "vn 0.0000 0.9565 -0.2917\n"
-                                   "vn 0.0193 -0.9805 -0.1956\n"
-                                   "vn -0.0000 -0.9805 -0.1966\n"
-                                   "vn 0.0975 -0.0979 -0.9904\n"
-                                   "vn -0.0000 -0.0979 -0.9952\n"
-                                   "vn 0.0376 0.9233 -0.3821\n"
-                                   "vn -0.0000 0.9233 -0.3840\n"
-                                   "vn 0.0961 -0.1948 -0.9761\n"
-                                   "vn -0.0000 0.8813 -0.4726\n"
-                                   "vn 0.0922 -0.8813 -0.4635\n"
-                                   "vn 0.1867 0.2899 -0.9387\n"
-                                   "vn 0.1914 0.1948 -0.9620\n"
-                                   "vn 0.0194 0.9950 -0.0976\n"
-                                   "vn 0.0749 -0.9233 -0.3766\n"
-                                   "vn 0.1942 0.0979 -0.9761\n"
-                                   "vn 0.0383 0.9805 -0.1928\n"
-                                   "vn 0.0569 -0.9565 -0.2861\n"
-                                   "vn 0.1951 -0.0000 -0.9808\n"
-                                   "vn 0.0569 0.9565 -0.2861\n"
-                                   "vn 0.0383 -0.9805 -0.1928\n"
-                                   "vn 0.1942 -0.0979 -0.9761\n"
-                                   "vn 0.0749 0.9233 -0.3766\n"
-                                   "vn 0.0194 -0.9950 -0.0976\n"
-                                   "vn 0.1914 -0.1948 -0.9620\n"
-                                   "vn 0.0922 0.8813 -0.4635\n"
-                                   "vn 0.1867 -0.2899 -0.9387\n"
-                                   "vn 0.1086 0.8308 -0.5459\n"
-                                   "vn 0.1803 -0.3821 -0.9063\n"
-                                   "vn 0.1239 0.7723 -0.6231\n"
-                                   "vn 0.1721 -0.4708 -0.8653\n"
-                                   "vn 0.1381 0.7063 -0.6943\n"
-                                   "vn 0.1623 -0.5549 -0.8160\n"
-                                   "vn 0.1509 0.6336 -0.7588\n"
-                                   "vn 0.1509 -0.6336 -0.7588\n"
-                                   "vn 0.1623 0.5549 -0.8160\n"
-                                   "vn 0.1381 -0.7063 -0.6943\n"
-                                   "vn 0.1721 0.4708 -0.8653\n"
-                                   "vn 0.1239 -0.7723 -0.6231\n"
-                                   "vn 0.1803 0.3821 -0.9063\n"
-                                   "vn 0.1086 -0.8308 -0.5459\n"
-                                   "vn 0.0571 0.9805 -0.1881\n"
-                                   "vn 0.0847 -0.9565 -0.2791\n"
-                                   "vn 0.2889 0.0979 -0.9523\n"
-                                   "vn 0.2903 -0.0000 -0.9569\n"
-                                   "vn 0.0847 0.9565 -0.2791\n"
-                                   "vn 0.0571 -0.9805 -0.1881\n"
-                                   "vn 0.2889 -0.0979 -0.9523\n"
-                                   "vn 0.1115 0.9233 -0.3675\n"
-                                   "vn 0.0289 -0.9950 -0.0953\n"
-                                   "vn 0.2847 -0.1948 -0.9386\n"
-                                   "vn 0.1372 0.8813 -0.4522\n"
-                                   "vn 0.2778 -0.2899 -0.9159\n"
-                                   "vn 0.1616 0.8308 -0.5327\n"
-                                   "vn 0.2683 -0.3821 -0.8843\n"
-                                   "vn 0.1844 0.7723 -0.6080\n"
-                                   "vn 0.2561 -0.4708 -0.8443\n"
-                                   "vn 0.2055 0.7063 -0.6774\n"
-                                   "vn 0.2415 -0.5549 -0.7961\n"
-                                   "vn 0.2246 0.6336 -0.7403\n"
-                                   "vn 0.2246 -0.6336 -0.7403\n"
-                                   "vn 0.2415 0.5549 -0.7961\n"
-                                   "vn 0.2055 -0.7063 -0.6774\n"
-                                   "vn 0.2561 0.4708 -0.8443\n"
-                                   "vn 0.1844 -0.7723 -0.6080\n"
-                                   "vn 0.2683 0.3821 -0.8843\n"
-                                   "vn 0.1616 -0.8308 -0.5327\n"
-                                   "vn 0.2778 0.2899 -0.9159\n"
-                                   "vn 0.1372 -0.8813 -0.4522\n"
-                                   "vn 0.2847 0.1948 -0.9386\n"
-                                   "vn 0.0289 0.9950 -0.0952\n"
-                                   "vn 0.1115 -0.9233 -0.3675\n"
-                                   "vn 0.1469 0.9233 -0.3548\n"
-                                   "vn 0.0381 -0.9950 -0.0920\n"
-                                   "vn 0.3808 -0.0979 -0.9194\n"
-                                   "vn 0.3754 -0.1948 -0.9062\n"
-                                   "vn 0.1809 0.8813 -0.4366\n"
-                                   "vn 0.3663 -0.2899 -0.8842\n"
-                                   "vn 0.2130 0.8308 -0.5143\n"
-                                   "vn 0.3536 -0.3821 -0.8538\n"
-                                   "vn 0.2431 0.7723 -0.5869\n"
-                                   "vn 0.3376 -0.4708 -0.8151\n"
-                                   "vn 0.2709 0.7063 -0.6540\n"
-                                   "vn 0.3184 -0.5549 -0.7686\n"
-                                   "vn 0.2961 0.6336 -0.7147\n"
-                                   "vn 0.2961 -0.6336 -0.7147\n"
-                                   "vn 0.3184 0.5549 -0.7686\n"
-                                   "vn 0.2709 -0.7063 -0.6540\n"
-                                   "vn 0.3376 0.4708 -0.8151\n"
-                                   "vn 0.2431 -0.7723 -0.5869\n"
-                                   "vn 0.3536 0.3821 -0.8538\n"
-                                   "vn 0.2130 -0.8308 -0.5143\n"
-                                   "vn 0.3663 0.2899 -0.8842\n"
-                                   "vn 0.1809 -0.8813 -0.4366\n"
-                                   "vn 0.3754 0.1948 -0.9062\n"
-                                   "vn 0.0381 0.9950 -0.0920\n"
-                                   "vn 0.1469 -0.9233 -0.3548\n"
-                                   "vn 0.3808 0.0979 -0.9194\n"
-                                   "vn 0.0752 0.9805 -0.1816\n"
-                                   "vn 0.1116 -0.9565 -0.2695\n"
-                                   "vn 0.3827 0.0000 -0.9239\n"
-                                   "vn 0.1116 0.9565 -0.2695\n"
-                                   "vn 0.0752 -0.9805 -0.1816\n"
-                                   "vn 0.2624 0.8308 -0.4909\n"
-                                   "vn 0.4512 -0.2899 -0.8441\n"
-                                   "vn 0.4356 -0.3821 -0.8150\n"
-                                   "vn 0.2995 0.7723 -0.5603\n"
-                                   "vn 0.4159 -0.4708 -0.7781\n"
-                                   "vn 0.3337 0.7063 -0.6243\n"
-                                   "vn 0.3922 -0.5549 -0.7337\n"
-                                   "vn 0.3647 0.6336 -0.6823\n"
-                                   "vn 0.3647 -0.6336 -0.6823\n"
-                                   "vn 0.3922 0.5549 -0.7337\n"
-                                   "vn 0.3337 -0.7063 -0.6243\n"
-                                   "vn 0.4159 0.4708 -0.7781\n"
-                                   "vn 0.2995 -0.7723 -0.5603\n"
-                                   "vn 0.4356 0.3821 -0.8150\n"
-                                   "vn 0.2624 -0.8308 -0.4909\n"
-                                   "vn 0.4512 0.2899 -0.8441\n"
-                                   "vn 0.2228 -0.8813 -0.4168\n"
-                                   "vn 0.4624 0.1948 -0.8650\n"
-                                   "vn 0.0469 0.9950 -0.0878\n"
-                                   "vn 0.1810 -0.9233 -0.3386\n"
-                                   "vn 0.4691 0.0979 -0.8777\n"
-                                   "vn 0.0927 0.9805 -0.1734\n"
-                                   "vn 0.1375 -0.9565 -0.2572\n"
-                                   "vn 0.4714 0.0000 -0.8819\n"
-                                   "vn 0.1375 0.9565 -0.2572\n"
-                                   "vn 0.0927 -0.9805 -0.1734\n"
-                                   "vn 0.4691 -0.0979 -0.8777\n"
-                                   "vn 0.1810 0.9233 -0.3386\n"
-                                   "vn 0.0469 -0.9950 -0.0878\n"
-                                   "vn 0.4624 -0.1948 -0.8650\n"
-                                   "vn 0.2228 0.8813 -0.4168\n"
-                                   "vn 0.3530 0.7723 -0.5282\n"
-                                   "vn 0.3933 0.7063 -0.5886\n"
-                                   "vn 0.4902 -0.4708 -0.7336\n"
-                                   "vn 0.4622 -0.5549 -0.6917\n"
-                                   "vn 0.4298 0.6336 -0.6432\n"
-                                   "vn 0.4298 -0.6336 -0.6432\n"
-                                   "vn 0.4622 0.5549 -0.6917\n"
-                                   "vn 0.3933 -0.7063 -0.5886\n"
-                                   "vn 0.4902 0.4708 -0.7336\n"
-                                   "vn 0.3530 -0.7723 -0.5282\n"
-                                   "vn 0.5134 0.3821 -0.7684\n"
-                                   "vn 0.3092 -0.8308 -0.4628\n"
-                                   "vn 0.5317 0.2899 -0.7958\n"
-                                   "vn 0.2626 -0.8813 -0.3929\n"
-                                   "vn 0.5449 0.1948 -0.8155\n"
-                                   "vn 0.0553 0.9950 -0.0828\n"
-                                   "vn 0.2133 -0.9233 -0.3193\n"
-                                   "vn 0.5529 0.0979 -0.8275\n"
-                                   "vn 0.1092 0.9805 -0.1634\n"
-                                   "vn 0.1621 -0.9565 -0.2425\n"
-                                   "vn 0.5556 -0.0000 -0.8315\n"
-                                   "vn 0.1621 0.9565 -0.2425\n"
-                                   "vn 0.1092 -0.9805 -0.1634\n"
-                                   "vn 0.5529 -0.0979 -0.8275\n"
-                                   "vn 0.2133 0.9233 -0.3193\n"
-                                   "vn 0.0553 -0.9950 -0.0828\n"
-                                   "vn 0.5449 -0.1948 -0.8155\n"
-                                   "vn 0.2626 0.8813 -0.3929\n"
-                                   "vn 0.5317 -0.2899 -0.7958\n"
-                                   "vn 0.3092 0.8308 -0.4628\n"
-                                   "vn 0.5134 -0.3821 -0.7684\n"
-                                   "vn 0.4908 0.6336 -0.5980\n"
-                                   "vn 0.5278 0.5549 -0.6431\n"
-                                   "vn 0.4908 -0.6336 -0.5980\n"
-                                   "vn 0.4491 -0.7063 -0.5472\n"
-                                   "vn 0.5597 0.4708 -0.6820\n"
-                                   "vn 0.4030 -0.7723 -0.4911\n"
-                                   "vn 0.5862 0.3821 -0.7143\n"
-                                   "vn 0.3531 -0.8308 -0.4303\n"
-                                   "vn 0.6072 0.2899 -0.7398\n"
-                                   "vn 0.2998 -0.8813 -0.3653\n"
-                                   "vn 0.6222 0.1948 -0.7582\n"
-                                   "vn 0.0631 0.9950 -0.0769\n"
-                                   "vn 0.2436 -0.9233 -0.2968\n"
-                                   "vn 0.6313 0.0979 -0.7693\n"
-                                   "vn 0.1247 0.9805 -0.1519\n"
-                                   "vn 0.1850 -0.9565 -0.2255\n"
-                                   "vn 0.6344 -0.0000 -0.7730\n"
-                                   "vn 0.1850 0.9565 -0.2255\n"
-                                   "vn 0.1247 -0.9805 -0.1519\n"
-                                   "vn 0.6313 -0.0979 -0.7693\n"
-                                   "vn 0.2436 0.9233 -0.2968\n"
-                                   "vn 0.0631 -0.9950 -0.0769\n"
-                                   "vn 0.6222 -0.1948 -0.7582\n"
-                                   "vn 0.2998 0.8813 -0.3653\n"
-                                   "vn 0.6072 -0.2899 -0.7398\n"
-                                   "vn 0.3531 0.8308 -0.4303\n"
-                                   "vn 0.5862 -0.3821 -0.7143\n"
-                                   "vn 0.4030 0.7723 -0.4911\n"
-                                   "vn 0.5597 -0.4708 -0.6820\n"
-                                   "vn 0.4491 0.7063 -0.5472\n"
-                                   "vn 0.5278 -0.5549 -0.6431\n"
-                                   "vn 0.6239 0.4708 -0.6239\n"
-                                   "vn 0.6534 0.3821 -0.6534\n"
-                                   "vn 0.4492 -0.7723 -0.4492\n"
-                                   "vn 0.3936 -0.8308 -0.3936\n"
-                                   "vn 0.6768 0.2899 -0.6767\n"
-                                   "vn 0.3342 -0.8813 -0.3342\n"
-                                   "vn 0.6936 0.1948 -0.6936\n"
-                                   "vn 0.0704 0.9950 -0.0704\n"
-                                   "vn 0.2715 -0.9233 -0.2715\n"
-                                   "vn 0.7037 0.0979 -0.7037\n"
-                                   "vn 0.1390 0.9805 -0.1390\n"
-                                   "vn 0.2063 -0.9565 -0.2063\n"
-                                   "vn 0.7071 -0.0000 -0.7071\n"
-                                   "vn 0.2063 0.9565 -0.2063\n"
-                                   "vn 0.1390 -0.9805 -0.1390\n"
-                                   "vn 0.7037 -0.0979 -0.7037\n"
-                                   "vn 0.2715 0.9233 -0.2715\n"
-                                   "vn 0.0704 -0.9950 -0.0704\n"
-                                   "vn 0.6936 -0.1948 -0.6936\n"
-                                   "vn 0.3342 0.8813 -0.3342\n"
-                                   "vn 0.6768 -0.2899 -0.6767\n"
-                                   "vn 0.3936 0.8308 -0.3936\n"
-                                   "vn 0.6534 -0.3821 -0.6534\n"
-                                   "vn 0.4492 0.7723 -0.4492\n"
-                                   "vn 0.6239 -0.4708 -0.6239\n"
-                                   "vn 0.5005 0.7063 -0.5005\n"
-                                   "vn 0.5883 -0.5549 -0.5883\n"
-                                   "vn 0.5470 0.6336 -0.5470\n"
-                                   "vn 0.5470 -0.6336 -0.5470\n"
-                                   "vn 0.5883 0.5549 -0.5883\n"
-                                   "vn 0.5005 -0.7063 -0.5005\n"
-                                   "vn 0.7582 0.1948 -0.6222\n"
-                                   "vn 0.0769 0.9950 -0.0631\n"
-                                   "vn 0.3653 -0.8813 -0.2998\n"
-                                   "vn 0.2968 -0.9233 -0.2436\n"
-                                   "vn 0.7693 0.0979 -0.6313\n"
-                                   "vn 0.1519 0.9805 -0.1247\n"
-                                   "vn 0.2255 -0.9565 -0.1850\n"
-                                   "vn 0.7730 -0.0000 -0.6344\n"
-                                   "vn 0.2255 0.9565 -0.1850\n"
-                                   "vn 0.1519 -0.9805 -0.1247\n"
-                                   "vn 0.7693 -0.0979 -0.6313\n"
-                                   "vn 0.2968 0.9233 -0.2436\n"
-                                   "vn 0.0769 -0.9950 -0.0631\n"
-                                   "vn 0.7582 -0.1948 -0.6222\n"
-                                   "vn 0.3653 0.8813 -0.2998\n"
-                                   "vn 0.7398 -0.2899 -0.6072\n"
-                                   "vn 0.4303 0.8308 -0.3531\n"
-                                   "vn 0.7143 -0.3821 -0.5862\n"
-                                   "vn 0.4911 0.7723 -0.4030\n"
-                                   "vn 0.6820 -0.4708 -0.5597\n"
-                                   "vn 0.5472 0.7063 -0.4491\n"
-                                   "vn 0.6431 -0.5549 -0.5278\n"
-                                   "vn 0.5980 0.6336 -0.4908\n"
-                                   "vn 0.5980 -0.6336 -0.4908\n"
-                                   "vn 0.6431 0.5549 -0.5278\n"
-                                   "vn 0.5472 -0.7063 -0.4491\n"
-                                   "vn 0.6820 0.4708 -0.5597\n"
-                                   "vn 0.4911 -0.7723 -0.4030\n"
-                                   "vn 0.7143 0.3821 -0.5862\n"
-                                   "vn 0.4303 -0.8308 -0.3531\n"
-                                   "vn 0.7398 0.2899 -0.6072\n"
-                                   "vn 0.8275 0.0979 -0.5529\n"
-                                   "vn 0.8315 -0.0000 -0.5556\n"
-                                   "vn 0.1634 0.9805 -0.1092\n"
-                                   "vn 0.2425 0.9565 -0.1621\n"
-                                   "vn 0.1634 -0.9805 -0.1092\n"
-                                   "vn 0.8275 -0.0979 -0.5529\n"
-                                   "vn 0.3193 0.9233 -0.2133\n"
-                                   "vn 0.0828 -0.9950 -0.0553\n"
-                                   "vn 0.8155 -0.1948 -0.5449\n"
-                                   "vn 0.3929 0.8813 -0.2626\n"
-                                   "vn 0.7958 -0.2899 -0.5317\n"
-                                   "vn 0.4628 0.8308 -0.3092\n"
-                                   "vn 0.7684 -0.3821 -0.5134\n"
-                                   "vn 0.5282 0.7723 -0.3530\n"
-                                   "vn 0.7336 -0.4708 -0.4902\n"
-                                   "vn 0.5886 0.7063 -0.3933\n"
-                                   "vn 0.6917 -0.5549 -0.4622\n"
-                                   "vn 0.6432 0.6336 -0.4298\n"
-                                   "vn 0.6432 -0.6336 -0.4298\n"
-                                   "vn 0.6917 0.5549 -0.4622\n"
-                                   "vn 0.5886 -0.7063 -0.3933\n"
-                                   "vn 0.7336 0.4708 -0.4902\n"
-                                   "vn 0.5282 -0.7723 -0.3530\n"
-                                   "vn 0.7684 0.3821 -0.5134\n"
-                                   "vn 0.4628 -0.8308 -0.3092\n"
-                                   "vn 0.7958 0.2899 -0.5317\n"
-                                   "vn 0.3929 -0.8813 -0.2626\n"
-                                   "vn 0.8155 0.1948 -0.5449\n"
-                                   "vn 0.0828 0.9950 -0.0553\n"
-                                   "vn 0.3193 -0.9233 -0.2133\n"
-                                   "vn 0.2425 -0.9565 -0.1621\n"
-                                   "vn 0.8650 -0.1948 -0.4624\n"
-                                   "vn 0.3386 0.9233 -0.1810\n"
-                                   "vn 0.4168 0.8813 -0.2228\n"
-                                   "vn 0.0878 -0.9950 -0.0469\n"
-                                   "vn 0.8441 -0.2899 -0.4512\n"
-                                   "vn 0.4909 0.8308 -0.2624\n"
-                                   "vn 0.8150 -0.3821 -0.4356\n"
-                                   "vn 0.5603 0.7723 -0.2995\n"
-                                   "vn 0.7781 -0.4708 -0.4159\n"
-                                   "vn 0.6243 0.7063 -0.3337\n"
-                                   "vn 0.7337 -0.5549 -0.3922\n"
-                                   "vn 0.6823 0.6336 -0.3647\n"
-                                   "vn 0.6823 -0.6336 -0.3647\n"
-                                   "vn 0.7337 0.5549 -0.3922\n"
-                                   "vn 0.6243 -0.7063 -0.3337\n"
-                                   "vn 0.7781 0.4708 -0.4159\n"
-                                   "vn 0.5603 -0.7723 -0.2995\n"
-                                   "vn 0.8150 0.3821 -0.4356\n"
-                                   "vn 0.4909 -0.8308 -0.2624\n"
-                                   "vn 0.8441 0.2899 -0.4512\n"
-                                   "vn 0.4168 -0.8813 -0.2228\n"
-                                   "vn 0.8650 0.1948 -0.4624\n"
-                                   "vn 0.0878 0.9950 -0.0469\n"
-                                   "vn 0.3386 -0.9233 -0.1810\n"
-                                   "vn 0.8777 0.0979 -0.4691\n"
-                                   "vn 0.1734 0.9805 -0.0927\n"
-                                   "vn 0.2572 -0.9565 -0.1375\n"
-                                   "vn 0.8819 -0.0000 -0.4714\n"
-                                   "vn 0.2572 0.9565 -0.1375\n"
-                                   "vn 0.1734 -0.9805 -0.0927\n"
-                                   "vn 0.8777 -0.0979 -0.4691\n"
-                                   "vn 0.8842 -0.2899 -0.3663\n"
-                                   "vn 0.8538 -0.3821 -0.3536\n"
-                                   "vn 0.5143 0.8308 -0.2130\n"
-                                   "vn 0.5869 0.7723 -0.2431\n"
-                                   "vn 0.8151 -0.4708 -0.3376\n"
-                                   "vn 0.6540 0.7063 -0.2709\n"
-                                   "vn 0.7686 -0.5549 -0.3184\n"
-                                   "vn 0.7147 0.6336 -0.2961\n"
-                                   "vn 0.7147 -0.6336 -0.2961\n"
-                                   "vn 0.7686 0.5549 -0.3184\n"
-                                   "vn 0.6540 -0.7063 -0.2709\n"
-                                   "vn 0.8151 0.4708 -0.3376\n"
-                                   "vn 0.5869 -0.7723 -0.2431\n"
-                                   "vn 0.8538 0.3821 -0.3536\n"
-                                   "vn 0.5143 -0.8308 -0.2130\n"
-                                   "vn 0.8842 0.2899 -0.3663\n"
-                                   "vn 0.4366 -0.8813 -0.1809\n"
-                                   "vn 0.9062 0.1948 -0.3754\n"
-                                   "vn 0.0920 0.9950 -0.0381\n"
-                                   "vn 0.3548 -0.9233 -0.1469\n"
-                                   "vn 0.9194 0.0979 -0.3808\n"
-                                   "vn 0.1816 0.9805 -0.0752\n"
-                                   "vn 0.2695 -0.9565 -0.1116\n"
-                                   "vn 0.9239 -0.0000 -0.3827\n"
-                                   "vn 0.2695 0.9565 -0.1116\n"
-                                   "vn 0.1816 -0.9805 -0.0752\n"
-                                   "vn 0.9194 -0.0979 -0.3808\n"
-                                   "vn 0.3548 0.9233 -0.1469\n"
-                                   "vn 0.0920 -0.9950 -0.0381\n"
-                                   "vn 0.9062 -0.1948 -0.3754\n"
-                                   "vn 0.4366 0.8813 -0.1809\n"
-                                   "vn 0.7961 -0.5549 -0.2415\n"
-                                   "vn 0.7403 0.6336 -0.2246\n"
-                                   "vn 0.7403 -0.6336 -0.2246\n"
-                                   "vn 0.7961 0.5549 -0.2415\n"
-                                   "vn 0.6774 -0.7063 -0.2055\n"
-                                   "vn 0.8443 0.4708 -0.2561\n"
-                                   "vn 0.6080 -0.7723 -0.1844\n"
-                                   "vn 0.8843 0.3821 -0.2683\n"
-                                   "vn 0.5327 -0.8308 -0.1616\n"
-                                   "vn 0.9159 0.2899 -0.2778\n"
-                                   "vn 0.4522 -0.8813 -0.1372\n"
-                                   "vn 0.9386 0.1948 -0.2847\n"
-                                   "vn 0.0952 0.9950 -0.0289\n"
-                                   "vn 0.3675 -0.9233 -0.1115\n"
-                                   "vn 0.9523 0.0979 -0.2889\n"
-                                   "vn 0.1881 0.9805 -0.0571\n"
-                                   "vn 0.2791 -0.9565 -0.0847\n"
-                                   "vn 0.9569 -0.0000 -0.2903\n"
-                                   "vn 0.2791 0.9565 -0.0847\n"
-                                   "vn 0.1881 -0.9805 -0.0571\n"
-                                   "vn 0.9523 -0.0979 -0.2889\n"
-                                   "vn 0.3675 0.9233 -0.1115\n"
-                                   "vn 0.0952 -0.9950 -0.0289\n"
-                                   "vn 0.9386 -0.1948 -0.2847\n"
-                                   "vn 0.4522 0.8813 -0.1372\n"
-                                   "vn 0.9159 -0.2899 -0.2778\n"
-                                   "vn 0.5327 0.8308 -0.1616\n"
-                                   "vn 0.8843 -0.3821 -0.2683\n"
-                                   "vn 0.6080 0.7723 -0.1844\n"
-                                   "vn 0.8443 -0.4708 -0.2561\n"
-                                   "vn 0.6774 0.7063 -0.2055\n"
-                                   "vn 0.7588 -0.6336 -0.1509\n"
-                                   "vn 0.6943 -0.7063 -0.1381\n"
-                                   "vn 0.8653 0.4708 -0.1721\n"
-                                   "vn 0.6231 -0.7723 -0.1239\n"
-                                   "vn 0.9063 0.3821 -0.1803\n"
-                                   "vn 0.5459 -0.8308 -0.1086\n"
-                                   "vn 0.9387 0.2899 -0.1867\n"
-                                   "vn 0.4635 -0.8813 -0.0922\n"
-                                   "vn 0.9620 0.1948 -0.1914\n"
-                                   "vn 0.0976 0.9950 -0.0194\n"
-                                   "vn 0.3766 -0.9233 -0.0749\n"
-                                   "vn 0.9761 0.0979 -0.1942\n"
-                                   "vn 0.1928 0.9805 -0.0383\n"
-                                   "vn 0.2861 -0.9565 -0.0569\n"
-                                   "vn 0.9808 -0.0000 -0.1951\n"
-                                   "vn 0.2861 0.9565 -0.0569\n"
-                                   "vn 0.1928 -0.9805 -0.0383\n"
-                                   "vn 0.9761 -0.0979 -0.1942\n"
-                                   "vn 0.3766 0.9233 -0.0749\n"
-                                   "vn 0.0976 -0.9950 -0.0194\n"
-                                   "vn 0.9620 -0.1948 -0.1914\n"
-                                   "vn 0.4635 0.8813 -0.0922\n"
-                                   "vn 0.9387 -0.2899 -0.1867\n"
-                                   "vn 0.5459 0.8308 -0.1086\n"
-                                   "vn 0.9063 -0.3821 -0.1803\n"
-                                   "vn 0.6231 0.7723 -0.1239\n"
-                                   "vn 0.8653 -0.4708 -0.1721\n"
-                                   "vn 0.6943 0.7063 -0.1381\n"
-                                   "vn 0.8160 -0.5549 -0.1623\n"
-                                   "vn 0.7588 0.6336 -0.1509\n"
-                                   "vn 0.8160 0.5549 -0.1623\n"
-                                   "vn 0.5539 -0.8308 -0.0546\n"
-                                   "vn 0.9525 0.2899 -0.0938\n"
-                                   "vn 0.4703 -0.8813 -0.0463\n"
-                                   "vn 0.9761 0.1948 -0.0961\n"
-                                   "vn 0.0991 0.9950 -0.0098\n"
-                                   "vn 0.3821 -0.9233 -0.0376\n"
-                                   "vn 0.9904 0.0979 -0.0975\n"
-                                   "vn 0.1956 0.9805 -0.0193\n"
-                                   "vn 0.2903 -0.9565 -0.0286\n"
-                                   "vn 0.9952 -0.0000 -0.0980\n"
-                                   "vn 0.2903 0.9565 -0.0286\n"
-                                   "vn 0.1956 -0.9805 -0.0193\n"
-                                   "vn 0.9904 -0.0979 -0.0975\n"
-                                   "vn 0.3821 0.9233 -0.0376\n"
-                                   "vn 0.0991 -0.9950 -0.0098\n"
-                                   "vn 0.9761 -0.1948 -0.0961\n"
-                                   "vn 0.4703 0.8813 -0.0463\n"
-                                   "vn 0.9525 -0.2899 -0.0938\n"
-                                   "vn 0.5539 0.8308 -0.0546\n"
-                                   "vn 0.9197 -0.3821 -0.0906\n"
-                                   "vn 0.6322 0.7723 -0.0623\n"
-                                   "vn 0.8780 -0.4708 -0.0865\n"
-                                   "vn 0.7045 0.7063 -0.0694\n"
-                                   "vn 0.8279 -0.5549 -0.0815\n"
-                                   "vn 0.7699 0.6336 -0.0758\n"
-                                   "vn 0.7699 -0.6336 -0.0758\n"
-                                   "vn 0.8279 0.5549 -0.0815\n"
-                                   "vn 0.7045 -0.7063 -0.0694\n"
-                                   "vn 0.8780 0.4708 -0.0865\n"
-                                   "vn 0.6322 -0.7723 -0.0623\n"
-                                   "vn 0.9197 0.3821 -0.0906\n"
-                                   "vn 0.4726 -0.8813 0.0000\n"
-                                   "vn 0.3840 -0.9233 -0.0000\n"
-                                   "vn 0.9808 0.1948 0.0000\n"
-                                   "vn 0.9952 0.0979 0.0000\n"
-                                   "vn 0.0995 0.9950 -0.0000\n"
-                                   "vn 0.1966 0.9805 0.0000\n"
-                                   "vn 0.2917 -0.9565 -0.0000\n"
-                                   "vn 1.0000 -0.0000 0.0000\n"
-                                   "vn 0.2917 0.9565 -0.0000\n"
-                                   "vn 0.1966 -0.9805 -0.0000\n"
-                                   "vn 0.9952 -0.0979 0.0000\n"
-                                   "vn 0.3840 0.9233 -0.0000\n"
-                                   "vn 0.0995 -0.9950 -0.0000\n"
-                                   "vn 0.9808 -0.1948 0.0000\n"
-                                   "vn 0.4726 0.8813 0.0000\n"
-                                   "vn 0.9571 -0.2899 -0.0000\n"
-                                   "vn 0.5566 0.8308 0.0000\n"
-                                   "vn 0.9241 -0.3821 0.0000\n"
-                                   "vn 0.6353 0.7723 0.0000\n"
-                                   "vn 0.8823 -0.4708 0.0000\n"
-                                   "vn 0.7079 0.7063 -0.0000\n"
-                                   "vn 0.8319 -0.5549 0.0000\n"
-                                   "vn 0.7736 0.6336 -0.0000\n"
-                                   "vn 0.7736 -0.6336 0.0000\n"
-                                   "vn 0.8319 0.5549 0.0000\n"
-                                   "vn 0.7079 -0.7063 -0.0000\n"
-                                   "vn 0.8823 0.4708 0.0000\n"
-                                   "vn 0.6353 -0.7723 0.0000\n"
-                                   "vn 0.9241 0.3821 0.0000\n"
-                                   "vn 0.5566 -0.8308 0.0000\n"
-                                   "vn 0.9571 0.2899 -0.0000\n"
-                                   "vn 0.1956 -0.9805 0.0193\n"
-                                   "vn 0.9952 -0.0000 0.0980\n"
-                                   "vn 0.9904 -0.0979 0.0975\n"
-                                   "vn 0.3821 0.9233 0.0376\n"
-                                   "vn 0.0991 -0.9950 0.0098\n"
-                                   "vn 0.9761 -0.1948 0.0961\n"
-                                   "vn 0.4703 0.8813 0.0463\n"
-                                   "vn 0.9525 -0.2899 0.0938\n"
-                                   "vn 0.5539 0.8308 0.0546\n"
-                                   "vn 0.9197 -0.3821 0.0906\n"
-                                   "vn 0.6322 0.7723 0.0623\n"
-                                   "vn 0.8780 -0.4708 0.0865\n"
-                                   "vn 0.7045 0.7063 0.0694\n"
-                                   "vn 0.8279 -0.5549 0.0815\n"
-                                   "vn 0.7699 0.6336 0.0758\n"
-                                   "vn 0.7699 -0.6336 0.0758\n"
-                                   "vn 0.8279 0.5549 0.0815\n"
-                                   "vn 0.7045 -0.7063 0.0694\n"
-                                   "vn 0.8780 0.4708 0.0865\n"
-                                   "vn 0.6322 -0.7723 0.0623\n"
-                                   "vn 0.9197 0.3821 0.0906\n"
-                                   "vn 0.5539 -0.8308 0.0546\n"
-                                   "vn 0.9525 0.2899 0.0938\n"
-                                   "vn 0.4703 -0.8813 0.0463\n"
-                                   "vn 0.9761 0.1948 0.0961\n"
-                                   "vn 0.0991 0.9950 0.0098\n"
-                                   "vn 0.3821 -0.9233 0.0376\n"
-                                   "vn 0.9904 0.0979 0.0975\n"
-                                   "vn 0.1956 0.9805 0.0193\n"
-                                   "vn 0.2903 -0.9565 0.0286\n"
-                                   "vn 0.2903 0.9565 0.0286\n"
-                                   "vn 0.0976 -0.9950 0.0194\n"
-                                   "vn 0.9387 -0.2899 0.1867\n"
-                                   "vn 0.5459 0.8308 0.1086\n"
-                                   "vn 0.9063 -0.3821 0.1803\n"
-                                   "vn 0.6231 0.7723 0.1239\n"
-                                   "vn 0.8653 -0.4708 0.1721\n"
-                                   "vn 0.6943 0.7063 0.1381\n"
-                                   "vn 0.8160 -0.5549 0.1623\n"
-                                   "vn 0.7588 0.6336 0.1509\n"
-                                   "vn 0.7588 -0.6336 0.1509\n"
-                                   "vn 0.8160 0.5549 0.1623\n"
-                                   "vn 0.6943 -0.7063 0.1381\n"
-                                   "vn 0.8653 0.4708 0.1721\n"
-                                   "vn 0.6231 -0.7723 0.1239\n"
-                                   "vn 0.9063 0.3821 0.1803\n"
-                                   "vn 0.5459 -0.8308 0.1086\n"
-                                   "vn 0.9387 0.2899 0.1867\n"
-                                   "vn 0.4635 -0.8813 0.0922\n"
-                                   "vn 0.9620 0.1948 0.1914\n"
-                                   "vn 0.0976 0.9950 0.0194\n"
-                                   "vn 0.3766 -0.9233 0.0749\n"
-                                   "vn 0.9761 0.0979 0.1942\n"
-                                   "vn 0.1928 0.9805 0.0383\n"
-                                   "vn 0.2861 -0.9565 0.0569\n"
-                                   "vn 0.9808 -0.0000 0.1951\n"
-                                   "vn 0.2861 0.9565 0.0569\n"
-                                   "vn 0.1928 -0.9805 0.0383\n"
-                                   "vn 0.9761 -0.0979 0.1942\n"
-                                   "vn 0.3766 0.9233 0.0749\n"
-                                   "vn 0.9620 -0.1948 0.1914\n"
-                                   "vn 0.4635 0.8813 0.0922\n"
-                                   "vn 0.8843 -0.3821 0.2683\n"
-                                   "vn 0.8443 -0.4708 0.2561\n"
-                                   "vn 0.6080 0.7723 0.1844\n"
-                                   "vn 0.6774 0.7063 0.2055\n"
-                                   "vn 0.7961 -0.5549 0.2415\n"
-                                   "vn 0.7403 0.6336 0.2246\n"
-                                   "vn 0.7403 -0.6336 0.2246\n"
-                                   "vn 0.7961 0.5549 0.2415\n"
-                                   "vn 0.6774 -0.7063 0.2055\n"
-                                   "vn 0.8443 0.4708 0.2561\n"
-                                   "vn 0.6080 -0.7723 0.1844\n"
-                                   "vn 0.8843 0.3821 0.2683\n"
-                                   "vn 0.5327 -0.8308 0.1616\n"
-                                   "vn 0.9159 0.2899 0.2778\n"
-                                   "vn 0.4522 -0.8813 0.1372\n"
-                                   "vn 0.9386 0.1948 0.2847\n"
-                                   "vn 0.0952 0.9950 0.0289\n"
-                                   "vn 0.3675 -0.9233 0.1115\n"
-                                   "vn 0.9523 0.0979 0.2889\n"
-                                   "vn 0.1881 0.9805 0.0571\n"
-                                   "vn 0.2791 -0.9565 0.0847\n"
-                                   "vn 0.9569 -0.0000 0.2903\n"
-                                   "vn 0.2791 0.9565 0.0847\n"
-                                   "vn 0.1881 -0.9805 0.0571\n"
-                                   "vn 0.9523 -0.0979 0.2889\n"
-                                   "vn 0.3675 0.9233 0.1115\n"
-                                   "vn 0.0952 -0.9950 0.0289\n"
-                                   "vn 0.9386 -0.1948 0.2847\n"
-                                   "vn 0.4522 0.8813 0.1372\n"
-                                   "vn 0.9159 -0.2899 0.2778\n"
-                                   "vn 0.5327 0.8308 0.1616\n"
-                                   "vn 0.7147 -0.6336 0.2961\n"
-                                   "vn 0.7686 0.5549 0.3184\n"
-                                   "vn 0.6540 -0.7063 0.2709\n"
-                                   "vn 0.8151 0.4708 0.3376\n"
-                                   "vn 0.5869 -0.7723 0.2431\n"
-                                   "vn 0.8538 0.3821 0.3536\n"
-                                   "vn 0.5143 -0.8308 0.2130\n"
-                                   "vn 0.8842 0.2899 0.3663\n"
-                                   "vn 0.4366 -0.8813 0.1809\n"
-                                   "vn 0.9062 0.1948 0.3754\n"
-                                   "vn 0.0920 0.9950 0.0381\n"
-                                   "vn 0.3548 -0.9233 0.1469\n"
-                                   "vn 0.9194 0.0979 0.3808\n"
-                                   "vn 0.1816 0.9805 0.0752\n"
-                                   "vn 0.2695 -0.9565 0.1116\n"
-                                   "vn 0.9239 -0.0000 0.3827\n"
-                                   "vn 0.2695 0.9565 0.1116\n"
-                                   "vn 0.1816 -0.9805 0.0752\n"
-                                   "vn 0.9194 -0.0979 0.3808\n"
-                                   "vn 0.3548 0.9233 0.1469\n"
-                                   "vn 0.0920 -0.9950 0.0381\n"
-                                   "vn 0.9062 -0.1948 0.3754\n"
-                                   "vn 0.4366 0.8813 0.1809\n"
-                                   "vn 0.8842 -0.2899 0.3663\n"
-                                   "vn 0.5143 0.8308 0.2130\n"
-                                   "vn 0.8538 -0.3821 0.3536\n"
-                                   "vn 0.5869 0.7723 0.2431\n"
-                                   "vn 0.8151 -0.4708 0.3376\n"
-                                   "vn 0.6540 0.7063 0.2709\n"
-                                   "vn 0.7686 -0.5549 0.3184\n"
-                                   "vn 0.7147 0.6336 0.2961\n"
-                                   "vn 0.5603 -0.7723 0.2995\n"
-                                   "vn 0.7781 0.4708 0.4159\n"
-                                   "vn 0.8150 0.3821 0.4356\n"
-                                   "vn 0.4909 -0.8308 0.2624\n"
-                                   "vn 0.8441 0.2899 0.4512\n"
-                                   "vn 0.4168 -0.8813 0.2228\n"
-                                   "vn 0.8650 0.1948 0.4624\n"
-                                   "vn 0.0878 0.9950 0.0469\n"
-                                   "vn 0.3386 -0.9233 0.1810\n"
-                                   "vn 0.8777 0.0979 0.4691\n"
-                                   "vn 0.1734 0.9805 0.0927\n"
-                                   "vn 0.2572 -0.9565 0.1375\n"
-                                   "vn 0.8819 -0.0000 0.4714\n"
-                                   "vn 0.2572 0.9565 0.1375\n"
-                                   "vn 0.1734 -0.9805 0.0927\n"
-                                   "vn 0.8777 -0.0979 0.4691\n"
-                                   "vn 0.3386 0.9233 0.1810\n"
-                                   "vn 0.0878 -0.9950 0.0469\n"
-                                   "vn 0.8650 -0.1948 0.4624\n"
-                                   "vn 0.4168 0.8813 0.2228\n"
-                                   "vn 0.8441 -0.2899 0.4512\n"
-                                   "vn 0.4909 0.8308 0.2624\n"
-                                   "vn 0.8150 -0.3821 0.4356\n"
-                                   "vn 0.5603 0.7723 0.2995\n"
-                                   "vn 0.7781 -0.4708 0.4159\n"
-                                   "vn 0.6243 0.7063 0.3337\n"
-                                   "vn 0.7337 -0.5549 0.3922\n"
-                                   "vn 0.6823 0.6336 0.3647\n"
-                                   "vn 0.6823 -0.6336 0.3647\n"
-                                   "vn 0.7337 0.5549 0.3922\n"
-                                   "vn 0.6243 -0.7063 0.3337\n"
-                                   "vn 0.4628 -0.8308 0.3092\n"
-                                   "vn 0.3929 -0.8813 0.2626\n"
-                                   "vn 0.8155 0.1948 0.5449\n"
-                                   "vn 0.0828 0.9950 0.0553\n"
-                                   "vn 0.3193 -0.9233 0.2133\n"
-                                   "vn 0.8275 0.0979 0.5529\n"
-                                   "vn 0.1634 0.9805 0.1092\n"
-                                   "vn 0.2425 -0.9565 0.1621\n"
-                                   "vn 0.8315 -0.0000 0.5556\n"
-                                   "vn 0.2425 0.9565 0.1621\n"
-                                   "vn 0.1634 -0.9805 0.1092\n"
-                                   "vn 0.8275 -0.0979 0.5529\n"
-                                   "vn 0.3193 0.9233 0.2133\n"
-                                   "vn 0.0828 -0.9950 0.0553\n"
-                                   "vn 0.8155 -0.1948 0.5449\n"
-                                   "vn 0.3929 0.8813 0.2626\n"
-                                   "vn 0.7958 -0.2899 0.5317\n"
-                                   "vn 0.4628 0.8308 0.3092\n"
-                                   "vn 0.7684 -0.3821 0.5134\n"
-                                   "vn 0.5282 0.7723 0.3530\n"
-                                   "vn 0.7336 -0.4708 0.4902\n"
-                                   "vn 0.5886 0.7063 0.3933\n"
-                                   "vn 0.6917 -0.5549 0.4622\n"
-                                   "vn 0.6432 0.6336 0.4298\n"
-                                   "vn 0.6432 -0.6336 0.4298\n"
-                                   "vn 0.6917 0.5549 0.4622\n"
-                                   "vn 0.5886 -0.7063 0.3933\n"
-                                   "vn 0.7336 0.4708 0.4902\n"
-                                   "vn 0.5282 -0.7723 0.3530\n"
-                                   "vn 0.7684 0.3821 0.5134\n"
-                                   "vn 0.7958 0.2899 0.5317\n"
-                                   "vn 0.1519 0.9805 0.1247\n"
-                                   "vn 0.2968 -0.9233 0.2436\n"
-                                   "vn 0.2255 -0.9565 0.1850\n"
-                                   "vn 0.7693 0.0979 0.6313\n"
-                                   "vn 0.7730 -0.0000 0.6344\n"
-                                   "vn 0.2255 0.9565 0.1850\n"
-                                   "vn 0.1519 -0.9805 0.1247\n"
-                                   "vn 0.7693 -0.0979 0.6313\n"
-                                   "vn 0.2968 0.9233 0.2436\n"
-                                   "vn 0.0769 -0.9950 0.0631\n"
-                                   "vn 0.7582 -0.1948 0.6222\n"
-                                   "vn 0.3653 0.8813 0.2998\n"
-                                   "vn 0.7398 -0.2899 0.6072\n"
-                                   "vn 0.4303 0.8308 0.3531\n"
-                                   "vn 0.7143 -0.3821 0.5862\n"
-                                   "vn 0.4911 0.7723 0.4030\n"
-                                   "vn 0.6820 -0.4708 0.5597\n"
-                                   "vn 0.5472 0.7063 0.4491\n"
-                                   "vn 0.6431 -0.5549 0.5278\n"
-                                   "vn 0.5980 0.6336 0.4908\n"
-                                   "vn 0.5980 -0.6336 0.4908\n"
-                                   "vn 0.6431 0.5549 0.5278\n"
-                                   "vn 0.5472 -0.7063 0.4491\n"
-                                   "vn 0.6820 0.4708 0.5597\n"
-                                   "vn 0.4911 -0.7723 0.4030\n"
-                                   "vn 0.7143 0.3821 0.5862\n"
-                                   "vn 0.4303 -0.8308 0.3531\n"
-                                   "vn 0.7398 0.2899 0.6072\n"
-                                   "vn 0.3653 -0.8813 0.2998\n"
-                                   "vn 0.7582 0.1948 0.6222\n"
-                                   "vn 0.0769 0.9950 0.0631\n"
-                                   "vn 0.2715 0.9233 0.2715\n"
-                                   "vn 0.0704 -0.9950 0.0704\n"
-                                   "vn 0.6936 -0.1948 0.6936\n"
-                                   "vn 0.3342 0.8813 0.3342\n"
-                                   "vn 0.6768 -0.2899 0.6768\n"
-                                   "vn 0.3936 0.8308 0.3936\n"
-                                   "vn 0.6534 -0.3821 0.6534\n"
-                                   "vn 0.4492 0.7723 0.4492\n"
-                                   "vn 0.6239 -0.4708 0.6239\n"
-                                   "vn 0.5005 0.7063 0.5005\n"
-                                   "vn 0.5883 -0.5549 0.5883\n"
-                                   "vn 0.5470 0.6336 0.5470\n"
-                                   "vn 0.5470 -0.6336 0.5470\n"
-                                   "vn 0.5883 0.5549 0.5883\n"
-                                   "vn 0.5005 -0.7063 0.5005\n"
-                                   "vn 0.6239 0.4708 0.6239\n"
-                                   "vn 0.4492 -0.7723 0.4492\n"
-                                   "vn 0.6534 0.3821 0.6534\n"
-                                   "vn 0.3936 -0.8308 0.3936\n"
-                                   "vn 0.6768 0.2899 0.6767\n"
-                                   "vn 0.3342 -0.8813 0.3342\n"
-                                   "vn 0.6936 0.1948 0.6936\n"
-                                   "vn 0.0704 0.9950 0.0704\n"
-                                   "vn 0.2715 -0.9233 0.2715\n"
-                                   "vn 0.7037 0.0979 0.7037\n"
-                                   "vn 0.1390 0.9805 0.1390\n"
-                                   "vn 0.2063 -0.9565 0.2063\n"
-                                   "vn 0.7071 -0.0000 0.7071\n"
-                                   "vn 0.2063 0.9565 0.2063\n"
-                                   "vn 0.1390 -0.9805 0.1390\n"
-                                   "vn 0.7037 -0.0979 0.7037\n"
-                                   "vn 0.3531 0.8308 0.4303\n"
-                                   "vn 0.6072 -0.2899 0.7398\n"
-                                   "vn 0.5862 -0.3821 0.7143\n"
-                                   "vn 0.4030 0.7723 0.4911\n"
-                                   "vn 0.5597 -0.4708 0.6820\n"
-                                   "vn 0.4491 0.7063 0.5472\n"
-                                   "vn 0.5278 -0.5549 0.6431\n"
-                                   "vn 0.4908 0.6336 0.5980\n"
-                                   "vn 0.4908 -0.6336 0.5980\n"
-                                   "vn 0.5278 0.5549 0.6431\n"
-                                   "vn 0.4491 -0.7063 0.5472\n"
-                                   "vn 0.5597 0.4708 0.6820\n"
-                                   "vn 0.4030 -0.7723 0.4911\n"
-                                   "vn 0.5862 0.3821 0.7143\n"
-                                   "vn 0.3531 -0.8308 0.4303\n"
-                                   "vn 0.6072 0.2899 0.7398\n"
-                                   "vn 0.2998 -0.8813 0.3653\n"
-                                   "vn 0.6222 0.1948 0.7582\n"
-                                   "vn 0.0631 0.9950 0.0769\n"
-                                   "vn 0.2436 -0.9233 0.2968\n"
-                                   "vn 0.6313 0.0979 0.7693\n"
-                                   "vn 0.1247 0.9805 0.1519\n"
-                                   "vn 0.1850 -0.9565 0.2255\n"
-                                   "vn 0.6344 -0.0000 0.7730\n"
-                                   "vn 0.1850 0.9565 0.2255\n"
-                                   "vn 0.1247 -0.9805 0.1519\n"
-                                   "vn 0.6313 -0.0979 0.7693\n"
-                                   "vn 0.2436 0.9233 0.2968\n"
-                                   "vn 0.0631 -0.9950 0.0769\n"
-                                   "vn 0.6222 -0.1948 0.7582\n"
-                                   "vn 0.2998 0.8813 0.3653\n"
-                                   "vn 0.3530 0.7723 0.5282\n"
-                                   "vn 0.3933 0.7063 0.5886\n"
-                                   "vn 0.4622 -0.5549 0.6917\n"
-                                   "vn 0.4298 0.6336 0.6432\n"
-                                   "vn 0.4298 -0.6336 0.6432\n"
-                                   "vn 0.4622 0.5549 0.6917\n"
-                                   "vn 0.3933 -0.7063 0.5886\n"
-                                   "vn 0.4902 0.4708 0.7336\n"
-                                   "vn 0.3530 -0.7723 0.5282\n"
-                                   "vn 0.5134 0.3821 0.7684\n"
-                                   "vn 0.3092 -0.8308 0.4628\n"
-                                   "vn 0.5317 0.2899 0.7958\n"
-                                   "vn 0.2626 -0.8813 0.3929\n"
-                                   "vn 0.5449 0.1948 0.8155\n"
-                                   "vn 0.0553 0.9950 0.0828\n"
-                                   "vn 0.2133 -0.9233 0.3193\n"
-                                   "vn 0.5529 0.0979 0.8275\n"
-                                   "vn 0.1092 0.9805 0.1634\n"
-                                   "vn 0.1621 -0.9565 0.2425\n"
-                                   "vn 0.5556 -0.0000 0.8315\n"
-                                   "vn 0.1621 0.9565 0.2425\n"
-                                   "vn 0.1092 -0.9805 0.1634\n"
-                                   "vn 0.5529 -0.0979 0.8275\n"
-                                   "vn 0.2133 0.9233 0.3193\n"
-                                   "vn 0.0553 -0.9950 0.0828\n"
-                                   "vn 0.5449 -0.1948 0.8155\n"
-                                   "vn 0.2626 0.8813 0.3929\n"
-                                   "vn 0.5317 -0.2899 0.7958\n"
-                                   "vn 0.3092 0.8308 0.4628\n"
-                                   "vn 0.5134 -0.3821 0.7684\n"
-                                   "vn 0.4902 -0.4708 0.7336\n"
-                                   "vn 0.4691 0.0979 0.8777\n"
-                                   "vn 0.4714 -0.0000 0.8819\n"
-                                   "vn 0.0927 0.9805 0.1734\n"
-                                   "vn 0.1375 0.9565 0.2572\n"
-                                   "vn 0.0927 -0.9805 0.1734\n"
-                                   "vn 0.4691 -0.0979 0.8777\n"
-                                   "vn 0.1810 0.9233 0.3386\n"
-                                   "vn 0.0469 -0.9950 0.0878\n"
-                                   "vn 0.4624 -0.1948 0.8650\n"
-                                   "vn 0.2228 0.8813 0.4168\n"
-                                   "vn 0.4512 -0.2899 0.8441\n"
-                                   "vn 0.2624 0.8308 0.4909\n"
-                                   "vn 0.4356 -0.3821 0.8150\n"
-                                   "vn 0.2995 0.7723 0.5603\n"
-                                   "vn 0.4159 -0.4708 0.7781\n"
-                                   "vn 0.3337 0.7063 0.6243\n"
-                                   "vn 0.3922 -0.5549 0.7337\n"
-                                   "vn 0.3647 0.6336 0.6823\n"
-                                   "vn 0.3647 -0.6336 0.6823\n"
-                                   "vn 0.3922 0.5549 0.7337\n"
-                                   "vn 0.3337 -0.7063 0.6243\n"
-                                   "vn 0.4159 0.4708 0.7781\n"
-                                   "vn 0.2995 -0.7723 0.5603\n"
-                                   "vn 0.4356 0.3821 0.8150\n"
-                                   "vn 0.2624 -0.8308 0.4909\n"
-                                   "vn 0.4512 0.2899 0.8441\n"
-                                   "vn 0.2228 -0.8813 0.4168\n"
-                                   "vn 0.4624 0.1948 0.8650\n"
-                                   "vn 0.0469 0.9950 0.0878\n"
-                                   "vn 0.1810 -0.9233 0.3386\n"
-                                   "vn 0.1375 -0.9565 0.2572\n"
-                                   "vn 0.3754 -0.1948 0.9062\n"
-                                   "vn 0.1469 0.9233 0.3548\n"
-                                   "vn 0.1809 0.8813 0.4366\n"
-                                   "vn 0.0381 -0.9950 0.0920\n"
-                                   "vn 0.3663 -0.2899 0.8842\n"
-                                   "vn 0.2130 0.8308 0.5143\n"
-                                   "vn 0.3536 -0.3821 0.8538\n"
-                                   "vn 0.2431 0.7723 0.5869\n"
-                                   "vn 0.3376 -0.4708 0.8151\n"
-                                   "vn 0.2709 0.7063 0.6540\n"
-                                   "vn 0.3184 -0.5549 0.7686\n"
-                                   "vn 0.2961 0.6336 0.7147\n"
-                                   "vn 0.2961 -0.6336 0.7147\n"
-                                   "vn 0.3184 0.5549 0.7686\n"
-                                   "vn 0.2709 -0.7063 0.6540\n"
-                                   "vn 0.3376 0.4708 0.8151\n"
-                                   "vn 0.2431 -0.7723 0.5869\n"
-                                   "vn 0.3536 0.3821 0.8538\n"
-                                   "vn 0.2130 -0.8308 0.5143\n"
-                                   "vn 0.3663 0.2899 0.8842\n"
-                                   "vn 0.1809 -0.8813 0.4366\n"
-                                   "vn 0.3754 0.1948 0.9062\n"
-                                   "vn 0.0381 0.9950 0.0920\n"
-                                   "vn 0.1469 -0.9233 0.3548\n"
-                                   "vn 0.3808 0.0979 0.9194\n"
-                                   "vn 0.0752 0.9805 0.1816\n"
-                                   "vn 0.1116 -0.9565 0.2695\n"
-                                   "vn 0.3827 -0.0000 0.9239\n"
-                                   "vn 0.1116 0.9565 0.2695\n"
-                                   "vn 0.0752 -0.9805 0.1816\n"
-                                   "vn 0.3808 -0.0979 0.9194\n"
-                                   "vn 0.2778 -0.2899 0.9159\n"
-                                   "vn 0.2683 -0.3821 0.8843\n"
-                                   "vn 0.1616 0.8308 0.5327\n"
-                                   "vn 0.1844 0.7723 0.6080\n"
-                                   "vn 0.2561 -0.4708 0.8443\n"
-                                   "vn 0.2055 0.7063 0.6774\n"
-                                   "vn 0.2415 -0.5549 0.7961\n"
-                                   "vn 0.2246 0.6336 0.7403\n"
-                                   "vn 0.2246 -0.6336 0.7403\n"
-                                   "vn 0.2415 0.5549 0.7961\n"
-                                   "vn 0.2055 -0.7063 0.6774\n"
-                                   "vn 0.2561 0.4708 0.8443\n"
-                                   "vn 0.1844 -0.7723 0.6080\n"
-                                   "vn 0.2683 0.3821 0.8843\n"
-                                   "vn 0.1616 -0.8308 0.5327\n"
-                                   "vn 0.2778 0.2899 0.9159\n"
-                                   "vn 0.1372 -0.8813 0.4522\n"
-                                   "vn 0.2847 0.1948 0.9386\n"
-                                   "vn 0.0289 0.9950 0.0952\n"
-                                   "vn 0.1115 -0.9233 0.3675\n"
-                                   "vn 0.2889 0.0979 0.9523\n"
-                                   "vn 0.0571 0.9805 0.1881\n"
-                                   "vn 0.0847 -0.9565 0.2791\n"
-                                   "vn 0.2903 -0.0000 0.9569\n"
-                                   "vn 0.0847 0.9565 0.2791\n"
-                                   "vn 0.0571 -0.9805 0.1881\n"
-                                   "vn 0.2889 -0.0979 0.9523\n"
-                                   "vn 0.1115 0.9233 0.3675\n"
-                                   "vn 0.0289 -0.9950 0.0952\n"
-                                   "vn 0.2847 -0.1948 0.9386\n"
-                                   "vn 0.1372 0.8813 0.4522\n"
-                                   "vn 0.1623 -0.5549 0.8160\n"
-                                   "vn 0.1509 0.6336 0.7588\n"
-                                   "vn 0.1509 -0.6336 0.7588\n"
-                                   "vn 0.1623 0.5549 0.8160\n"
-                                   "vn 0.1381 -0.7063 0.6943\n"
-                                   "vn 0.1721 0.4708 0.8653\n"
-                                   "vn 0.1239 -0.7723 0.6231\n"
-                                   "vn 0.1803 0.3821 0.9063\n"
-                                   "vn 0.1086 -0.8308 0.5459\n"
-                                   "vn 0.1867 0.2899 0.9387\n"
-                                   "vn 0.0922 -0.8813 0.4635\n"
-                                   "vn 0.1914 0.1948 0.9620\n"
-                                   "vn 0.0194 0.9950 0.0976\n"
-                                   "vn 0.0749 -0.9233 0.3766\n"
-                                   "vn 0.1942 0.0979 0.9761\n"
-                                   "vn 0.0383 0.9805 0.1928\n"
-                                   "vn 0.0569 -0.9565 0.2861\n"
-                                   "vn 0.1951 -0.0000 0.9808\n"
-                                   "vn 0.0569 0.9565 0.2861\n"
-                                   "vn 0.0383 -0.9805 0.1928\n"
-                                   "vn 0.1942 -0.0979 0.9761\n"
-                                   "vn 0.0749 0.9233 0.3766\n"
-                                   "vn 0.0194 -0.9950 0.0976\n"
-                                   "vn 0.1914 -0.1948 0.9620\n"
-                                   "vn 0.0922 0.8813 0.4635\n"
-                                   "vn 0.1867 -0.2899 0.9387\n"
-                                   "vn 0.1086 0.8308 0.5459\n"
-                                   "vn 0.1803 -0.3821 0.9063\n"
-                                   "vn 0.1239 0.7723 0.6231\n"
-                                   "vn 0.1721 -0.4708 0.8653\n"
-                                   "vn 0.1381 0.7063 0.6943\n"
-                                   "vn 0.0758 -0.6336 0.7699\n"
-                                   "vn 0.0694 -0.7063 0.7045\n"
-                                   "vn 0.0865 0.4708 0.8780\n"
-                                   "vn 0.0623 -0.7723 0.6322\n"
-                                   "vn 0.0906 0.3821 0.9197\n"
-                                   "vn 0.0546 -0.8308 0.5539\n"
-                                   "vn 0.0938 0.2899 0.9525\n"
-                                   "vn 0.0463 -0.8813 0.4703\n"
-                                   "vn 0.0961 0.1948 0.9761\n"
-                                   "vn 0.0098 0.9950 0.0991\n"
-                                   "vn 0.0376 -0.9233 0.3821\n"
-                                   "vn 0.0975 0.0979 0.9904\n"
-                                   "vn 0.0193 0.9805 0.1956\n"
-                                   "vn 0.0286 -0.9565 0.2903\n"
-                                   "vn 0.0980 -0.0000 0.9952\n"
-                                   "vn 0.0286 0.9565 0.2903\n"
-                                   "vn 0.0193 -0.9805 0.1956\n"
-                                   "vn 0.0975 -0.0979 0.9904\n"
-                                   "vn 0.0376 0.9233 0.3821\n"
-                                   "vn 0.0098 -0.9950 0.0991\n"
-                                   "vn 0.0961 -0.1948 0.9761\n"
-                                   "vn 0.0463 0.8813 0.4703\n"
-                                   "vn 0.0938 -0.2899 0.9525\n"
-                                   "vn 0.0546 0.8308 0.5539\n"
-                                   "vn 0.0906 -0.3821 0.9197\n"
-                                   "vn 0.0623 0.7723 0.6322\n"
-                                   "vn 0.0865 -0.4708 0.8780\n"
-                                   "vn 0.0694 0.7063 0.7045\n"
-                                   "vn 0.0815 -0.5549 0.8279\n"
-                                   "vn 0.0758 0.6336 0.7699\n"
-                                   "vn 0.0815 0.5549 0.8279\n"
-                                   "vn 0.0000 -0.8308 0.5566\n"
-                                   "vn -0.0000 0.2899 0.9571\n"
-                                   "vn -0.0000 -0.8813 0.4726\n"
-                                   "vn 0.0000 0.1948 0.9808\n"
-                                   "vn -0.0000 0.9950 0.0995\n"
-                                   "vn -0.0000 -0.9233 0.3840\n"
-                                   "vn 0.0000 0.0979 0.9952\n"
-                                   "vn 0.0000 0.9805 0.1966\n"
-                                   "vn -0.0000 -0.9565 0.2917\n"
-                                   "vn -0.0000 -0.0000 1.0000\n"
-                                   "vn 0.0000 0.9565 0.2917\n"
-                                   "vn -0.0000 -0.9805 0.1966\n"
-                                   "vn 0.0000 -0.0979 0.9952\n"
-                                   "vn -0.0000 0.9233 0.3840\n"
-                                   "vn -0.0000 -0.9950 0.0995\n"
-                                   "vn -0.0000 -0.1948 0.9808\n"
-                                   "vn -0.0000 0.8813 0.4726\n"
-                                   "vn -0.0000 -0.2899 0.9571\n"
-                                   "vn 0.0000 0.8308 0.5566\n"
-                                   "vn 0.0000 -0.3821 0.9241\n"
-                                   "vn -0.0000 0.7723 0.6353\n"
-                                   "vn -0.0000 -0.4708 0.8823\n"
-                                   "vn 0.0000 0.7063 0.7079\n"
-                                   "vn -0.0000 -0.5549 0.8319\n"
-                                   "vn -0.0000 0.6336 0.7736\n"
-                                   "vn -0.0000 -0.6336 0.7736\n"
-                                   "vn 0.0000 0.5549 0.8319\n"
-                                   "vn 0.0000 -0.7063 0.7079\n"
-                                   "vn -0.0000 0.4708 0.8823\n"
-                                   "vn -0.0000 -0.7723 0.6353\n"
-                                   "vn -0.0000 0.3821 0.9241\n"
-                                   "vn -0.0098 0.9950 0.0991\n"
-                                   "vn -0.0376 -0.9233 0.3821\n"
-                                   "vn -0.0961 0.1948 0.9761\n"
-                                   "vn -0.0975 0.0979 0.9904\n"
-                                   "vn -0.0193 0.9805 0.1956\n"
-                                   "vn -0.0286 -0.9565 0.2903\n"
-                                   "vn -0.0980 -0.0000 0.9952\n"
-                                   "vn -0.0286 0.9565 0.2903\n"
-                                   "vn -0.0193 -0.9805 0.1956\n"
-                                   "vn -0.0975 -0.0979 0.9904\n"
-                                   "vn -0.0376 0.9233 0.3821\n"
-                                   "vn -0.0098 -0.9950 0.0991\n"
-                                   "vn -0.0961 -0.1948 0.9761\n"
-                                   "vn -0.0463 0.8813 0.4703\n"
-                                   "vn -0.0938 -0.2899 0.9525\n"
-                                   "vn -0.0546 0.8308 0.5539\n"
-                                   "vn -0.0906 -0.3821 0.9197\n"
-                                   "vn -0.0623 0.7723 0.6322\n"
-                                   "vn -0.0865 -0.4708 0.8780\n"
-                                   "vn -0.0694 0.7063 0.7045\n"
-                                   "vn -0.0815 -0.5549 0.8279\n"
-                                   "vn -0.0758 0.6336 0.7699\n"
-                                   "vn -0.0758 -0.6336 0.7699\n"
-                                   "vn -0.0815 0.5549 0.8279\n"
-                                   "vn -0.0694 -0.7063 0.7045\n"
-                                   "vn -0.0865 0.4708 0.8780\n"
-                                   "vn -0.0623 -0.7723 0.6322\n"
-                                   "vn -0.0906 0.3821 0.9197\n"
-                                   "vn -0.0546 -0.8308 0.5539\n"
-                                   "vn -0.0938 0.2899 0.9525\n"
-                                   "vn -0.0463 -0.8813 0.4703\n"
-                                   "vn -0.0569 0.9565 0.2861\n"
-                                   "vn -0.0383 -0.9805 0.1928\n"
-                                   "vn -0.1942 -0.0979 0.9761\n"
-                                   "vn -0.0749 0.9233 0.3766\n"
-                                   "vn -0.0194 -0.9950 0.0976\n"
-                                   "vn -0.1914 -0.1948 0.9620\n"
-                                   "vn -0.0922 0.8813 0.4635\n"
-                                   "vn -0.1867 -0.2899 0.9387\n"
-                                   "vn -0.1086 0.8308 0.5459\n"
-                                   "vn -0.1803 -0.3821 0.9063\n"
-                                   "vn -0.1239 0.7723 0.6231\n"
-                                   "vn -0.1721 -0.4708 0.8653\n"
-                                   "vn -0.1381 0.7063 0.6943\n"
-                                   "vn -0.1623 -0.5549 0.8160\n"
-                                   "vn -0.1509 0.6336 0.7588\n"
-                                   "vn -0.1509 -0.6336 0.7588\n"
-                                   "vn -0.1623 0.5549 0.8160\n"
-                                   "vn -0.1381 -0.7063 0.6943\n"
-                                   "vn -0.1721 0.4708 0.8653\n"
-                                   "vn -0.1239 -0.7723 0.6231\n"
-                                   "vn -0.1803 0.3821 0.9063\n"
-                                   "vn -0.1086 -0.8308 0.5459\n"
-                                   "vn -0.1867 0.2899 0.9387\n"
-                                   "vn -0.0922 -0.8813 0.4635\n"
-                                   "vn -0.1914 0.1948 0.9620\n"
-                                   "vn -0.0194 0.9950 0.0976\n"
-                                   "vn -0.0749 -0.9233 0.3766\n"
-                                   "vn -0.1942 0.0979 0.9761\n"
-                                   "vn -0.0383 0.9805 0.1928\n"
-                                   "vn -0.0569 -0.9565 0.2861\n"
-                                   "vn -0.1951 0.0000 0.9808\n"
-                                   "vn -0.1372 0.8813 0.4522\n"
-                                   "vn -0.0289 -0.9950 0.0952\n"
-                                   "vn -0.2847 -0.1948 0.9386\n"
-                                   "vn -0.2778 -0.2899 0.9159\n"
-                                   "vn -0.1616 0.8308 0.5327\n"
-                                   "vn -0.2683 -0.3821 0.8843\n"
-                                   "vn -0.1844 0.7723 0.6080\n"
-                                   "vn -0.2561 -0.4708 0.8443\n"
-                                   "vn -0.2055 0.7063 0.6774\n"
-                                   "vn -0.2415 -0.5549 0.7961\n"
-                                   "vn -0.2246 0.6336 0.7403\n"
-                                   "vn -0.2246 -0.6336 0.7403\n"
-                                   "vn -0.2415 0.5549 0.7961\n"
-                                   "vn -0.2055 -0.7063 0.6774\n"
-                                   "vn -0.2561 0.4708 0.8443\n"
-                                   "vn -0.1844 -0.7723 0.6080\n"
-                                   "vn -0.2683 0.3821 0.8843\n"
-                                   "vn -0.1616 -0.8308 0.5327\n"
-                                   "vn -0.2778 0.2899 0.9159\n"
-                                   "vn -0.1372 -0.8813 0.4522\n"
-                                   "vn -0.2847 0.1948 0.9386\n"
-                                   "vn -0.0289 0.9950 0.0952\n"
-                                   "vn -0.1115 -0.9233 0.3675\n"
-                                   "vn -0.2889 0.0979 0.9523\n"
-                                   "vn -0.0571 0.9805 0.1881\n"
-                                   "vn -0.0847 -0.9565 0.2791\n"
-                                   "vn -0.2903 0.0000 0.9569\n"
-                                   "vn -0.0847 0.9565 0.2791\n"
-                                   "vn -0.0571 -0.9805 0.1881\n"
-                                   "vn -0.2889 -0.0979 0.9523\n"
-                                   "vn -0.1115 0.9233 0.3675\n"
-                                   "vn -0.2130 0.8308 0.5143\n"
-                                   "vn -0.2431 0.7723 0.5869\n"
-                                   "vn -0.3376 -0.4708 0.8151\n"
-                                   "vn -0.2709 0.7063 0.6540\n"
-                                   "vn -0.3184 -0.5549 0.7686\n"
-                                   "vn -0.2961 0.6336 0.7147\n"
-                                   "vn -0.2961 -0.6336 0.7147\n"
-                                   "vn -0.3184 0.5549 0.7686\n"
-                                   "vn -0.2709 -0.7063 0.6540\n"
-                                   "vn -0.3376 0.4708 0.8151\n"
-                                   "vn -0.2431 -0.7723 0.5869\n"
-                                   "vn -0.3536 0.3821 0.8538\n"
-                                   "vn -0.2130 -0.8308 0.5143\n"
-                                   "vn -0.3663 0.2899 0.8842\n"
-                                   "vn -0.1809 -0.8813 0.4366\n"
-                                   "vn -0.3754 0.1948 0.9062\n"
-                                   "vn -0.0381 0.9950 0.0920\n"
-                                   "vn -0.1469 -0.9233 0.3548\n"
-                                   "vn -0.3808 0.0979 0.9194\n"
-                                   "vn -0.0752 0.9805 0.1816\n"
-                                   "vn -0.1116 -0.9565 0.2695\n"
-                                   "vn -0.3827 -0.0000 0.9239\n"
-                                   "vn -0.1116 0.9565 0.2695\n"
-                                   "vn -0.0752 -0.9805 0.1816\n"
-                                   "vn -0.3808 -0.0979 0.9194\n"
-                                   "vn -0.1469 0.9233 0.3548\n"
-                                   "vn -0.0381 -0.9950 0.0920\n"
-                                   "vn -0.3754 -0.1948 0.9062\n"
-                                   "vn -0.1809 0.8813 0.4366\n"
-                                   "vn -0.3663 -0.2899 0.8842\n"
-                                   "vn -0.3536 -0.3821 0.8538\n"
-                                   "vn -0.3647 0.6336 0.6823\n"
-                                   "vn -0.3922 -0.5549 0.7337\n"
-                                   "vn -0.3647 -0.6336 0.6823\n"
-                                   "vn -0.3922 0.5549 0.7337\n"
-                                   "vn -0.3337 -0.7063 0.6243\n"
-                                   "vn -0.4159 0.4708 0.7781\n"
-                                   "vn -0.2995 -0.7723 0.5603\n"
-                                   "vn -0.4356 0.3821 0.8150\n"
-                                   "vn -0.2624 -0.8308 0.4909\n"
-                                   "vn -0.4512 0.2899 0.8441\n"
-                                   "vn -0.2228 -0.8813 0.4168\n"
-                                   "vn -0.4624 0.1948 0.8650\n"
-                                   "vn -0.0469 0.9950 0.0878\n"
-                                   "vn -0.1810 -0.9233 0.3386\n"
-                                   "vn -0.4691 0.0979 0.8777\n"
-                                   "vn -0.0927 0.9805 0.1734\n"
-                                   "vn -0.1375 -0.9565 0.2572\n"
-                                   "vn -0.4714 -0.0000 0.8819\n"
-                                   "vn -0.1375 0.9565 0.2572\n"
-                                   "vn -0.0927 -0.9805 0.1734\n"
-                                   "vn -0.4691 -0.0979 0.8777\n"
-                                   "vn -0.1810 0.9233 0.3386\n"
-                                   "vn -0.0469 -0.9950 0.0878\n"
-                                   "vn -0.4624 -0.1948 0.8650\n"
-                                   "vn -0.2228 0.8813 0.4168\n"
-                                   "vn -0.4512 -0.2899 0.8441\n"
-                                   "vn -0.2624 0.8308 0.4909\n"
-                                   "vn -0.4356 -0.3821 0.8150\n"
-                                   "vn -0.2995 0.7723 0.5603\n"
-                                   "vn -0.4159 -0.4708 0.7781\n"
-                                   "vn -0.3337 0.7063 0.6243\n"
-                                   "vn -0.4902 0.4708 0.7336\n"
-                                   "vn -0.3530 -0.7723 0.5282\n"
-                                   "vn -0.5134 0.3821 0.7684\n"
-                                   "vn -0.3092 -0.8308 0.4628\n"
-                                   "vn -0.5317 0.2899 0.7958\n"
-                                   "vn -0.2626 -0.8813 0.3929\n"
-                                   "vn -0.5449 0.1948 0.8155\n"
-                                   "vn -0.0553 0.9950 0.0828\n"
-                                   "vn -0.2133 -0.9233 0.3193\n"
-                                   "vn -0.5529 0.0979 0.8275\n"
-                                   "vn -0.1092 0.9805 0.1634\n"
-                                   "vn -0.1621 -0.9565 0.2425\n"
-                                   "vn -0.5556 -0.0000 0.8315\n"
-                                   "vn -0.1621 0.9565 0.2425\n"
-                                   "vn -0.1092 -0.9805 0.1634\n"
-                                   "vn -0.5529 -0.0979 0.8275\n"
-                                   "vn -0.2133 0.9233 0.3193\n"
-                                   "vn -0.0553 -0.9950 0.0828\n"
-                                   "vn -0.5449 -0.1948 0.8155\n"
-                                   "vn -0.2626 0.8813 0.3929\n"
-                                   "vn -0.5317 -0.2899 0.7958\n"
-                                   "vn -0.3092 0.8308 0.4628\n"
-                                   "vn -0.5134 -0.3821 0.7684\n"
-                                   "vn -0.3530 0.7723 0.5282\n"
-                                   "vn -0.4902 -0.4708 0.7336\n"
-                                   "vn -0.3933 0.7063 0.5886\n"
-                                   "vn -0.4622 -0.5549 0.6917\n"
-                                   "vn -0.4298 0.6336 0.6432\n"
-                                   "vn -0.4298 -0.6336 0.6432\n"
-                                   "vn -0.4622 0.5549 0.6917\n"
-                                   "vn -0.3933 -0.7063 0.5886\n"
-                                   "vn -0.6072 0.2899 0.7398\n"
-                                   "vn -0.3531 -0.8308 0.4303\n"
-                                   "vn -0.2998 -0.8813 0.3653\n"
-                                   "vn -0.6222 0.1948 0.7582\n"
-                                   "vn -0.0631 0.9950 0.0769\n"
-                                   "vn -0.2436 -0.9233 0.2968\n"
-                                   "vn -0.6313 0.0979 0.7693\n"
-                                   "vn -0.1247 0.9805 0.1519\n"
-                                   "vn -0.1850 -0.9565 0.2255\n"
-                                   "vn -0.6344 -0.0000 0.7730\n"
-                                   "vn -0.1850 0.9565 0.2255\n"
-                                   "vn -0.1247 -0.9805 0.1519\n"
-                                   "vn -0.6313 -0.0979 0.7693\n"
-                                   "vn -0.2436 0.9233 0.2968\n"
-                                   "vn -0.0631 -0.9950 0.0769\n"
-                                   "vn -0.6222 -0.1948 0.7582\n"
-                                   "vn -0.2998 0.8813 0.3653\n"
-                                   "vn -0.6072 -0.2899 0.7398\n"
-                                   "vn -0.3531 0.8308 0.4303\n"
-                                   "vn -0.5862 -0.3821 0.7143\n"
-                                   "vn -0.4030 0.7723 0.4911\n"
-                                   "vn -0.5597 -0.4708 0.6820\n"
-                                   "vn -0.4491 0.7063 0.5472\n"
-                                   "vn -0.5278 -0.5549 0.6431\n"
-                                   "vn -0.4908 0.6336 0.5980\n"
-                                   "vn -0.4908 -0.6336 0.5980\n"
-                                   "vn -0.5278 0.5549 0.6431\n"
-                                   "vn -0.4491 -0.7063 0.5472\n"
-                                   "vn -0.5597 0.4708 0.6820\n"
-                                   "vn -0.4030 -0.7723 0.4911\n"
-                                   "vn -0.5862 0.3821 0.7143\n"
-                                   "vn -0.6936 0.1948 0.6936\n"
-                                   "vn -0.7037 0.0979 0.7037\n"
-                                   "vn -0.1390 0.9805 0.1390\n"
-                                   "vn -0.2715 -0.9233 0.2715\n"
-                                   "vn -0.2063 -0.9565 0.2063\n"
-                                   "vn -0.7071 -0.0000 0.7071\n"
-                                   "vn -0.2063 0.9565 0.2063\n"
-                                   "vn -0.1390 -0.9805 0.1390\n"
-                                   "vn -0.7037 -0.0979 0.7037\n"
-                                   "vn -0.2715 0.9233 0.2715\n"
-                                   "vn -0.0704 -0.9950 0.0704\n"
-                                   "vn -0.6936 -0.1948 0.6936\n"
-                                   "vn -0.3342 0.8813 0.3342\n"
-                                   "vn -0.6768 -0.2899 0.6768\n"
-                                   "vn -0.3936 0.8308 0.3936\n"
-                                   "vn -0.6534 -0.3821 0.6534\n"
-                                   "vn -0.4492 0.7723 0.4492\n"
-                                   "vn -0.6239 -0.4708 0.6239\n"
-                                   "vn -0.5005 0.7063 0.5005\n"
-                                   "vn -0.5883 -0.5549 0.5883\n"
-                                   "vn -0.5470 0.6336 0.5470\n"
-                                   "vn -0.5470 -0.6336 0.5470\n"
-                                   "vn -0.5883 0.5549 0.5883\n"
-                                   "vn -0.5005 -0.7063 0.5005\n"
-                                   "vn -0.6239 0.4708 0.6239\n"
-                                   "vn -0.4492 -0.7723 0.4492\n"
-                                   "vn -0.6534 0.3821 0.6534\n"
-                                   "vn -0.3936 -0.8308 0.3936\n"
-                                   "vn -0.6768 0.2899 0.6767\n"
-                                   "vn -0.3342 -0.8813 0.3342\n"
-                                   "vn -0.0704 0.9950 0.0704\n"
-                                   "vn -0.7693 -0.0979 0.6313\n"
-                                   "vn -0.2255 0.9565 0.1850\n"
-                                   "vn -0.2968 0.9233 0.2436\n"
-                                   "vn -0.0769 -0.9950 0.0631\n"
-                                   "vn -0.7582 -0.1948 0.6222\n"
-                                   "vn -0.3653 0.8813 0.2998\n"
-                                   "vn -0.7398 -0.2899 0.6072\n"
-                                   "vn -0.4303 0.8308 0.3531\n"
-                                   "vn -0.7143 -0.3821 0.5862\n"
-                                   "vn -0.4911 0.7723 0.4030\n"
-                                   "vn -0.6820 -0.4708 0.5597\n"
-                                   "vn -0.5472 0.7063 0.4491\n"
-                                   "vn -0.6431 -0.5549 0.5278\n"
-                                   "vn -0.5980 0.6336 0.4908\n"
-                                   "vn -0.5980 -0.6336 0.4908\n"
-                                   "vn -0.6431 0.5549 0.5278\n"
-                                   "vn -0.5472 -0.7063 0.4491\n"
-                                   "vn -0.6820 0.4708 0.5597\n"
-                                   "vn -0.4911 -0.7723 0.4030\n"
-                                   "vn -0.7143 0.3821 0.5862\n"
-                                   "vn -0.4303 -0.8308 0.3531\n"
-                                   "vn -0.7398 0.2899 0.6072\n"
-                                   "vn -0.3653 -0.8813 0.2998\n"
-                                   "vn -0.7582 0.1948 0.6222\n"
-                                   "vn -0.0769 0.9950 0.0631\n"
-                                   "vn -0.2968 -0.9233 0.2436\n"
-                                   "vn -0.7693 0.0979 0.6313\n"
-                                   "vn -0.1519 0.9805 0.1247\n"
-                                   "vn -0.2255 -0.9565 0.1850\n"
-                                   "vn -0.7730 -0.0000 0.6344\n"
-                                   "vn -0.1519 -0.9805 0.1247\n"
-                                   "vn -0.8155 -0.1948 0.5449\n"
-                                   "vn -0.7958 -0.2899 0.5317\n"
-                                   "vn -0.4628 0.8308 0.3092\n"
-                                   "vn -0.7684 -0.3821 0.5134\n"
-                                   "vn -0.5282 0.7723 0.3530\n"
-                                   "vn -0.7336 -0.4708 0.4902\n"
-                                   "vn -0.5886 0.7063 0.3933\n"
-                                   "vn -0.6917 -0.5549 0.4622\n"
-                                   "vn -0.6432 0.6336 0.4298\n"
-                                   "vn -0.6432 -0.6336 0.4298\n"
-                                   "vn -0.6917 0.5549 0.4622\n"
-                                   "vn -0.5886 -0.7063 0.3933\n"
-                                   "vn -0.7336 0.4708 0.4902\n"
-                                   "vn -0.5282 -0.7723 0.3530\n"
-                                   "vn -0.7684 0.3821 0.5134\n"
-                                   "vn -0.4628 -0.8308 0.3092\n"
-                                   "vn -0.7958 0.2899 0.5317\n"
-                                   "vn -0.3929 -0.8813 0.2626\n"
-                                   "vn -0.8155 0.1948 0.5449\n"
-                                   "vn -0.0828 0.9950 0.0553\n"
-                                   "vn -0.3193 -0.9233 0.2133\n"
-                                   "vn -0.8275 0.0979 0.5529\n"
-                                   "vn -0.1634 0.9805 0.1092\n"
-                                   "vn -0.2425 -0.9565 0.1621\n"
-                                   "vn -0.8315 -0.0000 0.5556\n"
-                                   "vn -0.2425 0.9565 0.1621\n"
-                                   "vn -0.1634 -0.9805 0.1092\n"
-                                   "vn -0.8275 -0.0979 0.5529\n"
-                                   "vn -0.3193 0.9233 0.2133\n"
-                                   "vn -0.0828 -0.9950 0.0553\n"
-                                   "vn -0.3929 0.8813 0.2626\n"
-                                   "vn -0.7781 -0.4708 0.4159\n"
-                                   "vn -0.5603 0.7723 0.2995\n"
-                                   "vn -0.6243 0.7063 0.3337\n"
-                                   "vn -0.7337 -0.5549 0.3922\n"
-                                   "vn -0.6823 0.6336 0.3647\n"
-                                   "vn -0.6823 -0.6336 0.3647\n"
-                                   "vn -0.7337 0.5549 0.3922\n"
-                                   "vn -0.6243 -0.7063 0.3337\n"
-                                   "vn -0.7781 0.4708 0.4159\n"
-                                   "vn -0.5603 -0.7723 0.2995\n"
-                                   "vn -0.8150 0.3821 0.4356\n"
-                                   "vn -0.4909 -0.8308 0.2624\n"
-                                   "vn -0.8441 0.2899 0.4512\n"
-                                   "vn -0.4168 -0.8813 0.2228\n"
-                                   "vn -0.8650 0.1948 0.4624\n"
-                                   "vn -0.0878 0.9950 0.0469\n"
-                                   "vn -0.3386 -0.9233 0.1810\n"
-                                   "vn -0.8777 0.0979 0.4691\n"
-                                   "vn -0.1734 0.9805 0.0927\n"
-                                   "vn -0.2572 -0.9565 0.1375\n"
-                                   "vn -0.8819 -0.0000 0.4714\n"
-                                   "vn -0.2572 0.9565 0.1375\n"
-                                   "vn -0.1734 -0.9805 0.0927\n"
-                                   "vn -0.8777 -0.0979 0.4691\n"
-                                   "vn -0.3386 0.9233 0.1810\n"
-                                   "vn -0.0878 -0.9950 0.0469\n"
-                                   "vn -0.8650 -0.1948 0.4624\n"
-                                   "vn -0.4168 0.8813 0.2228\n"
-                                   "vn -0.8441 -0.2899 0.4512\n"
-                                   "vn -0.4909 0.8308 0.2624\n"
-                                   "vn -0.8150 -0.3821 0.4356\n"
-                                   "vn -0.7686 -0.5549 0.3184\n"
-                                   "vn -0.7147 -0.6336 0.2961\n"
-                                   "vn -0.7686 0.5549 0.3184\n"
-                                   "vn -0.6540 -0.7063 0.2709\n"
-                                   "vn -0.8151 0.4708 0.3376\n"
-                                   "vn -0.5869 -0.7723 0.2431\n"
-                                   "vn -0.8538 0.3821 0.3536\n"
-                                   "vn -0.5143 -0.8308 0.2130\n"
-                                   "vn -0.8842 0.2899 0.3663\n"
-                                   "vn -0.4366 -0.8813 0.1809\n"
-                                   "vn -0.9062 0.1948 0.3754\n"
-                                   "vn -0.0920 0.9950 0.0381\n"
-                                   "vn -0.3548 -0.9233 0.1469\n"
-                                   "vn -0.9194 0.0979 0.3808\n"
-                                   "vn -0.1816 0.9805 0.0752\n"
-                                   "vn -0.2695 -0.9565 0.1116\n"
-                                   "vn -0.9239 -0.0000 0.3827\n"
-                                   "vn -0.2695 0.9565 0.1116\n"
-                                   "vn -0.1816 -0.9805 0.0752\n"
-                                   "vn -0.9194 -0.0979 0.3808\n"
-                                   "vn -0.3548 0.9233 0.1469\n"
-                                   "vn -0.0920 -0.9950 0.0381\n"
-                                   "vn -0.9062 -0.1948 0.3754\n"
-                                   "vn -0.4366 0.8813 0.1809\n"
-                                   "vn -0.8842 -0.2899 0.3663\n"
-                                   "vn -0.5143 0.8308 0.2130\n"
-                                   "vn -0.8538 -0.3821 0.3536\n"
-                                   "vn -0.5869 0.7723 0.2431\n"
-                                   "vn -0.8151 -0.4708 0.3376\n"
-                                   "vn -0.6540 0.7063 0.2709\n"
-                                   "vn -0.7147 0.6336 0.2961\n"
-                                   "vn -0.6080 -0.7723 0.1844\n"
-                                   "vn -0.8843 0.3821 0.2683\n"
-                                   "vn -0.5327 -0.8308 0.1616\n"
-                                   "vn -0.9159 0.2899 0.2778\n"
-                                   "vn -0.4522 -0.8813 0.1372\n"
-                                   "vn -0.9386 0.1948 0.2847\n"
-                                   "vn -0.0952 0.9950 0.0289\n"
-                                   "vn -0.3675 -0.9233 0.1115\n"
-                                   "vn -0.9523 0.0979 0.2889\n"
-                                   "vn -0.1881 0.9805 0.0571\n"
-                                   "vn -0.2791 -0.9565 0.0847\n"
-                                   "vn -0.9569 -0.0000 0.2903\n"
-                                   "vn -0.2791 0.9565 0.0847\n"
-                                   "vn -0.1881 -0.9805 0.0571\n"
-                                   "vn -0.9523 -0.0979 0.2889\n"
-                                   "vn -0.3675 0.9233 0.1115\n"
-                                   "vn -0.0952 -0.9950 0.0289\n"
-                                   "vn -0.9386 -0.1948 0.2847\n"
-                                   "vn -0.4522 0.8813 0.1372\n"
-                                   "vn -0.9159 -0.2899 0.2778\n"
-                                   "vn -0.5327 0.8308 0.1616\n"
-                                   "vn -0.8843 -0.3821 0.2683\n"
-                                   "vn -0.6080 0.7723 0.1844\n"
-                                   "vn -0.8443 -0.4708 0.2561\n"
-                                   "vn -0.6774 0.7063 0.2055\n"
-                                   "vn -0.7961 -0.5549 0.2415\n"
-                                   "vn -0.7403 0.6336 0.2246\n"
-                                   "vn -0.7403 -0.6336 0.2246\n"
-                                   "vn -0.7961 0.5549 0.2415\n"
-                                   "vn -0.6774 -0.7063 0.2055\n"
-                                   "vn -0.8443 0.4708 0.2561\n"
-                                   "vn -0.5459 -0.8308 0.1086\n"
-                                   "vn -0.4635 -0.8813 0.0922\n"
-                                   "vn -0.9620 0.1948 0.1914\n"
-                                   "vn -0.0976 0.9950 0.0194\n"
-                                   "vn -0.3766 -0.9233 0.0749\n"
-                                   "vn -0.9761 0.0979 0.1942\n"
-                                   "vn -0.1928 0.9805 0.0383\n"
-                                   "vn -0.2861 -0.9565 0.0569\n"
-                                   "vn -0.9808 -0.0000 0.1951\n"
-                                   "vn -0.2861 0.9565 0.0569\n"
-                                   "vn -0.1928 -0.9805 0.0383\n"
-                                   "vn -0.9761 -0.0979 0.1942\n"
-                                   "vn -0.3766 0.9233 0.0749\n"
-                                   "vn -0.0976 -0.9950 0.0194\n"
-                                   "vn -0.9620 -0.1948 0.1914\n"
-                                   "vn -0.4635 0.8813 0.0922\n"
-                                   "vn -0.9387 -0.2899 0.1867\n"
-                                   "vn -0.5459 0.8308 0.1086\n"
-                                   "vn -0.9063 -0.3821 0.1803\n"
-                                   "vn -0.6231 0.7723 0.1239\n"
-                                   "vn -0.8653 -0.4708 0.1721\n"
-                                   "vn -0.6943 0.7063 0.1381\n"
-                                   "vn -0.8160 -0.5549 0.1623\n"
-                                   "vn -0.7588 0.6336 0.1509\n"
-                                   "vn -0.7588 -0.6336 0.1509\n"
-                                   "vn -0.8160 0.5549 0.1623\n"
-                                   "vn -0.6943 -0.7063 0.1381\n"
-                                   "vn -0.8653 0.4708 0.1721\n"
-                                   "vn -0.6231 -0.7723 0.1239\n"
-                                   "vn -0.9063 0.3821 0.1803\n"
-                                   "vn -0.9387 0.2899 0.1867\n"
-                                   "vn -0.2903 -0.9565 0.0286\n"
-                                   "vn -0.9904 0.0979 0.0975\n"
-                                   "vn -0.9952 -0.0000 0.0980\n"
-                                   "vn -0.1956 0.9805 0.0193\n"
-                                   "vn -0.2903 0.9565 0.0286\n"
-                                   "vn -0.1956 -0.9805 0.0193\n"
-                                   "vn -0.9904 -0.0979 0.0975\n"
-                                   "vn -0.3821 0.9233 0.0376\n"
-                                   "vn -0.0991 -0.9950 0.0098\n"
-                                   "vn -0.9761 -0.1948 0.0961\n"
-                                   "vn -0.4703 0.8813 0.0463\n"
-                                   "vn -0.9525 -0.2899 0.0938\n"
-                                   "vn -0.5539 0.8308 0.0546\n"
-                                   "vn -0.9197 -0.3821 0.0906\n"
-                                   "vn -0.6322 0.7723 0.0623\n"
-                                   "vn -0.8780 -0.4708 0.0865\n"
-                                   "vn -0.7045 0.7063 0.0694\n"
-                                   "vn -0.8279 -0.5549 0.0815\n"
-                                   "vn -0.7699 0.6336 0.0758\n"
-                                   "vn -0.7699 -0.6336 0.0758\n"
-                                   "vn -0.8279 0.5549 0.0815\n"
-                                   "vn -0.7045 -0.7063 0.0694\n"
-                                   "vn -0.8780 0.4708 0.0865\n"
-                                   "vn -0.6322 -0.7723 0.0623\n"
-                                   "vn -0.9197 0.3821 0.0906\n"
-                                   "vn -0.5539 -0.8308 0.0546\n"
-                                   "vn -0.9525 0.2899 0.0938\n"
-                                   "vn -0.4703 -0.8813 0.0463\n"
-                                   "vn -0.9761 0.1948 0.0961\n"
-                                   "vn -0.0991 0.9950 0.0098\n"
-                                   "vn -0.3821 -0.9233 0.0376\n"
-                                   "vn -0.1966 -0.9805 -0.0000\n"
-                                   "vn -0.0995 -0.9950 -0.0000\n"
-                                   "vn -0.9808 -0.1948 -0.0000\n"
-                                   "vn -0.4726 0.8813 0.0000\n"
-                                   "vn -0.9571 -0.2899 -0.0000\n"
-                                   "vn -0.5566 0.8308 0.0000\n"
-                                   "vn -0.9241 -0.3821 -0.0000\n"
-                                   "vn -0.6353 0.7723 -0.0000\n"
-                                   "vn -0.8823 -0.4708 -0.0000\n"
-                                   "vn -0.7079 0.7063 -0.0000\n"
-                                   "vn -0.8319 -0.5549 0.0000\n"
-                                   "vn -0.7736 0.6336 0.0000\n"
-                                   "vn -0.7736 -0.6336 0.0000\n"
-                                   "vn -0.8319 0.5549 0.0000\n"
-                                   "vn -0.7079 -0.7063 0.0000\n"
-                                   "vn -0.8823 0.4708 -0.0000\n"
-                                   "vn -0.6353 -0.7723 -0.0000\n"
-                                   "vn -0.9241 0.3821 0.0000\n"
-                                   "vn -0.5566 -0.8308 -0.0000\n"
-                                   "vn -0.9571 0.2899 -0.0000\n"
-                                   "vn -0.4726 -0.8813 -0.0000\n"
-                                   "vn -0.9808 0.1948 -0.0000\n"
-                                   "vn -0.0995 0.9950 -0.0000\n"
-                                   "vn -0.3840 -0.9233 -0.0000\n"
-                                   "vn -0.9952 0.0979 -0.0000\n"
-                                   "vn -0.1966 0.9805 -0.0000\n"
-                                   "vn -0.2917 -0.9565 0.0000\n"
-                                   "vn -1.0000 -0.0000 -0.0000\n"
-                                   "vn -0.2917 0.9565 0.0000\n"
-                                   "vn -0.9952 -0.0979 -0.0000\n"
-                                   "vn -0.3840 0.9233 -0.0000\n"
-                                   "vn -0.9197 -0.3821 -0.0906\n"
-                                   "vn -0.5539 0.8308 -0.0546\n"
-                                   "vn -0.6322 0.7723 -0.0623\n"
-                                   "vn -0.8780 -0.4708 -0.0865\n"
-                                   "vn -0.7045 0.7063 -0.0694\n"
-                                   "vn -0.8279 -0.5549 -0.0815\n"
-                                   "vn -0.7699 0.6336 -0.0758\n"
-                                   "vn -0.7699 -0.6336 -0.0758\n"
-                                   "vn -0.8279 0.5549 -0.0815\n"
-                                   "vn -0.7045 -0.7063 -0.0694\n"
-                                   "vn -0.8780 0.4708 -0.0865\n"
-                                   "vn -0.6322 -0.7723 -0.0623\n"
-                                   "vn -0.9197 0.3821 -0.0906\n"
-                                   "vn -0.5539 -0.8308 -0.0546\n"
-                                   "vn -0.9525 0.2899 -0.0938\n"
-                                   "vn -0.4703 -0.8813 -0.0463\n"
-                                   "vn -0.9761 0.1948 -0.0961\n"
-                                   "vn -0.0991 0.9950 -0.0098\n"
-                                   "vn -0.3821 -0.9233 -0.0376\n"
-                                   "vn -0.9904 0.0979 -0.0975\n"
-                                   "vn -0.1956 0.9805 -0.0193\n"
-                                   "vn -0.2903 -0.9565 -0.0286\n"
-                                   "vn -0.9952 -0.0000 -0.0980\n"
-                                   "vn -0.2903 0.9565 -0.0286\n"
-                                   "vn -0.1956 -0.9805 -0.0193\n"
-                                   "vn -0.9904 -0.0979 -0.0975\n"
-                                   "vn -0.3821 0.9233 -0.0376\n"
-                                   "vn -0.0991 -0.9950 -0.0098\n"
-                                   "vn -0.9761 -0.1948 -0.0961\n"
-                                   "vn -0.4703 0.8813 -0.0463\n"
-                                   "vn -0.9525 -0.2899 -0.0938\n"
-                                   "vn -0.8160 -0.5549 -0.1623\n"
-                                   "vn -0.7588 0.6336 -0.1509\n"
-                                   "vn -0.7588 -0.6336 -0.1509\n"
-                                   "vn -0.8160 0.5549 -0.1623\n"
-                                   "vn -0.6943 -0.7063 -0.1381\n"
-                                   "vn -0.8653 0.4708 -0.1721\n"
-                                   "vn -0.6231 -0.7723 -0.1239\n"
-                                   "vn -0.9063 0.3821 -0.1803\n"
-                                   "vn -0.5459 -0.8308 -0.1086\n"
-                                   "vn -0.9387 0.2899 -0.1867\n"
-                                   "vn -0.4635 -0.8813 -0.0922\n"
-                                   "vn -0.9620 0.1948 -0.1914\n"
-                                   "vn -0.0976 0.9950 -0.0194\n"
-                                   "vn -0.3766 -0.9233 -0.0749\n"
-                                   "vn -0.9761 0.0979 -0.1942\n"
-                                   "vn -0.1928 0.9805 -0.0383\n"
-                                   "vn -0.2861 -0.9565 -0.0569\n"
-                                   "vn -0.9808 -0.0000 -0.1951\n"
-                                   "vn -0.2861 0.9565 -0.0569\n"
-                                   "vn -0.1928 -0.9805 -0.0383\n"
-                                   "vn -0.9761 -0.0979 -0.1942\n"
-                                   "vn -0.3766 0.9233 -0.0749\n"
-                                   "vn -0.0976 -0.9950 -0.0194\n"
-                                   "vn -0.9620 -0.1948 -0.1914\n"
-                                   "vn -0.4635 0.8813 -0.0922\n"
-                                   "vn -0.9387 -0.2899 -0.1867\n"
-                                   "vn -0.5459 0.8308 -0.1086\n"
-                                   "vn -0.9063 -0.3821 -0.1803\n"
-                                   "vn -0.6231 0.7723 -0.1239\n"
-                                   "vn -0.8653 -0.4708 -0.1721\n"
-                                   "vn -0.6943 0.7063 -0.1381\n"
-                                   "vn -0.7403 -0.6336 -0.2246\n"
-                                   "vn -0.6774 -0.7063 -0.2055\n"
-                                   "vn -0.7961 0.5549 -0.2415\n"
-                                   "vn -0.8443 0.4708 -0.2561\n"
-                                   "vn -0.6080 -0.7723 -0.1844\n"
-                                   "vn -0.8843 0.3821 -0.2683\n"
-                                   "vn -0.5327 -0.8308 -0.1616\n"
-                                   "vn -0.9159 0.2899 -0.2778\n"
-                                   "vn -0.4522 -0.8813 -0.1372\n"
-                                   "vn -0.9386 0.1948 -0.2847\n"
-                                   "vn -0.0952 0.9950 -0.0289\n"
-                                   "vn -0.3675 -0.9233 -0.1115\n"
-                                   "vn -0.9523 0.0979 -0.2889\n"
-                                   "vn -0.1881 0.9805 -0.0571\n"
-                                   "vn -0.2791 -0.9565 -0.0847\n"
-                                   "vn -0.9569 -0.0000 -0.2903\n"
-                                   "vn -0.2791 0.9565 -0.0847\n"
-                                   "vn -0.1881 -0.9805 -0.0571\n"
-                                   "vn -0.9523 -0.0979 -0.2889\n"
-                                   "vn -0.3675 0.9233 -0.1115\n"
-                                   "vn -0.0952 -0.9950 -0.0289\n"
-                                   "vn -0.9386 -0.1948 -0.2847\n"
-                                   "vn -0.4522 0.8813 -0.1372\n"
-                                   "vn -0.9159 -0.2899 -0.2778\n"
-                                   "vn -0.5327 0.8308 -0.1616\n"
-                                   "vn -0.8843 -0.3821 -0.2683\n"
-                                   "vn -0.6080 0.7723 -0.1844\n"
-                                   "vn -0.8443 -0.4708 -0.2561\n"
-                                   "vn -0.6774 0.7063 -0.2055\n"
-                                   "vn -0.7961 -0.5549 -0.2415\n"
-                                   "vn -0.7403 0.6336 -0.2246\n"
-                                   "vn -0.5869 -0.7723 -0.2431\n"
-                                   "vn -0.8538 0.3821 -0.3536\n"
-                                   "vn -0.5143 -0.8308 -0.2130\n"
-                                   "vn -0.8842 0.2899 -0.3663\n"
-                                   "vn -0.4366 -0.8813 -0.1809\n"
-                                   "vn -0.9062 0.1948 -0.3754\n"
-                                   "vn -0.0920 0.9950 -0.0381\n"
-                                   "vn -0.3548 -0.9233 -0.1469\n"
-                                   "vn -0.9194 0.0979 -0.3808\n"
-                                   "vn -0.1816 0.9805 -0.0752\n"
-                                   "vn -0.2695 -0.9565 -0.1116\n"
-                                   "vn -0.9239 -0.0000 -0.3827\n"
-                                   "vn -0.2695 0.9565 -0.1116\n"
-                                   "vn -0.1816 -0.9805 -0.0752\n"
-                                   "vn -0.9194 -0.0979 -0.3808\n"
-                                   "vn -0.3548 0.9233 -0.1469\n"
-                                   "vn -0.0920 -0.9950 -0.0381\n"
-                                   "vn -0.9062 -0.1948 -0.3754\n"
-                                   "vn -0.4366 0.8813 -0.1809\n"
-                                   "vn -0.8842 -0.2899 -0.3663\n"
-                                   "vn -0.5143 0.8308 -0.2130\n"
-                                   "vn -0.8538 -0.3821 -0.3536\n"
-                                   "vn -0.5869 0.7723 -0.2431\n"
-                                   "vn -0.8151 -0.4708 -0.3376\n"
-                                   "vn -0.6540 0.7063 -0.2709\n"
-                                   "vn -0.7686 -0.5549 -0.3184\n"
-                                   "vn -0.7147 0.6336 -0.2961\n"
-                                   "vn -0.7147 -0.6336 -0.2961\n"
-                                   "vn -0.7686 0.5549 -0.3184\n"
-                                   "vn -0.6540 -0.7063 -0.2709\n"
-                                   "vn -0.8151 0.4708 -0.3376\n"
-                                   "vn -0.4909 -0.8308 -0.2624\n"
-                                   "vn -0.4168 -0.8813 -0.2228\n"
-                                   "vn -0.8650 0.1948 -0.4624\n"
-                                   "vn -0.0878 0.9950 -0.0469\n"
-                                   "vn -0.3386 -0.9233 -0.1810\n"
-                                   "vn -0.8777 0.0979 -0.4691\n"
-                                   "vn -0.1734 0.9805 -0.0927\n"
-                                   "vn -0.2572 -0.9565 -0.1375\n"
-                                   "vn -0.8819 -0.0000 -0.4714\n"
-                                   "vn -0.2572 0.9565 -0.1375\n"
-                                   "vn -0.1734 -0.9805 -0.0927\n"
-                                   "vn -0.8777 -0.0979 -0.4691\n"
-                                   "vn -0.3387 0.9233 -0.1810\n"
-                                   "vn -0.0878 -0.9950 -0.0469\n"
-                                   "vn -0.8650 -0.1948 -0.4624\n"
-                                   "vn -0.4168 0.8813 -0.2228\n"
-                                   "vn -0.8441 -0.2899 -0.4512\n"
-                                   "vn -0.4909 0.8308 -0.2624\n"
-                                   "vn -0.8150 -0.3821 -0.4356\n"
-                                   "vn -0.5603 0.7723 -0.2995\n"
-                                   "vn -0.7781 -0.4708 -0.4159\n"
-                                   "vn -0.6243 0.7063 -0.3337\n"
-                                   "vn -0.7337 -0.5549 -0.3922\n"
-                                   "vn -0.6823 0.6336 -0.3647\n"
-                                   "vn -0.6823 -0.6336 -0.3647\n"
-                                   "vn -0.7337 0.5549 -0.3922\n"
-                                   "vn -0.6243 -0.7063 -0.3337\n"
-                                   "vn -0.7781 0.4708 -0.4159\n"
-                                   "vn -0.5603 -0.7723 -0.2995\n"
-                                   "vn -0.8150 0.3821 -0.4356\n"
-                                   "vn -0.8441 0.2899 -0.4512\n"
-                                   "vn -0.1634 0.9805 -0.1092\n"
-                                   "vn -0.3193 -0.9233 -0.2133\n"
-                                   "vn -0.2425 -0.9565 -0.1621\n"
-                                   "vn -0.8275 0.0979 -0.5529\n"
-                                   "vn -0.8315 -0.0000 -0.5556\n"
-                                   "vn -0.2425 0.9565 -0.1621\n"
-                                   "vn -0.1634 -0.9805 -0.1092\n"
-                                   "vn -0.8275 -0.0979 -0.5529\n"
-                                   "vn -0.3193 0.9233 -0.2133\n"
-                                   "vn -0.0828 -0.9950 -0.0553\n"
-                                   "vn -0.8155 -0.1948 -0.5449\n"
-                                   "vn -0.3929 0.8813 -0.2626\n"
-                                   "vn -0.7958 -0.2899 -0.5317\n"
-                                   "vn -0.4628 0.8308 -0.3092\n"
-                                   "vn -0.7684 -0.3821 -0.5134\n"
-                                   "vn -0.5282 0.7723 -0.3530\n"
-                                   "vn -0.7336 -0.4708 -0.4902\n"
-                                   "vn -0.5886 0.7063 -0.3933\n"
-                                   "vn -0.6917 -0.5549 -0.4622\n"
-                                   "vn -0.6432 0.6336 -0.4298\n"
-                                   "vn -0.6432 -0.6336 -0.4298\n"
-                                   "vn -0.6917 0.5549 -0.4622\n"
-                                   "vn -0.5886 -0.7063 -0.3933\n"
-                                   "vn -0.7336 0.4708 -0.4902\n"
-                                   "vn -0.5282 -0.7723 -0.3530\n"
-                                   "vn -0.7684 0.3821 -0.5134\n"
-                                   "vn -0.4628 -0.8308 -0.3092\n"
-                                   "vn -0.7958 0.2899 -0.5317\n"
-                                   "vn -0.3929 -0.8813 -0.2626\n"
-                                   "vn -0.8155 0.1948 -0.5449\n"
-                                   "vn -0.0828 0.9950 -0.0553\n"
-                                   "vn -0.2255 0.9565 -0.1850\n"
-                                   "vn -0.2968 0.9233 -0.2436\n"
-                                   "vn -0.0769 -0.9950 -0.0631\n"
-                                   "vn -0.7582 -0.1948 -0.6222\n"
-                                   "vn -0.3653 0.8813 -0.2998\n"
-                                   "vn -0.7398 -0.2899 -0.6072\n"
-                                   "vn -0.4303 0.8308 -0.3531\n"
-                                   "vn -0.7143 -0.3821 -0.5862\n"
-                                   "vn -0.4911 0.7723 -0.4030\n"
-                                   "vn -0.6820 -0.4708 -0.5597\n"
-                                   "vn -0.5472 0.7063 -0.4491\n"
-                                   "vn -0.6431 -0.5549 -0.5278\n"
-                                   "vn -0.5980 0.6336 -0.4908\n"
-                                   "vn -0.5980 -0.6336 -0.4908\n"
-                                   "vn -0.6431 0.5549 -0.5278\n"
-                                   "vn -0.5472 -0.7063 -0.4491\n"
-                                   "vn -0.6820 0.4708 -0.5597\n"
-                                   "vn -0.4911 -0.7723 -0.4030\n"
-                                   "vn -0.7143 0.3821 -0.5862\n"
-                                   "vn -0.4303 -0.8308 -0.3531\n"
-                                   "vn -0.7398 0.2899 -0.6072\n"
-                                   "vn -0.3653 -0.8813 -0.2998\n"
-                                   "vn -0.7582 0.1948 -0.6222\n"
-                                   "vn -0.0769 0.9950 -0.0631\n"
-                                   "vn -0.2968 -0.9233 -0.2436\n"
-                                   "vn -0.7693 0.0979 -0.6313\n"
-                                   "vn -0.1519 0.9805 -0.1247\n"
-                                   "vn -0.2255 -0.9565 -0.1850\n"
-                                   "vn -0.7730 -0.0000 -0.6344\n"
-                                   "vn -0.1519 -0.9805 -0.1247\n"
-                                   "vn -0.7693 -0.0979 -0.6313\n"
-                                   "vn -0.3936 0.8308 -0.3936\n"
-                                   "vn -0.6534 -0.3821 -0.6534\n"
-                                   "vn -0.4492 0.7723 -0.4492\n"
-                                   "vn -0.6239 -0.4708 -0.6239\n"
-                                   "vn -0.5005 0.7063 -0.5005\n"
-                                   "vn -0.5883 -0.5549 -0.5883\n"
-                                   "vn -0.5470 0.6336 -0.5470\n"
-                                   "vn -0.5470 -0.6336 -0.5470\n"
-                                   "vn -0.5883 0.5549 -0.5883\n"
-                                   "vn -0.5005 -0.7063 -0.5005\n"
-                                   "vn -0.6239 0.4708 -0.6239\n"
-                                   "vn -0.4492 -0.7723 -0.4492\n"
-                                   "vn -0.6534 0.3821 -0.6534\n"
-                                   "vn -0.3936 -0.8308 -0.3936\n"
-                                   "vn -0.6767 0.2899 -0.6767\n"
-                                   "vn -0.3342 -0.8813 -0.3342\n"
-                                   "vn -0.6936 0.1948 -0.6936\n"
-                                   "vn -0.0704 0.9950 -0.0704\n"
-                                   "vn -0.2715 -0.9233 -0.2715\n"
-                                   "vn -0.7037 0.0979 -0.7037\n"
-                                   "vn -0.1390 0.9805 -0.1390\n"
-                                   "vn -0.2063 -0.9565 -0.2063\n"
-                                   "vn -0.7071 -0.0000 -0.7071\n"
-                                   "vn -0.2063 0.9565 -0.2063\n"
-                                   "vn -0.1390 -0.9805 -0.1390\n"
-                                   "vn -0.7037 -0.0979 -0.7037\n"
-                                   "vn -0.2715 0.9233 -0.2715\n"
-                                   "vn -0.0704 -0.9950 -0.0704\n"
-                                   "vn -0.6936 -0.1948 -0.6936\n"
-                                   "vn -0.3342 0.8813 -0.3342\n"
-                                   "vn -0.6768 -0.2899 -0.6768\n"
-                                   "vn -0.4030 0.7723 -0.4911\n"
-                                   "vn -0.4491 0.7063 -0.5472\n"
-                                   "vn -0.5278 -0.5549 -0.6431\n"
-                                   "vn -0.4908 0.6336 -0.5980\n"
-                                   "vn -0.4908 -0.6336 -0.5980\n"
-                                   "vn -0.5278 0.5549 -0.6431\n"
-                                   "vn -0.4491 -0.7063 -0.5472\n"
-                                   "vn -0.5597 0.4708 -0.6820\n"
-                                   "vn -0.4030 -0.7723 -0.4911\n"
-                                   "vn -0.5862 0.3821 -0.7143\n"
-                                   "vn -0.3531 -0.8308 -0.4303\n"
-                                   "vn -0.6072 0.2899 -0.7398\n"
-                                   "vn -0.2998 -0.8813 -0.3653\n"
-                                   "vn -0.6222 0.1948 -0.7582\n"
-                                   "vn -0.0631 0.9950 -0.0769\n"
-                                   "vn -0.2436 -0.9233 -0.2968\n"
-                                   "vn -0.6313 0.0979 -0.7693\n"
-                                   "vn -0.1247 0.9805 -0.1519\n"
-                                   "vn -0.1850 -0.9565 -0.2255\n"
-                                   "vn -0.6344 -0.0000 -0.7730\n"
-                                   "vn -0.1850 0.9565 -0.2255\n"
-                                   "vn -0.1247 -0.9805 -0.1519\n"
-                                   "vn -0.6313 -0.0979 -0.7693\n"
-                                   "vn -0.2436 0.9233 -0.2968\n"
-                                   "vn -0.0631 -0.9950 -0.0769\n"
-                                   "vn -0.6222 -0.1948 -0.7582\n"
-                                   "vn -0.2998 0.8813 -0.3653\n"
-                                   "vn -0.6072 -0.2899 -0.7398\n"
-                                   "vn -0.3531 0.8308 -0.4303\n"
-                                   "vn -0.5862 -0.3821 -0.7143\n"
-                                   "vn -0.5597 -0.4708 -0.6820\n"
-                                   "vn -0.4622 0.5549 -0.6917\n"
-                                   "vn -0.4298 -0.6336 -0.6432\n"
-                                   "vn -0.3933 -0.7063 -0.5886\n"
-                                   "vn -0.4902 0.4708 -0.7336\n"
-                                   "vn -0.3530 -0.7723 -0.5282\n"
-                                   "vn -0.5134 0.3821 -0.7684\n"
-                                   "vn -0.3092 -0.8308 -0.4628\n"
-                                   "vn -0.5317 0.2899 -0.7958\n"
-                                   "vn -0.2626 -0.8813 -0.3929\n"
-                                   "vn -0.5449 0.1948 -0.8155\n"
-                                   "vn -0.0553 0.9950 -0.0828\n"
-                                   "vn -0.2133 -0.9233 -0.3193\n"
-                                   "vn -0.5529 0.0979 -0.8275\n"
-                                   "vn -0.1092 0.9805 -0.1634\n"
-                                   "vn -0.1621 -0.9565 -0.2425\n"
-                                   "vn -0.5556 -0.0000 -0.8315\n"
-                                   "vn -0.1621 0.9565 -0.2425\n"
-                                   "vn -0.1092 -0.9805 -0.1634\n"
-                                   "vn -0.5529 -0.0979 -0.8275\n"
-                                   "vn -0.2133 0.9233 -0.3193\n"
-                                   "vn -0.0553 -0.9950 -0.0828\n"
-                                   "vn -0.5449 -0.1948 -0.8155\n"
-                                   "vn -0.2626 0.8813 -0.3929\n"
-                                   "vn -0.5317 -0.2899 -0.7958\n"
-                                   "vn -0.3092 0.8308 -0.4628\n"
-                                   "vn -0.5134 -0.3821 -0.7684\n"
-                                   "vn -0.3530 0.7723 -0.5282\n"
-                                   "vn -0.4902 -0.4708 -0.7336\n"
-                                   "vn -0.3933 0.7063 -0.5886\n"
-                                   "vn -0.4622 -0.5549 -0.6917\n"
-                                   "vn -0.4298 0.6336 -0.6432\n"
-                                   "vn -0.4356 0.3821 -0.8150\n"
-                                   "vn -0.2624 -0.8308 -0.4909\n"
-                                   "vn -0.4512 0.2899 -0.8441\n"
-                                   "vn -0.2228 -0.8813 -0.4168\n"
-                                   "vn -0.4624 0.1948 -0.8650\n"
-                                   "vn -0.0469 0.9950 -0.0878\n"
-                                   "vn -0.1810 -0.9233 -0.3386\n"
-                                   "vn -0.4691 0.0979 -0.8777\n"
-                                   "vn -0.0927 0.9805 -0.1734\n"
-                                   "vn -0.1375 -0.9565 -0.2572\n"
-                                   "vn -0.4714 -0.0000 -0.8819\n"
-                                   "vn -0.1375 0.9565 -0.2572\n"
-                                   "vn -0.0927 -0.9805 -0.1734\n"
-                                   "vn -0.4691 -0.0979 -0.8777\n"
-                                   "vn -0.1810 0.9233 -0.3386\n"
-                                   "vn -0.0469 -0.9950 -0.0878\n"
-                                   "vn -0.4624 -0.1948 -0.8650\n"
-                                   "vn -0.2228 0.8813 -0.4168\n"
-                                   "vn -0.4512 -0.2899 -0.8441\n"
-                                   "vn -0.2624 0.8308 -0.4909\n"
-                                   "vn -0.4356 -0.3821 -0.8150\n"
-                                   "vn -0.2995 0.7723 -0.5603\n"
-                                   "vn -0.4159 -0.4708 -0.7781\n"
-                                   "vn -0.3337 0.7063 -0.6243\n"
-                                   "vn -0.3922 -0.5549 -0.7337\n"
-                                   "vn -0.3647 0.6336 -0.6823\n"
-                                   "vn -0.3647 -0.6336 -0.6823\n"
-                                   "vn -0.3922 0.5549 -0.7337\n"
-                                   "vn -0.3337 -0.7063 -0.6243\n"
-                                   "vn -0.4159 0.4708 -0.7781\n"
-                                   "vn -0.2995 -0.7723 -0.5603\n"
-                                   "vn -0.3754 0.1948 -0.9062\n"
-                                   "vn -0.0381 0.9950 -0.0920\n"
-                                   "vn -0.1469 -0.9233 -0.3548\n"
-                                   "vn -0.3808 0.0979 -0.9194\n"
-                                   "vn -0.0752 0.9805 -0.1816\n"
-                                   "vn -0.1116 -0.9565 -0.2695\n"
-                                   "vn -0.3827 -0.0000 -0.9239\n"
-                                   "vn -0.1116 0.9565 -0.2695\n"
-                                   "vn -0.0752 -0.9805 -0.1816\n"
-                                   "vn -0.3808 -0.0979 -0.9194\n"
-                                   "vn -0.1469 0.9233 -0.3548\n"
-                                   "vn -0.0381 -0.9950 -0.0920\n"
-                                   "vn -0.3754 -0.1948 -0.9062\n"
-                                   "vn -0.1809 0.8813 -0.4366\n"
-                                   "vn -0.3663 -0.2899 -0.8842\n"
-                                   "vn -0.2130 0.8308 -0.5143\n"
-                                   "vn -0.3536 -0.3821 -0.8538\n"
-                                   "vn -0.2431 0.7723 -0.5869\n"
-                                   "vn -0.3376 -0.4708 -0.8151\n"
-                                   "vn -0.2709 0.7063 -0.6540\n"
-                                   "vn -0.3184 -0.5549 -0.7686\n"
-                                   "vn -0.2961 0.6336 -0.7147\n"
-                                   "vn -0.2961 -0.6336 -0.7147\n"
-                                   "vn -0.3184 0.5549 -0.7686\n"
-                                   "vn -0.2709 -0.7063 -0.6540\n"
-                                   "vn -0.3376 0.4708 -0.8151\n"
-                                   "vn -0.2431 -0.7723 -0.5869\n"
-                                   "vn -0.3536 0.3821 -0.8538\n"
-                                   "vn -0.2130 -0.8308 -0.5143\n"
-                                   "vn -0.3663 0.2899 -0.8842\n"
-                                   "vn -0.1809 -0.8813 -0.4366\n"
-                                   "vn -0.2889 0.0979 -0.9523\n"
-                                   "vn -0.2903 -0.0000 -0.9569\n"
-                                   "vn -0.0847 0.9565 -0.2791\n"
-                                   "vn -0.0571 -0.9805 -0.1881\n"
-                                   "vn -0.2889 -0.0979 -0.9523\n"
-                                   "vn -0.1115 0.9233 -0.3675\n"
-                                   "vn -0.0289 -0.9950 -0.0952\n"
-                                   "vn -0.2847 -0.1948 -0.9386\n"
-                                   "vn -0.1372 0.8813 -0.4522\n"
-                                   "vn -0.2778 -0.2899 -0.9159\n"
-                                   "vn -0.1616 0.8308 -0.5327\n"
-                                   "vn -0.2683 -0.3821 -0.8843\n"
-                                   "vn -0.1844 0.7723 -0.6080\n"
-                                   "vn -0.2561 -0.4708 -0.8443\n"
-                                   "vn -0.2055 0.7063 -0.6774\n"
-                                   "vn -0.2415 -0.5549 -0.7961\n"
-                                   "vn -0.2246 0.6336 -0.7403\n"
-                                   "vn -0.2246 -0.6336 -0.7403\n"
-                                   "vn -0.2415 0.5549 -0.7961\n"
-                                   "vn -0.2055 -0.7063 -0.6774\n"
-                                   "vn -0.2561 0.4708 -0.8443\n"
-                                   "vn -0.1844 -0.7723 -0.6080\n"
-                                   "vn -0.2683 0.3821 -0.8843\n"
-                                   "vn -0.1616 -0.8308 -0.5327\n"
-                                   "vn -0.2778 0.2899 -0.9159\n"
-                                   "vn -0.1372 -0.8813 -0.4522\n"
-                                   "vn -0.2847 0.1948 -0.9386\n"
-                                   "vn -0.0289 0.9950 -0.0952\n"
-                                   "vn -0.1115 -0.9233 -0.3675\n"
-                                   "vn -0.0571 0.9805 -0.1881\n"
-                                   "vn -0.0847 -0.9565 -0.2791\n"
-                                   "vn -0.1914 -0.1948 -0.9620\n"
-                                   "vn -0.0922 0.8813 -0.4635\n"
-                                   "vn -0.0194 -0.9950 -0.0976\n"
-                                   "vn -0.1867 -0.2899 -0.9387\n"
-                                   "vn -0.1086 0.8308 -0.5459\n"
-                                   "vn -0.1803 -0.3821 -0.9063\n"
-                                   "vn -0.1239 0.7723 -0.6231\n"
-                                   "vn -0.1721 -0.4708 -0.8653\n"
-                                   "vn -0.1381 0.7063 -0.6943\n"
-                                   "vn -0.1623 -0.5549 -0.8160\n"
-                                   "vn -0.1509 0.6336 -0.7588\n"
-                                   "vn -0.1509 -0.6336 -0.7588\n"
-                                   "vn -0.1623 0.5549 -0.8160\n"
-                                   "vn -0.1381 -0.7063 -0.6943\n"
-                                   "vn -0.1721 0.4708 -0.8653\n"
-                                   "vn -0.1239 -0.7723 -0.6231\n"
-                                   "vn -0.1803 0.3821 -0.9063\n"
-                                   "vn -0.1086 -0.8308 -0.5459\n"
-                                   "vn -0.1867 0.2899 -0.9387\n"
-                                   "vn -0.0922 -0.8813 -0.4635\n"
-                                   "vn -0.1914 0.1948 -0.9620\n"
-                                   "vn -0.0194 0.9950 -0.0976\n"
-                                   "vn -0.0749 -0.9233 -0.3766\n"
-                                   "vn -0.1942 0.0979 -0.9761\n"
-                                   "vn -0.0383 0.9805 -0.1928\n"
-                                   "vn -0.0569 -0.9565 -0.2861\n"
-                                   "vn -0.1951 -0.0000 -0.9808\n"
-                                   "vn -0.0569 0.9565 -0.2861\n"
-                                   "vn -0.0383 -0.9805 -0.1928\n"
-                                   "vn -0.1942 -0.0979 -0.9761\n"
-                                   "vn -0.0749 0.9233 -0.3766\n"
-                                   "vn -0.0906 -0.3821 -0.9197\n"
-                                   "vn -0.0546 0.8308 -0.5539\n"
-                                   "vn -0.0623 0.7723 -0.6322\n"
-                                   "vn -0.0865 -0.4708 -0.8780\n"
-                                   "vn -0.0694 0.7063 -0.7045\n"
-                                   "vn -0.0815 -0.5549 -0.8279\n"
-                                   "vn -0.0758 0.6336 -0.7699\n"
-                                   "vn -0.0758 -0.6336 -0.7699\n"
-                                   "vn -0.0815 0.5549 -0.8279\n"
-                                   "vn -0.0694 -0.7063 -0.7045\n"
-                                   "vn -0.0865 0.4708 -0.8780\n"
-                                   "vn -0.0623 -0.7723 -0.6322\n"
-                                   "vn -0.0906 0.3821 -0.9197\n"
-                                   "vn -0.0546 -0.8308 -0.5539\n"
-                                   "vn -0.0938 0.2899 -0.9525\n"
-                                   "vn -0.0463 -0.8813 -0.4703\n"
-                                   "vn -0.0961 0.1948 -0.9761\n"
-                                   "vn -0.0098 0.9950 -0.0991\n"
-                                   "vn -0.0376 -0.9233 -0.3821\n"
-                                   "vn -0.0975 0.0979 -0.9904\n"
-                                   "vn -0.0193 0.9805 -0.1956\n"
-                                   "vn -0.0286 -0.9565 -0.2903\n"
-                                   "vn -0.0980 -0.0000 -0.9952\n"
-                                   "vn -0.0286 0.9565 -0.2903\n"
-                                   "vn -0.0193 -0.9805 -0.1956\n"
-                                   "vn -0.0975 -0.0979 -0.9904\n"
-                                   "vn -0.0376 0.9233 -0.3821\n"
-                                   "vn -0.0098 -0.9950 -0.0991\n"
-                                   "vn -0.0961 -0.1948 -0.9761\n"
-                                   "vn -0.0463 0.8813 -0.4703\n"
-                                   "vn -0.0938 -0.2899 -0.9525\n"
-                                   "s 1\n"
-                                   "f 1137/1/1 20/2/2 51/3/3\n"
-                                   "f 13/4/4 39/5/5 14/6/6\n"
-                                   "f 1978/7/7 25/8/8 26/9/9\n"
-                                   "f 14/6/6 40/10/10 15/11/11\n"
-                                   "f 1978/7/7 27/12/12 4/13/13\n"
-                                   "f 16/14/14 40/10/10 41/15/15\n"
-                                   "f 4/13/13 28/16/16 5/17/17\n"
-                                   "f 16/14/14 42/18/18 1981/19/19\n"
-                                   "f 5/17/17 29/20/20 6/21/21\n"
-                                   "f 1981/19/19 43/22/22 1982/23/23\n"
-                                   "f 6/21/21 30/24/24 1979/25/25\n"
-                                   "f 1982/23/23 44/26/26 17/27/27\n"
-                                   "f 1979/25/25 31/28/28 7/29/29\n"
-                                   "f 18/30/30 44/26/26 45/31/31\n"
-                                   "f 1980/32/32 31/28/28 32/33/33\n"
-                                   "f 1983/34/34 45/31/31 46/35/35\n"
-                                   "f 8/36/36 32/33/33 33/37/37\n"
-                                   "f 19/38/38 46/35/35 47/39/39\n"
-                                   "f 8/36/36 34/40/40 9/41/41\n"
-                                   "f 1/42/42 1448/43/43 21/44/44\n"
-                                   "f 19/38/38 48/45/45 1984/46/46\n"
-                                   "f 9/41/41 35/47/47 10/48/48\n"
-                                   "f 1/42/42 22/49/49 1976/50/50\n"
-                                   "f 1984/46/46 49/51/51 1985/52/52\n"
-                                   "f 10/48/48 36/53/53 11/54/54\n"
-                                   "f 1976/50/50 23/55/55 2/56/56\n"
-                                   "f 1985/52/52 50/57/57 1986/58/58\n"
-                                   "f 11/54/54 37/59/59 12/60/60\n"
-                                   "f 2/56/56 24/61/61 3/62/62\n"
-                                   "f 1986/58/58 51/3/3 20/2/2\n"
-                                   "f 12/60/60 38/63/63 13/4/4\n"
-                                   "f 1977/64/64 24/61/61 25/8/8\n"
-                                   "f 46/35/35 78/65/65 47/39/39\n"
-                                   "f 34/40/40 64/66/66 65/67/67\n"
-                                   "f 21/44/44 1448/68/43 52/69/68\n"
-                                   "f 48/45/45 78/65/65 79/70/69\n"
-                                   "f 34/40/40 66/71/70 35/47/47\n"
-                                   "f 21/44/44 53/72/71 22/49/49\n"
-                                   "f 49/51/51 79/70/69 80/73/72\n"
-                                   "f 35/47/47 67/74/73 36/53/53\n"
-                                   "f 22/49/49 54/75/74 23/55/55\n"
-                                   "f 50/57/57 80/73/72 81/76/75\n"
-                                   "f 36/53/53 68/77/76 37/59/59\n"
-                                   "f 23/55/55 55/78/77 24/61/61\n"
-                                   "f 50/57/57 82/79/78 51/3/3\n"
-                                   "f 37/59/59 69/80/79 38/63/63\n"
-                                   "f 24/61/61 56/81/80 25/8/8\n"
-                                   "f 1137/82/1 51/3/3 82/79/78\n"
-                                   "f 38/63/63 70/83/81 39/5/5\n"
-                                   "f 25/8/8 57/84/82 26/9/9\n"
-                                   "f 39/5/5 71/85/83 40/10/10\n"
-                                   "f 26/9/9 58/86/84 27/12/12\n"
-                                   "f 40/10/10 72/87/85 41/15/15\n"
-                                   "f 27/12/12 59/88/86 28/16/16\n"
-                                   "f 42/18/18 72/87/85 73/89/87\n"
-                                   "f 29/20/20 59/88/86 60/90/88\n"
-                                   "f 43/22/22 73/89/87 74/91/89\n"
-                                   "f 29/20/20 61/92/90 30/24/24\n"
-                                   "f 44/26/26 74/91/89 75/93/91\n"
-                                   "f 30/24/24 62/94/92 31/28/28\n"
-                                   "f 45/31/31 75/93/91 76/95/93\n"
-                                   "f 31/28/28 63/96/94 32/33/33\n"
-                                   "f 45/31/31 77/97/95 46/35/35\n"
-                                   "f 32/33/33 64/66/66 33/37/37\n"
-                                   "f 52/69/68 84/98/96 53/72/71\n"
-                                   "f 79/70/69 111/99/97 80/73/72\n"
-                                   "f 67/74/73 97/100/98 98/101/99\n"
-                                   "f 53/72/71 85/102/100 54/75/74\n"
-                                   "f 80/73/72 112/103/101 81/76/75\n"
-                                   "f 68/77/76 98/101/99 99/104/102\n"
-                                   "f 54/75/74 86/105/103 55/78/77\n"
-                                   "f 82/79/78 112/103/101 113/106/104\n"
-                                   "f 68/77/76 100/107/105 69/80/79\n"
-                                   "f 55/78/77 87/108/106 56/81/80\n"
-                                   "f 1137/109/1 82/79/78 113/106/104\n"
-                                   "f 69/80/79 101/110/107 70/83/81\n"
-                                   "f 56/81/80 88/111/108 57/84/82\n"
-                                   "f 71/85/83 101/110/107 102/112/109\n"
-                                   "f 58/86/84 88/111/108 89/113/110\n"
-                                   "f 72/87/85 102/112/109 103/114/111\n"
-                                   "f 59/88/86 89/113/110 90/115/112\n"
-                                   "f 73/89/87 103/114/111 104/116/113\n"
-                                   "f 59/88/86 91/117/114 60/90/88\n"
-                                   "f 74/91/89 104/116/113 105/118/115\n"
-                                   "f 61/92/90 91/117/114 92/119/116\n"
-                                   "f 74/91/89 106/120/117 75/93/91\n"
-                                   "f 61/92/90 93/121/118 62/94/92\n"
-                                   "f 75/93/91 107/122/119 76/95/93\n"
-                                   "f 63/96/94 93/121/118 94/123/120\n"
-                                   "f 76/95/93 108/124/121 77/97/95\n"
-                                   "f 64/66/66 94/123/120 95/125/122\n"
-                                   "f 77/97/95 109/126/123 78/65/65\n"
-                                   "f 64/66/66 96/127/124 65/67/67\n"
-                                   "f 52/69/68 1448/128/43 83/129/125\n"
-                                   "f 79/70/69 109/126/123 110/130/126\n"
-                                   "f 65/67/67 97/100/98 66/71/70\n"
-                                   "f 85/102/100 117/131/127 86/105/103\n"
-                                   "f 112/103/101 144/132/128 113/106/104\n"
-                                   "f 100/107/105 130/133/129 131/134/130\n"
-                                   "f 86/105/103 118/135/131 87/108/106\n"
-                                   "f 1137/136/1 113/106/104 144/132/128\n"
-                                   "f 100/107/105 132/137/132 101/110/107\n"
-                                   "f 87/108/106 119/138/133 88/111/108\n"
-                                   "f 101/110/107 133/139/134 102/112/109\n"
-                                   "f 88/111/108 120/140/135 89/113/110\n"
-                                   "f 103/114/111 133/139/134 134/141/136\n"
-                                   "f 89/113/110 121/142/137 90/115/112\n"
-                                   "f 103/114/111 135/143/138 104/116/113\n"
-                                   "f 90/115/112 122/144/139 91/117/114\n"
-                                   "f 104/116/113 136/145/140 105/118/115\n"
-                                   "f 92/119/116 122/144/139 123/146/141\n"
-                                   "f 106/120/117 136/145/140 137/147/142\n"
-                                   "f 92/119/116 124/148/143 93/121/118\n"
-                                   "f 106/120/117 138/149/144 107/122/119\n"
-                                   "f 93/121/118 125/150/145 94/123/120\n"
-                                   "f 108/124/121 138/149/144 139/151/146\n"
-                                   "f 95/125/122 125/150/145 126/152/147\n"
-                                   "f 108/124/121 140/153/148 109/126/123\n"
-                                   "f 95/125/122 127/154/149 96/127/124\n"
-                                   "f 83/129/125 1448/155/43 114/156/150\n"
-                                   "f 109/126/123 141/157/151 110/130/126\n"
-                                   "f 97/100/98 127/154/149 128/158/152\n"
-                                   "f 84/98/96 114/156/150 115/159/153\n"
-                                   "f 110/130/126 142/160/154 111/99/97\n"
-                                   "f 97/100/98 129/161/155 98/101/99\n"
-                                   "f 85/102/100 115/159/153 116/162/156\n"
-                                   "f 111/99/97 143/163/157 112/103/101\n"
-                                   "f 98/101/99 130/133/129 99/104/102\n"
-                                   "f 118/135/131 150/164/158 119/138/133\n"
-                                   "f 133/139/134 163/165/159 164/166/160\n"
-                                   "f 120/140/135 150/164/158 151/167/161\n"
-                                   "f 134/141/136 164/166/160 165/168/162\n"
-                                   "f 121/142/137 151/167/161 152/169/163\n"
-                                   "f 135/143/138 165/168/162 166/170/164\n"
-                                   "f 121/142/137 153/171/165 122/144/139\n"
-                                   "f 135/143/138 167/172/166 136/145/140\n"
-                                   "f 122/144/139 154/173/167 123/146/141\n"
-                                   "f 137/147/142 167/172/166 168/174/168\n"
-                                   "f 123/146/141 155/175/169 124/148/143\n"
-                                   "f 137/147/142 169/176/170 138/149/144\n"
-                                   "f 124/148/143 156/177/171 125/150/145\n"
-                                   "f 138/149/144 170/178/172 139/151/146\n"
-                                   "f 125/150/145 157/179/173 126/152/147\n"
-                                   "f 140/153/148 170/178/172 171/180/174\n"
-                                   "f 126/152/147 158/181/175 127/154/149\n"
-                                   "f 114/156/150 1448/182/43 145/183/176\n"
-                                   "f 141/157/151 171/180/174 172/184/177\n"
-                                   "f 128/158/152 158/181/175 159/185/178\n"
-                                   "f 114/156/150 146/186/179 115/159/153\n"
-                                   "f 141/157/151 173/187/180 142/160/154\n"
-                                   "f 128/158/152 160/188/181 129/161/155\n"
-                                   "f 116/162/156 146/186/179 147/189/182\n"
-                                   "f 142/160/154 174/190/183 143/163/157\n"
-                                   "f 129/161/155 161/191/184 130/133/129\n"
-                                   "f 116/162/156 148/192/185 117/131/127\n"
-                                   "f 144/132/128 174/190/183 175/193/186\n"
-                                   "f 130/133/129 162/194/187 131/134/130\n"
-                                   "f 117/131/127 149/195/188 118/135/131\n"
-                                   "f 1137/196/1 144/132/128 175/193/186\n"
-                                   "f 131/134/130 163/165/159 132/137/132\n"
-                                   "f 152/169/163 182/197/189 183/198/190\n"
-                                   "f 166/170/164 196/199/191 197/200/192\n"
-                                   "f 152/169/163 184/201/193 153/171/165\n"
-                                   "f 167/172/166 197/200/192 198/202/194\n"
-                                   "f 154/173/167 184/201/193 185/203/195\n"
-                                   "f 168/174/168 198/202/194 199/204/196\n"
-                                   "f 154/173/167 186/205/197 155/175/169\n"
-                                   "f 168/174/168 200/206/198 169/176/170\n"
-                                   "f 155/175/169 187/207/199 156/177/171\n"
-                                   "f 169/176/170 201/208/200 170/178/172\n"
-                                   "f 157/179/173 187/207/199 188/209/201\n"
-                                   "f 171/180/174 201/208/200 202/210/202\n"
-                                   "f 157/179/173 189/211/203 158/181/175\n"
-                                   "f 145/183/176 1448/212/43 176/213/204\n"
-                                   "f 172/184/177 202/210/202 203/214/205\n"
-                                   "f 158/181/175 190/215/206 159/185/178\n"
-                                   "f 145/183/176 177/216/207 146/186/179\n"
-                                   "f 172/184/177 204/217/208 173/187/180\n"
-                                   "f 159/185/178 191/218/209 160/188/181\n"
-                                   "f 147/189/182 177/216/207 178/219/210\n"
-                                   "f 173/187/180 205/220/211 174/190/183\n"
-                                   "f 161/191/184 191/218/209 192/221/212\n"
-                                   "f 147/189/182 179/222/213 148/192/185\n"
-                                   "f 174/190/183 206/223/214 175/193/186\n"
-                                   "f 162/194/187 192/221/212 193/224/215\n"
-                                   "f 148/192/185 180/225/216 149/195/188\n"
-                                   "f 1137/226/1 175/193/186 206/223/214\n"
-                                   "f 162/194/187 194/227/217 163/165/159\n"
-                                   "f 149/195/188 181/228/218 150/164/158\n"
-                                   "f 163/165/159 195/229/219 164/166/160\n"
-                                   "f 150/164/158 182/197/189 151/167/161\n"
-                                   "f 165/168/162 195/229/219 196/199/191\n"
-                                   "f 185/203/195 215/230/220 216/231/221\n"
-                                   "f 199/204/196 229/232/222 230/233/223\n"
-                                   "f 185/203/195 217/234/224 186/205/197\n"
-                                   "f 199/204/196 231/235/225 200/206/198\n"
-                                   "f 186/205/197 218/236/226 187/207/199\n"
-                                   "f 200/206/198 232/237/227 201/208/200\n"
-                                   "f 187/207/199 219/238/228 188/209/201\n"
-                                   "f 202/210/202 232/237/227 233/239/229\n"
-                                   "f 188/209/201 220/240/230 189/211/203\n"
-                                   "f 176/213/204 1448/241/43 207/242/231\n"
-                                   "f 202/210/202 234/243/232 203/214/205\n"
-                                   "f 189/211/203 221/244/233 190/215/206\n"
-                                   "f 176/213/204 208/245/234 177/216/207\n"
-                                   "f 204/217/208 234/243/232 235/246/235\n"
-                                   "f 191/218/209 221/244/233 222/247/236\n"
-                                   "f 178/219/210 208/245/234 209/248/237\n"
-                                   "f 204/217/208 236/249/238 205/220/211\n"
-                                   "f 191/218/209 223/250/239 192/221/212\n"
-                                   "f 178/219/210 210/251/240 179/222/213\n"
-                                   "f 205/220/211 237/252/241 206/223/214\n"
-                                   "f 193/224/215 223/250/239 224/253/242\n"
-                                   "f 179/222/213 211/254/243 180/225/216\n"
-                                   "f 1137/255/1 206/223/214 237/252/241\n"
-                                   "f 193/224/215 225/256/244 194/227/217\n"
-                                   "f 181/228/218 211/254/243 212/257/245\n"
-                                   "f 194/227/217 226/258/246 195/229/219\n"
-                                   "f 181/228/218 213/259/247 182/197/189\n"
-                                   "f 195/229/219 227/260/248 196/199/191\n"
-                                   "f 183/198/190 213/259/247 214/261/249\n"
-                                   "f 196/199/191 228/262/250 197/200/192\n"
-                                   "f 183/198/190 215/230/220 184/201/193\n"
-                                   "f 197/200/192 229/232/222 198/202/194\n"
-                                   "f 218/236/226 248/263/251 249/264/252\n"
-                                   "f 232/237/227 262/265/253 263/266/254\n"
-                                   "f 218/236/226 250/267/255 219/238/228\n"
-                                   "f 233/239/229 263/266/254 264/268/256\n"
-                                   "f 219/238/228 251/269/257 220/240/230\n"
-                                   "f 207/242/231 1448/270/43 238/271/258\n"
-                                   "f 234/243/232 264/268/256 265/272/259\n"
-                                   "f 220/240/230 252/273/260 221/244/233\n"
-                                   "f 207/242/231 239/274/261 208/245/234\n"
-                                   "f 235/246/235 265/272/259 266/275/262\n"
-                                   "f 222/247/236 252/273/260 253/276/263\n"
-                                   "f 208/245/234 240/277/264 209/248/237\n"
-                                   "f 235/246/235 267/278/265 236/249/238\n"
-                                   "f 222/247/236 254/279/266 223/250/239\n"
-                                   "f 209/248/237 241/280/267 210/251/240\n"
-                                   "f 236/249/238 268/281/268 237/252/241\n"
-                                   "f 224/253/242 254/279/266 255/282/269\n"
-                                   "f 210/251/240 242/283/270 211/254/243\n"
-                                   "f 1137/284/1 237/252/241 268/281/268\n"
-                                   "f 225/256/244 255/282/269 256/285/271\n"
-                                   "f 211/254/243 243/286/272 212/257/245\n"
-                                   "f 226/258/246 256/285/271 257/287/273\n"
-                                   "f 213/259/247 243/286/272 244/288/274\n"
-                                   "f 226/258/246 258/289/275 227/260/248\n"
-                                   "f 214/261/249 244/288/274 245/290/276\n"
-                                   "f 228/262/250 258/289/275 259/291/277\n"
-                                   "f 214/261/249 246/292/278 215/230/220\n"
-                                   "f 229/232/222 259/291/277 260/293/279\n"
-                                   "f 216/231/221 246/292/278 247/294/280\n"
-                                   "f 230/233/223 260/293/279 261/295/281\n"
-                                   "f 216/231/221 248/263/251 217/234/224\n"
-                                   "f 230/233/223 262/265/253 231/235/225\n"
-                                   "f 250/267/255 282/296/282 251/269/257\n"
-                                   "f 238/271/258 1448/297/43 269/298/283\n"
-                                   "f 265/272/259 295/299/284 296/300/285\n"
-                                   "f 251/269/257 283/301/286 252/273/260\n"
-                                   "f 238/271/258 270/302/287 239/274/261\n"
-                                   "f 266/275/262 296/300/285 297/303/288\n"
-                                   "f 253/276/263 283/301/286 284/304/289\n"
-                                   "f 240/277/264 270/302/287 271/305/290\n"
-                                   "f 266/275/262 298/306/291 267/278/265\n"
-                                   "f 253/276/263 285/307/292 254/279/266\n"
-                                   "f 240/277/264 272/308/293 241/280/267\n"
-                                   "f 267/278/265 299/309/294 268/281/268\n"
-                                   "f 255/282/269 285/307/292 286/310/295\n"
-                                   "f 242/283/270 272/308/293 273/311/296\n"
-                                   "f 1137/312/1 268/281/268 299/309/294\n"
-                                   "f 256/285/271 286/310/295 287/313/297\n"
-                                   "f 242/283/270 274/314/298 243/286/272\n"
-                                   "f 257/287/273 287/313/297 288/315/299\n"
-                                   "f 244/288/274 274/314/298 275/316/300\n"
-                                   "f 257/287/273 289/317/301 258/289/275\n"
-                                   "f 245/290/276 275/316/300 276/318/302\n"
-                                   "f 259/291/277 289/317/301 290/319/303\n"
-                                   "f 245/290/276 277/320/304 246/292/278\n"
-                                   "f 259/291/277 291/321/305 260/293/279\n"
-                                   "f 247/294/280 277/320/304 278/322/306\n"
-                                   "f 261/295/281 291/321/305 292/323/307\n"
-                                   "f 247/294/280 279/324/308 248/263/251\n"
-                                   "f 261/295/281 293/325/309 262/265/253\n"
-                                   "f 249/264/252 279/324/308 280/326/310\n"
-                                   "f 262/265/253 294/327/311 263/266/254\n"
-                                   "f 249/264/252 281/328/312 250/267/255\n"
-                                   "f 264/268/256 294/327/311 295/299/284\n"
-                                   "f 284/304/289 314/329/313 315/330/314\n"
-                                   "f 271/305/290 301/331/315 302/332/316\n"
-                                   "f 297/303/288 329/333/317 298/306/291\n"
-                                   "f 284/304/289 316/334/318 285/307/292\n"
-                                   "f 271/305/290 303/335/319 272/308/293\n"
-                                   "f 299/309/294 329/333/317 330/336/320\n"
-                                   "f 285/307/292 317/337/321 286/310/295\n"
-                                   "f 272/308/293 304/338/322 273/311/296\n"
-                                   "f 1137/339/1 299/309/294 330/336/320\n"
-                                   "f 287/313/297 317/337/321 318/340/323\n"
-                                   "f 273/311/296 305/341/324 274/314/298\n"
-                                   "f 288/315/299 318/340/323 319/342/325\n"
-                                   "f 275/316/300 305/341/324 306/343/326\n"
-                                   "f 288/315/299 320/344/327 289/317/301\n"
-                                   "f 276/318/302 306/343/326 307/345/328\n"
-                                   "f 289/317/301 321/346/329 290/319/303\n"
-                                   "f 276/318/302 308/347/330 277/320/304\n"
-                                   "f 290/319/303 322/348/331 291/321/305\n"
-                                   "f 278/322/306 308/347/330 309/349/332\n"
-                                   "f 292/323/307 322/348/331 323/350/333\n"
-                                   "f 278/322/306 310/351/334 279/324/308\n"
-                                   "f 292/323/307 324/352/335 293/325/309\n"
-                                   "f 280/326/310 310/351/334 311/353/336\n"
-                                   "f 293/325/309 325/354/337 294/327/311\n"
-                                   "f 280/326/310 312/355/338 281/328/312\n"
-                                   "f 295/299/284 325/354/337 326/356/339\n"
-                                   "f 281/328/312 313/357/340 282/296/282\n"
-                                   "f 269/298/283 1448/358/43 300/359/341\n"
-                                   "f 296/300/285 326/356/339 327/360/342\n"
-                                   "f 283/301/286 313/357/340 314/329/313\n"
-                                   "f 269/298/283 301/331/315 270/302/287\n"
-                                   "f 297/303/288 327/360/342 328/361/343\n"
-                                   "f 316/334/318 348/362/344 317/337/321\n"
-                                   "f 304/338/322 334/363/345 335/364/346\n"
-                                   "f 1137/365/1 330/336/320 361/366/347\n"
-                                   "f 318/340/323 348/362/344 349/367/348\n"
-                                   "f 304/338/322 336/368/349 305/341/324\n"
-                                   "f 319/342/325 349/367/348 350/369/350\n"
-                                   "f 306/343/326 336/368/349 337/370/351\n"
-                                   "f 319/342/325 351/371/352 320/344/327\n"
-                                   "f 307/345/328 337/370/351 338/372/353\n"
-                                   "f 321/346/329 351/371/352 352/373/354\n"
-                                   "f 307/345/328 339/374/355 308/347/330\n"
-                                   "f 321/346/329 353/375/356 322/348/331\n"
-                                   "f 309/349/332 339/374/355 340/376/357\n"
-                                   "f 323/350/333 353/375/356 354/377/358\n"
-                                   "f 309/349/332 341/378/359 310/351/334\n"
-                                   "f 323/350/333 355/379/360 324/352/335\n"
-                                   "f 311/353/336 341/378/359 342/380/361\n"
-                                   "f 324/352/335 356/381/362 325/354/337\n"
-                                   "f 311/353/336 343/382/363 312/355/338\n"
-                                   "f 326/356/339 356/381/362 357/383/364\n"
-                                   "f 312/355/338 344/384/365 313/357/340\n"
-                                   "f 300/359/341 1448/385/43 331/386/366\n"
-                                   "f 326/356/339 358/387/367 327/360/342\n"
-                                   "f 314/329/313 344/384/365 345/388/368\n"
-                                   "f 300/359/341 332/389/369 301/331/315\n"
-                                   "f 328/361/343 358/387/367 359/390/370\n"
-                                   "f 315/330/314 345/388/368 346/391/371\n"
-                                   "f 302/332/316 332/389/369 333/392/372\n"
-                                   "f 328/361/343 360/393/373 329/333/317\n"
-                                   "f 315/330/314 347/394/374 316/334/318\n"
-                                   "f 302/332/316 334/363/345 303/335/319\n"
-                                   "f 329/333/317 361/366/347 330/336/320\n"
-                                   "f 350/369/350 380/395/375 381/396/376\n"
-                                   "f 337/370/351 367/397/377 368/398/378\n"
-                                   "f 350/369/350 382/399/379 351/371/352\n"
-                                   "f 338/372/353 368/398/378 369/400/380\n"
-                                   "f 351/371/352 383/401/381 352/373/354\n"
-                                   "f 338/372/353 370/402/382 339/374/355\n"
-                                   "f 352/373/354 384/403/383 353/375/356\n"
-                                   "f 340/376/357 370/402/382 371/404/384\n"
-                                   "f 354/377/358 384/403/383 385/405/385\n"
-                                   "f 340/376/357 372/406/386 341/378/359\n"
-                                   "f 354/377/358 386/407/387 355/379/360\n"
-                                   "f 342/380/361 372/406/386 373/408/388\n"
-                                   "f 355/379/360 387/409/389 356/381/362\n"
-                                   "f 342/380/361 374/410/390 343/382/363\n"
-                                   "f 357/383/364 387/409/389 388/411/391\n"
-                                   "f 344/384/365 374/410/390 375/412/392\n"
-                                   "f 331/386/366 1448/413/43 362/414/393\n"
-                                   "f 357/383/364 389/415/394 358/387/367\n"
-                                   "f 345/388/368 375/412/392 376/416/395\n"
-                                   "f 331/386/366 363/417/396 332/389/369\n"
-                                   "f 359/390/370 389/415/394 390/418/397\n"
-                                   "f 345/388/368 377/419/398 346/391/371\n"
-                                   "f 333/392/372 363/417/396 364/420/399\n"
-                                   "f 359/390/370 391/421/400 360/393/373\n"
-                                   "f 347/394/374 377/419/398 378/422/401\n"
-                                   "f 333/392/372 365/423/402 334/363/345\n"
-                                   "f 360/393/373 392/424/403 361/366/347\n"
-                                   "f 347/394/374 379/425/404 348/362/344\n"
-                                   "f 334/363/345 366/426/405 335/364/346\n"
-                                   "f 1137/427/1 361/366/347 392/424/403\n"
-                                   "f 349/367/348 379/425/404 380/395/375\n"
-                                   "f 335/364/346 367/397/377 336/368/349\n"
-                                   "f 382/399/379 414/428/406 383/401/381\n"
-                                   "f 369/400/380 401/429/407 370/402/382\n"
-                                   "f 383/401/381 415/430/408 384/403/383\n"
-                                   "f 371/404/384 401/429/407 402/431/409\n"
-                                   "f 385/405/385 415/430/408 416/432/410\n"
-                                   "f 371/404/384 403/433/411 372/406/386\n"
-                                   "f 385/405/385 417/434/412 386/407/387\n"
-                                   "f 373/408/388 403/433/411 404/435/413\n"
-                                   "f 386/407/387 418/436/414 387/409/389\n"
-                                   "f 373/408/388 405/437/415 374/410/390\n"
-                                   "f 388/411/391 418/436/414 419/438/416\n"
-                                   "f 375/412/392 405/437/415 406/439/417\n"
-                                   "f 362/414/393 1448/440/43 393/441/418\n"
-                                   "f 389/415/394 419/438/416 420/442/419\n"
-                                   "f 376/416/395 406/439/417 407/443/420\n"
-                                   "f 362/414/393 394/444/421 363/417/396\n"
-                                   "f 390/418/397 420/442/419 421/445/422\n"
-                                   "f 376/416/395 408/446/423 377/419/398\n"
-                                   "f 364/420/399 394/444/421 395/447/424\n"
-                                   "f 390/418/397 422/448/425 391/421/400\n"
-                                   "f 378/422/401 408/446/423 409/449/426\n"
-                                   "f 364/420/399 396/450/427 365/423/402\n"
-                                   "f 391/421/400 423/451/428 392/424/403\n"
-                                   "f 378/422/401 410/452/429 379/425/404\n"
-                                   "f 365/423/402 397/453/430 366/426/405\n"
-                                   "f 1137/454/1 392/424/403 423/451/428\n"
-                                   "f 380/395/375 410/452/429 411/455/431\n"
-                                   "f 366/426/405 398/456/432 367/397/377\n"
-                                   "f 381/396/376 411/455/431 412/457/433\n"
-                                   "f 368/398/378 398/456/432 399/458/434\n"
-                                   "f 381/396/376 413/459/435 382/399/379\n"
-                                   "f 368/398/378 400/460/436 369/400/380\n"
-                                   "f 416/432/410 446/461/437 447/462/438\n"
-                                   "f 402/431/409 434/463/439 403/433/411\n"
-                                   "f 416/432/410 448/464/440 417/434/412\n"
-                                   "f 404/435/413 434/463/439 435/465/441\n"
-                                   "f 417/434/412 449/466/442 418/436/414\n"
-                                   "f 404/435/413 436/467/443 405/437/415\n"
-                                   "f 419/438/416 449/466/442 450/468/444\n"
-                                   "f 406/439/417 436/467/443 437/469/445\n"
-                                   "f 393/441/418 1448/470/43 424/471/446\n"
-                                   "f 420/442/419 450/468/444 451/472/447\n"
-                                   "f 407/443/420 437/469/445 438/473/448\n"
-                                   "f 393/441/418 425/474/449 394/444/421\n"
-                                   "f 421/445/422 451/472/447 452/475/450\n"
-                                   "f 407/443/420 439/476/451 408/446/423\n"
-                                   "f 395/447/424 425/474/449 426/477/452\n"
-                                   "f 421/445/422 453/478/453 422/448/425\n"
-                                   "f 409/449/426 439/476/451 440/479/454\n"
-                                   "f 395/447/424 427/480/455 396/450/427\n"
-                                   "f 422/448/425 454/481/456 423/451/428\n"
-                                   "f 409/449/426 441/482/457 410/452/429\n"
-                                   "f 397/453/430 427/480/455 428/483/458\n"
-                                   "f 1137/484/1 423/451/428 454/481/456\n"
-                                   "f 411/455/431 441/482/457 442/485/459\n"
-                                   "f 397/453/430 429/486/460 398/456/432\n"
-                                   "f 412/457/433 442/485/459 443/487/461\n"
-                                   "f 399/458/434 429/486/460 430/488/462\n"
-                                   "f 412/457/433 444/489/463 413/459/435\n"
-                                   "f 400/460/436 430/488/462 431/490/464\n"
-                                   "f 413/459/435 445/491/465 414/428/406\n"
-                                   "f 400/460/436 432/492/466 401/429/407\n"
-                                   "f 415/430/408 445/491/465 446/461/437\n"
-                                   "f 401/429/407 433/493/467 402/431/409\n"
-                                   "f 448/464/440 480/494/468 449/466/442\n"
-                                   "f 435/465/441 467/495/469 436/467/443\n"
-                                   "f 450/468/444 480/494/468 481/496/470\n"
-                                   "f 437/469/445 467/495/469 468/497/471\n"
-                                   "f 424/471/446 1448/498/43 455/499/472\n"
-                                   "f 451/472/447 481/496/470 482/500/473\n"
-                                   "f 438/473/448 468/497/471 469/501/474\n"
-                                   "f 424/471/446 456/502/475 425/474/449\n"
-                                   "f 452/475/450 482/500/473 483/503/476\n"
-                                   "f 438/473/448 470/504/477 439/476/451\n"
-                                   "f 425/474/449 457/505/478 426/477/452\n"
-                                   "f 452/475/450 484/506/479 453/478/453\n"
-                                   "f 440/479/454 470/504/477 471/507/480\n"
-                                   "f 426/477/452 458/508/481 427/480/455\n"
-                                   "f 453/478/453 485/509/482 454/481/456\n"
-                                   "f 440/479/454 472/510/483 441/482/457\n"
-                                   "f 427/480/455 459/511/484 428/483/458\n"
-                                   "f 1137/512/1 454/481/456 485/509/482\n"
-                                   "f 441/482/457 473/513/485 442/485/459\n"
-                                   "f 428/483/458 460/514/486 429/486/460\n"
-                                   "f 442/485/459 474/515/487 443/487/461\n"
-                                   "f 430/488/462 460/514/486 461/516/488\n"
-                                   "f 444/489/463 474/515/487 475/517/489\n"
-                                   "f 431/490/464 461/516/488 462/518/490\n"
-                                   "f 444/489/463 476/519/491 445/491/465\n"
-                                   "f 431/490/464 463/520/492 432/492/466\n"
-                                   "f 445/491/465 477/521/493 446/461/437\n"
-                                   "f 433/493/467 463/520/492 464/522/494\n"
-                                   "f 447/462/438 477/521/493 478/523/495\n"
-                                   "f 433/493/467 465/524/496 434/463/439\n"
-                                   "f 447/462/438 479/525/497 448/464/440\n"
-                                   "f 435/465/441 465/524/496 466/526/498\n"
-                                   "f 482/500/473 512/527/499 513/528/500\n"
-                                   "f 469/501/474 499/529/501 500/530/502\n"
-                                   "f 456/502/475 486/531/503 487/532/504\n"
-                                   "f 483/503/476 513/528/500 514/533/505\n"
-                                   "f 469/501/474 501/534/506 470/504/477\n"
-                                   "f 457/505/478 487/532/504 488/535/507\n"
-                                   "f 483/503/476 515/536/508 484/506/479\n"
-                                   "f 471/507/480 501/534/506 502/537/509\n"
-                                   "f 457/505/478 489/538/510 458/508/481\n"
-                                   "f 484/506/479 516/539/511 485/509/482\n"
-                                   "f 471/507/480 503/540/512 472/510/483\n"
-                                   "f 458/508/481 490/541/513 459/511/484\n"
-                                   "f 1137/542/1 485/509/482 516/539/511\n"
-                                   "f 472/510/483 504/543/514 473/513/485\n"
-                                   "f 459/511/484 491/544/515 460/514/486\n"
-                                   "f 474/515/487 504/543/514 505/545/516\n"
-                                   "f 460/514/486 492/546/517 461/516/488\n"
-                                   "f 475/517/489 505/545/516 506/547/518\n"
-                                   "f 462/518/490 492/546/517 493/548/519\n"
-                                   "f 475/517/489 507/549/520 476/519/491\n"
-                                   "f 462/518/490 494/550/521 463/520/492\n"
-                                   "f 477/521/493 507/549/520 508/551/522\n"
-                                   "f 464/522/494 494/550/521 495/552/523\n"
-                                   "f 478/523/495 508/551/522 509/553/524\n"
-                                   "f 464/522/494 496/554/525 465/524/496\n"
-                                   "f 478/523/495 510/555/526 479/525/497\n"
-                                   "f 466/526/498 496/554/525 497/556/527\n"
-                                   "f 479/525/497 511/557/528 480/494/468\n"
-                                   "f 466/526/498 498/558/529 467/495/469\n"
-                                   "f 481/496/470 511/557/528 512/527/499\n"
-                                   "f 468/497/471 498/558/529 499/529/501\n"
-                                   "f 455/499/472 1448/559/43 486/531/503\n"
-                                   "f 514/533/505 546/560/530 515/536/508\n"
-                                   "f 502/537/509 532/561/531 533/562/532\n"
-                                   "f 488/535/507 520/563/533 489/538/510\n"
-                                   "f 515/536/508 547/564/534 516/539/511\n"
-                                   "f 502/537/509 534/565/535 503/540/512\n"
-                                   "f 490/541/513 520/563/533 521/566/536\n"
-                                   "f 1137/567/1 516/539/511 547/564/534\n"
-                                   "f 503/540/512 535/568/537 504/543/514\n"
-                                   "f 490/541/513 522/569/538 491/544/515\n"
-                                   "f 504/543/514 536/570/539 505/545/516\n"
-                                   "f 492/546/517 522/569/538 523/571/540\n"
-                                   "f 505/545/516 537/572/541 506/547/518\n"
-                                   "f 493/548/519 523/571/540 524/573/542\n"
-                                   "f 506/547/518 538/574/543 507/549/520\n"
-                                   "f 493/548/519 525/575/544 494/550/521\n"
-                                   "f 508/551/522 538/574/543 539/576/545\n"
-                                   "f 495/552/523 525/575/544 526/577/546\n"
-                                   "f 509/553/524 539/576/545 540/578/547\n"
-                                   "f 495/552/523 527/579/548 496/554/525\n"
-                                   "f 509/553/524 541/580/549 510/555/526\n"
-                                   "f 497/556/527 527/579/548 528/581/550\n"
-                                   "f 510/555/526 542/582/551 511/557/528\n"
-                                   "f 497/556/527 529/583/552 498/558/529\n"
-                                   "f 512/527/499 542/582/551 543/584/553\n"
-                                   "f 499/529/501 529/583/552 530/585/554\n"
-                                   "f 486/531/503 1448/586/43 517/587/555\n"
-                                   "f 512/527/499 544/588/556 513/528/500\n"
-                                   "f 500/530/502 530/585/554 531/589/557\n"
-                                   "f 487/532/504 517/587/555 518/590/558\n"
-                                   "f 513/528/500 545/591/559 514/533/505\n"
-                                   "f 500/530/502 532/561/531 501/534/506\n"
-                                   "f 488/535/507 518/590/558 519/592/560\n"
-                                   "f 1137/593/1 547/564/534 578/594/561\n"
-                                   "f 534/565/535 566/595/562 535/568/537\n"
-                                   "f 521/566/536 553/596/563 522/569/538\n"
-                                   "f 536/570/539 566/595/562 567/597/564\n"
-                                   "f 523/571/540 553/596/563 554/598/565\n"
-                                   "f 536/570/539 568/599/566 537/572/541\n"
-                                   "f 523/571/540 555/600/567 524/573/542\n"
-                                   "f 537/572/541 569/601/568 538/574/543\n"
-                                   "f 524/573/542 556/602/569 525/575/544\n"
-                                   "f 538/574/543 570/603/570 539/576/545\n"
-                                   "f 526/577/546 556/602/569 557/604/571\n"
-                                   "f 540/578/547 570/603/570 571/605/572\n"
-                                   "f 526/577/546 558/606/573 527/579/548\n"
-                                   "f 540/578/547 572/607/574 541/580/549\n"
-                                   "f 528/581/550 558/606/573 559/608/575\n"
-                                   "f 541/580/549 573/609/576 542/582/551\n"
-                                   "f 528/581/550 560/610/577 529/583/552\n"
-                                   "f 543/584/553 573/609/576 574/611/578\n"
-                                   "f 530/585/554 560/610/577 561/612/579\n"
-                                   "f 517/587/555 1448/613/43 548/614/580\n"
-                                   "f 544/588/556 574/611/578 575/615/581\n"
-                                   "f 531/589/557 561/612/579 562/616/582\n"
-                                   "f 517/587/555 549/617/583 518/590/558\n"
-                                   "f 545/591/559 575/615/581 576/618/584\n"
-                                   "f 531/589/557 563/619/585 532/561/531\n"
-                                   "f 518/590/558 550/620/586 519/592/560\n"
-                                   "f 546/560/530 576/618/584 577/621/587\n"
-                                   "f 533/562/532 563/619/585 564/622/588\n"
-                                   "f 519/592/560 551/623/589 520/563/533\n"
-                                   "f 547/564/534 577/621/587 578/594/561\n"
-                                   "f 533/562/532 565/624/590 534/565/535\n"
-                                   "f 520/563/533 552/625/591 521/566/536\n"
-                                   "f 568/599/566 598/626/592 599/627/593\n"
-                                   "f 555/600/567 585/628/594 586/629/595\n"
-                                   "f 568/599/566 600/630/596 569/601/568\n"
-                                   "f 555/600/567 587/631/597 556/602/569\n"
-                                   "f 569/601/568 601/632/598 570/603/570\n"
-                                   "f 557/604/571 587/631/597 588/633/599\n"
-                                   "f 571/605/572 601/632/598 602/634/600\n"
-                                   "f 557/604/571 589/635/601 558/606/573\n"
-                                   "f 571/605/572 603/636/602 572/607/574\n"
-                                   "f 559/608/575 589/635/601 590/637/603\n"
-                                   "f 572/607/574 604/638/604 573/609/576\n"
-                                   "f 559/608/575 591/639/605 560/610/577\n"
-                                   "f 574/611/578 604/638/604 605/640/606\n"
-                                   "f 561/612/579 591/639/605 592/641/607\n"
-                                   "f 548/614/580 1448/642/43 579/643/608\n"
-                                   "f 575/615/581 605/640/606 606/644/609\n"
-                                   "f 562/616/582 592/641/607 593/645/610\n"
-                                   "f 549/617/583 579/643/608 580/646/611\n"
-                                   "f 576/618/584 606/644/609 607/647/612\n"
-                                   "f 562/616/582 594/648/613 563/619/585\n"
-                                   "f 550/620/586 580/646/611 581/649/614\n"
-                                   "f 576/618/584 608/650/615 577/621/587\n"
-                                   "f 564/622/588 594/648/613 595/651/616\n"
-                                   "f 550/620/586 582/652/617 551/623/589\n"
-                                   "f 577/621/587 609/653/618 578/594/561\n"
-                                   "f 564/622/588 596/654/619 565/624/590\n"
-                                   "f 552/625/591 582/652/617 583/655/620\n"
-                                   "f 1137/656/1 578/594/561 609/653/618\n"
-                                   "f 565/624/590 597/657/621 566/595/562\n"
-                                   "f 552/625/591 584/658/622 553/596/563\n"
-                                   "f 567/597/564 597/657/621 598/626/592\n"
-                                   "f 554/598/565 584/658/622 585/628/594\n"
-                                   "f 600/630/596 632/659/623 601/632/598\n"
-                                   "f 587/631/597 619/660/624 588/633/599\n"
-                                   "f 602/634/600 632/659/623 633/661/625\n"
-                                   "f 588/633/599 620/662/626 589/635/601\n"
-                                   "f 602/634/600 634/663/627 603/636/602\n"
-                                   "f 590/637/603 620/662/626 621/664/628\n"
-                                   "f 603/636/602 635/665/629 604/638/604\n"
-                                   "f 590/637/603 622/666/630 591/639/605\n"
-                                   "f 605/640/606 635/665/629 636/667/631\n"
-                                   "f 592/641/607 622/666/630 623/668/632\n"
-                                   "f 579/643/608 1448/669/43 610/670/633\n"
-                                   "f 605/640/606 637/671/634 606/644/609\n"
-                                   "f 593/645/610 623/668/632 624/672/635\n"
-                                   "f 579/643/608 611/673/636 580/646/611\n"
-                                   "f 606/644/609 638/674/637 607/647/612\n"
-                                   "f 593/645/610 625/675/638 594/648/613\n"
-                                   "f 581/649/614 611/673/636 612/676/639\n"
-                                   "f 607/647/612 639/677/640 608/650/615\n"
-                                   "f 595/651/616 625/675/638 626/678/641\n"
-                                   "f 581/649/614 613/679/642 582/652/617\n"
-                                   "f 608/650/615 640/680/643 609/653/618\n"
-                                   "f 595/651/616 627/681/644 596/654/619\n"
-                                   "f 582/652/617 614/682/645 583/655/620\n"
-                                   "f 1137/683/1 609/653/618 640/680/643\n"
-                                   "f 596/654/619 628/684/646 597/657/621\n"
-                                   "f 583/655/620 615/685/647 584/658/622\n"
-                                   "f 597/657/621 629/686/648 598/626/592\n"
-                                   "f 585/628/594 615/685/647 616/687/649\n"
-                                   "f 599/627/593 629/686/648 630/688/650\n"
-                                   "f 586/629/595 616/687/649 617/689/651\n"
-                                   "f 599/627/593 631/690/652 600/630/596\n"
-                                   "f 586/629/595 618/691/653 587/631/597\n"
-                                   "f 633/661/625 665/692/654 634/663/627\n"
-                                   "f 621/664/628 651/693/655 652/694/656\n"
-                                   "f 634/663/627 666/695/657 635/665/629\n"
-                                   "f 621/664/628 653/696/658 622/666/630\n"
-                                   "f 636/667/631 666/695/657 667/697/659\n"
-                                   "f 623/668/632 653/696/658 654/698/660\n"
-                                   "f 610/670/633 1448/699/43 641/700/661\n"
-                                   "f 636/667/631 668/701/662 637/671/634\n"
-                                   "f 624/672/635 654/698/660 655/702/663\n"
-                                   "f 610/670/633 642/703/664 611/673/636\n"
-                                   "f 638/674/637 668/701/662 669/704/665\n"
-                                   "f 624/672/635 656/705/666 625/675/638\n"
-                                   "f 612/676/639 642/703/664 643/706/667\n"
-                                   "f 638/674/637 670/707/668 639/677/640\n"
-                                   "f 626/678/641 656/705/666 657/708/669\n"
-                                   "f 612/676/639 644/709/670 613/679/642\n"
-                                   "f 640/680/643 670/707/668 671/710/671\n"
-                                   "f 626/678/641 658/711/672 627/681/644\n"
-                                   "f 613/679/642 645/712/673 614/682/645\n"
-                                   "f 1137/713/1 640/680/643 671/710/671\n"
-                                   "f 627/681/644 659/714/674 628/684/646\n"
-                                   "f 614/682/645 646/715/675 615/685/647\n"
-                                   "f 628/684/646 660/716/676 629/686/648\n"
-                                   "f 616/687/649 646/715/675 647/717/677\n"
-                                   "f 630/688/650 660/716/676 661/718/678\n"
-                                   "f 617/689/651 647/717/677 648/719/679\n"
-                                   "f 630/688/650 662/720/680 631/690/652\n"
-                                   "f 617/689/651 649/721/681 618/691/653\n"
-                                   "f 631/690/652 663/722/682 632/659/623\n"
-                                   "f 619/660/624 649/721/681 650/723/683\n"
-                                   "f 633/661/625 663/722/682 664/724/684\n"
-                                   "f 619/660/624 651/693/655 620/662/626\n"
-                                   "f 667/697/659 697/725/685 698/726/686\n"
-                                   "f 653/696/658 685/727/687 654/698/660\n"
-                                   "f 641/700/661 1448/728/43 672/729/688\n"
-                                   "f 668/701/662 698/726/686 699/730/689\n"
-                                   "f 655/702/663 685/727/687 686/731/690\n"
-                                   "f 642/703/664 672/729/688 673/732/691\n"
-                                   "f 669/704/665 699/730/689 700/733/692\n"
-                                   "f 655/702/663 687/734/693 656/705/666\n"
-                                   "f 643/706/667 673/732/691 674/735/694\n"
-                                   "f 669/704/665 701/736/695 670/707/668\n"
-                                   "f 657/708/669 687/734/693 688/737/696\n"
-                                   "f 643/706/667 675/738/697 644/709/670\n"
-                                   "f 670/707/668 702/739/698 671/710/671\n"
-                                   "f 657/708/669 689/740/699 658/711/672\n"
-                                   "f 644/709/670 676/741/700 645/712/673\n"
-                                   "f 1137/742/1 671/710/671 702/739/698\n"
-                                   "f 659/714/674 689/740/699 690/743/701\n"
-                                   "f 645/712/673 677/744/702 646/715/675\n"
-                                   "f 659/714/674 691/745/703 660/716/676\n"
-                                   "f 647/717/677 677/744/702 678/746/704\n"
-                                   "f 661/718/678 691/745/703 692/747/705\n"
-                                   "f 648/719/679 678/746/704 679/748/706\n"
-                                   "f 661/718/678 693/749/707 662/720/680\n"
-                                   "f 648/719/679 680/750/708 649/721/681\n"
-                                   "f 663/722/682 693/749/707 694/751/709\n"
-                                   "f 650/723/683 680/750/708 681/752/710\n"
-                                   "f 664/724/684 694/751/709 695/753/711\n"
-                                   "f 650/723/683 682/754/712 651/693/655\n"
-                                   "f 664/724/684 696/755/713 665/692/654\n"
-                                   "f 652/694/656 682/754/712 683/756/714\n"
-                                   "f 665/692/654 697/725/685 666/695/657\n"
-                                   "f 652/694/656 684/757/715 653/696/658\n"
-                                   "f 672/729/688 704/758/716 673/732/691\n"
-                                   "f 700/733/692 730/759/717 731/760/718\n"
-                                   "f 687/734/693 717/761/719 718/762/720\n"
-                                   "f 674/735/694 704/758/716 705/763/721\n"
-                                   "f 700/733/692 732/764/722 701/736/695\n"
-                                   "f 687/734/693 719/765/723 688/737/696\n"
-                                   "f 674/735/694 706/766/724 675/738/697\n"
-                                   "f 701/736/695 733/767/725 702/739/698\n"
-                                   "f 688/737/696 720/768/726 689/740/699\n"
-                                   "f 675/738/697 707/769/727 676/741/700\n"
-                                   "f 1137/770/1 702/739/698 733/767/725\n"
-                                   "f 690/743/701 720/768/726 721/771/728\n"
-                                   "f 676/741/700 708/772/729 677/744/702\n"
-                                   "f 690/743/701 722/773/730 691/745/703\n"
-                                   "f 678/746/704 708/772/729 709/774/731\n"
-                                   "f 691/745/703 723/775/732 692/747/705\n"
-                                   "f 679/748/706 709/774/731 710/776/733\n"
-                                   "f 692/747/705 724/777/734 693/749/707\n"
-                                   "f 679/748/706 711/778/735 680/750/708\n"
-                                   "f 694/751/709 724/777/734 725/779/736\n"
-                                   "f 681/752/710 711/778/735 712/780/737\n"
-                                   "f 695/753/711 725/779/736 726/781/738\n"
-                                   "f 681/752/710 713/782/739 682/754/712\n"
-                                   "f 695/753/711 727/783/740 696/755/713\n"
-                                   "f 683/756/714 713/782/739 714/784/741\n"
-                                   "f 696/755/713 728/785/742 697/725/685\n"
-                                   "f 683/756/714 715/786/743 684/757/715\n"
-                                   "f 698/726/686 728/785/742 729/787/744\n"
-                                   "f 684/757/715 716/788/745 685/727/687\n"
-                                   "f 672/729/688 1448/789/43 703/790/746\n"
-                                   "f 698/726/686 730/759/717 699/730/689\n"
-                                   "f 686/731/690 716/788/745 717/761/719\n"
-                                   "f 705/763/721 737/791/747 706/766/724\n"
-                                   "f 732/764/722 764/792/748 733/767/725\n"
-                                   "f 719/765/723 751/793/749 720/768/726\n"
-                                   "f 706/766/724 738/794/750 707/769/727\n"
-                                   "f 1137/795/1 733/767/725 764/792/748\n"
-                                   "f 721/771/728 751/793/749 752/796/751\n"
-                                   "f 707/769/727 739/797/752 708/772/729\n"
-                                   "f 722/773/730 752/796/751 753/798/753\n"
-                                   "f 709/774/731 739/797/752 740/799/754\n"
-                                   "f 722/773/730 754/800/755 723/775/732\n"
-                                   "f 710/776/733 740/799/754 741/801/756\n"
-                                   "f 723/775/732 755/802/757 724/777/734\n"
-                                   "f 710/776/733 742/803/758 711/778/735\n"
-                                   "f 725/779/736 755/802/757 756/804/759\n"
-                                   "f 712/780/737 742/803/758 743/805/760\n"
-                                   "f 726/781/738 756/804/759 757/806/761\n"
-                                   "f 712/780/737 744/807/762 713/782/739\n"
-                                   "f 726/781/738 758/808/763 727/783/740\n"
-                                   "f 714/784/741 744/807/762 745/809/764\n"
-                                   "f 727/783/740 759/810/765 728/785/742\n"
-                                   "f 714/784/741 746/811/766 715/786/743\n"
-                                   "f 729/787/744 759/810/765 760/812/767\n"
-                                   "f 716/788/745 746/811/766 747/813/768\n"
-                                   "f 703/790/746 1448/814/43 734/815/769\n"
-                                   "f 729/787/744 761/816/770 730/759/717\n"
-                                   "f 717/761/719 747/813/768 748/817/771\n"
-                                   "f 703/790/746 735/818/772 704/758/716\n"
-                                   "f 731/760/718 761/816/770 762/819/773\n"
-                                   "f 718/762/720 748/817/771 749/820/774\n"
-                                   "f 705/763/721 735/818/772 736/821/775\n"
-                                   "f 731/760/718 763/822/776 732/764/722\n"
-                                   "f 718/762/720 750/823/777 719/765/723\n"
-                                   "f 738/794/750 770/824/778 739/797/752\n"
-                                   "f 753/798/753 783/825/779 784/826/780\n"
-                                   "f 740/799/754 770/824/778 771/827/781\n"
-                                   "f 753/798/753 785/828/782 754/800/755\n"
-                                   "f 741/801/756 771/827/781 772/829/783\n"
-                                   "f 754/800/755 786/830/784 755/802/757\n"
-                                   "f 741/801/756 773/831/785 742/803/758\n"
-                                   "f 756/804/759 786/830/784 787/832/786\n"
-                                   "f 743/805/760 773/831/785 774/833/787\n"
-                                   "f 757/806/761 787/832/786 788/834/788\n"
-                                   "f 743/805/760 775/835/789 744/807/762\n"
-                                   "f 757/806/761 789/836/790 758/808/763\n"
-                                   "f 745/809/764 775/835/789 776/837/791\n"
-                                   "f 758/808/763 790/838/792 759/810/765\n"
-                                   "f 745/809/764 777/839/793 746/811/766\n"
-                                   "f 760/812/767 790/838/792 791/840/794\n"
-                                   "f 747/813/768 777/839/793 778/841/795\n"
-                                   "f 734/815/769 1448/842/43 765/843/796\n"
-                                   "f 760/812/767 792/844/797 761/816/770\n"
-                                   "f 748/817/771 778/841/795 779/845/798\n"
-                                   "f 734/815/769 766/846/799 735/818/772\n"
-                                   "f 762/819/773 792/844/797 793/847/800\n"
-                                   "f 749/820/774 779/845/798 780/848/801\n"
-                                   "f 736/821/775 766/846/799 767/849/802\n"
-                                   "f 762/819/773 794/850/803 763/822/776\n"
-                                   "f 749/820/774 781/851/804 750/823/777\n"
-                                   "f 736/821/775 768/852/805 737/791/747\n"
-                                   "f 764/792/748 794/850/803 795/853/806\n"
-                                   "f 750/823/777 782/854/807 751/793/749\n"
-                                   "f 737/791/747 769/855/808 738/794/750\n"
-                                   "f 1137/856/1 764/792/748 795/853/806\n"
-                                   "f 752/796/751 782/854/807 783/825/779\n"
-                                   "f 772/829/783 802/857/809 803/858/810\n"
-                                   "f 785/828/782 817/859/811 786/830/784\n"
-                                   "f 772/829/783 804/860/812 773/831/785\n"
-                                   "f 787/832/786 817/859/811 818/861/813\n"
-                                   "f 774/833/787 804/860/812 805/862/814\n"
-                                   "f 788/834/788 818/861/813 819/863/815\n"
-                                   "f 774/833/787 806/864/816 775/835/789\n"
-                                   "f 788/834/788 820/865/817 789/836/790\n"
-                                   "f 776/837/791 806/864/816 807/866/818\n"
-                                   "f 789/836/790 821/867/819 790/838/792\n"
-                                   "f 776/837/791 808/868/820 777/839/793\n"
-                                   "f 791/840/794 821/867/819 822/869/821\n"
-                                   "f 777/839/793 809/870/822 778/841/795\n"
-                                   "f 765/843/796 1448/871/43 796/872/823\n"
-                                   "f 791/840/794 823/873/824 792/844/797\n"
-                                   "f 779/845/798 809/870/822 810/874/825\n"
-                                   "f 766/846/799 796/872/823 797/875/826\n"
-                                   "f 793/847/800 823/873/824 824/876/827\n"
-                                   "f 780/848/801 810/874/825 811/877/828\n"
-                                   "f 766/846/799 798/878/829 767/849/802\n"
-                                   "f 793/847/800 825/879/830 794/850/803\n"
-                                   "f 780/848/801 812/880/831 781/851/804\n"
-                                   "f 767/849/802 799/881/832 768/852/805\n"
-                                   "f 795/853/806 825/879/830 826/882/833\n"
-                                   "f 781/851/804 813/883/834 782/854/807\n"
-                                   "f 768/852/805 800/884/835 769/855/808\n"
-                                   "f 1137/885/1 795/853/806 826/882/833\n"
-                                   "f 783/825/779 813/883/834 814/886/836\n"
-                                   "f 769/855/808 801/887/837 770/824/778\n"
-                                   "f 784/826/780 814/886/836 815/888/838\n"
-                                   "f 771/827/781 801/887/837 802/857/809\n"
-                                   "f 784/826/780 816/889/839 785/828/782\n"
-                                   "f 811/877/828 841/890/840 842/891/841\n"
-                                   "f 798/878/829 828/892/842 829/893/843\n"
-                                   "f 824/876/827 856/894/844 825/879/830\n"
-                                   "f 811/877/828 843/895/845 812/880/831\n"
-                                   "f 798/878/829 830/896/846 799/881/832\n"
-                                   "f 826/882/833 856/894/844 857/897/847\n"
-                                   "f 812/880/831 844/898/848 813/883/834\n"
-                                   "f 799/881/832 831/899/849 800/884/835\n"
-                                   "f 1137/900/1 826/882/833 857/897/847\n"
-                                   "f 814/886/836 844/898/848 845/901/850\n"
-                                   "f 800/884/835 832/902/851 801/887/837\n"
-                                   "f 815/888/838 845/901/850 846/903/852\n"
-                                   "f 802/857/809 832/902/851 833/904/853\n"
-                                   "f 815/888/838 847/905/854 816/889/839\n"
-                                   "f 803/858/810 833/904/853 834/906/855\n"
-                                   "f 816/889/839 848/907/856 817/859/811\n"
-                                   "f 803/858/810 835/908/857 804/860/812\n"
-                                   "f 818/861/813 848/907/856 849/909/858\n"
-                                   "f 804/860/812 836/910/859 805/862/814\n"
-                                   "f 819/863/815 849/909/858 850/911/860\n"
-                                   "f 805/862/814 837/912/861 806/864/816\n"
-                                   "f 819/863/815 851/913/862 820/865/817\n"
-                                   "f 807/866/818 837/912/861 838/914/863\n"
-                                   "f 820/865/817 852/915/864 821/867/819\n"
-                                   "f 807/866/818 839/916/865 808/868/820\n"
-                                   "f 822/869/821 852/915/864 853/917/866\n"
-                                   "f 808/868/820 840/918/867 809/870/822\n"
-                                   "f 796/872/823 1448/919/43 827/920/868\n"
-                                   "f 822/869/821 854/921/869 823/873/824\n"
-                                   "f 810/874/825 840/918/867 841/890/840\n"
-                                   "f 796/872/823 828/892/842 797/875/826\n"
-                                   "f 824/876/827 854/921/869 855/922/870\n"
-                                   "f 843/895/845 875/923/871 844/898/848\n"
-                                   "f 831/899/849 861/924/872 862/925/873\n"
-                                   "f 1137/926/1 857/897/847 888/927/874\n"
-                                   "f 845/901/850 875/923/871 876/928/875\n"
-                                   "f 831/899/849 863/929/876 832/902/851\n"
-                                   "f 846/903/852 876/928/875 877/930/877\n"
-                                   "f 833/904/853 863/929/876 864/931/878\n"
-                                   "f 846/903/852 878/932/879 847/905/854\n"
-                                   "f 834/906/855 864/931/878 865/933/880\n"
-                                   "f 847/905/854 879/934/881 848/907/856\n"
-                                   "f 834/906/855 866/935/882 835/908/857\n"
-                                   "f 849/909/858 879/934/881 880/936/883\n"
-                                   "f 836/910/859 866/935/882 867/937/884\n"
-                                   "f 850/911/860 880/936/883 881/938/885\n"
-                                   "f 836/910/859 868/939/886 837/912/861\n"
-                                   "f 850/911/860 882/940/887 851/913/862\n"
-                                   "f 838/914/863 868/939/886 869/941/888\n"
-                                   "f 851/913/862 883/942/889 852/915/864\n"
-                                   "f 838/914/863 870/943/890 839/916/865\n"
-                                   "f 853/917/866 883/942/889 884/944/891\n"
-                                   "f 839/916/865 871/945/892 840/918/867\n"
-                                   "f 827/920/868 1448/946/43 858/947/893\n"
-                                   "f 853/917/866 885/948/894 854/921/869\n"
-                                   "f 841/890/840 871/945/892 872/949/895\n"
-                                   "f 827/920/868 859/950/896 828/892/842\n"
-                                   "f 855/922/870 885/948/894 886/951/897\n"
-                                   "f 842/891/841 872/949/895 873/952/898\n"
-                                   "f 829/893/843 859/950/896 860/953/899\n"
-                                   "f 855/922/870 887/954/900 856/894/844\n"
-                                   "f 842/891/841 874/955/901 843/895/845\n"
-                                   "f 829/893/843 861/924/872 830/896/846\n"
-                                   "f 857/897/847 887/954/900 888/927/874\n"
-                                   "f 877/930/877 907/956/902 908/957/903\n"
-                                   "f 864/931/878 894/958/904 895/959/905\n"
-                                   "f 877/930/877 909/960/906 878/932/879\n"
-                                   "f 865/933/880 895/959/905 896/961/907\n"
-                                   "f 878/932/879 910/962/908 879/934/881\n"
-                                   "f 865/933/880 897/963/909 866/935/882\n"
-                                   "f 880/936/883 910/962/908 911/964/910\n"
-                                   "f 867/937/884 897/963/909 898/965/911\n"
-                                   "f 881/938/885 911/964/910 912/966/912\n"
-                                   "f 867/937/884 899/967/913 868/939/886\n"
-                                   "f 881/938/885 913/968/914 882/940/887\n"
-                                   "f 869/941/888 899/967/913 900/969/915\n"
-                                   "f 882/940/887 914/970/916 883/942/889\n"
-                                   "f 869/941/888 901/971/917 870/943/890\n"
-                                   "f 884/944/891 914/970/916 915/972/918\n"
-                                   "f 870/943/890 902/973/919 871/945/892\n"
-                                   "f 858/947/893 1448/974/43 889/975/920\n"
-                                   "f 884/944/891 916/976/921 885/948/894\n"
-                                   "f 872/949/895 902/973/919 903/977/922\n"
-                                   "f 858/947/893 890/978/923 859/950/896\n"
-                                   "f 886/951/897 916/976/921 917/979/924\n"
-                                   "f 873/952/898 903/977/922 904/980/925\n"
-                                   "f 860/953/899 890/978/923 891/981/926\n"
-                                   "f 886/951/897 918/982/927 887/954/900\n"
-                                   "f 873/952/898 905/983/928 874/955/901\n"
-                                   "f 861/924/872 891/981/926 892/984/929\n"
-                                   "f 887/954/900 919/985/930 888/927/874\n"
-                                   "f 874/955/901 906/986/931 875/923/871\n"
-                                   "f 862/925/873 892/984/929 893/987/932\n"
-                                   "f 1137/988/1 888/927/874 919/985/930\n"
-                                   "f 876/928/875 906/986/931 907/956/902\n"
-                                   "f 862/925/873 894/958/904 863/929/876\n"
-                                   "f 909/960/906 941/989/933 910/962/908\n"
-                                   "f 896/961/907 928/990/934 897/963/909\n"
-                                   "f 911/964/910 941/989/933 942/991/935\n"
-                                   "f 897/963/909 929/992/936 898/965/911\n"
-                                   "f 912/966/912 942/991/935 943/993/937\n"
-                                   "f 898/965/911 930/994/938 899/967/913\n"
-                                   "f 912/966/912 944/995/939 913/968/914\n"
-                                   "f 900/969/915 930/994/938 931/996/940\n"
-                                   "f 913/968/914 945/997/941 914/970/916\n"
-                                   "f 900/969/915 932/998/942 901/971/917\n"
-                                   "f 915/972/918 945/997/941 946/999/943\n"
-                                   "f 901/971/917 933/1000/944 902/973/919\n"
-                                   "f 889/975/920 1448/1001/43 920/1002/945\n"
-                                   "f 915/972/918 947/1003/946 916/976/921\n"
-                                   "f 903/977/922 933/1000/944 934/1004/947\n"
-                                   "f 889/975/920 921/1005/948 890/978/923\n"
-                                   "f 917/979/924 947/1003/946 948/1006/949\n"
-                                   "f 904/980/925 934/1004/947 935/1007/950\n"
-                                   "f 891/981/926 921/1005/948 922/1008/951\n"
-                                   "f 917/979/924 949/1009/952 918/982/927\n"
-                                   "f 904/980/925 936/1010/953 905/983/928\n"
-                                   "f 892/984/929 922/1008/951 923/1011/954\n"
-                                   "f 918/982/927 950/1012/955 919/985/930\n"
-                                   "f 905/983/928 937/1013/956 906/986/931\n"
-                                   "f 893/987/932 923/1011/954 924/1014/957\n"
-                                   "f 1137/1015/1 919/985/930 950/1012/955\n"
-                                   "f 907/956/902 937/1013/956 938/1016/958\n"
-                                   "f 893/987/932 925/1017/959 894/958/904\n"
-                                   "f 908/957/903 938/1016/958 939/1018/960\n"
-                                   "f 895/959/905 925/1017/959 926/1019/961\n"
-                                   "f 908/957/903 940/1020/962 909/960/906\n"
-                                   "f 896/961/907 926/1019/961 927/1021/963\n"
-                                   "f 943/993/937 973/1022/964 974/1023/965\n"
-                                   "f 929/992/936 961/1024/966 930/994/938\n"
-                                   "f 943/993/937 975/1025/967 944/995/939\n"
-                                   "f 931/996/940 961/1024/966 962/1026/968\n"
-                                   "f 944/995/939 976/1027/969 945/997/941\n"
-                                   "f 931/996/940 963/1028/970 932/998/942\n"
-                                   "f 946/999/943 976/1027/969 977/1029/971\n"
-                                   "f 933/1000/944 963/1028/970 964/1030/972\n"
-                                   "f 920/1002/945 1448/1031/43 951/1032/973\n"
-                                   "f 946/999/943 978/1033/974 947/1003/946\n"
-                                   "f 934/1004/947 964/1030/972 965/1034/975\n"
-                                   "f 920/1002/945 952/1035/976 921/1005/948\n"
-                                   "f 948/1006/949 978/1033/974 979/1036/977\n"
-                                   "f 935/1007/950 965/1034/975 966/1037/978\n"
-                                   "f 922/1008/951 952/1035/976 953/1038/979\n"
-                                   "f 948/1006/949 980/1039/980 949/1009/952\n"
-                                   "f 935/1007/950 967/1040/981 936/1010/953\n"
-                                   "f 922/1008/951 954/1041/982 923/1011/954\n"
-                                   "f 949/1009/952 981/1042/983 950/1012/955\n"
-                                   "f 936/1010/953 968/1043/984 937/1013/956\n"
-                                   "f 924/1014/957 954/1041/982 955/1044/985\n"
-                                   "f 1137/1045/1 950/1012/955 981/1042/983\n"
-                                   "f 938/1016/958 968/1043/984 969/1046/986\n"
-                                   "f 924/1014/957 956/1047/987 925/1017/959\n"
-                                   "f 938/1016/958 970/1048/988 939/1018/960\n"
-                                   "f 926/1019/961 956/1047/987 957/1049/989\n"
-                                   "f 939/1018/960 971/1050/990 940/1020/962\n"
-                                   "f 927/1021/963 957/1049/989 958/1051/991\n"
-                                   "f 940/1020/962 972/1052/992 941/989/933\n"
-                                   "f 927/1021/963 959/1053/993 928/990/934\n"
-                                   "f 942/991/935 972/1052/992 973/1022/964\n"
-                                   "f 928/990/934 960/1054/994 929/992/936\n"
-                                   "f 975/1025/967 1007/1055/995 976/1027/969\n"
-                                   "f 962/1026/968 994/1056/996 963/1028/970\n"
-                                   "f 977/1029/971 1007/1055/995 1008/1057/997\n"
-                                   "f 964/1030/972 994/1056/996 995/1058/998\n"
-                                   "f 951/1032/973 1448/1059/43 982/1060/999\n"
-                                   "f 977/1029/971 1009/1061/1000 978/1033/974\n"
-                                   "f 965/1034/975 995/1058/998 996/1062/1001\n"
-                                   "f 951/1032/973 983/1063/1002 952/1035/976\n"
-                                   "f 979/1036/977 1009/1061/1000 1010/1064/1003\n"
-                                   "f 966/1037/978 996/1062/1001 997/1065/1004\n"
-                                   "f 952/1035/976 984/1066/1005 953/1038/979\n"
-                                   "f 979/1036/977 1011/1067/1006 980/1039/980\n"
-                                   "f 966/1037/978 998/1068/1007 967/1040/981\n"
-                                   "f 953/1038/979 985/1069/1008 954/1041/982\n"
-                                   "f 981/1042/983 1011/1067/1006 1012/1070/1009\n"
-                                   "f 967/1040/981 999/1071/1010 968/1043/984\n"
-                                   "f 954/1041/982 986/1072/1011 955/1044/985\n"
-                                   "f 1137/1073/1 981/1042/983 1012/1070/1009\n"
-                                   "f 969/1046/986 999/1071/1010 1000/1074/1012\n"
-                                   "f 955/1044/985 987/1075/1013 956/1047/987\n"
-                                   "f 970/1048/988 1000/1074/1012 1001/1076/1014\n"
-                                   "f 957/1049/989 987/1075/1013 988/1077/1015\n"
-                                   "f 970/1048/988 1002/1078/1016 971/1050/990\n"
-                                   "f 958/1051/991 988/1077/1015 989/1079/1017\n"
-                                   "f 971/1050/990 1003/1080/1018 972/1052/992\n"
-                                   "f 958/1051/991 990/1081/1019 959/1053/993\n"
-                                   "f 973/1022/964 1003/1080/1018 1004/1082/1020\n"
-                                   "f 959/1053/993 991/1083/1021 960/1054/994\n"
-                                   "f 974/1023/965 1004/1082/1020 1005/1084/1022\n"
-                                   "f 960/1054/994 992/1085/1023 961/1024/966\n"
-                                   "f 974/1023/965 1006/1086/1024 975/1025/967\n"
-                                   "f 962/1026/968 992/1085/1023 993/1087/1025\n"
-                                   "f 982/1060/999 1448/1088/43 1013/1089/1026\n"
-                                   "f 1008/1057/997 1040/1090/1027 1009/1061/1000\n"
-                                   "f 996/1062/1001 1026/1091/1028 1027/1092/1029\n"
-                                   "f 982/1060/999 1014/1093/1030 983/1063/1002\n"
-                                   "f 1010/1064/1003 1040/1090/1027 1041/1094/1031\n"
-                                   "f 997/1065/1004 1027/1092/1029 1028/1095/1032\n"
-                                   "f 984/1066/1005 1014/1093/1030 1015/1096/1033\n"
-                                   "f 1010/1064/1003 1042/1097/1034 1011/1067/1006\n"
-                                   "f 997/1065/1004 1029/1098/1035 998/1068/1007\n"
-                                   "f 984/1066/1005 1016/1099/1036 985/1069/1008\n"
-                                   "f 1012/1070/1009 1042/1097/1034 1043/1100/1037\n"
-                                   "f 998/1068/1007 1030/1101/1038 999/1071/1010\n"
-                                   "f 985/1069/1008 1017/1102/1039 986/1072/1011\n"
-                                   "f 1137/1103/1 1012/1070/1009 1043/1100/1037\n"
-                                   "f 1000/1074/1012 1030/1101/1038 1031/1104/1040\n"
-                                   "f 986/1072/1011 1018/1105/1041 987/1075/1013\n"
-                                   "f 1001/1076/1014 1031/1104/1040 1032/1106/1042\n"
-                                   "f 988/1077/1015 1018/1105/1041 1019/1107/1043\n"
-                                   "f 1001/1076/1014 1033/1108/1044 1002/1078/1016\n"
-                                   "f 989/1079/1017 1019/1107/1043 1020/1109/1045\n"
-                                   "f 1002/1078/1016 1034/1110/1046 1003/1080/1018\n"
-                                   "f 989/1079/1017 1021/1111/1047 990/1081/1019\n"
-                                   "f 1004/1082/1020 1034/1110/1046 1035/1112/1048\n"
-                                   "f 990/1081/1019 1022/1113/1049 991/1083/1021\n"
-                                   "f 1005/1084/1022 1035/1112/1048 1036/1114/1050\n"
-                                   "f 991/1083/1021 1023/1115/1051 992/1085/1023\n"
-                                   "f 1005/1084/1022 1037/1116/1052 1006/1086/1024\n"
-                                   "f 993/1087/1025 1023/1115/1051 1024/1117/1053\n"
-                                   "f 1006/1086/1024 1038/1118/1054 1007/1055/995\n"
-                                   "f 993/1087/1025 1025/1119/1055 994/1056/996\n"
-                                   "f 1008/1057/997 1038/1118/1054 1039/1120/1056\n"
-                                   "f 994/1056/996 1026/1091/1028 995/1058/998\n"
-                                   "f 1014/1093/1030 1046/1121/1057 1015/1096/1033\n"
-                                   "f 1041/1094/1031 1073/1122/1058 1042/1097/1034\n"
-                                   "f 1028/1095/1032 1060/1123/1059 1029/1098/1035\n"
-                                   "f 1015/1096/1033 1047/1124/1060 1016/1099/1036\n"
-                                   "f 1042/1097/1034 1074/1125/1061 1043/1100/1037\n"
-                                   "f 1029/1098/1035 1061/1126/1062 1030/1101/1038\n"
-                                   "f 1016/1099/1036 1048/1127/1063 1017/1102/1039\n"
-                                   "f 1137/1128/1 1043/1100/1037 1074/1125/1061\n"
-                                   "f 1031/1104/1040 1061/1126/1062 1062/1129/1064\n"
-                                   "f 1017/1102/1039 1049/1130/1065 1018/1105/1041\n"
-                                   "f 1032/1106/1042 1062/1129/1064 1063/1131/1066\n"
-                                   "f 1019/1107/1043 1049/1130/1065 1050/1132/1067\n"
-                                   "f 1032/1106/1042 1064/1133/1068 1033/1108/1044\n"
-                                   "f 1020/1109/1045 1050/1132/1067 1051/1134/1069\n"
-                                   "f 1033/1108/1044 1065/1135/1070 1034/1110/1046\n"
-                                   "f 1020/1109/1045 1052/1136/1071 1021/1111/1047\n"
-                                   "f 1035/1112/1048 1065/1135/1070 1066/1137/1072\n"
-                                   "f 1021/1111/1047 1053/1138/1073 1022/1113/1049\n"
-                                   "f 1036/1114/1050 1066/1137/1072 1067/1139/1074\n"
-                                   "f 1022/1113/1049 1054/1140/1075 1023/1115/1051\n"
-                                   "f 1036/1114/1050 1068/1141/1076 1037/1116/1052\n"
-                                   "f 1024/1117/1053 1054/1140/1075 1055/1142/1077\n"
-                                   "f 1037/1116/1052 1069/1143/1078 1038/1118/1054\n"
-                                   "f 1024/1117/1053 1056/1144/1079 1025/1119/1055\n"
-                                   "f 1039/1120/1056 1069/1143/1078 1070/1145/1080\n"
-                                   "f 1025/1119/1055 1057/1146/1081 1026/1091/1028\n"
-                                   "f 1013/1089/1026 1448/1147/43 1044/1148/1082\n"
-                                   "f 1039/1120/1056 1071/1149/1083 1040/1090/1027\n"
-                                   "f 1027/1092/1029 1057/1146/1081 1058/1150/1084\n"
-                                   "f 1014/1093/1030 1044/1148/1082 1045/1151/1085\n"
-                                   "f 1041/1094/1031 1071/1149/1083 1072/1152/1086\n"
-                                   "f 1028/1095/1032 1058/1150/1084 1059/1153/1087\n"
-                                   "f 1047/1124/1060 1079/1154/1088 1048/1127/1063\n"
-                                   "f 1137/1155/1 1074/1125/1061 1105/1156/1089\n"
-                                   "f 1062/1129/1064 1092/1157/1090 1093/1158/1091\n"
-                                   "f 1048/1127/1063 1080/1159/1092 1049/1130/1065\n"
-                                   "f 1062/1129/1064 1094/1160/1093 1063/1131/1066\n"
-                                   "f 1050/1132/1067 1080/1159/1092 1081/1161/1094\n"
-                                   "f 1063/1131/1066 1095/1162/1095 1064/1133/1068\n"
-                                   "f 1051/1134/1069 1081/1161/1094 1082/1163/1096\n"
-                                   "f 1064/1133/1068 1096/1164/1097 1065/1135/1070\n"
-                                   "f 1051/1134/1069 1083/1165/1098 1052/1136/1071\n"
-                                   "f 1066/1137/1072 1096/1164/1097 1097/1166/1099\n"
-                                   "f 1052/1136/1071 1084/1167/1100 1053/1138/1073\n"
-                                   "f 1067/1139/1074 1097/1166/1099 1098/1168/1101\n"
-                                   "f 1053/1138/1073 1085/1169/1102 1054/1140/1075\n"
-                                   "f 1067/1139/1074 1099/1170/1103 1068/1141/1076\n"
-                                   "f 1055/1142/1077 1085/1169/1102 1086/1171/1104\n"
-                                   "f 1068/1141/1076 1100/1172/1105 1069/1143/1078\n"
-                                   "f 1055/1142/1077 1087/1173/1106 1056/1144/1079\n"
-                                   "f 1070/1145/1080 1100/1172/1105 1101/1174/1107\n"
-                                   "f 1057/1146/1081 1087/1173/1106 1088/1175/1108\n"
-                                   "f 1044/1148/1082 1448/1176/43 1075/1177/1109\n"
-                                   "f 1070/1145/1080 1102/1178/1110 1071/1149/1083\n"
-                                   "f 1058/1150/1084 1088/1175/1108 1089/1179/1111\n"
-                                   "f 1045/1151/1085 1075/1177/1109 1076/1180/1112\n"
-                                   "f 1072/1152/1086 1102/1178/1110 1103/1181/1113\n"
-                                   "f 1058/1150/1084 1090/1182/1114 1059/1153/1087\n"
-                                   "f 1046/1121/1057 1076/1180/1112 1077/1183/1115\n"
-                                   "f 1072/1152/1086 1104/1184/1116 1073/1122/1058\n"
-                                   "f 1059/1153/1087 1091/1185/1117 1060/1123/1059\n"
-                                   "f 1046/1121/1057 1078/1186/1118 1047/1124/1060\n"
-                                   "f 1073/1122/1058 1105/1156/1089 1074/1125/1061\n"
-                                   "f 1060/1123/1059 1092/1157/1090 1061/1126/1062\n"
-                                   "f 1081/1161/1094 1111/1187/1119 1112/1188/1120\n"
-                                   "f 1094/1160/1093 1126/1189/1121 1095/1162/1095\n"
-                                   "f 1082/1163/1096 1112/1188/1120 1113/1190/1122\n"
-                                   "f 1095/1162/1095 1127/1191/1123 1096/1164/1097\n"
-                                   "f 1082/1163/1096 1114/1192/1124 1083/1165/1098\n"
-                                   "f 1097/1166/1099 1127/1191/1123 1128/1193/1125\n"
-                                   "f 1084/1167/1100 1114/1192/1124 1115/1194/1126\n"
-                                   "f 1098/1168/1101 1128/1193/1125 1129/1195/1127\n"
-                                   "f 1084/1167/1100 1116/1196/1128 1085/1169/1102\n"
-                                   "f 1098/1168/1101 1130/1197/1129 1099/1170/1103\n"
-                                   "f 1086/1171/1104 1116/1196/1128 1117/1198/1130\n"
-                                   "f 1099/1170/1103 1131/1199/1131 1100/1172/1105\n"
-                                   "f 1086/1171/1104 1118/1200/1132 1087/1173/1106\n"
-                                   "f 1101/1174/1107 1131/1199/1131 1132/1201/1133\n"
-                                   "f 1088/1175/1108 1118/1200/1132 1119/1202/1134\n"
-                                   "f 1075/1177/1109 1448/1203/43 1106/1204/1135\n"
-                                   "f 1101/1174/1107 1133/1205/1136 1102/1178/1110\n"
-                                   "f 1089/1179/1111 1119/1202/1134 1120/1206/1137\n"
-                                   "f 1075/1177/1109 1107/1207/1138 1076/1180/1112\n"
-                                   "f 1103/1181/1113 1133/1205/1136 1134/1208/1139\n"
-                                   "f 1090/1182/1114 1120/1206/1137 1121/1209/1140\n"
-                                   "f 1076/1180/1112 1108/1210/1141 1077/1183/1115\n"
-                                   "f 1103/1181/1113 1135/1211/1142 1104/1184/1116\n"
-                                   "f 1090/1182/1114 1122/1212/1143 1091/1185/1117\n"
-                                   "f 1077/1183/1115 1109/1213/1144 1078/1186/1118\n"
-                                   "f 1105/1156/1089 1135/1211/1142 1136/1214/1145\n"
-                                   "f 1091/1185/1117 1123/1215/1146 1092/1157/1090\n"
-                                   "f 1078/1186/1118 1110/1216/1147 1079/1154/1088\n"
-                                   "f 1137/1217/1 1105/1156/1089 1136/1214/1145\n"
-                                   "f 1093/1158/1091 1123/1215/1146 1124/1218/1148\n"
-                                   "f 1079/1154/1088 1111/1187/1119 1080/1159/1092\n"
-                                   "f 1093/1158/1091 1125/1219/1149 1094/1160/1093\n"
-                                   "f 1113/1190/1122 1146/1220/1150 1114/1192/1124\n"
-                                   "f 1128/1193/1125 1159/1221/1151 1160/1222/1152\n"
-                                   "f 1114/1192/1124 1147/1223/1153 1115/1194/1126\n"
-                                   "f 1129/1195/1127 1160/1222/1152 1161/1224/1154\n"
-                                   "f 1115/1194/1126 1148/1225/1155 1116/1196/1128\n"
-                                   "f 1129/1195/1127 1162/1226/1156 1130/1197/1129\n"
-                                   "f 1117/1198/1130 1148/1225/1155 1149/1227/1157\n"
-                                   "f 1130/1197/1129 1163/1228/1158 1131/1199/1131\n"
-                                   "f 1117/1198/1130 1150/1229/1159 1118/1200/1132\n"
-                                   "f 1132/1201/1133 1163/1228/1158 1164/1230/1160\n"
-                                   "f 1118/1200/1132 1151/1231/1161 1119/1202/1134\n"
-                                   "f 1106/1204/1135 1448/1232/43 1138/1233/1162\n"
-                                   "f 1132/1201/1133 1165/1234/1163 1133/1205/1136\n"
-                                   "f 1120/1206/1137 1151/1231/1161 1152/1235/1164\n"
-                                   "f 1106/1204/1135 1139/1236/1165 1107/1207/1138\n"
-                                   "f 1134/1208/1139 1165/1234/1163 1166/1237/1166\n"
-                                   "f 1121/1209/1140 1152/1235/1164 1153/1238/1167\n"
-                                   "f 1108/1210/1141 1139/1236/1165 1140/1239/1168\n"
-                                   "f 1134/1208/1139 1167/1240/1169 1135/1211/1142\n"
-                                   "f 1121/1209/1140 1154/1241/1170 1122/1212/1143\n"
-                                   "f 1108/1210/1141 1141/1242/1171 1109/1213/1144\n"
-                                   "f 1136/1214/1145 1167/1240/1169 1168/1243/1172\n"
-                                   "f 1122/1212/1143 1155/1244/1173 1123/1215/1146\n"
-                                   "f 1109/1213/1144 1142/1245/1174 1110/1216/1147\n"
-                                   "f 1137/1246/1 1136/1214/1145 1168/1243/1172\n"
-                                   "f 1124/1218/1148 1155/1244/1173 1156/1247/1175\n"
-                                   "f 1110/1216/1147 1143/1248/1176 1111/1187/1119\n"
-                                   "f 1124/1218/1148 1157/1249/1177 1125/1219/1149\n"
-                                   "f 1112/1188/1120 1143/1248/1176 1144/1250/1178\n"
-                                   "f 1125/1219/1149 1158/1251/1179 1126/1189/1121\n"
-                                   "f 1113/1190/1122 1144/1250/1178 1145/1252/1180\n"
-                                   "f 1126/1189/1121 1159/1221/1151 1127/1191/1123\n"
-                                   "f 1147/1223/1153 1179/1253/1181 1148/1225/1155\n"
-                                   "f 1161/1224/1154 1193/1254/1182 1162/1226/1156\n"
-                                   "f 1149/1227/1157 1179/1253/1181 1180/1255/1183\n"
-                                   "f 1162/1226/1156 1194/1256/1184 1163/1228/1158\n"
-                                   "f 1149/1227/1157 1181/1257/1185 1150/1229/1159\n"
-                                   "f 1163/1228/1158 1195/1258/1186 1164/1230/1160\n"
-                                   "f 1150/1229/1159 1182/1259/1187 1151/1231/1161\n"
-                                   "f 1138/1233/1162 1448/1260/43 1169/1261/1188\n"
-                                   "f 1164/1230/1160 1196/1262/1189 1165/1234/1163\n"
-                                   "f 1152/1235/1164 1182/1259/1187 1183/1263/1190\n"
-                                   "f 1138/1233/1162 1170/1264/1191 1139/1236/1165\n"
-                                   "f 1166/1237/1166 1196/1262/1189 1197/1265/1192\n"
-                                   "f 1153/1238/1167 1183/1263/1190 1184/1266/1193\n"
-                                   "f 1139/1236/1165 1171/1267/1194 1140/1239/1168\n"
-                                   "f 1166/1237/1166 1198/1268/1195 1167/1240/1169\n"
-                                   "f 1153/1238/1167 1185/1269/1196 1154/1241/1170\n"
-                                   "f 1140/1239/1168 1172/1270/1197 1141/1242/1171\n"
-                                   "f 1167/1240/1169 1199/1271/1198 1168/1243/1172\n"
-                                   "f 1154/1241/1170 1186/1272/1199 1155/1244/1173\n"
-                                   "f 1141/1242/1171 1173/1273/1200 1142/1245/1174\n"
-                                   "f 1137/1274/1 1168/1243/1172 1199/1271/1198\n"
-                                   "f 1156/1247/1175 1186/1272/1199 1187/1275/1201\n"
-                                   "f 1142/1245/1174 1174/1276/1202 1143/1248/1176\n"
-                                   "f 1157/1249/1177 1187/1275/1201 1188/1277/1203\n"
-                                   "f 1144/1250/1178 1174/1276/1202 1175/1278/1204\n"
-                                   "f 1157/1249/1177 1189/1279/1205 1158/1251/1179\n"
-                                   "f 1145/1252/1180 1175/1278/1204 1176/1280/1206\n"
-                                   "f 1158/1251/1179 1190/1281/1207 1159/1221/1151\n"
-                                   "f 1145/1252/1180 1177/1282/1208 1146/1220/1150\n"
-                                   "f 1160/1222/1152 1190/1281/1207 1191/1283/1209\n"
-                                   "f 1146/1220/1150 1178/1284/1210 1147/1223/1153\n"
-                                   "f 1161/1224/1154 1191/1283/1209 1192/1285/1211\n"
-                                   "f 1180/1255/1183 1212/1286/1212 1181/1257/1185\n"
-                                   "f 1195/1258/1186 1225/1287/1213 1226/1288/1214\n"
-                                   "f 1181/1257/1185 1213/1289/1215 1182/1259/1187\n"
-                                   "f 1169/1261/1188 1448/1290/43 1200/1291/1216\n"
-                                   "f 1195/1258/1186 1227/1292/1217 1196/1262/1189\n"
-                                   "f 1183/1263/1190 1213/1289/1215 1214/1293/1218\n"
-                                   "f 1169/1261/1188 1201/1294/1219 1170/1264/1191\n"
-                                   "f 1197/1265/1192 1227/1292/1217 1228/1295/1220\n"
-                                   "f 1184/1266/1193 1214/1293/1218 1215/1296/1221\n"
-                                   "f 1171/1267/1194 1201/1294/1219 1202/1297/1222\n"
-                                   "f 1197/1265/1192 1229/1298/1223 1198/1268/1195\n"
-                                   "f 1184/1266/1193 1216/1299/1224 1185/1269/1196\n"
-                                   "f 1171/1267/1194 1203/1300/1225 1172/1270/1197\n"
-                                   "f 1198/1268/1195 1230/1301/1226 1199/1271/1198\n"
-                                   "f 1185/1269/1196 1217/1302/1227 1186/1272/1199\n"
-                                   "f 1172/1270/1197 1204/1303/1228 1173/1273/1200\n"
-                                   "f 1137/1304/1 1199/1271/1198 1230/1301/1226\n"
-                                   "f 1187/1275/1201 1217/1302/1227 1218/1305/1229\n"
-                                   "f 1173/1273/1200 1205/1306/1230 1174/1276/1202\n"
-                                   "f 1188/1277/1203 1218/1305/1229 1219/1307/1231\n"
-                                   "f 1175/1278/1204 1205/1306/1230 1206/1308/1232\n"
-                                   "f 1188/1277/1203 1220/1309/1233 1189/1279/1205\n"
-                                   "f 1176/1280/1206 1206/1308/1232 1207/1310/1234\n"
-                                   "f 1189/1279/1205 1221/1311/1235 1190/1281/1207\n"
-                                   "f 1176/1280/1206 1208/1312/1236 1177/1282/1208\n"
-                                   "f 1191/1283/1209 1221/1311/1235 1222/1313/1237\n"
-                                   "f 1177/1282/1208 1209/1314/1238 1178/1284/1210\n"
-                                   "f 1192/1285/1211 1222/1313/1237 1223/1315/1239\n"
-                                   "f 1179/1253/1181 1209/1314/1238 1210/1316/1240\n"
-                                   "f 1192/1285/1211 1224/1317/1241 1193/1254/1182\n"
-                                   "f 1180/1255/1183 1210/1316/1240 1211/1318/1242\n"
-                                   "f 1193/1254/1182 1225/1287/1213 1194/1256/1184\n"
-                                   "f 1214/1293/1218 1244/1319/1243 1245/1320/1244\n"
-                                   "f 1200/1291/1216 1232/1321/1245 1201/1294/1219\n"
-                                   "f 1228/1295/1220 1258/1322/1246 1259/1323/1247\n"
-                                   "f 1215/1296/1221 1245/1320/1244 1246/1324/1248\n"
-                                   "f 1201/1294/1219 1233/1325/1249 1202/1297/1222\n"
-                                   "f 1228/1295/1220 1260/1326/1250 1229/1298/1223\n"
-                                   "f 1215/1296/1221 1247/1327/1251 1216/1299/1224\n"
-                                   "f 1202/1297/1222 1234/1328/1252 1203/1300/1225\n"
-                                   "f 1230/1301/1226 1260/1326/1250 1261/1329/1253\n"
-                                   "f 1216/1299/1224 1248/1330/1254 1217/1302/1227\n"
-                                   "f 1203/1300/1225 1235/1331/1255 1204/1303/1228\n"
-                                   "f 1137/1332/1 1230/1301/1226 1261/1329/1253\n"
-                                   "f 1218/1305/1229 1248/1330/1254 1249/1333/1256\n"
-                                   "f 1204/1303/1228 1236/1334/1257 1205/1306/1230\n"
-                                   "f 1219/1307/1231 1249/1333/1256 1250/1335/1258\n"
-                                   "f 1206/1308/1232 1236/1334/1257 1237/1336/1259\n"
-                                   "f 1219/1307/1231 1251/1337/1260 1220/1309/1233\n"
-                                   "f 1207/1310/1234 1237/1336/1259 1238/1338/1261\n"
-                                   "f 1220/1309/1233 1252/1339/1262 1221/1311/1235\n"
-                                   "f 1207/1310/1234 1239/1340/1263 1208/1312/1236\n"
-                                   "f 1222/1313/1237 1252/1339/1262 1253/1341/1264\n"
-                                   "f 1208/1312/1236 1240/1342/1265 1209/1314/1238\n"
-                                   "f 1223/1315/1239 1253/1341/1264 1254/1343/1266\n"
-                                   "f 1209/1314/1238 1241/1344/1267 1210/1316/1240\n"
-                                   "f 1223/1315/1239 1255/1345/1268 1224/1317/1241\n"
-                                   "f 1211/1318/1242 1241/1344/1267 1242/1346/1269\n"
-                                   "f 1224/1317/1241 1256/1347/1270 1225/1287/1213\n"
-                                   "f 1212/1286/1212 1242/1346/1269 1243/1348/1271\n"
-                                   "f 1226/1288/1214 1256/1347/1270 1257/1349/1272\n"
-                                   "f 1212/1286/1212 1244/1319/1243 1213/1289/1215\n"
-                                   "f 1200/1291/1216 1448/1350/43 1231/1351/1273\n"
-                                   "f 1226/1288/1214 1258/1322/1246 1227/1292/1217\n"
-                                   "f 1246/1324/1248 1278/1352/1274 1247/1327/1251\n"
-                                   "f 1234/1328/1252 1264/1353/1275 1265/1354/1276\n"
-                                   "f 1260/1326/1250 1292/1355/1277 1261/1329/1253\n"
-                                   "f 1247/1327/1251 1279/1356/1278 1248/1330/1254\n"
-                                   "f 1234/1328/1252 1266/1357/1279 1235/1331/1255\n"
-                                   "f 1137/1358/1 1261/1329/1253 1292/1355/1277\n"
-                                   "f 1249/1333/1256 1279/1356/1278 1280/1359/1280\n"
-                                   "f 1235/1331/1255 1267/1360/1281 1236/1334/1257\n"
-                                   "f 1250/1335/1258 1280/1359/1280 1281/1361/1282\n"
-                                   "f 1237/1336/1259 1267/1360/1281 1268/1362/1283\n"
-                                   "f 1250/1335/1258 1282/1363/1284 1251/1337/1260\n"
-                                   "f 1238/1338/1261 1268/1362/1283 1269/1364/1285\n"
-                                   "f 1251/1337/1260 1283/1365/1286 1252/1339/1262\n"
-                                   "f 1238/1338/1261 1270/1366/1287 1239/1340/1263\n"
-                                   "f 1253/1341/1264 1283/1365/1286 1284/1367/1288\n"
-                                   "f 1239/1340/1263 1271/1368/1289 1240/1342/1265\n"
-                                   "f 1254/1343/1266 1284/1367/1288 1285/1369/1290\n"
-                                   "f 1240/1342/1265 1272/1370/1291 1241/1344/1267\n"
-                                   "f 1254/1343/1266 1286/1371/1292 1255/1345/1268\n"
-                                   "f 1242/1346/1269 1272/1370/1291 1273/1372/1293\n"
-                                   "f 1255/1345/1268 1287/1373/1294 1256/1347/1270\n"
-                                   "f 1243/1348/1271 1273/1372/1293 1274/1374/1295\n"
-                                   "f 1257/1349/1272 1287/1373/1294 1288/1375/1296\n"
-                                   "f 1243/1348/1271 1275/1376/1297 1244/1319/1243\n"
-                                   "f 1231/1351/1273 1448/1377/43 1262/1378/1298\n"
-                                   "f 1258/1322/1246 1288/1375/1296 1289/1379/1299\n"
-                                   "f 1245/1320/1244 1275/1376/1297 1276/1380/1300\n"
-                                   "f 1231/1351/1273 1263/1381/1301 1232/1321/1245\n"
-                                   "f 1259/1323/1247 1289/1379/1299 1290/1382/1302\n"
-                                   "f 1246/1324/1248 1276/1380/1300 1277/1383/1303\n"
-                                   "f 1233/1325/1249 1263/1381/1301 1264/1353/1275\n"
-                                   "f 1259/1323/1247 1291/1384/1304 1260/1326/1250\n"
-                                   "f 1280/1359/1280 1310/1385/1305 1311/1386/1306\n"
-                                   "f 1266/1357/1279 1298/1387/1307 1267/1360/1281\n"
-                                   "f 1281/1361/1282 1311/1386/1306 1312/1388/1308\n"
-                                   "f 1268/1362/1283 1298/1387/1307 1299/1389/1309\n"
-                                   "f 1281/1361/1282 1313/1390/1310 1282/1363/1284\n"
-                                   "f 1269/1364/1285 1299/1389/1309 1300/1391/1311\n"
-                                   "f 1282/1363/1284 1314/1392/1312 1283/1365/1286\n"
-                                   "f 1269/1364/1285 1301/1393/1313 1270/1366/1287\n"
-                                   "f 1284/1367/1288 1314/1392/1312 1315/1394/1314\n"
-                                   "f 1270/1366/1287 1302/1395/1315 1271/1368/1289\n"
-                                   "f 1285/1369/1290 1315/1394/1314 1316/1396/1316\n"
-                                   "f 1271/1368/1289 1303/1397/1317 1272/1370/1291\n"
-                                   "f 1285/1369/1290 1317/1398/1318 1286/1371/1292\n"
-                                   "f 1272/1370/1291 1304/1399/1319 1273/1372/1293\n"
-                                   "f 1286/1371/1292 1318/1400/1320 1287/1373/1294\n"
-                                   "f 1274/1374/1295 1304/1399/1319 1305/1401/1321\n"
-                                   "f 1288/1375/1296 1318/1400/1320 1319/1402/1322\n"
-                                   "f 1274/1374/1295 1306/1403/1323 1275/1376/1297\n"
-                                   "f 1262/1378/1298 1448/1404/43 1293/1405/1324\n"
-                                   "f 1288/1375/1296 1320/1406/1325 1289/1379/1299\n"
-                                   "f 1276/1380/1300 1306/1403/1323 1307/1407/1326\n"
-                                   "f 1262/1378/1298 1294/1408/1327 1263/1381/1301\n"
-                                   "f 1289/1379/1299 1321/1409/1328 1290/1382/1302\n"
-                                   "f 1277/1383/1303 1307/1407/1326 1308/1410/1329\n"
-                                   "f 1264/1353/1275 1294/1408/1327 1295/1411/1330\n"
-                                   "f 1290/1382/1302 1322/1412/1331 1291/1384/1304\n"
-                                   "f 1277/1383/1303 1309/1413/1332 1278/1352/1274\n"
-                                   "f 1264/1353/1275 1296/1414/1333 1265/1354/1276\n"
-                                   "f 1292/1355/1277 1322/1412/1331 1323/1415/1334\n"
-                                   "f 1278/1352/1274 1310/1385/1305 1279/1356/1278\n"
-                                   "f 1265/1354/1276 1297/1416/1335 1266/1357/1279\n"
-                                   "f 1137/1417/1 1292/1355/1277 1323/1415/1334\n"
-                                   "f 1312/1388/1308 1344/1418/1336 1313/1390/1310\n"
-                                   "f 1300/1391/1311 1330/1419/1337 1331/1420/1338\n"
-                                   "f 1313/1390/1310 1345/1421/1339 1314/1392/1312\n"
-                                   "f 1300/1391/1311 1332/1422/1340 1301/1393/1313\n"
-                                   "f 1315/1394/1314 1345/1421/1339 1346/1423/1341\n"
-                                   "f 1301/1393/1313 1333/1424/1342 1302/1395/1315\n"
-                                   "f 1316/1396/1316 1346/1423/1341 1347/1425/1343\n"
-                                   "f 1303/1397/1317 1333/1424/1342 1334/1426/1344\n"
-                                   "f 1316/1396/1316 1348/1427/1345 1317/1398/1318\n"
-                                   "f 1303/1397/1317 1335/1428/1346 1304/1399/1319\n"
-                                   "f 1317/1398/1318 1349/1429/1347 1318/1400/1320\n"
-                                   "f 1305/1401/1321 1335/1428/1346 1336/1430/1348\n"
-                                   "f 1319/1402/1322 1349/1429/1347 1350/1431/1349\n"
-                                   "f 1305/1401/1321 1337/1432/1350 1306/1403/1323\n"
-                                   "f 1293/1405/1324 1448/1433/43 1324/1434/1351\n"
-                                   "f 1319/1402/1322 1351/1435/1352 1320/1406/1325\n"
-                                   "f 1307/1407/1326 1337/1432/1350 1338/1436/1353\n"
-                                   "f 1293/1405/1324 1325/1437/1354 1294/1408/1327\n"
-                                   "f 1321/1409/1328 1351/1435/1352 1352/1438/1355\n"
-                                   "f 1308/1410/1329 1338/1436/1353 1339/1439/1356\n"
-                                   "f 1295/1411/1330 1325/1437/1354 1326/1440/1357\n"
-                                   "f 1321/1409/1328 1353/1441/1358 1322/1412/1331\n"
-                                   "f 1308/1410/1329 1340/1442/1359 1309/1413/1332\n"
-                                   "f 1295/1411/1330 1327/1443/1360 1296/1414/1333\n"
-                                   "f 1322/1412/1331 1354/1444/1361 1323/1415/1334\n"
-                                   "f 1309/1413/1332 1341/1445/1362 1310/1385/1305\n"
-                                   "f 1297/1416/1335 1327/1443/1360 1328/1446/1363\n"
-                                   "f 1137/1447/1 1323/1415/1334 1354/1444/1361\n"
-                                   "f 1311/1386/1306 1341/1445/1362 1342/1448/1364\n"
-                                   "f 1297/1416/1335 1329/1449/1365 1298/1387/1307\n"
-                                   "f 1312/1388/1308 1342/1448/1364 1343/1450/1366\n"
-                                   "f 1299/1389/1309 1329/1449/1365 1330/1419/1337\n"
-                                   "f 1346/1423/1341 1376/1451/1367 1377/1452/1368\n"
-                                   "f 1332/1422/1340 1364/1453/1369 1333/1424/1342\n"
-                                   "f 1347/1425/1343 1377/1452/1368 1378/1454/1370\n"
-                                   "f 1334/1426/1344 1364/1453/1369 1365/1455/1371\n"
-                                   "f 1347/1425/1343 1379/1456/1372 1348/1427/1345\n"
-                                   "f 1334/1426/1344 1366/1457/1373 1335/1428/1346\n"
-                                   "f 1348/1427/1345 1380/1458/1374 1349/1429/1347\n"
-                                   "f 1336/1430/1348 1366/1457/1373 1367/1459/1375\n"
-                                   "f 1350/1431/1349 1380/1458/1374 1381/1460/1376\n"
-                                   "f 1336/1430/1348 1368/1461/1377 1337/1432/1350\n"
-                                   "f 1324/1434/1351 1448/1462/43 1355/1463/1378\n"
-                                   "f 1350/1431/1349 1382/1464/1379 1351/1435/1352\n"
-                                   "f 1338/1436/1353 1368/1461/1377 1369/1465/1380\n"
-                                   "f 1324/1434/1351 1356/1466/1381 1325/1437/1354\n"
-                                   "f 1351/1435/1352 1383/1467/1382 1352/1438/1355\n"
-                                   "f 1339/1439/1356 1369/1465/1380 1370/1468/1383\n"
-                                   "f 1325/1437/1354 1357/1469/1384 1326/1440/1357\n"
-                                   "f 1352/1438/1355 1384/1470/1385 1353/1441/1358\n"
-                                   "f 1339/1439/1356 1371/1471/1386 1340/1442/1359\n"
-                                   "f 1327/1443/1360 1357/1469/1384 1358/1472/1387\n"
-                                   "f 1353/1441/1358 1385/1473/1388 1354/1444/1361\n"
-                                   "f 1340/1442/1359 1372/1474/1389 1341/1445/1362\n"
-                                   "f 1327/1443/1360 1359/1475/1390 1328/1446/1363\n"
-                                   "f 1137/1476/1 1354/1444/1361 1385/1473/1388\n"
-                                   "f 1342/1448/1364 1372/1474/1389 1373/1477/1391\n"
-                                   "f 1328/1446/1363 1360/1478/1392 1329/1449/1365\n"
-                                   "f 1343/1450/1366 1373/1477/1391 1374/1479/1393\n"
-                                   "f 1330/1419/1337 1360/1478/1392 1361/1480/1394\n"
-                                   "f 1343/1450/1366 1375/1481/1395 1344/1418/1336\n"
-                                   "f 1331/1420/1338 1361/1480/1394 1362/1482/1396\n"
-                                   "f 1344/1418/1336 1376/1451/1367 1345/1421/1339\n"
-                                   "f 1331/1420/1338 1363/1483/1397 1332/1422/1340\n"
-                                   "f 1378/1454/1370 1410/1484/1398 1379/1456/1372\n"
-                                   "f 1365/1455/1371 1397/1485/1399 1366/1457/1373\n"
-                                   "f 1379/1456/1372 1411/1486/1400 1380/1458/1374\n"
-                                   "f 1367/1459/1375 1397/1485/1399 1398/1487/1401\n"
-                                   "f 1381/1460/1376 1411/1486/1400 1412/1488/1402\n"
-                                   "f 1367/1459/1375 1399/1489/1403 1368/1461/1377\n"
-                                   "f 1355/1463/1378 1448/1490/43 1386/1491/1404\n"
-                                   "f 1382/1464/1379 1412/1488/1402 1413/1492/1405\n"
-                                   "f 1369/1465/1380 1399/1489/1403 1400/1493/1406\n"
-                                   "f 1355/1463/1378 1387/1494/1407 1356/1466/1381\n"
-                                   "f 1382/1464/1379 1414/1495/1408 1383/1467/1382\n"
-                                   "f 1370/1468/1383 1400/1493/1406 1401/1496/1409\n"
-                                   "f 1357/1469/1384 1387/1494/1407 1388/1497/1410\n"
-                                   "f 1383/1467/1382 1415/1498/1411 1384/1470/1385\n"
-                                   "f 1370/1468/1383 1402/1499/1412 1371/1471/1386\n"
-                                   "f 1358/1472/1387 1388/1497/1410 1389/1500/1413\n"
-                                   "f 1384/1470/1385 1416/1501/1414 1385/1473/1388\n"
-                                   "f 1371/1471/1386 1403/1502/1415 1372/1474/1389\n"
-                                   "f 1358/1472/1387 1390/1503/1416 1359/1475/1390\n"
-                                   "f 1137/1504/1 1385/1473/1388 1416/1501/1414\n"
-                                   "f 1373/1477/1391 1403/1502/1415 1404/1505/1417\n"
-                                   "f 1359/1475/1390 1391/1506/1418 1360/1478/1392\n"
-                                   "f 1373/1477/1391 1405/1507/1419 1374/1479/1393\n"
-                                   "f 1361/1480/1394 1391/1506/1418 1392/1508/1420\n"
-                                   "f 1374/1479/1393 1406/1509/1421 1375/1481/1395\n"
-                                   "f 1362/1482/1396 1392/1508/1420 1393/1510/1422\n"
-                                   "f 1375/1481/1395 1407/1511/1423 1376/1451/1367\n"
-                                   "f 1362/1482/1396 1394/1512/1424 1363/1483/1397\n"
-                                   "f 1377/1452/1368 1407/1511/1423 1408/1513/1425\n"
-                                   "f 1363/1483/1397 1395/1514/1426 1364/1453/1369\n"
-                                   "f 1378/1454/1370 1408/1513/1425 1409/1515/1427\n"
-                                   "f 1365/1455/1371 1395/1514/1426 1396/1516/1428\n"
-                                   "f 1412/1488/1402 1442/1517/1429 1443/1518/1430\n"
-                                   "f 1398/1487/1401 1430/1519/1431 1399/1489/1403\n"
-                                   "f 1386/1491/1404 1448/1520/43 1417/1521/1432\n"
-                                   "f 1413/1492/1405 1443/1518/1430 1444/1522/1433\n"
-                                   "f 1400/1493/1406 1430/1519/1431 1431/1523/1434\n"
-                                   "f 1386/1491/1404 1418/1524/1435 1387/1494/1407\n"
-                                   "f 1414/1495/1408 1444/1522/1433 1445/1525/1436\n"
-                                   "f 1401/1496/1409 1431/1523/1434 1432/1526/1437\n"
-                                   "f 1388/1497/1410 1418/1524/1435 1419/1527/1438\n"
-                                   "f 1414/1495/1408 1446/1528/1439 1415/1498/1411\n"
-                                   "f 1401/1496/1409 1433/1529/1440 1402/1499/1412\n"
-                                   "f 1389/1500/1413 1419/1527/1438 1420/1530/1441\n"
-                                   "f 1416/1501/1414 1446/1528/1439 1447/1531/1442\n"
-                                   "f 1402/1499/1412 1434/1532/1443 1403/1502/1415\n"
-                                   "f 1389/1500/1413 1421/1533/1444 1390/1503/1416\n"
-                                   "f 1137/1534/1 1416/1501/1414 1447/1531/1442\n"
-                                   "f 1404/1505/1417 1434/1532/1443 1435/1535/1445\n"
-                                   "f 1390/1503/1416 1422/1536/1446 1391/1506/1418\n"
-                                   "f 1404/1505/1417 1436/1537/1447 1405/1507/1419\n"
-                                   "f 1392/1508/1420 1422/1536/1446 1423/1538/1448\n"
-                                   "f 1405/1507/1419 1437/1539/1449 1406/1509/1421\n"
-                                   "f 1393/1510/1422 1423/1538/1448 1424/1540/1450\n"
-                                   "f 1406/1509/1421 1438/1541/1451 1407/1511/1423\n"
-                                   "f 1393/1510/1422 1425/1542/1452 1394/1512/1424\n"
-                                   "f 1408/1513/1425 1438/1541/1451 1439/1543/1453\n"
-                                   "f 1394/1512/1424 1426/1544/1454 1395/1514/1426\n"
-                                   "f 1409/1515/1427 1439/1543/1453 1440/1545/1455\n"
-                                   "f 1396/1516/1428 1426/1544/1454 1427/1546/1456\n"
-                                   "f 1409/1515/1427 1441/1547/1457 1410/1484/1398\n"
-                                   "f 1396/1516/1428 1428/1548/1458 1397/1485/1399\n"
-                                   "f 1410/1484/1398 1442/1517/1429 1411/1486/1400\n"
-                                   "f 1398/1487/1401 1428/1548/1458 1429/1549/1459\n"
-                                   "f 1444/1522/1433 1477/1550/1460 1445/1525/1436\n"
-                                   "f 1432/1526/1437 1463/1551/1461 1464/1552/1462\n"
-                                   "f 1419/1527/1438 1450/1553/1463 1451/1554/1464\n"
-                                   "f 1445/1525/1436 1478/1555/1465 1446/1528/1439\n"
-                                   "f 1432/1526/1437 1465/1556/1466 1433/1529/1440\n"
-                                   "f 1420/1530/1441 1451/1554/1464 1452/1557/1467\n"
-                                   "f 1447/1531/1442 1478/1555/1465 1479/1558/1468\n"
-                                   "f 1433/1529/1440 1466/1559/1469 1434/1532/1443\n"
-                                   "f 1420/1530/1441 1453/1560/1470 1421/1533/1444\n"
-                                   "f 1137/1561/1 1447/1531/1442 1479/1558/1468\n"
-                                   "f 1435/1535/1445 1466/1559/1469 1467/1562/1471\n"
-                                   "f 1421/1533/1444 1454/1563/1472 1422/1536/1446\n"
-                                   "f 1435/1535/1445 1468/1564/1473 1436/1537/1447\n"
-                                   "f 1423/1538/1448 1454/1563/1472 1455/1565/1474\n"
-                                   "f 1436/1537/1447 1469/1566/1475 1437/1539/1449\n"
-                                   "f 1424/1540/1450 1455/1565/1474 1456/1567/1476\n"
-                                   "f 1437/1539/1449 1470/1568/1477 1438/1541/1451\n"
-                                   "f 1424/1540/1450 1457/1569/1478 1425/1542/1452\n"
-                                   "f 1439/1543/1453 1470/1568/1477 1471/1570/1479\n"
-                                   "f 1425/1542/1452 1458/1571/1480 1426/1544/1454\n"
-                                   "f 1440/1545/1455 1471/1570/1479 1472/1572/1481\n"
-                                   "f 1427/1546/1456 1458/1571/1480 1459/1573/1482\n"
-                                   "f 1440/1545/1455 1473/1574/1483 1441/1547/1457\n"
-                                   "f 1427/1546/1456 1460/1575/1484 1428/1548/1458\n"
-                                   "f 1441/1547/1457 1474/1576/1485 1442/1517/1429\n"
-                                   "f 1429/1549/1459 1460/1575/1484 1461/1577/1486\n"
-                                   "f 1443/1518/1430 1474/1576/1485 1475/1578/1487\n"
-                                   "f 1429/1549/1459 1462/1579/1488 1430/1519/1431\n"
-                                   "f 1417/1521/1432 1448/1580/43 1449/1581/1489\n"
-                                   "f 1443/1518/1430 1476/1582/1490 1444/1522/1433\n"
-                                   "f 1431/1523/1434 1462/1579/1488 1463/1551/1461\n"
-                                   "f 1417/1521/1432 1450/1553/1463 1418/1524/1435\n"
-                                   "f 1479/1558/1468 1509/1583/1491 1510/1584/1492\n"
-                                   "f 1465/1556/1466 1497/1585/1493 1466/1559/1469\n"
-                                   "f 1452/1557/1467 1484/1586/1494 1453/1560/1470\n"
-                                   "f 1137/1587/1 1479/1558/1468 1510/1584/1492\n"
-                                   "f 1467/1562/1471 1497/1585/1493 1498/1588/1495\n"
-                                   "f 1453/1560/1470 1485/1589/1496 1454/1563/1472\n"
-                                   "f 1467/1562/1471 1499/1590/1497 1468/1564/1473\n"
-                                   "f 1455/1565/1474 1485/1589/1496 1486/1591/1498\n"
-                                   "f 1468/1564/1473 1500/1592/1499 1469/1566/1475\n"
-                                   "f 1456/1567/1476 1486/1591/1498 1487/1593/1500\n"
-                                   "f 1469/1566/1475 1501/1594/1501 1470/1568/1477\n"
-                                   "f 1456/1567/1476 1488/1595/1502 1457/1569/1478\n"
-                                   "f 1471/1570/1479 1501/1594/1501 1502/1596/1503\n"
-                                   "f 1457/1569/1478 1489/1597/1504 1458/1571/1480\n"
-                                   "f 1472/1572/1481 1502/1596/1503 1503/1598/1505\n"
-                                   "f 1459/1573/1482 1489/1597/1504 1490/1599/1506\n"
-                                   "f 1472/1572/1481 1504/1600/1507 1473/1574/1483\n"
-                                   "f 1459/1573/1482 1491/1601/1508 1460/1575/1484\n"
-                                   "f 1473/1574/1483 1505/1602/1509 1474/1576/1485\n"
-                                   "f 1461/1577/1486 1491/1601/1508 1492/1603/1510\n"
-                                   "f 1475/1578/1487 1505/1602/1509 1506/1604/1511\n"
-                                   "f 1461/1577/1486 1493/1605/1512 1462/1579/1488\n"
-                                   "f 1449/1581/1489 1448/1606/43 1480/1607/1513\n"
-                                   "f 1476/1582/1490 1506/1604/1511 1507/1608/1514\n"
-                                   "f 1463/1551/1461 1493/1605/1512 1494/1609/1515\n"
-                                   "f 1449/1581/1489 1481/1610/1516 1450/1553/1463\n"
-                                   "f 1477/1550/1460 1507/1608/1514 1508/1611/1517\n"
-                                   "f 1464/1552/1462 1494/1609/1515 1495/1612/1518\n"
-                                   "f 1450/1553/1463 1482/1613/1519 1451/1554/1464\n"
-                                   "f 1478/1555/1465 1508/1611/1517 1509/1583/1491\n"
-                                   "f 1464/1552/1462 1496/1614/1520 1465/1556/1466\n"
-                                   "f 1451/1554/1464 1483/1615/1521 1452/1557/1467\n"
-                                   "f 1498/1616/1495 1530/1617/1522 1499/1618/1497\n"
-                                   "f 1486/1619/1498 1516/1620/1523 1517/1621/1524\n"
-                                   "f 1499/1618/1497 1531/1622/1525 1500/1623/1499\n"
-                                   "f 1487/1624/1500 1517/1621/1524 1518/1625/1526\n"
-                                   "f 1500/1623/1499 1532/1626/1527 1501/1627/1501\n"
-                                   "f 1487/1624/1500 1519/1628/1528 1488/1629/1502\n"
-                                   "f 1502/1630/1503 1532/1626/1527 1533/1631/1529\n"
-                                   "f 1488/1629/1502 1520/1632/1530 1489/1633/1504\n"
-                                   "f 1503/1634/1505 1533/1631/1529 1534/1635/1531\n"
-                                   "f 1490/1636/1506 1520/1632/1530 1521/1637/1532\n"
-                                   "f 1503/1634/1505 1535/1638/1533 1504/1639/1507\n"
-                                   "f 1490/1636/1506 1522/1640/1534 1491/1641/1508\n"
-                                   "f 1504/1639/1507 1536/1642/1535 1505/1643/1509\n"
-                                   "f 1492/1644/1510 1522/1640/1534 1523/1645/1536\n"
-                                   "f 1506/1646/1511 1536/1642/1535 1537/1647/1537\n"
-                                   "f 1492/1644/1510 1524/1648/1538 1493/1649/1512\n"
-                                   "f 1480/1650/1513 1448/1651/43 1511/1652/1539\n"
-                                   "f 1506/1646/1511 1538/1653/1540 1507/1654/1514\n"
-                                   "f 1494/1655/1515 1524/1648/1538 1525/1656/1541\n"
-                                   "f 1480/1650/1513 1512/1657/1542 1481/1658/1516\n"
-                                   "f 1508/1659/1517 1538/1653/1540 1539/1660/1543\n"
-                                   "f 1495/1661/1518 1525/1656/1541 1526/1662/1544\n"
-                                   "f 1482/1663/1519 1512/1657/1542 1513/1664/1545\n"
-                                   "f 1508/1659/1517 1540/1665/1546 1509/1666/1491\n"
-                                   "f 1495/1661/1518 1527/1667/1547 1496/1668/1520\n"
-                                   "f 1483/1669/1521 1513/1664/1545 1514/1670/1548\n"
-                                   "f 1510/1671/1492 1540/1665/1546 1541/1672/1549\n"
-                                   "f 1496/1668/1520 1528/1673/1550 1497/1674/1493\n"
-                                   "f 1483/1669/1521 1515/1675/1551 1484/1676/1494\n"
-                                   "f 1137/1677/1 1510/1671/1492 1541/1672/1549\n"
-                                   "f 1498/1616/1495 1528/1673/1550 1529/1678/1552\n"
-                                   "f 1484/1676/1494 1516/1620/1523 1485/1679/1496\n"
-                                   "f 1531/1622/1525 1563/1680/1553 1532/1626/1527\n"
-                                   "f 1518/1625/1526 1550/1681/1554 1519/1628/1528\n"
-                                   "f 1533/1631/1529 1563/1680/1553 1564/1682/1555\n"
-                                   "f 1519/1628/1528 1551/1683/1556 1520/1632/1530\n"
-                                   "f 1534/1635/1531 1564/1682/1555 1565/1684/1557\n"
-                                   "f 1521/1637/1532 1551/1683/1556 1552/1685/1558\n"
-                                   "f 1534/1635/1531 1566/1686/1559 1535/1638/1533\n"
-                                   "f 1521/1637/1532 1553/1687/1560 1522/1640/1534\n"
-                                   "f 1535/1638/1533 1567/1688/1561 1536/1642/1535\n"
-                                   "f 1523/1645/1536 1553/1687/1560 1554/1689/1562\n"
-                                   "f 1537/1647/1537 1567/1688/1561 1568/1690/1563\n"
-                                   "f 1523/1645/1536 1555/1691/1564 1524/1648/1538\n"
-                                   "f 1511/1652/1539 1448/1692/43 1542/1693/1565\n"
-                                   "f 1538/1653/1540 1568/1690/1563 1569/1694/1566\n"
-                                   "f 1525/1656/1541 1555/1691/1564 1556/1695/1567\n"
-                                   "f 1511/1652/1539 1543/1696/1568 1512/1657/1542\n"
-                                   "f 1538/1653/1540 1570/1697/1569 1539/1660/1543\n"
-                                   "f 1526/1662/1544 1556/1695/1567 1557/1698/1570\n"
-                                   "f 1513/1664/1545 1543/1696/1568 1544/1699/1571\n"
-                                   "f 1540/1665/1546 1570/1697/1569 1571/1700/1572\n"
-                                   "f 1526/1662/1544 1558/1701/1573 1527/1667/1547\n"
-                                   "f 1514/1670/1548 1544/1699/1571 1545/1702/1574\n"
-                                   "f 1541/1672/1549 1571/1700/1572 1572/1703/1575\n"
-                                   "f 1527/1667/1547 1559/1704/1576 1528/1673/1550\n"
-                                   "f 1514/1670/1548 1546/1705/1577 1515/1675/1551\n"
-                                   "f 1137/1706/1 1541/1672/1549 1572/1703/1575\n"
-                                   "f 1529/1678/1552 1559/1704/1576 1560/1707/1578\n"
-                                   "f 1515/1675/1551 1547/1708/1579 1516/1620/1523\n"
-                                   "f 1529/1678/1552 1561/1709/1580 1530/1617/1522\n"
-                                   "f 1517/1621/1524 1547/1708/1579 1548/1710/1581\n"
-                                   "f 1530/1617/1522 1562/1711/1582 1531/1622/1525\n"
-                                   "f 1518/1625/1526 1548/1710/1581 1549/1712/1583\n"
-                                   "f 1565/1684/1557 1595/1713/1584 1596/1714/1585\n"
-                                   "f 1552/1685/1558 1582/1715/1586 1583/1716/1587\n"
-                                   "f 1565/1684/1557 1597/1717/1588 1566/1686/1559\n"
-                                   "f 1552/1685/1558 1584/1718/1589 1553/1687/1560\n"
-                                   "f 1566/1686/1559 1598/1719/1590 1567/1688/1561\n"
-                                   "f 1554/1689/1562 1584/1718/1589 1585/1720/1591\n"
-                                   "f 1568/1690/1563 1598/1719/1590 1599/1721/1592\n"
-                                   "f 1554/1689/1562 1586/1722/1593 1555/1691/1564\n"
-                                   "f 1542/1693/1565 1448/1723/43 1573/1724/1594\n"
-                                   "f 1568/1690/1563 1600/1725/1595 1569/1694/1566\n"
-                                   "f 1556/1695/1567 1586/1722/1593 1587/1726/1596\n"
-                                   "f 1542/1693/1565 1574/1727/1597 1543/1696/1568\n"
-                                   "f 1570/1697/1569 1600/1725/1595 1601/1728/1598\n"
-                                   "f 1557/1698/1570 1587/1726/1596 1588/1729/1599\n"
-                                   "f 1544/1699/1571 1574/1727/1597 1575/1730/1600\n"
-                                   "f 1570/1697/1569 1602/1731/1601 1571/1700/1572\n"
-                                   "f 1557/1698/1570 1589/1732/1602 1558/1701/1573\n"
-                                   "f 1545/1702/1574 1575/1730/1600 1576/1733/1603\n"
-                                   "f 1572/1703/1575 1602/1731/1601 1603/1734/1604\n"
-                                   "f 1558/1701/1573 1590/1735/1605 1559/1704/1576\n"
-                                   "f 1545/1702/1574 1577/1736/1606 1546/1705/1577\n"
-                                   "f 1137/1737/1 1572/1703/1575 1603/1734/1604\n"
-                                   "f 1560/1707/1578 1590/1735/1605 1591/1738/1607\n"
-                                   "f 1546/1705/1577 1578/1739/1608 1547/1708/1579\n"
-                                   "f 1560/1707/1578 1592/1740/1609 1561/1709/1580\n"
-                                   "f 1548/1710/1581 1578/1739/1608 1579/1741/1610\n"
-                                   "f 1561/1709/1580 1593/1742/1611 1562/1711/1582\n"
-                                   "f 1549/1712/1583 1579/1741/1610 1580/1743/1612\n"
-                                   "f 1562/1711/1582 1594/1744/1613 1563/1680/1553\n"
-                                   "f 1549/1712/1583 1581/1745/1614 1550/1681/1554\n"
-                                   "f 1564/1682/1555 1594/1744/1613 1595/1713/1584\n"
-                                   "f 1550/1681/1554 1582/1715/1586 1551/1683/1556\n"
-                                   "f 1596/1714/1585 1628/1746/1615 1597/1717/1588\n"
-                                   "f 1583/1716/1587 1615/1747/1616 1584/1718/1589\n"
-                                   "f 1597/1717/1588 1629/1748/1617 1598/1719/1590\n"
-                                   "f 1585/1720/1591 1615/1747/1616 1616/1749/1618\n"
-                                   "f 1599/1721/1592 1629/1748/1617 1630/1750/1619\n"
-                                   "f 1585/1720/1591 1617/1751/1620 1586/1722/1593\n"
-                                   "f 1573/1724/1594 1448/1752/43 1604/1753/1621\n"
-                                   "f 1599/1721/1592 1631/1754/1622 1600/1725/1595\n"
-                                   "f 1587/1726/1596 1617/1751/1620 1618/1755/1623\n"
-                                   "f 1573/1724/1594 1605/1756/1624 1574/1727/1597\n"
-                                   "f 1600/1725/1595 1632/1757/1625 1601/1728/1598\n"
-                                   "f 1588/1729/1599 1618/1755/1623 1619/1758/1626\n"
-                                   "f 1574/1727/1597 1606/1759/1627 1575/1730/1600\n"
-                                   "f 1601/1728/1598 1633/1760/1628 1602/1731/1601\n"
-                                   "f 1588/1729/1599 1620/1761/1629 1589/1732/1602\n"
-                                   "f 1576/1733/1603 1606/1759/1627 1607/1762/1630\n"
-                                   "f 1602/1731/1601 1634/1763/1631 1603/1734/1604\n"
-                                   "f 1589/1732/1602 1621/1764/1632 1590/1735/1605\n"
-                                   "f 1576/1733/1603 1608/1765/1633 1577/1736/1606\n"
-                                   "f 1137/1766/1 1603/1734/1604 1634/1763/1631\n"
-                                   "f 1591/1738/1607 1621/1764/1632 1622/1767/1634\n"
-                                   "f 1577/1736/1606 1609/1768/1635 1578/1739/1608\n"
-                                   "f 1591/1738/1607 1623/1769/1636 1592/1740/1609\n"
-                                   "f 1579/1741/1610 1609/1768/1635 1610/1770/1637\n"
-                                   "f 1593/1742/1611 1623/1769/1636 1624/1771/1638\n"
-                                   "f 1580/1743/1612 1610/1770/1637 1611/1772/1639\n"
-                                   "f 1593/1742/1611 1625/1773/1640 1594/1744/1613\n"
-                                   "f 1580/1743/1612 1612/1774/1641 1581/1745/1614\n"
-                                   "f 1595/1713/1584 1625/1773/1640 1626/1775/1642\n"
-                                   "f 1581/1745/1614 1613/1776/1643 1582/1715/1586\n"
-                                   "f 1596/1714/1585 1626/1775/1642 1627/1777/1644\n"
-                                   "f 1583/1716/1587 1613/1776/1643 1614/1778/1645\n"
-                                   "f 1630/1750/1619 1660/1779/1646 1661/1780/1647\n"
-                                   "f 1616/1749/1618 1648/1781/1648 1617/1751/1620\n"
-                                   "f 1604/1753/1621 1448/1782/43 1635/1783/1649\n"
-                                   "f 1630/1750/1619 1662/1784/1650 1631/1754/1622\n"
-                                   "f 1618/1755/1623 1648/1781/1648 1649/1785/1651\n"
-                                   "f 1604/1753/1621 1636/1786/1652 1605/1756/1624\n"
-                                   "f 1632/1757/1625 1662/1784/1650 1663/1787/1653\n"
-                                   "f 1619/1758/1626 1649/1785/1651 1650/1788/1654\n"
-                                   "f 1606/1759/1627 1636/1786/1652 1637/1789/1655\n"
-                                   "f 1632/1757/1625 1664/1790/1656 1633/1760/1628\n"
-                                   "f 1619/1758/1626 1651/1791/1657 1620/1761/1629\n"
-                                   "f 1607/1762/1630 1637/1789/1655 1638/1792/1658\n"
-                                   "f 1633/1760/1628 1665/1793/1659 1634/1763/1631\n"
-                                   "f 1620/1761/1629 1652/1794/1660 1621/1764/1632\n"
-                                   "f 1607/1762/1630 1639/1795/1661 1608/1765/1633\n"
-                                   "f 1137/1796/1 1634/1763/1631 1665/1793/1659\n"
-                                   "f 1622/1767/1634 1652/1794/1660 1653/1797/1662\n"
-                                   "f 1608/1765/1633 1640/1798/1663 1609/1768/1635\n"
-                                   "f 1622/1767/1634 1654/1799/1664 1623/1769/1636\n"
-                                   "f 1610/1770/1637 1640/1798/1663 1641/1800/1665\n"
-                                   "f 1623/1769/1636 1655/1801/1666 1624/1771/1638\n"
-                                   "f 1611/1772/1639 1641/1800/1665 1642/1802/1667\n"
-                                   "f 1624/1771/1638 1656/1803/1668 1625/1773/1640\n"
-                                   "f 1611/1772/1639 1643/1804/1669 1612/1774/1641\n"
-                                   "f 1626/1775/1642 1656/1803/1668 1657/1805/1670\n"
-                                   "f 1612/1774/1641 1644/1806/1671 1613/1776/1643\n"
-                                   "f 1627/1777/1644 1657/1805/1670 1658/1807/1672\n"
-                                   "f 1614/1778/1645 1644/1806/1671 1645/1808/1673\n"
-                                   "f 1627/1777/1644 1659/1809/1674 1628/1746/1615\n"
-                                   "f 1614/1778/1645 1646/1810/1675 1615/1747/1616\n"
-                                   "f 1628/1746/1615 1660/1779/1646 1629/1748/1617\n"
-                                   "f 1616/1749/1618 1646/1810/1675 1647/1811/1676\n"
-                                   "f 1635/1783/1649 1667/1812/1677 1636/1786/1652\n"
-                                   "f 1663/1787/1653 1693/1813/1678 1694/1814/1679\n"
-                                   "f 1650/1788/1654 1680/1815/1680 1681/1816/1681\n"
-                                   "f 1637/1789/1655 1667/1812/1677 1668/1817/1682\n"
-                                   "f 1663/1787/1653 1695/1818/1683 1664/1790/1656\n"
-                                   "f 1650/1788/1654 1682/1819/1684 1651/1791/1657\n"
-                                   "f 1637/1789/1655 1669/1820/1685 1638/1792/1658\n"
-                                   "f 1665/1793/1659 1695/1818/1683 1696/1821/1686\n"
-                                   "f 1651/1791/1657 1683/1822/1687 1652/1794/1660\n"
-                                   "f 1638/1792/1658 1670/1823/1688 1639/1795/1661\n"
-                                   "f 1137/1824/1 1665/1793/1659 1696/1821/1686\n"
-                                   "f 1653/1797/1662 1683/1822/1687 1684/1825/1689\n"
-                                   "f 1639/1795/1661 1671/1826/1690 1640/1798/1663\n"
-                                   "f 1654/1799/1664 1684/1825/1689 1685/1827/1691\n"
-                                   "f 1641/1800/1665 1671/1826/1690 1672/1828/1692\n"
-                                   "f 1654/1799/1664 1686/1829/1693 1655/1801/1666\n"
-                                   "f 1642/1802/1667 1672/1828/1692 1673/1830/1694\n"
-                                   "f 1655/1801/1666 1687/1831/1695 1656/1803/1668\n"
-                                   "f 1642/1802/1667 1674/1832/1696 1643/1804/1669\n"
-                                   "f 1657/1805/1670 1687/1831/1695 1688/1833/1697\n"
-                                   "f 1643/1804/1669 1675/1834/1698 1644/1806/1671\n"
-                                   "f 1658/1807/1672 1688/1833/1697 1689/1835/1699\n"
-                                   "f 1645/1808/1673 1675/1834/1698 1676/1836/1700\n"
-                                   "f 1658/1807/1672 1690/1837/1701 1659/1809/1674\n"
-                                   "f 1645/1808/1673 1677/1838/1702 1646/1810/1675\n"
-                                   "f 1659/1809/1674 1691/1839/1703 1660/1779/1646\n"
-                                   "f 1647/1811/1676 1677/1838/1702 1678/1840/1704\n"
-                                   "f 1661/1780/1647 1691/1839/1703 1692/1841/1705\n"
-                                   "f 1647/1811/1676 1679/1842/1706 1648/1781/1648\n"
-                                   "f 1635/1783/1649 1448/1843/43 1666/1844/1707\n"
-                                   "f 1661/1780/1647 1693/1813/1678 1662/1784/1650\n"
-                                   "f 1649/1785/1651 1679/1842/1706 1680/1815/1680\n"
-                                   "f 1669/1820/1685 1699/1845/1708 1700/1846/1709\n"
-                                   "f 1695/1818/1683 1727/1847/1710 1696/1821/1686\n"
-                                   "f 1682/1819/1684 1714/1848/1711 1683/1822/1687\n"
-                                   "f 1670/1823/1688 1700/1846/1709 1701/1849/1712\n"
-                                   "f 1137/1850/1 1696/1821/1686 1727/1847/1710\n"
-                                   "f 1684/1825/1689 1714/1848/1711 1715/1851/1713\n"
-                                   "f 1670/1823/1688 1702/1852/1714 1671/1826/1690\n"
-                                   "f 1684/1825/1689 1716/1853/1715 1685/1827/1691\n"
-                                   "f 1672/1828/1692 1702/1852/1714 1703/1854/1716\n"
-                                   "f 1685/1827/1691 1717/1855/1717 1686/1829/1693\n"
-                                   "f 1673/1830/1694 1703/1854/1716 1704/1856/1718\n"
-                                   "f 1686/1829/1693 1718/1857/1719 1687/1831/1695\n"
-                                   "f 1673/1830/1694 1705/1858/1720 1674/1832/1696\n"
-                                   "f 1688/1833/1697 1718/1857/1719 1719/1859/1721\n"
-                                   "f 1674/1832/1696 1706/1860/1722 1675/1834/1698\n"
-                                   "f 1689/1835/1699 1719/1859/1721 1720/1861/1723\n"
-                                   "f 1676/1836/1700 1706/1860/1722 1707/1862/1724\n"
-                                   "f 1689/1835/1699 1721/1863/1725 1690/1837/1701\n"
-                                   "f 1676/1836/1700 1708/1864/1726 1677/1838/1702\n"
-                                   "f 1690/1837/1701 1722/1865/1727 1691/1839/1703\n"
-                                   "f 1678/1840/1704 1708/1864/1726 1709/1866/1728\n"
-                                   "f 1692/1841/1705 1722/1865/1727 1723/1867/1729\n"
-                                   "f 1678/1840/1704 1710/1868/1730 1679/1842/1706\n"
-                                   "f 1666/1844/1707 1448/1869/43 1697/1870/1731\n"
-                                   "f 1692/1841/1705 1724/1871/1732 1693/1813/1678\n"
-                                   "f 1680/1815/1680 1710/1868/1730 1711/1872/1733\n"
-                                   "f 1666/1844/1707 1698/1873/1734 1667/1812/1677\n"
-                                   "f 1694/1814/1679 1724/1871/1732 1725/1874/1735\n"
-                                   "f 1681/1816/1681 1711/1872/1733 1712/1875/1736\n"
-                                   "f 1668/1817/1682 1698/1873/1734 1699/1845/1708\n"
-                                   "f 1694/1814/1679 1726/1876/1737 1695/1818/1683\n"
-                                   "f 1681/1816/1681 1713/1877/1738 1682/1819/1684\n"
-                                   "f 1701/1849/1712 1733/1878/1739 1702/1852/1714\n"
-                                   "f 1715/1851/1713 1747/1879/1740 1716/1853/1715\n"
-                                   "f 1703/1854/1716 1733/1878/1739 1734/1880/1741\n"
-                                   "f 1716/1853/1715 1748/1881/1742 1717/1855/1717\n"
-                                   "f 1704/1856/1718 1734/1880/1741 1735/1882/1743\n"
-                                   "f 1717/1855/1717 1749/1883/1744 1718/1857/1719\n"
-                                   "f 1704/1856/1718 1736/1884/1745 1705/1858/1720\n"
-                                   "f 1719/1859/1721 1749/1883/1744 1750/1885/1746\n"
-                                   "f 1705/1858/1720 1737/1886/1747 1706/1860/1722\n"
-                                   "f 1720/1861/1723 1750/1885/1746 1751/1887/1748\n"
-                                   "f 1707/1862/1724 1737/1886/1747 1738/1888/1749\n"
-                                   "f 1720/1861/1723 1752/1889/1750 1721/1863/1725\n"
-                                   "f 1707/1862/1724 1739/1890/1751 1708/1864/1726\n"
-                                   "f 1721/1863/1725 1753/1891/1752 1722/1865/1727\n"
-                                   "f 1709/1866/1728 1739/1890/1751 1740/1892/1753\n"
-                                   "f 1723/1867/1729 1753/1891/1752 1754/1893/1754\n"
-                                   "f 1709/1866/1728 1741/1894/1755 1710/1868/1730\n"
-                                   "f 1697/1870/1731 1448/1895/43 1728/1896/1756\n"
-                                   "f 1723/1867/1729 1755/1897/1757 1724/1871/1732\n"
-                                   "f 1711/1872/1733 1741/1894/1755 1742/1898/1758\n"
-                                   "f 1697/1870/1731 1729/1899/1759 1698/1873/1734\n"
-                                   "f 1725/1874/1735 1755/1897/1757 1756/1900/1760\n"
-                                   "f 1712/1875/1736 1742/1898/1758 1743/1901/1761\n"
-                                   "f 1699/1845/1708 1729/1899/1759 1730/1902/1762\n"
-                                   "f 1725/1874/1735 1757/1903/1763 1726/1876/1737\n"
-                                   "f 1712/1875/1736 1744/1904/1764 1713/1877/1738\n"
-                                   "f 1700/1846/1709 1730/1902/1762 1731/1905/1765\n"
-                                   "f 1727/1847/1710 1757/1903/1763 1758/1906/1766\n"
-                                   "f 1713/1877/1738 1745/1907/1767 1714/1848/1711\n"
-                                   "f 1701/1849/1712 1731/1905/1765 1732/1908/1768\n"
-                                   "f 1137/1909/1 1727/1847/1710 1758/1906/1766\n"
-                                   "f 1715/1851/1713 1745/1907/1767 1746/1910/1769\n"
-                                   "f 1735/1882/1743 1765/1911/1770 1766/1912/1771\n"
-                                   "f 1748/1881/1742 1780/1913/1772 1749/1883/1744\n"
-                                   "f 1735/1882/1743 1767/1914/1773 1736/1884/1745\n"
-                                   "f 1750/1885/1746 1780/1913/1772 1781/1915/1774\n"
-                                   "f 1736/1884/1745 1768/1916/1775 1737/1886/1747\n"
-                                   "f 1751/1887/1748 1781/1915/1774 1782/1917/1776\n"
-                                   "f 1738/1888/1749 1768/1916/1775 1769/1918/1777\n"
-                                   "f 1751/1887/1748 1783/1919/1778 1752/1889/1750\n"
-                                   "f 1738/1888/1749 1770/1920/1779 1739/1890/1751\n"
-                                   "f 1752/1889/1750 1784/1921/1780 1753/1891/1752\n"
-                                   "f 1740/1892/1753 1770/1920/1779 1771/1922/1781\n"
-                                   "f 1754/1893/1754 1784/1921/1780 1785/1923/1782\n"
-                                   "f 1740/1892/1753 1772/1924/1783 1741/1894/1755\n"
-                                   "f 1728/1896/1756 1448/1925/43 1759/1926/1784\n"
-                                   "f 1754/1893/1754 1786/1927/1785 1755/1897/1757\n"
-                                   "f 1742/1898/1758 1772/1924/1783 1773/1928/1786\n"
-                                   "f 1729/1899/1759 1759/1926/1784 1760/1929/1787\n"
-                                   "f 1756/1900/1760 1786/1927/1785 1787/1930/1788\n"
-                                   "f 1743/1901/1761 1773/1928/1786 1774/1931/1789\n"
-                                   "f 1729/1899/1759 1761/1932/1790 1730/1902/1762\n"
-                                   "f 1756/1900/1760 1788/1933/1791 1757/1903/1763\n"
-                                   "f 1743/1901/1761 1775/1934/1792 1744/1904/1764\n"
-                                   "f 1730/1902/1762 1762/1935/1793 1731/1905/1765\n"
-                                   "f 1757/1903/1763 1789/1936/1794 1758/1906/1766\n"
-                                   "f 1744/1904/1764 1776/1937/1795 1745/1907/1767\n"
-                                   "f 1731/1905/1765 1763/1938/1796 1732/1908/1768\n"
-                                   "f 1137/1939/1 1758/1906/1766 1789/1936/1794\n"
-                                   "f 1746/1910/1769 1776/1937/1795 1777/1940/1797\n"
-                                   "f 1732/1908/1768 1764/1941/1798 1733/1878/1739\n"
-                                   "f 1746/1910/1769 1778/1942/1799 1747/1879/1740\n"
-                                   "f 1734/1880/1741 1764/1941/1798 1765/1911/1770\n"
-                                   "f 1747/1879/1740 1779/1943/1800 1748/1881/1742\n"
-                                   "f 1767/1914/1773 1799/1944/1801 1768/1916/1775\n"
-                                   "f 1782/1917/1776 1812/1945/1802 1813/1946/1803\n"
-                                   "f 1769/1918/1777 1799/1944/1801 1800/1947/1804\n"
-                                   "f 1782/1917/1776 1814/1948/1805 1783/1919/1778\n"
-                                   "f 1769/1918/1777 1801/1949/1806 1770/1920/1779\n"
-                                   "f 1783/1919/1778 1815/1950/1807 1784/1921/1780\n"
-                                   "f 1771/1922/1781 1801/1949/1806 1802/1951/1808\n"
-                                   "f 1785/1923/1782 1815/1950/1807 1816/1952/1809\n"
-                                   "f 1771/1922/1781 1803/1953/1810 1772/1924/1783\n"
-                                   "f 1759/1926/1784 1448/1954/43 1790/1955/1811\n"
-                                   "f 1786/1927/1785 1816/1952/1809 1817/1956/1812\n"
-                                   "f 1773/1928/1786 1803/1953/1810 1804/1957/1813\n"
-                                   "f 1759/1926/1784 1791/1958/1814 1760/1929/1787\n"
-                                   "f 1787/1930/1788 1817/1956/1812 1818/1959/1815\n"
-                                   "f 1774/1931/1789 1804/1957/1813 1805/1960/1816\n"
-                                   "f 1761/1932/1790 1791/1958/1814 1792/1961/1817\n"
-                                   "f 1787/1930/1788 1819/1962/1818 1788/1933/1791\n"
-                                   "f 1774/1931/1789 1806/1963/1819 1775/1934/1792\n"
-                                   "f 1762/1935/1793 1792/1961/1817 1793/1964/1820\n"
-                                   "f 1789/1936/1794 1819/1962/1818 1820/1965/1821\n"
-                                   "f 1775/1934/1792 1807/1966/1822 1776/1937/1795\n"
-                                   "f 1762/1935/1793 1794/1967/1823 1763/1938/1796\n"
-                                   "f 1137/1968/1 1789/1936/1794 1820/1965/1821\n"
-                                   "f 1777/1940/1797 1807/1966/1822 1808/1969/1824\n"
-                                   "f 1763/1938/1796 1795/1970/1825 1764/1941/1798\n"
-                                   "f 1778/1942/1799 1808/1969/1824 1809/1971/1826\n"
-                                   "f 1765/1911/1770 1795/1970/1825 1796/1972/1827\n"
-                                   "f 1778/1942/1799 1810/1973/1828 1779/1943/1800\n"
-                                   "f 1766/1912/1771 1796/1972/1827 1797/1974/1829\n"
-                                   "f 1779/1943/1800 1811/1975/1830 1780/1913/1772\n"
-                                   "f 1766/1912/1771 1798/1976/1831 1767/1914/1773\n"
-                                   "f 1781/1915/1774 1811/1975/1830 1812/1945/1802\n"
-                                   "f 1800/1947/1804 1832/1977/1832 1801/1949/1806\n"
-                                   "f 1814/1948/1805 1846/1978/1833 1815/1950/1807\n"
-                                   "f 1802/1951/1808 1832/1977/1832 1833/1979/1834\n"
-                                   "f 1816/1952/1809 1846/1978/1833 1847/1980/1835\n"
-                                   "f 1802/1951/1808 1834/1981/1836 1803/1953/1810\n"
-                                   "f 1790/1955/1811 1448/1982/43 1821/1983/1837\n"
-                                   "f 1816/1952/1809 1848/1984/1838 1817/1956/1812\n"
-                                   "f 1804/1957/1813 1834/1981/1836 1835/1985/1839\n"
-                                   "f 1790/1955/1811 1822/1986/1840 1791/1958/1814\n"
-                                   "f 1818/1959/1815 1848/1984/1838 1849/1987/1841\n"
-                                   "f 1805/1960/1816 1835/1985/1839 1836/1988/1842\n"
-                                   "f 1792/1961/1817 1822/1986/1840 1823/1989/1843\n"
-                                   "f 1818/1959/1815 1850/1990/1844 1819/1962/1818\n"
-                                   "f 1805/1960/1816 1837/1991/1845 1806/1963/1819\n"
-                                   "f 1793/1964/1820 1823/1989/1843 1824/1992/1846\n"
-                                   "f 1820/1965/1821 1850/1990/1844 1851/1993/1847\n"
-                                   "f 1806/1963/1819 1838/1994/1848 1807/1966/1822\n"
-                                   "f 1793/1964/1820 1825/1995/1849 1794/1967/1823\n"
-                                   "f 1137/1996/1 1820/1965/1821 1851/1993/1847\n"
-                                   "f 1808/1969/1824 1838/1994/1848 1839/1997/1850\n"
-                                   "f 1794/1967/1823 1826/1998/1851 1795/1970/1825\n"
-                                   "f 1808/1969/1824 1840/1999/1852 1809/1971/1826\n"
-                                   "f 1796/1972/1827 1826/1998/1851 1827/2000/1853\n"
-                                   "f 1809/1971/1826 1841/2001/1854 1810/1973/1828\n"
-                                   "f 1797/1974/1829 1827/2000/1853 1828/2002/1855\n"
-                                   "f 1810/1973/1828 1842/2003/1856 1811/1975/1830\n"
-                                   "f 1797/1974/1829 1829/2004/1857 1798/1976/1831\n"
-                                   "f 1812/1945/1802 1842/2003/1856 1843/2005/1858\n"
-                                   "f 1798/1976/1831 1830/2006/1859 1799/1944/1801\n"
-                                   "f 1813/1946/1803 1843/2005/1858 1844/2007/1860\n"
-                                   "f 1800/1947/1804 1830/2006/1859 1831/2008/1861\n"
-                                   "f 1813/1946/1803 1845/2009/1862 1814/1948/1805\n"
-                                   "f 1833/1979/1834 1865/2010/1863 1834/1981/1836\n"
-                                   "f 1821/1983/1837 1448/2011/43 1852/2012/1864\n"
-                                   "f 1847/1980/1835 1879/2013/1865 1848/1984/1838\n"
-                                   "f 1835/1985/1839 1865/2010/1863 1866/2014/1866\n"
-                                   "f 1821/1983/1837 1853/2015/1867 1822/1986/1840\n"
-                                   "f 1849/1987/1841 1879/2013/1865 1880/2016/1868\n"
-                                   "f 1836/1988/1842 1866/2014/1866 1867/2017/1869\n"
-                                   "f 1823/1989/1843 1853/2015/1867 1854/2018/1870\n"
-                                   "f 1849/1987/1841 1881/2019/1871 1850/1990/1844\n"
-                                   "f 1836/1988/1842 1868/2020/1872 1837/1991/1845\n"
-                                   "f 1824/1992/1846 1854/2018/1870 1855/2021/1873\n"
-                                   "f 1851/1993/1847 1881/2019/1871 1882/2022/1874\n"
-                                   "f 1837/1991/1845 1869/2023/1875 1838/1994/1848\n"
-                                   "f 1824/1992/1846 1856/2024/1876 1825/1995/1849\n"
-                                   "f 1137/2025/1 1851/1993/1847 1882/2022/1874\n"
-                                   "f 1839/1997/1850 1869/2023/1875 1870/2026/1877\n"
-                                   "f 1825/1995/1849 1857/2027/1878 1826/1998/1851\n"
-                                   "f 1839/1997/1850 1871/2028/1879 1840/1999/1852\n"
-                                   "f 1827/2000/1853 1857/2027/1878 1858/2029/1880\n"
-                                   "f 1840/1999/1852 1872/2030/1881 1841/2001/1854\n"
-                                   "f 1828/2002/1855 1858/2029/1880 1859/2031/1882\n"
-                                   "f 1841/2001/1854 1873/2032/1883 1842/2003/1856\n"
-                                   "f 1828/2002/1855 1860/2033/1884 1829/2004/1857\n"
-                                   "f 1843/2005/1858 1873/2032/1883 1874/2034/1885\n"
-                                   "f 1829/2004/1857 1861/2035/1886 1830/2006/1859\n"
-                                   "f 1844/2007/1860 1874/2034/1885 1875/2036/1887\n"
-                                   "f 1831/2008/1861 1861/2035/1886 1862/2037/1888\n"
-                                   "f 1844/2007/1860 1876/2038/1889 1845/2009/1862\n"
-                                   "f 1831/2008/1861 1863/2039/1890 1832/1977/1832\n"
-                                   "f 1845/2009/1862 1877/2040/1891 1846/1978/1833\n"
-                                   "f 1833/1979/1834 1863/2039/1890 1864/2041/1892\n"
-                                   "f 1847/1980/1835 1877/2040/1891 1878/2042/1893\n"
-                                   "f 1867/2017/1869 1897/2043/1894 1898/2044/1895\n"
-                                   "f 1853/2015/1867 1885/2045/1896 1854/2018/1870\n"
-                                   "f 1880/2016/1868 1912/2046/1897 1881/2019/1871\n"
-                                   "f 1867/2017/1869 1899/2047/1898 1868/2020/1872\n"
-                                   "f 1855/2021/1873 1885/2045/1896 1886/2048/1899\n"
-                                   "f 1881/2019/1871 1913/2049/1900 1882/2022/1874\n"
-                                   "f 1868/2020/1872 1900/2050/1901 1869/2023/1875\n"
-                                   "f 1855/2021/1873 1887/2051/1902 1856/2024/1876\n"
-                                   "f 1137/2052/1 1882/2022/1874 1913/2049/1900\n"
-                                   "f 1870/2026/1877 1900/2050/1901 1901/2053/1903\n"
-                                   "f 1856/2024/1876 1888/2054/1904 1857/2027/1878\n"
-                                   "f 1870/2026/1877 1902/2055/1905 1871/2028/1879\n"
-                                   "f 1858/2029/1880 1888/2054/1904 1889/2056/1906\n"
-                                   "f 1872/2030/1881 1902/2055/1905 1903/2057/1907\n"
-                                   "f 1859/2031/1882 1889/2056/1906 1890/2058/1908\n"
-                                   "f 1872/2030/1881 1904/2059/1909 1873/2032/1883\n"
-                                   "f 1859/2031/1882 1891/2060/1910 1860/2033/1884\n"
-                                   "f 1874/2034/1885 1904/2059/1909 1905/2061/1911\n"
-                                   "f 1860/2033/1884 1892/2062/1912 1861/2035/1886\n"
-                                   "f 1875/2036/1887 1905/2061/1911 1906/2063/1913\n"
-                                   "f 1862/2037/1888 1892/2062/1912 1893/2064/1914\n"
-                                   "f 1875/2036/1887 1907/2065/1915 1876/2038/1889\n"
-                                   "f 1862/2037/1888 1894/2066/1916 1863/2039/1890\n"
-                                   "f 1876/2038/1889 1908/2067/1917 1877/2040/1891\n"
-                                   "f 1864/2041/1892 1894/2066/1916 1895/2068/1918\n"
-                                   "f 1878/2042/1893 1908/2067/1917 1909/2069/1919\n"
-                                   "f 1864/2041/1892 1896/2070/1920 1865/2010/1863\n"
-                                   "f 1852/2012/1864 1448/2071/43 1883/2072/1921\n"
-                                   "f 1878/2042/1893 1910/2073/1922 1879/2013/1865\n"
-                                   "f 1866/2014/1866 1896/2070/1920 1897/2043/1894\n"
-                                   "f 1852/2012/1864 1884/2074/1923 1853/2015/1867\n"
-                                   "f 1880/2016/1868 1910/2073/1922 1911/2075/1924\n"
-                                   "f 1899/2047/1898 1931/2076/1925 1900/2050/1901\n"
-                                   "f 1886/2048/1899 1918/2077/1926 1887/2051/1902\n"
-                                   "f 1137/2078/1 1913/2049/1900 1944/2079/1927\n"
-                                   "f 1901/2053/1903 1931/2076/1925 1932/2080/1928\n"
-                                   "f 1887/2051/1902 1919/2081/1929 1888/2054/1904\n"
-                                   "f 1901/2053/1903 1933/2082/1930 1902/2055/1905\n"
-                                   "f 1889/2056/1906 1919/2081/1929 1920/2083/1931\n"
-                                   "f 1903/2057/1907 1933/2082/1930 1934/2084/1932\n"
-                                   "f 1889/2056/1906 1921/2085/1933 1890/2058/1908\n"
-                                   "f 1903/2057/1907 1935/2086/1934 1904/2059/1909\n"
-                                   "f 1890/2058/1908 1922/2087/1935 1891/2060/1910\n"
-                                   "f 1905/2061/1911 1935/2086/1934 1936/2088/1936\n"
-                                   "f 1891/2060/1910 1923/2089/1937 1892/2062/1912\n"
-                                   "f 1906/2063/1913 1936/2088/1936 1937/2090/1938\n"
-                                   "f 1893/2064/1914 1923/2089/1937 1924/2091/1939\n"
-                                   "f 1906/2063/1913 1938/2092/1940 1907/2065/1915\n"
-                                   "f 1893/2064/1914 1925/2093/1941 1894/2066/1916\n"
-                                   "f 1907/2065/1915 1939/2094/1942 1908/2067/1917\n"
-                                   "f 1895/2068/1918 1925/2093/1941 1926/2095/1943\n"
-                                   "f 1909/2069/1919 1939/2094/1942 1940/2096/1944\n"
-                                   "f 1895/2068/1918 1927/2097/1945 1896/2070/1920\n"
-                                   "f 1883/2072/1921 1448/2098/43 1914/2099/1946\n"
-                                   "f 1910/2073/1922 1940/2096/1944 1941/2100/1947\n"
-                                   "f 1897/2043/1894 1927/2097/1945 1928/2101/1948\n"
-                                   "f 1883/2072/1921 1915/2102/1949 1884/2074/1923\n"
-                                   "f 1911/2075/1924 1941/2100/1947 1942/2103/1950\n"
-                                   "f 1898/2044/1895 1928/2101/1948 1929/2104/1951\n"
-                                   "f 1885/2045/1896 1915/2102/1949 1916/2105/1952\n"
-                                   "f 1911/2075/1924 1943/2106/1953 1912/2046/1897\n"
-                                   "f 1898/2044/1895 1930/2107/1954 1899/2047/1898\n"
-                                   "f 1886/2048/1899 1916/2105/1952 1917/2108/1955\n"
-                                   "f 1912/2046/1897 1944/2079/1927 1913/2049/1900\n"
-                                   "f 1932/2080/1928 1964/2109/1956 1933/2082/1930\n"
-                                   "f 1920/2083/1931 1950/2110/1957 1951/2111/1958\n"
-                                   "f 1934/2084/1932 1964/2109/1956 1965/2112/1959\n"
-                                   "f 1921/2085/1933 1951/2111/1958 1952/2113/1960\n"
-                                   "f 1934/2084/1932 1966/2114/1961 1935/2086/1934\n"
-                                   "f 1921/2085/1933 1953/2115/1962 1922/2087/1935\n"
-                                   "f 1936/2088/1936 1966/2114/1961 1967/2116/1963\n"
-                                   "f 1922/2087/1935 1954/2117/1964 1923/2089/1937\n"
-                                   "f 1937/2090/1938 1967/2116/1963 1968/2118/1965\n"
-                                   "f 1924/2091/1939 1954/2117/1964 1955/2119/1966\n"
-                                   "f 1937/2090/1938 1969/2120/1967 1938/2092/1940\n"
-                                   "f 1924/2091/1939 1956/2121/1968 1925/2093/1941\n"
-                                   "f 1938/2092/1940 1970/2122/1969 1939/2094/1942\n"
-                                   "f 1926/2095/1943 1956/2121/1968 1957/2123/1970\n"
-                                   "f 1940/2096/1944 1970/2122/1969 1971/2124/1971\n"
-                                   "f 1926/2095/1943 1958/2125/1972 1927/2097/1945\n"
-                                   "f 1914/2099/1946 1448/2126/43 1945/2127/1973\n"
-                                   "f 1941/2100/1947 1971/2124/1971 1972/2128/1974\n"
-                                   "f 1928/2101/1948 1958/2125/1972 1959/2129/1975\n"
-                                   "f 1914/2099/1946 1946/2130/1976 1915/2102/1949\n"
-                                   "f 1942/2103/1950 1972/2128/1974 1973/2131/1977\n"
-                                   "f 1929/2104/1951 1959/2129/1975 1960/2132/1978\n"
-                                   "f 1916/2105/1952 1946/2130/1976 1947/2133/1979\n"
-                                   "f 1942/2103/1950 1974/2134/1980 1943/2106/1953\n"
-                                   "f 1929/2104/1951 1961/2135/1981 1930/2107/1954\n"
-                                   "f 1917/2108/1955 1947/2133/1979 1948/2136/1982\n"
-                                   "f 1944/2079/1927 1974/2134/1980 1975/2137/1983\n"
-                                   "f 1930/2107/1954 1962/2138/1984 1931/2076/1925\n"
-                                   "f 1917/2108/1955 1949/2139/1985 1918/2077/1926\n"
-                                   "f 1137/2140/1 1944/2079/1927 1975/2137/1983\n"
-                                   "f 1932/2080/1928 1962/2138/1984 1963/2141/1986\n"
-                                   "f 1918/2077/1926 1950/2110/1957 1919/2081/1929\n"
-                                   "f 1965/2112/1959 1981/19/19 1966/2114/1961\n"
-                                   "f 1953/2115/1962 5/17/17 6/21/21\n"
-                                   "f 1967/2116/1963 1981/19/19 1982/23/23\n"
-                                   "f 1954/2117/1964 6/21/21 1979/25/25\n"
-                                   "f 1968/2118/1965 1982/23/23 17/27/27\n"
-                                   "f 1955/2119/1966 1979/25/25 7/29/29\n"
-                                   "f 1968/2118/1965 18/30/30 1969/2120/1967\n"
-                                   "f 1955/2119/1966 1980/32/32 1956/2121/1968\n"
-                                   "f 1969/2120/1967 1983/34/34 1970/2122/1969\n"
-                                   "f 1957/2123/1970 1980/32/32 8/36/36\n"
-                                   "f 1970/2122/1969 19/38/38 1971/2124/1971\n"
-                                   "f 1957/2123/1970 9/41/41 1958/2125/1972\n"
-                                   "f 1945/2127/1973 1448/2142/43 1/42/42\n"
-                                   "f 1971/2124/1971 1984/46/46 1972/2128/1974\n"
-                                   "f 1959/2129/1975 9/41/41 10/48/48\n"
-                                   "f 1946/2130/1976 1/42/42 1976/50/50\n"
-                                   "f 1973/2131/1977 1984/46/46 1985/52/52\n"
-                                   "f 1960/2132/1978 10/48/48 11/54/54\n"
-                                   "f 1946/2130/1976 2/56/56 1947/2133/1979\n"
-                                   "f 1973/2131/1977 1986/58/58 1974/2134/1980\n"
-                                   "f 1960/2132/1978 12/60/60 1961/2135/1981\n"
-                                   "f 1948/2136/1982 2/56/56 3/62/62\n"
-                                   "f 1974/2134/1980 20/2/2 1975/2137/1983\n"
-                                   "f 1961/2135/1981 13/4/4 1962/2138/1984\n"
-                                   "f 1949/2139/1985 3/62/62 1977/64/64\n"
-                                   "f 1137/2143/1 1975/2137/1983 20/2/2\n"
-                                   "f 1963/2141/1986 13/4/4 14/6/6\n"
-                                   "f 1949/2139/1985 1978/7/7 1950/2110/1957\n"
-                                   "f 1963/2141/1986 15/11/11 1964/2109/1956\n"
-                                   "f 1951/2111/1958 1978/7/7 4/13/13\n"
-                                   "f 1964/2109/1956 16/14/14 1965/2112/1959\n"
-                                   "f 1952/2113/1960 4/13/13 5/17/17\n"
-                                   "f 13/4/4 38/63/63 39/5/5\n"
-                                   "f 1978/7/7 1977/64/64 25/8/8\n"
-                                   "f 14/6/6 39/5/5 40/10/10\n"
-                                   "f 1978/7/7 26/9/9 27/12/12\n"
-                                   "f 16/14/14 15/11/11 40/10/10\n"
-                                   "f 4/13/13 27/12/12 28/16/16\n"
-                                   "f 16/14/14 41/15/15 42/18/18\n"
-                                   "f 5/17/17 28/16/16 29/20/20\n"
-                                   "f 1981/19/19 42/18/18 43/22/22\n"
-                                   "f 6/21/21 29/20/20 30/24/24\n"
-                                   "f 1982/23/23 43/22/22 44/26/26\n"
-                                   "f 1979/25/25 30/24/24 31/28/28\n"
-                                   "f 18/30/30 17/27/27 44/26/26\n"
-                                   "f 1980/32/32 7/29/29 31/28/28\n"
-                                   "f 1983/34/34 18/30/30 45/31/31\n"
-                                   "f 8/36/36 1980/32/32 32/33/33\n"
-                                   "f 19/38/38 1983/34/34 46/35/35\n"
-                                   "f 8/36/36 33/37/37 34/40/40\n"
-                                   "f 19/38/38 47/39/39 48/45/45\n"
-                                   "f 9/41/41 34/40/40 35/47/47\n"
-                                   "f 1/42/42 21/44/44 22/49/49\n"
-                                   "f 1984/46/46 48/45/45 49/51/51\n"
-                                   "f 10/48/48 35/47/47 36/53/53\n"
-                                   "f 1976/50/50 22/49/49 23/55/55\n"
-                                   "f 1985/52/52 49/51/51 50/57/57\n"
-                                   "f 11/54/54 36/53/53 37/59/59\n"
-                                   "f 2/56/56 23/55/55 24/61/61\n"
-                                   "f 1986/58/58 50/57/57 51/3/3\n"
-                                   "f 12/60/60 37/59/59 38/63/63\n"
-                                   "f 1977/64/64 3/62/62 24/61/61\n"
-                                   "f 46/35/35 77/97/95 78/65/65\n"
-                                   "f 34/40/40 33/37/37 64/66/66\n"
-                                   "f 48/45/45 47/39/39 78/65/65\n"
-                                   "f 34/40/40 65/67/67 66/71/70\n"
-                                   "f 21/44/44 52/69/68 53/72/71\n"
-                                   "f 49/51/51 48/45/45 79/70/69\n"
-                                   "f 35/47/47 66/71/70 67/74/73\n"
-                                   "f 22/49/49 53/72/71 54/75/74\n"
-                                   "f 50/57/57 49/51/51 80/73/72\n"
-                                   "f 36/53/53 67/74/73 68/77/76\n"
-                                   "f 23/55/55 54/75/74 55/78/77\n"
-                                   "f 50/57/57 81/76/75 82/79/78\n"
-                                   "f 37/59/59 68/77/76 69/80/79\n"
-                                   "f 24/61/61 55/78/77 56/81/80\n"
-                                   "f 38/63/63 69/80/79 70/83/81\n"
-                                   "f 25/8/8 56/81/80 57/84/82\n"
-                                   "f 39/5/5 70/83/81 71/85/83\n"
-                                   "f 26/9/9 57/84/82 58/86/84\n"
-                                   "f 40/10/10 71/85/83 72/87/85\n"
-                                   "f 27/12/12 58/86/84 59/88/86\n"
-                                   "f 42/18/18 41/15/15 72/87/85\n"
-                                   "f 29/20/20 28/16/16 59/88/86\n"
-                                   "f 43/22/22 42/18/18 73/89/87\n"
-                                   "f 29/20/20 60/90/88 61/92/90\n"
-                                   "f 44/26/26 43/22/22 74/91/89\n"
-                                   "f 30/24/24 61/92/90 62/94/92\n"
-                                   "f 45/31/31 44/26/26 75/93/91\n"
-                                   "f 31/28/28 62/94/92 63/96/94\n"
-                                   "f 45/31/31 76/95/93 77/97/95\n"
-                                   "f 32/33/33 63/96/94 64/66/66\n"
-                                   "f 52/69/68 83/129/125 84/98/96\n"
-                                   "f 79/70/69 110/130/126 111/99/97\n"
-                                   "f 67/74/73 66/71/70 97/100/98\n"
-                                   "f 53/72/71 84/98/96 85/102/100\n"
-                                   "f 80/73/72 111/99/97 112/103/101\n"
-                                   "f 68/77/76 67/74/73 98/101/99\n"
-                                   "f 54/75/74 85/102/100 86/105/103\n"
-                                   "f 82/79/78 81/76/75 112/103/101\n"
-                                   "f 68/77/76 99/104/102 100/107/105\n"
-                                   "f 55/78/77 86/105/103 87/108/106\n"
-                                   "f 69/80/79 100/107/105 101/110/107\n"
-                                   "f 56/81/80 87/108/106 88/111/108\n"
-                                   "f 71/85/83 70/83/81 101/110/107\n"
-                                   "f 58/86/84 57/84/82 88/111/108\n"
-                                   "f 72/87/85 71/85/83 102/112/109\n"
-                                   "f 59/88/86 58/86/84 89/113/110\n"
-                                   "f 73/89/87 72/87/85 103/114/111\n"
-                                   "f 59/88/86 90/115/112 91/117/114\n"
-                                   "f 74/91/89 73/89/87 104/116/113\n"
-                                   "f 61/92/90 60/90/88 91/117/114\n"
-                                   "f 74/91/89 105/118/115 106/120/117\n"
-                                   "f 61/92/90 92/119/116 93/121/118\n"
-                                   "f 75/93/91 106/120/117 107/122/119\n"
-                                   "f 63/96/94 62/94/92 93/121/118\n"
-                                   "f 76/95/93 107/122/119 108/124/121\n"
-                                   "f 64/66/66 63/96/94 94/123/120\n"
-                                   "f 77/97/95 108/124/121 109/126/123\n"
-                                   "f 64/66/66 95/125/122 96/127/124\n"
-                                   "f 79/70/69 78/65/65 109/126/123\n"
-                                   "f 65/67/67 96/127/124 97/100/98\n"
-                                   "f 85/102/100 116/162/156 117/131/127\n"
-                                   "f 112/103/101 143/163/157 144/132/128\n"
-                                   "f 100/107/105 99/104/102 130/133/129\n"
-                                   "f 86/105/103 117/131/127 118/135/131\n"
-                                   "f 100/107/105 131/134/130 132/137/132\n"
-                                   "f 87/108/106 118/135/131 119/138/133\n"
-                                   "f 101/110/107 132/137/132 133/139/134\n"
-                                   "f 88/111/108 119/138/133 120/140/135\n"
-                                   "f 103/114/111 102/112/109 133/139/134\n"
-                                   "f 89/113/110 120/140/135 121/142/137\n"
-                                   "f 103/114/111 134/141/136 135/143/138\n"
-                                   "f 90/115/112 121/142/137 122/144/139\n"
-                                   "f 104/116/113 135/143/138 136/145/140\n"
-                                   "f 92/119/116 91/117/114 122/144/139\n"
-                                   "f 106/120/117 105/118/115 136/145/140\n"
-                                   "f 92/119/116 123/146/141 124/148/143\n"
-                                   "f 106/120/117 137/147/142 138/149/144\n"
-                                   "f 93/121/118 124/148/143 125/150/145\n"
-                                   "f 108/124/121 107/122/119 138/149/144\n"
-                                   "f 95/125/122 94/123/120 125/150/145\n"
-                                   "f 108/124/121 139/151/146 140/153/148\n"
-                                   "f 95/125/122 126/152/147 127/154/149\n"
-                                   "f 109/126/123 140/153/148 141/157/151\n"
-                                   "f 97/100/98 96/127/124 127/154/149\n"
-                                   "f 84/98/96 83/129/125 114/156/150\n"
-                                   "f 110/130/126 141/157/151 142/160/154\n"
-                                   "f 97/100/98 128/158/152 129/161/155\n"
-                                   "f 85/102/100 84/98/96 115/159/153\n"
-                                   "f 111/99/97 142/160/154 143/163/157\n"
-                                   "f 98/101/99 129/161/155 130/133/129\n"
-                                   "f 118/135/131 149/195/188 150/164/158\n"
-                                   "f 133/139/134 132/137/132 163/165/159\n"
-                                   "f 120/140/135 119/138/133 150/164/158\n"
-                                   "f 134/141/136 133/139/134 164/166/160\n"
-                                   "f 121/142/137 120/140/135 151/167/161\n"
-                                   "f 135/143/138 134/141/136 165/168/162\n"
-                                   "f 121/142/137 152/169/163 153/171/165\n"
-                                   "f 135/143/138 166/170/164 167/172/166\n"
-                                   "f 122/144/139 153/171/165 154/173/167\n"
-                                   "f 137/147/142 136/145/140 167/172/166\n"
-                                   "f 123/146/141 154/173/167 155/175/169\n"
-                                   "f 137/147/142 168/174/168 169/176/170\n"
-                                   "f 124/148/143 155/175/169 156/177/171\n"
-                                   "f 138/149/144 169/176/170 170/178/172\n"
-                                   "f 125/150/145 156/177/171 157/179/173\n"
-                                   "f 140/153/148 139/151/146 170/178/172\n"
-                                   "f 126/152/147 157/179/173 158/181/175\n"
-                                   "f 141/157/151 140/153/148 171/180/174\n"
-                                   "f 128/158/152 127/154/149 158/181/175\n"
-                                   "f 114/156/150 145/183/176 146/186/179\n"
-                                   "f 141/157/151 172/184/177 173/187/180\n"
-                                   "f 128/158/152 159/185/178 160/188/181\n"
-                                   "f 116/162/156 115/159/153 146/186/179\n"
-                                   "f 142/160/154 173/187/180 174/190/183\n"
-                                   "f 129/161/155 160/188/181 161/191/184\n"
-                                   "f 116/162/156 147/189/182 148/192/185\n"
-                                   "f 144/132/128 143/163/157 174/190/183\n"
-                                   "f 130/133/129 161/191/184 162/194/187\n"
-                                   "f 117/131/127 148/192/185 149/195/188\n"
-                                   "f 131/134/130 162/194/187 163/165/159\n"
-                                   "f 152/169/163 151/167/161 182/197/189\n"
-                                   "f 166/170/164 165/168/162 196/199/191\n"
-                                   "f 152/169/163 183/198/190 184/201/193\n"
-                                   "f 167/172/166 166/170/164 197/200/192\n"
-                                   "f 154/173/167 153/171/165 184/201/193\n"
-                                   "f 168/174/168 167/172/166 198/202/194\n"
-                                   "f 154/173/167 185/203/195 186/205/197\n"
-                                   "f 168/174/168 199/204/196 200/206/198\n"
-                                   "f 155/175/169 186/205/197 187/207/199\n"
-                                   "f 169/176/170 200/206/198 201/208/200\n"
-                                   "f 157/179/173 156/177/171 187/207/199\n"
-                                   "f 171/180/174 170/178/172 201/208/200\n"
-                                   "f 157/179/173 188/209/201 189/211/203\n"
-                                   "f 172/184/177 171/180/174 202/210/202\n"
-                                   "f 158/181/175 189/211/203 190/215/206\n"
-                                   "f 145/183/176 176/213/204 177/216/207\n"
-                                   "f 172/184/177 203/214/205 204/217/208\n"
-                                   "f 159/185/178 190/215/206 191/218/209\n"
-                                   "f 147/189/182 146/186/179 177/216/207\n"
-                                   "f 173/187/180 204/217/208 205/220/211\n"
-                                   "f 161/191/184 160/188/181 191/218/209\n"
-                                   "f 147/189/182 178/219/210 179/222/213\n"
-                                   "f 174/190/183 205/220/211 206/223/214\n"
-                                   "f 162/194/187 161/191/184 192/221/212\n"
-                                   "f 148/192/185 179/222/213 180/225/216\n"
-                                   "f 162/194/187 193/224/215 194/227/217\n"
-                                   "f 149/195/188 180/225/216 181/228/218\n"
-                                   "f 163/165/159 194/227/217 195/229/219\n"
-                                   "f 150/164/158 181/228/218 182/197/189\n"
-                                   "f 165/168/162 164/166/160 195/229/219\n"
-                                   "f 185/203/195 184/201/193 215/230/220\n"
-                                   "f 199/204/196 198/202/194 229/232/222\n"
-                                   "f 185/203/195 216/231/221 217/234/224\n"
-                                   "f 199/204/196 230/233/223 231/235/225\n"
-                                   "f 186/205/197 217/234/224 218/236/226\n"
-                                   "f 200/206/198 231/235/225 232/237/227\n"
-                                   "f 187/207/199 218/236/226 219/238/228\n"
-                                   "f 202/210/202 201/208/200 232/237/227\n"
-                                   "f 188/209/201 219/238/228 220/240/230\n"
-                                   "f 202/210/202 233/239/229 234/243/232\n"
-                                   "f 189/211/203 220/240/230 221/244/233\n"
-                                   "f 176/213/204 207/242/231 208/245/234\n"
-                                   "f 204/217/208 203/214/205 234/243/232\n"
-                                   "f 191/218/209 190/215/206 221/244/233\n"
-                                   "f 178/219/210 177/216/207 208/245/234\n"
-                                   "f 204/217/208 235/246/235 236/249/238\n"
-                                   "f 191/218/209 222/247/236 223/250/239\n"
-                                   "f 178/219/210 209/248/237 210/251/240\n"
-                                   "f 205/220/211 236/249/238 237/252/241\n"
-                                   "f 193/224/215 192/221/212 223/250/239\n"
-                                   "f 179/222/213 210/251/240 211/254/243\n"
-                                   "f 193/224/215 224/253/242 225/256/244\n"
-                                   "f 181/228/218 180/225/216 211/254/243\n"
-                                   "f 194/227/217 225/256/244 226/258/246\n"
-                                   "f 181/228/218 212/257/245 213/259/247\n"
-                                   "f 195/229/219 226/258/246 227/260/248\n"
-                                   "f 183/198/190 182/197/189 213/259/247\n"
-                                   "f 196/199/191 227/260/248 228/262/250\n"
-                                   "f 183/198/190 214/261/249 215/230/220\n"
-                                   "f 197/200/192 228/262/250 229/232/222\n"
-                                   "f 218/236/226 217/234/224 248/263/251\n"
-                                   "f 232/237/227 231/235/225 262/265/253\n"
-                                   "f 218/236/226 249/264/252 250/267/255\n"
-                                   "f 233/239/229 232/237/227 263/266/254\n"
-                                   "f 219/238/228 250/267/255 251/269/257\n"
-                                   "f 234/243/232 233/239/229 264/268/256\n"
-                                   "f 220/240/230 251/269/257 252/273/260\n"
-                                   "f 207/242/231 238/271/258 239/274/261\n"
-                                   "f 235/246/235 234/243/232 265/272/259\n"
-                                   "f 222/247/236 221/244/233 252/273/260\n"
-                                   "f 208/245/234 239/274/261 240/277/264\n"
-                                   "f 235/246/235 266/275/262 267/278/265\n"
-                                   "f 222/247/236 253/276/263 254/279/266\n"
-                                   "f 209/248/237 240/277/264 241/280/267\n"
-                                   "f 236/249/238 267/278/265 268/281/268\n"
-                                   "f 224/253/242 223/250/239 254/279/266\n"
-                                   "f 210/251/240 241/280/267 242/283/270\n"
-                                   "f 225/256/244 224/253/242 255/282/269\n"
-                                   "f 211/254/243 242/283/270 243/286/272\n"
-                                   "f 226/258/246 225/256/244 256/285/271\n"
-                                   "f 213/259/247 212/257/245 243/286/272\n"
-                                   "f 226/258/246 257/287/273 258/289/275\n"
-                                   "f 214/261/249 213/259/247 244/288/274\n"
-                                   "f 228/262/250 227/260/248 258/289/275\n"
-                                   "f 214/261/249 245/290/276 246/292/278\n"
-                                   "f 229/232/222 228/262/250 259/291/277\n"
-                                   "f 216/231/221 215/230/220 246/292/278\n"
-                                   "f 230/233/223 229/232/222 260/293/279\n"
-                                   "f 216/231/221 247/294/280 248/263/251\n"
-                                   "f 230/233/223 261/295/281 262/265/253\n"
-                                   "f 250/267/255 281/328/312 282/296/282\n"
-                                   "f 265/272/259 264/268/256 295/299/284\n"
-                                   "f 251/269/257 282/296/282 283/301/286\n"
-                                   "f 238/271/258 269/298/283 270/302/287\n"
-                                   "f 266/275/262 265/272/259 296/300/285\n"
-                                   "f 253/276/263 252/273/260 283/301/286\n"
-                                   "f 240/277/264 239/274/261 270/302/287\n"
-                                   "f 266/275/262 297/303/288 298/306/291\n"
-                                   "f 253/276/263 284/304/289 285/307/292\n"
-                                   "f 240/277/264 271/305/290 272/308/293\n"
-                                   "f 267/278/265 298/306/291 299/309/294\n"
-                                   "f 255/282/269 254/279/266 285/307/292\n"
-                                   "f 242/283/270 241/280/267 272/308/293\n"
-                                   "f 256/285/271 255/282/269 286/310/295\n"
-                                   "f 242/283/270 273/311/296 274/314/298\n"
-                                   "f 257/287/273 256/285/271 287/313/297\n"
-                                   "f 244/288/274 243/286/272 274/314/298\n"
-                                   "f 257/287/273 288/315/299 289/317/301\n"
-                                   "f 245/290/276 244/288/274 275/316/300\n"
-                                   "f 259/291/277 258/289/275 289/317/301\n"
-                                   "f 245/290/276 276/318/302 277/320/304\n"
-                                   "f 259/291/277 290/319/303 291/321/305\n"
-                                   "f 247/294/280 246/292/278 277/320/304\n"
-                                   "f 261/295/281 260/293/279 291/321/305\n"
-                                   "f 247/294/280 278/322/306 279/324/308\n"
-                                   "f 261/295/281 292/323/307 293/325/309\n"
-                                   "f 249/264/252 248/263/251 279/324/308\n"
-                                   "f 262/265/253 293/325/309 294/327/311\n"
-                                   "f 249/264/252 280/326/310 281/328/312\n"
-                                   "f 264/268/256 263/266/254 294/327/311\n"
-                                   "f 284/304/289 283/301/286 314/329/313\n"
-                                   "f 271/305/290 270/302/287 301/331/315\n"
-                                   "f 297/303/288 328/361/343 329/333/317\n"
-                                   "f 284/304/289 315/330/314 316/334/318\n"
-                                   "f 271/305/290 302/332/316 303/335/319\n"
-                                   "f 299/309/294 298/306/291 329/333/317\n"
-                                   "f 285/307/292 316/334/318 317/337/321\n"
-                                   "f 272/308/293 303/335/319 304/338/322\n"
-                                   "f 287/313/297 286/310/295 317/337/321\n"
-                                   "f 273/311/296 304/338/322 305/341/324\n"
-                                   "f 288/315/299 287/313/297 318/340/323\n"
-                                   "f 275/316/300 274/314/298 305/341/324\n"
-                                   "f 288/315/299 319/342/325 320/344/327\n"
-                                   "f 276/318/302 275/316/300 306/343/326\n"
-                                   "f 289/317/301 320/344/327 321/346/329\n"
-                                   "f 276/318/302 307/345/328 308/347/330\n"
-                                   "f 290/319/303 321/346/329 322/348/331\n"
-                                   "f 278/322/306 277/320/304 308/347/330\n"
-                                   "f 292/323/307 291/321/305 322/348/331\n"
-                                   "f 278/322/306 309/349/332 310/351/334\n"
-                                   "f 292/323/307 323/350/333 324/352/335\n"
-                                   "f 280/326/310 279/324/308 310/351/334\n"
-                                   "f 293/325/309 324/352/335 325/354/337\n"
-                                   "f 280/326/310 311/353/336 312/355/338\n"
-                                   "f 295/299/284 294/327/311 325/354/337\n"
-                                   "f 281/328/312 312/355/338 313/357/340\n"
-                                   "f 296/300/285 295/299/284 326/356/339\n"
-                                   "f 283/301/286 282/296/282 313/357/340\n"
-                                   "f 269/298/283 300/359/341 301/331/315\n"
-                                   "f 297/303/288 296/300/285 327/360/342\n"
-                                   "f 316/334/318 347/394/374 348/362/344\n"
-                                   "f 304/338/322 303/335/319 334/363/345\n"
-                                   "f 318/340/323 317/337/321 348/362/344\n"
-                                   "f 304/338/322 335/364/346 336/368/349\n"
-                                   "f 319/342/325 318/340/323 349/367/348\n"
-                                   "f 306/343/326 305/341/324 336/368/349\n"
-                                   "f 319/342/325 350/369/350 351/371/352\n"
-                                   "f 307/345/328 306/343/326 337/370/351\n"
-                                   "f 321/346/329 320/344/327 351/371/352\n"
-                                   "f 307/345/328 338/372/353 339/374/355\n"
-                                   "f 321/346/329 352/373/354 353/375/356\n"
-                                   "f 309/349/332 308/347/330 339/374/355\n"
-                                   "f 323/350/333 322/348/331 353/375/356\n"
-                                   "f 309/349/332 340/376/357 341/378/359\n"
-                                   "f 323/350/333 354/377/358 355/379/360\n"
-                                   "f 311/353/336 310/351/334 341/378/359\n"
-                                   "f 324/352/335 355/379/360 356/381/362\n"
-                                   "f 311/353/336 342/380/361 343/382/363\n"
-                                   "f 326/356/339 325/354/337 356/381/362\n"
-                                   "f 312/355/338 343/382/363 344/384/365\n"
-                                   "f 326/356/339 357/383/364 358/387/367\n"
-                                   "f 314/329/313 313/357/340 344/384/365\n"
-                                   "f 300/359/341 331/386/366 332/389/369\n"
-                                   "f 328/361/343 327/360/342 358/387/367\n"
-                                   "f 315/330/314 314/329/313 345/388/368\n"
-                                   "f 302/332/316 301/331/315 332/389/369\n"
-                                   "f 328/361/343 359/390/370 360/393/373\n"
-                                   "f 315/330/314 346/391/371 347/394/374\n"
-                                   "f 302/332/316 333/392/372 334/363/345\n"
-                                   "f 329/333/317 360/393/373 361/366/347\n"
-                                   "f 350/369/350 349/367/348 380/395/375\n"
-                                   "f 337/370/351 336/368/349 367/397/377\n"
-                                   "f 350/369/350 381/396/376 382/399/379\n"
-                                   "f 338/372/353 337/370/351 368/398/378\n"
-                                   "f 351/371/352 382/399/379 383/401/381\n"
-                                   "f 338/372/353 369/400/380 370/402/382\n"
-                                   "f 352/373/354 383/401/381 384/403/383\n"
-                                   "f 340/376/357 339/374/355 370/402/382\n"
-                                   "f 354/377/358 353/375/356 384/403/383\n"
-                                   "f 340/376/357 371/404/384 372/406/386\n"
-                                   "f 354/377/358 385/405/385 386/407/387\n"
-                                   "f 342/380/361 341/378/359 372/406/386\n"
-                                   "f 355/379/360 386/407/387 387/409/389\n"
-                                   "f 342/380/361 373/408/388 374/410/390\n"
-                                   "f 357/383/364 356/381/362 387/409/389\n"
-                                   "f 344/384/365 343/382/363 374/410/390\n"
-                                   "f 357/383/364 388/411/391 389/415/394\n"
-                                   "f 345/388/368 344/384/365 375/412/392\n"
-                                   "f 331/386/366 362/414/393 363/417/396\n"
-                                   "f 359/390/370 358/387/367 389/415/394\n"
-                                   "f 345/388/368 376/416/395 377/419/398\n"
-                                   "f 333/392/372 332/389/369 363/417/396\n"
-                                   "f 359/390/370 390/418/397 391/421/400\n"
-                                   "f 347/394/374 346/391/371 377/419/398\n"
-                                   "f 333/392/372 364/420/399 365/423/402\n"
-                                   "f 360/393/373 391/421/400 392/424/403\n"
-                                   "f 347/394/374 378/422/401 379/425/404\n"
-                                   "f 334/363/345 365/423/402 366/426/405\n"
-                                   "f 349/367/348 348/362/344 379/425/404\n"
-                                   "f 335/364/346 366/426/405 367/397/377\n"
-                                   "f 382/399/379 413/459/435 414/428/406\n"
-                                   "f 369/400/380 400/460/436 401/429/407\n"
-                                   "f 383/401/381 414/428/406 415/430/408\n"
-                                   "f 371/404/384 370/402/382 401/429/407\n"
-                                   "f 385/405/385 384/403/383 415/430/408\n"
-                                   "f 371/404/384 402/431/409 403/433/411\n"
-                                   "f 385/405/385 416/432/410 417/434/412\n"
-                                   "f 373/408/388 372/406/386 403/433/411\n"
-                                   "f 386/407/387 417/434/412 418/436/414\n"
-                                   "f 373/408/388 404/435/413 405/437/415\n"
-                                   "f 388/411/391 387/409/389 418/436/414\n"
-                                   "f 375/412/392 374/410/390 405/437/415\n"
-                                   "f 389/415/394 388/411/391 419/438/416\n"
-                                   "f 376/416/395 375/412/392 406/439/417\n"
-                                   "f 362/414/393 393/441/418 394/444/421\n"
-                                   "f 390/418/397 389/415/394 420/442/419\n"
-                                   "f 376/416/395 407/443/420 408/446/423\n"
-                                   "f 364/420/399 363/417/396 394/444/421\n"
-                                   "f 390/418/397 421/445/422 422/448/425\n"
-                                   "f 378/422/401 377/419/398 408/446/423\n"
-                                   "f 364/420/399 395/447/424 396/450/427\n"
-                                   "f 391/421/400 422/448/425 423/451/428\n"
-                                   "f 378/422/401 409/449/426 410/452/429\n"
-                                   "f 365/423/402 396/450/427 397/453/430\n"
-                                   "f 380/395/375 379/425/404 410/452/429\n"
-                                   "f 366/426/405 397/453/430 398/456/432\n"
-                                   "f 381/396/376 380/395/375 411/455/431\n"
-                                   "f 368/398/378 367/397/377 398/456/432\n"
-                                   "f 381/396/376 412/457/433 413/459/435\n"
-                                   "f 368/398/378 399/458/434 400/460/436\n"
-                                   "f 416/432/410 415/430/408 446/461/437\n"
-                                   "f 402/431/409 433/493/467 434/463/439\n"
-                                   "f 416/432/410 447/462/438 448/464/440\n"
-                                   "f 404/435/413 403/433/411 434/463/439\n"
-                                   "f 417/434/412 448/464/440 449/466/442\n"
-                                   "f 404/435/413 435/465/441 436/467/443\n"
-                                   "f 419/438/416 418/436/414 449/466/442\n"
-                                   "f 406/439/417 405/437/415 436/467/443\n"
-                                   "f 420/442/419 419/438/416 450/468/444\n"
-                                   "f 407/443/420 406/439/417 437/469/445\n"
-                                   "f 393/441/418 424/471/446 425/474/449\n"
-                                   "f 421/445/422 420/442/419 451/472/447\n"
-                                   "f 407/443/420 438/473/448 439/476/451\n"
-                                   "f 395/447/424 394/444/421 425/474/449\n"
-                                   "f 421/445/422 452/475/450 453/478/453\n"
-                                   "f 409/449/426 408/446/423 439/476/451\n"
-                                   "f 395/447/424 426/477/452 427/480/455\n"
-                                   "f 422/448/425 453/478/453 454/481/456\n"
-                                   "f 409/449/426 440/479/454 441/482/457\n"
-                                   "f 397/453/430 396/450/427 427/480/455\n"
-                                   "f 411/455/431 410/452/429 441/482/457\n"
-                                   "f 397/453/430 428/483/458 429/486/460\n"
-                                   "f 412/457/433 411/455/431 442/485/459\n"
-                                   "f 399/458/434 398/456/432 429/486/460\n"
-                                   "f 412/457/433 443/487/461 444/489/463\n"
-                                   "f 400/460/436 399/458/434 430/488/462\n"
-                                   "f 413/459/435 444/489/463 445/491/465\n"
-                                   "f 400/460/436 431/490/464 432/492/466\n"
-                                   "f 415/430/408 414/428/406 445/491/465\n"
-                                   "f 401/429/407 432/492/466 433/493/467\n"
-                                   "f 448/464/440 479/525/497 480/494/468\n"
-                                   "f 435/465/441 466/526/498 467/495/469\n"
-                                   "f 450/468/444 449/466/442 480/494/468\n"
-                                   "f 437/469/445 436/467/443 467/495/469\n"
-                                   "f 451/472/447 450/468/444 481/496/470\n"
-                                   "f 438/473/448 437/469/445 468/497/471\n"
-                                   "f 424/471/446 455/499/472 456/502/475\n"
-                                   "f 452/475/450 451/472/447 482/500/473\n"
-                                   "f 438/473/448 469/501/474 470/504/477\n"
-                                   "f 425/474/449 456/502/475 457/505/478\n"
-                                   "f 452/475/450 483/503/476 484/506/479\n"
-                                   "f 440/479/454 439/476/451 470/504/477\n"
-                                   "f 426/477/452 457/505/478 458/508/481\n"
-                                   "f 453/478/453 484/506/479 485/509/482\n"
-                                   "f 440/479/454 471/507/480 472/510/483\n"
-                                   "f 427/480/455 458/508/481 459/511/484\n"
-                                   "f 441/482/457 472/510/483 473/513/485\n"
-                                   "f 428/483/458 459/511/484 460/514/486\n"
-                                   "f 442/485/459 473/513/485 474/515/487\n"
-                                   "f 430/488/462 429/486/460 460/514/486\n"
-                                   "f 444/489/463 443/487/461 474/515/487\n"
-                                   "f 431/490/464 430/488/462 461/516/488\n"
-                                   "f 444/489/463 475/517/489 476/519/491\n"
-                                   "f 431/490/464 462/518/490 463/520/492\n"
-                                   "f 445/491/465 476/519/491 477/521/493\n"
-                                   "f 433/493/467 432/492/466 463/520/492\n"
-                                   "f 447/462/438 446/461/437 477/521/493\n"
-                                   "f 433/493/467 464/522/494 465/524/496\n"
-                                   "f 447/462/438 478/523/495 479/525/497\n"
-                                   "f 435/465/441 434/463/439 465/524/496\n"
-                                   "f 482/500/473 481/496/470 512/527/499\n"
-                                   "f 469/501/474 468/497/471 499/529/501\n"
-                                   "f 456/502/475 455/499/472 486/531/503\n"
-                                   "f 483/503/476 482/500/473 513/528/500\n"
-                                   "f 469/501/474 500/530/502 501/534/506\n"
-                                   "f 457/505/478 456/502/475 487/532/504\n"
-                                   "f 483/503/476 514/533/505 515/536/508\n"
-                                   "f 471/507/480 470/504/477 501/534/506\n"
-                                   "f 457/505/478 488/535/507 489/538/510\n"
-                                   "f 484/506/479 515/536/508 516/539/511\n"
-                                   "f 471/507/480 502/537/509 503/540/512\n"
-                                   "f 458/508/481 489/538/510 490/541/513\n"
-                                   "f 472/510/483 503/540/512 504/543/514\n"
-                                   "f 459/511/484 490/541/513 491/544/515\n"
-                                   "f 474/515/487 473/513/485 504/543/514\n"
-                                   "f 460/514/486 491/544/515 492/546/517\n"
-                                   "f 475/517/489 474/515/487 505/545/516\n"
-                                   "f 462/518/490 461/516/488 492/546/517\n"
-                                   "f 475/517/489 506/547/518 507/549/520\n"
-                                   "f 462/518/490 493/548/519 494/550/521\n"
-                                   "f 477/521/493 476/519/491 507/549/520\n"
-                                   "f 464/522/494 463/520/492 494/550/521\n"
-                                   "f 478/523/495 477/521/493 508/551/522\n"
-                                   "f 464/522/494 495/552/523 496/554/525\n"
-                                   "f 478/523/495 509/553/524 510/555/526\n"
-                                   "f 466/526/498 465/524/496 496/554/525\n"
-                                   "f 479/525/497 510/555/526 511/557/528\n"
-                                   "f 466/526/498 497/556/527 498/558/529\n"
-                                   "f 481/496/470 480/494/468 511/557/528\n"
-                                   "f 468/497/471 467/495/469 498/558/529\n"
-                                   "f 514/533/505 545/591/559 546/560/530\n"
-                                   "f 502/537/509 501/534/506 532/561/531\n"
-                                   "f 488/535/507 519/592/560 520/563/533\n"
-                                   "f 515/536/508 546/560/530 547/564/534\n"
-                                   "f 502/537/509 533/562/532 534/565/535\n"
-                                   "f 490/541/513 489/538/510 520/563/533\n"
-                                   "f 503/540/512 534/565/535 535/568/537\n"
-                                   "f 490/541/513 521/566/536 522/569/538\n"
-                                   "f 504/543/514 535/568/537 536/570/539\n"
-                                   "f 492/546/517 491/544/515 522/569/538\n"
-                                   "f 505/545/516 536/570/539 537/572/541\n"
-                                   "f 493/548/519 492/546/517 523/571/540\n"
-                                   "f 506/547/518 537/572/541 538/574/543\n"
-                                   "f 493/548/519 524/573/542 525/575/544\n"
-                                   "f 508/551/522 507/549/520 538/574/543\n"
-                                   "f 495/552/523 494/550/521 525/575/544\n"
-                                   "f 509/553/524 508/551/522 539/576/545\n"
-                                   "f 495/552/523 526/577/546 527/579/548\n"
-                                   "f 509/553/524 540/578/547 541/580/549\n"
-                                   "f 497/556/527 496/554/525 527/579/548\n"
-                                   "f 510/555/526 541/580/549 542/582/551\n"
-                                   "f 497/556/527 528/581/550 529/583/552\n"
-                                   "f 512/527/499 511/557/528 542/582/551\n"
-                                   "f 499/529/501 498/558/529 529/583/552\n"
-                                   "f 512/527/499 543/584/553 544/588/556\n"
-                                   "f 500/530/502 499/529/501 530/585/554\n"
-                                   "f 487/532/504 486/531/503 517/587/555\n"
-                                   "f 513/528/500 544/588/556 545/591/559\n"
-                                   "f 500/530/502 531/589/557 532/561/531\n"
-                                   "f 488/535/507 487/532/504 518/590/558\n"
-                                   "f 534/565/535 565/624/590 566/595/562\n"
-                                   "f 521/566/536 552/625/591 553/596/563\n"
-                                   "f 536/570/539 535/568/537 566/595/562\n"
-                                   "f 523/571/540 522/569/538 553/596/563\n"
-                                   "f 536/570/539 567/597/564 568/599/566\n"
-                                   "f 523/571/540 554/598/565 555/600/567\n"
-                                   "f 537/572/541 568/599/566 569/601/568\n"
-                                   "f 524/573/542 555/600/567 556/602/569\n"
-                                   "f 538/574/543 569/601/568 570/603/570\n"
-                                   "f 526/577/546 525/575/544 556/602/569\n"
-                                   "f 540/578/547 539/576/545 570/603/570\n"
-                                   "f 526/577/546 557/604/571 558/606/573\n"
-                                   "f 540/578/547 571/605/572 572/607/574\n"
-                                   "f 528/581/550 527/579/548 558/606/573\n"
-                                   "f 541/580/549 572/607/574 573/609/576\n"
-                                   "f 528/581/550 559/608/575 560/610/577\n"
-                                   "f 543/584/553 542/582/551 573/609/576\n"
-                                   "f 530/585/554 529/583/552 560/610/577\n"
-                                   "f 544/588/556 543/584/553 574/611/578\n"
-                                   "f 531/589/557 530/585/554 561/612/579\n"
-                                   "f 517/587/555 548/614/580 549/617/583\n"
-                                   "f 545/591/559 544/588/556 575/615/581\n"
-                                   "f 531/589/557 562/616/582 563/619/585\n"
-                                   "f 518/590/558 549/617/583 550/620/586\n"
-                                   "f 546/560/530 545/591/559 576/618/584\n"
-                                   "f 533/562/532 532/561/531 563/619/585\n"
-                                   "f 519/592/560 550/620/586 551/623/589\n"
-                                   "f 547/564/534 546/560/530 577/621/587\n"
-                                   "f 533/562/532 564/622/588 565/624/590\n"
-                                   "f 520/563/533 551/623/589 552/625/591\n"
-                                   "f 568/599/566 567/597/564 598/626/592\n"
-                                   "f 555/600/567 554/598/565 585/628/594\n"
-                                   "f 568/599/566 599/627/593 600/630/596\n"
-                                   "f 555/600/567 586/629/595 587/631/597\n"
-                                   "f 569/601/568 600/630/596 601/632/598\n"
-                                   "f 557/604/571 556/602/569 587/631/597\n"
-                                   "f 571/605/572 570/603/570 601/632/598\n"
-                                   "f 557/604/571 588/633/599 589/635/601\n"
-                                   "f 571/605/572 602/634/600 603/636/602\n"
-                                   "f 559/608/575 558/606/573 589/635/601\n"
-                                   "f 572/607/574 603/636/602 604/638/604\n"
-                                   "f 559/608/575 590/637/603 591/639/605\n"
-                                   "f 574/611/578 573/609/576 604/638/604\n"
-                                   "f 561/612/579 560/610/577 591/639/605\n"
-                                   "f 575/615/581 574/611/578 605/640/606\n"
-                                   "f 562/616/582 561/612/579 592/641/607\n"
-                                   "f 549/617/583 548/614/580 579/643/608\n"
-                                   "f 576/618/584 575/615/581 606/644/609\n"
-                                   "f 562/616/582 593/645/610 594/648/613\n"
-                                   "f 550/620/586 549/617/583 580/646/611\n"
-                                   "f 576/618/584 607/647/612 608/650/615\n"
-                                   "f 564/622/588 563/619/585 594/648/613\n"
-                                   "f 550/620/586 581/649/614 582/652/617\n"
-                                   "f 577/621/587 608/650/615 609/653/618\n"
-                                   "f 564/622/588 595/651/616 596/654/619\n"
-                                   "f 552/625/591 551/623/589 582/652/617\n"
-                                   "f 565/624/590 596/654/619 597/657/621\n"
-                                   "f 552/625/591 583/655/620 584/658/622\n"
-                                   "f 567/597/564 566/595/562 597/657/621\n"
-                                   "f 554/598/565 553/596/563 584/658/622\n"
-                                   "f 600/630/596 631/690/652 632/659/623\n"
-                                   "f 587/631/597 618/691/653 619/660/624\n"
-                                   "f 602/634/600 601/632/598 632/659/623\n"
-                                   "f 588/633/599 619/660/624 620/662/626\n"
-                                   "f 602/634/600 633/661/625 634/663/627\n"
-                                   "f 590/637/603 589/635/601 620/662/626\n"
-                                   "f 603/636/602 634/663/627 635/665/629\n"
-                                   "f 590/637/603 621/664/628 622/666/630\n"
-                                   "f 605/640/606 604/638/604 635/665/629\n"
-                                   "f 592/641/607 591/639/605 622/666/630\n"
-                                   "f 605/640/606 636/667/631 637/671/634\n"
-                                   "f 593/645/610 592/641/607 623/668/632\n"
-                                   "f 579/643/608 610/670/633 611/673/636\n"
-                                   "f 606/644/609 637/671/634 638/674/637\n"
-                                   "f 593/645/610 624/672/635 625/675/638\n"
-                                   "f 581/649/614 580/646/611 611/673/636\n"
-                                   "f 607/647/612 638/674/637 639/677/640\n"
-                                   "f 595/651/616 594/648/613 625/675/638\n"
-                                   "f 581/649/614 612/676/639 613/679/642\n"
-                                   "f 608/650/615 639/677/640 640/680/643\n"
-                                   "f 595/651/616 626/678/641 627/681/644\n"
-                                   "f 582/652/617 613/679/642 614/682/645\n"
-                                   "f 596/654/619 627/681/644 628/684/646\n"
-                                   "f 583/655/620 614/682/645 615/685/647\n"
-                                   "f 597/657/621 628/684/646 629/686/648\n"
-                                   "f 585/628/594 584/658/622 615/685/647\n"
-                                   "f 599/627/593 598/626/592 629/686/648\n"
-                                   "f 586/629/595 585/628/594 616/687/649\n"
-                                   "f 599/627/593 630/688/650 631/690/652\n"
-                                   "f 586/629/595 617/689/651 618/691/653\n"
-                                   "f 633/661/625 664/724/684 665/692/654\n"
-                                   "f 621/664/628 620/662/626 651/693/655\n"
-                                   "f 634/663/627 665/692/654 666/695/657\n"
-                                   "f 621/664/628 652/694/656 653/696/658\n"
-                                   "f 636/667/631 635/665/629 666/695/657\n"
-                                   "f 623/668/632 622/666/630 653/696/658\n"
-                                   "f 636/667/631 667/697/659 668/701/662\n"
-                                   "f 624/672/635 623/668/632 654/698/660\n"
-                                   "f 610/670/633 641/700/661 642/703/664\n"
-                                   "f 638/674/637 637/671/634 668/701/662\n"
-                                   "f 624/672/635 655/702/663 656/705/666\n"
-                                   "f 612/676/639 611/673/636 642/703/664\n"
-                                   "f 638/674/637 669/704/665 670/707/668\n"
-                                   "f 626/678/641 625/675/638 656/705/666\n"
-                                   "f 612/676/639 643/706/667 644/709/670\n"
-                                   "f 640/680/643 639/677/640 670/707/668\n"
-                                   "f 626/678/641 657/708/669 658/711/672\n"
-                                   "f 613/679/642 644/709/670 645/712/673\n"
-                                   "f 627/681/644 658/711/672 659/714/674\n"
-                                   "f 614/682/645 645/712/673 646/715/675\n"
-                                   "f 628/684/646 659/714/674 660/716/676\n"
-                                   "f 616/687/649 615/685/647 646/715/675\n"
-                                   "f 630/688/650 629/686/648 660/716/676\n"
-                                   "f 617/689/651 616/687/649 647/717/677\n"
-                                   "f 630/688/650 661/718/678 662/720/680\n"
-                                   "f 617/689/651 648/719/679 649/721/681\n"
-                                   "f 631/690/652 662/720/680 663/722/682\n"
-                                   "f 619/660/624 618/691/653 649/721/681\n"
-                                   "f 633/661/625 632/659/623 663/722/682\n"
-                                   "f 619/660/624 650/723/683 651/693/655\n"
-                                   "f 667/697/659 666/695/657 697/725/685\n"
-                                   "f 653/696/658 684/757/715 685/727/687\n"
-                                   "f 668/701/662 667/697/659 698/726/686\n"
-                                   "f 655/702/663 654/698/660 685/727/687\n"
-                                   "f 642/703/664 641/700/661 672/729/688\n"
-                                   "f 669/704/665 668/701/662 699/730/689\n"
-                                   "f 655/702/663 686/731/690 687/734/693\n"
-                                   "f 643/706/667 642/703/664 673/732/691\n"
-                                   "f 669/704/665 700/733/692 701/736/695\n"
-                                   "f 657/708/669 656/705/666 687/734/693\n"
-                                   "f 643/706/667 674/735/694 675/738/697\n"
-                                   "f 670/707/668 701/736/695 702/739/698\n"
-                                   "f 657/708/669 688/737/696 689/740/699\n"
-                                   "f 644/709/670 675/738/697 676/741/700\n"
-                                   "f 659/714/674 658/711/672 689/740/699\n"
-                                   "f 645/712/673 676/741/700 677/744/702\n"
-                                   "f 659/714/674 690/743/701 691/745/703\n"
-                                   "f 647/717/677 646/715/675 677/744/702\n"
-                                   "f 661/718/678 660/716/676 691/745/703\n"
-                                   "f 648/719/679 647/717/677 678/746/704\n"
-                                   "f 661/718/678 692/747/705 693/749/707\n"
-                                   "f 648/719/679 679/748/706 680/750/708\n"
-                                   "f 663/722/682 662/720/680 693/749/707\n"
-                                   "f 650/723/683 649/721/681 680/750/708\n"
-                                   "f 664/724/684 663/722/682 694/751/709\n"
-                                   "f 650/723/683 681/752/710 682/754/712\n"
-                                   "f 664/724/684 695/753/711 696/755/713\n"
-                                   "f 652/694/656 651/693/655 682/754/712\n"
-                                   "f 665/692/654 696/755/713 697/725/685\n"
-                                   "f 652/694/656 683/756/714 684/757/715\n"
-                                   "f 672/729/688 703/790/746 704/758/716\n"
-                                   "f 700/733/692 699/730/689 730/759/717\n"
-                                   "f 687/734/693 686/731/690 717/761/719\n"
-                                   "f 674/735/694 673/732/691 704/758/716\n"
-                                   "f 700/733/692 731/760/718 732/764/722\n"
-                                   "f 687/734/693 718/762/720 719/765/723\n"
-                                   "f 674/735/694 705/763/721 706/766/724\n"
-                                   "f 701/736/695 732/764/722 733/767/725\n"
-                                   "f 688/737/696 719/765/723 720/768/726\n"
-                                   "f 675/738/697 706/766/724 707/769/727\n"
-                                   "f 690/743/701 689/740/699 720/768/726\n"
-                                   "f 676/741/700 707/769/727 708/772/729\n"
-                                   "f 690/743/701 721/771/728 722/773/730\n"
-                                   "f 678/746/704 677/744/702 708/772/729\n"
-                                   "f 691/745/703 722/773/730 723/775/732\n"
-                                   "f 679/748/706 678/746/704 709/774/731\n"
-                                   "f 692/747/705 723/775/732 724/777/734\n"
-                                   "f 679/748/706 710/776/733 711/778/735\n"
-                                   "f 694/751/709 693/749/707 724/777/734\n"
-                                   "f 681/752/710 680/750/708 711/778/735\n"
-                                   "f 695/753/711 694/751/709 725/779/736\n"
-                                   "f 681/752/710 712/780/737 713/782/739\n"
-                                   "f 695/753/711 726/781/738 727/783/740\n"
-                                   "f 683/756/714 682/754/712 713/782/739\n"
-                                   "f 696/755/713 727/783/740 728/785/742\n"
-                                   "f 683/756/714 714/784/741 715/786/743\n"
-                                   "f 698/726/686 697/725/685 728/785/742\n"
-                                   "f 684/757/715 715/786/743 716/788/745\n"
-                                   "f 698/726/686 729/787/744 730/759/717\n"
-                                   "f 686/731/690 685/727/687 716/788/745\n"
-                                   "f 705/763/721 736/821/775 737/791/747\n"
-                                   "f 732/764/722 763/822/776 764/792/748\n"
-                                   "f 719/765/723 750/823/777 751/793/749\n"
-                                   "f 706/766/724 737/791/747 738/794/750\n"
-                                   "f 721/771/728 720/768/726 751/793/749\n"
-                                   "f 707/769/727 738/794/750 739/797/752\n"
-                                   "f 722/773/730 721/771/728 752/796/751\n"
-                                   "f 709/774/731 708/772/729 739/797/752\n"
-                                   "f 722/773/730 753/798/753 754/800/755\n"
-                                   "f 710/776/733 709/774/731 740/799/754\n"
-                                   "f 723/775/732 754/800/755 755/802/757\n"
-                                   "f 710/776/733 741/801/756 742/803/758\n"
-                                   "f 725/779/736 724/777/734 755/802/757\n"
-                                   "f 712/780/737 711/778/735 742/803/758\n"
-                                   "f 726/781/738 725/779/736 756/804/759\n"
-                                   "f 712/780/737 743/805/760 744/807/762\n"
-                                   "f 726/781/738 757/806/761 758/808/763\n"
-                                   "f 714/784/741 713/782/739 744/807/762\n"
-                                   "f 727/783/740 758/808/763 759/810/765\n"
-                                   "f 714/784/741 745/809/764 746/811/766\n"
-                                   "f 729/787/744 728/785/742 759/810/765\n"
-                                   "f 716/788/745 715/786/743 746/811/766\n"
-                                   "f 729/787/744 760/812/767 761/816/770\n"
-                                   "f 717/761/719 716/788/745 747/813/768\n"
-                                   "f 703/790/746 734/815/769 735/818/772\n"
-                                   "f 731/760/718 730/759/717 761/816/770\n"
-                                   "f 718/762/720 717/761/719 748/817/771\n"
-                                   "f 705/763/721 704/758/716 735/818/772\n"
-                                   "f 731/760/718 762/819/773 763/822/776\n"
-                                   "f 718/762/720 749/820/774 750/823/777\n"
-                                   "f 738/794/750 769/855/808 770/824/778\n"
-                                   "f 753/798/753 752/796/751 783/825/779\n"
-                                   "f 740/799/754 739/797/752 770/824/778\n"
-                                   "f 753/798/753 784/826/780 785/828/782\n"
-                                   "f 741/801/756 740/799/754 771/827/781\n"
-                                   "f 754/800/755 785/828/782 786/830/784\n"
-                                   "f 741/801/756 772/829/783 773/831/785\n"
-                                   "f 756/804/759 755/802/757 786/830/784\n"
-                                   "f 743/805/760 742/803/758 773/831/785\n"
-                                   "f 757/806/761 756/804/759 787/832/786\n"
-                                   "f 743/805/760 774/833/787 775/835/789\n"
-                                   "f 757/806/761 788/834/788 789/836/790\n"
-                                   "f 745/809/764 744/807/762 775/835/789\n"
-                                   "f 758/808/763 789/836/790 790/838/792\n"
-                                   "f 745/809/764 776/837/791 777/839/793\n"
-                                   "f 760/812/767 759/810/765 790/838/792\n"
-                                   "f 747/813/768 746/811/766 777/839/793\n"
-                                   "f 760/812/767 791/840/794 792/844/797\n"
-                                   "f 748/817/771 747/813/768 778/841/795\n"
-                                   "f 734/815/769 765/843/796 766/846/799\n"
-                                   "f 762/819/773 761/816/770 792/844/797\n"
-                                   "f 749/820/774 748/817/771 779/845/798\n"
-                                   "f 736/821/775 735/818/772 766/846/799\n"
-                                   "f 762/819/773 793/847/800 794/850/803\n"
-                                   "f 749/820/774 780/848/801 781/851/804\n"
-                                   "f 736/821/775 767/849/802 768/852/805\n"
-                                   "f 764/792/748 763/822/776 794/850/803\n"
-                                   "f 750/823/777 781/851/804 782/854/807\n"
-                                   "f 737/791/747 768/852/805 769/855/808\n"
-                                   "f 752/796/751 751/793/749 782/854/807\n"
-                                   "f 772/829/783 771/827/781 802/857/809\n"
-                                   "f 785/828/782 816/889/839 817/859/811\n"
-                                   "f 772/829/783 803/858/810 804/860/812\n"
-                                   "f 787/832/786 786/830/784 817/859/811\n"
-                                   "f 774/833/787 773/831/785 804/860/812\n"
-                                   "f 788/834/788 787/832/786 818/861/813\n"
-                                   "f 774/833/787 805/862/814 806/864/816\n"
-                                   "f 788/834/788 819/863/815 820/865/817\n"
-                                   "f 776/837/791 775/835/789 806/864/816\n"
-                                   "f 789/836/790 820/865/817 821/867/819\n"
-                                   "f 776/837/791 807/866/818 808/868/820\n"
-                                   "f 791/840/794 790/838/792 821/867/819\n"
-                                   "f 777/839/793 808/868/820 809/870/822\n"
-                                   "f 791/840/794 822/869/821 823/873/824\n"
-                                   "f 779/845/798 778/841/795 809/870/822\n"
-                                   "f 766/846/799 765/843/796 796/872/823\n"
-                                   "f 793/847/800 792/844/797 823/873/824\n"
-                                   "f 780/848/801 779/845/798 810/874/825\n"
-                                   "f 766/846/799 797/875/826 798/878/829\n"
-                                   "f 793/847/800 824/876/827 825/879/830\n"
-                                   "f 780/848/801 811/877/828 812/880/831\n"
-                                   "f 767/849/802 798/878/829 799/881/832\n"
-                                   "f 795/853/806 794/850/803 825/879/830\n"
-                                   "f 781/851/804 812/880/831 813/883/834\n"
-                                   "f 768/852/805 799/881/832 800/884/835\n"
-                                   "f 783/825/779 782/854/807 813/883/834\n"
-                                   "f 769/855/808 800/884/835 801/887/837\n"
-                                   "f 784/826/780 783/825/779 814/886/836\n"
-                                   "f 771/827/781 770/824/778 801/887/837\n"
-                                   "f 784/826/780 815/888/838 816/889/839\n"
-                                   "f 811/877/828 810/874/825 841/890/840\n"
-                                   "f 798/878/829 797/875/826 828/892/842\n"
-                                   "f 824/876/827 855/922/870 856/894/844\n"
-                                   "f 811/877/828 842/891/841 843/895/845\n"
-                                   "f 798/878/829 829/893/843 830/896/846\n"
-                                   "f 826/882/833 825/879/830 856/894/844\n"
-                                   "f 812/880/831 843/895/845 844/898/848\n"
-                                   "f 799/881/832 830/896/846 831/899/849\n"
-                                   "f 814/886/836 813/883/834 844/898/848\n"
-                                   "f 800/884/835 831/899/849 832/902/851\n"
-                                   "f 815/888/838 814/886/836 845/901/850\n"
-                                   "f 802/857/809 801/887/837 832/902/851\n"
-                                   "f 815/888/838 846/903/852 847/905/854\n"
-                                   "f 803/858/810 802/857/809 833/904/853\n"
-                                   "f 816/889/839 847/905/854 848/907/856\n"
-                                   "f 803/858/810 834/906/855 835/908/857\n"
-                                   "f 818/861/813 817/859/811 848/907/856\n"
-                                   "f 804/860/812 835/908/857 836/910/859\n"
-                                   "f 819/863/815 818/861/813 849/909/858\n"
-                                   "f 805/862/814 836/910/859 837/912/861\n"
-                                   "f 819/863/815 850/911/860 851/913/862\n"
-                                   "f 807/866/818 806/864/816 837/912/861\n"
-                                   "f 820/865/817 851/913/862 852/915/864\n"
-                                   "f 807/866/818 838/914/863 839/916/865\n"
-                                   "f 822/869/821 821/867/819 852/915/864\n"
-                                   "f 808/868/820 839/916/865 840/918/867\n"
-                                   "f 822/869/821 853/917/866 854/921/869\n"
-                                   "f 810/874/825 809/870/822 840/918/867\n"
-                                   "f 796/872/823 827/920/868 828/892/842\n"
-                                   "f 824/876/827 823/873/824 854/921/869\n"
-                                   "f 843/895/845 874/955/901 875/923/871\n"
-                                   "f 831/899/849 830/896/846 861/924/872\n"
-                                   "f 845/901/850 844/898/848 875/923/871\n"
-                                   "f 831/899/849 862/925/873 863/929/876\n"
-                                   "f 846/903/852 845/901/850 876/928/875\n"
-                                   "f 833/904/853 832/902/851 863/929/876\n"
-                                   "f 846/903/852 877/930/877 878/932/879\n"
-                                   "f 834/906/855 833/904/853 864/931/878\n"
-                                   "f 847/905/854 878/932/879 879/934/881\n"
-                                   "f 834/906/855 865/933/880 866/935/882\n"
-                                   "f 849/909/858 848/907/856 879/934/881\n"
-                                   "f 836/910/859 835/908/857 866/935/882\n"
-                                   "f 850/911/860 849/909/858 880/936/883\n"
-                                   "f 836/910/859 867/937/884 868/939/886\n"
-                                   "f 850/911/860 881/938/885 882/940/887\n"
-                                   "f 838/914/863 837/912/861 868/939/886\n"
-                                   "f 851/913/862 882/940/887 883/942/889\n"
-                                   "f 838/914/863 869/941/888 870/943/890\n"
-                                   "f 853/917/866 852/915/864 883/942/889\n"
-                                   "f 839/916/865 870/943/890 871/945/892\n"
-                                   "f 853/917/866 884/944/891 885/948/894\n"
-                                   "f 841/890/840 840/918/867 871/945/892\n"
-                                   "f 827/920/868 858/947/893 859/950/896\n"
-                                   "f 855/922/870 854/921/869 885/948/894\n"
-                                   "f 842/891/841 841/890/840 872/949/895\n"
-                                   "f 829/893/843 828/892/842 859/950/896\n"
-                                   "f 855/922/870 886/951/897 887/954/900\n"
-                                   "f 842/891/841 873/952/898 874/955/901\n"
-                                   "f 829/893/843 860/953/899 861/924/872\n"
-                                   "f 857/897/847 856/894/844 887/954/900\n"
-                                   "f 877/930/877 876/928/875 907/956/902\n"
-                                   "f 864/931/878 863/929/876 894/958/904\n"
-                                   "f 877/930/877 908/957/903 909/960/906\n"
-                                   "f 865/933/880 864/931/878 895/959/905\n"
-                                   "f 878/932/879 909/960/906 910/962/908\n"
-                                   "f 865/933/880 896/961/907 897/963/909\n"
-                                   "f 880/936/883 879/934/881 910/962/908\n"
-                                   "f 867/937/884 866/935/882 897/963/909\n"
-                                   "f 881/938/885 880/936/883 911/964/910\n"
-                                   "f 867/937/884 898/965/911 899/967/913\n"
-                                   "f 881/938/885 912/966/912 913/968/914\n"
-                                   "f 869/941/888 868/939/886 899/967/913\n"
-                                   "f 882/940/887 913/968/914 914/970/916\n"
-                                   "f 869/941/888 900/969/915 901/971/917\n"
-                                   "f 884/944/891 883/942/889 914/970/916\n"
-                                   "f 870/943/890 901/971/917 902/973/919\n"
-                                   "f 884/944/891 915/972/918 916/976/921\n"
-                                   "f 872/949/895 871/945/892 902/973/919\n"
-                                   "f 858/947/893 889/975/920 890/978/923\n"
-                                   "f 886/951/897 885/948/894 916/976/921\n"
-                                   "f 873/952/898 872/949/895 903/977/922\n"
-                                   "f 860/953/899 859/950/896 890/978/923\n"
-                                   "f 886/951/897 917/979/924 918/982/927\n"
-                                   "f 873/952/898 904/980/925 905/983/928\n"
-                                   "f 861/924/872 860/953/899 891/981/926\n"
-                                   "f 887/954/900 918/982/927 919/985/930\n"
-                                   "f 874/955/901 905/983/928 906/986/931\n"
-                                   "f 862/925/873 861/924/872 892/984/929\n"
-                                   "f 876/928/875 875/923/871 906/986/931\n"
-                                   "f 862/925/873 893/987/932 894/958/904\n"
-                                   "f 909/960/906 940/1020/962 941/989/933\n"
-                                   "f 896/961/907 927/1021/963 928/990/934\n"
-                                   "f 911/964/910 910/962/908 941/989/933\n"
-                                   "f 897/963/909 928/990/934 929/992/936\n"
-                                   "f 912/966/912 911/964/910 942/991/935\n"
-                                   "f 898/965/911 929/992/936 930/994/938\n"
-                                   "f 912/966/912 943/993/937 944/995/939\n"
-                                   "f 900/969/915 899/967/913 930/994/938\n"
-                                   "f 913/968/914 944/995/939 945/997/941\n"
-                                   "f 900/969/915 931/996/940 932/998/942\n"
-                                   "f 915/972/918 914/970/916 945/997/941\n"
-                                   "f 901/971/917 932/998/942 933/1000/944\n"
-                                   "f 915/972/918 946/999/943 947/1003/946\n"
-                                   "f 903/977/922 902/973/919 933/1000/944\n"
-                                   "f 889/975/920 920/1002/945 921/1005/948\n"
-                                   "f 917/979/924 916/976/921 947/1003/946\n"
-                                   "f 904/980/925 903/977/922 934/1004/947\n"
-                                   "f 891/981/926 890/978/923 921/1005/948\n"
-                                   "f 917/979/924 948/1006/949 949/1009/952\n"
-                                   "f 904/980/925 935/1007/950 936/1010/953\n"
-                                   "f 892/984/929 891/981/926 922/1008/951\n"
-                                   "f 918/982/927 949/1009/952 950/1012/955\n"
-                                   "f 905/983/928 936/1010/953 937/1013/956\n"
-                                   "f 893/987/932 892/984/929 923/1011/954\n"
-                                   "f 907/956/902 906/986/931 937/1013/956\n"
-                                   "f 893/987/932 924/1014/957 925/1017/959\n"
-                                   "f 908/957/903 907/956/902 938/1016/958\n"
-                                   "f 895/959/905 894/958/904 925/1017/959\n"
-                                   "f 908/957/903 939/1018/960 940/1020/962\n"
-                                   "f 896/961/907 895/959/905 926/1019/961\n"
-                                   "f 943/993/937 942/991/935 973/1022/964\n"
-                                   "f 929/992/936 960/1054/994 961/1024/966\n"
-                                   "f 943/993/937 974/1023/965 975/1025/967\n"
-                                   "f 931/996/940 930/994/938 961/1024/966\n"
-                                   "f 944/995/939 975/1025/967 976/1027/969\n"
-                                   "f 931/996/940 962/1026/968 963/1028/970\n"
-                                   "f 946/999/943 945/997/941 976/1027/969\n"
-                                   "f 933/1000/944 932/998/942 963/1028/970\n"
-                                   "f 946/999/943 977/1029/971 978/1033/974\n"
-                                   "f 934/1004/947 933/1000/944 964/1030/972\n"
-                                   "f 920/1002/945 951/1032/973 952/1035/976\n"
-                                   "f 948/1006/949 947/1003/946 978/1033/974\n"
-                                   "f 935/1007/950 934/1004/947 965/1034/975\n"
-                                   "f 922/1008/951 921/1005/948 952/1035/976\n"
-                                   "f 948/1006/949 979/1036/977 980/1039/980\n"
-                                   "f 935/1007/950 966/1037/978 967/1040/981\n"
-                                   "f 922/1008/951 953/1038/979 954/1041/982\n"
-                                   "f 949/1009/952 980/1039/980 981/1042/983\n"
-                                   "f 936/1010/953 967/1040/981 968/1043/984\n"
-                                   "f 924/1014/957 923/1011/954 954/1041/982\n"
-                                   "f 938/1016/958 937/1013/956 968/1043/984\n"
-                                   "f 924/1014/957 955/1044/985 956/1047/987\n"
-                                   "f 938/1016/958 969/1046/986 970/1048/988\n"
-                                   "f 926/1019/961 925/1017/959 956/1047/987\n"
-                                   "f 939/1018/960 970/1048/988 971/1050/990\n"
-                                   "f 927/1021/963 926/1019/961 957/1049/989\n"
-                                   "f 940/1020/962 971/1050/990 972/1052/992\n"
-                                   "f 927/1021/963 958/1051/991 959/1053/993\n"
-                                   "f 942/991/935 941/989/933 972/1052/992\n"
-                                   "f 928/990/934 959/1053/993 960/1054/994\n"
-                                   "f 975/1025/967 1006/1086/1024 1007/1055/995\n"
-                                   "f 962/1026/968 993/1087/1025 994/1056/996\n"
-                                   "f 977/1029/971 976/1027/969 1007/1055/995\n"
-                                   "f 964/1030/972 963/1028/970 994/1056/996\n"
-                                   "f 977/1029/971 1008/1057/997 1009/1061/1000\n"
-                                   "f 965/1034/975 964/1030/972 995/1058/998\n"
-                                   "f 951/1032/973 982/1060/999 983/1063/1002\n"
-                                   "f 979/1036/977 978/1033/974 1009/1061/1000\n"
-                                   "f 966/1037/978 965/1034/975 996/1062/1001\n"
-                                   "f 952/1035/976 983/1063/1002 984/1066/1005\n"
-                                   "f 979/1036/977 1010/1064/1003 1011/1067/1006\n"
-                                   "f 966/1037/978 997/1065/1004 998/1068/1007\n"
-                                   "f 953/1038/979 984/1066/1005 985/1069/1008\n"
-                                   "f 981/1042/983 980/1039/980 1011/1067/1006\n"
-                                   "f 967/1040/981 998/1068/1007 999/1071/1010\n"
-                                   "f 954/1041/982 985/1069/1008 986/1072/1011\n"
-                                   "f 969/1046/986 968/1043/984 999/1071/1010\n"
-                                   "f 955/1044/985 986/1072/1011 987/1075/1013\n"
-                                   "f 970/1048/988 969/1046/986 1000/1074/1012\n"
-                                   "f 957/1049/989 956/1047/987 987/1075/1013\n"
-                                   "f 970/1048/988 1001/1076/1014 1002/1078/1016\n"
-                                   "f 958/1051/991 957/1049/989 988/1077/1015\n"
-                                   "f 971/1050/990 1002/1078/1016 1003/1080/1018\n"
-                                   "f 958/1051/991 989/1079/1017 990/1081/1019\n"
-                                   "f 973/1022/964 972/1052/992 1003/1080/1018\n"
-                                   "f 959/1053/993 990/1081/1019 991/1083/1021\n"
-                                   "f 974/1023/965 973/1022/964 1004/1082/1020\n"
-                                   "f 960/1054/994 991/1083/1021 992/1085/1023\n"
-                                   "f 974/1023/965 1005/1084/1022 1006/1086/1024\n"
-                                   "f 962/1026/968 961/1024/966 992/1085/1023\n"
-                                   "f 1008/1057/997 1039/1120/1056 1040/1090/1027\n"
-                                   "f 996/1062/1001 995/1058/998 1026/1091/1028\n"
-                                   "f 982/1060/999 1013/1089/1026 1014/1093/1030\n"
-                                   "f 1010/1064/1003 1009/1061/1000 1040/1090/1027\n"
-                                   "f 997/1065/1004 996/1062/1001 1027/1092/1029\n"
-                                   "f 984/1066/1005 983/1063/1002 1014/1093/1030\n"
-                                   "f 1010/1064/1003 1041/1094/1031 1042/1097/1034\n"
-                                   "f 997/1065/1004 1028/1095/1032 1029/1098/1035\n"
-                                   "f 984/1066/1005 1015/1096/1033 1016/1099/1036\n"
-                                   "f 1012/1070/1009 1011/1067/1006 1042/1097/1034\n"
-                                   "f 998/1068/1007 1029/1098/1035 1030/1101/1038\n"
-                                   "f 985/1069/1008 1016/1099/1036 1017/1102/1039\n"
-                                   "f 1000/1074/1012 999/1071/1010 1030/1101/1038\n"
-                                   "f 986/1072/1011 1017/1102/1039 1018/1105/1041\n"
-                                   "f 1001/1076/1014 1000/1074/1012 1031/1104/1040\n"
-                                   "f 988/1077/1015 987/1075/1013 1018/1105/1041\n"
-                                   "f 1001/1076/1014 1032/1106/1042 1033/1108/1044\n"
-                                   "f 989/1079/1017 988/1077/1015 1019/1107/1043\n"
-                                   "f 1002/1078/1016 1033/1108/1044 1034/1110/1046\n"
-                                   "f 989/1079/1017 1020/1109/1045 1021/1111/1047\n"
-                                   "f 1004/1082/1020 1003/1080/1018 1034/1110/1046\n"
-                                   "f 990/1081/1019 1021/1111/1047 1022/1113/1049\n"
-                                   "f 1005/1084/1022 1004/1082/1020 1035/1112/1048\n"
-                                   "f 991/1083/1021 1022/1113/1049 1023/1115/1051\n"
-                                   "f 1005/1084/1022 1036/1114/1050 1037/1116/1052\n"
-                                   "f 993/1087/1025 992/1085/1023 1023/1115/1051\n"
-                                   "f 1006/1086/1024 1037/1116/1052 1038/1118/1054\n"
-                                   "f 993/1087/1025 1024/1117/1053 1025/1119/1055\n"
-                                   "f 1008/1057/997 1007/1055/995 1038/1118/1054\n"
-                                   "f 994/1056/996 1025/1119/1055 1026/1091/1028\n"
-                                   "f 1014/1093/1030 1045/1151/1085 1046/1121/1057\n"
-                                   "f 1041/1094/1031 1072/1152/1086 1073/1122/1058\n"
-                                   "f 1028/1095/1032 1059/1153/1087 1060/1123/1059\n"
-                                   "f 1015/1096/1033 1046/1121/1057 1047/1124/1060\n"
-                                   "f 1042/1097/1034 1073/1122/1058 1074/1125/1061\n"
-                                   "f 1029/1098/1035 1060/1123/1059 1061/1126/1062\n"
-                                   "f 1016/1099/1036 1047/1124/1060 1048/1127/1063\n"
-                                   "f 1031/1104/1040 1030/1101/1038 1061/1126/1062\n"
-                                   "f 1017/1102/1039 1048/1127/1063 1049/1130/1065\n"
-                                   "f 1032/1106/1042 1031/1104/1040 1062/1129/1064\n"
-                                   "f 1019/1107/1043 1018/1105/1041 1049/1130/1065\n"
-                                   "f 1032/1106/1042 1063/1131/1066 1064/1133/1068\n"
-                                   "f 1020/1109/1045 1019/1107/1043 1050/1132/1067\n"
-                                   "f 1033/1108/1044 1064/1133/1068 1065/1135/1070\n"
-                                   "f 1020/1109/1045 1051/1134/1069 1052/1136/1071\n"
-                                   "f 1035/1112/1048 1034/1110/1046 1065/1135/1070\n"
-                                   "f 1021/1111/1047 1052/1136/1071 1053/1138/1073\n"
-                                   "f 1036/1114/1050 1035/1112/1048 1066/1137/1072\n"
-                                   "f 1022/1113/1049 1053/1138/1073 1054/1140/1075\n"
-                                   "f 1036/1114/1050 1067/1139/1074 1068/1141/1076\n"
-                                   "f 1024/1117/1053 1023/1115/1051 1054/1140/1075\n"
-                                   "f 1037/1116/1052 1068/1141/1076 1069/1143/1078\n"
-                                   "f 1024/1117/1053 1055/1142/1077 1056/1144/1079\n"
-                                   "f 1039/1120/1056 1038/1118/1054 1069/1143/1078\n"
-                                   "f 1025/1119/1055 1056/1144/1079 1057/1146/1081\n"
-                                   "f 1039/1120/1056 1070/1145/1080 1071/1149/1083\n"
-                                   "f 1027/1092/1029 1026/1091/1028 1057/1146/1081\n"
-                                   "f 1014/1093/1030 1013/1089/1026 1044/1148/1082\n"
-                                   "f 1041/1094/1031 1040/1090/1027 1071/1149/1083\n"
-                                   "f 1028/1095/1032 1027/1092/1029 1058/1150/1084\n"
-                                   "f 1047/1124/1060 1078/1186/1118 1079/1154/1088\n"
-                                   "f 1062/1129/1064 1061/1126/1062 1092/1157/1090\n"
-                                   "f 1048/1127/1063 1079/1154/1088 1080/1159/1092\n"
-                                   "f 1062/1129/1064 1093/1158/1091 1094/1160/1093\n"
-                                   "f 1050/1132/1067 1049/1130/1065 1080/1159/1092\n"
-                                   "f 1063/1131/1066 1094/1160/1093 1095/1162/1095\n"
-                                   "f 1051/1134/1069 1050/1132/1067 1081/1161/1094\n"
-                                   "f 1064/1133/1068 1095/1162/1095 1096/1164/1097\n"
-                                   "f 1051/1134/1069 1082/1163/1096 1083/1165/1098\n"
-                                   "f 1066/1137/1072 1065/1135/1070 1096/1164/1097\n"
-                                   "f 1052/1136/1071 1083/1165/1098 1084/1167/1100\n"
-                                   "f 1067/1139/1074 1066/1137/1072 1097/1166/1099\n"
-                                   "f 1053/1138/1073 1084/1167/1100 1085/1169/1102\n"
-                                   "f 1067/1139/1074 1098/1168/1101 1099/1170/1103\n"
-                                   "f 1055/1142/1077 1054/1140/1075 1085/1169/1102\n"
-                                   "f 1068/1141/1076 1099/1170/1103 1100/1172/1105\n"
-                                   "f 1055/1142/1077 1086/1171/1104 1087/1173/1106\n"
-                                   "f 1070/1145/1080 1069/1143/1078 1100/1172/1105\n"
-                                   "f 1057/1146/1081 1056/1144/1079 1087/1173/1106\n"
-                                   "f 1070/1145/1080 1101/1174/1107 1102/1178/1110\n"
-                                   "f 1058/1150/1084 1057/1146/1081 1088/1175/1108\n"
-                                   "f 1045/1151/1085 1044/1148/1082 1075/1177/1109\n"
-                                   "f 1072/1152/1086 1071/1149/1083 1102/1178/1110\n"
-                                   "f 1058/1150/1084 1089/1179/1111 1090/1182/1114\n"
-                                   "f 1046/1121/1057 1045/1151/1085 1076/1180/1112\n"
-                                   "f 1072/1152/1086 1103/1181/1113 1104/1184/1116\n"
-                                   "f 1059/1153/1087 1090/1182/1114 1091/1185/1117\n"
-                                   "f 1046/1121/1057 1077/1183/1115 1078/1186/1118\n"
-                                   "f 1073/1122/1058 1104/1184/1116 1105/1156/1089\n"
-                                   "f 1060/1123/1059 1091/1185/1117 1092/1157/1090\n"
-                                   "f 1081/1161/1094 1080/1159/1092 1111/1187/1119\n"
-                                   "f 1094/1160/1093 1125/1219/1149 1126/1189/1121\n"
-                                   "f 1082/1163/1096 1081/1161/1094 1112/1188/1120\n"
-                                   "f 1095/1162/1095 1126/1189/1121 1127/1191/1123\n"
-                                   "f 1082/1163/1096 1113/1190/1122 1114/1192/1124\n"
-                                   "f 1097/1166/1099 1096/1164/1097 1127/1191/1123\n"
-                                   "f 1084/1167/1100 1083/1165/1098 1114/1192/1124\n"
-                                   "f 1098/1168/1101 1097/1166/1099 1128/1193/1125\n"
-                                   "f 1084/1167/1100 1115/1194/1126 1116/1196/1128\n"
-                                   "f 1098/1168/1101 1129/1195/1127 1130/1197/1129\n"
-                                   "f 1086/1171/1104 1085/1169/1102 1116/1196/1128\n"
-                                   "f 1099/1170/1103 1130/1197/1129 1131/1199/1131\n"
-                                   "f 1086/1171/1104 1117/1198/1130 1118/1200/1132\n"
-                                   "f 1101/1174/1107 1100/1172/1105 1131/1199/1131\n"
-                                   "f 1088/1175/1108 1087/1173/1106 1118/1200/1132\n"
-                                   "f 1101/1174/1107 1132/1201/1133 1133/1205/1136\n"
-                                   "f 1089/1179/1111 1088/1175/1108 1119/1202/1134\n"
-                                   "f 1075/1177/1109 1106/1204/1135 1107/1207/1138\n"
-                                   "f 1103/1181/1113 1102/1178/1110 1133/1205/1136\n"
-                                   "f 1090/1182/1114 1089/1179/1111 1120/1206/1137\n"
-                                   "f 1076/1180/1112 1107/1207/1138 1108/1210/1141\n"
-                                   "f 1103/1181/1113 1134/1208/1139 1135/1211/1142\n"
-                                   "f 1090/1182/1114 1121/1209/1140 1122/1212/1143\n"
-                                   "f 1077/1183/1115 1108/1210/1141 1109/1213/1144\n"
-                                   "f 1105/1156/1089 1104/1184/1116 1135/1211/1142\n"
-                                   "f 1091/1185/1117 1122/1212/1143 1123/1215/1146\n"
-                                   "f 1078/1186/1118 1109/1213/1144 1110/1216/1147\n"
-                                   "f 1093/1158/1091 1092/1157/1090 1123/1215/1146\n"
-                                   "f 1079/1154/1088 1110/1216/1147 1111/1187/1119\n"
-                                   "f 1093/1158/1091 1124/1218/1148 1125/1219/1149\n"
-                                   "f 1113/1190/1122 1145/1252/1180 1146/1220/1150\n"
-                                   "f 1128/1193/1125 1127/1191/1123 1159/1221/1151\n"
-                                   "f 1114/1192/1124 1146/1220/1150 1147/1223/1153\n"
-                                   "f 1129/1195/1127 1128/1193/1125 1160/1222/1152\n"
-                                   "f 1115/1194/1126 1147/1223/1153 1148/1225/1155\n"
-                                   "f 1129/1195/1127 1161/1224/1154 1162/1226/1156\n"
-                                   "f 1117/1198/1130 1116/1196/1128 1148/1225/1155\n"
-                                   "f 1130/1197/1129 1162/1226/1156 1163/1228/1158\n"
-                                   "f 1117/1198/1130 1149/1227/1157 1150/1229/1159\n"
-                                   "f 1132/1201/1133 1131/1199/1131 1163/1228/1158\n"
-                                   "f 1118/1200/1132 1150/1229/1159 1151/1231/1161\n"
-                                   "f 1132/1201/1133 1164/1230/1160 1165/1234/1163\n"
-                                   "f 1120/1206/1137 1119/1202/1134 1151/1231/1161\n"
-                                   "f 1106/1204/1135 1138/1233/1162 1139/1236/1165\n"
-                                   "f 1134/1208/1139 1133/1205/1136 1165/1234/1163\n"
-                                   "f 1121/1209/1140 1120/1206/1137 1152/1235/1164\n"
-                                   "f 1108/1210/1141 1107/1207/1138 1139/1236/1165\n"
-                                   "f 1134/1208/1139 1166/1237/1166 1167/1240/1169\n"
-                                   "f 1121/1209/1140 1153/1238/1167 1154/1241/1170\n"
-                                   "f 1108/1210/1141 1140/1239/1168 1141/1242/1171\n"
-                                   "f 1136/1214/1145 1135/1211/1142 1167/1240/1169\n"
-                                   "f 1122/1212/1143 1154/1241/1170 1155/1244/1173\n"
-                                   "f 1109/1213/1144 1141/1242/1171 1142/1245/1174\n"
-                                   "f 1124/1218/1148 1123/1215/1146 1155/1244/1173\n"
-                                   "f 1110/1216/1147 1142/1245/1174 1143/1248/1176\n"
-                                   "f 1124/1218/1148 1156/1247/1175 1157/1249/1177\n"
-                                   "f 1112/1188/1120 1111/1187/1119 1143/1248/1176\n"
-                                   "f 1125/1219/1149 1157/1249/1177 1158/1251/1179\n"
-                                   "f 1113/1190/1122 1112/1188/1120 1144/1250/1178\n"
-                                   "f 1126/1189/1121 1158/1251/1179 1159/1221/1151\n"
-                                   "f 1147/1223/1153 1178/1284/1210 1179/1253/1181\n"
-                                   "f 1161/1224/1154 1192/1285/1211 1193/1254/1182\n"
-                                   "f 1149/1227/1157 1148/1225/1155 1179/1253/1181\n"
-                                   "f 1162/1226/1156 1193/1254/1182 1194/1256/1184\n"
-                                   "f 1149/1227/1157 1180/1255/1183 1181/1257/1185\n"
-                                   "f 1163/1228/1158 1194/1256/1184 1195/1258/1186\n"
-                                   "f 1150/1229/1159 1181/1257/1185 1182/1259/1187\n"
-                                   "f 1164/1230/1160 1195/1258/1186 1196/1262/1189\n"
-                                   "f 1152/1235/1164 1151/1231/1161 1182/1259/1187\n"
-                                   "f 1138/1233/1162 1169/1261/1188 1170/1264/1191\n"
-                                   "f 1166/1237/1166 1165/1234/1163 1196/1262/1189\n"
-                                   "f 1153/1238/1167 1152/1235/1164 1183/1263/1190\n"
-                                   "f 1139/1236/1165 1170/1264/1191 1171/1267/1194\n"
-                                   "f 1166/1237/1166 1197/1265/1192 1198/1268/1195\n"
-                                   "f 1153/1238/1167 1184/1266/1193 1185/1269/1196\n"
-                                   "f 1140/1239/1168 1171/1267/1194 1172/1270/1197\n"
-                                   "f 1167/1240/1169 1198/1268/1195 1199/1271/1198\n"
-                                   "f 1154/1241/1170 1185/1269/1196 1186/1272/1199\n"
-                                   "f 1141/1242/1171 1172/1270/1197 1173/1273/1200\n"
-                                   "f 1156/1247/1175 1155/1244/1173 1186/1272/1199\n"
-                                   "f 1142/1245/1174 1173/1273/1200 1174/1276/1202\n"
-                                   "f 1157/1249/1177 1156/1247/1175 1187/1275/1201\n"
-                                   "f 1144/1250/1178 1143/1248/1176 1174/1276/1202\n"
-                                   "f 1157/1249/1177 1188/1277/1203 1189/1279/1205\n"
-                                   "f 1145/1252/1180 1144/1250/1178 1175/1278/1204\n"
-                                   "f 1158/1251/1179 1189/1279/1205 1190/1281/1207\n"
-                                   "f 1145/1252/1180 1176/1280/1206 1177/1282/1208\n"
-                                   "f 1160/1222/1152 1159/1221/1151 1190/1281/1207\n"
-                                   "f 1146/1220/1150 1177/1282/1208 1178/1284/1210\n"
-                                   "f 1161/1224/1154 1160/1222/1152 1191/1283/1209\n"
-                                   "f 1180/1255/1183 1211/1318/1242 1212/1286/1212\n"
-                                   "f 1195/1258/1186 1194/1256/1184 1225/1287/1213\n"
-                                   "f 1181/1257/1185 1212/1286/1212 1213/1289/1215\n"
-                                   "f 1195/1258/1186 1226/1288/1214 1227/1292/1217\n"
-                                   "f 1183/1263/1190 1182/1259/1187 1213/1289/1215\n"
-                                   "f 1169/1261/1188 1200/1291/1216 1201/1294/1219\n"
-                                   "f 1197/1265/1192 1196/1262/1189 1227/1292/1217\n"
-                                   "f 1184/1266/1193 1183/1263/1190 1214/1293/1218\n"
-                                   "f 1171/1267/1194 1170/1264/1191 1201/1294/1219\n"
-                                   "f 1197/1265/1192 1228/1295/1220 1229/1298/1223\n"
-                                   "f 1184/1266/1193 1215/1296/1221 1216/1299/1224\n"
-                                   "f 1171/1267/1194 1202/1297/1222 1203/1300/1225\n"
-                                   "f 1198/1268/1195 1229/1298/1223 1230/1301/1226\n"
-                                   "f 1185/1269/1196 1216/1299/1224 1217/1302/1227\n"
-                                   "f 1172/1270/1197 1203/1300/1225 1204/1303/1228\n"
-                                   "f 1187/1275/1201 1186/1272/1199 1217/1302/1227\n"
-                                   "f 1173/1273/1200 1204/1303/1228 1205/1306/1230\n"
-                                   "f 1188/1277/1203 1187/1275/1201 1218/1305/1229\n"
-                                   "f 1175/1278/1204 1174/1276/1202 1205/1306/1230\n"
-                                   "f 1188/1277/1203 1219/1307/1231 1220/1309/1233\n"
-                                   "f 1176/1280/1206 1175/1278/1204 1206/1308/1232\n"
-                                   "f 1189/1279/1205 1220/1309/1233 1221/1311/1235\n"
-                                   "f 1176/1280/1206 1207/1310/1234 1208/1312/1236\n"
-                                   "f 1191/1283/1209 1190/1281/1207 1221/1311/1235\n"
-                                   "f 1177/1282/1208 1208/1312/1236 1209/1314/1238\n"
-                                   "f 1192/1285/1211 1191/1283/1209 1222/1313/1237\n"
-                                   "f 1179/1253/1181 1178/1284/1210 1209/1314/1238\n"
-                                   "f 1192/1285/1211 1223/1315/1239 1224/1317/1241\n"
-                                   "f 1180/1255/1183 1179/1253/1181 1210/1316/1240\n"
-                                   "f 1193/1254/1182 1224/1317/1241 1225/1287/1213\n"
-                                   "f 1214/1293/1218 1213/1289/1215 1244/1319/1243\n"
-                                   "f 1200/1291/1216 1231/1351/1273 1232/1321/1245\n"
-                                   "f 1228/1295/1220 1227/1292/1217 1258/1322/1246\n"
-                                   "f 1215/1296/1221 1214/1293/1218 1245/1320/1244\n"
-                                   "f 1201/1294/1219 1232/1321/1245 1233/1325/1249\n"
-                                   "f 1228/1295/1220 1259/1323/1247 1260/1326/1250\n"
-                                   "f 1215/1296/1221 1246/1324/1248 1247/1327/1251\n"
-                                   "f 1202/1297/1222 1233/1325/1249 1234/1328/1252\n"
-                                   "f 1230/1301/1226 1229/1298/1223 1260/1326/1250\n"
-                                   "f 1216/1299/1224 1247/1327/1251 1248/1330/1254\n"
-                                   "f 1203/1300/1225 1234/1328/1252 1235/1331/1255\n"
-                                   "f 1218/1305/1229 1217/1302/1227 1248/1330/1254\n"
-                                   "f 1204/1303/1228 1235/1331/1255 1236/1334/1257\n"
-                                   "f 1219/1307/1231 1218/1305/1229 1249/1333/1256\n"
-                                   "f 1206/1308/1232 1205/1306/1230 1236/1334/1257\n"
-                                   "f 1219/1307/1231 1250/1335/1258 1251/1337/1260\n"
-                                   "f 1207/1310/1234 1206/1308/1232 1237/1336/1259\n"
-                                   "f 1220/1309/1233 1251/1337/1260 1252/1339/1262\n"
-                                   "f 1207/1310/1234 1238/1338/1261 1239/1340/1263\n"
-                                   "f 1222/1313/1237 1221/1311/1235 1252/1339/1262\n"
-                                   "f 1208/1312/1236 1239/1340/1263 1240/1342/1265\n"
-                                   "f 1223/1315/1239 1222/1313/1237 1253/1341/1264\n"
-                                   "f 1209/1314/1238 1240/1342/1265 1241/1344/1267\n"
-                                   "f 1223/1315/1239 1254/1343/1266 1255/1345/1268\n"
-                                   "f 1211/1318/1242 1210/1316/1240 1241/1344/1267\n"
-                                   "f 1224/1317/1241 1255/1345/1268 1256/1347/1270\n"
-                                   "f 1212/1286/1212 1211/1318/1242 1242/1346/1269\n"
-                                   "f 1226/1288/1214 1225/1287/1213 1256/1347/1270\n"
-                                   "f 1212/1286/1212 1243/1348/1271 1244/1319/1243\n"
-                                   "f 1226/1288/1214 1257/1349/1272 1258/1322/1246\n"
-                                   "f 1246/1324/1248 1277/1383/1303 1278/1352/1274\n"
-                                   "f 1234/1328/1252 1233/1325/1249 1264/1353/1275\n"
-                                   "f 1260/1326/1250 1291/1384/1304 1292/1355/1277\n"
-                                   "f 1247/1327/1251 1278/1352/1274 1279/1356/1278\n"
-                                   "f 1234/1328/1252 1265/1354/1276 1266/1357/1279\n"
-                                   "f 1249/1333/1256 1248/1330/1254 1279/1356/1278\n"
-                                   "f 1235/1331/1255 1266/1357/1279 1267/1360/1281\n"
-                                   "f 1250/1335/1258 1249/1333/1256 1280/1359/1280\n"
-                                   "f 1237/1336/1259 1236/1334/1257 1267/1360/1281\n"
-                                   "f 1250/1335/1258 1281/1361/1282 1282/1363/1284\n"
-                                   "f 1238/1338/1261 1237/1336/1259 1268/1362/1283\n"
-                                   "f 1251/1337/1260 1282/1363/1284 1283/1365/1286\n"
-                                   "f 1238/1338/1261 1269/1364/1285 1270/1366/1287\n"
-                                   "f 1253/1341/1264 1252/1339/1262 1283/1365/1286\n"
-                                   "f 1239/1340/1263 1270/1366/1287 1271/1368/1289\n"
-                                   "f 1254/1343/1266 1253/1341/1264 1284/1367/1288\n"
-                                   "f 1240/1342/1265 1271/1368/1289 1272/1370/1291\n"
-                                   "f 1254/1343/1266 1285/1369/1290 1286/1371/1292\n"
-                                   "f 1242/1346/1269 1241/1344/1267 1272/1370/1291\n"
-                                   "f 1255/1345/1268 1286/1371/1292 1287/1373/1294\n"
-                                   "f 1243/1348/1271 1242/1346/1269 1273/1372/1293\n"
-                                   "f 1257/1349/1272 1256/1347/1270 1287/1373/1294\n"
-                                   "f 1243/1348/1271 1274/1374/1295 1275/1376/1297\n"
-                                   "f 1258/1322/1246 1257/1349/1272 1288/1375/1296\n"
-                                   "f 1245/1320/1244 1244/1319/1243 1275/1376/1297\n"
-                                   "f 1231/1351/1273 1262/1378/1298 1263/1381/1301\n"
-                                   "f 1259/1323/1247 1258/1322/1246 1289/1379/1299\n"
-                                   "f 1246/1324/1248 1245/1320/1244 1276/1380/1300\n"
-                                   "f 1233/1325/1249 1232/1321/1245 1263/1381/1301\n"
-                                   "f 1259/1323/1247 1290/1382/1302 1291/1384/1304\n"
-                                   "f 1280/1359/1280 1279/1356/1278 1310/1385/1305\n"
-                                   "f 1266/1357/1279 1297/1416/1335 1298/1387/1307\n"
-                                   "f 1281/1361/1282 1280/1359/1280 1311/1386/1306\n"
-                                   "f 1268/1362/1283 1267/1360/1281 1298/1387/1307\n"
-                                   "f 1281/1361/1282 1312/1388/1308 1313/1390/1310\n"
-                                   "f 1269/1364/1285 1268/1362/1283 1299/1389/1309\n"
-                                   "f 1282/1363/1284 1313/1390/1310 1314/1392/1312\n"
-                                   "f 1269/1364/1285 1300/1391/1311 1301/1393/1313\n"
-                                   "f 1284/1367/1288 1283/1365/1286 1314/1392/1312\n"
-                                   "f 1270/1366/1287 1301/1393/1313 1302/1395/1315\n"
-                                   "f 1285/1369/1290 1284/1367/1288 1315/1394/1314\n"
-                                   "f 1271/1368/1289 1302/1395/1315 1303/1397/1317\n"
-                                   "f 1285/1369/1290 1316/1396/1316 1317/1398/1318\n"
-                                   "f 1272/1370/1291 1303/1397/1317 1304/1399/1319\n"
-                                   "f 1286/1371/1292 1317/1398/1318 1318/1400/1320\n"
-                                   "f 1274/1374/1295 1273/1372/1293 1304/1399/1319\n"
-                                   "f 1288/1375/1296 1287/1373/1294 1318/1400/1320\n"
-                                   "f 1274/1374/1295 1305/1401/1321 1306/1403/1323\n"
-                                   "f 1288/1375/1296 1319/1402/1322 1320/1406/1325\n"
-                                   "f 1276/1380/1300 1275/1376/1297 1306/1403/1323\n"
-                                   "f 1262/1378/1298 1293/1405/1324 1294/1408/1327\n"
-                                   "f 1289/1379/1299 1320/1406/1325 1321/1409/1328\n"
-                                   "f 1277/1383/1303 1276/1380/1300 1307/1407/1326\n"
-                                   "f 1264/1353/1275 1263/1381/1301 1294/1408/1327\n"
-                                   "f 1290/1382/1302 1321/1409/1328 1322/1412/1331\n"
-                                   "f 1277/1383/1303 1308/1410/1329 1309/1413/1332\n"
-                                   "f 1264/1353/1275 1295/1411/1330 1296/1414/1333\n"
-                                   "f 1292/1355/1277 1291/1384/1304 1322/1412/1331\n"
-                                   "f 1278/1352/1274 1309/1413/1332 1310/1385/1305\n"
-                                   "f 1265/1354/1276 1296/1414/1333 1297/1416/1335\n"
-                                   "f 1312/1388/1308 1343/1450/1366 1344/1418/1336\n"
-                                   "f 1300/1391/1311 1299/1389/1309 1330/1419/1337\n"
-                                   "f 1313/1390/1310 1344/1418/1336 1345/1421/1339\n"
-                                   "f 1300/1391/1311 1331/1420/1338 1332/1422/1340\n"
-                                   "f 1315/1394/1314 1314/1392/1312 1345/1421/1339\n"
-                                   "f 1301/1393/1313 1332/1422/1340 1333/1424/1342\n"
-                                   "f 1316/1396/1316 1315/1394/1314 1346/1423/1341\n"
-                                   "f 1303/1397/1317 1302/1395/1315 1333/1424/1342\n"
-                                   "f 1316/1396/1316 1347/1425/1343 1348/1427/1345\n"
-                                   "f 1303/1397/1317 1334/1426/1344 1335/1428/1346\n"
-                                   "f 1317/1398/1318 1348/1427/1345 1349/1429/1347\n"
-                                   "f 1305/1401/1321 1304/1399/1319 1335/1428/1346\n"
-                                   "f 1319/1402/1322 1318/1400/1320 1349/1429/1347\n"
-                                   "f 1305/1401/1321 1336/1430/1348 1337/1432/1350\n"
-                                   "f 1319/1402/1322 1350/1431/1349 1351/1435/1352\n"
-                                   "f 1307/1407/1326 1306/1403/1323 1337/1432/1350\n"
-                                   "f 1293/1405/1324 1324/1434/1351 1325/1437/1354\n"
-                                   "f 1321/1409/1328 1320/1406/1325 1351/1435/1352\n"
-                                   "f 1308/1410/1329 1307/1407/1326 1338/1436/1353\n"
-                                   "f 1295/1411/1330 1294/1408/1327 1325/1437/1354\n"
-                                   "f 1321/1409/1328 1352/1438/1355 1353/1441/1358\n"
-                                   "f 1308/1410/1329 1339/1439/1356 1340/1442/1359\n"
-                                   "f 1295/1411/1330 1326/1440/1357 1327/1443/1360\n"
-                                   "f 1322/1412/1331 1353/1441/1358 1354/1444/1361\n"
-                                   "f 1309/1413/1332 1340/1442/1359 1341/1445/1362\n"
-                                   "f 1297/1416/1335 1296/1414/1333 1327/1443/1360\n"
-                                   "f 1311/1386/1306 1310/1385/1305 1341/1445/1362\n"
-                                   "f 1297/1416/1335 1328/1446/1363 1329/1449/1365\n"
-                                   "f 1312/1388/1308 1311/1386/1306 1342/1448/1364\n"
-                                   "f 1299/1389/1309 1298/1387/1307 1329/1449/1365\n"
-                                   "f 1346/1423/1341 1345/1421/1339 1376/1451/1367\n"
-                                   "f 1332/1422/1340 1363/1483/1397 1364/1453/1369\n"
-                                   "f 1347/1425/1343 1346/1423/1341 1377/1452/1368\n"
-                                   "f 1334/1426/1344 1333/1424/1342 1364/1453/1369\n"
-                                   "f 1347/1425/1343 1378/1454/1370 1379/1456/1372\n"
-                                   "f 1334/1426/1344 1365/1455/1371 1366/1457/1373\n"
-                                   "f 1348/1427/1345 1379/1456/1372 1380/1458/1374\n"
-                                   "f 1336/1430/1348 1335/1428/1346 1366/1457/1373\n"
-                                   "f 1350/1431/1349 1349/1429/1347 1380/1458/1374\n"
-                                   "f 1336/1430/1348 1367/1459/1375 1368/1461/1377\n"
-                                   "f 1350/1431/1349 1381/1460/1376 1382/1464/1379\n"
-                                   "f 1338/1436/1353 1337/1432/1350 1368/1461/1377\n"
-                                   "f 1324/1434/1351 1355/1463/1378 1356/1466/1381\n"
-                                   "f 1351/1435/1352 1382/1464/1379 1383/1467/1382\n"
-                                   "f 1339/1439/1356 1338/1436/1353 1369/1465/1380\n"
-                                   "f 1325/1437/1354 1356/1466/1381 1357/1469/1384\n"
-                                   "f 1352/1438/1355 1383/1467/1382 1384/1470/1385\n"
-                                   "f 1339/1439/1356 1370/1468/1383 1371/1471/1386\n"
-                                   "f 1327/1443/1360 1326/1440/1357 1357/1469/1384\n"
-                                   "f 1353/1441/1358 1384/1470/1385 1385/1473/1388\n"
-                                   "f 1340/1442/1359 1371/1471/1386 1372/1474/1389\n"
-                                   "f 1327/1443/1360 1358/1472/1387 1359/1475/1390\n"
-                                   "f 1342/1448/1364 1341/1445/1362 1372/1474/1389\n"
-                                   "f 1328/1446/1363 1359/1475/1390 1360/1478/1392\n"
-                                   "f 1343/1450/1366 1342/1448/1364 1373/1477/1391\n"
-                                   "f 1330/1419/1337 1329/1449/1365 1360/1478/1392\n"
-                                   "f 1343/1450/1366 1374/1479/1393 1375/1481/1395\n"
-                                   "f 1331/1420/1338 1330/1419/1337 1361/1480/1394\n"
-                                   "f 1344/1418/1336 1375/1481/1395 1376/1451/1367\n"
-                                   "f 1331/1420/1338 1362/1482/1396 1363/1483/1397\n"
-                                   "f 1378/1454/1370 1409/1515/1427 1410/1484/1398\n"
-                                   "f 1365/1455/1371 1396/1516/1428 1397/1485/1399\n"
-                                   "f 1379/1456/1372 1410/1484/1398 1411/1486/1400\n"
-                                   "f 1367/1459/1375 1366/1457/1373 1397/1485/1399\n"
-                                   "f 1381/1460/1376 1380/1458/1374 1411/1486/1400\n"
-                                   "f 1367/1459/1375 1398/1487/1401 1399/1489/1403\n"
-                                   "f 1382/1464/1379 1381/1460/1376 1412/1488/1402\n"
-                                   "f 1369/1465/1380 1368/1461/1377 1399/1489/1403\n"
-                                   "f 1355/1463/1378 1386/1491/1404 1387/1494/1407\n"
-                                   "f 1382/1464/1379 1413/1492/1405 1414/1495/1408\n"
-                                   "f 1370/1468/1383 1369/1465/1380 1400/1493/1406\n"
-                                   "f 1357/1469/1384 1356/1466/1381 1387/1494/1407\n"
-                                   "f 1383/1467/1382 1414/1495/1408 1415/1498/1411\n"
-                                   "f 1370/1468/1383 1401/1496/1409 1402/1499/1412\n"
-                                   "f 1358/1472/1387 1357/1469/1384 1388/1497/1410\n"
-                                   "f 1384/1470/1385 1415/1498/1411 1416/1501/1414\n"
-                                   "f 1371/1471/1386 1402/1499/1412 1403/1502/1415\n"
-                                   "f 1358/1472/1387 1389/1500/1413 1390/1503/1416\n"
-                                   "f 1373/1477/1391 1372/1474/1389 1403/1502/1415\n"
-                                   "f 1359/1475/1390 1390/1503/1416 1391/1506/1418\n"
-                                   "f 1373/1477/1391 1404/1505/1417 1405/1507/1419\n"
-                                   "f 1361/1480/1394 1360/1478/1392 1391/1506/1418\n"
-                                   "f 1374/1479/1393 1405/1507/1419 1406/1509/1421\n"
-                                   "f 1362/1482/1396 1361/1480/1394 1392/1508/1420\n"
-                                   "f 1375/1481/1395 1406/1509/1421 1407/1511/1423\n"
-                                   "f 1362/1482/1396 1393/1510/1422 1394/1512/1424\n"
-                                   "f 1377/1452/1368 1376/1451/1367 1407/1511/1423\n"
-                                   "f 1363/1483/1397 1394/1512/1424 1395/1514/1426\n"
-                                   "f 1378/1454/1370 1377/1452/1368 1408/1513/1425\n"
-                                   "f 1365/1455/1371 1364/1453/1369 1395/1514/1426\n"
-                                   "f 1412/1488/1402 1411/1486/1400 1442/1517/1429\n"
-                                   "f 1398/1487/1401 1429/1549/1459 1430/1519/1431\n"
-                                   "f 1413/1492/1405 1412/1488/1402 1443/1518/1430\n"
-                                   "f 1400/1493/1406 1399/1489/1403 1430/1519/1431\n"
-                                   "f 1386/1491/1404 1417/1521/1432 1418/1524/1435\n"
-                                   "f 1414/1495/1408 1413/1492/1405 1444/1522/1433\n"
-                                   "f 1401/1496/1409 1400/1493/1406 1431/1523/1434\n"
-                                   "f 1388/1497/1410 1387/1494/1407 1418/1524/1435\n"
-                                   "f 1414/1495/1408 1445/1525/1436 1446/1528/1439\n"
-                                   "f 1401/1496/1409 1432/1526/1437 1433/1529/1440\n"
-                                   "f 1389/1500/1413 1388/1497/1410 1419/1527/1438\n"
-                                   "f 1416/1501/1414 1415/1498/1411 1446/1528/1439\n"
-                                   "f 1402/1499/1412 1433/1529/1440 1434/1532/1443\n"
-                                   "f 1389/1500/1413 1420/1530/1441 1421/1533/1444\n"
-                                   "f 1404/1505/1417 1403/1502/1415 1434/1532/1443\n"
-                                   "f 1390/1503/1416 1421/1533/1444 1422/1536/1446\n"
-                                   "f 1404/1505/1417 1435/1535/1445 1436/1537/1447\n"
-                                   "f 1392/1508/1420 1391/1506/1418 1422/1536/1446\n"
-                                   "f 1405/1507/1419 1436/1537/1447 1437/1539/1449\n"
-                                   "f 1393/1510/1422 1392/1508/1420 1423/1538/1448\n"
-                                   "f 1406/1509/1421 1437/1539/1449 1438/1541/1451\n"
-                                   "f 1393/1510/1422 1424/1540/1450 1425/1542/1452\n"
-                                   "f 1408/1513/1425 1407/1511/1423 1438/1541/1451\n"
-                                   "f 1394/1512/1424 1425/1542/1452 1426/1544/1454\n"
-                                   "f 1409/1515/1427 1408/1513/1425 1439/1543/1453\n"
-                                   "f 1396/1516/1428 1395/1514/1426 1426/1544/1454\n"
-                                   "f 1409/1515/1427 1440/1545/1455 1441/1547/1457\n"
-                                   "f 1396/1516/1428 1427/1546/1456 1428/1548/1458\n"
-                                   "f 1410/1484/1398 1441/1547/1457 1442/1517/1429\n"
-                                   "f 1398/1487/1401 1397/1485/1399 1428/1548/1458\n"
-                                   "f 1444/1522/1433 1476/1582/1490 1477/1550/1460\n"
-                                   "f 1432/1526/1437 1431/1523/1434 1463/1551/1461\n"
-                                   "f 1419/1527/1438 1418/1524/1435 1450/1553/1463\n"
-                                   "f 1445/1525/1436 1477/1550/1460 1478/1555/1465\n"
-                                   "f 1432/1526/1437 1464/1552/1462 1465/1556/1466\n"
-                                   "f 1420/1530/1441 1419/1527/1438 1451/1554/1464\n"
-                                   "f 1447/1531/1442 1446/1528/1439 1478/1555/1465\n"
-                                   "f 1433/1529/1440 1465/1556/1466 1466/1559/1469\n"
-                                   "f 1420/1530/1441 1452/1557/1467 1453/1560/1470\n"
-                                   "f 1435/1535/1445 1434/1532/1443 1466/1559/1469\n"
-                                   "f 1421/1533/1444 1453/1560/1470 1454/1563/1472\n"
-                                   "f 1435/1535/1445 1467/1562/1471 1468/1564/1473\n"
-                                   "f 1423/1538/1448 1422/1536/1446 1454/1563/1472\n"
-                                   "f 1436/1537/1447 1468/1564/1473 1469/1566/1475\n"
-                                   "f 1424/1540/1450 1423/1538/1448 1455/1565/1474\n"
-                                   "f 1437/1539/1449 1469/1566/1475 1470/1568/1477\n"
-                                   "f 1424/1540/1450 1456/1567/1476 1457/1569/1478\n"
-                                   "f 1439/1543/1453 1438/1541/1451 1470/1568/1477\n"
-                                   "f 1425/1542/1452 1457/1569/1478 1458/1571/1480\n"
-                                   "f 1440/1545/1455 1439/1543/1453 1471/1570/1479\n"
-                                   "f 1427/1546/1456 1426/1544/1454 1458/1571/1480\n"
-                                   "f 1440/1545/1455 1472/1572/1481 1473/1574/1483\n"
-                                   "f 1427/1546/1456 1459/1573/1482 1460/1575/1484\n"
-                                   "f 1441/1547/1457 1473/1574/1483 1474/1576/1485\n"
-                                   "f 1429/1549/1459 1428/1548/1458 1460/1575/1484\n"
-                                   "f 1443/1518/1430 1442/1517/1429 1474/1576/1485\n"
-                                   "f 1429/1549/1459 1461/1577/1486 1462/1579/1488\n"
-                                   "f 1443/1518/1430 1475/1578/1487 1476/1582/1490\n"
-                                   "f 1431/1523/1434 1430/1519/1431 1462/1579/1488\n"
-                                   "f 1417/1521/1432 1449/1581/1489 1450/1553/1463\n"
-                                   "f 1479/1558/1468 1478/1555/1465 1509/1583/1491\n"
-                                   "f 1465/1556/1466 1496/1614/1520 1497/1585/1493\n"
-                                   "f 1452/1557/1467 1483/1615/1521 1484/1586/1494\n"
-                                   "f 1467/1562/1471 1466/1559/1469 1497/1585/1493\n"
-                                   "f 1453/1560/1470 1484/1586/1494 1485/1589/1496\n"
-                                   "f 1467/1562/1471 1498/1588/1495 1499/1590/1497\n"
-                                   "f 1455/1565/1474 1454/1563/1472 1485/1589/1496\n"
-                                   "f 1468/1564/1473 1499/1590/1497 1500/1592/1499\n"
-                                   "f 1456/1567/1476 1455/1565/1474 1486/1591/1498\n"
-                                   "f 1469/1566/1475 1500/1592/1499 1501/1594/1501\n"
-                                   "f 1456/1567/1476 1487/1593/1500 1488/1595/1502\n"
-                                   "f 1471/1570/1479 1470/1568/1477 1501/1594/1501\n"
-                                   "f 1457/1569/1478 1488/1595/1502 1489/1597/1504\n"
-                                   "f 1472/1572/1481 1471/1570/1479 1502/1596/1503\n"
-                                   "f 1459/1573/1482 1458/1571/1480 1489/1597/1504\n"
-                                   "f 1472/1572/1481 1503/1598/1505 1504/1600/1507\n"
-                                   "f 1459/1573/1482 1490/1599/1506 1491/1601/1508\n"
-                                   "f 1473/1574/1483 1504/1600/1507 1505/1602/1509\n"
-                                   "f 1461/1577/1486 1460/1575/1484 1491/1601/1508\n"
-                                   "f 1475/1578/1487 1474/1576/1485 1505/1602/1509\n"
-                                   "f 1461/1577/1486 1492/1603/1510 1493/1605/1512\n"
-                                   "f 1476/1582/1490 1475/1578/1487 1506/1604/1511\n"
-                                   "f 1463/1551/1461 1462/1579/1488 1493/1605/1512\n"
-                                   "f 1449/1581/1489 1480/1607/1513 1481/1610/1516\n"
-                                   "f 1477/1550/1460 1476/1582/1490 1507/1608/1514\n"
-                                   "f 1464/1552/1462 1463/1551/1461 1494/1609/1515\n"
-                                   "f 1450/1553/1463 1481/1610/1516 1482/1613/1519\n"
-                                   "f 1478/1555/1465 1477/1550/1460 1508/1611/1517\n"
-                                   "f 1464/1552/1462 1495/1612/1518 1496/1614/1520\n"
-                                   "f 1451/1554/1464 1482/1613/1519 1483/1615/1521\n"
-                                   "f 1498/1616/1495 1529/1678/1552 1530/1617/1522\n"
-                                   "f 1486/1619/1498 1485/1679/1496 1516/1620/1523\n"
-                                   "f 1499/1618/1497 1530/1617/1522 1531/1622/1525\n"
-                                   "f 1487/1624/1500 1486/1619/1498 1517/1621/1524\n"
-                                   "f 1500/1623/1499 1531/1622/1525 1532/1626/1527\n"
-                                   "f 1487/1624/1500 1518/1625/1526 1519/1628/1528\n"
-                                   "f 1502/1630/1503 1501/1627/1501 1532/1626/1527\n"
-                                   "f 1488/1629/1502 1519/1628/1528 1520/1632/1530\n"
-                                   "f 1503/1634/1505 1502/1630/1503 1533/1631/1529\n"
-                                   "f 1490/1636/1506 1489/1633/1504 1520/1632/1530\n"
-                                   "f 1503/1634/1505 1534/1635/1531 1535/1638/1533\n"
-                                   "f 1490/1636/1506 1521/1637/1532 1522/1640/1534\n"
-                                   "f 1504/1639/1507 1535/1638/1533 1536/1642/1535\n"
-                                   "f 1492/1644/1510 1491/1641/1508 1522/1640/1534\n"
-                                   "f 1506/1646/1511 1505/1643/1509 1536/1642/1535\n"
-                                   "f 1492/1644/1510 1523/1645/1536 1524/1648/1538\n"
-                                   "f 1506/1646/1511 1537/1647/1537 1538/1653/1540\n"
-                                   "f 1494/1655/1515 1493/1649/1512 1524/1648/1538\n"
-                                   "f 1480/1650/1513 1511/1652/1539 1512/1657/1542\n"
-                                   "f 1508/1659/1517 1507/1654/1514 1538/1653/1540\n"
-                                   "f 1495/1661/1518 1494/1655/1515 1525/1656/1541\n"
-                                   "f 1482/1663/1519 1481/1658/1516 1512/1657/1542\n"
-                                   "f 1508/1659/1517 1539/1660/1543 1540/1665/1546\n"
-                                   "f 1495/1661/1518 1526/1662/1544 1527/1667/1547\n"
-                                   "f 1483/1669/1521 1482/1663/1519 1513/1664/1545\n"
-                                   "f 1510/1671/1492 1509/1666/1491 1540/1665/1546\n"
-                                   "f 1496/1668/1520 1527/1667/1547 1528/1673/1550\n"
-                                   "f 1483/1669/1521 1514/1670/1548 1515/1675/1551\n"
-                                   "f 1498/1616/1495 1497/1674/1493 1528/1673/1550\n"
-                                   "f 1484/1676/1494 1515/1675/1551 1516/1620/1523\n"
-                                   "f 1531/1622/1525 1562/1711/1582 1563/1680/1553\n"
-                                   "f 1518/1625/1526 1549/1712/1583 1550/1681/1554\n"
-                                   "f 1533/1631/1529 1532/1626/1527 1563/1680/1553\n"
-                                   "f 1519/1628/1528 1550/1681/1554 1551/1683/1556\n"
-                                   "f 1534/1635/1531 1533/1631/1529 1564/1682/1555\n"
-                                   "f 1521/1637/1532 1520/1632/1530 1551/1683/1556\n"
-                                   "f 1534/1635/1531 1565/1684/1557 1566/1686/1559\n"
-                                   "f 1521/1637/1532 1552/1685/1558 1553/1687/1560\n"
-                                   "f 1535/1638/1533 1566/1686/1559 1567/1688/1561\n"
-                                   "f 1523/1645/1536 1522/1640/1534 1553/1687/1560\n"
-                                   "f 1537/1647/1537 1536/1642/1535 1567/1688/1561\n"
-                                   "f 1523/1645/1536 1554/1689/1562 1555/1691/1564\n"
-                                   "f 1538/1653/1540 1537/1647/1537 1568/1690/1563\n"
-                                   "f 1525/1656/1541 1524/1648/1538 1555/1691/1564\n"
-                                   "f 1511/1652/1539 1542/1693/1565 1543/1696/1568\n"
-                                   "f 1538/1653/1540 1569/1694/1566 1570/1697/1569\n"
-                                   "f 1526/1662/1544 1525/1656/1541 1556/1695/1567\n"
-                                   "f 1513/1664/1545 1512/1657/1542 1543/1696/1568\n"
-                                   "f 1540/1665/1546 1539/1660/1543 1570/1697/1569\n"
-                                   "f 1526/1662/1544 1557/1698/1570 1558/1701/1573\n"
-                                   "f 1514/1670/1548 1513/1664/1545 1544/1699/1571\n"
-                                   "f 1541/1672/1549 1540/1665/1546 1571/1700/1572\n"
-                                   "f 1527/1667/1547 1558/1701/1573 1559/1704/1576\n"
-                                   "f 1514/1670/1548 1545/1702/1574 1546/1705/1577\n"
-                                   "f 1529/1678/1552 1528/1673/1550 1559/1704/1576\n"
-                                   "f 1515/1675/1551 1546/1705/1577 1547/1708/1579\n"
-                                   "f 1529/1678/1552 1560/1707/1578 1561/1709/1580\n"
-                                   "f 1517/1621/1524 1516/1620/1523 1547/1708/1579\n"
-                                   "f 1530/1617/1522 1561/1709/1580 1562/1711/1582\n"
-                                   "f 1518/1625/1526 1517/1621/1524 1548/1710/1581\n"
-                                   "f 1565/1684/1557 1564/1682/1555 1595/1713/1584\n"
-                                   "f 1552/1685/1558 1551/1683/1556 1582/1715/1586\n"
-                                   "f 1565/1684/1557 1596/1714/1585 1597/1717/1588\n"
-                                   "f 1552/1685/1558 1583/1716/1587 1584/1718/1589\n"
-                                   "f 1566/1686/1559 1597/1717/1588 1598/1719/1590\n"
-                                   "f 1554/1689/1562 1553/1687/1560 1584/1718/1589\n"
-                                   "f 1568/1690/1563 1567/1688/1561 1598/1719/1590\n"
-                                   "f 1554/1689/1562 1585/1720/1591 1586/1722/1593\n"
-                                   "f 1568/1690/1563 1599/1721/1592 1600/1725/1595\n"
-                                   "f 1556/1695/1567 1555/1691/1564 1586/1722/1593\n"
-                                   "f 1542/1693/1565 1573/1724/1594 1574/1727/1597\n"
-                                   "f 1570/1697/1569 1569/1694/1566 1600/1725/1595\n"
-                                   "f 1557/1698/1570 1556/1695/1567 1587/1726/1596\n"
-                                   "f 1544/1699/1571 1543/1696/1568 1574/1727/1597\n"
-                                   "f 1570/1697/1569 1601/1728/1598 1602/1731/1601\n"
-                                   "f 1557/1698/1570 1588/1729/1599 1589/1732/1602\n"
-                                   "f 1545/1702/1574 1544/1699/1571 1575/1730/1600\n"
-                                   "f 1572/1703/1575 1571/1700/1572 1602/1731/1601\n"
-                                   "f 1558/1701/1573 1589/1732/1602 1590/1735/1605\n"
-                                   "f 1545/1702/1574 1576/1733/1603 1577/1736/1606\n"
-                                   "f 1560/1707/1578 1559/1704/1576 1590/1735/1605\n"
-                                   "f 1546/1705/1577 1577/1736/1606 1578/1739/1608\n"
-                                   "f 1560/1707/1578 1591/1738/1607 1592/1740/1609\n"
-                                   "f 1548/1710/1581 1547/1708/1579 1578/1739/1608\n"
-                                   "f 1561/1709/1580 1592/1740/1609 1593/1742/1611\n"
-                                   "f 1549/1712/1583 1548/1710/1581 1579/1741/1610\n"
-                                   "f 1562/1711/1582 1593/1742/1611 1594/1744/1613\n"
-                                   "f 1549/1712/1583 1580/1743/1612 1581/1745/1614\n"
-                                   "f 1564/1682/1555 1563/1680/1553 1594/1744/1613\n"
-                                   "f 1550/1681/1554 1581/1745/1614 1582/1715/1586\n"
-                                   "f 1596/1714/1585 1627/1777/1644 1628/1746/1615\n"
-                                   "f 1583/1716/1587 1614/1778/1645 1615/1747/1616\n"
-                                   "f 1597/1717/1588 1628/1746/1615 1629/1748/1617\n"
-                                   "f 1585/1720/1591 1584/1718/1589 1615/1747/1616\n"
-                                   "f 1599/1721/1592 1598/1719/1590 1629/1748/1617\n"
-                                   "f 1585/1720/1591 1616/1749/1618 1617/1751/1620\n"
-                                   "f 1599/1721/1592 1630/1750/1619 1631/1754/1622\n"
-                                   "f 1587/1726/1596 1586/1722/1593 1617/1751/1620\n"
-                                   "f 1573/1724/1594 1604/1753/1621 1605/1756/1624\n"
-                                   "f 1600/1725/1595 1631/1754/1622 1632/1757/1625\n"
-                                   "f 1588/1729/1599 1587/1726/1596 1618/1755/1623\n"
-                                   "f 1574/1727/1597 1605/1756/1624 1606/1759/1627\n"
-                                   "f 1601/1728/1598 1632/1757/1625 1633/1760/1628\n"
-                                   "f 1588/1729/1599 1619/1758/1626 1620/1761/1629\n"
-                                   "f 1576/1733/1603 1575/1730/1600 1606/1759/1627\n"
-                                   "f 1602/1731/1601 1633/1760/1628 1634/1763/1631\n"
-                                   "f 1589/1732/1602 1620/1761/1629 1621/1764/1632\n"
-                                   "f 1576/1733/1603 1607/1762/1630 1608/1765/1633\n"
-                                   "f 1591/1738/1607 1590/1735/1605 1621/1764/1632\n"
-                                   "f 1577/1736/1606 1608/1765/1633 1609/1768/1635\n"
-                                   "f 1591/1738/1607 1622/1767/1634 1623/1769/1636\n"
-                                   "f 1579/1741/1610 1578/1739/1608 1609/1768/1635\n"
-                                   "f 1593/1742/1611 1592/1740/1609 1623/1769/1636\n"
-                                   "f 1580/1743/1612 1579/1741/1610 1610/1770/1637\n"
-                                   "f 1593/1742/1611 1624/1771/1638 1625/1773/1640\n"
-                                   "f 1580/1743/1612 1611/1772/1639 1612/1774/1641\n"
-                                   "f 1595/1713/1584 1594/1744/1613 1625/1773/1640\n"
-                                   "f 1581/1745/1614 1612/1774/1641 1613/1776/1643\n"
-                                   "f 1596/1714/1585 1595/1713/1584 1626/1775/1642\n"
-                                   "f 1583/1716/1587 1582/1715/1586 1613/1776/1643\n"
-                                   "f 1630/1750/1619 1629/1748/1617 1660/1779/1646\n"
-                                   "f 1616/1749/1618 1647/1811/1676 1648/1781/1648\n"
-                                   "f 1630/1750/1619 1661/1780/1647 1662/1784/1650\n"
-                                   "f 1618/1755/1623 1617/1751/1620 1648/1781/1648\n"
-                                   "f 1604/1753/1621 1635/1783/1649 1636/1786/1652\n"
-                                   "f 1632/1757/1625 1631/1754/1622 1662/1784/1650\n"
-                                   "f 1619/1758/1626 1618/1755/1623 1649/1785/1651\n"
-                                   "f 1606/1759/1627 1605/1756/1624 1636/1786/1652\n"
-                                   "f 1632/1757/1625 1663/1787/1653 1664/1790/1656\n"
-                                   "f 1619/1758/1626 1650/1788/1654 1651/1791/1657\n"
-                                   "f 1607/1762/1630 1606/1759/1627 1637/1789/1655\n"
-                                   "f 1633/1760/1628 1664/1790/1656 1665/1793/1659\n"
-                                   "f 1620/1761/1629 1651/1791/1657 1652/1794/1660\n"
-                                   "f 1607/1762/1630 1638/1792/1658 1639/1795/1661\n"
-                                   "f 1622/1767/1634 1621/1764/1632 1652/1794/1660\n"
-                                   "f 1608/1765/1633 1639/1795/1661 1640/1798/1663\n"
-                                   "f 1622/1767/1634 1653/1797/1662 1654/1799/1664\n"
-                                   "f 1610/1770/1637 1609/1768/1635 1640/1798/1663\n"
-                                   "f 1623/1769/1636 1654/1799/1664 1655/1801/1666\n"
-                                   "f 1611/1772/1639 1610/1770/1637 1641/1800/1665\n"
-                                   "f 1624/1771/1638 1655/1801/1666 1656/1803/1668\n"
-                                   "f 1611/1772/1639 1642/1802/1667 1643/1804/1669\n"
-                                   "f 1626/1775/1642 1625/1773/1640 1656/1803/1668\n"
-                                   "f 1612/1774/1641 1643/1804/1669 1644/1806/1671\n"
-                                   "f 1627/1777/1644 1626/1775/1642 1657/1805/1670\n"
-                                   "f 1614/1778/1645 1613/1776/1643 1644/1806/1671\n"
-                                   "f 1627/1777/1644 1658/1807/1672 1659/1809/1674\n"
-                                   "f 1614/1778/1645 1645/1808/1673 1646/1810/1675\n"
-                                   "f 1628/1746/1615 1659/1809/1674 1660/1779/1646\n"
-                                   "f 1616/1749/1618 1615/1747/1616 1646/1810/1675\n"
-                                   "f 1635/1783/1649 1666/1844/1707 1667/1812/1677\n"
-                                   "f 1663/1787/1653 1662/1784/1650 1693/1813/1678\n"
-                                   "f 1650/1788/1654 1649/1785/1651 1680/1815/1680\n"
-                                   "f 1637/1789/1655 1636/1786/1652 1667/1812/1677\n"
-                                   "f 1663/1787/1653 1694/1814/1679 1695/1818/1683\n"
-                                   "f 1650/1788/1654 1681/1816/1681 1682/1819/1684\n"
-                                   "f 1637/1789/1655 1668/1817/1682 1669/1820/1685\n"
-                                   "f 1665/1793/1659 1664/1790/1656 1695/1818/1683\n"
-                                   "f 1651/1791/1657 1682/1819/1684 1683/1822/1687\n"
-                                   "f 1638/1792/1658 1669/1820/1685 1670/1823/1688\n"
-                                   "f 1653/1797/1662 1652/1794/1660 1683/1822/1687\n"
-                                   "f 1639/1795/1661 1670/1823/1688 1671/1826/1690\n"
-                                   "f 1654/1799/1664 1653/1797/1662 1684/1825/1689\n"
-                                   "f 1641/1800/1665 1640/1798/1663 1671/1826/1690\n"
-                                   "f 1654/1799/1664 1685/1827/1691 1686/1829/1693\n"
-                                   "f 1642/1802/1667 1641/1800/1665 1672/1828/1692\n"
-                                   "f 1655/1801/1666 1686/1829/1693 1687/1831/1695\n"
-                                   "f 1642/1802/1667 1673/1830/1694 1674/1832/1696\n"
-                                   "f 1657/1805/1670 1656/1803/1668 1687/1831/1695\n"
-                                   "f 1643/1804/1669 1674/1832/1696 1675/1834/1698\n"
-                                   "f 1658/1807/1672 1657/1805/1670 1688/1833/1697\n"
-                                   "f 1645/1808/1673 1644/1806/1671 1675/1834/1698\n"
-                                   "f 1658/1807/1672 1689/1835/1699 1690/1837/1701\n"
-                                   "f 1645/1808/1673 1676/1836/1700 1677/1838/1702\n"
-                                   "f 1659/1809/1674 1690/1837/1701 1691/1839/1703\n"
-                                   "f 1647/1811/1676 1646/1810/1675 1677/1838/1702\n"
-                                   "f 1661/1780/1647 1660/1779/1646 1691/1839/1703\n"
-                                   "f 1647/1811/1676 1678/1840/1704 1679/1842/1706\n"
-                                   "f 1661/1780/1647 1692/1841/1705 1693/1813/1678\n"
-                                   "f 1649/1785/1651 1648/1781/1648 1679/1842/1706\n"
-                                   "f 1669/1820/1685 1668/1817/1682 1699/1845/1708\n"
-                                   "f 1695/1818/1683 1726/1876/1737 1727/1847/1710\n"
-                                   "f 1682/1819/1684 1713/1877/1738 1714/1848/1711\n"
-                                   "f 1670/1823/1688 1669/1820/1685 1700/1846/1709\n"
-                                   "f 1684/1825/1689 1683/1822/1687 1714/1848/1711\n"
-                                   "f 1670/1823/1688 1701/1849/1712 1702/1852/1714\n"
-                                   "f 1684/1825/1689 1715/1851/1713 1716/1853/1715\n"
-                                   "f 1672/1828/1692 1671/1826/1690 1702/1852/1714\n"
-                                   "f 1685/1827/1691 1716/1853/1715 1717/1855/1717\n"
-                                   "f 1673/1830/1694 1672/1828/1692 1703/1854/1716\n"
-                                   "f 1686/1829/1693 1717/1855/1717 1718/1857/1719\n"
-                                   "f 1673/1830/1694 1704/1856/1718 1705/1858/1720\n"
-                                   "f 1688/1833/1697 1687/1831/1695 1718/1857/1719\n"
-                                   "f 1674/1832/1696 1705/1858/1720 1706/1860/1722\n"
-                                   "f 1689/1835/1699 1688/1833/1697 1719/1859/1721\n"
-                                   "f 1676/1836/1700 1675/1834/1698 1706/1860/1722\n"
-                                   "f 1689/1835/1699 1720/1861/1723 1721/1863/1725\n"
-                                   "f 1676/1836/1700 1707/1862/1724 1708/1864/1726\n"
-                                   "f 1690/1837/1701 1721/1863/1725 1722/1865/1727\n"
-                                   "f 1678/1840/1704 1677/1838/1702 1708/1864/1726\n"
-                                   "f 1692/1841/1705 1691/1839/1703 1722/1865/1727\n"
-                                   "f 1678/1840/1704 1709/1866/1728 1710/1868/1730\n"
-                                   "f 1692/1841/1705 1723/1867/1729 1724/1871/1732\n"
-                                   "f 1680/1815/1680 1679/1842/1706 1710/1868/1730\n"
-                                   "f 1666/1844/1707 1697/1870/1731 1698/1873/1734\n"
-                                   "f 1694/1814/1679 1693/1813/1678 1724/1871/1732\n"
-                                   "f 1681/1816/1681 1680/1815/1680 1711/1872/1733\n"
-                                   "f 1668/1817/1682 1667/1812/1677 1698/1873/1734\n"
-                                   "f 1694/1814/1679 1725/1874/1735 1726/1876/1737\n"
-                                   "f 1681/1816/1681 1712/1875/1736 1713/1877/1738\n"
-                                   "f 1701/1849/1712 1732/1908/1768 1733/1878/1739\n"
-                                   "f 1715/1851/1713 1746/1910/1769 1747/1879/1740\n"
-                                   "f 1703/1854/1716 1702/1852/1714 1733/1878/1739\n"
-                                   "f 1716/1853/1715 1747/1879/1740 1748/1881/1742\n"
-                                   "f 1704/1856/1718 1703/1854/1716 1734/1880/1741\n"
-                                   "f 1717/1855/1717 1748/1881/1742 1749/1883/1744\n"
-                                   "f 1704/1856/1718 1735/1882/1743 1736/1884/1745\n"
-                                   "f 1719/1859/1721 1718/1857/1719 1749/1883/1744\n"
-                                   "f 1705/1858/1720 1736/1884/1745 1737/1886/1747\n"
-                                   "f 1720/1861/1723 1719/1859/1721 1750/1885/1746\n"
-                                   "f 1707/1862/1724 1706/1860/1722 1737/1886/1747\n"
-                                   "f 1720/1861/1723 1751/1887/1748 1752/1889/1750\n"
-                                   "f 1707/1862/1724 1738/1888/1749 1739/1890/1751\n"
-                                   "f 1721/1863/1725 1752/1889/1750 1753/1891/1752\n"
-                                   "f 1709/1866/1728 1708/1864/1726 1739/1890/1751\n"
-                                   "f 1723/1867/1729 1722/1865/1727 1753/1891/1752\n"
-                                   "f 1709/1866/1728 1740/1892/1753 1741/1894/1755\n"
-                                   "f 1723/1867/1729 1754/1893/1754 1755/1897/1757\n"
-                                   "f 1711/1872/1733 1710/1868/1730 1741/1894/1755\n"
-                                   "f 1697/1870/1731 1728/1896/1756 1729/1899/1759\n"
-                                   "f 1725/1874/1735 1724/1871/1732 1755/1897/1757\n"
-                                   "f 1712/1875/1736 1711/1872/1733 1742/1898/1758\n"
-                                   "f 1699/1845/1708 1698/1873/1734 1729/1899/1759\n"
-                                   "f 1725/1874/1735 1756/1900/1760 1757/1903/1763\n"
-                                   "f 1712/1875/1736 1743/1901/1761 1744/1904/1764\n"
-                                   "f 1700/1846/1709 1699/1845/1708 1730/1902/1762\n"
-                                   "f 1727/1847/1710 1726/1876/1737 1757/1903/1763\n"
-                                   "f 1713/1877/1738 1744/1904/1764 1745/1907/1767\n"
-                                   "f 1701/1849/1712 1700/1846/1709 1731/1905/1765\n"
-                                   "f 1715/1851/1713 1714/1848/1711 1745/1907/1767\n"
-                                   "f 1735/1882/1743 1734/1880/1741 1765/1911/1770\n"
-                                   "f 1748/1881/1742 1779/1943/1800 1780/1913/1772\n"
-                                   "f 1735/1882/1743 1766/1912/1771 1767/1914/1773\n"
-                                   "f 1750/1885/1746 1749/1883/1744 1780/1913/1772\n"
-                                   "f 1736/1884/1745 1767/1914/1773 1768/1916/1775\n"
-                                   "f 1751/1887/1748 1750/1885/1746 1781/1915/1774\n"
-                                   "f 1738/1888/1749 1737/1886/1747 1768/1916/1775\n"
-                                   "f 1751/1887/1748 1782/1917/1776 1783/1919/1778\n"
-                                   "f 1738/1888/1749 1769/1918/1777 1770/1920/1779\n"
-                                   "f 1752/1889/1750 1783/1919/1778 1784/1921/1780\n"
-                                   "f 1740/1892/1753 1739/1890/1751 1770/1920/1779\n"
-                                   "f 1754/1893/1754 1753/1891/1752 1784/1921/1780\n"
-                                   "f 1740/1892/1753 1771/1922/1781 1772/1924/1783\n"
-                                   "f 1754/1893/1754 1785/1923/1782 1786/1927/1785\n"
-                                   "f 1742/1898/1758 1741/1894/1755 1772/1924/1783\n"
-                                   "f 1729/1899/1759 1728/1896/1756 1759/1926/1784\n"
-                                   "f 1756/1900/1760 1755/1897/1757 1786/1927/1785\n"
-                                   "f 1743/1901/1761 1742/1898/1758 1773/1928/1786\n"
-                                   "f 1729/1899/1759 1760/1929/1787 1761/1932/1790\n"
-                                   "f 1756/1900/1760 1787/1930/1788 1788/1933/1791\n"
-                                   "f 1743/1901/1761 1774/1931/1789 1775/1934/1792\n"
-                                   "f 1730/1902/1762 1761/1932/1790 1762/1935/1793\n"
-                                   "f 1757/1903/1763 1788/1933/1791 1789/1936/1794\n"
-                                   "f 1744/1904/1764 1775/1934/1792 1776/1937/1795\n"
-                                   "f 1731/1905/1765 1762/1935/1793 1763/1938/1796\n"
-                                   "f 1746/1910/1769 1745/1907/1767 1776/1937/1795\n"
-                                   "f 1732/1908/1768 1763/1938/1796 1764/1941/1798\n"
-                                   "f 1746/1910/1769 1777/1940/1797 1778/1942/1799\n"
-                                   "f 1734/1880/1741 1733/1878/1739 1764/1941/1798\n"
-                                   "f 1747/1879/1740 1778/1942/1799 1779/1943/1800\n"
-                                   "f 1767/1914/1773 1798/1976/1831 1799/1944/1801\n"
-                                   "f 1782/1917/1776 1781/1915/1774 1812/1945/1802\n"
-                                   "f 1769/1918/1777 1768/1916/1775 1799/1944/1801\n"
-                                   "f 1782/1917/1776 1813/1946/1803 1814/1948/1805\n"
-                                   "f 1769/1918/1777 1800/1947/1804 1801/1949/1806\n"
-                                   "f 1783/1919/1778 1814/1948/1805 1815/1950/1807\n"
-                                   "f 1771/1922/1781 1770/1920/1779 1801/1949/1806\n"
-                                   "f 1785/1923/1782 1784/1921/1780 1815/1950/1807\n"
-                                   "f 1771/1922/1781 1802/1951/1808 1803/1953/1810\n"
-                                   "f 1786/1927/1785 1785/1923/1782 1816/1952/1809\n"
-                                   "f 1773/1928/1786 1772/1924/1783 1803/1953/1810\n"
-                                   "f 1759/1926/1784 1790/1955/1811 1791/1958/1814\n"
-                                   "f 1787/1930/1788 1786/1927/1785 1817/1956/1812\n"
-                                   "f 1774/1931/1789 1773/1928/1786 1804/1957/1813\n"
-                                   "f 1761/1932/1790 1760/1929/1787 1791/1958/1814\n"
-                                   "f 1787/1930/1788 1818/1959/1815 1819/1962/1818\n"
-                                   "f 1774/1931/1789 1805/1960/1816 1806/1963/1819\n"
-                                   "f 1762/1935/1793 1761/1932/1790 1792/1961/1817\n"
-                                   "f 1789/1936/1794 1788/1933/1791 1819/1962/1818\n"
-                                   "f 1775/1934/1792 1806/1963/1819 1807/1966/1822\n"
-                                   "f 1762/1935/1793 1793/1964/1820 1794/1967/1823\n"
-                                   "f 1777/1940/1797 1776/1937/1795 1807/1966/1822\n"
-                                   "f 1763/1938/1796 1794/1967/1823 1795/1970/1825\n"
-                                   "f 1778/1942/1799 1777/1940/1797 1808/1969/1824\n"
-                                   "f 1765/1911/1770 1764/1941/1798 1795/1970/1825\n"
-                                   "f 1778/1942/1799 1809/1971/1826 1810/1973/1828\n"
-                                   "f 1766/1912/1771 1765/1911/1770 1796/1972/1827\n"
-                                   "f 1779/1943/1800 1810/1973/1828 1811/1975/1830\n"
-                                   "f 1766/1912/1771 1797/1974/1829 1798/1976/1831\n"
-                                   "f 1781/1915/1774 1780/1913/1772 1811/1975/1830\n"
-                                   "f 1800/1947/1804 1831/2008/1861 1832/1977/1832\n"
-                                   "f 1814/1948/1805 1845/2009/1862 1846/1978/1833\n"
-                                   "f 1802/1951/1808 1801/1949/1806 1832/1977/1832\n"
-                                   "f 1816/1952/1809 1815/1950/1807 1846/1978/1833\n"
-                                   "f 1802/1951/1808 1833/1979/1834 1834/1981/1836\n"
-                                   "f 1816/1952/1809 1847/1980/1835 1848/1984/1838\n"
-                                   "f 1804/1957/1813 1803/1953/1810 1834/1981/1836\n"
-                                   "f 1790/1955/1811 1821/1983/1837 1822/1986/1840\n"
-                                   "f 1818/1959/1815 1817/1956/1812 1848/1984/1838\n"
-                                   "f 1805/1960/1816 1804/1957/1813 1835/1985/1839\n"
-                                   "f 1792/1961/1817 1791/1958/1814 1822/1986/1840\n"
-                                   "f 1818/1959/1815 1849/1987/1841 1850/1990/1844\n"
-                                   "f 1805/1960/1816 1836/1988/1842 1837/1991/1845\n"
-                                   "f 1793/1964/1820 1792/1961/1817 1823/1989/1843\n"
-                                   "f 1820/1965/1821 1819/1962/1818 1850/1990/1844\n"
-                                   "f 1806/1963/1819 1837/1991/1845 1838/1994/1848\n"
-                                   "f 1793/1964/1820 1824/1992/1846 1825/1995/1849\n"
-                                   "f 1808/1969/1824 1807/1966/1822 1838/1994/1848\n"
-                                   "f 1794/1967/1823 1825/1995/1849 1826/1998/1851\n"
-                                   "f 1808/1969/1824 1839/1997/1850 1840/1999/1852\n"
-                                   "f 1796/1972/1827 1795/1970/1825 1826/1998/1851\n"
-                                   "f 1809/1971/1826 1840/1999/1852 1841/2001/1854\n"
-                                   "f 1797/1974/1829 1796/1972/1827 1827/2000/1853\n"
-                                   "f 1810/1973/1828 1841/2001/1854 1842/2003/1856\n"
-                                   "f 1797/1974/1829 1828/2002/1855 1829/2004/1857\n"
-                                   "f 1812/1945/1802 1811/1975/1830 1842/2003/1856\n"
-                                   "f 1798/1976/1831 1829/2004/1857 1830/2006/1859\n"
-                                   "f 1813/1946/1803 1812/1945/1802 1843/2005/1858\n"
-                                   "f 1800/1947/1804 1799/1944/1801 1830/2006/1859\n"
-                                   "f 1813/1946/1803 1844/2007/1860 1845/2009/1862\n"
-                                   "f 1833/1979/1834 1864/2041/1892 1865/2010/1863\n"
-                                   "f 1847/1980/1835 1878/2042/1893 1879/2013/1865\n"
-                                   "f 1835/1985/1839 1834/1981/1836 1865/2010/1863\n"
-                                   "f 1821/1983/1837 1852/2012/1864 1853/2015/1867\n"
-                                   "f 1849/1987/1841 1848/1984/1838 1879/2013/1865\n"
-                                   "f 1836/1988/1842 1835/1985/1839 1866/2014/1866\n"
-                                   "f 1823/1989/1843 1822/1986/1840 1853/2015/1867\n"
-                                   "f 1849/1987/1841 1880/2016/1868 1881/2019/1871\n"
-                                   "f 1836/1988/1842 1867/2017/1869 1868/2020/1872\n"
-                                   "f 1824/1992/1846 1823/1989/1843 1854/2018/1870\n"
-                                   "f 1851/1993/1847 1850/1990/1844 1881/2019/1871\n"
-                                   "f 1837/1991/1845 1868/2020/1872 1869/2023/1875\n"
-                                   "f 1824/1992/1846 1855/2021/1873 1856/2024/1876\n"
-                                   "f 1839/1997/1850 1838/1994/1848 1869/2023/1875\n"
-                                   "f 1825/1995/1849 1856/2024/1876 1857/2027/1878\n"
-                                   "f 1839/1997/1850 1870/2026/1877 1871/2028/1879\n"
-                                   "f 1827/2000/1853 1826/1998/1851 1857/2027/1878\n"
-                                   "f 1840/1999/1852 1871/2028/1879 1872/2030/1881\n"
-                                   "f 1828/2002/1855 1827/2000/1853 1858/2029/1880\n"
-                                   "f 1841/2001/1854 1872/2030/1881 1873/2032/1883\n"
-                                   "f 1828/2002/1855 1859/2031/1882 1860/2033/1884\n"
-                                   "f 1843/2005/1858 1842/2003/1856 1873/2032/1883\n"
-                                   "f 1829/2004/1857 1860/2033/1884 1861/2035/1886\n"
-                                   "f 1844/2007/1860 1843/2005/1858 1874/2034/1885\n"
-                                   "f 1831/2008/1861 1830/2006/1859 1861/2035/1886\n"
-                                   "f 1844/2007/1860 1875/2036/1887 1876/2038/1889\n"
-                                   "f 1831/2008/1861 1862/2037/1888 1863/2039/1890\n"
-                                   "f 1845/2009/1862 1876/2038/1889 1877/2040/1891\n"
-                                   "f 1833/1979/1834 1832/1977/1832 1863/2039/1890\n"
-                                   "f 1847/1980/1835 1846/1978/1833 1877/2040/1891\n"
-                                   "f 1867/2017/1869 1866/2014/1866 1897/2043/1894\n"
-                                   "f 1853/2015/1867 1884/2074/1923 1885/2045/1896\n"
-                                   "f 1880/2016/1868 1911/2075/1924 1912/2046/1897\n"
-                                   "f 1867/2017/1869 1898/2044/1895 1899/2047/1898\n"
-                                   "f 1855/2021/1873 1854/2018/1870 1885/2045/1896\n"
-                                   "f 1881/2019/1871 1912/2046/1897 1913/2049/1900\n"
-                                   "f 1868/2020/1872 1899/2047/1898 1900/2050/1901\n"
-                                   "f 1855/2021/1873 1886/2048/1899 1887/2051/1902\n"
-                                   "f 1870/2026/1877 1869/2023/1875 1900/2050/1901\n"
-                                   "f 1856/2024/1876 1887/2051/1902 1888/2054/1904\n"
-                                   "f 1870/2026/1877 1901/2053/1903 1902/2055/1905\n"
-                                   "f 1858/2029/1880 1857/2027/1878 1888/2054/1904\n"
-                                   "f 1872/2030/1881 1871/2028/1879 1902/2055/1905\n"
-                                   "f 1859/2031/1882 1858/2029/1880 1889/2056/1906\n"
-                                   "f 1872/2030/1881 1903/2057/1907 1904/2059/1909\n"
-                                   "f 1859/2031/1882 1890/2058/1908 1891/2060/1910\n"
-                                   "f 1874/2034/1885 1873/2032/1883 1904/2059/1909\n"
-                                   "f 1860/2033/1884 1891/2060/1910 1892/2062/1912\n"
-                                   "f 1875/2036/1887 1874/2034/1885 1905/2061/1911\n"
-                                   "f 1862/2037/1888 1861/2035/1886 1892/2062/1912\n"
-                                   "f 1875/2036/1887 1906/2063/1913 1907/2065/1915\n"
-                                   "f 1862/2037/1888 1893/2064/1914 1894/2066/1916\n"
-                                   "f 1876/2038/1889 1907/2065/1915 1908/2067/1917\n"
-                                   "f 1864/2041/1892 1863/2039/1890 1894/2066/1916\n"
-                                   "f 1878/2042/1893 1877/2040/1891 1908/2067/1917\n"
-                                   "f 1864/2041/1892 1895/2068/1918 1896/2070/1920\n"
-                                   "f 1878/2042/1893 1909/2069/1919 1910/2073/1922\n"
-                                   "f 1866/2014/1866 1865/2010/1863 1896/2070/1920\n"
-                                   "f 1852/2012/1864 1883/2072/1921 1884/2074/1923\n"
-                                   "f 1880/2016/1868 1879/2013/1865 1910/2073/1922\n"
-                                   "f 1899/2047/1898 1930/2107/1954 1931/2076/1925\n"
-                                   "f 1886/2048/1899 1917/2108/1955 1918/2077/1926\n"
-                                   "f 1901/2053/1903 1900/2050/1901 1931/2076/1925\n"
-                                   "f 1887/2051/1902 1918/2077/1926 1919/2081/1929\n"
-                                   "f 1901/2053/1903 1932/2080/1928 1933/2082/1930\n"
-                                   "f 1889/2056/1906 1888/2054/1904 1919/2081/1929\n"
-                                   "f 1903/2057/1907 1902/2055/1905 1933/2082/1930\n"
-                                   "f 1889/2056/1906 1920/2083/1931 1921/2085/1933\n"
-                                   "f 1903/2057/1907 1934/2084/1932 1935/2086/1934\n"
-                                   "f 1890/2058/1908 1921/2085/1933 1922/2087/1935\n"
-                                   "f 1905/2061/1911 1904/2059/1909 1935/2086/1934\n"
-                                   "f 1891/2060/1910 1922/2087/1935 1923/2089/1937\n"
-                                   "f 1906/2063/1913 1905/2061/1911 1936/2088/1936\n"
-                                   "f 1893/2064/1914 1892/2062/1912 1923/2089/1937\n"
-                                   "f 1906/2063/1913 1937/2090/1938 1938/2092/1940\n"
-                                   "f 1893/2064/1914 1924/2091/1939 1925/2093/1941\n"
-                                   "f 1907/2065/1915 1938/2092/1940 1939/2094/1942\n"
-                                   "f 1895/2068/1918 1894/2066/1916 1925/2093/1941\n"
-                                   "f 1909/2069/1919 1908/2067/1917 1939/2094/1942\n"
-                                   "f 1895/2068/1918 1926/2095/1943 1927/2097/1945\n"
-                                   "f 1910/2073/1922 1909/2069/1919 1940/2096/1944\n"
-                                   "f 1897/2043/1894 1896/2070/1920 1927/2097/1945\n"
-                                   "f 1883/2072/1921 1914/2099/1946 1915/2102/1949\n"
-                                   "f 1911/2075/1924 1910/2073/1922 1941/2100/1947\n"
-                                   "f 1898/2044/1895 1897/2043/1894 1928/2101/1948\n"
-                                   "f 1885/2045/1896 1884/2074/1923 1915/2102/1949\n"
-                                   "f 1911/2075/1924 1942/2103/1950 1943/2106/1953\n"
-                                   "f 1898/2044/1895 1929/2104/1951 1930/2107/1954\n"
-                                   "f 1886/2048/1899 1885/2045/1896 1916/2105/1952\n"
-                                   "f 1912/2046/1897 1943/2106/1953 1944/2079/1927\n"
-                                   "f 1932/2080/1928 1963/2141/1986 1964/2109/1956\n"
-                                   "f 1920/2083/1931 1919/2081/1929 1950/2110/1957\n"
-                                   "f 1934/2084/1932 1933/2082/1930 1964/2109/1956\n"
-                                   "f 1921/2085/1933 1920/2083/1931 1951/2111/1958\n"
-                                   "f 1934/2084/1932 1965/2112/1959 1966/2114/1961\n"
-                                   "f 1921/2085/1933 1952/2113/1960 1953/2115/1962\n"
-                                   "f 1936/2088/1936 1935/2086/1934 1966/2114/1961\n"
-                                   "f 1922/2087/1935 1953/2115/1962 1954/2117/1964\n"
-                                   "f 1937/2090/1938 1936/2088/1936 1967/2116/1963\n"
-                                   "f 1924/2091/1939 1923/2089/1937 1954/2117/1964\n"
-                                   "f 1937/2090/1938 1968/2118/1965 1969/2120/1967\n"
-                                   "f 1924/2091/1939 1955/2119/1966 1956/2121/1968\n"
-                                   "f 1938/2092/1940 1969/2120/1967 1970/2122/1969\n"
-                                   "f 1926/2095/1943 1925/2093/1941 1956/2121/1968\n"
-                                   "f 1940/2096/1944 1939/2094/1942 1970/2122/1969\n"
-                                   "f 1926/2095/1943 1957/2123/1970 1958/2125/1972\n"
-                                   "f 1941/2100/1947 1940/2096/1944 1971/2124/1971\n"
-                                   "f 1928/2101/1948 1927/2097/1945 1958/2125/1972\n"
-                                   "f 1914/2099/1946 1945/2127/1973 1946/2130/1976\n"
-                                   "f 1942/2103/1950 1941/2100/1947 1972/2128/1974\n"
-                                   "f 1929/2104/1951 1928/2101/1948 1959/2129/1975\n"
-                                   "f 1916/2105/1952 1915/2102/1949 1946/2130/1976\n"
-                                   "f 1942/2103/1950 1973/2131/1977 1974/2134/1980\n"
-                                   "f 1929/2104/1951 1960/2132/1978 1961/2135/1981\n"
-                                   "f 1917/2108/1955 1916/2105/1952 1947/2133/1979\n"
-                                   "f 1944/2079/1927 1943/2106/1953 1974/2134/1980\n"
-                                   "f 1930/2107/1954 1961/2135/1981 1962/2138/1984\n"
-                                   "f 1917/2108/1955 1948/2136/1982 1949/2139/1985\n"
-                                   "f 1932/2080/1928 1931/2076/1925 1962/2138/1984\n"
-                                   "f 1918/2077/1926 1949/2139/1985 1950/2110/1957\n"
-                                   "f 1965/2112/1959 16/14/14 1981/19/19\n"
-                                   "f 1953/2115/1962 1952/2113/1960 5/17/17\n"
-                                   "f 1967/2116/1963 1966/2114/1961 1981/19/19\n"
-                                   "f 1954/2117/1964 1953/2115/1962 6/21/21\n"
-                                   "f 1968/2118/1965 1967/2116/1963 1982/23/23\n"
-                                   "f 1955/2119/1966 1954/2117/1964 1979/25/25\n"
-                                   "f 1968/2118/1965 17/27/27 18/30/30\n"
-                                   "f 1955/2119/1966 7/29/29 1980/32/32\n"
-                                   "f 1969/2120/1967 18/30/30 1983/34/34\n"
-                                   "f 1957/2123/1970 1956/2121/1968 1980/32/32\n"
-                                   "f 1970/2122/1969 1983/34/34 19/38/38\n"
-                                   "f 1957/2123/1970 8/36/36 9/41/41\n"
-                                   "f 1971/2124/1971 19/38/38 1984/46/46\n"
-                                   "f 1959/2129/1975 1958/2125/1972 9/41/41\n"
-                                   "f 1946/2130/1976 1945/2127/1973 1/42/42\n"
-                                   "f 1973/2131/1977 1972/2128/1974 1984/46/46\n"
-                                   "f 1960/2132/1978 1959/2129/1975 10/48/48\n"
-                                   "f 1946/2130/1976 1976/50/50 2/56/56\n"
-                                   "f 1973/2131/1977 1985/52/52 1986/58/58\n"
-                                   "f 1960/2132/1978 11/54/54 12/60/60\n"
-                                   "f 1948/2136/1982 1947/2133/1979 2/56/56\n"
-                                   "f 1974/2134/1980 1986/58/58 20/2/2\n"
-                                   "f 1961/2135/1981 12/60/60 13/4/4\n"
-                                   "f 1949/2139/1985 1948/2136/1982 3/62/62\n"
-                                   "f 1963/2141/1986 1962/2138/1984 13/4/4\n"
-                                   "f 1949/2139/1985 1977/64/64 1978/7/7\n"
-                                   "f 1963/2141/1986 14/6/6 15/11/11\n"
-                                   "f 1951/2111/1958 1950/2110/1957 1978/7/7\n"
-                                   "f 1964/2109/1956 15/11/11 16/14/14\n"
-                                   "f 1952/2113/1960 1951/2111/1958 4/13/13\n"};
+// Vertex positions and triangle indices of uv_sphere.obj, stored in static memory
+EmbeddedMesh uv_sphere_data();
+
+// The mesh of uv_sphere.obj, built on the first call
+const geometry::IndexedTriangleMesh& uv_sphere();
 
 } // namespace shapes
 
@@ -0,0 +1,244 @@
+#include <algorithm>
+
+// SSE is part of every x86-64 target
+#if defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define PHYSSCOPE_SOA_SSE
+#endif
+
+#include "soa_mesh.hpp"
+#include "trace.hpp"
+
+namespace physscope
+{
+
+namespace geometry
+{
+
+/*
+The kernels below are written as independent per-lane loops over whole
+registers (simd_width floats), which compilers vectorize without
+-ffast-math: reductions keep one accumulator per lane and combine the
+lanes at the end, instead of a single serial accumulator. Minimum and
+maximum reductions aren't vectorized that way unless NaNs and signed zeros
+are ignored (-ffast-math), so bounds() uses SSE directly where available.
+*/
+
+namespace
+{
+
+// Minimum and maximum of padded_size values, a nonzero multiple of simd_width aligned to simd_alignment
+void min_max(const float* values, std::size_t padded_size, float& min, float& max)
+{
+#ifdef PHYSSCOPE_SOA_SSE
+    constexpr std::size_t registers{simd_width / 4};
+    // Plain arrays: std::array would drop the alignment attributes of __m128
+    __m128 lane_min[registers];
+    __m128 lane_max[registers];
+    for (std::size_t r = 0; r < registers; ++r)
+    {
+        lane_min[r] = _mm_load_ps(values + 4 * r);
+        lane_max[r] = lane_min[r];
+    }
+    for (std::size_t block = simd_width; block < padded_size; block += simd_width)
+    {
+        for (std::size_t r = 0; r < registers; ++r)
+        {
+            const __m128 value{_mm_load_ps(values + block + 4 * r)};
+            lane_min[r] = _mm_min_ps(lane_min[r], value);
+            lane_max[r] = _mm_max_ps(lane_max[r], value);
+        }
+    }
+
+    std::array<float, simd_width> mins{};
+    std::array<float, simd_width> maxs{};
+    for (std::size_t r = 0; r < registers; ++r)
+    {
+        _mm_storeu_ps(mins.data() + 4 * r, lane_min[r]);
+        _mm_storeu_ps(maxs.data() + 4 * r, lane_max[r]);
+    }
+#else
+    std::array<float, simd_width> mins{};
+    std::array<float, simd_width> maxs{};
+    std::copy_n(values, simd_width, mins.begin());
+    std::copy_n(values, simd_width, maxs.begin());
+    for (std::size_t block = simd_width; block < padded_size; block += simd_width)
+    {
+        for (std::size_t lane = 0; lane < simd_width; ++lane)
+        {
+            const float value{values[block + lane]};
+            mins[lane] = value < mins[lane] ? value : mins[lane];
+            maxs[lane] = value > maxs[lane] ? value : maxs[lane];
+        }
+    }
+#endif
+    min = *std::min_element(mins.begin(), mins.end());
+    max = *std::max_element(maxs.begin(), maxs.end());
+}
+
+} // namespace
+
+SoAVertices::SoAVertices(std::span<const glm::vec3> vertices) : size_{vertices.size()}
+{
+    const std::size_t padded{(size_ + simd_width - 1) / simd_width * simd_width};
+    x_.resize(padded);
+    y_.resize(padded);
+    z_.resize(padded);
+    for (std::size_t i = 0; i < size_; ++i)
+    {
+        x_[i] = vertices[i].x;
+        y_[i] = vertices[i].y;
+        z_[i] = vertices[i].z;
+    }
+    update_padding();
+}
+
+std::size_t SoAVertices::size() const
+{
+    return size_;
+}
+
+std::size_t SoAVertices::padded_size() const
+{
+    return x_.size();
+}
+
+std::span<const float> SoAVertices::x() const
+{
+    return x_;
+}
+
+std::span<const float> SoAVertices::y() const
+{
+    return y_;
+}
+
+std::span<const float> SoAVertices::z() const
+{
+    return z_;
+}
+
+glm::vec3 SoAVertices::vertex(std::size_t index) const
+{
+    return glm::vec3{x_[index], y_[index], z_[index]};
+}
+
+void SoAVertices::set_vertex(std::size_t index, const glm::vec3& position)
+{
+    x_[index] = position.x;
+    y_[index] = position.y;
+    z_[index] = position.z;
+    if (index + 1 == size_)
+    {
+        update_padding();
+    }
+}
+
+void SoAVertices::transform(const glm::mat4& transform)
+{
+    PHYSSCOPE_TRACE_SCOPE("SoAVertices::transform");
+    float* x{x_.data()};
+    float* y{y_.data()};
+    float* z{z_.data()};
+
+    // The padding is transformed as well, so it keeps repeating the last vertex
+    for (std::size_t i = 0; i < x_.size(); ++i)
+    {
+        const float vx{x[i]};
+        const float vy{y[i]};
+        const float vz{z[i]};
+        x[i] = transform[0][0] * vx + transform[1][0] * vy + transform[2][0] * vz + transform[3][0];
+        y[i] = transform[0][1] * vx + transform[1][1] * vy + transform[2][1] * vz + transform[3][1];
+        z[i] = transform[0][2] * vx + transform[1][2] * vy + transform[2][2] * vz + transform[3][2];
+    }
+}
+
+std::vector<glm::vec3> SoAVertices::to_vec3() const
+{
+    std::vector<glm::vec3> vertices(size_);
+    for (std::size_t i = 0; i < size_; ++i)
+    {
+        vertices[i] = glm::vec3{x_[i], y_[i], z_[i]};
+    }
+    return vertices;
+}
+
+void SoAVertices::update_padding()
+{
+    if (size_ == 0)
+    {
+        return;
+    }
+    std::fill(x_.begin() + static_cast<std::ptrdiff_t>(size_), x_.end(), x_[size_ - 1]);
+    std::fill(y_.begin() + static_cast<std::ptrdiff_t>(size_), y_.end(), y_[size_ - 1]);
+    std::fill(z_.begin() + static_cast<std::ptrdiff_t>(size_), z_.end(), z_[size_ - 1]);
+}
+
+AABB bounds(const SoAVertices& vertices)
+{
+    PHYSSCOPE_TRACE_SCOPE("bounds (SoA)");
+    if (vertices.size() == 0)
+    {
+        return AABB{};
+    }
+
+    // The padding repeats a vertex, so it can be included safely
+    std::array<std::span<const float>, 3> coordinates{vertices.x(), vertices.y(), vertices.z()};
+    AABB box{};
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        min_max(coordinates[axis].data(), vertices.padded_size(), box.min[axis], box.max[axis]);
+    }
+    return box;
+}
+
+glm::vec3 centroid(const SoAVertices& vertices)
+{
+    PHYSSCOPE_TRACE_SCOPE("centroid (SoA)");
+    if (vertices.size() == 0)
+    {
+        return glm::vec3{0.0f};
+    }
+
+    // Whole blocks of real vertices are summed lane-wise, the remaining ones (not the padding) one by one
+    const std::size_t full_blocks_end{vertices.size() / simd_width * simd_width};
+    std::array<std::span<const float>, 3> coordinates{vertices.x(), vertices.y(), vertices.z()};
+    glm::vec3 mean{0.0f};
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        const float* values{coordinates[axis].data()};
+        std::array<double, simd_width> lane_sum{};
+        for (std::size_t block = 0; block < full_blocks_end; block += simd_width)
+        {
+            for (std::size_t lane = 0; lane < simd_width; ++lane)
+            {
+                lane_sum[lane] += values[block + lane];
+            }
+        }
+
+        double sum{0.0};
+        for (std::size_t i = full_blocks_end; i < vertices.size(); ++i)
+        {
+            sum += values[i];
+        }
+        for (const double lane : lane_sum)
+        {
+            sum += lane;
+        }
+        mean[axis] = static_cast<float>(sum / static_cast<double>(vertices.size()));
+    }
+    return mean;
+}
+
+SoATriangleMesh::SoATriangleMesh(const IndexedTriangleMesh& mesh) : vertices{mesh.vertices}, indices{mesh.indices}
+{
+}
+
+IndexedTriangleMesh SoATriangleMesh::to_indexed_triangle_mesh() const
+{
+    return IndexedTriangleMesh{.vertices = vertices.to_vec3(), .indices = indices};
+}
+
+} // namespace geometry
+
+} // namespace physscope
\ No newline at end of file
@@ -0,0 +1,116 @@
+#ifndef SOA_MESH_HPP
+#define SOA_MESH_HPP
+
+#include <array>
+#include <cstddef>
+#include <glm/glm.hpp>
+#include <new>
+#include <span>
+#include <vector>
+
+#include "geometry.hpp"
+
+namespace physscope
+{
+
+namespace geometry
+{
+
+// Alignment of the SoA arrays, a cache line, which is also the widest SIMD register (AVX-512)
+inline constexpr std::size_t simd_alignment{64};
+
+// Floats per SIMD register of simd_alignment bytes; SoA arrays are padded to a multiple of it
+inline constexpr std::size_t simd_width{simd_alignment / sizeof(float)};
+
+// Allocator of memory aligned to simd_alignment bytes
+template <typename T>
+struct AlignedAllocator
+{
+    using value_type = T;
+
+    AlignedAllocator() = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U>& /*other*/) noexcept
+    {
+    }
+
+    T* allocate(std::size_t count)
+    {
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{simd_alignment}));
+    }
+
+    void deallocate(T* pointer, std::size_t count) noexcept
+    {
+        ::operator delete(pointer, count * sizeof(T), std::align_val_t{simd_alignment});
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U>& /*other*/) const noexcept
+    {
+        return true;
+    }
+};
+
+using AlignedFloats = std::vector<float, AlignedAllocator<float>>;
+
+/*
+Vertex positions stored as a structure of arrays: one aligned array per
+coordinate, so kernels load a full SIMD register of x (y, z) values at a time
+instead of deinterleaving 12-byte glm::vec3. The arrays are padded to a
+multiple of simd_width with copies of the last vertex, so kernels run over
+whole registers without a scalar tail and padded lanes never change bounds.
+*/
+class SoAVertices
+{
+public:
+    SoAVertices() = default;
+    explicit SoAVertices(std::span<const glm::vec3> vertices);
+
+    std::size_t size() const;
+    std::size_t padded_size() const;
+
+    // Padded arrays of each coordinate
+    std::span<const float> x() const;
+    std::span<const float> y() const;
+    std::span<const float> z() const;
+
+    glm::vec3 vertex(std::size_t index) const;
+    void set_vertex(std::size_t index, const glm::vec3& position);
+
+    // Apply an affine transform to every vertex
+    void transform(const glm::mat4& transform);
+
+    std::vector<glm::vec3> to_vec3() const;
+
+private:
+    void update_padding();
+
+    AlignedFloats x_;
+    AlignedFloats y_;
+    AlignedFloats z_;
+    std::size_t size_{0};
+};
+
+AABB bounds(const SoAVertices& vertices);
+
+// Mean of the vertices, accumulated in double precision; the origin if there are none
+glm::vec3 centroid(const SoAVertices& vertices);
+
+// IndexedTriangleMesh with SoAVertices; triangles are unchanged
+struct SoATriangleMesh
+{
+    SoATriangleMesh() = default;
+    explicit SoATriangleMesh(const IndexedTriangleMesh& mesh);
+
+    IndexedTriangleMesh to_indexed_triangle_mesh() const;
+
+    SoAVertices vertices;
+    std::vector<std::array<IndexedTriangleMesh::index_type, 3>> indices;
+};
+
+} // namespace geometry
+
+} // namespace physscope
+
+#endif // SOA_MESH_HPP
\ No newline at end of file
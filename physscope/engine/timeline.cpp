@@ -0,0 +1,113 @@
+#include <array>
+
+#include "timeline.hpp"
+
+namespace physscope
+{
+
+namespace
+{
+
+constexpr std::array<char, 4> timeline_magic{'P', 'S', 'T', 'L'};
+constexpr std::uint32_t timeline_version{1};
+
+} // namespace
+
+TimelineRecorder::TimelineRecorder(std::ostream& output) : output_{output}, writer_{output}
+{
+    writer_.write(timeline_magic);
+    writer_.write(timeline_version);
+}
+
+TimelineRecorder::~TimelineRecorder()
+{
+    flush();
+}
+
+void TimelineRecorder::record_step(float delta_time)
+{
+    // Consecutive steps with the same time step are stored as a single event
+    if (pending_steps_ > 0 && delta_time != pending_delta_time_)
+    {
+        write_pending_steps();
+    }
+    pending_delta_time_ = delta_time;
+    ++pending_steps_;
+}
+
+void TimelineRecorder::record_parameter(std::string_view name, float value)
+{
+    write_pending_steps();
+    writer_.write(TimelineEvent::parameter);
+    writer_.write(name);
+    writer_.write(value);
+}
+
+void TimelineRecorder::record_restart()
+{
+    write_pending_steps();
+    writer_.write(TimelineEvent::restart);
+}
+
+void TimelineRecorder::flush()
+{
+    write_pending_steps();
+    output_.flush();
+}
+
+void TimelineRecorder::write_pending_steps()
+{
+    if (pending_steps_ == 0)
+    {
+        return;
+    }
+
+    writer_.write(TimelineEvent::steps);
+    writer_.write(pending_delta_time_);
+    writer_.write(pending_steps_);
+    pending_steps_ = 0;
+}
+
+TimelineReader::TimelineReader(std::istream& input) : reader_{input}
+{
+    std::array<char, 4> magic{};
+    std::uint32_t version{0};
+    valid_ = reader_.read(magic) && reader_.read(version) && magic == timeline_magic && version == timeline_version;
+}
+
+bool TimelineReader::valid() const
+{
+    return valid_;
+}
+
+std::optional<TimelineEntry> TimelineReader::next()
+{
+    TimelineEntry entry{};
+    if (!valid_ || !reader_.read(entry.event))
+    {
+        return std::nullopt;
+    }
+
+    bool complete{false};
+    switch (entry.event)
+    {
+    case TimelineEvent::steps:
+        complete = reader_.read(entry.delta_time) && reader_.read(entry.count);
+        break;
+    case TimelineEvent::parameter:
+        complete = reader_.read(entry.name) && reader_.read(entry.value);
+        break;
+    case TimelineEvent::restart:
+        complete = true;
+        break;
+    }
+
+    if (!complete)
+    {
+        valid_ = false;
+        return std::nullopt;
+    }
+    return entry;
+}
+
+} // namespace physscope
\ No newline at end of file
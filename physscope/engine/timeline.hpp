@@ -0,0 +1,90 @@
+#ifndef TIMELINE_HPP
+#define TIMELINE_HPP
+
+#include <cstdint>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "binary_stream.hpp"
+
+namespace physscope
+{
+
+/*
+A timeline is the sequence of events that drives a simulation: physics
+steps, parameter changes and restarts. Replaying a recorded timeline
+from the initial state reproduces the simulation bit by bit.
+
+Binary layout: the magic bytes "PSTL", a uint32 version and then the
+events, each one starting with a TimelineEvent tag:
+    steps:     float delta_time, uint32 count (consecutive equal steps)
+    parameter: uint32 name size, name, float value
+    restart:   no payload
+*/
+enum class TimelineEvent : std::uint8_t
+{
+    steps = 0,
+    parameter = 1,
+    restart = 2,
+};
+
+struct TimelineEntry
+{
+    TimelineEvent event{TimelineEvent::steps};
+    float delta_time{0.0f};
+    std::uint32_t count{0};
+    std::string name;
+    float value{0.0f};
+};
+
+class TimelineRecorder
+{
+public:
+    explicit TimelineRecorder(std::ostream& output);
+
+    // Flushes the pending steps
+    ~TimelineRecorder();
+
+    TimelineRecorder(const TimelineRecorder&) = delete;
+    TimelineRecorder(TimelineRecorder&&) = delete;
+    TimelineRecorder& operator=(const TimelineRecorder&) = delete;
+    TimelineRecorder& operator=(TimelineRecorder&&) = delete;
+
+    void record_step(float delta_time);
+    void record_parameter(std::string_view name, float value);
+    void record_restart();
+
+    // Write the pending steps and flush the underlying stream
+    void flush();
+
+private:
+    void write_pending_steps();
+
+    std::ostream& output_;
+    BinaryWriter writer_;
+    float pending_delta_time_{0.0f};
+    std::uint32_t pending_steps_{0};
+};
+
+class TimelineReader
+{
+public:
+    explicit TimelineReader(std::istream& input);
+
+    // Return false if the stream doesn't start with a valid timeline header
+    bool valid() const;
+
+    // Return the next event, or nothing at the end of the timeline
+    std::optional<TimelineEntry> next();
+
+private:
+    BinaryReader reader_;
+    bool valid_{false};
+};
+
+} // namespace physscope
+
+#endif // TIMELINE_HPP
\ No newline at end of file
@@ -0,0 +1,233 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "trace.hpp"
+
+namespace physscope
+{
+
+namespace trace
+{
+
+namespace
+{
+
+struct Event
+{
+    const char* name;
+    std::int64_t begin;
+    std::int64_t end;
+};
+
+/*
+Events of a thread are stored on a linked list of fixed-size chunks,
+allocated from its first event on, so threads that are only named don't
+pay for them while tracing is off. Only the owner thread appends events;
+readers only see the chunks and events published through head, next and
+the size of each chunk.
+*/
+struct Chunk
+{
+    static constexpr std::size_t capacity{4096};
+
+    std::array<Event, capacity> events{};
+    std::atomic<std::size_t> size{0};
+    std::atomic<Chunk*> next{nullptr};
+};
+
+struct ThreadBuffer
+{
+    explicit ThreadBuffer(std::uint32_t thread_id) : id{thread_id}
+    {
+    }
+
+    ~ThreadBuffer()
+    {
+        Chunk* chunk{head.load()};
+        while (chunk != nullptr)
+        {
+            Chunk* next{chunk->next.load()};
+            delete chunk;
+            chunk = next;
+        }
+    }
+
+    ThreadBuffer(const ThreadBuffer&) = delete;
+    ThreadBuffer(ThreadBuffer&&) = delete;
+    ThreadBuffer& operator=(const ThreadBuffer&) = delete;
+    ThreadBuffer& operator=(ThreadBuffer&&) = delete;
+
+    void append(const Event& event)
+    {
+        if (tail == nullptr)
+        {
+            tail = new Chunk{};
+            head.store(tail, std::memory_order_release);
+        }
+        std::size_t size{tail->size.load(std::memory_order_relaxed)};
+        if (size == Chunk::capacity)
+        {
+            Chunk* chunk{new Chunk{}};
+            tail->next.store(chunk, std::memory_order_release);
+            tail = chunk;
+            size = 0;
+        }
+        tail->events[size] = event;
+        tail->size.store(size + 1, std::memory_order_release);
+    }
+
+    std::uint32_t id;
+    std::string name;
+    std::atomic<Chunk*> head{nullptr};
+    Chunk* tail{nullptr};
+};
+
+struct Registry
+{
+    std::mutex mutex;
+
+    // Buffers are kept alive after their threads exit, until the process ends
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+};
+
+std::atomic<bool> tracing_enabled{false};
+const std::chrono::steady_clock::time_point trace_start{std::chrono::steady_clock::now()};
+
+Registry& registry()
+{
+    static Registry instance{};
+    return instance;
+}
+
+std::shared_ptr<ThreadBuffer> register_thread()
+{
+    Registry& registry_instance{registry()};
+    std::scoped_lock lock_protection{registry_instance.mutex};
+    const auto id{static_cast<std::uint32_t>(registry_instance.buffers.size() + 1)};
+    return registry_instance.buffers.emplace_back(std::make_shared<ThreadBuffer>(id));
+}
+
+ThreadBuffer& thread_buffer()
+{
+    thread_local const std::shared_ptr<ThreadBuffer> buffer{register_thread()};
+    return *buffer;
+}
+
+std::int64_t now_nanoseconds()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - trace_start)
+        .count();
+}
+
+void write_json_string(std::ostream& output, const char* text)
+{
+    output << '"';
+    for (; *text != '\0'; ++text)
+    {
+        if (*text == '"' || *text == '\\')
+        {
+            output << '\\';
+        }
+        output << *text;
+    }
+    output << '"';
+}
+
+} // namespace
+
+void set_enabled(bool enabled)
+{
+    tracing_enabled.store(enabled);
+}
+
+bool is_enabled()
+{
+    return tracing_enabled.load(std::memory_order_relaxed);
+}
+
+void set_thread_name(const std::string& name)
+{
+    ThreadBuffer& buffer{thread_buffer()};
+    std::scoped_lock lock_protection{registry().mutex};
+    buffer.name = name;
+}
+
+bool write_chrome_trace(const std::string& filename)
+{
+    std::ofstream output{filename};
+    if (!output)
+    {
+        return false;
+    }
+
+    Registry& registry_instance{registry()};
+    std::scoped_lock lock_protection{registry_instance.mutex};
+    output << "{\"traceEvents\":[\n";
+    bool first_event{true};
+    const auto separator = [&output, &first_event]
+    {
+        if (!first_event)
+        {
+            output << ",\n";
+        }
+        first_event = false;
+    };
+
+    // Nanosecond timestamps, written exactly as microseconds with three decimals
+    output << std::fixed << std::setprecision(3);
+    for (const std::shared_ptr<ThreadBuffer>& buffer : registry_instance.buffers)
+    {
+        if (!buffer->name.empty())
+        {
+            separator();
+            output << R"({"ph":"M","name":"thread_name","pid":1,"tid":)" << buffer->id << R"(,"args":{"name":)";
+            write_json_string(output, buffer->name.c_str());
+            output << "}}";
+        }
+
+        for (const Chunk* chunk = buffer->head.load(std::memory_order_acquire); chunk != nullptr;
+             chunk = chunk->next.load(std::memory_order_acquire))
+        {
+            const std::size_t size{chunk->size.load(std::memory_order_acquire)};
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                // Complete events; timestamps and durations are in microseconds
+                const Event& event{chunk->events[i]};
+                separator();
+                output << R"({"ph":"X","pid":1,"tid":)" << buffer->id << R"(,"ts":)"
+                       << static_cast<double>(event.begin) / 1000.0 << R"(,"dur":)"
+                       << static_cast<double>(event.end - event.begin) / 1000.0 << R"(,"name":)";
+                write_json_string(output, event.name);
+                output << '}';
+            }
+        }
+    }
+    output << "\n]}\n";
+    return output.good();
+}
+
+Scope::Scope(const char* name) noexcept : name_{name}
+{
+    if (is_enabled())
+    {
+        begin_ = now_nanoseconds();
+    }
+}
+
+Scope::~Scope()
+{
+    if (begin_ >= 0)
+    {
+        thread_buffer().append(Event{.name = name_, .begin = begin_, .end = now_nanoseconds()});
+    }
+}
+
+} // namespace trace
+
+} // namespace physscope
\ No newline at end of file
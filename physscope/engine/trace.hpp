@@ -0,0 +1,71 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <cstdint>
+#include <string>
+
+namespace physscope
+{
+
+namespace trace
+{
+
+/*
+Scoped trace markers, exported to the Chrome trace-event JSON format
+(open the file on https://ui.perfetto.dev or chrome://tracing).
+
+Each thread records its events into its own lock-free buffer, so a
+marker costs a couple of clock reads when tracing is enabled and a
+single atomic load when it's disabled. Use the PHYSSCOPE_TRACE_SCOPE
+macro to mark a scope:
+
+    void physics_update(float delta_time) override
+    {
+        PHYSSCOPE_TRACE_SCOPE("collisions");
+        ...
+    }
+
+Event names must be string literals (or otherwise outlive the trace).
+*/
+
+// Start or stop recording events. Tracing is disabled by default.
+void set_enabled(bool enabled);
+bool is_enabled();
+
+// Name the calling thread on the exported trace
+void set_thread_name(const std::string& name);
+
+/*
+Write every event recorded so far, from all threads, to filename.
+Can be called at any time, even while other threads record events.
+Return false if the file could not be written.
+*/
+bool write_chrome_trace(const std::string& filename);
+
+// Records the time spent between its construction and destruction
+class Scope
+{
+public:
+    explicit Scope(const char* name) noexcept;
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope(Scope&&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    Scope& operator=(Scope&&) = delete;
+
+private:
+    const char* name_;
+    std::int64_t begin_{-1};
+};
+
+} // namespace trace
+
+} // namespace physscope
+
+#define PHYSSCOPE_TRACE_CONCATENATE_IMPL(a, b) a##b
+#define PHYSSCOPE_TRACE_CONCATENATE(a, b) PHYSSCOPE_TRACE_CONCATENATE_IMPL(a, b)
+#define PHYSSCOPE_TRACE_SCOPE(name)                                                                                    \
+    const ::physscope::trace::Scope PHYSSCOPE_TRACE_CONCATENATE(physscope_trace_scope_, __LINE__)(name)
+
+#endif // TRACE_HPP
\ No newline at end of file
@@ -0,0 +1,81 @@
+#ifndef TRIPLE_BUFFER_HPP
+#define TRIPLE_BUFFER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace physscope
+{
+
+/*
+Lock-free single-producer/single-consumer exchange of a value of type T.
+The producer (e.g. the simulation thread) fills write_buffer() and calls
+publish(); the consumer (e.g. the render thread) calls update() to acquire
+the most recently published value and accesses it with read_buffer().
+Neither side ever blocks: the producer may publish many times between two
+reads, in which case the intermediate values are simply skipped.
+
+Note that write_buffer() is not a copy of the last published value; the
+producer must overwrite the whole state before each publish().
+*/
+template <typename T>
+class TripleBuffer
+{
+public:
+    TripleBuffer() = default;
+
+    explicit TripleBuffer(const T& initial_value) : buffers_{initial_value, initial_value, initial_value}
+    {
+    }
+
+    // Producer: buffer where the next value is written
+    T& write_buffer() noexcept
+    {
+        return buffers_[write_index_];
+    }
+
+    // Producer: make the contents of write_buffer() visible to the consumer
+    void publish() noexcept
+    {
+        const std::uint8_t previous{middle_.exchange(write_index_ | dirty_bit, std::memory_order_acq_rel)};
+        write_index_ = previous & index_mask;
+    }
+
+    /*
+    Consumer: acquire the most recently published value, if any.
+    Return true if read_buffer() changed since the previous call.
+    */
+    bool update() noexcept
+    {
+        if ((middle_.load(std::memory_order_relaxed) & dirty_bit) == 0)
+        {
+            return false;
+        }
+
+        const std::uint8_t previous{middle_.exchange(read_index_, std::memory_order_acq_rel)};
+        read_index_ = previous & index_mask;
+        return true;
+    }
+
+    // Consumer: latest value acquired by update()
+    const T& read_buffer() const noexcept
+    {
+        return buffers_[read_index_];
+    }
+
+private:
+    static constexpr std::uint8_t index_mask{0b011};
+    static constexpr std::uint8_t dirty_bit{0b100};
+
+    std::array<T, 3> buffers_{};
+
+    // Each index is accessed by a different thread; keep them on separate cache lines
+    alignas(64) std::uint8_t write_index_{0};
+    alignas(64) std::atomic<std::uint8_t> middle_{1};
+    alignas(64) std::uint8_t read_index_{2};
+};
+
+} // namespace physscope
+
+#endif // TRIPLE_BUFFER_HPP
\ No newline at end of file
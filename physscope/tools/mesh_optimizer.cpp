@@ -0,0 +1,107 @@
+/*
+Optimizes a mesh offline with geometry::optimize_mesh(): welds duplicate
+vertices, reorders the triangles for the vertex cache and the vertices for
+fetching, then writes the result as OBJ (".obj" output) or in the binary mesh
+format (any other extension). Inputs are OBJ files or binary mesh files (".psm").
+
+Usage: mesh_optimizer <input> <output> [--tolerance <distance>] [--cache-size <entries>]
+                      [--no-weld] [--no-vertex-cache] [--no-vertex-fetch]
+*/
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "io.hpp"
+#include "mesh_file.hpp"
+#include "mesh_optimizer.hpp"
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+void print_usage()
+{
+    std::cerr << "Usage: mesh_optimizer <input> <output> [--tolerance <distance>] [--cache-size <entries>]\n"
+                 "                      [--no-weld] [--no-vertex-cache] [--no-vertex-fetch]\n";
+}
+
+physscope::geometry::IndexedTriangleMesh read_mesh(const std::filesystem::path& filename)
+{
+    if (filename.extension() == ".psm")
+    {
+        return physscope::MeshFile{filename}.to_indexed_triangle_mesh();
+    }
+    return physscope::read_triangle_mesh_obj_mapped(filename);
+}
+
+void print_statistics(std::string_view name, const physscope::geometry::IndexedTriangleMesh& mesh,
+                      std::size_t cache_size)
+{
+    std::cout << name << ": " << mesh.num_vertices() << " vertices, " << mesh.num_indices()
+              << " triangles, ACMR " << physscope::geometry::average_cache_miss_ratio(mesh, cache_size) << '\n';
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        print_usage();
+        return 1;
+    }
+
+    const std::filesystem::path input{argv[1]};
+    const std::filesystem::path output{argv[2]};
+    physscope::geometry::MeshOptimizationSettings settings{};
+    for (int i = 3; i < argc; ++i)
+    {
+        const std::string_view option{argv[i]};
+        if (option == "--tolerance" && i + 1 < argc)
+        {
+            settings.weld_tolerance = std::stof(argv[++i]);
+        }
+        else if (option == "--cache-size" && i + 1 < argc)
+        {
+            settings.cache_size = std::stoul(argv[++i]);
+        }
+        else if (option == "--no-weld")
+        {
+            settings.weld = false;
+        }
+        else if (option == "--no-vertex-cache")
+        {
+            settings.optimize_vertex_cache = false;
+        }
+        else if (option == "--no-vertex-fetch")
+        {
+            settings.optimize_vertex_fetch = false;
+        }
+        else
+        {
+            print_usage();
+            return 1;
+        }
+    }
+
+    physscope::geometry::IndexedTriangleMesh mesh{read_mesh(input)};
+    if (mesh.indices.empty())
+    {
+        std::cerr << "No triangles read from " << input << std::endl;
+        return 1;
+    }
+    print_statistics("input ", mesh, settings.cache_size);
+
+    const Clock::time_point start{Clock::now()};
+    physscope::geometry::optimize_mesh(mesh, settings);
+    const double seconds{std::chrono::duration<double>(Clock::now() - start).count()};
+    print_statistics("output", mesh, settings.cache_size);
+    std::cout << "optimized in " << seconds << " s\n";
+
+    const bool written{output.extension() == ".obj" ? physscope::write_triangle_mesh_obj(output, mesh)
+                                                    : physscope::write_mesh_file(output, mesh)};
+    return written ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+"""Converts a Wavefront OBJ file into C++ source with the mesh embedded as constexpr arrays.
+
+Generates <name>.hpp, declaring physscope::shapes::<name>() and <name>_data(), and
+<name>.cpp, holding the vertex positions and triangle indices. Only positions and
+faces are kept; polygons are triangulated as fans. The generated files are meant to
+be committed, so building the engine doesn't require Python.
+
+Usage: python scripts/obj_to_header.py --filename physscope/engine/shapes/uv_sphere.obj
+"""
+import argparse
+import pathlib
+
+MAX_COLUMNS = 120
+INDENT = "    "
+
+
+def parse_obj(wavefront_file: pathlib.Path) -> tuple[list[str], list[int]]:
+    positions: list[str] = []
+    indices: list[int] = []
+    for line in wavefront_file.read_text().splitlines():
+        fields = line.split()
+        if not fields:
+            continue
+        if fields[0] == "v":
+            positions.extend(fields[1:4])
+        elif fields[0] == "f":
+            # "v", "v/vt", "v//vn" or "v/vt/vn"; negative indices are relative to the latest vertex
+            face = []
+            for corner in fields[1:]:
+                index = int(corner.split("/")[0])
+                face.append(index - 1 if index > 0 else len(positions) // 3 + index)
+            for i in range(1, len(face) - 1):
+                indices.extend((face[0], face[i], face[i + 1]))
+    return positions, indices
+
+
+def format_values(values: list[str]) -> str:
+    lines = []
+    current = INDENT
+    for value in values:
+        item = f"{value}, "
+        if len(current) + len(item.rstrip()) > MAX_COLUMNS:
+            lines.append(current.rstrip())
+            current = INDENT
+        current += item
+    lines.append(current.rstrip().rstrip(","))
+    return "\n".join(lines)
+
+
+def float_literal(value: str) -> str:
+    literal = repr(float(value))
+    return f"{literal}f"
+
+
+def write_header(output_dir: pathlib.Path, name: str, source: str) -> None:
+    guard = f"{name.upper()}_HPP"
+    output_dir.joinpath(f"{name}.hpp").write_text(f"""// Generated by scripts/obj_to_header.py from {source}; do not edit.
+#ifndef {guard}
+#define {guard}
+
+#include "geometry.hpp"
+#include "shapes/embedded_mesh.hpp"
+
+namespace physscope
+{{
+
+namespace shapes
+{{
+
+// Vertex positions and triangle indices of {source}, stored in static memory
+EmbeddedMesh {name}_data();
+
+// The mesh of {source}, built on the first call
+const geometry::IndexedTriangleMesh& {name}();
+
+}} // namespace shapes
+
+}} // namespace physscope
+
+#endif // {guard}""")
+
+
+def write_source(output_dir: pathlib.Path, name: str, source: str, positions: list[str], indices: list[int]) -> None:
+    output_dir.joinpath(f"{name}.cpp").write_text(f"""// Generated by scripts/obj_to_header.py from {source}; do not edit.
+#include <array>
+#include <cstdint>
+
+#include "shapes/{name}.hpp"
+
+namespace physscope
+{{
+
+namespace shapes
+{{
+
+namespace
+{{
+
+constexpr std::array<float, {len(positions)}> positions{{
+{format_values([float_literal(value) for value in positions])}}};
+
+constexpr std::array<std::uint32_t, {len(indices)}> indices{{
+{format_values([str(index) for index in indices])}}};
+
+}} // namespace
+
+EmbeddedMesh {name}_data()
+{{
+    return EmbeddedMesh{{.positions = positions, .indices = indices}};
+}}
+
+const geometry::IndexedTriangleMesh& {name}()
+{{
+    static const geometry::IndexedTriangleMesh mesh{{to_indexed_triangle_mesh({name}_data())}};
+    return mesh;
+}}
+
+}} // namespace shapes
+
+}} // namespace physscope""")
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--filename", type=str, required=True, help="Name of the Wavefront OBJ file to convert")
+    parser.add_argument("--name", type=str, help="Name of the generated files and functions (default: file stem)")
+    parser.add_argument("--output-dir", type=str, help="Directory of the generated files (default: OBJ directory)")
+    args = parser.parse_args()
+
+    wavefront_file = pathlib.Path(args.filename)
+    name = args.name or wavefront_file.stem
+    output_dir = pathlib.Path(args.output_dir) if args.output_dir else wavefront_file.parent
+    positions, indices = parse_obj(wavefront_file)
+    write_header(output_dir, name, wavefront_file.name)
+    write_source(output_dir, name, wavefront_file.name, positions, indices)
+
+
+if __name__ == "__main__":
+    main()